@@ -1036,6 +1036,50 @@ namespace BINDER_SPACE
     }
 
 
+#if !defined(DACCESS_COMPILE)
+    /* static */
+    HRESULT AssemblyBinderCommon::PrefetchTpaAssembly(ApplicationContext *pApplicationContext,
+                                                      SString            &simpleName,
+                                                      PEImage           **ppPEImage)
+    {
+        HRESULT hr = S_OK;
+
+        _ASSERTE(pApplicationContext != NULL);
+        _ASSERTE(ppPEImage != NULL);
+
+        *ppPEImage = NULL;
+
+        // Bundled assemblies don't come from the file system
+        if (Bundle::AppIsBundle())
+            return S_FALSE;
+
+        // The TPA list is only set up once, so it can be read without the binder lock
+        SimpleNameToFileNameMap * tpaMap = pApplicationContext->GetTpaList();
+        if (tpaMap == nullptr)
+            return S_FALSE;
+
+        const SimpleNameToFileNameMapEntry *pTpaEntry = tpaMap->LookupPtr(simpleName.GetUnicode());
+        if (pTpaEntry == nullptr)
+            return S_FALSE;
+
+        SString fileName((pTpaEntry->m_wszNIFileName != nullptr) ? pTpaEntry->m_wszNIFileName : pTpaEntry->m_wszILFileName);
+
+        // Creating the binder assembly maps the image and reads its metadata, same as a bind would
+        ReleaseHolder<Assembly> pAssembly;
+        hr = GetAssembly(fileName,
+                         TRUE,  // fIsInTPA
+                         &pAssembly);
+        if (FAILED(hr))
+            return hr;
+
+        PEImage *pPEImage = pAssembly->GetPEImage();
+        pPEImage->AddRef();
+        *ppPEImage = pPEImage;
+
+        return S_OK;
+    }
+#endif // !defined(DACCESS_COMPILE)
+
     /* static */
     HRESULT AssemblyBinderCommon::Register(ApplicationContext *pApplicationContext,
                                            BindResult         *pBindResult)
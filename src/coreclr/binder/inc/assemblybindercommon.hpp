@@ -58,6 +58,12 @@ namespace BINDER_SPACE
                                         /* in */  PEImage            *pPEImage,
                                         /* in */  bool              excludeAppPaths,
                                         /* [retval] [out] */  Assembly **ppAssembly);
+
+        // Opens and maps the TPA assembly with the given simple name ahead of its bind. A bind that
+        // happens while the returned image is alive finds it already open.
+        static HRESULT PrefetchTpaAssembly(/* in */  ApplicationContext *pApplicationContext,
+                                           /* in */  SString            &simpleName,
+                                           /* out */ PEImage           **ppPEImage);
 #endif // !defined(DACCESS_COMPILE)
 
         static HRESULT TranslatePEToArchitectureType(DWORD  *pdwPAFlags, PEKIND *PeKind);
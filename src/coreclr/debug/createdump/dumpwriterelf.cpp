@@ -2,9 +2,215 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 
 #include "createdump.h"
+#include <pthread.h>
 
 extern int g_readProcessMemoryErrno;
 
+//
+// Reads the memory regions from the target process in large chunks on a separate thread, so the
+// reads overlap with the writes to the dump file. The chunks are returned in region order.
+//
+class MemoryRegionReader
+{
+public:
+    struct Chunk
+    {
+        BYTE* Buffer;
+        uint64_t Address;
+        size_t Requested;
+        size_t Read;
+        int Error;
+    };
+
+private:
+    static const size_t ChunkSize = 0x100000;
+    static const size_t ChunkCount = 2;
+
+    CrashInfo& m_crashInfo;
+    std::set<MemoryRegion>::const_iterator m_region;
+    uint64_t m_address;
+    size_t m_remaining;
+
+    Chunk m_chunks[ChunkCount];
+    size_t m_produced;
+    size_t m_consumed;
+    bool m_done;
+    bool m_abort;
+
+    bool m_threaded;
+    pthread_t m_thread;
+    pthread_mutex_t m_lock;
+    pthread_cond_t m_cond;
+
+public:
+    MemoryRegionReader(CrashInfo& crashInfo) :
+        m_crashInfo(crashInfo),
+        m_region(crashInfo.MemoryRegions().begin()),
+        m_address(0),
+        m_remaining(0),
+        m_produced(0),
+        m_consumed(0),
+        m_done(false),
+        m_abort(false),
+        m_threaded(false)
+    {
+        memset(m_chunks, 0, sizeof(m_chunks));
+    }
+
+    ~MemoryRegionReader()
+    {
+        if (m_threaded)
+        {
+            pthread_mutex_lock(&m_lock);
+            m_abort = true;
+            pthread_cond_broadcast(&m_cond);
+            pthread_mutex_unlock(&m_lock);
+
+            pthread_join(m_thread, nullptr);
+            pthread_cond_destroy(&m_cond);
+            pthread_mutex_destroy(&m_lock);
+        }
+        for (size_t i = 0; i < ChunkCount; i++)
+        {
+            delete [] m_chunks[i].Buffer;
+        }
+    }
+
+    void Start()
+    {
+        for (size_t i = 0; i < ChunkCount; i++)
+        {
+            m_chunks[i].Buffer = new BYTE[ChunkSize];
+        }
+        if (pthread_mutex_init(&m_lock, nullptr) != 0)
+        {
+            return;
+        }
+        if (pthread_cond_init(&m_cond, nullptr) != 0)
+        {
+            pthread_mutex_destroy(&m_lock);
+            return;
+        }
+        // If the thread can't be created, the chunks are read synchronously in Next()
+        if (pthread_create(&m_thread, nullptr, ThreadProc, this) != 0)
+        {
+            pthread_cond_destroy(&m_cond);
+            pthread_mutex_destroy(&m_lock);
+            return;
+        }
+        m_threaded = true;
+    }
+
+    // Returns the next chunk. It stays valid until Release() is called.
+    const Chunk& Next()
+    {
+        Chunk& chunk = m_chunks[m_consumed % ChunkCount];
+        if (!m_threaded)
+        {
+            ReadNextChunk(chunk);
+            return chunk;
+        }
+        pthread_mutex_lock(&m_lock);
+        while (m_produced == m_consumed)
+        {
+            pthread_cond_wait(&m_cond, &m_lock);
+        }
+        pthread_mutex_unlock(&m_lock);
+        return chunk;
+    }
+
+    void Release()
+    {
+        if (!m_threaded)
+        {
+            m_consumed++;
+            return;
+        }
+        pthread_mutex_lock(&m_lock);
+        m_consumed++;
+        pthread_cond_broadcast(&m_cond);
+        pthread_mutex_unlock(&m_lock);
+    }
+
+private:
+    static void* ThreadProc(void* param)
+    {
+        ((MemoryRegionReader*)param)->Run();
+        return nullptr;
+    }
+
+    void Run()
+    {
+        while (true)
+        {
+            pthread_mutex_lock(&m_lock);
+            while (!m_abort && (m_produced - m_consumed) == ChunkCount)
+            {
+                pthread_cond_wait(&m_cond, &m_lock);
+            }
+            bool stop = m_abort || m_done;
+            pthread_mutex_unlock(&m_lock);
+
+            if (stop)
+            {
+                break;
+            }
+
+            // Only this thread touches the chunks that haven't been produced yet
+            Chunk& chunk = m_chunks[m_produced % ChunkCount];
+            bool more = ReadNextChunk(chunk);
+
+            pthread_mutex_lock(&m_lock);
+            m_produced++;
+            m_done = !more;
+            pthread_cond_broadcast(&m_cond);
+            pthread_mutex_unlock(&m_lock);
+        }
+    }
+
+    // Reads the next chunk in region order, skipping the diagnostics info region which isn't in the
+    // target. Returns false if there is nothing left to read or the read failed.
+    bool ReadNextChunk(Chunk& chunk)
+    {
+        while (m_remaining == 0)
+        {
+            if (m_region == m_crashInfo.MemoryRegions().end())
+            {
+                chunk.Requested = chunk.Read = 0;
+                chunk.Error = 0;
+                return false;
+            }
+            if (m_region->StartAddress() != SpecialDiagInfoAddress)
+            {
+                m_address = m_region->StartAddress();
+                m_remaining = m_region->Size();
+            }
+            m_region++;
+        }
+
+        chunk.Address = m_address;
+        chunk.Requested = std::min(m_remaining, ChunkSize);
+        chunk.Read = 0;
+        chunk.Error = 0;
+
+        if (!m_crashInfo.ReadProcessMemory(chunk.Address, chunk.Buffer, chunk.Requested, &chunk.Read))
+        {
+            chunk.Error = g_readProcessMemoryErrno;
+            chunk.Read = 0;
+            return false;
+        }
+        if (chunk.Read == 0)
+        {
+            chunk.Error = g_readProcessMemoryErrno;
+            return false;
+        }
+
+        m_address += chunk.Read;
+        m_remaining -= chunk.Read;
+        return true;
+    }
+};
+
 // Write the core dump file:
 //   ELF header
 //   Single section header (Shdr) for 64 bit program header count
@@ -169,14 +375,16 @@ DumpWriter::WriteDump()
     TRACE("Writing %" PRIu64 " memory regions to core file\n", phnum - 1);
 
     // Read from target process and write memory regions to core
+    MemoryRegionReader reader(m_crashInfo);
+    reader.Start();
+
     uint64_t total = 0;
     for (const MemoryRegion& memoryRegion : m_crashInfo.MemoryRegions())
     {
-        uint64_t address = memoryRegion.StartAddress();
         size_t size = memoryRegion.Size();
         total += size;
 
-        if (address == SpecialDiagInfoAddress)
+        if (memoryRegion.StartAddress() == SpecialDiagInfoAddress)
         {
             if (!WriteDiagInfo(size)) {
                 return false;
@@ -186,31 +394,81 @@ DumpWriter::WriteDump()
         {
             while (size > 0)
             {
-                size_t bytesToRead = std::min(size, sizeof(m_tempBuffer));
-                size_t read = 0;
-
-                if (!m_crashInfo.ReadProcessMemory(address, m_tempBuffer, bytesToRead, &read)) {
-                    printf_error("Error reading memory at %" PRIA PRIx64 " size %08zx FAILED %s (%d)\n", address, bytesToRead, strerror(g_readProcessMemoryErrno), g_readProcessMemoryErrno);
-                    return false;
-                }
+                const MemoryRegionReader::Chunk& chunk = reader.Next();
 
-                // This can happen if the target process dies before createdump is finished
-                if (read == 0) {
-                    printf_error("Error reading memory at %" PRIA PRIx64 " size %08zx returned 0 bytes read: %s (%d)\n", address, bytesToRead, strerror(g_readProcessMemoryErrno), g_readProcessMemoryErrno);
+                // A read of 0 bytes can happen if the target process dies before createdump is finished
+                if (chunk.Read == 0) {
+                    printf_error("Error reading memory at %" PRIA PRIx64 " size %08zx FAILED %s (%d)\n", chunk.Address, chunk.Requested, strerror(chunk.Error), chunk.Error);
                     return false;
                 }
 
-                if (!WriteData(m_tempBuffer, read)) {
+                if (!WriteMemory(chunk.Buffer, chunk.Read)) {
                     return false;
                 }
 
-                address += read;
-                size -= read;
+                size -= chunk.Read;
+                reader.Release();
             }
         }
     }
 
-    printf_status("Written %" PRId64 " bytes (%" PRId64 " pages) to core file\n", total, total / PAGE_SIZE);
+    // Make sure the file covers a hole at the end of the last memory region
+    if (m_sparseBytes > 0) {
+        off_t end = lseek(m_fd, 0, SEEK_CUR);
+        if (end == -1 || ftruncate(m_fd, end) != 0) {
+            printf_error("Error setting the dump file size: %s (%d)\n", strerror(errno), errno);
+            return false;
+        }
+    }
+
+    printf_status("Written %" PRId64 " bytes (%" PRId64 " pages, %" PRId64 " zero pages not stored) to core file\n", total, total / PAGE_SIZE, m_sparseBytes / PAGE_SIZE);
+    return true;
+}
+
+static bool
+IsZeroPage(const BYTE* buffer, size_t size)
+{
+    const uint64_t* words = (const uint64_t*)buffer;
+    for (size_t i = 0; i < size / sizeof(uint64_t); i++) {
+        if (words[i] != 0) {
+            return false;
+        }
+    }
+    for (size_t i = size & ~(sizeof(uint64_t) - 1); i < size; i++) {
+        if (buffer[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Writes target memory to the dump. Runs of zero pages are skipped with lseek instead, which leaves
+// holes in the dump file that read back as zeros. This saves both the disk space and the writes.
+bool
+DumpWriter::WriteMemory(const BYTE* buffer, size_t size)
+{
+    size_t offset = 0;
+    while (offset < size)
+    {
+        bool zero = IsZeroPage(buffer + offset, std::min(size - offset, (size_t)PAGE_SIZE));
+
+        // Coalesce the run of pages of the same kind
+        size_t end = std::min(offset + (size_t)PAGE_SIZE, size);
+        while (end < size && IsZeroPage(buffer + end, std::min(size - end, (size_t)PAGE_SIZE)) == zero) {
+            end = std::min(end + (size_t)PAGE_SIZE, size);
+        }
+
+        if (zero && lseek(m_fd, end - offset, SEEK_CUR) != -1) {
+            m_sparseBytes += end - offset;
+        }
+        else {
+            // The zeros are written out if the file isn't seekable
+            if (!WriteData(buffer + offset, end - offset)) {
+                return false;
+            }
+        }
+        offset = end;
+    }
     return true;
 }
 
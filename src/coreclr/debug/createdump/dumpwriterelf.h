@@ -43,6 +43,7 @@ private:
     int m_fd;
     CrashInfo& m_crashInfo;
     BYTE m_tempBuffer[0x4000];
+    uint64_t m_sparseBytes = 0;
 
     // no public copy constructor
     DumpWriter(const DumpWriter&) = delete;
@@ -63,6 +64,7 @@ private:
     bool WriteNTFileInfo();
     bool WriteThread(const ThreadInfo& thread);
     bool WriteData(const void* buffer, size_t length) { return WriteData(m_fd, buffer, length); }
+    bool WriteMemory(const BYTE* buffer, size_t size);
 
     size_t GetProcessInfoSize() const { return sizeof(Nhdr) + 8 + sizeof(prpsinfo_t); }
     size_t GetAuxvInfoSize() const { return sizeof(Nhdr) + 8 + m_crashInfo.GetAuxvSize(); }
@@ -15,6 +15,7 @@
 #include <corhost.h>
 #include <configuration.h>
 #include "../../vm/ceemain.h"
+#include "../../vm/startupsummary.h"
 #ifdef FEATURE_GDBJIT
 #include "../../vm/gdbjithelpers.h"
 #endif // FEATURE_GDBJIT
@@ -22,6 +23,7 @@
 #include "pinvokeoverride.h"
 #include <hostinformation.h>
 #include <corehost/host_runtime_contract.h>
+#include <minipal/time.h>
 
 #define ASSERTE_ALL_BUILDS(expr) _ASSERTE_ALL_BUILDS((expr))
 
@@ -241,6 +243,7 @@ int coreclr_initialize(
             void** hostHandle,
             unsigned int* domainId)
 {
+    int64_t initializeStartTicks = minipal_hires_ticks();
     HRESULT hr;
 
     LPCWSTR* propertyKeysW;
@@ -301,6 +304,8 @@ int coreclr_initialize(
     // This will take ownership of propertyKeysWTemp and propertyValuesWTemp
     Configuration::InitializeConfigurationKnobs(propertyCount, propertyKeysW, propertyValuesW);
 
+    StartupSummary::Initialize(initializeStartTicks);
+
     STARTUP_FLAGS startupFlags;
     InitializeStartupFlags(&startupFlags);
 
@@ -343,6 +348,7 @@ int coreclr_initialize(
 #endif // _DEBUG
 
 #endif
+        StartupSummary::PhaseEnd(StartupSummary::Phase_Initialize);
     }
     return hr;
 }
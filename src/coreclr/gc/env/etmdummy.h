@@ -134,6 +134,7 @@
 #define FireEtwMethodJitTailCallSucceeded(MethodBeingCompiledNamespace, MethodBeingCompiledName, MethodBeingCompiledNameSignature, CallerNamespace, CallerName, CallerNameSignature, CalleeNamespace, CalleeName, CalleeNameSignature, TailPrefix, TailCallType, ClrInstanceID) 0
 #define FireEtwMethodJitTailCallFailed(MethodBeingCompiledNamespace, MethodBeingCompiledName, MethodBeingCompiledNameSignature, CallerNamespace, CallerName, CallerNameSignature, CalleeNamespace, CalleeName, CalleeNameSignature, TailPrefix, FailReason, ClrInstanceID) 0
 #define FireEtwMethodJitMemoryAllocatedForCode(MethodID, ModuleID, JitHotCodeRequestSize, JitRODataRequestSize, AllocatedSizeForJitCode, JitAllocFlag, ClrInstanceID) 0
+#define FireEtwMethodJitTelemetry(MethodID, ModuleID, ILSize, NativeSize, JitArenaBytes, TotalMicroseconds, ImportMicroseconds, OptimizeMicroseconds, RegAllocMicroseconds, CodegenMicroseconds, ClrInstanceID) 0
 #define FireEtwMethodILToNativeMap(MethodID, ReJITID, MethodExtent, CountOfMapEntries, ILOffsets, NativeOffsets, ClrInstanceID) 0
 #define FireEtwModuleDCStartV2(ModuleID, AssemblyID, ModuleFlags, Reserved1, ModuleILPath, ModuleNativePath) 0
 #define FireEtwModuleDCEndV2(ModuleID, AssemblyID, ModuleFlags, Reserved1, ModuleILPath, ModuleNativePath) 0
@@ -419,3 +420,4 @@
 #define FireEtwEventSource(eventID, eventName, eventSourceName, payload) 0
 #define FireEtwWaitHandleWaitStart(WaitSource, AssociatedObjectID, ClrInstanceID) 0
 #define FireEtwWaitHandleWaitStop(ClrInstanceID) 0
+#define FireEtwAllocationSampled(AllocationKind, ClrInstanceID, TypeID, Address, ObjectSize, SampledByteOffset) 0
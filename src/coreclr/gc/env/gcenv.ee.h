@@ -96,6 +96,10 @@ public:
     static void DiagAddNewRegion(int generation, uint8_t* rangeStart, uint8_t* rangeEnd, uint8_t* rangeEndReserved);
 
     static void LogErrorToHost(const char *message);
+
+    static void SyncBlockCacheWeakPtrScanPartition(HANDLESCANPROC scanProc, uintptr_t lp1, uintptr_t lp2);
+
+    static void RefCountedHandleCallbacksBatch(Object** objects, bool* promote, size_t count);
 };
 
 #endif // __GCENV_EE_H__
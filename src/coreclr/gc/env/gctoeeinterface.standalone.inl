@@ -258,5 +258,15 @@ namespace standalone
         {
             ::GCToEEInterface::LogErrorToHost(message);
         }
+
+        void SyncBlockCacheWeakPtrScanPartition(HANDLESCANPROC scanProc, uintptr_t lp1, uintptr_t lp2)
+        {
+            ::GCToEEInterface::SyncBlockCacheWeakPtrScanPartition(scanProc, lp1, lp2);
+        }
+
+        void RefCountedHandleCallbacksBatch(Object** objects, bool* promote, size_t count)
+        {
+            ::GCToEEInterface::RefCountedHandleCallbacksBatch(objects, promote, count);
+        }
     };
 }
@@ -18,7 +18,8 @@
 
 #include "gcpriv.h"
 
-#ifdef TARGET_AMD64
+// NativeAOT only links the vectorized sort libraries for x64 so far.
+#if defined(TARGET_AMD64) || (defined(TARGET_ARM64) && !defined(FEATURE_NATIVEAOT))
 #define USE_VXSORT
 #else
 #define USE_INTROSORT
@@ -77,6 +78,8 @@ BOOL bgc_heap_walk_for_etw_p = FALSE;
 // If the survived due to cards from old generations / region_size is 90+%,
 // we don't compact this region, also we immediately promote it to gen2.
 #define sip_old_card_surv_ratio_th (90)
+// Gen2 regions with a survived / region_size above this are never evacuated by a budgeted gen2.
+#define gen2_evacuation_surv_ratio_max (50)
 #else
 #define demotion_plug_len_th (6*1024*1024)
 #endif //USE_REGIONS
@@ -396,6 +399,9 @@ float mb (size_t num)
 uint32_t bgc_alloc_spin_count = 140;
 uint32_t bgc_alloc_spin_count_uoh = 16;
 uint32_t bgc_alloc_spin = 2;
+// When set, the BGC thread releases more_space_lock_uoh after each UOH segment
+// it sweeps so UOH allocations aren't blocked for the whole UOH sweep.
+bool bgc_uoh_sweep_yield_p = false;
 
 inline
 void c_write (uint32_t& place, uint32_t value)
@@ -639,12 +645,20 @@ enum gc_join_flavor
 };
 
 #define first_thread_arrived 2
+
+// With many heaps, joins arrive hierarchically - the threads of a group count down the group's
+// own lock and the last one to arrive counts down the join_lock. Waiting threads spin on their
+// group's copy of the lock color so a restart doesn't have all threads polling the same line.
+#define MAX_JOIN_GROUPS 64
+
 #pragma warning(push)
 #pragma warning(disable:4324) // don't complain if DECLSPEC_ALIGN actually pads
 struct DECLSPEC_ALIGN(HS_CACHE_LINE_SIZE) join_structure
 {
     // Shared non volatile keep on separate line to prevent eviction
     int n_threads;
+    int n_groups;
+    int group_size;
 
     // Keep polling/wait structures on separate line write once per join
     DECLSPEC_ALIGN(HS_CACHE_LINE_SIZE)
@@ -659,6 +673,16 @@ struct DECLSPEC_ALIGN(HS_CACHE_LINE_SIZE) join_structure
     VOLATILE(int) r_join_lock;
 
 };
+
+struct DECLSPEC_ALIGN(HS_CACHE_LINE_SIZE) join_group
+{
+    int n_threads;
+    VOLATILE(int) join_lock;
+
+    // Polled by the threads of this group, written once per join
+    DECLSPEC_ALIGN(HS_CACHE_LINE_SIZE)
+    Volatile<int> lock_color;
+};
 #pragma warning(pop)
 
 enum join_type
@@ -685,6 +709,7 @@ enum join_heap_index
 class t_join
 {
     join_structure join_struct;
+    join_group groups[MAX_JOIN_GROUPS];
 
     int id;
     gc_join_flavor flavor;
@@ -722,7 +747,7 @@ public:
                     return FALSE;
             }
         }
-        join_struct.join_lock = join_struct.n_threads;
+        init_groups (join_struct.n_threads);
         join_struct.r_join_lock = join_struct.n_threads;
         join_struct.wait_done = FALSE;
         flavor = f;
@@ -737,10 +762,76 @@ public:
     void update_n_threads(int n_th)
     {
         join_struct.n_threads = n_th;
-        join_struct.join_lock = n_th;
+        init_groups (n_th);
         join_struct.r_join_lock = n_th;
     }
 
+    void init_groups (int n_th)
+    {
+        // Grouped joins are opt-in, by default all the threads arrive at the same join_lock.
+        int group_size = (int)GCConfig::GetGCJoinGroupSize();
+        if (group_size <= 0)
+        {
+            group_size = n_th;
+        }
+        group_size = max (group_size, (n_th + MAX_JOIN_GROUPS - 1) / MAX_JOIN_GROUPS);
+        group_size = max (1, min (group_size, n_th));
+
+        join_struct.group_size = group_size;
+        join_struct.n_groups = (n_th + group_size - 1) / group_size;
+
+        int color = join_struct.lock_color.LoadWithoutBarrier();
+        for (int i = 0; i < join_struct.n_groups; i++)
+        {
+            groups[i].n_threads = min (group_size, n_th - i * group_size);
+            groups[i].lock_color = color;
+        }
+
+        dprintf (JOIN_LOG, ("join%d: %d threads in %d groups of %d", flavor, n_th, join_struct.n_groups, group_size));
+        reset_join_locks();
+    }
+
+    void reset_join_locks()
+    {
+        if (join_struct.n_groups > 1)
+        {
+            for (int i = 0; i < join_struct.n_groups; i++)
+            {
+                groups[i].join_lock = groups[i].n_threads;
+            }
+            join_struct.join_lock = join_struct.n_groups;
+        }
+        else
+        {
+            join_struct.join_lock = join_struct.n_threads;
+        }
+    }
+
+    // Returns TRUE if this is the last thread to arrive at the join
+    BOOL arrive (int heap_number)
+    {
+        if (join_struct.n_groups > 1)
+        {
+            join_group* group = &groups[heap_number / join_struct.group_size];
+            if (Interlocked::Decrement(&group->join_lock) != 0)
+            {
+                return FALSE;
+            }
+        }
+
+        return (Interlocked::Decrement(&join_struct.join_lock) == 0);
+    }
+
+    Volatile<int>& get_lock_color (int heap_number)
+    {
+        if (join_struct.n_groups > 1)
+        {
+            return groups[heap_number / join_struct.group_size].lock_color;
+        }
+
+        return join_struct.lock_color;
+    }
+
     int get_num_threads()
     {
         return join_struct.n_threads;
@@ -770,8 +861,9 @@ public:
 
         assert (!join_struct.joined_p);
         int color = join_struct.lock_color.LoadWithoutBarrier();
+        Volatile<int>& lock_color = get_lock_color (gch->heap_number);
 
-        if (Interlocked::Decrement(&join_struct.join_lock) != 0)
+        if (!arrive (gch->heap_number))
         {
             dprintf (JOIN_LOG, ("join%d(%d): Join() Waiting...join_lock is now %d",
                 flavor, join_id, (int32_t)(join_struct.join_lock)));
@@ -779,13 +871,13 @@ public:
             fire_event (gch->heap_number, time_start, type_join, join_id);
 
             //busy wait around the color
-            if (color == join_struct.lock_color.LoadWithoutBarrier())
+            if (color == lock_color.LoadWithoutBarrier())
             {
 respin:
                 int spin_count = 128 * yp_spin_count_unit;
                 for (int j = 0; j < spin_count; j++)
                 {
-                    if (color != join_struct.lock_color.LoadWithoutBarrier())
+                    if (color != lock_color.LoadWithoutBarrier())
                     {
                         break;
                     }
@@ -793,7 +885,7 @@ respin:
                 }
 
                 // we've spun, and if color still hasn't changed, fall into hard wait
-                if (color == join_struct.lock_color.LoadWithoutBarrier())
+                if (color == lock_color.LoadWithoutBarrier())
                 {
                     dprintf (JOIN_LOG, ("join%d(%d): Join() hard wait on reset event %d, join_lock is now %d",
                         flavor, join_id, color, (int32_t)(join_struct.join_lock)));
@@ -808,10 +900,10 @@ respin:
                 }
 
                 // avoid race due to the thread about to reset the event (occasionally) being preempted before ResetEvent()
-                if (color == join_struct.lock_color.LoadWithoutBarrier())
+                if (color == lock_color.LoadWithoutBarrier())
                 {
                     dprintf (9999, ("---h%d %d j%d %d - respin!!! (c:%d-%d)",
-                        gch->heap_number, join_id, join_struct.n_threads, color, join_struct.lock_color.LoadWithoutBarrier()));
+                        gch->heap_number, join_id, join_struct.n_threads, color, lock_color.LoadWithoutBarrier()));
                     goto respin;
                 }
 
@@ -977,10 +1069,18 @@ respin:
         fire_event (join_heap_restart, time_start, type_restart, -1);
         assert (join_struct.joined_p);
         join_struct.joined_p = FALSE;
-        join_struct.join_lock = join_struct.n_threads;
+        reset_join_locks();
         dprintf (JOIN_LOG, ("join%d(%d): Restarting from join: join_lock is %d", flavor, id, (int32_t)(join_struct.join_lock)));
         int color = join_struct.lock_color.LoadWithoutBarrier();
         join_struct.lock_color = !color;
+        if (join_struct.n_groups > 1)
+        {
+            // The locks must all be reset before any group is released
+            for (int i = 0; i < join_struct.n_groups; i++)
+            {
+                groups[i].lock_color = !color;
+            }
+        }
         join_struct.joined_event[color].Set();
 
         fire_event (join_heap_restart, time_end, type_restart, -1);
@@ -1237,6 +1337,10 @@ void reset_memory (uint8_t* o, size_t sizeo);
 
 #ifndef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 static bool virtual_alloc_hardware_write_watch = false;
+#else // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+// When set, background GC finds the pages written during concurrent marking with the OS write watch instead of the
+// software write watch table, so the write barrier doesn't need to update the table while a BGC is in progress.
+static bool os_write_watch_for_gc_heap = false;
 #endif // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
 static bool hardware_write_watch_capability = false;
@@ -1985,6 +2089,9 @@ const int max_snoop_level = 128;
 // max size to decommit per millisecond
 #define DECOMMIT_SIZE_PER_MILLISECOND (160*1024)
 
+// when we are above the commit target we decommit this much faster
+#define COMMIT_TARGET_DECOMMIT_STEP_FACTOR 4
+
 // time in milliseconds between decommit steps
 #define DECOMMIT_TIME_STEP_MILLISECONDS (100)
 
@@ -2083,6 +2190,14 @@ void region_write_barrier_settings (WriteBarrierParameters* args,
     {
     default:
     case GCConfig::WRITE_BARRIER_DEFAULT:
+#ifdef TARGET_ARM64
+        // on arm64 setting a single card bit needs an exclusive load/store loop in the
+        // barrier, so the bitwise region write barrier is opt-in there
+        args->region_to_generation_table = (uint8_t*)map_region_to_generation_skewed;
+        args->region_shr = region_shr;
+        assert (args->region_use_bitwise_write_barrier == false);
+        break;
+#endif //TARGET_ARM64
     case GCConfig::WRITE_BARRIER_REGION_BIT:
         // bitwise region write barrier is the default now
         args->region_to_generation_table = (uint8_t*)map_region_to_generation_skewed;
@@ -2289,6 +2404,11 @@ size_t*     gc_heap::g_bpromoted;
 
 BOOL        gc_heap::gradual_decommit_in_progress_p = FALSE;
 size_t      gc_heap::max_decommit_step_size = 0;
+
+#ifdef MH_SC_MARK
+bool        gc_heap::mark_steal_enabled_p = true;
+size_t      gc_heap::mark_steal_heap_size_threshold = 0;
+#endif //MH_SC_MARK
 #else  //MULTIPLE_HEAPS
 
 #if !defined(USE_REGIONS) || defined(_DEBUG)
@@ -2336,6 +2456,14 @@ size_t      gc_heap::current_total_committed = 0;
 
 size_t      gc_heap::committed_by_oh[recorded_committed_bucket_counts];
 
+#ifdef MULTIPLE_HEAPS
+ptrdiff_t   gc_heap::gen0_budget_pool = 0;
+
+size_t      gc_heap::gen0_budget_pool_quantum = 0;
+
+int         gc_heap::gen0_budget_pool_percent = 0;
+#endif //MULTIPLE_HEAPS
+
 size_t      gc_heap::current_total_committed_bookkeeping = 0;
 
 BOOL        gc_heap::reset_mm_p = TRUE;
@@ -2372,6 +2500,8 @@ double      gc_heap::short_plugs_pad_ratio = 0;
 
 int         gc_heap::generation_skip_ratio_threshold = 0;
 int         gc_heap::conserve_mem_setting = 0;
+size_t      gc_heap::pause_target = 0;
+size_t      gc_heap::heap_commit_target = 0;
 bool        gc_heap::spin_count_unit_config_p = false;
 
 uint64_t    gc_heap::suspended_start_time = 0;
@@ -2648,6 +2778,8 @@ size_t      gc_heap::loh_pinned_queue_length = 0;
 mark*       gc_heap::loh_pinned_queue = 0;
 
 BOOL        gc_heap::loh_compacted_p = FALSE;
+
+BOOL        gc_heap::loh_compaction_partial_p = FALSE;
 #endif //FEATURE_LOH_COMPACTION
 
 #ifdef BACKGROUND_GC
@@ -2816,6 +2948,7 @@ size_t        gc_heap::last_gc_end_time_us = 0;
 #endif //HEAP_BALANCE_INSTRUMENTATION
 #ifdef USE_REGIONS
 bool          gc_heap::enable_special_regions_p = false;
+size_t        gc_heap::gen2_evacuation_budget = 0;
 #else //USE_REGIONS
 size_t        gc_heap::min_segment_size = 0;
 size_t        gc_heap::min_uoh_segment_size = 0;
@@ -2830,6 +2963,7 @@ size_t gc_heap::compact_or_sweep_gcs[2];
 
 #ifdef FEATURE_LOH_COMPACTION
 BOOL                   gc_heap::loh_compaction_always_p = FALSE;
+size_t                 gc_heap::loh_compaction_slice_size = 0;
 gc_loh_compaction_mode gc_heap::loh_compaction_mode = loh_compaction_default;
 #endif //FEATURE_LOH_COMPACTION
 
@@ -2959,6 +3093,8 @@ mark_queue_t gc_heap::mark_queue;
 
 #ifdef USE_REGIONS
 bool gc_heap::special_sweep_p = false;
+bool gc_heap::gen2_evacuation_p = false;
+int  gc_heap::gen2_evacuation_surv_ratio_th = -1;
 #endif //USE_REGIONS
 
 int gc_heap::loh_pinned_queue_decay = LOH_PIN_DECAY;
@@ -2973,6 +3109,9 @@ const size_t uninitialized_end_gen0_region_space = (size_t)(-1);
 
 // budget smoothing
 size_t     gc_heap::smoothed_desired_total[total_generation_count];
+
+size_t     gc_heap::pause_target_observed = 0;
+float      gc_heap::pause_target_budget_ratio = 1.0f;
 /* end of static initialization */
 
 // This is for methods that need to iterate through all SOH heap segments/regions.
@@ -5670,10 +5809,12 @@ void* virtual_alloc (size_t size, bool use_large_pages_p, uint16_t numa_node)
     uint32_t flags = VirtualReserveFlags::None;
 #ifndef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     if (virtual_alloc_hardware_write_watch)
+#else // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+    if (os_write_watch_for_gc_heap)
+#endif // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     {
         flags = VirtualReserveFlags::WriteWatch;
     }
-#endif // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
     void* prgmem = use_large_pages_p ?
         GCToOSInterface::VirtualReserveAndCommitLargePages(requested_size, numa_node) :
@@ -8052,6 +8193,12 @@ bool gc_heap::new_allocation_allowed (int gen_number)
                 }
             }
         }
+#ifdef MULTIPLE_HEAPS
+        else if ((settings.pause_mode != pause_no_gc) && borrow_gen0_budget())
+        {
+            return TRUE;
+        }
+#endif //MULTIPLE_HEAPS
         return FALSE;
     }
 #ifndef MULTIPLE_HEAPS
@@ -8080,6 +8227,92 @@ bool gc_heap::new_allocation_allowed (int gen_number)
     return TRUE;
 }
 
+#ifdef MULTIPLE_HEAPS
+// Holds back gen0_budget_pool_percent of every heap's new gen0 budget in a pool shared by
+// all heaps. A heap that runs out of gen0 budget borrows from the pool before it triggers a
+// GC, so when a few threads allocate much more than the others their heaps can use the budget
+// the other heaps would leave unused. The total gen0 budget stays the same.
+//
+// This must be called after the gen0 budgets are assigned, while the EE is suspended.
+void gc_heap::fill_gen0_budget_pool()
+{
+    gen0_budget_pool = 0;
+    gen0_budget_pool_quantum = 0;
+
+    if ((n_heaps == 1) || (gen0_budget_pool_percent == 0) || (settings.pause_mode == pause_no_gc))
+    {
+        return;
+    }
+
+    size_t total_pooled = 0;
+    size_t total_desired = 0;
+    for (int i = 0; i < n_heaps; i++)
+    {
+        gc_heap* hp = g_heaps[i];
+        dynamic_data* dd0 = hp->dynamic_data_of (0);
+        if (dd_new_allocation (dd0) <= 0)
+        {
+            total_desired += dd_desired_allocation (dd0);
+            continue;
+        }
+
+        // Take the same amount off the desired budget so the amount allocated since the
+        // GC, desired - new, stays correct.
+        size_t pooled = Align ((size_t)dd_new_allocation (dd0) / 100 * gen0_budget_pool_percent);
+        dd_desired_allocation (dd0) -= pooled;
+        dd_gc_new_allocation (dd0) -= pooled;
+        dd_new_allocation (dd0) -= pooled;
+        hp->fgn_last_alloc -= pooled;
+        total_pooled += pooled;
+        total_desired += dd_desired_allocation (dd0);
+    }
+
+    // The budget the heaps start with no longer includes the pooled part, report what they
+    // actually got.
+    gc_data_global.final_youngest_desired = total_desired / n_heaps;
+
+    // Heaps borrow a quarter of an average heap's share at a time so a few heaps can't
+    // drain the pool on their first allocations.
+    gen0_budget_pool_quantum = Align (total_pooled / n_heaps / 4);
+    if (gen0_budget_pool_quantum > 0)
+    {
+        gen0_budget_pool = (ptrdiff_t)total_pooled;
+    }
+
+    dprintf (2, ("gen0 budget pool %zd, quantum %zd", gen0_budget_pool, gen0_budget_pool_quantum));
+}
+
+// Moves up to gen0_budget_pool_quantum from the gen0 budget pool to this heap's gen0
+// budget. This is called with this heap's more space lock held, but the pool is shared by
+// all heaps so it's only updated with an interlocked add. Taking more than is left drives
+// the pool negative, which just makes other heaps fail to borrow until the next GC.
+bool gc_heap::borrow_gen0_budget()
+{
+    if (VolatileLoadWithoutBarrier (&gen0_budget_pool) <= 0)
+    {
+        return false;
+    }
+
+    ptrdiff_t quantum = (ptrdiff_t)gen0_budget_pool_quantum;
+    ptrdiff_t available = Interlocked::ExchangeAddPtr (&gen0_budget_pool, -quantum);
+    if (available <= 0)
+    {
+        return false;
+    }
+
+    ptrdiff_t borrowed = min (available, quantum);
+    dynamic_data* dd0 = dynamic_data_of (0);
+    dd_desired_allocation (dd0) += borrowed;
+    dd_new_allocation (dd0) += borrowed;
+    fgn_last_alloc += borrowed;
+
+    dprintf (2, ("h%d borrowed %zd of gen0 budget, %zd left in pool",
+        heap_number, borrowed, (available - borrowed)));
+
+    return (dd_new_allocation (dd0) >= 0);
+}
+#endif //MULTIPLE_HEAPS
+
 inline
 ptrdiff_t gc_heap::get_desired_allocation (int gen_number)
 {
@@ -8809,6 +9042,50 @@ uint32_t*& card_table_card_bundle_table (uint32_t* c_table)
 }
 #endif //CARD_BUNDLE
 
+#if defined(USE_VXSORT) && defined(TARGET_AMD64)
+// Below these sizes (in words) the vectorized side table kernels don't pay off.
+// Clearing with non temporal stores only makes sense when the range is much
+// bigger than what we'd want to keep in the cache.
+#define SIDE_TABLE_CLEAR_NT_THRESHOLD_WORDS (256 * 1024)
+#define SIDE_TABLE_OR_AVX2_THRESHOLD_WORDS  32
+#endif //USE_VXSORT && TARGET_AMD64
+
+// Clears count words of a side table (mark array or card table).
+inline
+void clear_side_table_words (uint32_t* dest, size_t count)
+{
+#if defined(USE_VXSORT) && defined(TARGET_AMD64)
+    if ((count >= SIDE_TABLE_CLEAR_NT_THRESHOLD_WORDS) && IsSupportedInstructionSet (InstructionSet::AVX2))
+    {
+        do_clear_words_avx2 (dest, count);
+        return;
+    }
+#endif //USE_VXSORT && TARGET_AMD64
+
+    memset (dest, 0, count * sizeof (uint32_t));
+}
+
+// ORs count words of src into dest. Returns true if any of the src words is non zero.
+inline
+bool or_side_table_words (uint32_t* dest, const uint32_t* src, size_t count)
+{
+#if defined(USE_VXSORT) && defined(TARGET_AMD64)
+    if ((count >= SIDE_TABLE_OR_AVX2_THRESHOLD_WORDS) && IsSupportedInstructionSet (InstructionSet::AVX2))
+    {
+        return do_or_words_avx2 (dest, src, count);
+    }
+#endif //USE_VXSORT && TARGET_AMD64
+
+    uint32_t any = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        dest[i] |= src[i];
+        any |= src[i];
+    }
+
+    return (any != 0);
+}
+
 #ifdef BACKGROUND_GC
 inline
 uint32_t*& card_table_mark_array (uint32_t* c_table)
@@ -8969,7 +9246,7 @@ void gc_heap::clear_mark_array (uint8_t* from, uint8_t* end)
             op += mark_bit_pitch;
         }
 
-        memset (&mark_array[beg_word], 0, (end_word - beg_word)*sizeof (uint32_t));
+        clear_side_table_words (&mark_array[beg_word], (end_word - beg_word));
 
 #ifdef _DEBUG
         //Beware, it is assumed that the mark array word straddling
@@ -9859,21 +10136,25 @@ void gc_heap::copy_brick_card_range (uint8_t* la, uint32_t* old_card_table,
 
             uint32_t* dest = &card_table[start_word];
             uint32_t* src = &((translate_card_table (ct))[start_word]);
-            ptrdiff_t count = count_card_of (start, end);
-            for (int x = 0; x < count; x++)
-            {
-                *dest |= *src;
+            size_t count = (size_t)count_card_of (start, end);
 
 #ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
-                if (*src != 0)
+            // merge one card bundle worth of words at a time so we only need to
+            // set the bundle once if any of its source words are set.
+            size_t x = 0;
+            while (x < count)
+            {
+                size_t cardb = cardw_card_bundle (start_word + x);
+                size_t chunk = min ((card_bundle_cardw (cardb + 1) - (start_word + x)), (count - x));
+                if (or_side_table_words (&dest[x], &src[x], chunk))
                 {
-                    card_bundle_set(cardw_card_bundle(start_word+x));
+                    card_bundle_set (cardb);
                 }
-#endif
-
-                dest++;
-                src++;
+                x += chunk;
             }
+#else
+            or_side_table_words (dest, src, count);
+#endif //FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
         }
         ct = card_table_next (ct);
     }
@@ -10369,9 +10650,20 @@ static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* rang
     // despite possible downclocking on current devices
     const ptrdiff_t AVX512F_THRESHOLD_SIZE = 128 * 1024;
 
+    // above this threshold, using NEON for sorting will likely pay off
+    const ptrdiff_t NEON_THRESHOLD_SIZE = 8 * 1024;
+
     if (item_count <= 1)
         return;
 
+#if defined(TARGET_ARM64)
+    if (IsSupportedInstructionSet (InstructionSet::NEON) && (item_count > NEON_THRESHOLD_SIZE))
+    {
+        dprintf(3, ("Sorting mark lists"));
+        do_vxsort_neon (item_array, &item_array[item_count - 1], range_low, range_high);
+    }
+    else
+#endif //TARGET_ARM64
     if (IsSupportedInstructionSet (InstructionSet::AVX2) && (item_count > AVX2_THRESHOLD_SIZE))
     {
         dprintf(3, ("Sorting mark lists"));
@@ -11019,11 +11311,13 @@ void gc_heap::grow_mark_list ()
 {
     // with vectorized sorting, we can use bigger mark lists
 #ifdef USE_VXSORT
+    bool vectorized_sort_p = IsSupportedInstructionSet (InstructionSet::AVX2) ||
+                             IsSupportedInstructionSet (InstructionSet::NEON);
 #ifdef MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ?
+    const size_t MAX_MARK_LIST_SIZE = vectorized_sort_p ?
         (1000 * 1024) : (200 * 1024);
 #else //MULTIPLE_HEAPS
-    const size_t MAX_MARK_LIST_SIZE = IsSupportedInstructionSet (InstructionSet::AVX2) ?
+    const size_t MAX_MARK_LIST_SIZE = vectorized_sort_p ?
         (32 * 1024) : (16 * 1024);
 #endif //MULTIPLE_HEAPS
 #else //USE_VXSORT
@@ -11643,10 +11937,7 @@ void gc_heap::bgc_clear_batch_mark_array_bits (uint8_t* start, uint8_t* end)
             startwrd++;
         }
 
-        for (size_t wrdtmp = startwrd; wrdtmp < endwrd; wrdtmp++)
-        {
-            mark_array[wrdtmp] = 0;
-        }
+        clear_side_table_words (&mark_array[startwrd], (endwrd - startwrd));
 
         // clear the last mark word.
         if (endbit)
@@ -12717,6 +13008,25 @@ static int64_t add_regions (region_free_list* free_list, region_free_list* surpl
     return added_count;
 }
 
+#ifdef MULTIPLE_HEAPS
+// move regions from from_list to to_list until to_list reaches to_target_count or from_list
+// would drop below from_target_count - used to rebalance free regions between heaps directly
+static int64_t move_regions_within_budget (region_free_list* to_list, size_t to_target_count,
+                                           region_free_list* from_list, size_t from_target_count)
+{
+    int64_t moved_count = 0;
+    while ((to_list->get_num_free_regions() < to_target_count) &&
+           (from_list->get_num_free_regions() > from_target_count))
+    {
+        moved_count++;
+
+        heap_segment* region = from_list->unlink_region_front();
+        to_list->add_region_front (region);
+    }
+    return moved_count;
+}
+#endif //MULTIPLE_HEAPS
+
 region_free_list::region_free_list() : num_free_regions (0),
                                        size_free_regions (0),
                                        size_committed_in_free_regions (0),
@@ -13196,11 +13506,25 @@ void region_free_list::sort_by_committed_and_age()
 }
 #endif //USE_REGIONS
 
+// returns how many bytes we have committed beyond the commit target, 0 if there's no target or we are under it
+size_t gc_heap::get_commit_target_excess()
+{
+    if (heap_commit_target == 0)
+        return 0;
+
+    size_t committed = current_total_committed;
+    return ((committed > heap_commit_target) ? (committed - heap_commit_target) : 0);
+}
+
 void gc_heap::distribute_free_regions()
 {
 #ifdef USE_REGIONS
     const int kind_count = large_free_region + 1;
 
+    // above the commit target we don't keep free regions around for AGE_IN_FREE_TO_DECOMMIT GCs -
+    // any free region that wasn't reused since the last GC is decommitted.
+    size_t commit_target_excess = get_commit_target_excess();
+
 #ifdef MULTIPLE_HEAPS
     BOOL joined_last_gc_before_oom = FALSE;
     for (int i = 0; i < n_heaps; i++)
@@ -13304,7 +13628,7 @@ void gc_heap::distribute_free_regions()
             for (heap_segment* region = region_list.get_first_free_region(); region != nullptr; region = next_region)
             {
                 next_region = heap_segment_next (region);
-                int age_in_free_to_decommit = min (max (AGE_IN_FREE_TO_DECOMMIT, n_heaps), MAX_AGE_IN_FREE);
+                int age_in_free_to_decommit = (commit_target_excess > 0) ? 1 : min (max (AGE_IN_FREE_TO_DECOMMIT, n_heaps), MAX_AGE_IN_FREE);
                 // when we are about to get OOM, we'd like to discount the free regions that just have the initial page commit as they are not useful
                 if ((heap_segment_age_in_free (region) >= age_in_free_to_decommit) ||
                     ((get_region_committed_size (region) == GC_PAGE_SIZE) && joined_last_gc_before_oom))
@@ -13502,6 +13826,46 @@ void gc_heap::distribute_free_regions()
     for (int kind = basic_free_region; kind < kind_count; kind++)
     {
 #ifdef MULTIPLE_HEAPS
+        // if the heaps span more than one numa node, first satisfy heaps that are under budget
+        // from heaps on the same node that are over budget, so free regions (and the memory
+        // already committed for them) stay local to the node. Whatever is left is distributed
+        // across nodes below.
+        if (heap_select::find_numa_node_from_heap_no (0) != heap_select::find_numa_node_from_heap_no (n_heaps - 1))
+        {
+            for (int i = 0; i < n_heaps; i++)
+            {
+                gc_heap* hp = g_heaps[i];
+                if (hp->free_regions[kind].get_num_free_regions() >= heap_budget_in_region_units[i][kind])
+                    continue;
+
+                int start, end;
+                heap_select::get_heap_range_for_heap (i, &start, &end);
+                end = min (end, n_heaps);
+
+                for (int j = start; j < end; j++)
+                {
+                    if (j == i)
+                        continue;
+
+                    gc_heap* src_hp = g_heaps[j];
+                    int64_t num_moved_regions = move_regions_within_budget (&hp->free_regions[kind], heap_budget_in_region_units[i][kind],
+                                                                            &src_hp->free_regions[kind], heap_budget_in_region_units[j][kind]);
+                    if (num_moved_regions > 0)
+                    {
+                        dprintf (REGIONS_LOG, ("moved %zd %s regions from heap %d to heap %d on numa node %d",
+                            (size_t)num_moved_regions,
+                            kind_name[kind],
+                            j,
+                            i,
+                            heap_select::find_numa_node_from_heap_no (i)));
+                    }
+
+                    if (hp->free_regions[kind].get_num_free_regions() >= heap_budget_in_region_units[i][kind])
+                        break;
+                }
+            }
+        }
+
         // now go through all the heaps and remove any free regions above the target count
         for (int i = 0; i < n_heaps; i++)
         {
@@ -13550,6 +13914,25 @@ void gc_heap::distribute_free_regions()
         }
     }
 
+    if (heap_commit_target != 0)
+    {
+        size_t committed_to_decommit = 0;
+        for (int kind = basic_free_region; kind < count_free_region_kinds; kind++)
+        {
+            committed_to_decommit += global_regions_to_decommit[kind].get_size_committed_in_free();
+        }
+
+        dprintf (REGIONS_LOG, ("commit target %zd, committed %zd, excess %zd, %zd on decommit list (%zd by time)",
+            heap_commit_target, current_total_committed, commit_target_excess,
+            committed_to_decommit, size_decommit_regions_by_time));
+
+        GCEventFireCommitTargetTuning_V1 (
+            (uint64_t)heap_commit_target,
+            (uint64_t)current_total_committed,
+            (uint64_t)committed_to_decommit,
+            (uint64_t)size_decommit_regions_by_time);
+    }
+
 #ifdef MULTIPLE_HEAPS
     for (int kind = basic_free_region; kind < count_free_region_kinds; kind++)
     {
@@ -13722,10 +14105,14 @@ void gc_heap::update_card_table_bundle()
 void gc_heap::reset_write_watch_for_gc_heap(void* base_address, size_t region_size)
 {
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
-    SoftwareWriteWatch::ClearDirty(base_address, region_size);
-#else // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
-    GCToOSInterface::ResetWriteWatch(base_address, region_size);
+    if (!os_write_watch_for_gc_heap)
+    {
+        SoftwareWriteWatch::ClearDirty(base_address, region_size);
+        return;
+    }
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+
+    GCToOSInterface::ResetWriteWatch(base_address, region_size);
 }
 
 // static
@@ -13734,14 +14121,18 @@ void gc_heap::get_write_watch_for_gc_heap(bool reset, void *base_address, size_t
                                           bool is_runtime_suspended)
 {
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
-    SoftwareWriteWatch::GetDirty(base_address, region_size, dirty_pages, dirty_page_count_ref,
-                                 reset, is_runtime_suspended);
-#else // !FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+    if (!os_write_watch_for_gc_heap)
+    {
+        SoftwareWriteWatch::GetDirty(base_address, region_size, dirty_pages, dirty_page_count_ref,
+                                     reset, is_runtime_suspended);
+        return;
+    }
+#endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+
     UNREFERENCED_PARAMETER(is_runtime_suspended);
     bool success = GCToOSInterface::GetWriteWatch(reset, base_address, region_size, dirty_pages,
                                                   dirty_page_count_ref);
     assert(success);
-#endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 }
 
 const size_t ww_reset_quantum = 128*1024*1024;
@@ -14096,6 +14487,16 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
     HRESULT hres = S_OK;
 
     conserve_mem_setting = (int)GCConfig::GetGCConserveMem();
+    pause_target = (size_t)GCConfig::GetGCPauseTargetMs() * 1000;
+    heap_commit_target = (size_t)GCConfig::GetGCHeapCommitTarget();
+
+#ifdef MULTIPLE_HEAPS
+    gen0_budget_pool_percent = (int)GCConfig::GetGCGen0BudgetPoolPercent();
+    if ((gen0_budget_pool_percent < 0) || (gen0_budget_pool_percent > 90))
+    {
+        gen0_budget_pool_percent = 0;
+    }
+#endif //MULTIPLE_HEAPS
 
 #ifdef DYNAMIC_HEAP_COUNT
     dynamic_adaptation_mode = (int)GCConfig::GetGCDynamicAdaptationMode();
@@ -14118,6 +14519,11 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
 #ifdef WRITE_WATCH
     hardware_write_watch_api_supported();
 #ifdef BACKGROUND_GC
+#ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+    // Large pages can't be write watched by the OS.
+    os_write_watch_for_gc_heap = GCConfig::GetGCOSWriteWatch() && can_use_hardware_write_watch() && !use_large_pages_p;
+    dprintf (2, ("BGC uses %s write watch", (os_write_watch_for_gc_heap ? "OS" : "software")));
+#endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
     if (can_use_write_watch_for_gc_heap() && GCConfig::GetConcurrentGC())
     {
         gc_can_use_concurrent = true;
@@ -14285,6 +14691,9 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
 #ifdef MH_SC_MARK
     if (!g_mark_stack_busy)
         return E_OUTOFMEMORY;
+
+    mark_steal_enabled_p = GCConfig::GetGCMarkSteal();
+    mark_steal_heap_size_threshold = (size_t)GCConfig::GetGCMarkStealThreshold();
 #endif //MH_SC_MARK
 
     if (!create_thread_support (number_of_heaps))
@@ -14425,6 +14834,7 @@ gc_heap::init_semi_shared()
 #ifdef FEATURE_LOH_COMPACTION
     loh_compaction_always_p = GCConfig::GetLOHCompactionMode() != 0;
     loh_compaction_mode = loh_compaction_default;
+    loh_compaction_slice_size = (size_t)GCConfig::GetLOHCompactionSliceSize();
 #endif //FEATURE_LOH_COMPACTION
 
 #ifdef BGC_SERVO_TUNING
@@ -14511,6 +14921,7 @@ gc_heap::init_semi_shared()
     memset (ephemeral_fgc_counts, 0, sizeof (ephemeral_fgc_counts));
     bgc_alloc_spin_count = static_cast<uint32_t>(GCConfig::GetBGCSpinCount());
     bgc_alloc_spin = static_cast<uint32_t>(GCConfig::GetBGCSpin());
+    bgc_uoh_sweep_yield_p = GCConfig::GetBGCUOHSweepYield();
 
     {
         int number_bgc_threads = get_num_heaps();
@@ -14876,6 +15287,8 @@ gc_heap::init_gc_heap (int h_number)
     new_regions_in_threading = 0;
 
     special_sweep_p = false;
+    gen2_evacuation_p = false;
+    gen2_evacuation_surv_ratio_th = -1;
 #endif //USE_REGIONS
 
 #endif //MULTIPLE_HEAPS
@@ -17415,6 +17828,33 @@ void gc_heap::bgc_uoh_alloc_clr (uint8_t* alloc_start,
 }
 #endif //BACKGROUND_GC
 
+// POH is mostly used for pinned I/O buffers which tend to come in a handful of sizes and are freed and allocated
+// again all the time. Before falling back to first fit we look for a free item of exactly the requested size,
+// reusing it doesn't split a larger item (which is what fragments POH over time). The search is bounded so a
+// bucket full of differently sized items doesn't make allocations more expensive.
+const int poh_exact_fit_search_limit = 32;
+
+// Looks for a free item of exactly size bytes in the bucket. If one is found, free_list and prev_free_item are
+// updated to refer to it, otherwise they're left untouched.
+static void find_exact_fit_free_item (size_t size, uint8_t** free_list, uint8_t** prev_free_item)
+{
+    uint8_t* item = *free_list;
+    uint8_t* prev_item = *prev_free_item;
+
+    for (int i = 0; (i < poh_exact_fit_search_limit) && (item != 0); i++)
+    {
+        if (unused_array_size (item) == size)
+        {
+            *free_list = item;
+            *prev_free_item = prev_item;
+            return;
+        }
+
+        prev_item = item;
+        item = free_list_slot (item);
+    }
+}
+
 BOOL gc_heap::a_fit_free_list_uoh_p (size_t size,
                                        alloc_context* acontext,
                                        uint32_t flags,
@@ -17433,10 +17873,18 @@ BOOL gc_heap::a_fit_free_list_uoh_p (size_t size,
     int cookie = -1;
 #endif //BACKGROUND_GC
 
-    for (unsigned int a_l_idx = allocator->first_suitable_bucket(size); a_l_idx < allocator->number_of_buckets(); a_l_idx++)
+    unsigned int first_bucket = allocator->first_suitable_bucket(size);
+    for (unsigned int a_l_idx = first_bucket; a_l_idx < allocator->number_of_buckets(); a_l_idx++)
     {
         uint8_t* free_list = allocator->alloc_list_head_of (a_l_idx);
         uint8_t* prev_free_item = 0;
+
+        // Items of the requested size can only be in the first suitable bucket.
+        if ((gen_number == poh_generation) && (a_l_idx == first_bucket))
+        {
+            find_exact_fit_free_item (size, &free_list, &prev_free_item);
+        }
+
         while (free_list != 0)
         {
             dprintf (3, ("considering free list %zx", (size_t)free_list));
@@ -22718,6 +23166,8 @@ void gc_heap::gc1()
                 }
             }
 
+            fill_gen0_budget_pool();
+
 #ifdef FEATURE_LOH_COMPACTION
             BOOL all_heaps_compacted_p = TRUE;
 #endif //FEATURE_LOH_COMPACTION
@@ -22728,7 +23178,7 @@ void gc_heap::gc1()
                 hp->decommit_ephemeral_segment_pages();
                 hp->rearrange_uoh_segments();
 #ifdef FEATURE_LOH_COMPACTION
-                all_heaps_compacted_p &= hp->loh_compacted_p;
+                all_heaps_compacted_p &= (hp->loh_compacted_p && !hp->loh_compaction_partial_p);
 #endif //FEATURE_LOH_COMPACTION
                 // compute max of gen0_must_clear_bricks over all heaps
                 max_gen0_must_clear_bricks = max(max_gen0_must_clear_bricks, hp->gen0_must_clear_bricks);
@@ -22799,7 +23249,7 @@ void gc_heap::gc1()
         dd_desired_allocation (dynamic_data_of (0));
 
 #ifdef FEATURE_LOH_COMPACTION
-    check_loh_compact_mode (loh_compacted_p);
+    check_loh_compact_mode (loh_compacted_p && !loh_compaction_partial_p);
 #endif //FEATURE_LOH_COMPACTION
 
     decommit_ephemeral_segment_pages();
@@ -22902,6 +23352,11 @@ void gc_heap::assign_new_budget (int gen_number, size_t desired_per_heap)
     }
 
     gc_data_global.final_youngest_desired = desired_per_heap;
+
+    if (gen_number == 0)
+    {
+        fill_gen0_budget_pool();
+    }
 }
 
 bool gc_heap::prepare_rethread_fl_items()
@@ -24047,6 +24502,9 @@ void gc_heap::garbage_collect (int n)
             gc_heap* hp = g_heaps[i];
             hp->delay_free_segments();
         }
+
+        // Pooled budget isn't carried over, the budgets are recomputed at the end of this GC
+        gen0_budget_pool = 0;
 #else //MULTIPLE_HEAPS
         delay_free_segments();
 #endif //MULTIPLE_HEAPS
@@ -24242,7 +24700,10 @@ void gc_heap::garbage_collect (int n)
             if (do_concurrent_p)
             {
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
-                SoftwareWriteWatch::EnableForGCHeap();
+                if (!os_write_watch_for_gc_heap)
+                {
+                    SoftwareWriteWatch::EnableForGCHeap();
+                }
 #endif //FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
 #ifdef MULTIPLE_HEAPS
@@ -27749,6 +28210,77 @@ void gc_heap::set_background_overflow_p (uint8_t* oo)
 }
 #endif //USE_REGIONS
 
+// Objects newly marked by background_mark_simple1 wait in this queue while the prefetches
+// of their method tables take effect, before they are sized and pushed on the mark stack.
+// Unlike mark_queue_t this doesn't delay the marking itself, since the background mark
+// bits are in the mark array rather than in the objects. Foreground GCs don't relocate
+// the queued objects, so the queue must be empty whenever one can run.
+class bgc_mark_queue_t
+{
+public:
+    // The mark stack needs this much room beyond the children of the object being scanned
+    static const size_t slot_count = 16;
+
+private:
+    uint8_t* slot_table[slot_count];
+    size_t curr_slot_index;
+
+public:
+    bgc_mark_queue_t() : curr_slot_index (0)
+    {
+        for (size_t i = 0; i < slot_count; i++)
+        {
+            slot_table[i] = nullptr;
+        }
+    }
+
+    // queues a newly marked object and returns the object that has been in the queue
+    // the longest, or nullptr
+    FORCEINLINE
+    uint8_t* queue (uint8_t* o)
+    {
+        Prefetch (o);
+
+        size_t slot_index = curr_slot_index;
+        uint8_t* old_o = slot_table[slot_index];
+        slot_table[slot_index] = o;
+        curr_slot_index = (slot_index + 1) % slot_count;
+        return old_o;
+    }
+
+    // removes the object that has been in the queue the longest, returns nullptr if the
+    // queue is empty
+    uint8_t* dequeue()
+    {
+        for (size_t i = 0; i < slot_count; i++)
+        {
+            size_t slot_index = curr_slot_index;
+            curr_slot_index = (slot_index + 1) % slot_count;
+            uint8_t* o = slot_table[slot_index];
+            if (o != nullptr)
+            {
+                slot_table[slot_index] = nullptr;
+                return o;
+            }
+        }
+        return nullptr;
+    }
+};
+
+inline
+void gc_heap::background_push_queued (uint8_t* o THREAD_NUMBER_DCL)
+{
+#ifndef MULTIPLE_HEAPS
+    const int thread = 0;
+#endif //!MULTIPLE_HEAPS
+    size_t obj_size = size (o);
+    bpromoted_bytes (thread) += obj_size;
+    if (contain_pointers_or_collectible (o))
+    {
+        *(background_mark_stack_tos++) = o;
+    }
+}
+
 void gc_heap::background_mark_simple1 (uint8_t* oo THREAD_NUMBER_DCL)
 {
     uint8_t** mark_stack_limit = &background_mark_stack_array[background_mark_stack_array_length];
@@ -27759,6 +28291,8 @@ void gc_heap::background_mark_simple1 (uint8_t* oo THREAD_NUMBER_DCL)
 
     background_mark_stack_tos = background_mark_stack_array;
 
+    bgc_mark_queue_t bgc_queue;
+
     while (1)
     {
 #ifdef MULTIPLE_HEAPS
@@ -27772,11 +28306,11 @@ void gc_heap::background_mark_simple1 (uint8_t* oo THREAD_NUMBER_DCL)
             {
                 BOOL overflow_p = FALSE;
 
-                if (background_mark_stack_tos + (s) /sizeof (uint8_t*) >= (mark_stack_limit - 1))
+                if (background_mark_stack_tos + (s) /sizeof (uint8_t*) >= (mark_stack_limit - 1 - bgc_mark_queue_t::slot_count))
                 {
                     size_t num_components = ((method_table(oo))->HasComponentSize() ? ((CObjectHeader*)oo)->GetNumComponents() : 0);
                     size_t num_pointers = CGCDesc::GetNumPointers(method_table(oo), s, num_components);
-                    if (background_mark_stack_tos + num_pointers >= (mark_stack_limit - 1))
+                    if (background_mark_stack_tos + num_pointers >= (mark_stack_limit - 1 - bgc_mark_queue_t::slot_count))
                     {
                         dprintf (2, ("h%d: %zd left, obj (mt: %p) %zd ptrs",
                             heap_number,
@@ -27796,18 +28330,15 @@ void gc_heap::background_mark_simple1 (uint8_t* oo THREAD_NUMBER_DCL)
                     go_through_object_cl (method_table(oo), oo, s, ppslot,
                     {
                         uint8_t* o = *ppslot;
-                        Prefetch(o);
                         if (background_mark (o,
                                              background_saved_lowest_address,
                                              background_saved_highest_address))
                         {
                             //m_boundary (o);
-                            size_t obj_size = size (o);
-                            bpromoted_bytes (thread) += obj_size;
-                            if (contain_pointers_or_collectible (o))
+                            uint8_t* queued_o = bgc_queue.queue (o);
+                            if (queued_o != nullptr)
                             {
-                                *(background_mark_stack_tos++) = o;
-
+                                background_push_queued (queued_o THREAD_NUMBER_ARG);
                             }
                         }
                     }
@@ -27863,7 +28394,7 @@ void gc_heap::background_mark_simple1 (uint8_t* oo THREAD_NUMBER_DCL)
 
                 BOOL overflow_p = FALSE;
 
-                if (background_mark_stack_tos + (num_partial_refs + 2)  >= mark_stack_limit)
+                if (background_mark_stack_tos + (num_partial_refs + 2 + bgc_mark_queue_t::slot_count)  >= mark_stack_limit)
                 {
                     size_t num_components = ((method_table(oo))->HasComponentSize() ? ((CObjectHeader*)oo)->GetNumComponents() : 0);
                     size_t num_pointers = CGCDesc::GetNumPointers(method_table(oo), s, num_components);
@@ -27895,25 +28426,24 @@ void gc_heap::background_mark_simple1 (uint8_t* oo THREAD_NUMBER_DCL)
                                        start, use_start, (oo + s),
                     {
                         uint8_t* o = *ppslot;
-                        Prefetch(o);
 
                         if (background_mark (o,
                                             background_saved_lowest_address,
                                             background_saved_highest_address))
                         {
                             //m_boundary (o);
-                            size_t obj_size = size (o);
-                            bpromoted_bytes (thread) += obj_size;
-                            if (contain_pointers_or_collectible (o))
+                            // Whether o has pointers isn't known until it leaves the queue, so
+                            // every newly marked object counts against num_pushed_refs
+                            uint8_t* queued_o = bgc_queue.queue (o);
+                            if (queued_o != nullptr)
                             {
-                                *(background_mark_stack_tos++) = o;
-                                if (--num_pushed_refs == 0)
-                                {
-                                    //update the start
-                                    *place = (uint8_t*)(ppslot+1);
-                                    goto more_to_do;
-                                }
-
+                                background_push_queued (queued_o THREAD_NUMBER_ARG);
+                            }
+                            if (--num_pushed_refs == 0)
+                            {
+                                //update the start
+                                *place = (uint8_t*)(ppslot+1);
+                                goto more_to_do;
                             }
                         }
                         if (--num_processed_refs == 0)
@@ -27954,7 +28484,27 @@ void gc_heap::background_mark_simple1 (uint8_t* oo THREAD_NUMBER_DCL)
 #ifdef COLLECTIBLE_CLASS
 next_level:
 #endif // COLLECTIBLE_CLASS
-        allow_fgc();
+        if (g_fSuspensionPending > 0)
+        {
+            // A foreground GC can run in allow_fgc and it only relocates the objects on
+            // the mark stack, so nothing can be left in the queue.
+            uint8_t* queued_o;
+            while ((queued_o = bgc_queue.dequeue()) != nullptr)
+            {
+                background_push_queued (queued_o THREAD_NUMBER_ARG);
+            }
+
+            allow_fgc();
+        }
+
+        if (background_mark_stack_tos == background_mark_stack_array)
+        {
+            uint8_t* queued_o;
+            while ((queued_o = bgc_queue.dequeue()) != nullptr)
+            {
+                background_push_queued (queued_o THREAD_NUMBER_ARG);
+            }
+        }
 
         if (!(background_mark_stack_tos == background_mark_stack_array))
         {
@@ -29434,11 +29984,11 @@ void gc_heap::mark_phase (int condemned_gen_number)
 
 #ifdef MULTIPLE_HEAPS
 #ifdef MH_SC_MARK
-        if (full_p)
+        if (full_p && mark_steal_enabled_p)
         {
             size_t total_heap_size = get_total_heap_size();
 
-            if (total_heap_size > (100 * 1024 * 1024))
+            if (total_heap_size > mark_steal_heap_size_threshold)
             {
                 do_mark_steal_p = TRUE;
             }
@@ -29830,8 +30380,13 @@ void gc_heap::mark_phase (int condemned_gen_number)
 
 #ifdef MULTIPLE_HEAPS
     size_t total_mark_list_size = sort_mark_list();
+    if (GCScan::CanWeakPtrScanByAllThreads())
+    {
+        // scan our part of the syncblk cache for deleted entries
+        GCScan::GcWeakPtrScanByAllThreads(condemned_gen_number, max_generation, &sc);
+    }
     // first thread to finish sorting will scan the sync syncblk cache
-    if ((syncblock_scan_p == 0) && (Interlocked::Increment(&syncblock_scan_p) == 1))
+    else if ((syncblock_scan_p == 0) && (Interlocked::Increment(&syncblock_scan_p) == 1))
 #endif //MULTIPLE_HEAPS
     {
         // scan for deleted entries in the syncblk cache
@@ -30978,6 +31533,9 @@ BOOL gc_heap::plan_loh()
     uint8_t* free_space_start = o;
     uint8_t* free_space_end = o;
     uint8_t* new_address = 0;
+    size_t moved_size = 0;
+
+    loh_compaction_partial_p = FALSE;
 
     while (1)
     {
@@ -30998,6 +31556,14 @@ BOOL gc_heap::plan_loh()
             size_t size = AlignQword (size (o));
             dprintf (1235, ("%p(%zd) M", o, size));
 
+            if (!pinned (o) && loh_compaction_slice_size && (moved_size >= loh_compaction_slice_size))
+            {
+                // We've moved as much as this GC is allowed to, the rest stays where it is
+                // as if it was pinned. compact_loh clears the pinned bit again.
+                set_pinned (o);
+                loh_compaction_partial_p = TRUE;
+            }
+
             if (pinned (o))
             {
                 // We don't clear the pinned bit yet so we can check in
@@ -31013,6 +31579,10 @@ BOOL gc_heap::plan_loh()
             else
             {
                 new_address = loh_allocate_in_condemned (size);
+                if (new_address != o)
+                {
+                    moved_size += size;
+                }
             }
 
             loh_set_node_relocation_distance (o, (new_address - o));
@@ -32489,6 +33059,10 @@ void gc_heap::plan_phase (int condemned_gen_number)
         }
     }
 
+#ifdef USE_REGIONS
+    decide_on_gen2_evacuation();
+#endif //USE_REGIONS
+
     //reset all of the segment's plan_allocated
     {
         int condemned_gen_index1 = get_stop_generation_index (condemned_gen_number);
@@ -34729,9 +35303,91 @@ void gc_heap::update_start_tail_regions (generation* gen,
 //
 // This new region we get needs to be temporarily recorded instead of being on the free_regions list because
 // we can't use it for other purposes.
+// A budgeted gen2 only evacuates the most fragmented gen2 regions, those with the lowest survival,
+// as long as the survived bytes they relocate fit in gen2_evacuation_budget. All other gen2 regions
+// are swept in plan so the fragmentation is reclaimed a few regions at a time instead of by a full
+// compacting gen2.
+void gc_heap::decide_on_gen2_evacuation()
+{
+    gen2_evacuation_p = false;
+    gen2_evacuation_surv_ratio_th = -1;
+
+    if ((gen2_evacuation_budget == 0) ||
+        (settings.condemned_generation != max_generation) ||
+        settings.concurrent ||
+        last_gc_before_oom ||
+        GCConfig::GetForceCompact() ||
+        (settings.reason == reason_induced_compacting) ||
+        (settings.reason == reason_induced_aggressive) ||
+        (settings.reason == reason_pm_full_gc))
+    {
+        return;
+    }
+
+    // With Server GC a heap that has nothing to evacuate still compacts when another heap does,
+    // so we always sweep its gen2 regions in plan.
+    gen2_evacuation_p = true;
+
+    size_t basic_region_size = (size_t)1 << min_segment_size_shr;
+    size_t surv_per_ratio[gen2_evacuation_surv_ratio_max + 1];
+    memset (surv_per_ratio, 0, sizeof (surv_per_ratio));
+
+    heap_segment* region = heap_segment_rw (generation_start_segment (generation_of (max_generation)));
+    while (region)
+    {
+        size_t surv_ratio = heap_segment_survived (region) * 100 / basic_region_size;
+        if ((surv_ratio <= gen2_evacuation_surv_ratio_max) && (heap_segment_survived (region) > 0))
+        {
+            surv_per_ratio[surv_ratio] += heap_segment_survived (region);
+        }
+        region = heap_segment_next_rw (region);
+    }
+
+    // Regions that have nothing survived are freed by the sweep already.
+    size_t total_surv = 0;
+    bool found_p = false;
+    for (int surv_ratio = 0; surv_ratio <= gen2_evacuation_surv_ratio_max; surv_ratio++)
+    {
+        total_surv += surv_per_ratio[surv_ratio];
+        if (total_surv > gen2_evacuation_budget)
+        {
+            break;
+        }
+
+        gen2_evacuation_surv_ratio_th = surv_ratio;
+        found_p |= (surv_per_ratio[surv_ratio] > 0);
+    }
+
+    if (!found_p)
+    {
+        gen2_evacuation_surv_ratio_th = -1;
+    }
+
+    dprintf (REGIONS_LOG, ("h%d budgeted gen2 evacuates regions with surv <= %d%%, budget %zd",
+        heap_number, gen2_evacuation_surv_ratio_th, gen2_evacuation_budget));
+}
+
 inline
 bool gc_heap::should_sweep_in_plan (heap_segment* region)
 {
+    if (gen2_evacuation_p && (heap_segment_gen_num (region) == max_generation))
+    {
+        heap_segment_swept_in_plan (region) = false;
+
+        size_t basic_region_size = (size_t)1 << min_segment_size_shr;
+        int surv_ratio = (int)(heap_segment_survived (region) * 100 / basic_region_size);
+        // Empty regions cost nothing to compact.
+        bool sip_p = (heap_segment_survived (region) > 0) && (surv_ratio > gen2_evacuation_surv_ratio_th);
+        if (sip_p)
+        {
+            set_region_plan_gen_num (region, max_generation);
+        }
+
+        dprintf (REGIONS_LOG, ("budgeted gen2: region %p surv %d%% %s SIP", heap_segment_mem (region),
+            surv_ratio, (sip_p ? "is" : "is not")));
+        return sip_p;
+    }
+
     if (!enable_special_regions_p)
     {
         return false;
@@ -38356,7 +39012,10 @@ void gc_heap::background_mark_phase ()
 #ifdef FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
         // The runtime is suspended, take this opportunity to pause tracking written pages to
         // avoid further perf penalty after the runtime is restarted
-        SoftwareWriteWatch::DisableForGCHeap();
+        if (SoftwareWriteWatch::IsEnabledForGCHeap())
+        {
+            SoftwareWriteWatch::DisableForGCHeap();
+        }
 #endif // FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
 
         GCToEEInterface::AfterGcScanRoots (max_generation, max_generation, &sc);
@@ -38429,13 +39088,25 @@ void gc_heap::background_mark_phase ()
     concurrent_print_time_delta ("NR GcWeakPtrScan");
 
 #ifdef MULTIPLE_HEAPS
+    bool syncblk_scanned_p = GCScan::CanWeakPtrScanByAllThreads();
+    if (syncblk_scanned_p)
+    {
+        // scan our part of the syncblk cache for deleted entries
+        GCScan::GcWeakPtrScanByAllThreads (max_generation, max_generation, &sc);
+    }
+
     bgc_t_join.join(this, gc_join_null_dead_syncblk);
     if (bgc_t_join.joined())
+#else
+    bool syncblk_scanned_p = false;
 #endif //MULTIPLE_HEAPS
     {
-        dprintf (2, ("calling GcWeakPtrScanBySingleThread"));
-        // scan for deleted entries in the syncblk cache
-        GCScan::GcWeakPtrScanBySingleThread (max_generation, max_generation, &sc);
+        if (!syncblk_scanned_p)
+        {
+            dprintf (2, ("calling GcWeakPtrScanBySingleThread"));
+            // scan for deleted entries in the syncblk cache
+            GCScan::GcWeakPtrScanBySingleThread (max_generation, max_generation, &sc);
+        }
 
 #ifdef FEATURE_EVENT_TRACE
         record_mark_time (bgc_time_info[time_mark_long_weak], current_mark_time, last_mark_time);
@@ -40483,8 +41154,7 @@ void gc_heap::clear_cards (size_t start_card, size_t end_card)
             // Figure out the bit positions of the cards within their words
             unsigned bits = card_bit (start_card);
             card_table [start_word] &= lowbits (~0, bits);
-            for (size_t i = start_word+1; i < end_word; i++)
-                card_table [i] = 0;
+            clear_side_table_words (&card_table [start_word+1], (end_word - (start_word+1)));
             bits = card_bit (end_card);
             // Don't write beyond end_card (and possibly uncommitted card table space).
             if (bits != 0)
@@ -43481,6 +44151,13 @@ size_t gc_heap::desired_new_allocation (dynamic_data* dd,
                     }
                 }
             }
+
+            if ((gen_number == 0) && pause_target && (pause_target_budget_ratio < 1.0f))
+            {
+                size_t new_allocation_for_pause = max (min_gc_size, (size_t)(new_allocation * pause_target_budget_ratio));
+                dprintf (2, ("Reducing gen0 budget from %zd to %zd for the pause target", new_allocation, new_allocation_for_pause));
+                new_allocation = new_allocation_for_pause;
+            }
         }
 
         size_t new_allocation_ret = Align (new_allocation, get_alignment_constant (gen_number <= max_generation));
@@ -44056,7 +44733,11 @@ bool gc_heap::decommit_step (uint64_t step_milliseconds)
     size_t decommit_size = 0;
 
 #ifdef USE_REGIONS
-    const size_t max_decommit_step_size = DECOMMIT_SIZE_PER_MILLISECOND * step_milliseconds;
+    size_t max_decommit_step_size = DECOMMIT_SIZE_PER_MILLISECOND * step_milliseconds;
+    if (get_commit_target_excess() > 0)
+    {
+        max_decommit_step_size *= COMMIT_TARGET_DECOMMIT_STEP_FACTOR;
+    }
     for (int kind = basic_free_region; kind < count_free_region_kinds; kind++)
     {
         dprintf (REGIONS_LOG, ("decommit_step %d, regions_to_decommit = %zd",
@@ -44542,6 +45223,14 @@ BOOL gc_heap::decide_on_compacting (int condemned_gen_number,
     }
 
 #ifdef USE_REGIONS
+    if (!should_compact && (gen2_evacuation_surv_ratio_th >= 0))
+    {
+        dprintf (GTC_LOG, ("h%d budgeted gen2 evacuating regions with surv <= %d%%",
+            heap_number, gen2_evacuation_surv_ratio_th));
+        should_compact = TRUE;
+        get_gc_data_per_heap()->set_mechanism (gc_heap_compact, compact_high_frag);
+    }
+
     if (!should_compact)
     {
         should_compact = !!decide_on_compaction_space();
@@ -44574,6 +45263,30 @@ BOOL gc_heap::decide_on_compacting (int condemned_gen_number,
     BOOL high_memory = FALSE;
 #endif // HOST_64BIT
 
+    if (!should_compact && (condemned_gen_number == max_generation))
+    {
+        // above the commit target we compact gen2 if that gives back a meaningful part of the excess
+        size_t commit_target_excess = get_commit_target_excess();
+        if (commit_target_excess > 0)
+        {
+            uint32_t num_heaps = 1;
+#ifdef MULTIPLE_HEAPS
+            num_heaps = gc_heap::n_heaps;
+#endif // MULTIPLE_HEAPS
+
+            ptrdiff_t reclaim_space = generation_size (max_generation) - generation_plan_size (max_generation);
+            size_t gen2_size = generation_size (max_generation);
+            size_t reclaim_th = max (min ((commit_target_excess / num_heaps), (gen2_size / 10)), (gen2_size / 100));
+
+            if ((reclaim_space > 0) && ((size_t)reclaim_space >= reclaim_th))
+            {
+                dprintf (GTC_LOG, ("compacting to get under the commit target, reclaim %zd >= %zd", reclaim_space, reclaim_th));
+                should_compact = TRUE;
+                get_gc_data_per_heap()->set_mechanism (gc_heap_compact, compact_commit_target);
+            }
+        }
+    }
+
     if (!should_compact)
     {
         // We are not putting this in dt_high_frag_p because it's not exactly
@@ -46001,7 +46714,9 @@ void gc_heap::background_sweep()
                     // we can treat all UOH segments as in the bgc domain
                     // regardless of whether we saw in bgc mark or not
                     // because we don't allow UOH allocations during bgc
-                    // sweep anyway - the UOH segments can't change.
+                    // sweep anyway - the UOH segments can't change. With
+                    // bgc_uoh_sweep_yield_p we only let allocations in
+                    // between segments so this segment still can't change.
                     process_background_segment_end (seg, gen, plug_end,
                                                     start_seg, &delete_p, 0);
                 }
@@ -46033,6 +46748,36 @@ void gc_heap::background_sweep()
 
             verify_soh_segment_list();
 
+            if ((i > max_generation) && bgc_uoh_sweep_yield_p && next_seg)
+            {
+                // Let allocating threads in between segments. This is safe because
+                // - the free list of this gen only has items we've already swept;
+                // - objects allocated into segments we haven't swept yet are marked in
+                //   the mark array (see adjust_limit_clr and bgc_uoh_alloc_clr) so we
+                //   will keep them when we get to those segments;
+                // - segments obtained during the sweep have background_allocated 0 and
+                //   only contain objects allocated during this BGC, we skip them below.
+                add_saved_spinlock_info (true, me_release, mt_bgc_uoh_sweep, msl_entered);
+                leave_spin_lock (&more_space_lock_uoh);
+
+                enter_spin_lock (&more_space_lock_uoh);
+                add_saved_spinlock_info (true, me_acquire, mt_bgc_uoh_sweep, msl_entered);
+
+                // Threads that allocated while we weren't holding the msl may still be
+                // clearing their objects so we need to wait for them again.
+                int spin_count = yp_spin_count_unit;
+                while (uoh_alloc_thread_count)
+                {
+                    spin_and_switch (spin_count, (uoh_alloc_thread_count == 0));
+                }
+
+                while (next_seg && heap_segment_background_allocated (next_seg) == 0)
+                {
+                    dprintf (2, ("[h%d] skip new uoh %p ", heap_number, next_seg));
+                    next_seg = heap_segment_next (next_seg);
+                }
+            }
+
 #ifdef DOUBLY_LINKED_FL
             while (next_seg && heap_segment_background_allocated (next_seg) == 0)
             {
@@ -48399,6 +49144,7 @@ HRESULT GCHeap::Initialize()
 
 #ifdef USE_REGIONS
     gc_heap::enable_special_regions_p = (bool)GCConfig::GetGCEnableSpecialRegions();
+    gc_heap::gen2_evacuation_budget = (size_t)GCConfig::GetGCGen2EvacuationBudget();
     size_t gc_region_size = (size_t)GCConfig::GetGCRegionSize();
 
     if (gc_region_size >= MAX_REGION_SIZE)
@@ -50209,6 +50955,32 @@ void gc_heap::update_recorded_gen_data (last_recorded_gc_info* gc_info)
     }
 }
 
+// We don't try to hit the target exactly - the gen0 budget is only one of the things that
+// determine how long an ephemeral GC takes (survivorship and pinning being the others) so
+// we back off quickly when we are over the target and recover slowly when we are under it.
+void gc_heap::update_pause_target_budget (size_t pause_duration)
+{
+    assert (pause_target != 0);
+
+    // Decay the observed max by 1/8th each GC so a single outlier doesn't keep the budget
+    // low forever but a recurring long pause does.
+    pause_target_observed = max (pause_duration, (pause_target_observed - (pause_target_observed / 8)));
+
+    const float min_ratio = 0.1f;
+    if (pause_target_observed > pause_target)
+    {
+        float reduction = max (0.5f, ((float)pause_target / (float)pause_target_observed));
+        pause_target_budget_ratio = max (min_ratio, (pause_target_budget_ratio * reduction));
+    }
+    else if (pause_target_observed < (pause_target / 2))
+    {
+        pause_target_budget_ratio = min (1.0f, (pause_target_budget_ratio * 1.1f));
+    }
+
+    dprintf (2, ("pause target %zdus, this pause %zdus, observed %zdus -> gen0 budget ratio %d%%",
+        pause_target, pause_duration, pause_target_observed, (int)(pause_target_budget_ratio * 100)));
+}
+
 void gc_heap::do_post_gc()
 {
 #ifdef MULTIPLE_HEAPS
@@ -50327,6 +51099,11 @@ void gc_heap::do_post_gc()
         last_gc_info->pause_durations[0] = pause_duration;
         total_suspended_time += pause_duration;
         last_gc_info->pause_durations[1] = 0;
+
+        if (pause_target && (settings.condemned_generation < max_generation))
+        {
+            update_pause_target_budget (pause_duration);
+        }
     }
 
     uint64_t total_process_time = end_gc_time - process_start_time;
@@ -77,11 +77,13 @@ public:
     BOOL_CONFIG  (GCNumaAware,               "GCNumaAware",               NULL,                                true,               "Enables numa allocations in the GC")                                                     \
     BOOL_CONFIG  (GCCpuGroup,                "GCCpuGroup",                "System.GC.CpuGroup",                false,              "Enables CPU groups in the GC")                                                            \
     BOOL_CONFIG  (GCLargePages,              "GCLargePages",              "System.GC.LargePages",              false,              "Enables using Large Pages in the GC")                                                     \
+    BOOL_CONFIG  (GCOSWriteWatch,            "GCOSWriteWatch",            NULL,                                false,              "Specifies whether background GC tracks written pages with the OS instead of the write barrier") \
     INT_CONFIG   (HeapVerifyLevel,           "HeapVerify",                NULL,                                HEAPVERIFY_NONE,    "When set verifies the integrity of the managed heap on entry and exit of each GC")       \
     INT_CONFIG   (LOHCompactionMode,         "GCLOHCompact",              NULL,                                0,                  "Specifies the LOH compaction mode")                                                      \
     INT_CONFIG   (LOHThreshold,              "GCLOHThreshold",            "System.GC.LOHThreshold",            LARGE_OBJECT_SIZE,  "Specifies the size that will make objects go on LOH")                                    \
     INT_CONFIG   (BGCSpinCount,              "BGCSpinCount",              NULL,                                140,                "Specifies the bgc spin count")                                                           \
     INT_CONFIG   (BGCSpin,                   "BGCSpin",                   NULL,                                2,                  "Specifies the bgc spin time")                                                            \
+    BOOL_CONFIG  (BGCUOHSweepYield,          "GCBGCUOHSweepYield",        NULL,                                false,              "Specifies whether BGC lets UOH allocations in between UOH segments it sweeps")           \
     INT_CONFIG   (HeapCount,                 "GCHeapCount",               "System.GC.HeapCount",               0,                  "Specifies the number of server GC heaps")                                                 \
     INT_CONFIG   (MaxHeapCount,              "GCMaxHeapCount",            "System.GC.MaxHeapCount",            0,                  "Specifies the max number of server GC heaps to adjust to")                                                 \
     INT_CONFIG   (Gen0Size,                  "GCgen0size",                NULL,                                0,                  "Specifies the smallest gen0 budget")                                                     \
@@ -134,14 +136,22 @@ public:
     INT_CONFIG   (GCHeapHardLimitSOHPercent, "GCHeapHardLimitSOHPercent", "System.GC.HeapHardLimitSOHPercent", 0,                  "Specifies the GC heap SOH usage as a percentage of the total memory")                    \
     INT_CONFIG   (GCHeapHardLimitLOHPercent, "GCHeapHardLimitLOHPercent", "System.GC.HeapHardLimitLOHPercent", 0,                  "Specifies the GC heap LOH usage as a percentage of the total memory")                    \
     INT_CONFIG   (GCHeapHardLimitPOHPercent, "GCHeapHardLimitPOHPercent", "System.GC.HeapHardLimitPOHPercent", 0,                  "Specifies the GC heap POH usage as a percentage of the total memory")                    \
-    INT_CONFIG   (GCEnabledInstructionSets,  "GCEnabledInstructionSets",  NULL,                                -1,                 "Specifies whether GC can use AVX2 or AVX512F - 0 for neither, 1 for AVX2, 3 for AVX512F")\
+    INT_CONFIG   (GCEnabledInstructionSets,  "GCEnabledInstructionSets",  NULL,                                -1,                 "Specifies whether GC can use AVX2, AVX512F or NEON - 0 for none, 1 for AVX2, 3 for AVX512F, 4 for NEON")\
     INT_CONFIG   (GCConserveMem,             "GCConserveMemory",          "System.GC.ConserveMemory",          0,                  "Specifies how hard GC should try to conserve memory - values 0-9")                       \
     INT_CONFIG   (GCWriteBarrier,            "GCWriteBarrier",            NULL,                                0,                  "Specifies whether GC should use more precise but slower write barrier")                  \
     STRING_CONFIG(GCName,                    "GCName",                    "System.GC.Name",                                        "Specifies the name of the standalone GC implementation.")                                \
     STRING_CONFIG(GCPath,                    "GCPath",                    "System.GC.Path",                                        "Specifies the path of the standalone GC implementation.")                                \
     INT_CONFIG   (GCSpinCountUnit,           "GCSpinCountUnit",           NULL,                                0,                  "Specifies the spin count unit used by the GC.")                                          \
     INT_CONFIG   (GCDynamicAdaptationMode,   "GCDynamicAdaptationMode",   "System.GC.DynamicAdaptationMode",   1,                  "Enable the GC to dynamically adapt to application sizes.")                               \
-    INT_CONFIG   (GCDTargetTCP,              "GCDTargetTCP",              "System.GC.DTargetTCP",              0,                  "Specifies the target tcp for DATAS")
+    INT_CONFIG   (GCDTargetTCP,              "GCDTargetTCP",              "System.GC.DTargetTCP",              0,                  "Specifies the target tcp for DATAS")                                                     \
+    BOOL_CONFIG  (GCMarkSteal,               "GCMarkSteal",               NULL,                                true,               "Enables Server GC threads to steal marking work from other heaps' mark stacks")          \
+    INT_CONFIG   (GCMarkStealThreshold,      "GCMarkStealThreshold",      NULL,                                (100*1024*1024),    "Specifies the total heap size above which full blocking GCs do mark stealing")           \
+    INT_CONFIG   (LOHCompactionSliceSize,    "GCLOHCompactSliceSize",     NULL,                                0,                  "Specifies the max bytes of LOH objects each compacting GC moves per heap; 0 means no limit") \
+    INT_CONFIG   (GCPauseTargetMs,           "GCPauseTargetMs",           "System.GC.PauseTargetMs",           0,                  "Specifies the ephemeral GC pause time in ms the GC should try to stay under by adjusting the gen0 budget") \
+    INT_CONFIG   (GCHeapCommitTarget,        "GCHeapCommitTarget",        "System.GC.HeapCommitTarget",        0,                  "Specifies a soft goal for the GC's committed bytes; above it the GC decommits and compacts more eagerly") \
+    INT_CONFIG   (GCGen0BudgetPoolPercent,   "GCGen0BudgetPoolPercent",   NULL,                                0,                  "Specifies the percentage of each heap's gen0 budget Server GC pools for the heaps that run out of budget first, 0 (the default) disables the pool") \
+    INT_CONFIG   (GCGen2EvacuationBudget,    "GCGen2EvacuationBudget",    NULL,                                0,                  "Specifies the max survived bytes per heap a gen2 GC relocates by evacuating only the most fragmented regions; 0 disables it") \
+    INT_CONFIG   (GCJoinGroupSize,           "GCJoinGroupSize",           NULL,                                0,                  "Specifies the number of heaps per group for hierarchical GC joins; 0 (the default) or a value >= the heap count disables them")
 // This class is responsible for retreiving configuration information
 // for how the GC should operate.
 class GCConfig
@@ -325,4 +325,18 @@ inline void GCToEEInterface::LogErrorToHost(const char *message)
     }
 }
 
+inline void GCToEEInterface::SyncBlockCacheWeakPtrScanPartition(HANDLESCANPROC scanProc, uintptr_t lp1, uintptr_t lp2)
+{
+    assert(g_theGCToCLR != nullptr);
+    assert(g_runtimeSupportedVersion.MajorVersion >= 3);
+    g_theGCToCLR->SyncBlockCacheWeakPtrScanPartition(scanProc, lp1, lp2);
+}
+
+inline void GCToEEInterface::RefCountedHandleCallbacksBatch(Object** objects, bool* promote, size_t count)
+{
+    assert(g_theGCToCLR != nullptr);
+    assert(g_runtimeSupportedVersion.MajorVersion >= 4);
+    g_theGCToCLR->RefCountedHandleCallbacksBatch(objects, promote, count);
+}
+
 #endif // __GCTOENV_EE_STANDALONE_INL__
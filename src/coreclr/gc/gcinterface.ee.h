@@ -459,6 +459,19 @@ public:
     // The following method is available only with EE_INTERFACE_MAJOR_VERSION >= 1
     virtual
     void LogErrorToHost(const char *message) PURE_VIRTUAL
+
+    // The following method is available only with EE_INTERFACE_MAJOR_VERSION >= 3
+    // Performs a weak pointer scan of the part of the sync block cache assigned to the GC thread
+    // described by the ScanContext passed in lp1. All the GC threads call this concurrently.
+    virtual
+    void SyncBlockCacheWeakPtrScanPartition(HANDLESCANPROC scanProc, uintptr_t lp1, uintptr_t lp2) PURE_VIRTUAL
+
+    // The following method is available only with EE_INTERFACE_MAJOR_VERSION >= 3
+    // Batched form of RefCountedHandleCallbacks. Sets promote[i] to whether the object in
+    // objects[i] should be promoted. Every GC thread calls this concurrently for the handles
+    // it is scanning.
+    virtual
+    void RefCountedHandleCallbacksBatch(Object** objects, bool* promote, size_t count) PURE_VIRTUAL
 };
 
 #endif // _GCINTERFACE_EE_H_
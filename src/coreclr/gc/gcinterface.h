@@ -15,7 +15,7 @@
 
 // The major version of the IGCToCLR interface. Breaking changes to this interface
 // require bumps in the major version number.
-#define EE_INTERFACE_MAJOR_VERSION 2
+#define EE_INTERFACE_MAJOR_VERSION 3
 
 struct ScanContext;
 struct gc_alloc_context;
@@ -1047,7 +1047,10 @@ enum GC_ALLOC_FLAGS
     GC_ALLOC_ZEROING_OPTIONAL   = 16,
     GC_ALLOC_LARGE_OBJECT_HEAP  = 32,
     GC_ALLOC_PINNED_OBJECT_HEAP = 64,
-    GC_ALLOC_USER_OLD_HEAP      = GC_ALLOC_LARGE_OBJECT_HEAP | GC_ALLOC_PINNED_OBJECT_HEAP,
+    // The object is expected to be long lived so it's allocated directly in an older generation
+    // (currently the LOH) instead of being copied out of gen0 and gen1 by ephemeral GCs.
+    GC_ALLOC_PRETENURED         = 128,
+    GC_ALLOC_USER_OLD_HEAP      = GC_ALLOC_LARGE_OBJECT_HEAP | GC_ALLOC_PINNED_OBJECT_HEAP | GC_ALLOC_PRETENURED,
 };
 
 inline GC_ALLOC_FLAGS operator|(GC_ALLOC_FLAGS a, GC_ALLOC_FLAGS b)
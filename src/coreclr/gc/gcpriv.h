@@ -1663,6 +1663,7 @@ private:
                                     heap_segment* region_to_delete,
                                     heap_segment* prev_region,
                                     heap_segment* next_region);
+    PER_HEAP_METHOD void decide_on_gen2_evacuation();
     PER_HEAP_METHOD bool should_sweep_in_plan (heap_segment* region);
 
     PER_HEAP_METHOD void sweep_region_in_plan (heap_segment* region,
@@ -1754,6 +1755,8 @@ private:
 
     PER_HEAP_ISOLATED_METHOD void do_post_gc();
 
+    PER_HEAP_ISOLATED_METHOD void update_pause_target_budget (size_t pause_duration);
+
     PER_HEAP_ISOLATED_METHOD void update_recorded_gen_data (last_recorded_gc_info* gc_info);
 
     PER_HEAP_METHOD void update_end_gc_time_per_heap();
@@ -2386,6 +2389,8 @@ private:
 #endif //MULTIPLE_HEAPS
     PER_HEAP_METHOD size_t decommit_heap_segment_pages_worker (heap_segment* seg, uint8_t *new_committed);
     PER_HEAP_ISOLATED_METHOD bool decommit_step (uint64_t step_milliseconds);
+
+    PER_HEAP_ISOLATED_METHOD size_t get_commit_target_excess();
 #ifdef USE_REGIONS
     PER_HEAP_ISOLATED_METHOD size_t decommit_region (heap_segment* region, int bucket, int h_number);
 #endif //USE_REGIONS
@@ -2608,6 +2613,10 @@ private:
     PER_HEAP_METHOD ptrdiff_t  get_new_allocation (int gen_number);
     PER_HEAP_METHOD ptrdiff_t  get_allocation (int gen_number);
     PER_HEAP_METHOD bool new_allocation_allowed (int gen_number);
+#ifdef MULTIPLE_HEAPS
+    PER_HEAP_ISOLATED_METHOD void fill_gen0_budget_pool();
+    PER_HEAP_METHOD bool borrow_gen0_budget();
+#endif //MULTIPLE_HEAPS
 #ifdef BACKGROUND_GC
     PER_HEAP_ISOLATED_METHOD void allow_new_allocation (int gen_number);
     PER_HEAP_ISOLATED_METHOD void disallow_new_allocation (int gen_number);
@@ -2660,6 +2669,7 @@ private:
     PER_HEAP_METHOD uint8_t* background_mark_object (uint8_t* o THREAD_NUMBER_DCL);
     PER_HEAP_METHOD void background_mark_simple (uint8_t* o THREAD_NUMBER_DCL);
     PER_HEAP_METHOD void background_mark_simple1 (uint8_t* o THREAD_NUMBER_DCL);
+    PER_HEAP_METHOD void background_push_queued (uint8_t* o THREAD_NUMBER_DCL);
     PER_HEAP_ISOLATED_METHOD void background_promote (Object**, ScanContext* , uint32_t);
     PER_HEAP_METHOD BOOL background_object_marked (uint8_t* o, BOOL clearp);
     PER_HEAP_METHOD void init_background_gc();
@@ -3552,6 +3562,11 @@ private:
 
     PER_HEAP_FIELD_SINGLE_GC bool special_sweep_p;
 
+    // Set by decide_on_gen2_evacuation for a budgeted gen2 - gen2 regions with a higher survival
+    // ratio than gen2_evacuation_surv_ratio_th are swept in plan, -1 means none are evacuated.
+    PER_HEAP_FIELD_SINGLE_GC bool gen2_evacuation_p;
+    PER_HEAP_FIELD_SINGLE_GC int gen2_evacuation_surv_ratio_th;
+
 #else //USE_REGIONS
     PER_HEAP_FIELD_SINGLE_GC BOOL ro_segments_in_range;
 
@@ -3635,6 +3650,11 @@ private:
     // this heap's LOH is compacted or not. So even if
     // settings.loh_compaction is TRUE this may not be TRUE.
     PER_HEAP_FIELD_SINGLE_GC BOOL loh_compacted_p;
+
+    // Set when plan_loh stopped moving objects because it reached
+    // loh_compaction_slice_size. The objects it didn't get to are left
+    // in place and will be compacted by a later LOH compacting GC.
+    PER_HEAP_FIELD_SINGLE_GC BOOL loh_compaction_partial_p;
 #endif //FEATURE_LOH_COMPACTION
 
     /*****************************************/
@@ -4209,6 +4229,12 @@ private:
 
     PER_HEAP_ISOLATED_FIELD_MAINTAINED uint64_t gc_last_ephemeral_decommit_time;
 
+    // When GCPauseTargetMs is specified we keep a decaying max of the ephemeral blocking
+    // pauses (which tracks the tail of the pause distribution rather than the average)
+    // and scale the gen0 budget by pause_target_budget_ratio to keep it under the target.
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED size_t pause_target_observed;
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED float pause_target_budget_ratio;
+
     // maintained as we need to grow bookkeeping data.
     PER_HEAP_ISOLATED_FIELD_MAINTAINED size_t card_table_element_layout[total_bookkeeping_elements + 1];
 
@@ -5088,6 +5114,13 @@ private:
     PER_HEAP_ISOLATED_FIELD_MAINTAINED_ALLOC size_t current_total_committed;
     PER_HEAP_ISOLATED_FIELD_MAINTAINED_ALLOC size_t committed_by_oh[recorded_committed_bucket_counts];
 
+#ifdef MULTIPLE_HEAPS
+    // gen0 budget held back from the heaps at the end of a GC, which heaps that run out of
+    // gen0 budget borrow from before triggering a GC. See fill_gen0_budget_pool.
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED_ALLOC ptrdiff_t gen0_budget_pool;
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED_ALLOC size_t gen0_budget_pool_quantum;
+#endif //MULTIPLE_HEAPS
+
     /********************************************/
     // PER_HEAP_ISOLATED_FIELD_INIT_ONLY fields //
     /********************************************/
@@ -5101,6 +5134,14 @@ private:
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY uint64_t total_physical_mem;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY int generation_skip_ratio_threshold;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY int conserve_mem_setting;
+    // In microseconds, 0 means there's no pause target.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t pause_target;
+    // Soft goal for current_total_committed, 0 means there's no target.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t heap_commit_target;
+#ifdef MULTIPLE_HEAPS
+    // Percentage of each heap's gen0 budget that goes to gen0_budget_pool, 0 disables the pool.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY int gen0_budget_pool_percent;
+#endif //MULTIPLE_HEAPS
 
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool spin_count_unit_config_p;
 
@@ -5190,6 +5231,13 @@ private:
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t min_balance_threshold;
 
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t max_decommit_step_size;
+
+#ifdef MH_SC_MARK
+    // Full blocking GCs let idle GC threads steal marking work from other heaps'
+    // mark stacks when this is enabled and the total heap size is above the threshold.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool mark_steal_enabled_p;
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t mark_steal_heap_size_threshold;
+#endif //MH_SC_MARK
 #else //MULTIPLE_HEAPS
 #endif //MULTIPLE_HEAPS
 
@@ -5206,6 +5254,8 @@ private:
 #ifdef USE_REGIONS
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t regions_range;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool enable_special_regions_p;
+    // Max survived bytes per heap a gen2 relocates, 0 means gen2s compact all regions as usual.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t gen2_evacuation_budget;
 #else //USE_REGIONS
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t eph_gen_starts_size;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t min_segment_size;
@@ -5219,6 +5269,11 @@ private:
 #ifdef FEATURE_LOH_COMPACTION
     // This is for forced LOH compaction via the complus env var
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY BOOL        loh_compaction_always_p;
+
+    // How many bytes of LOH objects a compacting GC moves per heap (0 means no limit).
+    // Limiting this bounds the copying part of the pause and spreads the work of
+    // compacting a fragmented LOH over multiple GCs.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t      loh_compaction_slice_size;
 #endif //FEATURE_LOH_COMPACTION
 
 #ifdef HOST_64BIT
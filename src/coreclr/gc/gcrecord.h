@@ -250,7 +250,8 @@ enum gc_heap_compact_reason
     compact_vhigh_mem_frag = 9,
     compact_no_gc_mode = 10,
     compact_aggressive_compacting = 11,
-    max_compact_reasons_count = 12
+    compact_commit_target = 12,
+    max_compact_reasons_count = 13
 };
 
 #ifndef DACCESS_COMPILE
@@ -267,7 +268,8 @@ static BOOL gc_heap_compact_reason_mandatory_p[] =
     TRUE, //compact_high_mem_frag = 8,
     TRUE, //compact_vhigh_mem_frag = 9,
     TRUE, //compact_no_gc_mode = 10,
-    TRUE //compact_aggressive_compacting = 11
+    TRUE, //compact_aggressive_compacting = 11
+    FALSE //compact_commit_target = 12
 };
 
 static BOOL gc_expand_mechanism_mandatory_p[] =
@@ -294,7 +296,9 @@ static char* str_heap_compact_reasons[] =
     "high memory load (ephemeral GC)",
     "high memory load and frag",
     "very high memory load and frag",
-    "no gc mode"
+    "no gc mode",
+    "aggressive compacting",
+    "above commit target"
 };
 #endif //DT_LOG
 
@@ -58,6 +58,13 @@ void GCScan::GcDhInitialScan(promote_func* fn, int condemned, int max_gen, ScanC
     pDhContext->m_iMaxGen = max_gen;
     pDhContext->m_pScanContext = sc;
 
+    // Rebuild the list of pending handles from scratch on the initial scan. Background GCs scan the table
+    // while the mutator can still create and free handles, so the addresses recorded in the list could go
+    // stale under them; those always use full scans.
+    pDhContext->m_cPending = 0;
+    pDhContext->m_fPendingRecording = !sc->concurrent;
+    pDhContext->m_fPendingValid = false;
+
     // Look for dependent handle whose primary has been promoted but whose secondary has not. Promote the
     // secondary in those cases. Additionally this scan sets the m_fUnpromotedPrimaries and m_fPromoted state
     // flags in the DH context. The m_fUnpromotedPrimaries flag is the most interesting here: if this flag is
@@ -132,6 +139,23 @@ void GCScan::GcWeakPtrScanBySingleThread( int condemned, int max_gen, ScanContex
     GCToEEInterface::SyncBlockCacheWeakPtrScan(&CheckPromoted, (uintptr_t)sc, 0);
 }
 
+// Older runtimes only know how to scan the whole sync block cache on one thread.
+bool GCScan::CanWeakPtrScanByAllThreads()
+{
+#ifdef BUILD_AS_STANDALONE
+    return g_runtimeSupportedVersion.MajorVersion >= 3;
+#else
+    return true;
+#endif // BUILD_AS_STANDALONE
+}
+
+void GCScan::GcWeakPtrScanByAllThreads( int condemned, int max_gen, ScanContext* sc )
+{
+    UNREFERENCED_PARAMETER(condemned);
+    UNREFERENCED_PARAMETER(max_gen);
+    GCToEEInterface::SyncBlockCacheWeakPtrScanPartition(&CheckPromoted, (uintptr_t)sc, 0);
+}
+
 void GCScan::GcScanSizedRefs(promote_func* fn, int condemned, int max_gen, ScanContext* sc)
 {
     Ref_ScanSizedRefHandles(condemned, max_gen, sc, fn);
@@ -28,6 +28,20 @@ struct DhContext
     int             m_iCondemned;               // The condemned generation
     int             m_iMaxGen;                  // The maximum generation
     ScanContext    *m_pScanContext;             // The GC's scan context for this phase
+
+    // Dependent handles whose primary was still unpromoted on the last scan. Once the first full scan of
+    // the handle table has built this list, rescans only need to revisit these handles rather than the
+    // whole table. The list is retained between GCs to avoid reallocating it every mark phase.
+    struct DhPending
+    {
+        Object    **m_pPrimary;
+        Object    **m_pSecondary;
+    };
+    DhPending      *m_pPending;                 // Handles still waiting on their primary
+    size_t          m_cPending;                 // Number of valid entries in m_pPending
+    size_t          m_cPendingCapacity;         // Allocated size of m_pPending
+    bool            m_fPendingRecording;        // Is the current full scan building the pending list?
+    bool            m_fPendingValid;            // Does m_pPending hold every unpromoted primary?
 };
 
 class GCScan
@@ -56,6 +70,10 @@ class GCScan
     static void GcWeakPtrScan (int condemned, int max_gen, ScanContext*sc);
     static void GcWeakPtrScanBySingleThread (int condemned, int max_gen, ScanContext*sc);
 
+    // scan the sync block cache for dead weak pointers with every GC thread taking a part of it
+    static bool CanWeakPtrScanByAllThreads ();
+    static void GcWeakPtrScanByAllThreads (int condemned, int max_gen, ScanContext*sc);
+
     // scan for dead weak pointers
     static void GcShortWeakPtrScan (int condemned, int max_gen, ScanContext* sc);
 
@@ -190,6 +190,9 @@ void HndDestroyHandleTable(HHANDLETABLE hTable)
     // fetch the handle table pointer
     HandleTable *pTable = Table(hTable);
 
+    // pinned handles cached by threads must not come back to this table
+    TableInvalidateThreadHandleCaches();
+
 #ifdef ENABLE_PERF_COUNTERS
     // decrement handle count by number of handles in this table
     GetPerfCounters().m_GC.cHandles -= HndCountHandles(hTable);
@@ -703,6 +703,153 @@ void TableCacheMissOnFree(HandleTable *pTable, HandleTypeCache *pCache, uint32_t
 }
 
 
+/****************************************************************************
+ *
+ * PER-THREAD CACHE
+ *
+ ****************************************************************************/
+
+/*
+ * Pinned handles are typically allocated and freed on the same thread around
+ * a single I/O operation.  Each thread keeps a few free ones to itself so that
+ * doing so doesn't hit the table's shared reserve and free banks every time.
+ *
+ * Handles in a thread cache are "used" as far as the table is concerned, like
+ * the ones in the main and quick caches, but with a NULL referent.
+ */
+static uint32_t g_uThreadHandleCacheEpoch = 0;
+
+static void TableFreeSingleHandleToTableCache(HandleTable *pTable, uint32_t uType, OBJECTHANDLE handle);
+
+struct ThreadHandleCache
+{
+    /*
+     * table the cached handles belong to and the epoch it was seen at
+     */
+    HandleTable *pTable;
+    uint32_t uEpoch;
+
+    /*
+     * number of cached handles
+     */
+    uint32_t uCount;
+
+    /*
+     * set once the thread is going away
+     */
+    bool fDestroyed;
+
+    OBJECTHANDLE rgHandles[HANDLES_PER_THREAD_CACHE];
+
+    bool IsValidFor(HandleTable *pTableToCheck)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        return (pTable == pTableToCheck) && (uEpoch == VolatileLoad(&g_uThreadHandleCacheEpoch));
+    }
+
+    // Gives the last uFlushCount cached handles back to their table in one go
+    void Flush(uint32_t uFlushCount)
+    {
+        WRAPPER_NO_CONTRACT;
+
+        _ASSERTE(uFlushCount <= uCount);
+
+        // if the table has been destroyed since then the handles went away with it
+        if (IsValidFor(pTable))
+        {
+            for (uint32_t i = uCount - uFlushCount; i < uCount; i++)
+            {
+                TableFreeSingleHandleToTableCache(pTable, HNDTYPE_PINNED, rgHandles[i]);
+            }
+        }
+
+        uCount -= uFlushCount;
+    }
+
+    ~ThreadHandleCache()
+    {
+        WRAPPER_NO_CONTRACT;
+
+        if (uCount != 0)
+        {
+            Flush(uCount);
+        }
+
+        fDestroyed = true;
+    }
+};
+
+static thread_local ThreadHandleCache t_threadHandleCache;
+
+/*
+ * TableInvalidateThreadHandleCaches
+ *
+ * Makes all the thread caches drop their handles instead of returning them
+ * to a table that is being destroyed.
+ *
+ */
+void TableInvalidateThreadHandleCaches()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    Interlocked::Increment(&g_uThreadHandleCacheEpoch);
+}
+
+/*
+ * TableAllocSingleHandleFromThreadCache
+ *
+ * Gets a pinned handle from the current thread's cache, or NULL if it has
+ * none for the specified table.
+ *
+ */
+static OBJECTHANDLE TableAllocSingleHandleFromThreadCache(HandleTable *pTable)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    ThreadHandleCache *pThreadCache = &t_threadHandleCache;
+    if ((pThreadCache->uCount == 0) || !pThreadCache->IsValidFor(pTable))
+        return NULL;
+
+    return pThreadCache->rgHandles[--pThreadCache->uCount];
+}
+
+/*
+ * TableFreeSingleHandleToThreadCache
+ *
+ * Stores a pinned handle in the current thread's cache, giving half of the
+ * cache back to the table when it is full.  Returns FALSE if the thread can't
+ * cache handles anymore.
+ *
+ */
+static BOOL TableFreeSingleHandleToThreadCache(HandleTable *pTable, OBJECTHANDLE handle)
+{
+    WRAPPER_NO_CONTRACT;
+
+    ThreadHandleCache *pThreadCache = &t_threadHandleCache;
+    if (pThreadCache->fDestroyed)
+        return FALSE;
+
+    if (!pThreadCache->IsValidFor(pTable))
+    {
+        // switch the cache over to this table
+        pThreadCache->Flush(pThreadCache->uCount);
+        pThreadCache->pTable = pTable;
+        pThreadCache->uEpoch = VolatileLoad(&g_uThreadHandleCacheEpoch);
+    }
+    else if (pThreadCache->uCount == HANDLES_PER_THREAD_CACHE)
+    {
+        pThreadCache->Flush(HANDLES_PER_THREAD_CACHE / 2);
+    }
+
+    pThreadCache->rgHandles[pThreadCache->uCount++] = handle;
+    return TRUE;
+}
+
+/*--------------------------------------------------------------------------*/
+
+
+
 /*
  * TableAllocSingleHandleFromCache
  *
@@ -718,6 +865,14 @@ OBJECTHANDLE TableAllocSingleHandleFromCache(HandleTable *pTable, uint32_t uType
     // we use this in two places
     OBJECTHANDLE handle;
 
+    // pinned handles may be waiting in this thread's cache
+    if (uType == HNDTYPE_PINNED)
+    {
+        handle = TableAllocSingleHandleFromThreadCache(pTable);
+        if (handle)
+            return handle;
+    }
+
     // first try to get a handle from the quick cache
     if (pTable->rgQuickCache[uType])
     {
@@ -786,6 +941,31 @@ void TableFreeSingleHandleToCache(HandleTable *pTable, uint32_t uType, OBJECTHAN
     if (TypeHasUserData(pTable, uType))
         HandleQuickSetUserData(handle, 0L);
 
+    // pinned handles go to this thread's cache first
+    if ((uType == HNDTYPE_PINNED) && TableFreeSingleHandleToThreadCache(pTable, handle))
+        return;
+
+    TableFreeSingleHandleToTableCache(pTable, uType, handle);
+}
+
+
+/*
+ * TableFreeSingleHandleToTableCache
+ *
+ * Returns a single cleared handle to the table's quick cache or free bank.
+ *
+ */
+static void TableFreeSingleHandleToTableCache(HandleTable *pTable, uint32_t uType, OBJECTHANDLE handle)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        CAN_TAKE_LOCK;         // because of TableCacheMissOnFree
+    }
+    CONTRACTL_END;
+
     // is there room in the quick cache?
     if (!pTable->rgQuickCache[uType])
     {
@@ -100,6 +100,7 @@ C_ASSERT (HANDLE_HANDLES_PER_MASK * 2 == HANDLE_HANDLES_PER_BLOCK);
 // cache layout metrics
 #define HANDLE_CACHE_TYPE_SIZE          128 // 128 == 63 handles per bank
 #define HANDLES_PER_CACHE_BANK          ((HANDLE_CACHE_TYPE_SIZE / 2) - 1)
+#define HANDLES_PER_THREAD_CACHE        16  // pinned handles each thread keeps to itself
 
 // cache policy defines
 #define REBALANCE_TOLERANCE             (HANDLES_PER_CACHE_BANK / 3)
@@ -770,6 +770,16 @@ uint32_t TableAllocHandlesFromCache(HandleTable *pTable, uint32_t uType, OBJECTH
  */
 void TableFreeHandlesToCache(HandleTable *pTable, uint32_t uType, const OBJECTHANDLE *pHandleBase, uint32_t uCount);
 
+
+/*
+ * TableInvalidateThreadHandleCaches
+ *
+ * Makes all the thread caches drop their handles instead of returning them
+ * to a table that is being destroyed.
+ *
+ */
+void TableInvalidateThreadHandleCaches();
+
 /*--------------------------------------------------------------------------*/
 
 
@@ -104,6 +104,85 @@ void CALLBACK PromoteRefCounted(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pExtra
     // Assert this object wasn't relocated since we are passing a temporary object's address.
     _ASSERTE(pOldObj == pObj);
 }
+
+#define REFCOUNTED_BATCH_SIZE 256
+
+/*
+ * struct REFCOUNTEDBATCH
+ *
+ * used when tracing ref-counted handles in batches. Each GC thread fills its own batch
+ * with the unpromoted objects of the handles it scans and asks the runtime about all
+ * of them with a single call.
+ */
+struct REFCOUNTEDBATCH
+{
+    Ref_promote_func* pfnPromote;   // promotion function to use
+    size_t            count;        // number of objects in the batch
+    Object*           objects[REFCOUNTED_BATCH_SIZE];
+    bool              promote[REFCOUNTED_BATCH_SIZE];
+};
+
+// Older runtimes only know how to answer for one ref-counted handle at a time.
+static bool CanBatchRefCountedHandleCallbacks()
+{
+#ifdef BUILD_AS_STANDALONE
+    return g_runtimeSupportedVersion.MajorVersion >= 3;
+#else
+    return true;
+#endif // BUILD_AS_STANDALONE
+}
+
+static void FlushRefCountedBatch(REFCOUNTEDBATCH* pBatch, ScanContext* sc)
+{
+    WRAPPER_NO_CONTRACT;
+
+    if (pBatch->count == 0)
+        return;
+
+    GCToEEInterface::RefCountedHandleCallbacksBatch(pBatch->objects, pBatch->promote, pBatch->count);
+
+    for (size_t i = 0; i < pBatch->count; i++)
+    {
+        if (pBatch->promote[i])
+        {
+            Object *pObj = pBatch->objects[i];
+            pBatch->pfnPromote(&pObj, sc, 0);
+
+            // Assert this object wasn't relocated since we are passing a temporary object's address.
+            _ASSERTE(pObj == pBatch->objects[i]);
+        }
+    }
+
+    pBatch->count = 0;
+}
+
+/*
+ * Scan callback for tracing ref-counted handles in batches.
+ *
+ * This callback is called to collect individual objects referred to by handles
+ * in the refcounted table, lp2 is a pointer to the REFCOUNTEDBATCH of the GC thread.
+ */
+void CALLBACK PromoteRefCountedBatched(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pExtraInfo, uintptr_t lp1, uintptr_t lp2)
+{
+    WRAPPER_NO_CONTRACT;
+    UNREFERENCED_PARAMETER(pExtraInfo);
+
+    // there are too many races when asynchronously scanning ref-counted handles so we no longer support it
+    _ASSERTE(!((ScanContext*)lp1)->concurrent);
+
+    LOG((LF_GC, LL_INFO1000, LOG_HANDLE_OBJECT_CLASS("", pObjRef, "may cause promotion of ", *pObjRef)));
+
+    Object *pObj = VolatileLoad((PTR_Object*)pObjRef);
+
+    if (!HndIsNullOrDestroyedHandle(pObj) && !g_theGCHeap->IsPromoted(pObj))
+    {
+        REFCOUNTEDBATCH *pBatch = (REFCOUNTEDBATCH *)lp2;
+        pBatch->objects[pBatch->count++] = pObj;
+
+        if (pBatch->count == REFCOUNTED_BATCH_SIZE)
+            FlushRefCountedBatch(pBatch, (ScanContext *)lp1);
+    }
+}
 #endif // FEATURE_REFCOUNTED_HANDLES
 
 
@@ -225,6 +304,35 @@ void CALLBACK UpdateDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pE
 #endif
 }
 
+// Append a dependent handle with an unpromoted primary to the pending list of the DH context. If the list can't
+// be grown the recording is abandoned and rescans fall back to walking the whole handle table.
+static void RecordPendingDependentHandle(DhContext *pDhContext, Object **pPrimaryRef, Object **pSecondaryRef)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (pDhContext->m_cPending == pDhContext->m_cPendingCapacity)
+    {
+        size_t cNewCapacity = (pDhContext->m_cPendingCapacity != 0) ? pDhContext->m_cPendingCapacity * 2 : 256;
+        DhContext::DhPending *pNewPending = new (nothrow) DhContext::DhPending[cNewCapacity];
+        if (pNewPending == NULL)
+        {
+            pDhContext->m_fPendingRecording = false;
+            return;
+        }
+
+        if (pDhContext->m_cPending != 0)
+            memcpy(pNewPending, pDhContext->m_pPending, pDhContext->m_cPending * sizeof(DhContext::DhPending));
+
+        delete [] pDhContext->m_pPending;
+        pDhContext->m_pPending = pNewPending;
+        pDhContext->m_cPendingCapacity = cNewCapacity;
+    }
+
+    DhContext::DhPending *pEntry = &pDhContext->m_pPending[pDhContext->m_cPending++];
+    pEntry->m_pPrimary = pPrimaryRef;
+    pEntry->m_pSecondary = pSecondaryRef;
+}
+
 void CALLBACK PromoteDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pExtraInfo, uintptr_t lp1, uintptr_t lp2)
 {
     LIMITED_METHOD_CONTRACT;
@@ -260,6 +368,10 @@ void CALLBACK PromoteDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *p
         // promoted handles, so there's no chance of finding an additional handle being promoted on a
         // subsequent scan).
         pDhContext->m_fUnpromotedPrimaries = true;
+
+        // Remember the handle so rescans can revisit it without walking the entire table again.
+        if (pDhContext->m_fPendingRecording)
+            RecordPendingDependentHandle(pDhContext, pPrimaryRef, pSecondaryRef);
     }
 }
 
@@ -692,6 +804,15 @@ bool Ref_Initialize()
     if (g_pDependentHandleContexts == NULL)
         goto CleanupAndFail;
 
+    for (int uCPUindex = 0; uCPUindex < n_slots; uCPUindex++)
+    {
+        g_pDependentHandleContexts[uCPUindex].m_pPending = NULL;
+        g_pDependentHandleContexts[uCPUindex].m_cPending = 0;
+        g_pDependentHandleContexts[uCPUindex].m_cPendingCapacity = 0;
+        g_pDependentHandleContexts[uCPUindex].m_fPendingRecording = false;
+        g_pDependentHandleContexts[uCPUindex].m_fPendingValid = false;
+    }
+
     return true;
 
 CleanupAndFail:
@@ -710,6 +831,10 @@ void Ref_Shutdown()
 
     if (g_pDependentHandleContexts)
     {
+        int n_slots = getNumberOfSlots();
+        for (int uCPUindex = 0; uCPUindex < n_slots; uCPUindex++)
+            delete [] g_pDependentHandleContexts[uCPUindex].m_pPending;
+
         delete [] g_pDependentHandleContexts;
         g_pDependentHandleContexts = NULL;
     }
@@ -1141,6 +1266,13 @@ void Ref_TraceNormalRoots(uint32_t condemned, uint32_t maxgen, ScanContext* sc,
         // promote ref-counted handles
         uint32_t type = HNDTYPE_REFCOUNTED;
 
+        // The handles are already split across the GC threads, each thread batches the
+        // objects it finds so the runtime can look at many of them per call.
+        bool fBatch = CanBatchRefCountedHandleCallbacks();
+        REFCOUNTEDBATCH batch;
+        batch.pfnPromote = fn;
+        batch.count = 0;
+
         walk = &g_HandleTableMap;
         while (walk) {
             for (uint32_t i = 0; i < INITIAL_HANDLE_TABLE_ARRAY_SIZE; i ++)
@@ -1155,11 +1287,18 @@ void Ref_TraceNormalRoots(uint32_t condemned, uint32_t maxgen, ScanContext* sc,
                     {
                         HHANDLETABLE hTable = pTable[uCPUindex];
                         if (hTable)
-                            HndScanHandlesForGC(hTable, PromoteRefCounted, uintptr_t(sc), uintptr_t(fn), &type, 1, condemned, maxgen, flags );
+                        {
+                            if (fBatch)
+                                HndScanHandlesForGC(hTable, PromoteRefCountedBatched, uintptr_t(sc), uintptr_t(&batch), &type, 1, condemned, maxgen, flags );
+                            else
+                                HndScanHandlesForGC(hTable, PromoteRefCounted, uintptr_t(sc), uintptr_t(fn), &type, 1, condemned, maxgen, flags );
+                        }
                     }
                 }
             walk = walk->pNext;
         }
+
+        FlushRefCountedBatch(&batch, sc);
     }
 #endif // FEATURE_REFCOUNTED_HANDLES
 }
@@ -1272,6 +1411,45 @@ DhContext *Ref_GetDependentHandleContext(ScanContext* sc)
     return &g_pDependentHandleContexts[getSlotNumber(sc)];
 }
 
+// Revisit only the dependent handles recorded as pending by an earlier scan, promoting the secondaries of those
+// whose primary has since been promoted. Handles that are resolved or cleared are dropped from the list so each
+// rescan gets cheaper, instead of costing a walk of every dependent handle in the process.
+static void ScanPendingDependentHandles(DhContext *pDhContext)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    ScanContext *sc = pDhContext->m_pScanContext;
+    promote_func *callback = pDhContext->m_pfnPromoteFunction;
+    DhContext::DhPending *pPending = pDhContext->m_pPending;
+    size_t cRemaining = 0;
+
+    for (size_t i = 0; i < pDhContext->m_cPending; i++)
+    {
+        Object **pPrimaryRef = pPending[i].m_pPrimary;
+        Object **pSecondaryRef = pPending[i].m_pSecondary;
+
+        if (*pPrimaryRef == NULL)
+            continue;
+
+        if (g_theGCHeap->IsPromoted(*pPrimaryRef))
+        {
+            if (!g_theGCHeap->IsPromoted(*pSecondaryRef))
+            {
+                LOG((LF_GC, LL_INFO10000, "\tPromoting secondary " LOG_OBJECT_CLASS(*pSecondaryRef)));
+                callback(pSecondaryRef, sc, 0);
+                pDhContext->m_fPromoted = true;
+            }
+        }
+        else
+        {
+            pDhContext->m_fUnpromotedPrimaries = true;
+            pPending[cRemaining++] = pPending[i];
+        }
+    }
+
+    pDhContext->m_cPending = cRemaining;
+}
+
 // Scan the dependent handle table promoting any secondary object whose associated primary object is promoted.
 //
 // Multiple scans may be required since (a) secondary promotions made during one scan could cause the primary
@@ -1306,6 +1484,17 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
         pDhContext->m_fUnpromotedPrimaries = false;
         pDhContext->m_fPromoted = false;
 
+        // Once a full scan has recorded every handle with an unpromoted primary only those need looking at.
+        if (pDhContext->m_fPendingValid)
+        {
+            ScanPendingDependentHandles(pDhContext);
+
+            if (pDhContext->m_fPromoted)
+                fAnyPromotions = true;
+
+            continue;
+        }
+
         HandleTableMap *walk = &g_HandleTableMap;
         while (walk)
         {
@@ -1338,6 +1527,13 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
             walk = walk->pNext;
         }
 
+        // The pending list is complete only if it could be grown for every handle the scan recorded.
+        if (pDhContext->m_fPendingRecording)
+        {
+            pDhContext->m_fPendingRecording = false;
+            pDhContext->m_fPendingValid = true;
+        }
+
         if (pDhContext->m_fPromoted)
             fAnyPromotions = true;
 
@@ -12,6 +12,7 @@
 //  * How to create a type layout information in format that the GC expects
 //  * How to implement fast object allocator and write barrier
 //  * How to allocate objects and work with GC handles
+//  * How to benchmark the GC with scripted allocation scenarios (see the Scenarios section below)
 //
 //  An important part of the sample is the GC environment (gcenv.*) that provides methods for GC to interact
 //  with the OS and execution engine.
@@ -83,6 +84,45 @@ Object * AllocateObject(MethodTable * pMT)
     return pObject;
 }
 
+class SampleArray : public Object
+{
+public:
+    uint32_t m_dwLength;
+#ifdef HOST_64BIT
+    uint32_t m_dwPadding;
+#endif
+    Object * m_Data[1];
+};
+
+Object * AllocateArray(MethodTable * pMT, uint32_t length)
+{
+    alloc_context * acontext = GetThread()->GetAllocContext();
+    Object * pObject;
+
+    size_t size = ALIGN_UP(pMT->GetBaseSize() + (size_t)length * pMT->RawGetComponentSize(), sizeof(void *));
+
+    uint8_t* result = acontext->alloc_ptr;
+    uint8_t* advance = result + size;
+    if (size < g_theGCHeap->GetLOHThreshold() && advance <= acontext->alloc_limit)
+    {
+        acontext->alloc_ptr = advance;
+        pObject = (Object *)result;
+    }
+    else
+    {
+        // Objects above the threshold have to be explicitly allocated on the LOH
+        uint32_t flags = (size >= g_theGCHeap->GetLOHThreshold()) ? GC_ALLOC_LARGE_OBJECT_HEAP : 0;
+        pObject = g_theGCHeap->Alloc(acontext, size, flags);
+        if (pObject == NULL)
+            return NULL;
+    }
+
+    pObject->RawSetMethodTable(pMT);
+    ((SampleArray *)pObject)->m_dwLength = length;
+
+    return pObject;
+}
+
 #if defined(HOST_64BIT)
 // Card byte shift is different on 64bit.
 #define card_byte_shift     11
@@ -114,63 +154,49 @@ void WriteBarrier(Object ** dst, Object * ref)
 
 extern "C" HRESULT LOCALGC_CALLCONV GC_Initialize(IGCToCLR* clrToGC, IGCHeap** gcHeap, IGCHandleManager** gcHandleManager, GcDacVars* gcDacVars);
 
-int __cdecl main(int argc, char* argv[])
+//
+// Types used by the sample
+//
+
+class My : Object {
+public:
+    Object * m_pOther1;
+    int dummy_inbetween;
+    Object * m_pOther2;
+};
+
+static struct My_MethodTable
 {
-    //
-    // Initialize system info
-    //
-    if (!GCToOSInterface::Initialize())
-    {
-        return -1;
-    }
+    // GCDesc
+    CGCDescSeries m_series[2];
+    size_t m_numSeries;
 
-    //
-    // Initialize GC heap
-    //
-    GcDacVars dacVars;
-    IGCHeap *pGCHeap;
-    IGCHandleManager *pGCHandleManager;
-    if (GC_Initialize(nullptr, &pGCHeap, &pGCHandleManager, &dacVars) != S_OK)
-    {
-        return -1;
-    }
+    // The actual methodtable
+    MethodTable m_MT;
+}
+My_MethodTable;
 
-    if (FAILED(pGCHeap->Initialize()))
-        return -1;
+// Array of object references, the equivalent of object[]
+static struct RefArray_MethodTable
+{
+    // GCDesc
+    CGCDescSeries m_series[1];
+    size_t m_numSeries;
 
-    //
-    // Initialize handle manager
-    //
-    if (!pGCHandleManager->Initialize())
-        return -1;
+    // The actual methodtable
+    MethodTable m_MT;
+}
+RefArray_MethodTable;
 
-    //
-    // Initialize current thread
-    //
-    ThreadStore::AttachCurrentThread();
+// Array of bytes, the equivalent of byte[]
+static MethodTable ByteArray_MethodTable;
 
+static void InitializeMethodTables()
+{
     //
     // Create a Methodtable with GCDesc
     //
 
-    class My : Object {
-    public:
-        Object * m_pOther1;
-        int dummy_inbetween;
-        Object * m_pOther2;
-    };
-
-    static struct My_MethodTable
-    {
-        // GCDesc
-        CGCDescSeries m_series[2];
-        size_t m_numSeries;
-
-        // The actual methodtable
-        MethodTable m_MT;
-    }
-    My_MethodTable;
-
     // 'My' contains the MethodTable*
     uint32_t baseSize = sizeof(My);
     // GC expects the size of ObjHeader (extra void*) to be included in the size.
@@ -192,26 +218,57 @@ int __cdecl main(int argc, char* argv[])
     My_MethodTable.m_series[1].SetSeriesCount(1);
     My_MethodTable.m_series[1].seriessize -= My_MethodTable.m_MT.m_baseSize;
 
+    // Arrays have the length (and padding on 64-bit) after the MethodTable*
+    RefArray_MethodTable.m_MT.m_baseSize = offsetof(SampleArray, m_Data) + sizeof(ObjHeader);
+    RefArray_MethodTable.m_MT.m_componentSize = sizeof(Object *);
+    RefArray_MethodTable.m_MT.m_flags = MTFlag_ContainsPointers | MTFlag_HasComponentSize | MTFlag_IsArray;
+
+    // The single series covers all the elements, its size is relative to the size of the whole array.
+    RefArray_MethodTable.m_numSeries = 1;
+    RefArray_MethodTable.m_series[0].SetSeriesOffset(offsetof(SampleArray, m_Data));
+    RefArray_MethodTable.m_series[0].SetSeriesCount(0);
+    RefArray_MethodTable.m_series[0].seriessize -= RefArray_MethodTable.m_MT.m_baseSize;
+
+    ByteArray_MethodTable.m_baseSize = offsetof(SampleArray, m_Data) + sizeof(ObjHeader);
+    ByteArray_MethodTable.m_componentSize = 1;
+    ByteArray_MethodTable.m_flags = MTFlag_HasComponentSize | MTFlag_IsArray;
+}
+
+static OBJECTHANDLE CreateHandle(Object * pObject, uint32_t type)
+{
+    return HndCreateHandle(g_HandleTableMap.pBuckets[0]->pTable[GetCurrentThreadHomeHeapNumber()], type, pObject);
+}
+
+static void DestroyHandle(OBJECTHANDLE oh, uint32_t type)
+{
+    HndDestroyHandle(HndGetHandleTable(oh), type, oh);
+}
+
+//
+// The original sample: allocate a chain of objects, then check that a full GC clears a weak handle
+//
+static bool RunBasic(size_t iterations)
+{
     MethodTable * pMyMethodTable = &My_MethodTable.m_MT;
 
     // Allocate instance of MyObject
     Object * pObj = AllocateObject(pMyMethodTable);
     if (pObj == NULL)
-        return -1;
+        return false;
 
     // Create strong handle and store the object into it
-    OBJECTHANDLE oh = HndCreateHandle(g_HandleTableMap.pBuckets[0]->pTable[GetCurrentThreadHomeHeapNumber()], HNDTYPE_DEFAULT, pObj);
+    OBJECTHANDLE oh = CreateHandle(pObj, HNDTYPE_DEFAULT);
     if (oh == NULL)
-        return -1;
+        return false;
 
-    for (int i = 0; i < 1000000; i++)
+    for (size_t i = 0; i < iterations; i++)
     {
         Object * pBefore = ((My *)HndFetchHandle(oh))->m_pOther1;
 
         // Allocate more instances of the same object
         Object * p = AllocateObject(pMyMethodTable);
         if (p == NULL)
-            return -1;
+            return false;
 
         Object * pAfter = ((My *)HndFetchHandle(oh))->m_pOther1;
 
@@ -223,19 +280,376 @@ int __cdecl main(int argc, char* argv[])
     }
 
     // Create weak handle that points to our object
-    OBJECTHANDLE ohWeak = HndCreateHandle(g_HandleTableMap.pBuckets[0]->pTable[GetCurrentThreadHomeHeapNumber()], HNDTYPE_WEAK_DEFAULT, HndFetchHandle(oh));
+    OBJECTHANDLE ohWeak = CreateHandle(HndFetchHandle(oh), HNDTYPE_WEAK_DEFAULT);
     if (ohWeak == NULL)
-        return -1;
+        return false;
 
     // Destroy the strong handle so that nothing will be keeping out object alive
-    HndDestroyHandle(HndGetHandleTable(oh), HNDTYPE_DEFAULT, oh);
+    DestroyHandle(oh, HNDTYPE_DEFAULT);
 
     // Explicitly trigger full GC
-    pGCHeap->GarbageCollect();
+    g_theGCHeap->GarbageCollect();
 
     // Verify that the weak handle got cleared by the GC
     assert(HndFetchHandle(ohWeak) == NULL);
 
+    DestroyHandle(ohWeak, HNDTYPE_WEAK_DEFAULT);
+
+    return true;
+}
+
+//
+// Scenarios
+//
+// Each scenario drives a specific part of the GC. They are deterministic for a given iteration count, so
+// runs with different GC builds or configurations can be compared directly. The GC configuration is read
+// from the environment like in the runtime, e.g. DOTNET_gcServer=1, DOTNET_GCHeapCount, DOTNET_GCgen0size
+// or DOTNET_GCRegionSize.
+//
+
+static uint32_t g_randomState = 0x2545F491;
+
+static uint32_t NextRandom()
+{
+    // xorshift32
+    g_randomState ^= g_randomState << 13;
+    g_randomState ^= g_randomState >> 17;
+    g_randomState ^= g_randomState << 5;
+    return g_randomState;
+}
+
+// LOH churn: keep a working set of large byte arrays and keep replacing them with arrays of a different size,
+// which exercises LOH allocation, free list fitting and the gen2 GCs triggered by the LOH budget.
+static bool RunLohChurn(size_t iterations)
+{
+    const uint32_t slotCount = 64;
+    const uint32_t minSize = 85000;
+    const uint32_t maxSize = 1024 * 1024;
+
+    Object * pSlots = AllocateArray(&RefArray_MethodTable.m_MT, slotCount);
+    if (pSlots == NULL)
+        return false;
+
+    OBJECTHANDLE oh = CreateHandle(pSlots, HNDTYPE_DEFAULT);
+    if (oh == NULL)
+        return false;
+
+    for (size_t i = 0; i < iterations; i++)
+    {
+        Object * p = AllocateArray(&ByteArray_MethodTable, minSize + NextRandom() % (maxSize - minSize));
+        if (p == NULL)
+            return false;
+
+        SampleArray * pArray = (SampleArray *)HndFetchHandle(oh);
+        WriteBarrier(&pArray->m_Data[NextRandom() % slotCount], p);
+    }
+
+    DestroyHandle(oh, HNDTYPE_DEFAULT);
+    return true;
+}
+
+// Deep linked graphs: keep rebuilding long linked lists with back references to random earlier nodes,
+// which makes marking deep and exercises mark stack overflow handling.
+static bool RunDeepGraphs(size_t iterations)
+{
+    const uint32_t graphCount = 16;
+    const uint32_t depth = 100000;
+
+    Object * pGraphs = AllocateArray(&RefArray_MethodTable.m_MT, graphCount);
+    if (pGraphs == NULL)
+        return false;
+
+    OBJECTHANDLE oh = CreateHandle(pGraphs, HNDTYPE_DEFAULT);
+    if (oh == NULL)
+        return false;
+
+    for (size_t i = 0; i < iterations; i++)
+    {
+        Object * pHead = AllocateObject(&My_MethodTable.m_MT);
+        if (pHead == NULL)
+            return false;
+
+        // The list under construction is rooted in its slot, so it survives the GCs triggered while building it
+        uint32_t slot = (uint32_t)(i % graphCount);
+        WriteBarrier(&((SampleArray *)HndFetchHandle(oh))->m_Data[slot], pHead);
+
+        for (uint32_t j = 1; j < depth; j++)
+        {
+            Object * p = AllocateObject(&My_MethodTable.m_MT);
+            if (p == NULL)
+                return false;
+
+            My * pCurrentHead = (My *)((SampleArray *)HndFetchHandle(oh))->m_Data[slot];
+            WriteBarrier(&((My *)p)->m_pOther1, (Object *)pCurrentHead);
+
+            // Point back to a node further down the list
+            Object * pBack = (Object *)pCurrentHead;
+            for (uint32_t k = NextRandom() % 8; k > 0 && pBack != NULL; k--)
+                pBack = ((My *)pBack)->m_pOther1;
+            WriteBarrier(&((My *)p)->m_pOther2, pBack);
+
+            WriteBarrier(&((SampleArray *)HndFetchHandle(oh))->m_Data[slot], p);
+        }
+    }
+
+    DestroyHandle(oh, HNDTYPE_DEFAULT);
+    return true;
+}
+
+// Cache-like gen2 mutation: a large cache is promoted to gen2 and then keeps getting entries replaced and
+// existing entries updated to point to young objects. Every ephemeral GC has to find these references through
+// the card table.
+static bool RunGen2Cache(size_t iterations)
+{
+    const uint32_t cacheSize = 256 * 1024;
+
+    Object * pCache = AllocateArray(&RefArray_MethodTable.m_MT, cacheSize);
+    if (pCache == NULL)
+        return false;
+
+    OBJECTHANDLE oh = CreateHandle(pCache, HNDTYPE_DEFAULT);
+    if (oh == NULL)
+        return false;
+
+    for (uint32_t i = 0; i < cacheSize; i++)
+    {
+        Object * p = AllocateObject(&My_MethodTable.m_MT);
+        if (p == NULL)
+            return false;
+
+        WriteBarrier(&((SampleArray *)HndFetchHandle(oh))->m_Data[i], p);
+    }
+
+    // Age the cache into gen2 before measuring
+    g_theGCHeap->GarbageCollect(max_generation);
+
+    for (size_t i = 0; i < iterations; i++)
+    {
+        Object * p = AllocateObject(&My_MethodTable.m_MT);
+        if (p == NULL)
+            return false;
+
+        SampleArray * pArray = (SampleArray *)HndFetchHandle(oh);
+        uint32_t index = NextRandom() % cacheSize;
+        if ((i % 4) == 0)
+        {
+            // Replace the entry
+            WriteBarrier(&pArray->m_Data[index], p);
+        }
+        else
+        {
+            // Update the (likely old) entry to point to the young object
+            My * pEntry = (My *)pArray->m_Data[index];
+            WriteBarrier(&pEntry->m_pOther1, p);
+        }
+    }
+
+    DestroyHandle(oh, HNDTYPE_DEFAULT);
+    return true;
+}
+
+// Pinning storms: keep many short lived objects pinned while allocating, which fragments gen0 and exercises
+// pinned plugs, demotion and the free list reuse of the space between them.
+static bool RunPinningStorm(size_t iterations)
+{
+    const uint32_t pinCount = 1024;
+    const uint32_t allocationsPerPin = 64;
+
+    OBJECTHANDLE pins[pinCount] = {};
+
+    for (size_t i = 0; i < iterations; i++)
+    {
+        uint32_t slot = (uint32_t)(i % pinCount);
+        if (pins[slot] != NULL)
+            DestroyHandle(pins[slot], HNDTYPE_PINNED);
+
+        Object * p = AllocateArray(&ByteArray_MethodTable, 16 + NextRandom() % 1024);
+        if (p == NULL)
+            return false;
+
+        pins[slot] = CreateHandle(p, HNDTYPE_PINNED);
+        if (pins[slot] == NULL)
+            return false;
+
+        for (uint32_t j = 0; j < allocationsPerPin; j++)
+        {
+            if (AllocateObject(&My_MethodTable.m_MT) == NULL)
+                return false;
+        }
+    }
+
+    for (uint32_t i = 0; i < pinCount; i++)
+    {
+        if (pins[i] != NULL)
+            DestroyHandle(pins[i], HNDTYPE_PINNED);
+    }
+
+    return true;
+}
+
+struct Scenario
+{
+    const char * name;
+    bool (*run)(size_t iterations);
+    size_t defaultIterations;
+};
+
+static const Scenario g_scenarios[] =
+{
+    { "basic",   RunBasic,        1000000 },
+    { "loh",     RunLohChurn,     20000 },
+    { "graph",   RunDeepGraphs,   200 },
+    { "gen2",    RunGen2Cache,    20000000 },
+    { "pinning", RunPinningStorm, 1000000 },
+};
+
+//
+// Reporting
+//
+
+const size_t MaxRecordedPauses = 64 * 1024;
+
+static int64_t g_pauses[MaxRecordedPauses];
+static size_t g_pauseCount;
+static int64_t g_totalPauseTicks;
+static int64_t g_maxPauseTicks;
+
+static void RecordPause(int64_t pauseTicks)
+{
+    // The count, the total and the max include the pauses that did not fit
+    if (g_pauseCount < MaxRecordedPauses)
+        g_pauses[g_pauseCount] = pauseTicks;
+
+    g_pauseCount++;
+    g_totalPauseTicks += pauseTicks;
+    g_maxPauseTicks = max(g_maxPauseTicks, pauseTicks);
+}
+
+static int __cdecl ComparePauses(const void * a, const void * b)
+{
+    int64_t left = *(const int64_t *)a;
+    int64_t right = *(const int64_t *)b;
+    return (left < right) ? -1 : ((left > right) ? 1 : 0);
+}
+
+static double TicksToMilliseconds(int64_t ticks)
+{
+    return (double)ticks * 1000.0 / (double)GCToOSInterface::QueryPerformanceFrequency();
+}
+
+static void PrintReport(const char * scenario, int64_t elapsedTicks)
+{
+    printf("Scenario:         %s (%s GC)\n", scenario, IsServerHeap() ? "Server" : "Workstation");
+    printf("Elapsed:          %.3f ms\n", TicksToMilliseconds(elapsedTicks));
+    printf("GCs:              gen0 %d, gen1 %d, gen2 %d\n",
+        g_theGCHeap->CollectionCount(0), g_theGCHeap->CollectionCount(1), g_theGCHeap->CollectionCount(2));
+
+    printf("Pauses:           %zu, total %.3f ms, max %.3f ms\n",
+        g_pauseCount, TicksToMilliseconds(g_totalPauseTicks), TicksToMilliseconds(g_maxPauseTicks));
+
+    size_t recorded = min(g_pauseCount, MaxRecordedPauses);
+    if (recorded > 0)
+    {
+        qsort(g_pauses, recorded, sizeof(g_pauses[0]), ComparePauses);
+
+        static const int percentiles[] = { 500, 900, 990, 999 };
+        for (size_t i = 0; i < sizeof(percentiles) / sizeof(percentiles[0]); i++)
+        {
+            size_t index = min(recorded - 1, recorded * percentiles[i] / 1000);
+            printf("  p%-5.1f          %.3f ms\n", percentiles[i] / 10.0, TicksToMilliseconds(g_pauses[index]));
+        }
+    }
+
+    uint64_t highMemLoadThresholdBytes, totalAvailableMemoryBytes, lastRecordedMemLoadBytes, lastRecordedHeapSizeBytes;
+    uint64_t lastRecordedFragmentationBytes, totalCommittedBytes, promotedBytes, pinnedObjectCount;
+    uint64_t finalizationPendingCount, index;
+    uint32_t generation, pauseTimePct;
+    bool isCompaction, isConcurrent;
+    uint64_t genInfoRaw[total_generation_count * 4];
+    uint64_t pauseInfoRaw[2];
+
+    g_theGCHeap->GetMemoryInfo(&highMemLoadThresholdBytes, &totalAvailableMemoryBytes, &lastRecordedMemLoadBytes,
+        &lastRecordedHeapSizeBytes, &lastRecordedFragmentationBytes, &totalCommittedBytes, &promotedBytes,
+        &pinnedObjectCount, &finalizationPendingCount, &index, &generation, &pauseTimePct, &isCompaction,
+        &isConcurrent, genInfoRaw, pauseInfoRaw, gc_kind_any);
+
+    printf("Pause time:       %u%%\n", pauseTimePct);
+    printf("Heap size:        %llu KB\n", (unsigned long long)(lastRecordedHeapSizeBytes / 1024));
+    printf("Fragmentation:    %llu KB\n", (unsigned long long)(lastRecordedFragmentationBytes / 1024));
+    printf("Committed:        %llu KB\n", (unsigned long long)(totalCommittedBytes / 1024));
+    printf("Promoted (last):  %llu KB\n", (unsigned long long)(promotedBytes / 1024));
+    printf("Allocated:        %llu KB\n", (unsigned long long)(g_theGCHeap->GetTotalAllocatedBytes() / 1024));
+}
+
+int __cdecl main(int argc, char* argv[])
+{
+    const Scenario * pScenario = &g_scenarios[0];
+    if (argc > 1)
+    {
+        pScenario = NULL;
+        for (size_t i = 0; i < sizeof(g_scenarios) / sizeof(g_scenarios[0]); i++)
+        {
+            if (strcmp(argv[1], g_scenarios[i].name) == 0)
+                pScenario = &g_scenarios[i];
+        }
+
+        if (pScenario == NULL)
+        {
+            printf("Usage: gcsample [basic|loh|graph|gen2|pinning] [iterations]\n");
+            return -1;
+        }
+    }
+
+    size_t iterations = (argc > 2) ? (size_t)strtoull(argv[2], NULL, 10) : pScenario->defaultIterations;
+
+    //
+    // Initialize system info
+    //
+    if (!GCToOSInterface::Initialize())
+    {
+        return -1;
+    }
+
+    //
+    // Initialize GC heap
+    //
+    GcDacVars dacVars;
+    IGCHeap *pGCHeap;
+    IGCHandleManager *pGCHandleManager;
+    if (GC_Initialize(nullptr, &pGCHeap, &pGCHandleManager, &dacVars) != S_OK)
+    {
+        return -1;
+    }
+
+    if (FAILED(pGCHeap->Initialize()))
+        return -1;
+
+    //
+    // Initialize handle manager
+    //
+    if (!pGCHandleManager->Initialize())
+        return -1;
+
+    //
+    // Initialize current thread
+    //
+    ThreadStore::AttachCurrentThread();
+
+    InitializeMethodTables();
+
+    SetGCPauseCallback(RecordPause);
+
+    int64_t start = GCToOSInterface::QueryPerformanceCounter();
+
+    if (!pScenario->run(iterations))
+        return -1;
+
+    int64_t elapsed = GCToOSInterface::QueryPerformanceCounter() - start;
+
+    SetGCPauseCallback(NULL);
+
+    PrintReport(pScenario->name, elapsed);
+
     printf("Done\n");
 
     return 0;
@@ -124,8 +124,18 @@ void ThreadStore::AttachCurrentThread()
     g_pThreadList = pThread;
 }
 
+static GCPauseCallback g_pfnPauseCallback;
+static int64_t g_suspendTimestamp;
+
+void SetGCPauseCallback(GCPauseCallback callback)
+{
+    g_pfnPauseCallback = callback;
+}
+
 void GCToEEInterface::SuspendEE(SUSPEND_REASON reason)
 {
+    g_suspendTimestamp = GCToOSInterface::QueryPerformanceCounter();
+
     g_theGCHeap->SetGCInProgress(true);
 
     // TODO: Implement
@@ -136,6 +146,11 @@ void GCToEEInterface::RestartEE(bool bFinishedGC)
     // TODO: Implement
 
     g_theGCHeap->SetGCInProgress(false);
+
+    if (g_pfnPauseCallback != NULL)
+    {
+        g_pfnPauseCallback(GCToOSInterface::QueryPerformanceCounter() - g_suspendTimestamp);
+    }
 }
 
 void GCToEEInterface::GcScanRoots(promote_func* fn,  int condemned, int max_gen, ScanContext* sc)
@@ -167,7 +182,7 @@ bool GCToEEInterface::RefCountedHandleCallbacks(Object * pObject)
 bool GCToEEInterface::IsPreemptiveGCDisabled()
 {
     Thread* pThread = ::GetThread();
-    return pThread->PreemptiveGCDisabled();
+    return pThread && pThread->PreemptiveGCDisabled();
 }
 
 bool GCToEEInterface::EnablePreemptiveGC()
@@ -184,8 +199,12 @@ bool GCToEEInterface::EnablePreemptiveGC()
 
 void GCToEEInterface::DisablePreemptiveGC()
 {
+    // Server GC threads are not attached to the thread store
     Thread* pThread = ::GetThread();
-    pThread->DisablePreemptiveGC();
+    if (pThread)
+    {
+        pThread->DisablePreemptiveGC();
+    }
 }
 
 Thread* GCToEEInterface::GetThread()
@@ -274,33 +293,92 @@ bool GCToEEInterface::EagerFinalized(Object* obj)
     return false;
 }
 
-bool GCToEEInterface::GetBooleanConfigValue(const char* privateKey, const char* publicKey, bool* value)
+//
+// The configuration is read from DOTNET_<privateKey> (or COMPlus_<privateKey>) environment variables,
+// so the sample can be run with the same settings as the runtime, e.g. DOTNET_gcServer=1.
+//
+static bool GetConfigEnvironmentVariable(const char* privateKey, char* buffer, DWORD size)
 {
+    static const char* const prefixes[] = { "DOTNET_", "COMPlus_" };
+
+    if (privateKey == NULL)
+        return false;
+
+    for (size_t i = 0; i < sizeof(prefixes) / sizeof(prefixes[0]); i++)
+    {
+        char name[256];
+        if (_snprintf_s(name, sizeof(name), _TRUNCATE, "%s%s", prefixes[i], privateKey) < 0)
+            return false;
+
+        DWORD length = GetEnvironmentVariableA(name, buffer, size);
+        if (length > 0 && length < size)
+            return true;
+    }
+
     return false;
 }
 
+// Numeric values are hex, like CLRConfig
+static bool GetConfigNumber(const char* privateKey, uint64_t* value)
+{
+    char buffer[64];
+    if (!GetConfigEnvironmentVariable(privateKey, buffer, sizeof(buffer)))
+        return false;
+
+    char* end;
+    uint64_t result = _strtoui64(buffer, &end, 16);
+    if (end == buffer || *end != '\0')
+        return false;
+
+    *value = result;
+    return true;
+}
+
+bool GCToEEInterface::GetBooleanConfigValue(const char* privateKey, const char* publicKey, bool* value)
+{
+    uint64_t result;
+    if (!GetConfigNumber(privateKey, &result))
+        return false;
+
+    *value = (result != 0);
+    return true;
+}
+
 bool GCToEEInterface::GetIntConfigValue(const char* privateKey, const char* publicKey, int64_t* value)
 {
-    return false;
+    uint64_t result;
+    if (!GetConfigNumber(privateKey, &result))
+        return false;
+
+    *value = (int64_t)result;
+    return true;
 }
 
 bool GCToEEInterface::GetStringConfigValue(const char* privateKey, const char* publicKey, const char** value)
 {
-    return false;
+    char buffer[1024];
+    if (!GetConfigEnvironmentVariable(privateKey, buffer, sizeof(buffer)))
+        return false;
+
+    *value = _strdup(buffer);
+    return *value != NULL;
 }
 
 void GCToEEInterface::FreeStringConfigValue(const char *value)
 {
+    free((void*)value);
 }
 
+thread_local bool t_isGCThread;
+
 bool GCToEEInterface::IsGCThread()
 {
-    return false;
+    return t_isGCThread;
 }
 
 bool GCToEEInterface::WasCurrentThreadCreatedByGC()
 {
-    return false;
+    return t_isGCThread;
 }
 
 static MethodTable freeObjectMT;
@@ -315,9 +393,45 @@ MethodTable* GCToEEInterface::GetFreeObjectMethodTable()
     return &freeObjectMT;
 }
 
+struct GCThreadStartInfo
+{
+    void (*threadStart)(void*);
+    void* arg;
+};
+
+static DWORD WINAPI GCThreadStub(void* param)
+{
+    GCThreadStartInfo startInfo = *(GCThreadStartInfo*)param;
+    delete (GCThreadStartInfo*)param;
+
+    t_isGCThread = true;
+    startInfo.threadStart(startInfo.arg);
+    return 0;
+}
+
 bool GCToEEInterface::CreateThread(void (*threadStart)(void*), void* arg, bool is_suspendable, const char* name)
 {
-    return false;
+    // The sample does not suspend other threads, so it can only run threads that never touch the
+    // heap outside of a GC. This allows Server GC, background GC stays disabled.
+    if (is_suspendable)
+        return false;
+
+    GCThreadStartInfo* startInfo = new (nothrow) GCThreadStartInfo();
+    if (startInfo == NULL)
+        return false;
+
+    startInfo->threadStart = threadStart;
+    startInfo->arg = arg;
+
+    HANDLE hThread = ::CreateThread(NULL, 0, GCThreadStub, startInfo, 0, NULL);
+    if (hThread == NULL)
+    {
+        delete startInfo;
+        return false;
+    }
+
+    CloseHandle(hThread);
+    return true;
 }
 
 void GCToEEInterface::WalkAsyncPinnedForPromotion(Object* object, ScanContext* sc, promote_func* callback)
@@ -362,3 +476,13 @@ void GCToEEInterface::DiagAddNewRegion(int generation, uint8_t* rangeStart, uint
 void GCToEEInterface::LogErrorToHost(const char *message)
 {
 }
+
+void GCToEEInterface::SyncBlockCacheWeakPtrScanPartition(HANDLESCANPROC /*scanProc*/, uintptr_t /*lp1*/, uintptr_t /*lp2*/)
+{
+}
+
+void GCToEEInterface::RefCountedHandleCallbacksBatch(Object** /*objects*/, bool* promote, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        promote[i] = false;
+}
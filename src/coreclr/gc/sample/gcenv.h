@@ -137,6 +137,15 @@ public:
     static void AttachCurrentThread();
 };
 
+// -----------------------------------------------------------------------------------------------------------
+// Pause tracking
+//
+
+// Called on every RestartEE with the time the EE was suspended, in QueryPerformanceCounter ticks
+typedef void (*GCPauseCallback)(int64_t pauseTicks);
+
+void SetGCPauseCallback(GCPauseCallback callback);
+
 // -----------------------------------------------------------------------------------------------------------
 // Config file enumulation
 //
@@ -158,6 +158,21 @@ int main(int argc, char **argv)
     return 0;
 }" HAVE_XSW_USAGE)
 
+check_cxx_source_compiles("
+#include <linux/fs.h>
+#include <linux/userfaultfd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+int main(int argc, char **argv)
+{
+    struct pm_scan_arg arg;
+    int features = UFFD_FEATURE_WP_ASYNC | UFFD_FEATURE_WP_UNPOPULATED;
+
+    return ioctl(0, PAGEMAP_SCAN, &arg) + (int)syscall(__NR_userfaultfd, 0) + features;
+}" HAVE_PAGEMAP_SCAN)
+
 check_struct_has_member(
     "struct statfs"
     f_fstypename
@@ -121,6 +121,14 @@ typedef cpuset_t cpu_set_t;
 #include <unistd.h> // sysconf
 #include "globals.h"
 #include "cgroup.h"
+#include "gcconfig.h"
+
+#if HAVE_PAGEMAP_SCAN
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <linux/fs.h>
+#include <linux/userfaultfd.h>
+#endif // HAVE_PAGEMAP_SCAN
 
 #ifndef __APPLE__
 #if HAVE_SYSCONF && HAVE__SC_AVPHYS_PAGES
@@ -211,6 +219,13 @@ uint32_t g_pageSizeUnixInl = 0;
 
 AffinitySet g_processAffinitySet;
 
+#ifdef TARGET_LINUX
+// Relative performance of the processors on hybrid systems (Intel P/E cores, Arm big.LITTLE),
+// only filled in when the processors available to the process are not all the same.
+static uint32_t g_cpuCapacities[MAX_SUPPORTED_CPUS];
+static bool g_hasHybridCpus = false;
+#endif // TARGET_LINUX
+
 extern "C" int g_highestNumaNode;
 extern "C" bool g_numaAvailable;
 
@@ -221,6 +236,10 @@ static int *g_kern_memorystatus_level_mib = NULL;
 static size_t g_kern_memorystatus_level_mib_length = 0;
 #endif
 
+#ifdef TARGET_LINUX
+static void InitializeCpuCapacities();
+#endif // TARGET_LINUX
+
 // Initialize the interface implementation
 // Return:
 //  true if it has succeeded, false if it has failed
@@ -318,6 +337,10 @@ bool GCToOSInterface::Initialize()
 
     NUMASupportInitialize();
 
+#ifdef TARGET_LINUX
+    InitializeCpuCapacities();
+#endif // TARGET_LINUX
+
 #ifdef TARGET_APPLE
     const char* mem_free_name = "kern.memorystatus_level";
     int rc = sysctlnametomib(mem_free_name, NULL, &g_kern_memorystatus_level_mib_length);
@@ -563,6 +586,27 @@ void GCToOSInterface::YieldThread(uint32_t switchCount)
     assert(ret == 0);
 }
 
+#if HAVE_PAGEMAP_SCAN
+// Write watch is implemented with asynchronous userfaultfd write protection. Writes to a write protected page are
+// resolved by the kernel without a fault being delivered, and the PAGEMAP_SCAN ioctl reports (and optionally
+// write protects again) the pages that were written since. Unlike the soft-dirty bits this works on arbitrary
+// ranges rather than on the whole process.
+static int g_userFaultFd = -1;
+static int g_pagemapFd = -1;
+
+// Enable write watch for the specified range. Registering an already registered range is harmless, which lets
+// this be used to pick up mappings that replaced a registered one.
+static bool RegisterWriteWatch(void* address, size_t size)
+{
+    uffdio_register reg = {};
+    reg.range.start = (uint64_t)address;
+    reg.range.len = size;
+    reg.mode = UFFDIO_REGISTER_MODE_WP;
+
+    return ioctl(g_userFaultFd, UFFDIO_REGISTER, &reg) == 0;
+}
+#endif // HAVE_PAGEMAP_SCAN
+
 // Reserve virtual memory range.
 // Parameters:
 //  size       - size of the virtual memory range
@@ -573,7 +617,11 @@ void GCToOSInterface::YieldThread(uint32_t switchCount)
 //  Starting virtual address of the reserved range
 static void* VirtualReserveInner(size_t size, size_t alignment, uint32_t flags, uint32_t hugePagesFlag, bool committing)
 {
+#if HAVE_PAGEMAP_SCAN
+    assert(!(flags & VirtualReserveFlags::WriteWatch) || (g_userFaultFd != -1));
+#else
     assert(!(flags & VirtualReserveFlags::WriteWatch) && "WriteWatch not supported on Unix");
+#endif // HAVE_PAGEMAP_SCAN
     if (alignment < OS_PAGE_SIZE)
     {
         alignment = OS_PAGE_SIZE;
@@ -607,6 +655,13 @@ static void* VirtualReserveInner(size_t size, size_t alignment, uint32_t flags,
             madvise(pRetVal, size, MADV_DONTDUMP);
         }
 #endif
+#if HAVE_PAGEMAP_SCAN
+        if ((flags & VirtualReserveFlags::WriteWatch) && !RegisterWriteWatch(pRetVal, size))
+        {
+            munmap(pRetVal, size);
+            return NULL;
+        }
+#endif // HAVE_PAGEMAP_SCAN
         return pRetVal;
     }
 
@@ -731,6 +786,14 @@ bool GCToOSInterface::VirtualDecommit(void* address, size_t size)
     // be zeroed-out.
     bool bRetVal = mmap(address, size, PROT_NONE, MAP_FIXED | MAP_ANON | MAP_PRIVATE, -1, 0) != MAP_FAILED;
 
+#if HAVE_PAGEMAP_SCAN
+    // The new mapping doesn't inherit the write watch registration of the one it replaced.
+    if (bRetVal && (g_userFaultFd != -1))
+    {
+        RegisterWriteWatch(address, size);
+    }
+#endif // HAVE_PAGEMAP_SCAN
+
 #ifdef MADV_DONTDUMP
     if (bRetVal)
     {
@@ -786,7 +849,52 @@ bool GCToOSInterface::VirtualReset(void * address, size_t size, bool unlock)
 // Check if the OS supports write watching
 bool GCToOSInterface::SupportsWriteWatch()
 {
+#if HAVE_PAGEMAP_SCAN
+    // Write watch is opt-in since write protecting the GC heap makes the first write to each page after a reset
+    // take a (kernel resolved) fault.
+    if (!GCConfig::GetGCOSWriteWatch())
+    {
+        return false;
+    }
+
+    if (g_pagemapFd != -1)
+    {
+        return true;
+    }
+
+    int flags = O_CLOEXEC | O_NONBLOCK;
+#ifdef UFFD_USER_MODE_ONLY
+    // Only faults from user mode are of interest, this doesn't require vm.unprivileged_userfaultfd.
+    flags |= UFFD_USER_MODE_ONLY;
+#endif
+    int userFaultFd = (int)syscall(__NR_userfaultfd, flags);
+    if (userFaultFd == -1)
+    {
+        return false;
+    }
+
+    uffdio_api api = {};
+    api.api = UFFD_API;
+    api.features = UFFD_FEATURE_WP_ASYNC | UFFD_FEATURE_WP_UNPOPULATED;
+    if (ioctl(userFaultFd, UFFDIO_API, &api) != 0)
+    {
+        close(userFaultFd);
+        return false;
+    }
+
+    int pagemapFd = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+    if (pagemapFd == -1)
+    {
+        close(userFaultFd);
+        return false;
+    }
+
+    g_userFaultFd = userFaultFd;
+    g_pagemapFd = pagemapFd;
+    return true;
+#else
     return false;
+#endif // HAVE_PAGEMAP_SCAN
 }
 
 // Reset the write tracking state for the specified virtual memory range.
@@ -795,7 +903,21 @@ bool GCToOSInterface::SupportsWriteWatch()
 //  size    - size of the virtual memory range
 void GCToOSInterface::ResetWriteWatch(void* address, size_t size)
 {
+#if HAVE_PAGEMAP_SCAN
+    assert(g_userFaultFd != -1);
+
+    RegisterWriteWatch(address, size);
+
+    uffdio_writeprotect wp = {};
+    wp.range.start = (uint64_t)address;
+    wp.range.len = size;
+    wp.mode = UFFDIO_WRITEPROTECT_MODE_WP;
+
+    int st = ioctl(g_userFaultFd, UFFDIO_WRITEPROTECT, &wp);
+    assert(st == 0);
+#else
     assert(!"should never call ResetWriteWatch on Unix");
+#endif // HAVE_PAGEMAP_SCAN
 }
 
 // Retrieve addresses of the pages that are written to in a region of virtual memory
@@ -810,8 +932,70 @@ void GCToOSInterface::ResetWriteWatch(void* address, size_t size)
 //  true if it has succeeded, false if it has failed
 bool GCToOSInterface::GetWriteWatch(bool resetState, void* address, size_t size, void** pageAddresses, uintptr_t* pageAddressesCount)
 {
+#if HAVE_PAGEMAP_SCAN
+    assert(g_pagemapFd != -1);
+
+    uintptr_t capacity = *pageAddressesCount;
+    uintptr_t count = 0;
+    uint64_t start = (uint64_t)address;
+    uint64_t end = start + size;
+    bool registered = false;
+
+    page_region regions[64];
+
+    while ((start < end) && (count < capacity))
+    {
+        pm_scan_arg arg = {};
+        arg.size = sizeof(arg);
+        // Fail rather than silently skip mappings that aren't write watched, those would lose writes.
+        arg.flags = PM_SCAN_CHECK_WPASYNC | (resetState ? PM_SCAN_WP_MATCHING : 0);
+        arg.start = start;
+        arg.end = end;
+        arg.vec = (uint64_t)regions;
+        arg.vec_len = ARRAY_SIZE(regions);
+        arg.max_pages = capacity - count;
+        arg.category_mask = PAGE_IS_WRITTEN;
+        arg.return_mask = PAGE_IS_WRITTEN;
+
+        int regionCount = ioctl(g_pagemapFd, PAGEMAP_SCAN, &arg);
+        if (regionCount < 0)
+        {
+            if ((errno == EPERM) && !registered)
+            {
+                // Part of the range was mapped without the registration, enable it and scan again. All the
+                // pages of a newly registered mapping are reported as written.
+                registered = true;
+                if (RegisterWriteWatch((void*)start, (size_t)(end - start)))
+                {
+                    continue;
+                }
+            }
+
+            return false;
+        }
+
+        for (int i = 0; i < regionCount; i++)
+        {
+            for (uint64_t page = regions[i].start; (page < regions[i].end) && (count < capacity); page += OS_PAGE_SIZE)
+            {
+                pageAddresses[count++] = (void*)page;
+            }
+        }
+
+        if (arg.walk_end <= start)
+        {
+            break;
+        }
+
+        start = arg.walk_end;
+    }
+
+    *pageAddressesCount = count;
+    return true;
+#else
     assert(!"should never call GetWriteWatch on Unix");
     return false;
+#endif // HAVE_PAGEMAP_SCAN
 }
 
 bool ReadMemoryValueFromFile(const char* filename, uint64_t* val)
@@ -1529,35 +1713,132 @@ bool GCToOSInterface::CanEnableGCCPUGroups()
 //  node_no     - set to the NUMA node of the selected processor or to NUMA_NODE_UNDEFINED
 // Return:
 //  true if it succeeded
+#ifdef TARGET_LINUX
+// Set the capacity of the processors listed in a sysfs cpu list file (e.g. "0-7,16-23")
+static void SetCapacityForCpuList(const char* filename, uint32_t capacity)
+{
+    FILE* file = fopen(filename, "r");
+    if (file == nullptr)
+    {
+        return;
+    }
+
+    char* line = nullptr;
+    size_t lineLen = 0;
+    if (getline(&line, &lineLen, file) != -1)
+    {
+        const char* current = line;
+        size_t start, end;
+        while (ParseIndexOrRange(&current, &start, &end))
+        {
+            for (size_t i = start; (i <= end) && (i < MAX_SUPPORTED_CPUS); i++)
+            {
+                g_cpuCapacities[i] = capacity;
+            }
+
+            if (*current != ',')
+            {
+                break;
+            }
+            current++;
+        }
+    }
+
+    free(line);
+    fclose(file);
+}
+
+// Find out whether the processors available to the process have different performance. On such
+// systems the server GC heaps are placed on the fastest processors first, otherwise a process that
+// uses fewer heaps than processors could end up with its heaps on the efficiency cores.
+static void InitializeCpuCapacities()
+{
+    bool found = false;
+
+    // Arm big.LITTLE and other systems that describe the capacity through the energy model
+    for (size_t i = 0; i < MAX_SUPPORTED_CPUS; i++)
+    {
+        if (g_processAffinitySet.Contains(i))
+        {
+            char filename[64];
+            uint64_t capacity;
+            snprintf(filename, sizeof(filename), "/sys/devices/system/cpu/cpu%zu/cpu_capacity", i);
+            if (ReadMemoryValueFromFile(filename, &capacity))
+            {
+                g_cpuCapacities[i] = (uint32_t)capacity;
+                found = true;
+            }
+        }
+    }
+
+    // Intel hybrid processors expose the performance and efficiency cores as separate PMUs
+    if (!found)
+    {
+        SetCapacityForCpuList("/sys/devices/cpu_core/cpus", 1024);
+        SetCapacityForCpuList("/sys/devices/cpu_atom/cpus", 512);
+    }
+
+    uint32_t firstCapacity = 0;
+    bool first = true;
+    for (size_t i = 0; i < MAX_SUPPORTED_CPUS; i++)
+    {
+        if (g_processAffinitySet.Contains(i))
+        {
+            if (first)
+            {
+                firstCapacity = g_cpuCapacities[i];
+                first = false;
+            }
+            else if (g_cpuCapacities[i] != firstCapacity)
+            {
+                g_hasHybridCpus = true;
+                break;
+            }
+        }
+    }
+}
+#endif // TARGET_LINUX
+
 bool GCToOSInterface::GetProcessorForHeap(uint16_t heap_number, uint16_t* proc_no, uint16_t* node_no)
 {
     bool success = false;
 
-    uint16_t availableProcNumber = 0;
+    uint16_t availableProcs[MAX_SUPPORTED_CPUS];
+    size_t availableProcCount = 0;
     for (size_t procNumber = 0; procNumber < MAX_SUPPORTED_CPUS; procNumber++)
     {
         if (g_processAffinitySet.Contains(procNumber))
         {
-            if (availableProcNumber == heap_number)
-            {
-                *proc_no = procNumber;
+            availableProcs[availableProcCount++] = (uint16_t)procNumber;
+        }
+    }
+
 #ifdef TARGET_LINUX
-                if (GCToOSInterface::CanEnableGCNumaAware())
-                {
-                    int result = GetNumaNodeNumByCpu(procNumber);
-                    *node_no = (result >= 0) ? (uint16_t)result : NUMA_NODE_UNDEFINED;
-                }
-                else
+    if (g_hasHybridCpus)
+    {
+        // Fastest processors first, keeping the processor numbering order among the equally fast ones
+        std::stable_sort(availableProcs, availableProcs + availableProcCount,
+            [](uint16_t a, uint16_t b) { return g_cpuCapacities[a] > g_cpuCapacities[b]; });
+    }
 #endif // TARGET_LINUX
-                {
-                    *node_no = NUMA_NODE_UNDEFINED;
-                }
 
-                success = true;
-                break;
-            }
-            availableProcNumber++;
+    if (heap_number < availableProcCount)
+    {
+        uint16_t procNumber = availableProcs[heap_number];
+        *proc_no = procNumber;
+#ifdef TARGET_LINUX
+        if (GCToOSInterface::CanEnableGCNumaAware())
+        {
+            int result = GetNumaNodeNumByCpu(procNumber);
+            *node_no = (result >= 0) ? (uint16_t)result : NUMA_NODE_UNDEFINED;
+        }
+        else
+#endif // TARGET_LINUX
+        {
+            *node_no = NUMA_NODE_UNDEFINED;
         }
+
+        success = true;
     }
 
     return success;
@@ -13,6 +13,7 @@
 #endif
 #ifdef _M_ARM64
 #define ARCH_ARM
+#define ARCH_ARM64
 #endif
 #else
 #ifdef __i386__
@@ -24,6 +25,23 @@
 #ifdef __arm__
 #define ARCH_ARM
 #endif
+#ifdef __aarch64__
+#define ARCH_ARM64
+#endif
+#endif
+
+#ifdef ARCH_ARM64
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define vxsort_popcnt_u32(x) ((int)_CountOneBits(x))
+#define vxsort_popcnt_u64(x) ((int64_t)_CountOneBits64(x))
+#else
+#define vxsort_popcnt_u32(x) __builtin_popcount(x)
+#define vxsort_popcnt_u64(x) ((int64_t)__builtin_popcountll(x))
+#endif
+#else
+#define vxsort_popcnt_u32(x) _mm_popcnt_u32(x)
+#define vxsort_popcnt_u64(x) _mm_popcnt_u64(x)
 #endif
 
 #ifdef _MSC_VER
@@ -0,0 +1,76 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "common.h"
+
+#include "vxsort_targets_enable_avx2.h"
+
+#include <immintrin.h>
+
+#include "do_vxsort.h"
+
+//
+// Bulk operations on GC side tables (mark array, card table). These are called
+// for ranges that can be many MBs so they use 32 byte vectors, and the clearing
+// uses non temporal stores since the cleared words are not going to be looked at
+// again soon.
+//
+
+void do_clear_words_avx2 (uint32_t* dest, size_t count)
+{
+    // get to a 32 byte boundary with regular stores first.
+    while ((count > 0) && (((size_t)dest & (sizeof (__m256i) - 1)) != 0))
+    {
+        *dest++ = 0;
+        count--;
+    }
+
+    const size_t words_per_vector = sizeof (__m256i) / sizeof (uint32_t);
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i* vdest = (__m256i*)dest;
+
+    size_t vector_count = count / words_per_vector;
+    for (size_t i = 0; i < vector_count; i++)
+    {
+        _mm256_stream_si256 (&vdest[i], zero);
+    }
+
+    // the non temporal stores are weakly ordered, make sure they are visible
+    // before anyone looks at the side table after us.
+    _mm_sfence();
+
+    dest += vector_count * words_per_vector;
+    count -= vector_count * words_per_vector;
+    while (count > 0)
+    {
+        *dest++ = 0;
+        count--;
+    }
+}
+
+bool do_or_words_avx2 (uint32_t* dest, const uint32_t* src, size_t count)
+{
+    const size_t words_per_vector = sizeof (__m256i) / sizeof (uint32_t);
+    __m256i any = _mm256_setzero_si256();
+
+    size_t vector_count = count / words_per_vector;
+    for (size_t i = 0; i < vector_count; i++)
+    {
+        __m256i s = _mm256_loadu_si256 ((const __m256i*)src + i);
+        __m256i d = _mm256_loadu_si256 ((const __m256i*)dest + i);
+        _mm256_storeu_si256 ((__m256i*)dest + i, _mm256_or_si256 (d, s));
+        any = _mm256_or_si256 (any, s);
+    }
+
+    bool nonzero_p = !_mm256_testz_si256 (any, any);
+
+    for (size_t i = vector_count * words_per_vector; i < count; i++)
+    {
+        dest[i] |= src[i];
+        nonzero_p |= (src[i] != 0);
+    }
+
+    return nonzero_p;
+}
+
+#include "vxsort_targets_disable.h"
@@ -6,6 +6,7 @@ enum class InstructionSet
 {
     AVX2 = 0,
     AVX512F = 1,
+    NEON = 2,
 };
 
 void InitSupportedInstructionSet (int32_t configSetting);
@@ -14,3 +15,10 @@ bool IsSupportedInstructionSet (InstructionSet instructionSet);
 void do_vxsort_avx2 (uint8_t** low, uint8_t** high, uint8_t *range_low, uint8_t *range_high);
 
 void do_vxsort_avx512 (uint8_t** low, uint8_t** high, uint8_t* range_low, uint8_t* range_high);
+
+void do_vxsort_neon (uint8_t** low, uint8_t** high, uint8_t* range_low, uint8_t* range_high);
+
+// Bulk side table (mark array, card table) operations, see do_side_table_avx2.cpp
+void do_clear_words_avx2 (uint32_t* dest, size_t count);
+
+bool do_or_words_avx2 (uint32_t* dest, const uint32_t* src, size_t count);
@@ -28,3 +28,19 @@ void do_vxsort_avx512 (uint8_t** low, uint8_t** high, uint8_t* range_low, uint8_
 {
     assert(false);
 }
+
+void do_vxsort_neon (uint8_t** low, uint8_t** high, uint8_t* range_low, uint8_t* range_high)
+{
+    assert(false);
+}
+
+void do_clear_words_avx2 (uint32_t* dest, size_t count)
+{
+    assert(false);
+}
+
+bool do_or_words_avx2 (uint32_t* dest, const uint32_t* src, size_t count)
+{
+    assert(false);
+    return false;
+}
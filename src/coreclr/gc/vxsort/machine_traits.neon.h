@@ -0,0 +1,106 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef VXSORT_MACHINE_TRAITS_NEON_H
+#define VXSORT_MACHINE_TRAITS_NEON_H
+
+#include <arm_neon.h>
+#include <assert.h>
+#include <inttypes.h>
+#include <limits>
+#include <type_traits>
+#include "defs.h"
+#include "machine_traits.h"
+
+namespace vxsort {
+
+// A 128-bit vector only holds 2 64-bit elements, so there are just 4 possible
+// comparison masks. Each entry is a byte shuffle for vqtbl1q_u8 that moves the
+// elements that are <= pivot to the front of the vector.
+const int NEON_T64_SIZE = 4 * 16;
+
+extern const uint8_t perm_table_64_neon[NEON_T64_SIZE];
+
+static void not_supported()
+{
+    assert(!"operation is unsupported");
+}
+
+#ifdef _DEBUG
+// in _DEBUG, we #define return to be something more complicated,
+// containing a statement, so #define away constexpr for _DEBUG
+#define constexpr
+#endif  //_DEBUG
+
+template <>
+class vxsort_machine_traits<int64_t, NEON> {
+   public:
+    typedef int64_t T;
+    typedef int64x2_t TV;
+    typedef uint64_t TMASK;
+    typedef int64_t TPACK;
+    typedef typename std::make_unsigned<T>::type TU;
+
+    static constexpr bool supports_compress_writes() { return false; }
+
+    // Packing to 32-bit would only give us 4 lanes per vector, which still leaves
+    // a bitonic network with too little work per instruction to pay for itself.
+    static constexpr bool supports_packing() { return false; }
+
+    template <int Shift>
+    static constexpr bool can_pack(T span) { return false; }
+
+    static INLINE TV load_vec(TV* p) { return vld1q_s64((const int64_t*)p); }
+
+    static INLINE void store_vec(TV* ptr, TV v) { vst1q_s64((int64_t*)ptr, v); }
+
+    static void store_compress_vec(TV* ptr, TV v, TMASK mask) { not_supported(); }
+
+    static INLINE TV partition_vector(TV v, int mask) {
+        assert(mask >= 0);
+        assert(mask <= 3);
+        uint8x16_t perm = vld1q_u8(perm_table_64_neon + mask * 16);
+        return vreinterpretq_s64_u8(vqtbl1q_u8(vreinterpretq_u8_s64(v), perm));
+    }
+
+    static INLINE TV broadcast(int64_t pivot) { return vdupq_n_s64(pivot); }
+
+    static INLINE TMASK get_cmpgt_mask(TV a, TV b) {
+        uint64x2_t bits = vshrq_n_u64(vcgtq_s64(a, b), 63);
+        return vgetq_lane_u64(bits, 0) | (vgetq_lane_u64(bits, 1) << 1);
+    }
+
+    static TV shift_right(TV v, int i) { return vreinterpretq_s64_u64(vshlq_u64(vreinterpretq_u64_s64(v), vdupq_n_s64(-i))); }
+    static TV shift_left(TV v, int i) { return vshlq_s64(v, vdupq_n_s64(i)); }
+
+    static INLINE TV add(TV a, TV b) { return vaddq_s64(a, b); }
+    static INLINE TV sub(TV a, TV b) { return vsubq_s64(a, b); };
+
+    static INLINE TV pack_ordered(TV a, TV b) { not_supported(); return a; }
+    static INLINE TV pack_unordered(TV a, TV b) { not_supported(); return a; }
+    static INLINE void unpack_ordered(TV p, TV& u1, TV& u2) { not_supported(); }
+
+    template <int Shift>
+    static T shift_n_sub(T v, T sub) {
+        if (Shift > 0)
+            v >>= Shift;
+        v -= sub;
+        return v;
+    }
+
+    template <int Shift>
+    static T unshift_and_add(TPACK from, T add) {
+        add += from;
+        if (Shift > 0)
+            add = (T) (((TU) add) << Shift);
+        return add;
+    }
+};
+
+}
+
+#ifdef _DEBUG
+#undef constexpr
+#endif //_DEBUG
+
+#endif  // VXSORT_MACHINE_TRAITS_NEON_H
@@ -0,0 +1,20 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "common.h"
+#include "bitonic_sort.NEON.int64_t.h"
+
+using namespace vxsort;
+
+template<>
+void vxsort::smallsort::bitonic<int64_t, vector_machine::NEON>::sort(int64_t *ptr, size_t length) {
+    for (size_t i = 1; i < length; i++) {
+        int64_t v = ptr[i];
+        size_t j = i;
+        while ((j > 0) && (ptr[j - 1] > v)) {
+            ptr[j] = ptr[j - 1];
+            j--;
+        }
+        ptr[j] = v;
+    }
+}
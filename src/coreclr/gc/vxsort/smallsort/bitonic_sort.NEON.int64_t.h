@@ -0,0 +1,20 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef BITONIC_SORT_NEON_INT64_T_H
+#define BITONIC_SORT_NEON_INT64_T_H
+
+#include "bitonic_sort.h"
+
+namespace vxsort {
+namespace smallsort {
+
+// With only 2 64-bit lanes per NEON vector a bitonic network spends most of its
+// time shuffling lanes between vectors, so the small partitions left over by the
+// vectorized partitioning (at most 16 vectors, i.e. 32 elements) are finished
+// with a straight insertion sort instead.
+template<> void bitonic<int64_t, NEON>::sort(int64_t* ptr, size_t length);
+
+}  // namespace smallsort
+}  // namespace vxsort
+#endif
@@ -4,7 +4,7 @@
 #ifndef VXSORT_VXSORT_H
 #define VXSORT_VXSORT_H
 
-#ifdef __GNUC__
+#if defined(__GNUC__) && !defined(__aarch64__)
 #ifdef __clang__
 #pragma clang attribute push (__attribute__((target("popcnt"))), apply_to = any(function))
 #else
@@ -14,7 +14,11 @@
 #endif
 
 #include <assert.h>
+#if defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#else
 #include <immintrin.h>
+#endif
 
 #include <minipal/utils.h>
 
@@ -310,7 +314,7 @@ private:
         dataVec = MT::partition_vector(dataVec, mask);
         MT::store_vec(reinterpret_cast<TV*>(left), dataVec);
         MT::store_vec(reinterpret_cast<TV*>(right), dataVec);
-        auto popCount = -_mm_popcnt_u64(mask);
+        auto popCount = -vxsort_popcnt_u64(mask);
         right += popCount;
         left += popCount + N;
     }
@@ -320,7 +324,7 @@ private:
                                                      T*& left,
                                                      T*& right) {
         auto mask = MT::get_cmpgt_mask(dataVec, P);
-        auto popCount = -_mm_popcnt_u64(mask);
+        auto popCount = -vxsort_popcnt_u64(mask);
         MT::store_compress_vec(reinterpret_cast<TV*>(left), dataVec, ~mask);
         MT::store_compress_vec(reinterpret_cast<TV*>(right + N + popCount), dataVec, mask);
         right += popCount;
@@ -581,8 +585,8 @@ private:
         TV LT0 = MT::load_vec(preAlignedLeft);
         auto rtMask = MT::get_cmpgt_mask(RT0, P);
         auto ltMask = MT::get_cmpgt_mask(LT0, P);
-        const auto rtPopCountRightPart = max(_mm_popcnt_u32(rtMask), rightAlign);
-        const auto ltPopCountRightPart = _mm_popcnt_u32(ltMask);
+        const auto rtPopCountRightPart = max(vxsort_popcnt_u32(rtMask), rightAlign);
+        const auto ltPopCountRightPart = vxsort_popcnt_u32(ltMask);
         const auto rtPopCountLeftPart  = N - rtPopCountRightPart;
         const auto ltPopCountLeftPart  = N - ltPopCountRightPart;
 
@@ -656,6 +660,8 @@ private:
 
 }  // namespace gcsort
 
+#if !defined(__aarch64__)
 #include "vxsort_targets_disable.h"
+#endif
 
 #endif
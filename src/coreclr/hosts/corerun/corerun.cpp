@@ -8,6 +8,7 @@
 #include "corerun.hpp"
 #include "dotenv.hpp"
 
+#include <algorithm>
 #include <fstream>
 
 using char_t = pal::char_t;
@@ -55,6 +56,10 @@ struct configuration
     // Perform self test.
     bool self_test;
 
+    // Number of times to run the entry assembly to measure its startup, and the index of the option in argv.
+    int startup_benchmark_iterations;
+    int startup_benchmark_argi;
+
     // configured .env file to load
     dotenv dotenv_configuration;
 };
@@ -458,6 +463,80 @@ static int run(const configuration& config)
     return exit_code;
 }
 
+// Runs corerun with the same arguments the requested number of times with the runtime's startup
+// summary enabled, then reports the minimum, median and maximum of each value of the summaries.
+static int run_startup_benchmark(const int argc, const char_t* argv[], const configuration& config)
+{
+    std::vector<string_t> args;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (i == config.startup_benchmark_argi)
+        {
+            i++; // Skip the option's value.
+            continue;
+        }
+
+        args.push_back(argv[i]);
+    }
+
+    string_t summary_path = W("corerun-startup-");
+    summary_path.append(pal::to_string(pal::get_process_id()));
+    summary_path.append(W(".jsonl"));
+    std::ofstream{ pal::convert_to_utf8(summary_path.c_str()), std::ios::trunc };
+
+    pal::setenv(W("DOTNET_StartupSummary"), W("1"));
+    pal::setenv(W("DOTNET_StartupSummaryPath"), summary_path);
+
+    string_t exe_path = pal::get_exe_path();
+    for (int i = 0; i < config.startup_benchmark_iterations; ++i)
+    {
+        // The exit code is up to the app, only failing to start the process is an error.
+        if (pal::run_process(exe_path, args) == -1)
+        {
+            pal::fprintf(stderr, W("Failed to run '%s'\n"), exe_path.c_str());
+            return -1;
+        }
+    }
+
+    // Every summary is a single line object with numeric values
+    std::vector<std::pair<std::string, std::vector<long long>>> values;
+    std::ifstream summary_file{ pal::convert_to_utf8(summary_path.c_str()) };
+    int runs = 0;
+    for (std::string line; std::getline(summary_file, line); runs++)
+    {
+        size_t pos = 0;
+        while ((pos = line.find('"', pos)) != std::string::npos)
+        {
+            size_t key_end = line.find('"', pos + 1);
+            if (key_end == std::string::npos || key_end + 1 >= line.size() || line[key_end + 1] != ':')
+                break;
+
+            std::string key = line.substr(pos + 1, key_end - pos - 1);
+            long long value = ::strtoll(line.c_str() + key_end + 2, nullptr, 10);
+            pos = key_end + 2;
+            if (key == "pid")
+                continue;
+
+            auto it = std::find_if(values.begin(), values.end(), [&key](const std::pair<std::string, std::vector<long long>>& v) { return v.first == key; });
+            if (it == values.end())
+                it = values.insert(values.end(), std::make_pair(key, std::vector<long long>{}));
+
+            it->second.push_back(value);
+        }
+    }
+
+    ::printf("%d runs, summaries in %s\n", runs, pal::convert_to_utf8(summary_path.c_str()).c_str());
+    ::printf("%-24s %12s %12s %12s %6s\n", "", "min", "median", "max", "runs");
+    for (auto& value : values)
+    {
+        std::vector<long long>& samples = value.second;
+        std::sort(samples.begin(), samples.end());
+        ::printf("%-24s %12lld %12lld %12lld %6d\n", value.first.c_str(), samples.front(), samples[samples.size() / 2], samples.back(), (int)samples.size());
+    }
+
+    return runs == config.startup_benchmark_iterations ? 0 : -1;
+}
+
 // Display the command line options
 static void display_usage()
 {
@@ -474,6 +553,9 @@ static void display_usage()
         W("                   May be supplied multiple times. Format: <key>=<value>.\n")
         W("  -d, --debug - causes corerun to wait for a debugger to attach before executing.\n")
         W("  -e, --env - path to a .env file with environment variables that corerun should set.\n")
+        W("  --startup-benchmark - runs the assembly the given number of times and reports the\n")
+        W("                        startup phases, page faults, files opened and methods jitted\n")
+        W("                        and loaded from ReadyToRun code recorded by the runtime.\n")
         W("  -?, -h, --help - show this help.\n")
         W("\n")
         W("The runtime binary is searched for in --clr-path, CORE_ROOT environment variable, then\n")
@@ -573,6 +655,16 @@ static bool parse_args(
         {
             config.wait_to_debug = true;
         }
+        else if (pal::strcmp(option, W("startup-benchmark")) == 0)
+        {
+            config.startup_benchmark_argi = i;
+            i++;
+            if (i >= argc || (config.startup_benchmark_iterations = pal::stoi(argv[i])) <= 0)
+            {
+                pal::fprintf(stderr, W("Option %s: missing or invalid number of iterations\n"), arg);
+                break;
+            }
+        }
         else if (pal::strcmp(option, W("st")) == 0)
         {
             config.self_test = true;
@@ -621,6 +713,9 @@ int MAIN(const int argc, const char_t* argv[])
     if (config.self_test)
         return self_test();
 
+    if (config.startup_benchmark_iterations > 0)
+        return run_startup_benchmark(argc, argv, config);
+
     int exit_code = run(config);
     return exit_code;
 }
@@ -674,6 +769,19 @@ static int self_test()
             const char_t* args[] = { W(""), W("-p"), W("invalid"), W("foo") };
             THROW_IF_TRUE(parse_args(4, args, config));
         }
+        {
+            configuration config{};
+            const char_t* args[] = { W(""), W("--startup-benchmark"), W("5"), W("foo"), W("1") };
+            THROW_IF_FALSE(parse_args(5, args, config));
+            THROW_IF_FALSE(config.startup_benchmark_iterations == 5);
+            THROW_IF_FALSE(config.startup_benchmark_argi == 1);
+            THROW_IF_FALSE(config.entry_assembly_argc == 1);
+        }
+        {
+            configuration config{};
+            const char_t* args[] = { W(""), W("--startup-benchmark"), W("0"), W("foo") };
+            THROW_IF_TRUE(parse_args(4, args, config));
+        }
         {
             configuration config{};
             const char_t* args[] = { W(""), W("-p"), W("empty="), W("foo") };
@@ -69,6 +69,8 @@ namespace pal
     inline int strcmp(const char_t* str1, const char_t* str2) { return wcscmp(str1, str2); }
     inline size_t strlen(const char_t* str) { return wcslen(str); }
     inline char_t* strdup(const char_t* str) { return ::_wcsdup(str); }
+    inline int stoi(const char_t* str) { return (int)::wcstol(str, nullptr, 10); }
+    inline string_t to_string(uint32_t value) { return std::to_wstring(value); }
     inline int fprintf(FILE* fd, const char_t* const fmt, ...)
     {
         va_list args;
@@ -207,6 +209,32 @@ namespace pal
         return { buffer.get() };
     }
 
+    // Runs the executable with the arguments and waits for it to exit, returns its exit code or -1 if it couldn't be started.
+    inline int run_process(const string_t& exe_path, const std::vector<string_t>& args)
+    {
+        stringstream_t command_line;
+        command_line << W('"') << exe_path << W('"');
+        for (const string_t& arg : args)
+            command_line << W(" \"") << arg << W('"');
+
+        string_t command_line_str = command_line.str();
+        STARTUPINFOW si{};
+        si.cb = sizeof(si);
+        PROCESS_INFORMATION pi{};
+        if (!::CreateProcessW(exe_path.c_str(), &command_line_str[0], nullptr, nullptr, FALSE, 0, nullptr, nullptr, &si, &pi))
+            return -1;
+
+        ::WaitForSingleObject(pi.hProcess, INFINITE);
+
+        DWORD exit_code;
+        if (!::GetExitCodeProcess(pi.hProcess, &exit_code))
+            exit_code = (DWORD)-1;
+
+        ::CloseHandle(pi.hThread);
+        ::CloseHandle(pi.hProcess);
+        return (int)exit_code;
+    }
+
     inline bool try_load_hostpolicy(pal::string_t mock_hostpolicy_value)
     {
         const char_t* hostpolicyName = W("hostpolicy.dll");
@@ -303,6 +331,8 @@ public:
 #include <dlfcn.h>
 #include <limits.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
+#include <errno.h>
 #include <unistd.h>
 
 // Needed for detecting the debugger attach scenario
@@ -357,6 +387,8 @@ namespace pal
     inline int strcmp(const char_t* str1, const char_t* str2) { return ::strcmp(str1, str2); }
     inline size_t strlen(const char_t* str) { return ::strlen(str); }
     inline char_t* strdup(const char_t* str) { return ::strdup(str); }
+    inline int stoi(const char_t* str) { return (int)::strtol(str, nullptr, 10); }
+    inline string_t to_string(uint32_t value) { return std::to_string(value); }
     inline int fprintf(FILE* fd, const char_t* const fmt, ...)
     {
         va_list args;
@@ -588,6 +620,35 @@ namespace pal
         return { str };
     }
 
+    // Runs the executable with the arguments and waits for it to exit, returns its exit code or -1 if it couldn't be started.
+    inline int run_process(const string_t& exe_path, const std::vector<string_t>& args)
+    {
+        std::vector<char*> argv;
+        argv.push_back(const_cast<char*>(exe_path.c_str()));
+        for (const string_t& arg : args)
+            argv.push_back(const_cast<char*>(arg.c_str()));
+        argv.push_back(nullptr);
+
+        pid_t pid = ::fork();
+        if (pid == -1)
+            return -1;
+
+        if (pid == 0)
+        {
+            ::execv(exe_path.c_str(), argv.data());
+            ::_exit(127);
+        }
+
+        int status;
+        while (::waitpid(pid, &status, 0) == -1)
+        {
+            if (errno != EINTR)
+                return -1;
+        }
+
+        return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    }
+
     inline bool try_load_hostpolicy(pal::string_t mock_hostpolicy_value)
     {
         if (!string_ends_with(mock_hostpolicy_value, pal::nativelib_ext))
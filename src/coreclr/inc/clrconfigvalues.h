@@ -281,9 +281,13 @@ RETAIL_CONFIG_DWORD_INFO(EXTERNAL_gcAllowVeryLargeObjects, W("gcAllowVeryLargeOb
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_GCStress, W("GCStress"), 0, "Trigger GCs at regular intervals")
 CONFIG_DWORD_INFO(INTERNAL_GcStressOnDirectCalls, W("GcStressOnDirectCalls"), 0, "Whether to trigger a GC on direct calls")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_HeapVerify, W("HeapVerify"), 0, "When set verifies the integrity of the managed heap on entry and exit of each GC")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_FinalizerThreadCount, W("FinalizerThreadCount"), 1, "Number of threads, including the finalizer thread, that run finalizers in parallel. Capped to the processor count. Critical finalizers still run after the other finalizers of a pass.")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_GCCpuGroup, W("GCCpuGroup"), 0, "Specifies if to enable GC to support CPU groups")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_GCName, W("GCName"), "")
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_GCPath, W("GCPath"), "")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_FrozenObjectHeapMaxObjectSize, W("FrozenObjectHeapMaxObjectSize"), 0x10000, "Largest object, in bytes, that may be allocated on a frozen segment, for example an array stored to a static readonly field by a static constructor. Values below the default are ignored.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_GCPretenuring, W("GCPretenuring"), 0, "Samples object allocations per type and allocates the instances of types whose samples keep surviving to gen2 directly in an older generation.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_GCPretenuringSampleInterval, W("GCPretenuringSampleInterval"), 64, "Samples one in this many object allocations that reach the runtime's allocator for GCPretenuring.")
 /**
  * This flag allows us to force the runtime to use global allocation context on Windows x86/amd64 instead of thread allocation context just for testing purpose.
  * The flag is unsafe for a subtle reason. Although the access to the g_global_alloc_context is protected under a lock. The implementation of
@@ -351,6 +355,7 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_JitELTHookEnabled, W("JitELTHookEnabled"), 0,
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_JitMemStats, W("JitMemStats"), 0, "Display JIT memory usage statistics")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_JitVNMapSelBudget, W("JitVNMapSelBudget"), 100, "Max # of MapSelect's considered for a particular top-level invocation.")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TrackDynamicMethodDebugInfo, W("TrackDynamicMethodDebugInfo"), 0, "Specifies whether debug info should be generated and tracked for dynamic methods")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TrackOptimizedVarInfo, W("TrackOptimizedVarInfo"), 1, "Specifies whether native variable locations should be stored for optimized jitted code when no debugger is attached")
 
 #ifdef FEATURE_MULTICOREJIT
 
@@ -358,6 +363,10 @@ RETAIL_CONFIG_STRING_INFO(INTERNAL_MultiCoreJitProfile, W("MultiCoreJitProfile")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitProfileWriteDelay, W("MultiCoreJitProfileWriteDelay"), 12, "Set the delay after which the multi-core JIT profile will be written to disk.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitMinNumCpus, W("MultiCoreJitMinNumCpus"), 2, "Minimum number of cpus that must be present to allow MultiCoreJit usage.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitNoProfileGather, W("MultiCoreJitNoProfileGather"), 0, "Set to 1 to disable profile gathering (but leave possibly enabled profile usage).")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitRecordTypes, W("MultiCoreJitRecordTypes"), 0, "Set to 1 to also record generic type instantiations in the multi-core JIT profile, so that playback loads them eagerly.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitTier1Workers, W("MultiCoreJitTier1Workers"), 1, "Number of threads, including the player thread, that jit methods recorded as promoted to tier 1 directly at tier 1 during playback. Set to 0 to play them back at the initial tier like other methods.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitPrefetchAssemblies, W("MultiCoreJitPrefetchAssemblies"), 0, "Set to 1 to open and map the TPA assemblies listed in the multi-core JIT profile on the player thread as soon as playback starts, ahead of their binds on the application threads.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_MultiCoreJitPreResolveHelperCells, W("MultiCoreJitPreResolveHelperCells"), 0, "Set to 1 to resolve the ReadyToRun allocation and casting helper cells of a module on the player thread when playback reaches the module, instead of on first use.")
 
 #endif
 
@@ -469,6 +478,7 @@ RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ProfAPI_DetachMinSleepMs, W("ProfAPI_DetachMin
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ProfAPI_DetachMaxSleepMs, W("ProfAPI_DetachMaxSleepMs"), 0, "The maximum time, in milliseconds, the CLR will wait before checking whether a profiler that is in the process of detaching is ready to be unloaded.")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ProfAPI_RejitOnAttach, W("ProfApi_RejitOnAttach"), 1, "Enables the ability for profilers to rejit methods on attach.")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ProfAPI_InliningTracking, W("ProfApi_InliningTracking"), 1, "Enables the runtime's tracking of inlining for profiler ReJIT.")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ProfAPI_EnterLeaveSampleRate, W("ProfAPI_EnterLeaveSampleRate"), 1, "If greater than one, the profiler's enter, leave and tailcall hooks are only called for one in that many calls of each method. The three hooks are sampled independently, so they no longer pair up.")
 CONFIG_DWORD_INFO(INTERNAL_ProfAPI_EnableRejitDiagnostics, W("ProfAPI_EnableRejitDiagnostics"), 0, "Enable extra dumping to stdout of rejit structures")
 CONFIG_DWORD_INFO(INTERNAL_ProfAPIFault, W("ProfAPIFault"), 0, "Test-only bitmask to inject various types of faults in the profapi code")
 CONFIG_DWORD_INFO(INTERNAL_TestOnlyAllowedEventMask, W("TestOnlyAllowedEventMask"), 0, "Test-only bitmask to allow profiler tests to override CLR enforcement of COR_PRF_ALLOWABLE_AFTER_ATTACH and COR_PRF_MONITOR_IMMUTABLE")
@@ -477,6 +487,9 @@ CONFIG_DWORD_INFO(INTERNAL_TestOnlyEnableObjectAllocatedHook, W("TestOnlyEnableO
 CONFIG_DWORD_INFO(INTERNAL_TestOnlyEnableSlowELTHooks, W("TestOnlyEnableSlowELTHooks"), 0, "Test-only flag that forces CLR to initialize on startup as if slow-ELT were requested, to enable post-attach ELT functionality.")
 
 RETAIL_CONFIG_STRING_INFO(UNSUPPORTED_ETW_ObjectAllocationEventsPerTypePerSec, W("ETW_ObjectAllocationEventsPerTypePerSec"), "Desired number of GCSampledObjectAllocation ETW events to be logged per type per second.  If 0, then the default built in to the implementation for the enabled event (e.g., High, Low), will be used.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_ETW_AllocationSamplingMeanBytes, W("ETW_AllocationSamplingMeanBytes"), 0x19000, "Mean number of bytes allocated by a thread between two AllocationSampled events.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_ETW_GCHeapDumpAggregate, W("ETW_GCHeapDumpAggregate"), 0, "If set, GC heap dumps report per-type and per-generation object counts and sizes in GCBulkTypeStats events instead of a GCBulkNode and GCBulkEdge event entry for every object.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_ETW_GCHeapDumpAggregateSampleInterval, W("ETW_GCHeapDumpAggregateSampleInterval"), 10000, "Number of objects between two objects whose node and references are still reported by an aggregated GC heap dump. If 0, no objects are sampled.")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_ProfAPI_ValidateNGENInstrumentation, W("ProfAPI_ValidateNGENInstrumentation"), 0, "This flag enables additional validations when using the IMetaDataEmit APIs for NGEN'ed images to ensure only supported edits are made.")
 
 #ifdef FEATURE_PERFMAP
@@ -484,9 +497,14 @@ RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapEnabled, W("PerfMapEnabled"), 0, "This
 RETAIL_CONFIG_STRING_INFO_EX(EXTERNAL_PerfMapJitDumpPath, W("PerfMapJitDumpPath"), "Specifies a path to write the perf jitdump file. Defaults to /tmp", CLRConfig::LookupOptions::TrimWhiteSpaceFromStringValue)
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapIgnoreSignal, W("PerfMapIgnoreSignal"), 0, "When perf map is enabled, this option will configure the specified signal to be accepted and ignored as a marker in the perf logs.  It is disabled by default")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapShowOptimizationTiers, W("PerfMapShowOptimizationTiers"), 1, "Shows optimization tiers in the perf map for methods, as part of the symbol name. Useful for seeing separate stack frames for different optimization tiers of each method.")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapBufferSize, W("PerfMapBufferSize"), 0, "When set, perf map lines are queued in a ring buffer of this many KB and written to the file by a background thread instead of the thread that logged them. Disabled by default")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapMaxFileSize, W("PerfMapMaxFileSize"), 0, "When set, the perf map is moved to perf-$pid.map.old and a new one is started once it grows past this many MB. Disabled by default")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_PerfMapJitDumpDebugInfo, W("PerfMapJitDumpDebugInfo"), 0, "Writes a debug info record mapping native code to IL offsets before each jitted method in the jitdump file. The IL offsets are reported as line numbers. Disabled by default")
 #endif
 
 RETAIL_CONFIG_STRING_INFO(EXTERNAL_StartupDelayMS, W("StartupDelayMS"), "")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_StartupSummary, W("StartupSummary"), 0, "Writes a single line of JSON at shutdown with the duration of the host and runtime startup phases, page faults, files opened and methods jitted and loaded from ReadyToRun code.")
+RETAIL_CONFIG_STRING_INFO(UNSUPPORTED_StartupSummaryPath, W("StartupSummaryPath"), "Appends the startup summary to this file instead of writing it to stderr.")
 
 ///
 /// Stress
@@ -497,6 +515,7 @@ RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_StressLogSize, W("StressLogSize"), 0, "Stre
 RETAIL_CONFIG_STRING_INFO(UNSUPPORTED_StressLogFilename, W("StressLogFilename"), "Stress log filename for memory mapped stress log.")
 CONFIG_DWORD_INFO(INTERNAL_stressSynchronized, W("stressSynchronized"), 0, "Unknown if or where this is used; unless a test is specifically depending on this, it can be removed.")
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TotalStressLogSize, W("TotalStressLogSize"), 0, "Total stress log size in bytes.")
+RETAIL_CONFIG_STRING_INFO(EXTERNAL_StressLogFacilities, W("StressLogFacilities"), "Comma separated stress log categories to record (GC, JIT, ThreadPool, Suspension, Loader, Interop, EH, Startup). Takes precedence over LogFacility for the stress log.")
 
 ///
 /// Thread Suspend
@@ -575,10 +594,12 @@ RETAIL_CONFIG_DWORD_INFO(EXTERNAL_TC_CallCountThreshold, W("TC_CallCountThreshol
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_TC_CallCountingDelayMs, W("TC_CallCountingDelayMs"), TC_CallCountingDelayMs, "A perpetual delay in milliseconds that is applied to call counting in tier 0 and jitting at higher tiers, while there is startup-like activity.")
 
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_BackgroundWorkerTimeoutMs, W("TC_BackgroundWorkerTimeoutMs"), TC_BackgroundWorkerTimeoutMs, "How long in milliseconds the background worker thread may remain idle before exiting.")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_TC_BackgroundWorkerCount, W("TC_BackgroundWorkerCount"), 1, "Maximum number of threads, including the background worker thread, that may jit methods at higher tiers in parallel. Capped to the processor count.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_DelaySingleProcMultiplier, W("TC_DelaySingleProcMultiplier"), TC_DelaySingleProcMultiplier, "Multiplier for TC_CallCountingDelayMs that is applied on a single-processor machine or when the process is affinitized to a single processor.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_CallCounting, W("TC_CallCounting"), 1, "Enabled by default (only activates when TieredCompilation is also enabled). If disabled immediately backpatches prestub, and likely prevents any promotion to higher tiers")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_UseCallCountingStubs, W("TC_UseCallCountingStubs"), 1, "Uses call counting stubs for faster call counting.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_DeleteCallCountingStubsAfter, W("TC_DeleteCallCountingStubsAfter"), 0, "Deletes call counting stubs after this many have completed. Zero to disable deleting.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_CallCountingCompletionBatchMs, W("TC_CallCountingCompletionBatchMs"), 0, "If nonzero, methods reaching the call count threshold are queued without taking locks and call counting is completed for them in batches at most this often (in milliseconds), and call counting stubs are deleted at most this often. Zero to complete call counting as methods reach the threshold.")
 #undef TC_BackgroundWorkerTimeoutMs
 #undef TC_CallCountThreshold
 #undef TC_CallCountingDelayMs
@@ -592,6 +613,7 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_TC_DeleteCallCountingStubsAfter, W("TC_DeleteC
 #ifdef FEATURE_ON_STACK_REPLACEMENT
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_OSR_CounterBump, W("OSR_CounterBump"), 1000, "Counter reload value when a patchpoint is hit")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_OSR_HitLimit, W("OSR_HitLimit"), 10, "Number of times a patchpoint must call back to trigger an OSR transition")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_OSR_BackgroundCompilation, W("OSR_BackgroundCompilation"), 0, "If set, OSR methods are jitted on a background thread while the Tier0 method keeps running")
 CONFIG_DWORD_INFO(INTERNAL_OSR_LowId, W("OSR_LowId"), (DWORD)-1, "Low end of enabled patchpoint range (inclusive)");
 CONFIG_DWORD_INFO(INTERNAL_OSR_HighId, W("OSR_HighId"), 10000000, "High end of enabled patchpoint range (inclusive)");
 #endif
@@ -604,6 +626,8 @@ RETAIL_CONFIG_STRING_INFO(INTERNAL_PGODataPath, W("PGODataPath"), "Read/Write PG
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_ReadPGOData, W("ReadPGOData"), 0, "Read PGO data")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_WritePGOData, W("WritePGOData"), 0, "Write PGO data")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_TieredPGO, W("TieredPGO"), 1, "Instrument Tier0 code and make counts available to Tier1")
+RETAIL_CONFIG_STRING_INFO(EXTERNAL_TieredPGO_PersistedProfilePath, W("TieredPGO_PersistedProfilePath"), "Load dynamic PGO data saved by a previous run from the indicated file, and save this run's data to it at shutdown")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_TieredPGO_PersistedProfileReadOnly, W("TieredPGO_PersistedProfileReadOnly"), 0, "Load the persisted PGO profile but do not update it at shutdown")
 
 // TieredPGO_InstrumentOnlyHotCode values:
 //
@@ -628,6 +652,7 @@ RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_BackpatchEntryPointSlots, W("BackpatchEntry
 /// TypeLoader
 ///
 CONFIG_DWORD_INFO(INTERNAL_TypeLoader_InjectInterfaceDuplicates, W("INTERNAL_TypeLoader_InjectInterfaceDuplicates"), 0, "Injects duplicates in interface map for all types.")
+RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_TypeLoader_CompactGCLayout, W("TypeLoader_CompactGCLayout"), 0, "Places by-value fields that contain GC pointers right after the object reference fields of auto layout types that are not from ReadyToRun images, so the GC scans fewer pointer series per object.")
 
 ///
 /// Virtual call stubs
@@ -674,6 +699,7 @@ RETAIL_CONFIG_STRING_INFO(INTERNAL_EventNameFilter, W("EventNameFilter"), "")
 ///
 RETAIL_CONFIG_DWORD_INFO(UNSUPPORTED_InteropValidatePinnedObjects, W("InteropValidatePinnedObjects"), 0, "After returning from a managed-to-unmanaged interop call, validate GC heap around objects pinned by IL stubs.")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_InteropLogArguments, W("InteropLogArguments"), 0, "Log all pinned arguments passed to an interop call")
+RETAIL_CONFIG_STRING_INFO(EXTERNAL_PInvokeSuppressGCTransition, W("PInvokeSuppressGCTransition"), "List of native entry points whose P/Invokes are called as if marked with SuppressGCTransitionAttribute")
 RETAIL_CONFIG_STRING_INFO(UNSUPPORTED_LogCCWRefCountChange, W("LogCCWRefCountChange"), "Outputs debug information and calls LogCCWRefCountChange_BREAKPOINT when AddRef or Release is called on a CCW.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EnableRCWCleanupOnSTAShutdown, W("EnableRCWCleanupOnSTAShutdown"), 0, "Performs RCW cleanup when STA shutdown is detected using IInitializeSpy in classic processes.")
 
@@ -688,7 +714,10 @@ RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeRundown, W("EventPipeRundown"), 1, "E
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeCircularMB, W("EventPipeCircularMB"), 1024, "The EventPipe circular buffer size in megabytes.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeProcNumbers, W("EventPipeProcNumbers"), 0, "Enable/disable capturing processor numbers in EventPipe event headers")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeOutputStreaming, W("EventPipeOutputStreaming"), 1, "Enable/disable streaming for trace file set in DOTNET_EventPipeOutputPath.  Non-zero values enable streaming.")
+RETAIL_CONFIG_STRING_INFO(INTERNAL_EventPipeStartupSession, W("EventPipeStartupSession"), "Providers (EventPipeConfig syntax) of a session buffering from startup until a diagnostics client attaches to it.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeStartupSessionMB, W("EventPipeStartupSessionMB"), 16, "The size in megabytes of the startup session buffers, allocated up front.")
 RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeEnableStackwalk, W("EventPipeEnableStackwalk"), 1, "Set to 0 to disable collecting stacks for EventPipe events.")
+RETAIL_CONFIG_DWORD_INFO(INTERNAL_EventPipeSampleRunningThreadsOnly, W("EventPipeSampleRunningThreadsOnly"), 0, "Set to 1 to have the EventPipe sample profiler skip threads that aren't running managed code.")
 
 //
 // UserEvents
@@ -733,6 +762,7 @@ RETAIL_CONFIG_DWORD_INFO(EXTERNAL_EnableWriteXorExecute, W("EnableWriteXorExecut
 #else
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_EnableWriteXorExecute, W("EnableWriteXorExecute"), 1, "Enable W^X for executable memory.");
 #endif // TARGET_RISCV64
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_ExecutableHugePages, W("ExecutableHugePages"), 0, "Advise the OS to back code and loader heaps with transparent huge pages.");
 
 #ifdef FEATURE_GDBJIT
 ///
@@ -801,6 +831,7 @@ RETAIL_CONFIG_DWORD_INFO(EXTERNAL_EnableArm64Sha256,            W("EnableArm64Sh
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_EnableArm64Rcpc,              W("EnableArm64Rcpc"),           1, "Allows Arm64 Rcpc+ hardware intrinsics to be disabled")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_EnableArm64Rcpc2,             W("EnableArm64Rcpc2"),          1, "Allows Arm64 Rcpc2+ hardware intrinsics to be disabled")
 RETAIL_CONFIG_DWORD_INFO(EXTERNAL_EnableArm64Sve,               W("EnableArm64Sve"),            1, "Allows Arm64 SVE hardware intrinsics to be disabled")
+RETAIL_CONFIG_DWORD_INFO(EXTERNAL_Arm64ClampSveVectorLength,    W("Arm64ClampSveVectorLength"), 0, "On Linux, limits the SVE vector length of the threads running managed code to 128 bits, which allows SVE to be used on hardware with wider vectors")
 #endif
 
 ///
@@ -1702,6 +1702,9 @@ struct CORINFO_THREAD_STATIC_BLOCKS_INFO
     uint32_t offsetOfMaxThreadStaticBlocks;
     uint32_t offsetOfThreadStaticBlocks;
     uint32_t offsetOfBaseOfThreadLocalData;
+    uint32_t offsetOfMaxCollectibleThreadStaticBlocks;
+    uint32_t offsetOfCollectibleThreadStaticBlocks;
+    uint32_t collectibleTypeIndexFlag;          // set in the indices of collectible types returned by getThreadLocalFieldInfo
 };
 
 //----------------------------------------------------------------------------
@@ -1969,6 +1972,24 @@ struct CORINFO_SWIFT_LOWERING
     size_t numLoweredElements;
 };
 
+// Low overhead per-method compilation summary that the JIT reports through
+// ICorJitInfo::reportMetadata under the CORINFO_JIT_TELEMETRY_KEY key, after
+// code has been emitted. Times are in microseconds; a phase time is zero when
+// the JIT could not measure it.
+#define CORINFO_JIT_TELEMETRY_KEY "JitTelemetry"
+
+struct CORINFO_JIT_TELEMETRY
+{
+    uint32_t ilCodeSize;           // IL size of the method (not including inlinees)
+    uint32_t nativeCodeSize;       // hot + cold code size
+    uint64_t arenaBytes;           // bytes allocated by the JIT's arena allocator (arenas never shrink, so this is the peak)
+    uint32_t totalMicroseconds;    // whole compilation
+    uint32_t importMicroseconds;   // importation
+    uint32_t optimizeMicroseconds; // from the end of importation to the start of register allocation
+    uint32_t lsraMicroseconds;     // register allocation
+    uint32_t codegenMicroseconds;  // code generation and emission
+};
+
 #define SIZEOF__CORINFO_Object                            TARGET_POINTER_SIZE /* methTable */
 
 #define CORINFO_Array_MaxLength                           0x7FFFFFC7
@@ -2826,7 +2847,8 @@ public:
             CORINFO_FIELD_INFO *        pResult
             ) = 0;
 
-    // Returns the index against which the field's thread static block in stored in TLS.
+    // Returns the index against which the field's thread static block in stored in TLS. For collectible
+    // types, the index has CORINFO_THREAD_STATIC_BLOCKS_INFO::collectibleTypeIndexFlag set.
     virtual uint32_t getThreadLocalFieldInfo (
             CORINFO_FIELD_HANDLE        field,
             bool                        isGCType
@@ -140,6 +140,13 @@ namespace ETW
         // GCSampledObjectAllocation*Keyword was used)
         static int s_nCustomMsBetweenEvents;
 
+        // See code:ETW::TypeSystemLog::PostRegistrationInit
+        static BOOL s_fAllocationSamplingEnabledOnStartup;
+        static BOOL s_fAllocationSamplingEnabledNow;
+
+        // Mean distance, in allocated bytes, between two AllocationSampled events on a thread
+        static SIZE_T s_cbAllocationSamplingMean;
+
     public:
         // This customizes the type logging behavior in LogTypeAndParametersIfNecessary
         enum TypeLogBehavior
@@ -165,6 +172,8 @@ namespace ETW
         static void PostRegistrationInit();
         static BOOL IsHeapAllocEventEnabled();
         static void SendObjectAllocatedEvent(Object * pObject);
+        static BOOL IsAllocationSamplingEnabled();
+        static void SampleObjectAllocation(Object * pObject, UINT32 allocationKind);
         static CrstBase * GetHashCrst();
         static VOID LogTypeAndParametersIfNecessary(BulkTypeEventLogger * pBulkTypeEventLogger, ULONGLONG thAsAddr, TypeLogBehavior typeLogBehavior);
         static VOID OnModuleUnload(Module * pModule);
@@ -98,11 +98,19 @@ private:
     // Caches the DOTNET_EnableWXORX setting
     static bool g_isWXorXEnabled;
 
+    // Caches the DOTNET_ExecutableHugePages setting
+    static bool g_isHugePagesEnabled;
+
     // Head of the linked list of all RX blocks that were allocated by this allocator
     BlockRX* m_pFirstBlockRX = NULL;
 
-    // Head of the linked list of free RX blocks that were allocated by this allocator and then backed out
-    BlockRX* m_pFirstFreeBlockRX = NULL;
+    // Number of size buckets of the free RX blocks. Bucket i holds the blocks of at least
+    // Granularity() << i bytes, the last bucket also holds all the larger ones.
+    static const int FreeBlockBucketCount = 16;
+
+    // Linked lists of free RX blocks that were allocated by this allocator and then released or backed out,
+    // by size bucket. Free blocks that are adjacent in the underlying shared memory are merged.
+    BlockRX* m_pFreeBlocksRX[FreeBlockBucketCount] = { 0 };
 
     // Head of the linked list of currently mapped RW blocks
     BlockRW* m_pFirstBlockRW = NULL;
@@ -117,6 +125,11 @@ private:
     // for platforms that don't use shared memory.
     size_t m_freeOffset = 0;
 
+    // Number of RW mappings created and released at the OS level, which is what
+    // W^X costs. Updated under m_CriticalSection.
+    UINT64 m_rwMapCount = 0;
+    UINT64 m_rwUnmapCount = 0;
+
 // Uncomment these to gather information to better choose caching parameters
 //#define VARIABLE_SIZED_CACHEDMAPPING_SIZE
 
@@ -157,10 +170,19 @@ private:
     // Return false if no existing RW block contains the passed in address.
     bool RemoveRWBlock(void* pRW, void** pUnmapAddress, size_t* pUnmapSize);
 
-    // Find a free block with the closest size >= the requested size.
+    // Find a free block with the closest size >= the requested size and split off the rest of it.
     // Returns NULL if no such block exists.
     BlockRX* FindBestFreeBlock(size_t size);
 
+    // Return the index of the free block bucket for blocks of the specified size
+    static int GetFreeBlockBucket(size_t size);
+
+    // Add the block to the free blocks, merging it with the adjacent free blocks
+    void AddFreeBlock(BlockRX* pBlock);
+
+    // Remove the block from the free blocks
+    void RemoveFreeBlock(BlockRX* pBlock);
+
     // Return memory mapping granularity.
     static size_t Granularity();
 
@@ -262,6 +284,13 @@ public:
 
     // Unmap the RW mapping at the specified address
     void UnmapRW(void* pRW);
+
+    // Return the number of RW mappings that were created and released so far
+    void GetRWMappingCounts(UINT64* pMapCount, UINT64* pUnmapCount);
+
+    // Return the size of the part of the underlying shared memory used so far and how much of it
+    // is free for reuse. All the values are zero if double mapping is not enabled.
+    void GetSharedMemoryStatistics(size_t* pUsedSize, size_t* pFreeSize, size_t* pFreeBlockCount, size_t* pLargestFreeBlockSize);
 };
 
 #define ExecutableWriterHolder ExecutableWriterHolderNoLog
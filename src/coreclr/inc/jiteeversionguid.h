@@ -43,11 +43,11 @@ typedef const GUID *LPCGUID;
 #define GUID_DEFINED
 #endif // !GUID_DEFINED
 
-constexpr GUID JITEEVersionIdentifier = { /* e428e66d-5e0e-4320-ad8a-fa5a50f6da07 */
-    0xe428e66d,
-    0x5e0e,
-    0x4320,
-    {0xad, 0x8a, 0xfa, 0x5a, 0x50, 0xf6, 0xda, 0x07}
+constexpr GUID JITEEVersionIdentifier = { /* cb844637-cdad-4859-8535-c552d54c8e3e */
+    0xcb844637,
+    0xcdad,
+    0x4859,
+    {0x85, 0x35, 0xc5, 0x52, 0xd5, 0x4c, 0x8e, 0x3e}
   };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -223,6 +223,10 @@ private:
     PTR_BYTE            m_pPtrToEndOfCommittedRegion;
     PTR_BYTE            m_pEndReservedRegion;
 
+    // For interleaved heaps, points to the end of the code/data page pairs of the current block that have
+    // already been committed and filled with code, possibly ahead of m_pPtrToEndOfCommittedRegion
+    PTR_BYTE            m_pEndOfCommittedInterleavedPages;
+
     // When we need to ClrVirtualAlloc() MEM_RESERVE a new set of pages, number of bytes to reserve
     DWORD               m_dwReserveBlockSize;
 
@@ -339,8 +343,9 @@ private:
     // has run out, reserve another set of pages
     BOOL GetMoreCommittedPages(size_t dwMinSize);
 
-    // Commit memory pages starting at the specified adress
-    BOOL CommitPages(void* pData, size_t dwSizeToCommitPart);
+    // Commit memory pages starting at the specified adress. For interleaved heaps, more code/data page pairs
+    // may be committed ahead, up to pEndReservedRegion.
+    BOOL CommitPages(void* pData, size_t dwSizeToCommitPart, BYTE* pEndReservedRegion);
 
 protected:
     // Reserve some pages at any address
@@ -451,6 +456,15 @@ public:
 protected:
     void *UnlockedAllocMemForCode_NoThrow(size_t dwHeaderSize, size_t dwCodeSize, DWORD dwCodeAlignment, size_t dwReserveForJumpStubs);
 
+    // Carves a raw run of zero-initialized bytes off the allocation pointer for a LoaderHeap
+    // per-thread allocation buffer. No debug boundary or validation tag is added; the individual
+    // allocations made from the run later carry their own.
+    void *UnlockedAllocThreadBuffer_NoThrow(size_t dwSize);
+
+    // Gives back the unused tail [pStart, pEnd) of a per-thread allocation buffer if nothing has
+    // been allocated behind it since, otherwise the tail is wasted.
+    void UnlockedReturnThreadBufferTail(BYTE *pStart, BYTE *pEnd);
+
     void UnlockedSetReservedRegion(BYTE* dwReservedRegionAddress, SIZE_T dwReservedRegionSize, BOOL fReleaseMemory);
 };
 
@@ -472,6 +486,13 @@ class LoaderHeap : public UnlockedLoaderHeap, public ILoaderHeapBackout
 private:
     CRITSEC_COOKIE    m_CriticalSection;
 
+    // Small allocations from a locked data heap are served from a per-thread bump pointer buffer
+    // carved from the heap, so the lock is only taken once per buffer refill. Per-thread buffers
+    // are keyed by this process-unique id rather than by the heap address, so that a buffer left
+    // behind by a destroyed heap can never be mistaken for one belonging to a new heap allocated
+    // at the same address. Zero if the heap does not use per-thread buffers.
+    UINT64            m_threadBufferHeapId;
+
 #ifndef DACCESS_COMPILE
 public:
     LoaderHeap(DWORD dwReserveBlockSize,
@@ -489,7 +510,8 @@ public:
                            kind,
                            codePageGenerator,
                            dwGranularity),
-        m_CriticalSection(fUnlocked ? NULL : CreateLoaderHeapLock())
+        m_CriticalSection(fUnlocked ? NULL : CreateLoaderHeapLock()),
+        m_threadBufferHeapId((fUnlocked || kind != UnlockedLoaderHeap::HeapKind::Data) ? 0 : GetNewThreadBufferHeapId())
     {
         WRAPPER_NO_CONTRACT;
         m_fExplicitControl = FALSE;
@@ -513,7 +535,8 @@ public:
                            pRangeList,
                            kind,
                            codePageGenerator, dwGranularity),
-        m_CriticalSection(fUnlocked ? NULL : CreateLoaderHeapLock())
+        m_CriticalSection(fUnlocked ? NULL : CreateLoaderHeapLock()),
+        m_threadBufferHeapId((fUnlocked || kind != UnlockedLoaderHeap::HeapKind::Data) ? 0 : GetNewThreadBufferHeapId())
     {
         WRAPPER_NO_CONTRACT;
         m_fExplicitControl = FALSE;
@@ -595,16 +618,24 @@ private:
     {
         WRAPPER_NO_CONTRACT;
 
-        void *pResult;
         TaggedMemAllocPtr tmap;
 
-        CRITSEC_Holder csh(m_CriticalSection);
-        pResult = UnlockedAllocMem(dwSize
+        void *pResult = TryAllocFromThreadBuffer(dwSize
 #ifdef _DEBUG
-                                 , szFile
-                                 , lineNum
+                                                 , szFile
+                                                 , lineNum
 #endif
-                                 );
+                                                 );
+        if (pResult == NULL)
+        {
+            CRITSEC_Holder csh(m_CriticalSection);
+            pResult = UnlockedAllocMem(dwSize
+#ifdef _DEBUG
+                                     , szFile
+                                     , lineNum
+#endif
+                                     );
+        }
         tmap.m_pMem             = pResult;
         tmap.m_dwRequestedSize  = dwSize;
         tmap.m_pHeap            = this;
@@ -626,17 +657,25 @@ private:
     {
         WRAPPER_NO_CONTRACT;
 
-        void *pResult;
         TaggedMemAllocPtr tmap;
 
-        CRITSEC_Holder csh(m_CriticalSection);
+        void *pResult = TryAllocFromThreadBuffer(dwSize
+#ifdef _DEBUG
+                                                 , szFile
+                                                 , lineNum
+#endif
+                                                 );
+        if (pResult == NULL)
+        {
+            CRITSEC_Holder csh(m_CriticalSection);
 
-        pResult = UnlockedAllocMem_NoThrow(dwSize
+            pResult = UnlockedAllocMem_NoThrow(dwSize
 #ifdef _DEBUG
-                                           , szFile
-                                           , lineNum
+                                               , szFile
+                                               , lineNum
 #endif
-                                           );
+                                               );
+        }
 
         tmap.m_pMem             = pResult;
         tmap.m_dwRequestedSize  = dwSize;
@@ -756,6 +795,10 @@ public:
                         )
     {
         WRAPPER_NO_CONTRACT;
+
+        if (TryBackoutToThreadBuffer(pMem, dwSize))
+            return;
+
         CRITSEC_Holder csh(m_CriticalSection);
         UnlockedBackoutMem(pMem
                            , dwSize
@@ -768,6 +811,25 @@ public:
                            );
     }
 
+private:
+    static UINT64 GetNewThreadBufferHeapId();
+
+    // Serves a small allocation from the current thread's buffer for this heap without taking
+    // the heap lock, refilling the buffer under the lock if needed. Returns NULL if the
+    // allocation is not eligible or could not be satisfied, in which case the caller falls back
+    // to the locked allocation path.
+    void *TryAllocFromThreadBuffer(size_t dwRequestedSize
+#ifdef _DEBUG
+                                   ,_In_ _In_z_ const char *szFile
+                                   ,int  lineNum
+#endif
+                                   );
+
+    // Backs out the most recent allocation made from the current thread's buffer by rolling the
+    // buffer back over it. Returns FALSE if pMem is not that allocation, in which case the caller
+    // must back it out through the locked path.
+    BOOL TryBackoutToThreadBuffer(void *pMem, size_t dwRequestedSize);
+
 public:
 // Extra CallTracing support
 #ifdef _DEBUG
@@ -274,6 +274,11 @@ public:
         unsigned maxBytesTotal, void* moduleBase, LPWSTR logFilename = nullptr);
     static void Terminate(BOOL fProcessDetach=FALSE);
     static void ThreadDetach();         // call at DllMain  THREAD_DETACH if you want to recycle thread logs
+
+    // Map a comma separated list of category names (e.g. "GC,JIT,ThreadPool,Suspension") to a facility
+    // mask. The names are stable across releases even if the LF_* bits behind them change. Returns 0 if
+    // none of the names are recognized.
+    static unsigned ParseFacilityNames(LPCWSTR names);
 #ifndef STRESS_LOG_ANALYZER
     static int NewChunk ()
     {
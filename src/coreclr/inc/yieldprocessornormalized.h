@@ -31,12 +31,20 @@ public:
     static const unsigned int MaxOptimalMaxNormalizedYieldsPerSpinIteration =
         TargetMaxNsPerSpinIteration * 3 / (TargetNsPerNormalizedYield * 2) + 1;
 
+    // Processors above this number use the process-wide normalization
+    static const unsigned int MaxNormalizedProcessorCount = 256;
+
 private:
     static bool s_isMeasurementScheduled;
 
     static unsigned int s_yieldsPerNormalizedYield;
     static unsigned int s_optimalMaxNormalizedYieldsPerSpinIteration;
 
+    // The latency of a yield can be very different between the types of cores of the same machine, so it is also
+    // normalized per processor. The values are packed as (optimalMaxNormalizedYieldsPerSpinIteration << 16) |
+    // yieldsPerNormalizedYield, 0 means the processor has not been measured yet.
+    static UINT32 s_normalizationByProcessor[MaxNormalizedProcessorCount];
+
 public:
     static bool IsMeasurementScheduled()
     {
@@ -47,6 +55,9 @@ public:
 
 private:
     static void ScheduleMeasurementIfNecessary();
+    static void GetNormalizationForCurrentProcessor(
+        unsigned int *yieldsPerNormalizedYieldRef,
+        unsigned int *optimalMaxNormalizedYieldsPerSpinIterationRef);
 
 public:
     static unsigned int GetOptimalMaxNormalizedYieldsPerSpinIteration()
@@ -76,10 +87,13 @@ private:
 public:
     YieldProcessorNormalizationInfo()
         : yieldsPerNormalizedYield(YieldProcessorNormalization::s_yieldsPerNormalizedYield),
-        optimalMaxNormalizedYieldsPerSpinIteration(YieldProcessorNormalization::s_optimalMaxNormalizedYieldsPerSpinIteration),
-        optimalMaxYieldsPerSpinIteration(yieldsPerNormalizedYield * optimalMaxNormalizedYieldsPerSpinIteration)
+        optimalMaxNormalizedYieldsPerSpinIteration(YieldProcessorNormalization::s_optimalMaxNormalizedYieldsPerSpinIteration)
     {
         YieldProcessorNormalization::ScheduleMeasurementIfNecessary();
+        YieldProcessorNormalization::GetNormalizationForCurrentProcessor(
+            &yieldsPerNormalizedYield,
+            &optimalMaxNormalizedYieldsPerSpinIteration);
+        optimalMaxYieldsPerSpinIteration = yieldsPerNormalizedYield * optimalMaxNormalizedYieldsPerSpinIteration;
     }
 
     DISABLE_COPY(YieldProcessorNormalizationInfo);
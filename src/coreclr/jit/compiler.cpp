@@ -4568,6 +4568,13 @@ void Compiler::compFunctionTraceEnd(void* methodCodePtr, ULONG methodCodeSize, b
 //
 void Compiler::BeginPhase(Phases phase)
 {
+#if defined(FEATURE_JIT_METHOD_PERF)
+    if (compTelemetryEnabled && (phase == PHASE_LINEAR_SCAN))
+    {
+        compTelemetryMark(TELEMETRY_MARK_LSRA_START);
+    }
+#endif
+
     mostRecentlyActivePhase = phase;
 }
 
@@ -4584,11 +4591,92 @@ void Compiler::EndPhase(Phases phase)
     {
         pCompJitTimer->EndPhase(this, phase);
     }
+
+    if (compTelemetryEnabled)
+    {
+        if (phase == PHASE_IMPORTATION)
+        {
+            compTelemetryMark(TELEMETRY_MARK_IMPORT_END);
+        }
+        else if (phase == PHASE_LINEAR_SCAN)
+        {
+            compTelemetryMark(TELEMETRY_MARK_LSRA_END);
+        }
+    }
 #endif
 
     mostRecentlyActivePhase = phase;
 }
 
+#if defined(FEATURE_JIT_METHOD_PERF)
+//------------------------------------------------------------------------
+// compTelemetryMark: record the cycle counter for a telemetry phase boundary
+//
+// Arguments:
+//    mark - the boundary that was just reached
+//
+// Notes:
+//    Telemetry is disabled for the rest of the method if the cycle counter
+//    cannot be read.
+//
+void Compiler::compTelemetryMark(TelemetryMark mark)
+{
+    if (compTelemetryEnabled && !_our_GetThreadCycles(&compTelemetryCycles[mark]))
+    {
+        compTelemetryEnabled = false;
+    }
+}
+
+//------------------------------------------------------------------------
+// compReportTelemetry: report the CORINFO_JIT_TELEMETRY summary of the
+//   method that was just compiled back to the EE.
+//
+// Notes:
+//    Unlike the JitTimer this is cheap enough to be on by default: it reads
+//    the cycle counter at a handful of phase boundaries and makes a single
+//    reportMetadata call per method. It is up to the EE to decide whether
+//    anybody is listening for the data.
+//
+void Compiler::compReportTelemetry()
+{
+    if (!compTelemetryEnabled)
+    {
+        return;
+    }
+
+    compTelemetryMark(TELEMETRY_MARK_EMIT_END);
+    if (!compTelemetryEnabled)
+    {
+        return;
+    }
+
+    const double cyclesPerMicrosecond = CachedCyclesPerSecond() / 1000000.0;
+
+    auto elapsed = [=](TelemetryMark from, TelemetryMark to) -> uint32_t {
+        const uint64_t fromCycles = compTelemetryCycles[from];
+        const uint64_t toCycles   = compTelemetryCycles[to];
+        if ((cyclesPerMicrosecond <= 0.0) || (fromCycles == 0) || (toCycles < fromCycles))
+        {
+            return 0;
+        }
+
+        return (uint32_t)min((double)UINT32_MAX, (toCycles - fromCycles) / cyclesPerMicrosecond);
+    };
+
+    CORINFO_JIT_TELEMETRY telemetry;
+    telemetry.ilCodeSize           = info.compILCodeSize;
+    telemetry.nativeCodeSize       = info.compTotalHotCodeSize + info.compTotalColdCodeSize;
+    telemetry.arenaBytes           = (uint64_t)compArenaAllocator->getTotalBytesAllocated();
+    telemetry.totalMicroseconds    = elapsed(TELEMETRY_MARK_START, TELEMETRY_MARK_EMIT_END);
+    telemetry.importMicroseconds   = elapsed(TELEMETRY_MARK_START, TELEMETRY_MARK_IMPORT_END);
+    telemetry.optimizeMicroseconds = elapsed(TELEMETRY_MARK_IMPORT_END, TELEMETRY_MARK_LSRA_START);
+    telemetry.lsraMicroseconds     = elapsed(TELEMETRY_MARK_LSRA_START, TELEMETRY_MARK_LSRA_END);
+    telemetry.codegenMicroseconds  = elapsed(TELEMETRY_MARK_LSRA_END, TELEMETRY_MARK_EMIT_END);
+
+    info.compCompHnd->reportMetadata(CORINFO_JIT_TELEMETRY_KEY, &telemetry, sizeof(telemetry));
+}
+#endif // FEATURE_JIT_METHOD_PERF
+
 //------------------------------------------------------------------------
 // compCompile: run phases needed for compilation
 //
@@ -5376,6 +5464,8 @@ void Compiler::compCompile(void** methodCodePtr, uint32_t* methodCodeSize, JitFl
 #endif
         pCompJitTimer->Terminate(this, CompTimeSummaryInfo::s_compTimeSummary, true);
     }
+
+    compReportTelemetry();
 #endif
 
     // Generate PatchpointInfo
@@ -6133,6 +6223,11 @@ int Compiler::compCompile(CORINFO_MODULE_HANDLE classPtr,
     {
         pCompJitTimer = JitTimer::Create(this, info.compMethodInfo->ILCodeSize);
     }
+
+    // Inlinee phases are accounted for as part of the root method's phases.
+    memset(compTelemetryCycles, 0, sizeof(compTelemetryCycles));
+    compTelemetryEnabled = !compIsForInlining() && (JitConfig.JitReportTelemetry() != 0);
+    compTelemetryMark(TELEMETRY_MARK_START);
 #endif // FEATURE_JIT_METHOD_PERF
 
 #ifdef DEBUG
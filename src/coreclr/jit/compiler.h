@@ -4562,7 +4562,9 @@ protected:
         GenTreeLclVarCommon* data, WCHAR* cns, int len, int dataOffset, StringComparison cmpMode);
     GenTree* impExpandHalfConstEqualsSIMD(
         GenTreeLclVarCommon* data, WCHAR* cns, int len, int dataOffset, StringComparison cmpMode);
-    GenTreeStrCon* impGetStrConFromSpan(GenTree* span);
+    bool     impIsConstUtf16String(GenTree* node);
+    int      impGetConstUtf16String(GenTree* node, char16_t* str, int maxLength);
+    GenTree* impGetStrConFromSpan(GenTree* span);
 
     GenTree* impIntrinsic(CORINFO_CLASS_HANDLE    clsHnd,
                           CORINFO_METHOD_HANDLE   method,
@@ -5266,6 +5268,8 @@ public:
 
     bool fgHasSwitch; // any BBJ_SWITCH jumps?
 
+    bool fgGCPollLoops; // poll on back edges instead of making the method fully interruptible?
+
     bool fgRemoveRestOfBlock; // true if we know that we will throw
     bool fgStmtRemoved;       // true if we remove statements -> need new DFA
 
@@ -5955,6 +5959,7 @@ public:
     bool fgLateCastExpansionForCall(BasicBlock** pBlock, Statement* stmt, GenTreeCall* call);
 
     PhaseStatus fgInsertGCPolls();
+    bool        fgMarkLoopGCPolls();
     BasicBlock* fgCreateGCPoll(GCPollType pollType, BasicBlock* block);
 
 public:
@@ -6147,6 +6152,7 @@ public:
     bool fgReorderBlocks(bool useProfile);
     void fgDoReversePostOrderLayout();
     void fgMoveColdBlocks();
+    void fgSearchImprovedLayout();
 
     template <bool hasEH>
     void fgMoveHotJumps();
@@ -7452,9 +7458,16 @@ public:
                 return 3;
             }
 
+            // With Dynamic PGO we have class histograms for virtual and interface call-sites, so more
+            // guesses can be allowed for polymorphic sites (JitGuardedDevirtualizationDynamicPgoMaxTypeChecks).
             // We plan to use 3 for CoreCLR too, but we need to make sure it doesn't regress performance
             // as CoreCLR heavily relies on Dynamic PGO while for NativeAOT we *usually* don't have it and
             // can only perform the "exact" devirtualization.
+            if ((fgPgoSource == ICorJitInfo::PgoSource::Dynamic) && !opts.jitFlags->IsSet(JitFlags::JIT_FLAG_SIZE_OPT))
+            {
+                return max(1, min(MAX_GDV_TYPE_CHECKS, JitConfig.JitGuardedDevirtualizationDynamicPgoMaxTypeChecks()));
+            }
+
             return 1;
         }
 
@@ -7556,6 +7569,13 @@ public:
 
     PhaseStatus optInductionVariables();
 
+    Scev* optDistributeIndexExtensions(ScalarEvolutionContext& scevContext, Scev* scev);
+    bool  optReplaceFillLoopWithBlockInit(ScalarEvolutionContext& scevContext,
+                                          FlowGraphNaturalLoop*   loop,
+                                          LoopLocalOccurrences*   loopLocals);
+
+    bool optRemoveLoopBoundsChecks(ScalarEvolutionContext& scevContext, FlowGraphNaturalLoop* loop);
+
     bool optMakeLoopDownwardsCounted(ScalarEvolutionContext& scevContext,
                                      FlowGraphNaturalLoop*   loop,
                                      LoopLocalOccurrences*   loopLocals);
@@ -11202,6 +11222,24 @@ private:
 
     static LPCWSTR JitTimeLogCsv();        // Retrieve the file name for CSV from ConfigDWORD.
     static LPCWSTR compJitTimeLogFilename; // If a log file for JIT time is desired, filename to write it to.
+
+    // Cycle counter readings at a few phase boundaries, used to build the
+    // CORINFO_JIT_TELEMETRY summary reported to the EE at the end of compilation.
+    enum TelemetryMark
+    {
+        TELEMETRY_MARK_START,
+        TELEMETRY_MARK_IMPORT_END,
+        TELEMETRY_MARK_LSRA_START,
+        TELEMETRY_MARK_LSRA_END,
+        TELEMETRY_MARK_EMIT_END,
+        TELEMETRY_MARK_COUNT
+    };
+
+    bool     compTelemetryEnabled;
+    uint64_t compTelemetryCycles[TELEMETRY_MARK_COUNT];
+
+    void compTelemetryMark(TelemetryMark mark);
+    void compReportTelemetry();
 #endif
     void BeginPhase(Phases phase); // Indicate the start of the given phase.
     void EndPhase(Phases phase);   // Indicate the end of the given phase.
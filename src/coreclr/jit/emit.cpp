@@ -4883,6 +4883,23 @@ void emitter::emitJumpDistBind()
 
     int jmp_iteration = 1;
 
+    // Once every jump is bound, later iterations only need to revisit the jumps
+    // that can still shrink, along with any other jumps in their groups (so their
+    // group-relative offsets keep being adjusted). This is null on the first pass.
+    instrDescJmp** pendingJumps     = nullptr;
+    unsigned       pendingJumpCount = 0;
+    unsigned       pendingJumpIndex = 0;
+
+    auto getNextJump = [&](instrDescJmp* current) -> instrDescJmp* {
+        if (pendingJumps == nullptr)
+        {
+            return current->idjNext;
+        }
+
+        pendingJumpIndex++;
+        return (pendingJumpIndex < pendingJumpCount) ? pendingJumps[pendingJumpIndex] : nullptr;
+    };
+
     /*****************************************************************************/
     /* If we iterate to look for more jumps to shorten, we start again here.     */
     /*****************************************************************************/
@@ -4903,16 +4920,23 @@ AGAIN:
     instrDescJmp* lastLJ = nullptr;
 #endif
 
-    lstIG         = nullptr;
-    adjLJ         = 0;
-    adjIG         = 0;
-    minShortExtra = (UNATIVE_OFFSET)-1;
+    lstIG            = nullptr;
+    adjLJ            = 0;
+    adjIG            = 0;
+    minShortExtra    = (UNATIVE_OFFSET)-1;
+    pendingJumpIndex = 0;
 
 #if defined(TARGET_ARM)
     minMediumExtra = (UNATIVE_OFFSET)-1;
 #endif // TARGET_ARM
 
-    for (jmp = emitJumpList; jmp; jmp = jmp->idjNext)
+    jmp = emitJumpList;
+    if (pendingJumps != nullptr)
+    {
+        jmp = (pendingJumpCount > 0) ? pendingJumps[0] : nullptr;
+    }
+
+    for (; jmp != nullptr; jmp = getNextJump(jmp))
     {
         insGroup* jmpIG;
         insGroup* tgtIG;
@@ -5593,6 +5617,51 @@ AGAIN:
             }
 #endif
 
+            if (pendingJumps == nullptr)
+            {
+                for (jmp = emitJumpList; jmp != nullptr; jmp = jmp->idjNext)
+                {
+                    pendingJumpCount++;
+                }
+
+                pendingJumps = emitComp->getAllocator(CMK_InstDesc).allocate<instrDescJmp*>(pendingJumpCount);
+
+                unsigned index = 0;
+                for (jmp = emitJumpList; jmp != nullptr; jmp = jmp->idjNext)
+                {
+                    pendingJumps[index++] = jmp;
+                }
+            }
+
+            // Drop the groups whose jumps are all short or must stay long; nothing in them
+            // can change size anymore. The jumps of a group are contiguous in the list.
+            unsigned newPendingJumpCount = 0;
+            for (unsigned groupStart = 0; groupStart < pendingJumpCount;)
+            {
+                insGroup* group     = pendingJumps[groupStart]->idjIG;
+                unsigned  groupEnd  = groupStart;
+                bool      canShrink = false;
+
+                while ((groupEnd < pendingJumpCount) && (pendingJumps[groupEnd]->idjIG == group))
+                {
+                    canShrink |= !pendingJumps[groupEnd]->idjShort && !pendingJumps[groupEnd]->idjKeepLong;
+                    groupEnd++;
+                }
+
+                if (canShrink)
+                {
+                    for (unsigned i = groupStart; i < groupEnd; i++)
+                    {
+                        pendingJumps[newPendingJumpCount++] = pendingJumps[i];
+                    }
+                }
+
+                groupStart = groupEnd;
+            }
+
+            JITDUMP("Revisiting %u of the jumps\n", newPendingJumpCount);
+            pendingJumpCount = newPendingJumpCount;
+
             goto AGAIN;
         }
     }
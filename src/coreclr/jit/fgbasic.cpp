@@ -152,6 +152,7 @@ void Compiler::fgInit()
 #endif
 
     fgHasSwitch                  = false;
+    fgGCPollLoops                = false;
     fgPgoDisabled                = false;
     fgPgoSchema                  = nullptr;
     fgPgoData                    = nullptr;
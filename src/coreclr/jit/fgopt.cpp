@@ -3251,6 +3251,11 @@ bool Compiler::fgReorderBlocks(bool useProfile)
             fgDoReversePostOrderLayout();
             fgMoveColdBlocks();
 
+            if ((compHndBBtabCount == 0) && (JitConfig.JitDoImprovedLayoutSearch() != 0))
+            {
+                fgSearchImprovedLayout();
+            }
+
             // Renumber blocks to facilitate LSRA's order of block visitation
             // TODO: Consider removing this, and using traversal order in lSRA
             //
@@ -4759,6 +4764,220 @@ void Compiler::fgDoReversePostOrderLayout()
     }
 }
 
+//-----------------------------------------------------------------------------
+// fgSearchImprovedLayout: Refine the RPO-based layout of the hot blocks with a 3-opt search
+// that maximizes the profile weight of the edges that become fallthroughs.
+//
+// Notes:
+//    Only used for methods without EH regions, after cold blocks have been moved to the end
+//    of the method, so the search only considers the hot prefix of the block list.
+//    Each move partitions the hot blocks into [S1 S2 S3 S4] and reorders them into [S1 S3 S2 S4],
+//    which only changes three adjacencies, so its gain is cheap to evaluate.
+//    Candidate edges are visited hottest first, and JitImprovedLayoutSearchBudget bounds the number
+//    of candidates evaluated to keep the throughput cost in check.
+//
+void Compiler::fgSearchImprovedLayout()
+{
+#ifdef DEBUG
+    if (verbose)
+    {
+        printf("*************** In fgSearchImprovedLayout()\n");
+
+        printf("\nInitial BasicBlocks");
+        fgDispBasicBlocks(verboseTrees);
+        printf("\n");
+    }
+#endif // DEBUG
+
+    assert(compHndBBtabCount == 0);
+
+    unsigned hotBlockCount = 0;
+    for (BasicBlock* const block : Blocks())
+    {
+        if (!block->IsFirst() && block->isBBWeightCold(this))
+        {
+            break;
+        }
+
+        hotBlockCount++;
+    }
+
+    // There is nothing to gain with fewer than three blocks, as the first block cannot move
+    //
+    if (hotBlockCount < 3)
+    {
+        return;
+    }
+
+    BasicBlock** const blockOrder = new (this, CMK_BasicBlock) BasicBlock*[hotBlockCount];
+    BasicBlock** const tempOrder  = new (this, CMK_BasicBlock) BasicBlock*[hotBlockCount];
+    unsigned* const    ordinals   = new (this, CMK_BasicBlock) unsigned[fgBBNumMax + 1];
+
+    for (unsigned i = 0; i <= fgBBNumMax; i++)
+    {
+        ordinals[i] = UINT_MAX;
+    }
+
+    unsigned candidateCount = 0;
+    unsigned position       = 0;
+    for (BasicBlock* block = fgFirstBB; position < hotBlockCount; block = block->Next())
+    {
+        ordinals[block->bbNum] = position;
+        blockOrder[position++] = block;
+        candidateCount += block->NumSucc();
+    }
+
+    // Collect the edges between hot blocks that could become fallthroughs, hottest first
+    //
+    FlowEdge** const candidates = new (this, CMK_BasicBlock) FlowEdge*[candidateCount];
+    candidateCount              = 0;
+    for (unsigned i = 0; i < hotBlockCount; i++)
+    {
+        for (FlowEdge* const edge : blockOrder[i]->SuccEdges())
+        {
+            BasicBlock* const target = edge->getDestinationBlock();
+            if ((ordinals[target->bbNum] != UINT_MAX) && !target->IsFirst() && (target != blockOrder[i]) &&
+                (edge->getLikelyWeight() > BB_ZERO_WEIGHT))
+            {
+                candidates[candidateCount++] = edge;
+            }
+        }
+    }
+
+    jitstd::sort(candidates, candidates + candidateCount, [](FlowEdge* left, FlowEdge* right) {
+        return left->getLikelyWeight() > right->getLikelyWeight();
+    });
+
+    // Weight of the flow from 'source' to 'target' if 'target' is placed right after 'source'
+    //
+    auto fallthroughWeight = [](BasicBlock* source, BasicBlock* target) -> weight_t {
+        weight_t weight = BB_ZERO_WEIGHT;
+        for (FlowEdge* const edge : source->SuccEdges())
+        {
+            if (edge->getDestinationBlock() == target)
+            {
+                weight += edge->getLikelyWeight();
+            }
+        }
+        return weight;
+    };
+
+    // Gain of reordering [S1 S2 S3 S4] into [S1 S3 S2 S4], with S2 = [s2Start, s3Start) and S3 = [s3Start, s3End]
+    //
+    auto moveGain = [&](unsigned s2Start, unsigned s3Start, unsigned s3End) -> weight_t {
+        assert((0 < s2Start) && (s2Start < s3Start) && (s3Start <= s3End) && (s3End < hotBlockCount));
+
+        BasicBlock* const s1Last  = blockOrder[s2Start - 1];
+        BasicBlock* const s2First = blockOrder[s2Start];
+        BasicBlock* const s2Last  = blockOrder[s3Start - 1];
+        BasicBlock* const s3First = blockOrder[s3Start];
+        BasicBlock* const s3Last  = blockOrder[s3End];
+        BasicBlock* const s4First = (s3End + 1 < hotBlockCount) ? blockOrder[s3End + 1] : nullptr;
+
+        weight_t oldWeight = fallthroughWeight(s1Last, s2First) + fallthroughWeight(s2Last, s3First);
+        weight_t newWeight = fallthroughWeight(s1Last, s3First) + fallthroughWeight(s3Last, s2First);
+
+        if (s4First != nullptr)
+        {
+            oldWeight += fallthroughWeight(s3Last, s4First);
+            newWeight += fallthroughWeight(s2Last, s4First);
+        }
+
+        return newWeight - oldWeight;
+    };
+
+    auto applyMove = [&](unsigned s2Start, unsigned s3Start, unsigned s3End) {
+        JITDUMP("Moving " FMT_BB "-" FMT_BB " before " FMT_BB "\n", blockOrder[s3Start]->bbNum,
+                blockOrder[s3End]->bbNum, blockOrder[s2Start]->bbNum);
+
+        const unsigned s3Count = s3End - s3Start + 1;
+        const unsigned s2Count = s3Start - s2Start;
+        memcpy(tempOrder, blockOrder + s3Start, s3Count * sizeof(BasicBlock*));
+        memcpy(tempOrder + s3Count, blockOrder + s2Start, s2Count * sizeof(BasicBlock*));
+        memcpy(blockOrder + s2Start, tempOrder, (s2Count + s3Count) * sizeof(BasicBlock*));
+
+        for (unsigned i = s2Start; i <= s3End; i++)
+        {
+            ordinals[blockOrder[i]->bbNum] = i;
+        }
+    };
+
+    unsigned budget = (unsigned)JitConfig.JitImprovedLayoutSearchBudget();
+    bool     improved;
+
+    do
+    {
+        improved = false;
+
+        for (unsigned i = 0; (i < candidateCount) && (budget > 0); i++)
+        {
+            FlowEdge* const edge      = candidates[i];
+            const unsigned  sourcePos = ordinals[edge->getSourceBlock()->bbNum];
+            const unsigned  targetPos = ordinals[edge->getDestinationBlock()->bbNum];
+
+            if (targetPos == sourcePos + 1)
+            {
+                continue;
+            }
+
+            budget--;
+
+            // Consider the two moves that make the target fall through from the source:
+            // for a forward edge, move the target alone or the target and everything after it up
+            // to the source, and for a backward edge, move the source alone or everything from
+            // the target's successor up to the source back before the target.
+            //
+            unsigned s2Start, s3Start, s3End;
+            unsigned altS3Start, altS3End;
+
+            if (targetPos > sourcePos)
+            {
+                s2Start    = sourcePos + 1;
+                s3Start    = targetPos;
+                s3End      = targetPos;
+                altS3Start = targetPos;
+                altS3End   = hotBlockCount - 1;
+            }
+            else
+            {
+                assert(targetPos > 0);
+                s2Start    = targetPos;
+                s3Start    = sourcePos;
+                s3End      = sourcePos;
+                altS3Start = targetPos + 1;
+                altS3End   = sourcePos;
+            }
+
+            weight_t gain    = moveGain(s2Start, s3Start, s3End);
+            weight_t altGain = moveGain(s2Start, altS3Start, altS3End);
+
+            if (altGain > gain)
+            {
+                gain    = altGain;
+                s3Start = altS3Start;
+                s3End   = altS3End;
+            }
+
+            if (gain > BB_ZERO_WEIGHT)
+            {
+                applyMove(s2Start, s3Start, s3End);
+                improved = true;
+            }
+        }
+    } while (improved && (budget > 0));
+
+    // Commit the new order to the block list
+    //
+    for (unsigned i = 1; i < hotBlockCount; i++)
+    {
+        if (!blockOrder[i - 1]->NextIs(blockOrder[i]))
+        {
+            fgUnlinkBlock(blockOrder[i]);
+            fgInsertBBafter(blockOrder[i - 1], blockOrder[i]);
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // fgMoveColdBlocks: Move rarely-run blocks to the end of their respective regions.
 //
@@ -61,6 +61,9 @@ static bool blockNeedsGCPoll(BasicBlock* block)
 //    find the basic blocks that require GC polls; when optimizing the tree nodes
 //    are scanned to find calls to methods with SuppressGCTransitionAttribute.
 //
+//    With JitGCPollLoops, this also polls on the back edges of loops that would
+//    otherwise make the method fully interruptible, see fgMarkLoopGCPolls.
+//
 //    This must be done after any transformations that would add control flow between
 //    calls.
 //
@@ -76,6 +79,12 @@ PhaseStatus Compiler::fgInsertGCPolls()
         return result;
     }
 
+    if (fgGCPollLoops && !fgMarkLoopGCPolls())
+    {
+        JITDUMP("Can't poll on every back edge, marking method as fully interruptible\n");
+        SetInterruptible(true);
+    }
+
     bool createdPollBlocks = false;
 
     // Walk through the blocks and hunt for a block that needs a GC Poll
@@ -161,6 +170,81 @@ PhaseStatus Compiler::fgInsertGCPolls()
     return result;
 }
 
+//------------------------------------------------------------------------------
+// fgMarkLoopGCPolls : Mark the blocks that need a GC poll so that every cycle in
+//                     the flow graph goes through a GC safe point.
+//
+// Returns:
+//    True if all the blocks could be marked; false if some cycle can only be
+//    broken by making the method fully interruptible, in which case no blocks
+//    are marked.
+//
+// Notes:
+//    Used instead of full interruptibility for methods with loops that have no
+//    calls when JitGCPollLoops is set. Every cycle contains an edge that does not
+//    go to a block with a higher bbNum, so polling in the source of each such
+//    edge breaks them all. This is done late, after the loop optimizations, so
+//    that the polls don't get in their way and the block flags can't be lost.
+//
+bool Compiler::fgMarkLoopGCPolls()
+{
+    assert(fgGCPollLoops);
+    assert(opts.OptimizationEnabled());
+
+    ArrayStack<BasicBlock*> pollBlocks(getAllocator(CMK_ArrayStack));
+
+    for (BasicBlock* const block : Blocks())
+    {
+        if (block->HasAnyFlag(BBF_GC_SAFE_POINT | BBF_NEEDS_GCPOLL))
+        {
+            continue;
+        }
+
+        bool     hasBackEdge = false;
+        unsigned numSuccs    = 0;
+        block->VisitRegularSuccs(this, [block, &hasBackEdge, &numSuccs](BasicBlock* succ) {
+            numSuccs++;
+            if ((succ->bbNum <= block->bbNum) && !succ->HasFlag(BBF_GC_SAFE_POINT))
+            {
+                hasBackEdge = true;
+                return BasicBlockVisit::Abort;
+            }
+
+            return BasicBlockVisit::Continue;
+        });
+
+        if (!hasBackEdge)
+        {
+            // fgHasCycleWithoutGCSafePoint models a tail call as an edge back to the entry,
+            // leave those to full interruptibility.
+            if ((numSuccs == 0) && block->endsWithTailCallOrJmp(this, true) &&
+                !fgFirstBB->HasFlag(BBF_GC_SAFE_POINT))
+            {
+                return false;
+            }
+
+            continue;
+        }
+
+        if (!block->KindIs(BBJ_ALWAYS, BBJ_COND, BBJ_SWITCH) || block->HasFlag(BBF_HAS_JMP))
+        {
+            JITDUMP("Can't poll on the back edge from " FMT_BB "\n", block->bbNum);
+            return false;
+        }
+
+        pollBlocks.Push(block);
+    }
+
+    for (int i = 0; i < pollBlocks.Height(); i++)
+    {
+        BasicBlock* const block = pollBlocks.Bottom(i);
+        JITDUMP("Marking " FMT_BB " as needs gc poll for its back edge\n", block->bbNum);
+        block->SetFlags(BBF_NEEDS_GCPOLL);
+    }
+
+    return true;
+}
+
 //------------------------------------------------------------------------------
 // fgCreateGCPoll : Insert a GC poll of the specified type for the given basic block.
 //
@@ -3729,8 +3813,20 @@ PhaseStatus Compiler::fgSetBlockOrder()
 
     if (compCanEncodePtrArgCntMax() && fgHasCycleWithoutGCSafePoint())
     {
-        JITDUMP("Marking method as fully interruptible\n");
-        SetInterruptible(true);
+        if (opts.OptimizationEnabled() && !opts.compDbgCode && (JitConfig.JitGCPollLoops() != 0))
+        {
+            // Keep the method partially interruptible and poll on the back edges instead. The
+            // polls are placed by fgInsertGCPolls, which falls back to full interruptibility
+            // if some back edge can't get one.
+            JITDUMP("Method has a cycle without a GC safe point, will poll on its back edges\n");
+            fgGCPollLoops = true;
+            optMethodFlags |= OMF_NEEDS_GCPOLLS;
+        }
+        else
+        {
+            JITDUMP("Marking method as fully interruptible\n");
+            SetInterruptible(true);
+        }
     }
 
     for (BasicBlock* const block : Blocks())
@@ -840,6 +840,11 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
     JITDUMP("offsetOfMaxThreadStaticBlocks= %u\n", dspOffset(threadStaticBlocksInfo.offsetOfMaxThreadStaticBlocks));
     JITDUMP("offsetOfThreadStaticBlocks= %u\n", dspOffset(threadStaticBlocksInfo.offsetOfThreadStaticBlocks));
     JITDUMP("offsetOfBaseOfThreadLocalData= %u\n", dspOffset(threadStaticBlocksInfo.offsetOfBaseOfThreadLocalData));
+    JITDUMP("offsetOfMaxCollectibleThreadStaticBlocks= %u\n",
+            dspOffset(threadStaticBlocksInfo.offsetOfMaxCollectibleThreadStaticBlocks));
+    JITDUMP("offsetOfCollectibleThreadStaticBlocks= %u\n",
+            dspOffset(threadStaticBlocksInfo.offsetOfCollectibleThreadStaticBlocks));
+    JITDUMP("collectibleTypeIndexFlag= 0x%x\n", threadStaticBlocksInfo.collectibleTypeIndexFlag);
 
     assert(call->gtArgs.CountArgs() == 1);
 
@@ -1037,9 +1042,28 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
     }
     else
     {
+        // Thread statics of collectible types are stored in a separate native array of handles to the
+        // static blocks. The type index has collectibleTypeIndexFlag set for them, which is kept for
+        // the helper call but stripped to index the array.
+        const bool isCollectible = (threadStaticBlocksInfo.collectibleTypeIndexFlag != 0) &&
+                                   typeThreadStaticBlockIndexValue->IsIntegralConst() &&
+                                   ((typeThreadStaticBlockIndexValue->AsIntConCommon()->IconValue() &
+                                     threadStaticBlocksInfo.collectibleTypeIndexFlag) != 0);
+
         size_t offsetOfThreadStaticBlocksVal    = threadStaticBlocksInfo.offsetOfThreadStaticBlocks;
         size_t offsetOfMaxThreadStaticBlocksVal = threadStaticBlocksInfo.offsetOfMaxThreadStaticBlocks;
 
+        if (isCollectible)
+        {
+            JITDUMP("Collectible thread static block index\n");
+            offsetOfThreadStaticBlocksVal    = threadStaticBlocksInfo.offsetOfCollectibleThreadStaticBlocks;
+            offsetOfMaxThreadStaticBlocksVal = threadStaticBlocksInfo.offsetOfMaxCollectibleThreadStaticBlocks;
+            typeThreadStaticBlockIndexValue =
+                gtNewIconNode(typeThreadStaticBlockIndexValue->AsIntConCommon()->IconValue() &
+                                  ~(ssize_t)threadStaticBlocksInfo.collectibleTypeIndexFlag,
+                              TYP_INT);
+        }
+
         // Create tree for "maxThreadStaticBlocks = tls[offsetOfMaxThreadStaticBlocks]"
         GenTree* offsetOfMaxThreadStaticBlocks = gtNewIconNode(offsetOfMaxThreadStaticBlocksVal, TYP_I_IMPL);
         GenTree* maxThreadStaticBlocksRef =
@@ -1049,7 +1073,8 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
 
         GenTree* threadStaticBlocksRef = gtNewOperNode(GT_ADD, TYP_I_IMPL, gtCloneExpr(tlsLclValueUse),
                                                        gtNewIconNode(offsetOfThreadStaticBlocksVal, TYP_I_IMPL));
-        threadStaticBlocksValue = gtNewIndir(TYP_REF, threadStaticBlocksRef, GTF_IND_NONFAULTING | GTF_IND_INVARIANT);
+        threadStaticBlocksValue = gtNewIndir(isCollectible ? TYP_I_IMPL : TYP_REF, threadStaticBlocksRef,
+                                             GTF_IND_NONFAULTING | GTF_IND_INVARIANT);
 
         // Create tree for "if (maxThreadStaticBlocks < typeIndex)"
         GenTree* maxThreadStaticBlocksCond =
@@ -1060,8 +1085,37 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
         typeThreadStaticBlockIndexValue = gtNewOperNode(GT_MUL, TYP_INT, gtCloneExpr(typeThreadStaticBlockIndexValue),
                                                         gtNewIconNode(TARGET_POINTER_SIZE, TYP_INT));
         GenTree* typeThreadStaticBlockRef =
-            gtNewOperNode(GT_ADD, TYP_BYREF, threadStaticBlocksValue, typeThreadStaticBlockIndexValue);
-        GenTree* typeThreadStaticBlockValue = gtNewIndir(TYP_BYREF, typeThreadStaticBlockRef, GTF_IND_NONFAULTING);
+            gtNewOperNode(GT_ADD, isCollectible ? TYP_I_IMPL : TYP_BYREF, threadStaticBlocksValue,
+                          typeThreadStaticBlockIndexValue);
+
+        GenTree*       typeThreadStaticBlockValue         = nullptr;
+        GenTree*       threadStaticBlockHandleDef         = nullptr;
+        GenTree*       threadStaticBlockHandleCond        = nullptr;
+        GenTreeLclVar* threadStaticBlockHandleLclValueUse = nullptr;
+
+        if (isCollectible)
+        {
+            // Create tree to "threadStaticBlockHandle = threadStaticBlockBase[typeIndex]" and
+            // "if (threadStaticBlockHandle == nullptr)"
+            unsigned threadStaticBlockHandleLclNum = lvaGrabTemp(true DEBUGARG("ThreadStaticBlockHandle access"));
+            lvaTable[threadStaticBlockHandleLclNum].lvType = TYP_I_IMPL;
+
+            GenTree* handleValue = gtNewIndir(TYP_I_IMPL, typeThreadStaticBlockRef, GTF_IND_NONFAULTING);
+            threadStaticBlockHandleDef         = gtNewStoreLclVarNode(threadStaticBlockHandleLclNum, handleValue);
+            threadStaticBlockHandleLclValueUse = gtNewLclVarNode(threadStaticBlockHandleLclNum);
+
+            threadStaticBlockHandleCond =
+                gtNewOperNode(GT_EQ, TYP_INT, threadStaticBlockHandleLclValueUse, gtNewIconNode(0, TYP_I_IMPL));
+            threadStaticBlockHandleCond = gtNewOperNode(GT_JTRUE, TYP_VOID, threadStaticBlockHandleCond);
+
+            // The static block is the target of the handle
+            typeThreadStaticBlockValue =
+                gtNewIndir(TYP_BYREF, gtCloneExpr(threadStaticBlockHandleLclValueUse), GTF_IND_NONFAULTING);
+        }
+        else
+        {
+            typeThreadStaticBlockValue = gtNewIndir(TYP_BYREF, typeThreadStaticBlockRef, GTF_IND_NONFAULTING);
+        }
 
         // Cache the threadStaticBlock value
         unsigned threadStaticBlockBaseLclNum         = lvaGrabTemp(true DEBUGARG("ThreadStaticBlockBase access"));
@@ -1083,8 +1137,14 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
         //      if (maxThreadStaticBlocks <= typeIndex)
         //          goto fallbackBb;
         //
+        // threadStaticBlockHandleCondBB (BBJ_COND):                        [weight: 1.0]
+        //      (only for collectible types)
+        //      handle = t_collectibleThreadStaticBlocks[typeIndex]
+        //      if (handle == nullptr)
+        //          goto fallbackBb;
+        //
         // threadStaticBlockNullCondBB (BBJ_COND):                          [weight: 1.0]
-        //      fastPathValue = t_threadStaticBlocks[typeIndex]
+        //      fastPathValue = t_threadStaticBlocks[typeIndex] (*handle for collectible types)
         //      if (fastPathValue != nullptr)
         //          goto fastPathBb;
         //
@@ -1107,9 +1167,19 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
         fgInsertStmtAfter(maxThreadStaticBlocksCondBB, maxThreadStaticBlocksCondBB->firstStmt(),
                           fgNewStmtFromTree(maxThreadStaticBlocksCond));
 
+        BasicBlock* threadStaticBlockHandleCondBB = nullptr;
+        if (isCollectible)
+        {
+            threadStaticBlockHandleCondBB =
+                fgNewBBFromTreeAfter(BBJ_COND, maxThreadStaticBlocksCondBB, threadStaticBlockHandleDef, debugInfo);
+            fgInsertStmtAfter(threadStaticBlockHandleCondBB, threadStaticBlockHandleCondBB->firstStmt(),
+                              fgNewStmtFromTree(threadStaticBlockHandleCond));
+        }
+
         // Similarly, set threadStaticBlockNulLCondBB to jump to fastPathBb once the latter exists.
         BasicBlock* threadStaticBlockNullCondBB =
-            fgNewBBFromTreeAfter(BBJ_COND, maxThreadStaticBlocksCondBB, threadStaticBlockBaseDef, debugInfo);
+            fgNewBBFromTreeAfter(BBJ_COND, isCollectible ? threadStaticBlockHandleCondBB : maxThreadStaticBlocksCondBB,
+                                 threadStaticBlockBaseDef, debugInfo);
         fgInsertStmtAfter(threadStaticBlockNullCondBB, threadStaticBlockNullCondBB->firstStmt(),
                           fgNewStmtFromTree(threadStaticBlockNullCond));
 
@@ -1129,14 +1199,25 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
         fgRedirectTargetEdge(prevBb, maxThreadStaticBlocksCondBB);
 
         {
-            FlowEdge* const trueEdge  = fgAddRefPred(fallbackBb, maxThreadStaticBlocksCondBB);
-            FlowEdge* const falseEdge = fgAddRefPred(threadStaticBlockNullCondBB, maxThreadStaticBlocksCondBB);
+            BasicBlock* const nextBb    = isCollectible ? threadStaticBlockHandleCondBB : threadStaticBlockNullCondBB;
+            FlowEdge* const   trueEdge  = fgAddRefPred(fallbackBb, maxThreadStaticBlocksCondBB);
+            FlowEdge* const   falseEdge = fgAddRefPred(nextBb, maxThreadStaticBlocksCondBB);
             maxThreadStaticBlocksCondBB->SetTrueEdge(trueEdge);
             maxThreadStaticBlocksCondBB->SetFalseEdge(falseEdge);
             trueEdge->setLikelihood(0.0);
             falseEdge->setLikelihood(1.0);
         }
 
+        if (isCollectible)
+        {
+            FlowEdge* const trueEdge  = fgAddRefPred(fallbackBb, threadStaticBlockHandleCondBB);
+            FlowEdge* const falseEdge = fgAddRefPred(threadStaticBlockNullCondBB, threadStaticBlockHandleCondBB);
+            threadStaticBlockHandleCondBB->SetTrueEdge(trueEdge);
+            threadStaticBlockHandleCondBB->SetFalseEdge(falseEdge);
+            trueEdge->setLikelihood(0.0);
+            falseEdge->setLikelihood(1.0);
+        }
+
         {
             FlowEdge* const trueEdge  = fgAddRefPred(fastPathBb, threadStaticBlockNullCondBB);
             FlowEdge* const falseEdge = fgAddRefPred(fallbackBb, threadStaticBlockNullCondBB);
@@ -1159,6 +1240,10 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
         // Inherit the weights
         block->inheritWeight(prevBb);
         maxThreadStaticBlocksCondBB->inheritWeight(prevBb);
+        if (isCollectible)
+        {
+            threadStaticBlockHandleCondBB->inheritWeight(prevBb);
+        }
         threadStaticBlockNullCondBB->inheritWeight(prevBb);
         fastPathBb->inheritWeight(prevBb);
 
@@ -1168,6 +1253,7 @@ bool Compiler::fgExpandThreadLocalAccessForCall(BasicBlock** pBlock, Statement*
         // All blocks are expected to be in the same EH region
         assert(BasicBlock::sameEHRegion(prevBb, block));
         assert(BasicBlock::sameEHRegion(prevBb, maxThreadStaticBlocksCondBB));
+        assert(!isCollectible || BasicBlock::sameEHRegion(prevBb, threadStaticBlockHandleCondBB));
         assert(BasicBlock::sameEHRegion(prevBb, threadStaticBlockNullCondBB));
         assert(BasicBlock::sameEHRegion(prevBb, fastPathBb));
     }
@@ -9441,14 +9441,18 @@ void Compiler::impImportBlockCode(BasicBlock* block)
                 op2 = impImplicitIorI4Cast(op2, TYP_I_IMPL);
 
                 bool isFrozenAllocator = false;
-                // If we're jitting a static constructor and detect the following code pattern:
+                // If we're jitting a static constructor and detect one of the following code patterns:
                 //
-                //  newarr
-                //  stsfld
-                //  ret
+                //  newarr                  newarr
+                //  stsfld                  dup
+                //                          ldtoken
+                //                          call RuntimeHelpers.InitializeArray
+                //                          stsfld
                 //
-                // we emit a "frozen" allocator for newarr to, hopefully, allocate that array on a frozen segment.
-                // This is a very simple and conservative implementation targeting Array.Empty<T>()'s shape
+                // i.e. a new array, optionally initialized from a data blob, stored straight into a
+                // "static readonly" field, we emit a "frozen" allocator for newarr to, hopefully, allocate
+                // that array on a frozen segment. This covers Array.Empty<T>()'s shape as well as readonly
+                // lookup tables built at startup, which the GC then never has to mark or move.
                 // Ideally, we want to be able to use frozen allocators more broadly, but such an analysis is
                 // not trivial.
                 //
@@ -9456,33 +9460,45 @@ void Compiler::impImportBlockCode(BasicBlock* block)
                     // Does VM allow us to use frozen allocators?
                     opts.jitFlags->IsSet(JitFlags::JIT_FLAG_FROZEN_ALLOC_ALLOWED))
                 {
-                    // Check next two opcodes (have to be STSFLD and RET)
-                    const BYTE* nextOpcode1 = codeAddr + sizeof(mdToken);
-                    const BYTE* nextOpcode2 = nextOpcode1 + sizeof(mdToken) + 1;
-                    if ((nextOpcode2 < codeEndp) && (getU1LittleEndian(nextOpcode1) == CEE_STSFLD))
+                    const BYTE* storeOpcode = codeAddr + sizeof(mdToken);
+
+                    // Skip over the InitializeArray call, if any
+                    const BYTE* ldtokenOpcode   = storeOpcode + 1;
+                    const BYTE* callOpcode      = ldtokenOpcode + 1 + sizeof(mdToken);
+                    const BYTE* afterCallOpcode = callOpcode + 1 + sizeof(mdToken);
+                    if ((afterCallOpcode < codeEndp) && (getU1LittleEndian(storeOpcode) == CEE_DUP) &&
+                        (getU1LittleEndian(ldtokenOpcode) == CEE_LDTOKEN) && (getU1LittleEndian(callOpcode) == CEE_CALL))
                     {
-                        if (getU1LittleEndian(nextOpcode2) == CEE_RET)
+                        CORINFO_RESOLVED_TOKEN callToken;
+                        impResolveToken(callOpcode + 1, &callToken, CORINFO_TOKENKIND_Method);
+                        if (lookupNamedIntrinsic(callToken.hMethod) ==
+                            NI_System_Runtime_CompilerServices_RuntimeHelpers_InitializeArray)
+                        {
+                            storeOpcode = afterCallOpcode;
+                        }
+                    }
+
+                    if ((storeOpcode + sizeof(mdToken) < codeEndp) && (getU1LittleEndian(storeOpcode) == CEE_STSFLD))
+                    {
+                        // Check that the field is "static readonly", we don't want to waste memory
+                        // for potentially mutable fields.
+                        CORINFO_RESOLVED_TOKEN fldToken;
+                        impResolveToken(storeOpcode + 1, &fldToken, CORINFO_TOKENKIND_Field);
+                        CORINFO_FIELD_INFO fi;
+                        eeGetFieldInfo(&fldToken, CORINFO_ACCESS_SET, &fi);
+                        unsigned flagsToCheck = CORINFO_FLG_FIELD_STATIC | CORINFO_FLG_FIELD_FINAL;
+                        if (((fi.fieldFlags & flagsToCheck) == flagsToCheck) &&
+                            ((info.compCompHnd->getClassAttribs(info.compClassHnd) & CORINFO_FLG_SHAREDINST) == 0))
                         {
-                            // Check that the field is "static readonly", we don't want to waste memory
-                            // for potentially mutable fields.
-                            CORINFO_RESOLVED_TOKEN fldToken;
-                            impResolveToken(nextOpcode1 + 1, &fldToken, CORINFO_TOKENKIND_Field);
-                            CORINFO_FIELD_INFO fi;
-                            eeGetFieldInfo(&fldToken, CORINFO_ACCESS_SET, &fi);
-                            unsigned flagsToCheck = CORINFO_FLG_FIELD_STATIC | CORINFO_FLG_FIELD_FINAL;
-                            if (((fi.fieldFlags & flagsToCheck) == flagsToCheck) &&
-                                ((info.compCompHnd->getClassAttribs(info.compClassHnd) & CORINFO_FLG_SHAREDINST) == 0))
-                            {
 #ifdef FEATURE_READYTORUN
-                                if (opts.IsReadyToRun())
-                                {
-                                    // Need to restore array classes before creating array objects on the heap
-                                    op1 = impTokenToHandle(&resolvedToken, nullptr, true /*mustRestoreHandle*/);
-                                }
-#endif
-                                op1 = gtNewHelperCallNode(CORINFO_HELP_NEWARR_1_MAYBEFROZEN, TYP_REF, op1, op2);
-                                isFrozenAllocator = true;
+                            if (opts.IsReadyToRun())
+                            {
+                                // Need to restore array classes before creating array objects on the heap
+                                op1 = impTokenToHandle(&resolvedToken, nullptr, true /*mustRestoreHandle*/);
                             }
+#endif
+                            op1 = gtNewHelperCallNode(CORINFO_HELP_NEWARR_1_MAYBEFROZEN, TYP_REF, op1, op2);
+                            isFrozenAllocator = true;
                         }
                     }
                 }
@@ -9524,7 +9540,9 @@ void Compiler::impImportBlockCode(BasicBlock* block)
 
                 op1->AsCall()->compileTimeHelperArgumentHandle = (CORINFO_GENERIC_HANDLE)resolvedToken.hClass;
 
-                // Remember that this function contains 'new' of an SD array.
+                // Remember that this basic block contains 'new' of an SD array,
+                // and so does this method.
+                block->SetFlags(BBF_HAS_NEWARR);
                 optMethodFlags |= OMF_HAS_NEWARRAY;
 
                 /* Push the result of the call on the stack */
@@ -6689,6 +6689,16 @@ void Compiler::pickGDV(GenTreeCall*           call,
             likelihoodThreshold = 10;
         }
 
+        // For more than 2 guesses we may pick candidates by histogram coverage: once the accepted
+        // classes cover 'coverageTarget' percent of the observed types, the remaining ones are
+        // left to the fallback call. A coverage of 0 (the default) accepts all candidates.
+        //
+        unsigned coverageTarget = UINT_MAX;
+        if ((maxNumberOfGuesses > 2) && (JitConfig.JitGuardedDevirtualizationCoverage() > 0))
+        {
+            coverageTarget = (unsigned)min(100, JitConfig.JitGuardedDevirtualizationCoverage());
+        }
+
         // We have 'maxNumberOfGuesses' number of classes available
         // and we're allowed to make 'maxNumberOfGuesses' number of guesses
         // Iterate over the available classes to find classes with likelihoods bigger than
@@ -6696,13 +6706,21 @@ void Compiler::pickGDV(GenTreeCall*           call,
         //
         assert(*candidatesCount == 0);
         unsigned totalGuesses = min((unsigned)maxNumberOfGuesses, numberOfClasses);
+        unsigned coverage     = 0;
         for (unsigned guessIdx = 0; guessIdx < totalGuesses; guessIdx++)
         {
+            if (coverage >= coverageTarget)
+            {
+                JITDUMP("Accepted candidates already cover %u%% of the histogram\n", coverage);
+                break;
+            }
+
             if (likelyClasses[guessIdx].likelihood >= likelihoodThreshold)
             {
                 classGuesses[guessIdx] = (CORINFO_CLASS_HANDLE)likelyClasses[guessIdx].handle;
                 likelihoods[guessIdx]  = likelyClasses[guessIdx].likelihood;
                 *candidatesCount       = *candidatesCount + 1;
+                coverage += likelihoods[guessIdx];
                 JITDUMP("Accepting type %s with likelihood %u as a candidate\n", eeGetClassName(classGuesses[guessIdx]),
                         likelihoods[guessIdx])
             }
@@ -545,18 +545,96 @@ GenTree* Compiler::impExpandHalfConstEquals(GenTreeLclVarCommon* data,
 }
 
 //------------------------------------------------------------------------
-// impGetStrConFromSpan: Try to obtain string literal out of a span:
+// impIsConstUtf16String: Check whether a node is a string with content known
+//    at JIT time: either a string literal or a frozen string object, e.g. the
+//    value of an initialized static readonly string field in Tier1.
+//
+// Arguments:
+//    node - the node to check
+//
+// Returns:
+//    true if impGetConstUtf16String can be used to obtain the content
+//
+bool Compiler::impIsConstUtf16String(GenTree* node)
+{
+    if (node->OperIs(GT_CNS_STR))
+    {
+        return true;
+    }
+
+    if (node->IsIconHandle(GTF_ICON_OBJ_HDL))
+    {
+        CORINFO_OBJECT_HANDLE obj = (CORINFO_OBJECT_HANDLE)node->AsIntCon()->IconValue();
+        return info.compCompHnd->getObjectType(obj) == impGetStringClass();
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------
+// impGetConstUtf16String: Obtain the content of a string accepted by
+//    impIsConstUtf16String
+//
+// Arguments:
+//    node      - GT_CNS_STR or frozen string handle
+//    str       - [out] buffer for the characters
+//    maxLength - size of the buffer in characters
+//
+// Returns:
+//    Length of the string, or -1 if the content is not available or
+//    does not fit into the buffer
+//
+int Compiler::impGetConstUtf16String(GenTree* node, char16_t* str, int maxLength)
+{
+    assert(impIsConstUtf16String(node));
+
+    int length;
+    if (node->OperIs(GT_CNS_STR))
+    {
+        GenTreeStrCon* cnsStr = node->AsStrCon();
+        if (cnsStr->IsStringEmptyField())
+        {
+            // check for fake "" first
+            return 0;
+        }
+
+        length = info.compCompHnd->getStringLiteral(cnsStr->gtScpHnd, cnsStr->gtSconCPX, str, maxLength);
+    }
+    else
+    {
+        CORINFO_OBJECT_HANDLE obj = (CORINFO_OBJECT_HANDLE)node->AsIntCon()->IconValue();
+
+        length = info.compCompHnd->getArrayOrStringLength(obj);
+        if ((length > 0) && (length <= maxLength) &&
+            !info.compCompHnd->getObjectContent(obj, (uint8_t*)str, length * (int)sizeof(char16_t),
+                                                OFFSETOF__CORINFO_String__chars))
+        {
+            return -1;
+        }
+    }
+
+    if ((length < 0) || (length > maxLength))
+    {
+        // We were unable to get the content (e.g. dynamic context)
+        return -1;
+    }
+
+    return length;
+}
+
+//------------------------------------------------------------------------
+// impGetStrConFromSpan: Try to obtain a constant string out of a span:
 //  var span = "str".AsSpan();
 //  var span = (ReadOnlySpan<char>)"str"
 //
 // Arguments:
 //    span - String_op_Implicit or MemoryExtensions_AsSpan call
-//           with a string literal
+//           with a constant string (see impIsConstUtf16String)
 //
 // Returns:
-//    GenTreeStrCon node or nullptr
+//    The constant string node or nullptr
 //
-GenTreeStrCon* Compiler::impGetStrConFromSpan(GenTree* span)
+GenTree* Compiler::impGetStrConFromSpan(GenTree* span)
 {
     GenTreeCall* argCall = nullptr;
     if (span->OperIs(GT_RET_EXPR))
@@ -580,9 +658,9 @@ GenTreeStrCon* Compiler::impGetStrConFromSpan(GenTree* span)
         {
             assert(argCall->gtArgs.CountArgs() == 1);
             GenTree* arg = argCall->gtArgs.GetArgByIndex(0)->GetNode();
-            if (arg->OperIs(GT_CNS_STR))
+            if (impIsConstUtf16String(arg))
             {
-                return arg->AsStrCon();
+                return arg;
             }
         }
     }
@@ -653,28 +731,27 @@ GenTree* Compiler::impUtf16StringComparison(StringComparisonKind kind, CORINFO_S
         op2 = impStackTop(0).val;
     }
 
-    if (!op1->OperIs(GT_CNS_STR) && !op2->OperIs(GT_CNS_STR))
+    GenTree* varStr;
+    GenTree* cnsStr;
+    if (impIsConstUtf16String(op2))
     {
-        return nullptr;
-    }
-
-    GenTree*       varStr;
-    GenTreeStrCon* cnsStr;
-    if (op2->OperIs(GT_CNS_STR))
-    {
-        cnsStr = op2->AsStrCon();
+        cnsStr = op2;
         varStr = op1;
     }
-    else
+    else if (impIsConstUtf16String(op1))
     {
         if (kind != StringComparisonKind::Equals)
         {
             // StartsWith and EndsWith are not commutative
             return nullptr;
         }
-        cnsStr = op1->AsStrCon();
+        cnsStr = op1;
         varStr = op2;
     }
+    else
+    {
+        return nullptr;
+    }
 
     bool needsNullcheck = true;
     if ((op1 != cnsStr) && !isStatic)
@@ -690,24 +767,13 @@ GenTree* Compiler::impUtf16StringComparison(StringComparisonKind kind, CORINFO_S
         needsNullcheck = false;
     }
 
-    int      cnsLength;
-    char16_t str[MaxPossibleUnrollSize];
-    if (cnsStr->IsStringEmptyField())
-    {
-        // check for fake "" first
-        cnsLength = 0;
-        JITDUMP("Trying to unroll String.Equals|StartsWith|EndsWith(op1, \"\")...\n", str)
-    }
-    else
+    char16_t  str[MaxPossibleUnrollSize];
+    const int cnsLength = impGetConstUtf16String(cnsStr, str, MaxPossibleUnrollSize);
+    if (cnsLength < 0)
     {
-        cnsLength = info.compCompHnd->getStringLiteral(cnsStr->gtScpHnd, cnsStr->gtSconCPX, str, MaxPossibleUnrollSize);
-        if ((cnsLength < 0) || (cnsLength > MaxPossibleUnrollSize))
-        {
-            // We were unable to get the literal (e.g. dynamic context)
-            return nullptr;
-        }
-        JITDUMP("Trying to unroll String.Equals|StartsWith|EndsWith(op1, \"cns\")...\n")
+        return nullptr;
     }
+    JITDUMP("Trying to unroll String.Equals|StartsWith|EndsWith(op1, \"cns\")...\n")
 
     // Create a temp which is safe to gtClone for varStr
     // We're not appending it as a statement until we figure out unrolling is profitable (and possible)
@@ -816,16 +882,16 @@ GenTree* Compiler::impUtf16SpanComparison(StringComparisonKind kind, CORINFO_SIG
     }
 
     // Try to obtain original string literals out of span arguments
-    GenTreeStrCon* op1Str = impGetStrConFromSpan(op1);
-    GenTreeStrCon* op2Str = impGetStrConFromSpan(op2);
+    GenTree* op1Str = impGetStrConFromSpan(op1);
+    GenTree* op2Str = impGetStrConFromSpan(op2);
 
     if ((op1Str == nullptr) && (op2Str == nullptr))
     {
         return nullptr;
     }
 
-    GenTree*       spanObj;
-    GenTreeStrCon* cnsStr;
+    GenTree* spanObj;
+    GenTree* cnsStr;
     if (op2Str != nullptr)
     {
         cnsStr  = op2Str;
@@ -842,24 +908,13 @@ GenTree* Compiler::impUtf16SpanComparison(StringComparisonKind kind, CORINFO_SIG
         spanObj = op2;
     }
 
-    int      cnsLength = -1;
-    char16_t str[MaxPossibleUnrollSize];
-    if (cnsStr->IsStringEmptyField())
+    char16_t  str[MaxPossibleUnrollSize];
+    const int cnsLength = impGetConstUtf16String(cnsStr, str, MaxPossibleUnrollSize);
+    if (cnsLength < 0)
     {
-        // check for fake "" first
-        cnsLength = 0;
-        JITDUMP("Trying to unroll MemoryExtensions.Equals|SequenceEqual|StartsWith(op1, \"\")...\n")
-    }
-    else
-    {
-        cnsLength = info.compCompHnd->getStringLiteral(cnsStr->gtScpHnd, cnsStr->gtSconCPX, str, MaxPossibleUnrollSize);
-        if ((cnsLength < 0) || (cnsLength > MaxPossibleUnrollSize))
-        {
-            // We were unable to get the literal (e.g. dynamic context)
-            return nullptr;
-        }
-        JITDUMP("Trying to unroll MemoryExtensions.Equals|SequenceEqual|StartsWith(op1, \"%ws\")...\n", str)
+        return nullptr;
     }
+    JITDUMP("Trying to unroll MemoryExtensions.Equals|SequenceEqual|StartsWith(op1, \"cns\")...\n")
 
     unsigned spanLclNum;
     if (spanObj->OperIs(GT_LCL_VAR))
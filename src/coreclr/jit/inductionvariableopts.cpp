@@ -67,6 +67,8 @@ public:
 
     template <typename TFunc>
     bool VisitStatementsWithOccurrences(FlowGraphNaturalLoop* loop, unsigned lclNum, TFunc func);
+
+    void Invalidate(FlowGraphNaturalLoop* loop);
 };
 
 LoopLocalOccurrences::LoopLocalOccurrences(FlowGraphNaturalLoops* loops)
@@ -314,6 +316,27 @@ bool LoopLocalOccurrences::VisitStatementsWithOccurrences(FlowGraphNaturalLoop*
     return VisitLoopNestMaps(loop, visitor);
 }
 
+//------------------------------------------------------------------------------
+// LoopLocalOccurrences:Invalidate:
+//   Invalidate the occurrences tracked for an innermost loop after its IR has
+//   been changed. The occurrences will be recomputed on demand.
+//
+// Parameters:
+//   loop - The loop. Must not have any child loops.
+//
+void LoopLocalOccurrences::Invalidate(FlowGraphNaturalLoop* loop)
+{
+    assert(loop->GetChild() == nullptr);
+
+    BitVecTraits poTraits = m_loops->GetDfsTree()->PostOrderTraits();
+    loop->VisitLoopBlocks([=, &poTraits](BasicBlock* block) {
+        BitVecOps::RemoveElemD(&poTraits, m_visitedBlocks, block->bbPostorderNum);
+        return BasicBlockVisit::Continue;
+    });
+
+    m_maps[loop->GetIndex()] = nullptr;
+}
+
 //------------------------------------------------------------------------
 // optCanSinkWidenedIV: Check to see if we are able to sink a store to the old
 // local into the exits of a loop if we decide to widen.
@@ -861,6 +884,412 @@ bool Compiler::optWidenPrimaryIV(FlowGraphNaturalLoop* loop,
     return true;
 }
 
+//------------------------------------------------------------------------
+// optDistributeIndexExtensions: Distribute zero and sign extensions of an
+// array index over its add recurrence.
+//
+// Parameters:
+//   scevContext - Context for scalar evolution
+//   scev        - The SCEV describing an address of an in-bounds array element
+//
+// Returns:
+//   SCEV with extensions of simple add recurrences replaced by wide add
+//   recurrences, or nullptr if an extension could not be distributed.
+//
+// Remarks:
+//   SCEV does not distribute extensions over add recurrences since the narrow
+//   value may wrap. For an index with a non-negative constant start and a step
+//   of one that is used to access an in-bounds array element in every
+//   iteration that cannot happen: the index has to stay below the array
+//   length, so it never exceeds INT32_MAX.
+//
+Scev* Compiler::optDistributeIndexExtensions(ScalarEvolutionContext& scevContext, Scev* scev)
+{
+    switch (scev->Oper)
+    {
+        case ScevOper::Constant:
+        case ScevOper::Local:
+            return scev;
+        case ScevOper::ZeroExtend:
+        case ScevOper::SignExtend:
+        {
+            ScevUnop* ext = (ScevUnop*)scev;
+            Scev*     op  = scevContext.Simplify(ext->Op1);
+            if (!op->OperIs(ScevOper::AddRec))
+            {
+                return op->IsInvariant() ? scev : nullptr;
+            }
+
+            ScevAddRec* addRec = (ScevAddRec*)op;
+            int64_t     start;
+            int64_t     step;
+            if (!addRec->Start->GetConstantValue(this, &start) || !addRec->Step->GetConstantValue(this, &step) ||
+                (start < 0) || (start > INT32_MAX) || (step != 1))
+            {
+                return nullptr;
+            }
+
+            return scevContext.NewAddRec(scevContext.NewConstant(ext->Type, start),
+                                         scevContext.NewConstant(ext->Type, step));
+        }
+        case ScevOper::Add:
+        case ScevOper::Mul:
+        case ScevOper::Lsh:
+        {
+            ScevBinop* binop = (ScevBinop*)scev;
+            Scev*      op1   = optDistributeIndexExtensions(scevContext, binop->Op1);
+            if (op1 == nullptr)
+            {
+                return nullptr;
+            }
+
+            Scev* op2 = optDistributeIndexExtensions(scevContext, binop->Op2);
+            if (op2 == nullptr)
+            {
+                return nullptr;
+            }
+
+            return scevContext.NewBinop(binop->Oper, op1, op2);
+        }
+        case ScevOper::AddRec:
+            return scev;
+        default:
+            unreached();
+    }
+}
+
+//------------------------------------------------------------------------
+// optReplaceFillLoopWithBlockInit: Replace a loop that stores the same value
+// into consecutive array elements by a single block initialization in the
+// preheader.
+//
+// Parameters:
+//   scevContext - Context for scalar evolution
+//   loop        - Loop to transform
+//   loopLocals  - Data structure that tracks occurrences of locals in the loop
+//
+// Returns:
+//   True if the store was removed from the loop.
+//
+// Remarks:
+//   We look for single block loops like
+//
+//     for (int i = 0; i < arr.Length; i++)
+//         arr[i] = 0;
+//
+//   where the bounds check has been removed. The element store is replaced by
+//   a CORINFO_HELP_MEMZERO/CORINFO_HELP_MEMSET call in the preheader that
+//   covers all elements the loop would have stored to; the backend unrolls it
+//   using SIMD stores when the size is a small constant and the helper itself
+//   is vectorized otherwise. The remaining IV updates are left for the
+//   downwards counted transformation and later to clean up.
+//
+bool Compiler::optReplaceFillLoopWithBlockInit(ScalarEvolutionContext& scevContext,
+                                               FlowGraphNaturalLoop*   loop,
+                                               LoopLocalOccurrences*   loopLocals)
+{
+    BasicBlock* header = loop->GetHeader();
+
+    if ((loop->GetChild() != nullptr) || (loop->NumLoopBlocks() != 1) || !header->KindIs(BBJ_COND))
+    {
+        return false;
+    }
+
+    JITDUMP("Checking if " FMT_LP " is a fill loop\n", loop->GetIndex());
+
+    Statement* jtrueStmt = header->lastStmt();
+    if ((jtrueStmt->GetRootNode()->gtFlags & GTF_SIDE_EFFECT) != 0)
+    {
+        JITDUMP("  No; exit node has side effects\n");
+        return false;
+    }
+
+    // The only memory access in the loop must be the element store. Anything
+    // else is allowed to be a side effect free local store only, so that
+    // moving the element stores in front of the loop is not observable.
+    Statement* storeStmt = nullptr;
+    for (Statement* stmt : header->NonPhiStatements())
+    {
+        if (stmt == jtrueStmt)
+        {
+            continue;
+        }
+
+        GenTree* root = stmt->GetRootNode();
+        if (root->OperIs(GT_STOREIND) && (storeStmt == nullptr))
+        {
+            storeStmt = stmt;
+            continue;
+        }
+
+        if (!root->OperIs(GT_STORE_LCL_VAR) || ((root->gtFlags & GTF_GLOB_REF) != 0) ||
+            ((root->AsLclVarCommon()->Data()->gtFlags & GTF_SIDE_EFFECT) != 0))
+        {
+            JITDUMP("  No; " FMT_STMT " is not a simple local store\n", stmt->GetID());
+            return false;
+        }
+
+        for (GenTree* node : stmt->TreeList())
+        {
+            if (node->OperIsIndir() || node->IsCall())
+            {
+                JITDUMP("  No; " FMT_STMT " accesses memory\n", stmt->GetID());
+                return false;
+            }
+        }
+    }
+
+    if (storeStmt == nullptr)
+    {
+        JITDUMP("  No; no element store found\n");
+        return false;
+    }
+
+    GenTreeStoreInd* store = storeStmt->GetRootNode()->AsStoreInd();
+    GenTree*         data  = store->Data();
+    var_types        type  = store->TypeGet();
+
+    // Removed bounds checks leave behind a COMMA with a NOP.
+    GenTree* addrNode = store->Addr();
+    while (addrNode->OperIs(GT_COMMA) && ((addrNode->gtGetOp1()->gtFlags & GTF_SIDE_EFFECT) == 0))
+    {
+        addrNode = addrNode->gtGetOp2();
+    }
+
+    if (!addrNode->OperIs(GT_ARR_ADDR) || ((store->gtFlags & (GTF_EXCEPT | GTF_IND_VOLATILE)) != 0) ||
+        store->IsUnaligned() || varTypeIsGC(type) || varTypeIsStruct(type) || varTypeIsSIMD(type))
+    {
+        JITDUMP("  No; not a simple in bounds store to a primitive array element\n");
+        return false;
+    }
+
+    GenTreeArrAddr* arrAddr = addrNode->AsArrAddr();
+    if ((genTypeSize(arrAddr->GetElemType()) != genTypeSize(type)) || ((arrAddr->gtFlags & GTF_SIDE_EFFECT) != 0))
+    {
+        JITDUMP("  No; store does not cover the full element\n");
+        return false;
+    }
+
+    // memset can only replicate a single byte, so apart from byte arrays only
+    // zeroing is supported.
+    bool isZero = data->IsIntegralConst(0) || data->IsFloatPositiveZero();
+    if (!isZero && !((genTypeSize(type) == 1) && data->IsCnsIntOrI()))
+    {
+        JITDUMP("  No; stored value is not a suitable constant\n");
+        return false;
+    }
+
+    Scev* addr = scevContext.Analyze(header, arrAddr->Addr());
+    if (addr == nullptr)
+    {
+        JITDUMP("  No; could not analyze address\n");
+        return false;
+    }
+
+    addr = optDistributeIndexExtensions(scevContext, addr);
+    if (addr == nullptr)
+    {
+        JITDUMP("  No; could not widen index\n");
+        return false;
+    }
+
+    addr = scevContext.Simplify(addr);
+
+    JITDUMP("  Address => ");
+    DBEXEC(verbose, addr->Dump(this));
+    JITDUMP("\n");
+
+    int64_t step;
+    if (!addr->OperIs(ScevOper::AddRec) || !((ScevAddRec*)addr)->Step->GetConstantValue(this, &step) ||
+        (step != (int64_t)genTypeSize(type)))
+    {
+        JITDUMP("  No; address does not advance by one element per iteration\n");
+        return false;
+    }
+
+    // We expect the start to be <array> + <constant offset>.
+    Scev*   start  = ((ScevAddRec*)addr)->Start;
+    int64_t offset = 0;
+    if (start->OperIs(ScevOper::Add) && ((ScevBinop*)start)->Op2->GetConstantValue(this, &offset))
+    {
+        start = ((ScevBinop*)start)->Op1;
+    }
+
+    if (!start->OperIs(ScevOper::Local) || !lvaGetDesc(((ScevLocal*)start)->LclNum)->TypeIs(TYP_REF) ||
+        (offset < arrAddr->GetFirstElemOffset()))
+    {
+        JITDUMP("  No; start address is not an element of an invariant array\n");
+        return false;
+    }
+
+    Scev* backedgeCount = scevContext.ComputeExitNotTakenCount(header);
+    if (backedgeCount == nullptr)
+    {
+        JITDUMP("  No; could not compute backedge count\n");
+        return false;
+    }
+
+    // The store executes once more than the backedge is taken.
+    Scev* tripCount = scevContext.Simplify(
+        scevContext.NewBinop(ScevOper::Add, backedgeCount, scevContext.NewConstant(backedgeCount->Type, 1)));
+    GenTree* tripCountNode = scevContext.Materialize(tripCount);
+    if (tripCountNode == nullptr)
+    {
+        JITDUMP("  No; could not materialize trip count into IR\n");
+        return false;
+    }
+
+    JITDUMP("  Replacing element store " FMT_STMT " with a block init in the preheader\n", storeStmt->GetID());
+
+#ifdef TARGET_64BIT
+    if (tripCountNode->TypeIs(TYP_INT))
+    {
+        tripCountNode = gtNewCastNode(TYP_LONG, tripCountNode, /* fromUnsigned */ true, TYP_LONG);
+    }
+#endif
+
+    GenTree* size = tripCountNode;
+    if (genTypeSize(type) != 1)
+    {
+        size = gtNewOperNode(GT_MUL, TYP_I_IMPL, size, gtNewIconNode(genTypeSize(type), TYP_I_IMPL));
+    }
+
+    GenTree* dst = gtNewOperNode(GT_ADD, TYP_BYREF, gtNewLclvNode(((ScevLocal*)start)->LclNum, TYP_REF),
+                                 gtNewIconNode((ssize_t)offset, TYP_I_IMPL));
+
+    GenTreeCall* call;
+    if (isZero)
+    {
+        call = gtNewHelperCallNode(CORINFO_HELP_MEMZERO, TYP_VOID, dst, size);
+    }
+    else
+    {
+        GenTree* value = gtNewIconNode(data->AsIntConCommon()->IconValue() & 0xFF);
+        call           = gtNewHelperCallNode(CORINFO_HELP_MEMSET, TYP_VOID, dst, value, size);
+    }
+
+    fgMorphArgs(call);
+
+    Statement* newStmt = fgNewStmtFromTree(call);
+    fgInsertStmtAtEnd(loop->GetPreheader(), newStmt);
+    DISPSTMT(newStmt);
+
+    fgRemoveStmt(header, storeStmt);
+    loopLocals->Invalidate(loop);
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// optRemoveLoopBoundsChecks: Remove bounds checks inside a loop whose index
+// is proven to be in bounds by an exit test of the loop.
+//
+// Parameters:
+//   scevContext - Context for scalar evolution
+//   loop        - Loop to optimize
+//
+// Returns:
+//   True if any bounds check was removed.
+//
+// Remarks:
+//   Range check elimination relies on assertions about the index itself, so
+//   it does not see that "a[i + 1]" is in bounds in a loop that tests
+//   "i < a.Length - 1", or that a second IV stepping in lockstep with the
+//   tested one stays in bounds. SCEV relates both to the IV of the exit test;
+//   see ScalarEvolutionContext::IsIndexInBounds for the details.
+//
+bool Compiler::optRemoveLoopBoundsChecks(ScalarEvolutionContext& scevContext, FlowGraphNaturalLoop* loop)
+{
+    JITDUMP("Checking for removable bounds checks in " FMT_LP "\n", loop->GetIndex());
+
+    BasicBlock* dominates = nullptr;
+    for (FlowEdge* backEdge : loop->BackEdges())
+    {
+        if (dominates == nullptr)
+        {
+            dominates = backEdge->getSourceBlock();
+        }
+        else
+        {
+            dominates = m_domTree->Intersect(dominates, backEdge->getSourceBlock());
+        }
+    }
+
+    ArrayStack<BasicBlock*> exitings(getAllocator(CMK_LoopIVOpts));
+    while ((dominates != nullptr) && loop->ContainsBlock(dominates))
+    {
+        if (dominates->KindIs(BBJ_COND) &&
+            (!loop->ContainsBlock(dominates->GetTrueTarget()) || !loop->ContainsBlock(dominates->GetFalseTarget())) &&
+            !loop->MayExecuteBlockMultipleTimesPerIteration(dominates))
+        {
+            exitings.Push(dominates);
+        }
+
+        dominates = dominates->bbIDom;
+    }
+
+    if (exitings.Empty())
+    {
+        JITDUMP("  No exiting block dominates all backedges\n");
+        return false;
+    }
+
+    int numRemoved = 0;
+    loop->VisitLoopBlocks([this, &scevContext, &exitings, &numRemoved](BasicBlock* block) {
+        for (Statement* const stmt : block->Statements())
+        {
+            bool modified = false;
+
+            for (GenTree* const tree : stmt->TreeList())
+            {
+                GenTree* comma = nullptr;
+                GenTree* check = tree;
+                if (tree->OperIs(GT_COMMA))
+                {
+                    comma = tree;
+                    check = tree->gtGetOp1();
+                }
+                else if (tree != stmt->GetRootNode())
+                {
+                    continue;
+                }
+
+                if (!check->OperIs(GT_BOUNDS_CHECK))
+                {
+                    continue;
+                }
+
+                GenTreeBoundsChk* bndsChk = check->AsBoundsChk();
+                ValueNum lengthVN = vnStore->VNConservativeNormalValue(bndsChk->GetArrayLength()->gtVNPair);
+
+                for (int i = 0; i < exitings.Height(); i++)
+                {
+                    if (scevContext.IsIndexInBounds(exitings.Bottom(i), block, bndsChk->GetIndex(), lengthVN))
+                    {
+                        JITDUMP("  Bounds check [%06u] in " FMT_BB " is implied by the exit test in " FMT_BB "\n",
+                                dspTreeID(bndsChk), block->bbNum, exitings.Bottom(i)->bbNum);
+                        optRemoveRangeCheck(bndsChk, comma, stmt);
+                        modified = true;
+                        numRemoved++;
+                        break;
+                    }
+                }
+            }
+
+            if (modified)
+            {
+                gtSetStmtInfo(stmt);
+                fgSetStmtSeq(stmt);
+            }
+        }
+
+        return BasicBlockVisit::Continue;
+    });
+
+    Metrics.LoopBoundsChecksRemoved += numRemoved;
+    return numRemoved > 0;
+}
+
 //------------------------------------------------------------------------
 // optMakeLoopDownwardsCounted: Transform a loop to be downwards counted if
 // profitable and legal.
@@ -1200,6 +1629,20 @@ PhaseStatus Compiler::optInductionVariables()
             continue;
         }
 
+        // Do this before the exit test is rewritten to be downwards counted,
+        // since the proof relates the indices to the IV compared in the test.
+        if ((JitConfig.JitDoLoopBoundsCheckRemoval() != 0) && optRemoveLoopBoundsChecks(scevContext, loop))
+        {
+            changed = true;
+        }
+
+        if ((JitConfig.JitDoLoopFillBlockInit() != 0) &&
+            optReplaceFillLoopWithBlockInit(scevContext, loop, &loopLocals))
+        {
+            Metrics.LoopsReplacedWithBlockInit++;
+            changed = true;
+        }
+
         if (optMakeLoopDownwardsCounted(scevContext, loop, &loopLocals))
         {
             Metrics.LoopsMadeDownwardsCounted++;
@@ -1794,6 +1794,39 @@ double ExtendedDefaultPolicy::DetermineMultiplier()
             multiplier *= min(m_ProfileFrequency, 1.0) * profileScale;
         }
         JITDUMP("\nCallsite has profile data: %g.  Multiplier limited to %g.", m_ProfileFrequency, multiplier);
+
+        if (m_RootCompiler->fgHaveTrustedProfileWeights())
+        {
+            if (m_ProfileFrequency > 1.0)
+            {
+                // The callsite runs more often than the caller itself, typically inside a loop. Such sites
+                // are where manually added AggressiveInlining usually pays off, so let the benefit keep
+                // growing (logarithmically, up to 16x the entry weight) to allow larger callees there.
+                const double hotScale = (double)JitConfig.JitExtDefaultPolicyProfHotScale() / 10.0;
+                multiplier *= 1.0 + min(log2(m_ProfileFrequency), 4.0) * hotScale;
+                JITDUMP("\nCallsite is hotter than the method entry.  Multiplier increased to %g.", multiplier);
+            }
+            else if (m_ProfileFrequency <= 0.0)
+            {
+                // The callsite was never executed: only inline if it does not grow the caller.
+                multiplier = min(multiplier, 1.0);
+                JITDUMP("\nCallsite was never executed.  Multiplier limited to %g.", multiplier);
+            }
+
+            // Keep a budget on how much the caller may grow, only sites as hot as the method entry may
+            // exceed it.
+            const int sizeBudgetFactor = JitConfig.JitExtDefaultPolicyProfSizeBudget();
+            const int initialSize      = m_RootCompiler->m_inlineStrategy->GetInitialSizeEstimate();
+            const int currentSize      = m_RootCompiler->m_inlineStrategy->GetCurrentSizeEstimate();
+            const int sizeBudget       = max(initialSize * sizeBudgetFactor, 1024 * SIZE_SCALE);
+
+            if ((sizeBudgetFactor > 0) && (m_ProfileFrequency < 1.0) && (currentSize > sizeBudget))
+            {
+                multiplier *= (double)sizeBudget / currentSize;
+                JITDUMP("\nCaller size estimate %d is over budget %d.  Multiplier decreased to %g.", currentSize,
+                        sizeBudget, multiplier);
+            }
+        }
     }
 
     // Slow down if there are already too many locals
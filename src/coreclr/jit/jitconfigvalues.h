@@ -360,6 +360,17 @@ RELEASE_CONFIG_INTEGER(EnableEHWriteThru, W("EnableEHWriteThru"), 1)
 // Enable the enregistration of locals that are defined or used in a multireg context.
 RELEASE_CONFIG_INTEGER(EnableMultiRegLocals, W("EnableMultiRegLocals"), 1)
 
+// Bound the register allocator's work on methods with very many blocks (0, the default, disables each limit).
+// With at least JitLsraLargeMethodBlocks blocks only the hottest JitLsraLargeMethodCandidates
+// lclVars are register candidates; with at least JitLsraSimpleAllocBlocks blocks no lclVars are.
+RELEASE_CONFIG_INTEGER(JitLsraLargeMethodBlocks, W("JitLsraLargeMethodBlocks"), 0)
+RELEASE_CONFIG_INTEGER(JitLsraLargeMethodCandidates, W("JitLsraLargeMethodCandidates"), 256)
+RELEASE_CONFIG_INTEGER(JitLsraSimpleAllocBlocks, W("JitLsraSimpleAllocBlocks"), 0)
+
+// If set, optimized methods with loops that contain no calls get GC polls on their back edges instead
+// of being made fully interruptible, which bounds the time it takes for such loops to reach a safe point.
+RELEASE_CONFIG_INTEGER(JitGCPollLoops, W("JitGCPollLoops"), 0)
+
 // Disables inlining of all methods
 RELEASE_CONFIG_INTEGER(JitNoInline, W("JitNoInline"), 0)
 
@@ -455,6 +466,11 @@ RELEASE_CONFIG_INTEGER(JitConstCSE, W("JitConstCSE"), CONST_CSE_ENABLE_ARM)
 //
 RELEASE_CONFIG_INTEGER(JitRLCSEGreedy, W("JitRLCSEGreedy"), 0)
 
+// When set, a comma-separated list of parameters that replaces the built-in parameters of the
+// greedy RL policy, e.g. ones trained with JitRLCSE on a SuperPMI collection of your own methods.
+//
+RELEASE_CONFIG_STRING(JitRLCSEGreedyParameters, W("JitRLCSEGreedyParameters"))
+
 // If nonzero, dump out details of parameterized policy evaluation and gradient updates.
 RELEASE_CONFIG_INTEGER(JitRLCSEVerbose, W("JitRLCSEVerbose"), 0)
 
@@ -546,6 +562,9 @@ RELEASE_CONFIG_INTEGER(JitNoRngChks, W("JitNoRngChks"), 0) // If 1, don't genera
 OPT_CONFIG_INTEGER(JitDoAssertionProp, W("JitDoAssertionProp"), 1) // Perform assertion propagation optimization
 OPT_CONFIG_INTEGER(JitDoCopyProp, W("JitDoCopyProp"), 1) // Perform copy propagation on variables that appear redundant
 OPT_CONFIG_INTEGER(JitDoOptimizeIVs, W("JitDoOptimizeIVs"), 1)     // Perform optimization of induction variables
+OPT_CONFIG_INTEGER(JitDoLoopFillBlockInit, W("JitDoLoopFillBlockInit"), 1) // Replace array fill loops by block inits
+OPT_CONFIG_INTEGER(JitDoLoopBoundsCheckRemoval, W("JitDoLoopBoundsCheckRemoval"), 1) // Remove bounds checks implied
+                                                                                     // by loop exit tests
 OPT_CONFIG_INTEGER(JitDoEarlyProp, W("JitDoEarlyProp"), 1)         // Perform Early Value Propagation
 OPT_CONFIG_INTEGER(JitDoLoopHoisting, W("JitDoLoopHoisting"), 1)   // Perform loop hoisting on loop invariant values
 OPT_CONFIG_INTEGER(JitDoLoopInversion, W("JitDoLoopInversion"), 1) // Perform loop inversion on "for/while" loops
@@ -595,6 +614,9 @@ RELEASE_CONFIG_STRING(JitFuncInfoFile, W("JitFuncInfoLogFile"))
 // If set, gather JIT throughput data and write to a CSV file. This mode must be used in internal retail builds.
 RELEASE_CONFIG_STRING(JitTimeLogCsv, W("JitTimeLogCsv"))
 
+// If set, report a per-method phase time, memory and size summary (CORINFO_JIT_TELEMETRY) to the EE.
+RELEASE_CONFIG_INTEGER(JitReportTelemetry, W("JitReportTelemetry"), 1)
+
 RELEASE_CONFIG_STRING(TailCallOpt, W("TailCallOpt"))
 
 // If set, allow fast tail calls; otherwise allow only helper-based calls for explicit tail calls.
@@ -643,6 +665,15 @@ RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyMaxBB, W("JitExtDefaultPolicyMaxBB"),
 RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyProfTrust, W("JitExtDefaultPolicyProfTrust"), 0x7)
 RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyProfScale, W("JitExtDefaultPolicyProfScale"), 0x2A)
 
+// With trusted profile data, callsites hotter than the method entry get their BM additionally scaled by
+//
+//    1.0 + min(log2(ProfWeight), 4.0) * ProfHotScale
+//
+// and callsites colder than the entry are penalized once the caller's estimated size exceeds ProfSizeBudget
+// times its initial estimate (0 disables the budget).
+RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyProfHotScale, W("JitExtDefaultPolicyProfHotScale"), 0x5)
+RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyProfSizeBudget, W("JitExtDefaultPolicyProfSizeBudget"), 0x8)
+
 RELEASE_CONFIG_INTEGER(JitInlinePolicyModel, W("JitInlinePolicyModel"), 0)
 RELEASE_CONFIG_INTEGER(JitInlinePolicyProfile, W("JitInlinePolicyProfile"), 0)
 RELEASE_CONFIG_INTEGER(JitInlinePolicyProfileThreshold, W("JitInlinePolicyProfileThreshold"), 40)
@@ -661,6 +692,14 @@ RELEASE_CONFIG_INTEGER(JitEnableGuardedDevirtualization, W("JitEnableGuardedDevi
 // Max number is MAX_GDV_TYPE_CHECKS defined above ^. -1 means it's up to JIT to decide
 RELEASE_CONFIG_INTEGER(JitGuardedDevirtualizationMaxTypeChecks, W("JitGuardedDevirtualizationMaxTypeChecks"), -1)
 
+// Max number of type checks the JIT picks for call-sites with Dynamic PGO data when
+// JitGuardedDevirtualizationMaxTypeChecks is -1. Values above 1 are opt-in until measured.
+RELEASE_CONFIG_INTEGER(JitGuardedDevirtualizationDynamicPgoMaxTypeChecks, W("JitGuardedDevirtualizationDynamicPgoMaxTypeChecks"), 1)
+
+// When more than 2 type checks are allowed, stop adding guesses for a call-site once the accepted
+// classes cover this percentage of its class histogram. 0 disables the cutoff.
+RELEASE_CONFIG_INTEGER(JitGuardedDevirtualizationCoverage, W("JitGuardedDevirtualizationCoverage"), 0)
+
 // Various policies for GuardedDevirtualization (0x4B == 75)
 RELEASE_CONFIG_INTEGER(JitGuardedDevirtualizationChainLikelihood, W("JitGuardedDevirtualizationChainLikelihood"), 0x4B)
 RELEASE_CONFIG_INTEGER(JitGuardedDevirtualizationChainStatements, W("JitGuardedDevirtualizationChainStatements"), 1)
@@ -769,6 +808,16 @@ RELEASE_CONFIG_INTEGER(JitEnableCrossBlockLocalAssertionProp, W("JitEnableCrossB
 // Do greedy RPO-based layout in Compiler::fgReorderBlocks.
 RELEASE_CONFIG_INTEGER(JitDoReversePostOrderLayout, W("JitDoReversePostOrderLayout"), 1);
 
+// Refine the RPO-based layout of methods without EH with a profile-driven 3-opt search
+RELEASE_CONFIG_INTEGER(JitDoImprovedLayoutSearch, W("JitDoImprovedLayoutSearch"), 0);
+
+// Maximum number of candidate edges the 3-opt layout search considers per method
+RELEASE_CONFIG_INTEGER(JitImprovedLayoutSearchBudget, W("JitImprovedLayoutSearchBudget"), 1000);
+
+// Lower switches whose jump table has at most this many runs of cases with the same target
+// into a binary search instead of an indirect jump. 0 disables the transformation.
+RELEASE_CONFIG_INTEGER(JitSwitchBinarySearchMaxRuns, W("JitSwitchBinarySearchMaxRuns"), 4)
+
 // JitFunctionFile: Name of a file that contains a list of functions. If the currently compiled function is in the
 // file, certain other JIT config variables will be active. If the currently compiled function is not in the file,
 // the specific JIT config variables will not be active.
@@ -36,6 +36,8 @@ JITMETADATAMETRIC(LoopsAligned,                          int,              0)
 JITMETADATAMETRIC(LoopsIVWidened,                        int,              0)
 JITMETADATAMETRIC(WidenedIVs,                            int,              0)
 JITMETADATAMETRIC(LoopsMadeDownwardsCounted,             int,              0)
+JITMETADATAMETRIC(LoopsReplacedWithBlockInit,            int,              0)
+JITMETADATAMETRIC(LoopBoundsChecksRemoved,               int,              JIT_METADATA_HIGHER_IS_BETTER)
 JITMETADATAMETRIC(VarsInSsa,                             int,              0)
 JITMETADATAMETRIC(HoistedExpressions,                    int,              0)
 JITMETADATAMETRIC(RedundantBranchesEliminated,           int,              JIT_METADATA_HIGHER_IS_BETTER)
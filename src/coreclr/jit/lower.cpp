@@ -1222,7 +1222,8 @@ GenTree* Lowering::LowerSwitch(GenTree* node)
         // Try generating a bit test based switch first,
         // if that's not possible a jump table based switch will be generated.
         if (!TryLowerSwitchToBitTest(jumpTab, jumpCnt, targetCnt, afterDefaultCondBlock, switchValue,
-                                     defaultLikelihood))
+                                     defaultLikelihood) &&
+            !TryLowerSwitchToBinarySearch(jumpTab, jumpCnt, afterDefaultCondBlock, switchValue, defaultLikelihood))
         {
             JITDUMP("Lowering switch " FMT_BB ": using jump table expansion\n", originalSwitchBB->bbNum);
 
@@ -1495,6 +1496,200 @@ bool Lowering::TryLowerSwitchToBitTest(FlowEdge*   jumpTable[],
     return true;
 }
 
+//------------------------------------------------------------------------
+// TryLowerSwitchToBinarySearch: Attempts to transform a jump table switch into
+//    a binary search over the runs of cases that share a jump target.
+//
+// Arguments:
+//    jumpTable - The jump table
+//    jumpCount - The number of blocks in the jump table
+//    bbSwitch - The switch block
+//    switchValue - A LclVar node that provides the switch value
+//    defaultLikelihood - likelihood control flow took the default case (already checked)
+//
+// Return value:
+//    true if the switch has been lowered to a binary search
+//
+// Notes:
+//    Large tables with only a few distinct runs of targets are common for switches over
+//    character ranges, e.g. 'a'-'z' -> A, '0'-'9' -> B, everything else -> default. The
+//    indirect jump through such a table mispredicts as often as the input changes ranges,
+//    while a couple of compare-and-branch instructions on the run boundaries predict much
+//    better and avoid the table load:
+//        cmp ebx, 10
+//        jb  run0
+//        cmp ebx, 36
+//        jb  run1
+//        jmp run2
+//    Each internal node of the search tree tests "switchValue < first case of the upper
+//    half", and a half that consists of a single run branches directly to its target.
+//
+bool Lowering::TryLowerSwitchToBinarySearch(FlowEdge*   jumpTable[],
+                                            unsigned    jumpCount,
+                                            BasicBlock* bbSwitch,
+                                            GenTree*    switchValue,
+                                            weight_t    defaultLikelihood)
+{
+    assert(jumpCount >= 2);
+    assert(bbSwitch->KindIs(BBJ_SWITCH));
+    assert(switchValue->OperIs(GT_LCL_VAR));
+
+    if (comp->opts.OptimizationDisabled())
+    {
+        return false;
+    }
+
+    // As with the bit test, the last entry of the jump table is the default case that
+    // LowerSwitch already checked for.
+    const unsigned caseCount = jumpCount - 1;
+    const unsigned maxRuns   = (unsigned)JitConfig.JitSwitchBinarySearchMaxRuns();
+
+    unsigned runCount = 1;
+    for (unsigned i = 1; i < caseCount; i++)
+    {
+        if (jumpTable[i] != jumpTable[i - 1])
+        {
+            runCount++;
+        }
+    }
+
+    // A single run has a unique successor, which LowerSwitch handles without a table.
+    // Runs of single cases are better served by the jump table itself.
+    if ((runCount < 2) || (runCount > maxRuns) || (runCount == caseCount))
+    {
+        return false;
+    }
+
+    JITDUMP("Lowering switch " FMT_BB " to binary search over %u runs\n", bbSwitch->bbNum, runCount);
+
+    struct SwitchRun
+    {
+        unsigned    firstCase;
+        BasicBlock* target;
+        weight_t    likelihood;
+    };
+
+    SwitchRun* const runs = new (comp, CMK_Generic) SwitchRun[runCount];
+
+    // If defaultLikelihood is not ~ 1.0 the case likelihoods are up-scaled by
+    // 1.0 / (1.0 - defaultLikelihood), otherwise we don't know them and treat
+    // all cases as equally likely.
+    bool const     likelyToReachSwitch = !Compiler::fgProfileWeightsEqual(defaultLikelihood, 1.0, 0.001);
+    weight_t const scaleFactor         = likelyToReachSwitch ? (1.0 / (1.0 - defaultLikelihood)) : 0.0;
+
+    unsigned runIndex = 0;
+    for (unsigned i = 0; i < caseCount; i++)
+    {
+        FlowEdge* const edge = jumpTable[i];
+        weight_t const  caseLikelihood =
+            likelyToReachSwitch ? (scaleFactor * edge->getLikelihood() / edge->getDupCount()) : (1.0 / caseCount);
+
+        if ((i == 0) || (edge != jumpTable[i - 1]))
+        {
+            runIndex = (i == 0) ? 0 : runIndex + 1;
+            runs[runIndex].firstCase  = i;
+            runs[runIndex].target     = edge->getDestinationBlock();
+            runs[runIndex].likelihood = 0;
+        }
+
+        runs[runIndex].likelihood += caseLikelihood;
+    }
+
+    assert(runIndex == runCount - 1);
+
+    // The switch no longer branches to any of the jump table targets, the search
+    // tree below adds the edges it needs.
+    for (unsigned i = 0; i < caseCount; i++)
+    {
+        comp->fgRemoveRefPred(jumpTable[i]);
+    }
+
+    struct SearchNode
+    {
+        BasicBlock* block;
+        unsigned    lo;
+        unsigned    hi;
+    };
+
+    ArrayStack<SearchNode> pending(comp->getAllocator(CMK_ArrayStack));
+    pending.Push({bbSwitch, 0, runCount - 1});
+
+    while (!pending.Empty())
+    {
+        SearchNode const node = pending.Pop();
+        assert(node.lo < node.hi);
+
+        unsigned const mid           = (node.lo + node.hi + 1) / 2;
+        weight_t       lowLikelihood = 0;
+        weight_t       allLikelihood = 0;
+        for (unsigned i = node.lo; i <= node.hi; i++)
+        {
+            lowLikelihood += (i < mid) ? runs[i].likelihood : 0;
+            allLikelihood += runs[i].likelihood;
+        }
+
+        weight_t const trueLikelihood = (allLikelihood > 0) ? min(1.0, lowLikelihood / allLikelihood) : 0.5;
+
+        // Create the upper half last so that it immediately follows this block
+        // and the false edge can fall through.
+        BasicBlock* lowBlock  = runs[node.lo].target;
+        BasicBlock* highBlock = runs[node.hi].target;
+
+        if (mid - 1 > node.lo)
+        {
+            lowBlock = comp->fgNewBBafter(BBJ_ALWAYS, node.block, true);
+        }
+
+        if (node.hi > mid)
+        {
+            highBlock = comp->fgNewBBafter(BBJ_ALWAYS, node.block, true);
+        }
+
+        FlowEdge* const trueEdge  = comp->fgAddRefPred(lowBlock, node.block);
+        FlowEdge* const falseEdge = comp->fgAddRefPred(highBlock, node.block);
+        trueEdge->setLikelihood(trueLikelihood);
+        falseEdge->setLikelihood(1.0 - trueLikelihood);
+        node.block->SetCond(trueEdge, falseEdge);
+
+        if (mid - 1 > node.lo)
+        {
+            lowBlock->inheritWeight(node.block);
+            lowBlock->scaleBBWeight(trueLikelihood);
+            pending.Push({lowBlock, node.lo, mid - 1});
+        }
+
+        if (node.hi > mid)
+        {
+            highBlock->inheritWeight(node.block);
+            highBlock->scaleBBWeight(1.0 - trueLikelihood);
+            pending.Push({highBlock, mid, node.hi});
+        }
+
+        // Append JTRUE(LT(switchValue, firstCase(mid))) to the block.
+        GenTree* value = switchValue;
+        if (node.block != bbSwitch)
+        {
+            value = comp->gtNewLclvNode(switchValue->AsLclVar()->GetLclNum(), switchValue->TypeGet());
+        }
+
+        GenTree* bound = comp->gtNewIconNode(runs[mid].firstCase, genActualType(switchValue));
+        GenTree* cmp   = comp->gtNewOperNode(GT_LT, TYP_INT, value, bound);
+        cmp->gtFlags |= GTF_UNSIGNED;
+        GenTree* jtrue = comp->gtNewOperNode(GT_JTRUE, TYP_VOID, cmp);
+
+        if (node.block == bbSwitch)
+        {
+            LIR::AsRange(bbSwitch).InsertAfter(switchValue, bound, cmp, jtrue);
+        }
+        else
+        {
+            LIR::AsRange(node.block).InsertAtEnd(LIR::SeqTree(comp, jtrue));
+        }
+    }
+
+    return true;
+}
+
 //------------------------------------------------------------------------
 // ReplaceArgWithPutArgOrBitcast: Insert a PUTARG_* node in the right location
 // and replace the call operand with that node.
@@ -389,6 +389,11 @@ private:
                                      BasicBlock* bbSwitch,
                                      GenTree*    switchValue,
                                      weight_t    defaultLikelihood);
+    bool     TryLowerSwitchToBinarySearch(FlowEdge*   jumpTable[],
+                                          unsigned    jumpCount,
+                                          BasicBlock* bbSwitch,
+                                          GenTree*    switchValue,
+                                          weight_t    defaultLikelihood);
 
     GenTree* LowerCast(GenTree* node);
 
@@ -1430,6 +1430,77 @@ BasicBlock* LinearScan::getNextBlock()
     return nullptr;
 }
 
+//------------------------------------------------------------------------
+// applyLargeMethodLimits: Bound the register allocation work for methods
+//    with very many blocks.
+//
+// Notes:
+//    Building intervals and resolving across block boundaries both scale with
+//    the number of blocks times the number of register candidate lclVars, which
+//    makes LSRA dominate the JIT time of huge generated methods. Instead of
+//    falling back to MinOpts for such methods:
+//    - with at least JitLsraLargeMethodBlocks blocks, only the hottest
+//      JitLsraLargeMethodCandidates tracked lclVars remain register candidates;
+//      the rest live on the stack.
+//    - with at least JitLsraSimpleAllocBlocks blocks, lclVars are not
+//      enregistered at all and we only allocate registers for tree temps.
+//
+void LinearScan::applyLargeMethodLimits()
+{
+    limitRegisterCandidates          = false;
+    registerCandidateWeightThreshold = 0;
+
+    if (!enregisterLocalVars)
+    {
+        return;
+    }
+
+    const unsigned blockCount   = compiler->fgBBcount;
+    const int      simpleBlocks = JitConfig.JitLsraSimpleAllocBlocks();
+    if ((simpleBlocks > 0) && (blockCount >= (unsigned)simpleBlocks))
+    {
+        JITDUMP("Not enregistering lclVars: %u blocks (JitLsraSimpleAllocBlocks=%d)\n", blockCount, simpleBlocks);
+        enregisterLocalVars = false;
+        return;
+    }
+
+    const int largeBlocks   = JitConfig.JitLsraLargeMethodBlocks();
+    const int maxCandidates = JitConfig.JitLsraLargeMethodCandidates();
+    if ((largeBlocks <= 0) || (blockCount < (unsigned)largeBlocks) || (maxCandidates <= 0) ||
+        (compiler->lvaTrackedCount <= (unsigned)maxCandidates))
+    {
+        return;
+    }
+
+    // This runs before identifyCandidates, so only look at the lclVars here: isRegCandidate
+    // updates their ref counts. Unreferenced lclVars don't compete for registers.
+    weight_t* weights = new (compiler, CMK_LSRA) weight_t[compiler->lvaTrackedCount];
+    unsigned  count   = 0;
+    for (unsigned varIndex = 0; varIndex < compiler->lvaTrackedCount; varIndex++)
+    {
+        const LclVarDsc* varDsc = compiler->lvaGetDescByTrackedIndex(varIndex);
+        if (!varDsc->lvDoNotEnregister && (varDsc->lvRefCnt() != 0) && !varTypeIsStruct(varDsc))
+        {
+            weights[count++] = varDsc->lvRefCntWtd();
+        }
+    }
+
+    if (count <= (unsigned)maxCandidates)
+    {
+        return;
+    }
+
+    jitstd::sort(weights, weights + count, [](weight_t w1, weight_t w2) {
+        return w1 > w2;
+    });
+
+    limitRegisterCandidates          = true;
+    registerCandidateWeightThreshold = weights[maxCandidates - 1];
+
+    JITDUMP("Large method (%u blocks): limiting %u register candidates to those with weight >= " FMT_WT "\n",
+            blockCount, count, registerCandidateWeightThreshold);
+}
+
 //------------------------------------------------------------------------
 // doLinearScan: The main method for register allocation.
 //
@@ -1450,6 +1521,8 @@ PhaseStatus LinearScan::doLinearScan()
         enregisterLocalVars = false;
     }
 
+    applyLargeMethodLimits();
+
     splitBBNumToTargetBBNumMap = nullptr;
 
     // This is complicated by the fact that physical registers have refs associated
@@ -2000,7 +2073,9 @@ void LinearScan::identifyCandidates()
         // the same register assignment throughout
         varDsc->lvRegister = false;
 
-        if (!isRegCandidate(varDsc))
+        // Struct locals are left alone as multi-reg uses may already depend on them being candidates.
+        if (!isRegCandidate(varDsc) || (limitRegisterCandidates && !varTypeIsStruct(varDsc) &&
+                                        (varDsc->lvRefCntWtd() < registerCandidateWeightThreshold)))
         {
             varDsc->lvLRACandidate = 0;
             if (varDsc->lvTracked)
@@ -1696,6 +1696,13 @@ private:
     // True if there are any register candidate lclVars available for allocation.
     bool enregisterLocalVars;
 
+    // For methods with very many blocks, only lclVars with a weighted ref count of at least
+    // registerCandidateWeightThreshold are register candidates. See applyLargeMethodLimits().
+    bool     limitRegisterCandidates;
+    weight_t registerCandidateWeightThreshold;
+
+    void applyLargeMethodLimits();
+
     virtual bool willEnregisterLocalVars() const
     {
         return enregisterLocalVars;
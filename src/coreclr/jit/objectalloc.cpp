@@ -26,13 +26,13 @@ XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 //    PhaseStatus indicating, what, if anything, was modified
 //
 // Notes:
-//    Runs only if Compiler::optMethodFlags has flag OMF_HAS_NEWOBJ set.
+//    Runs only if Compiler::optMethodFlags has flag OMF_HAS_NEWOBJ or OMF_HAS_NEWARRAY set.
 //
 PhaseStatus ObjectAllocator::DoPhase()
 {
-    if ((comp->optMethodFlags & OMF_HAS_NEWOBJ) == 0)
+    if ((comp->optMethodFlags & (OMF_HAS_NEWOBJ | OMF_HAS_NEWARRAY)) == 0)
     {
-        JITDUMP("no newobjs in this method; punting\n");
+        JITDUMP("no newobjs or newarrs in this method; punting\n");
         return PhaseStatus::MODIFIED_NOTHING;
     }
 
@@ -331,15 +331,71 @@ void ObjectAllocator::ComputeStackObjectPointers(BitVecTraits* bitVecTraits)
     }
 }
 
+//------------------------------------------------------------------------
+// IsStackAllocatableNewArr: Check if the tree is a call to a new array helper
+//                           with a constant length that we know how to replace
+//                           with a stack allocation.
+//
+// Arguments:
+//    tree   - tree to check
+//    length - [out] length of the array
+//
+// Return Value:
+//    true if the tree is such an array allocation.
+
+bool ObjectAllocator::IsStackAllocatableNewArr(GenTree* tree, unsigned int* length)
+{
+    if (!tree->IsHelperCall())
+    {
+        return false;
+    }
+
+    GenTreeCall* const    call   = tree->AsCall();
+    const CorInfoHelpFunc helper = comp->eeGetHelperNum(call->gtCallMethHnd);
+
+    // The ALIGN8 and frozen allocators have requirements we don't
+    // model on the stack, and the ReadyToRun helper has no explicit
+    // method table argument.
+    if ((helper != CORINFO_HELP_NEWARR_1_VC) && (helper != CORINFO_HELP_NEWARR_1_DIRECT))
+    {
+        return false;
+    }
+
+    if (call->compileTimeHelperArgumentHandle == nullptr)
+    {
+        return false;
+    }
+
+    GenTree* const methodTable = call->gtArgs.GetUserArgByIndex(0)->GetNode();
+    GenTree* const arrayLength = comp->getArrayLengthFromAllocation(call DEBUGARG(nullptr));
+
+    // TODO-ObjectStackAllocation: handle runtime lookups of the array type.
+    if (!methodTable->IsIconHandle(GTF_ICON_CLASS_HDL) || (arrayLength == nullptr) || !arrayLength->IsCnsIntOrI())
+    {
+        return false;
+    }
+
+    const ssize_t value = arrayLength->AsIntCon()->IconValue();
+    if ((value < 0) || (value > (ssize_t)s_StackAllocMaxSize))
+    {
+        return false;
+    }
+
+    *length = (unsigned int)value;
+    return true;
+}
+
 //------------------------------------------------------------------------
 // MorphAllocObjNodes: Morph each GT_ALLOCOBJ node either into an
 //                     allocation helper call or stack allocation.
+//                     Also replace new array helper calls with stack
+//                     allocations where possible.
 //
 // Returns:
 //    true if any allocation was done as a stack allocation.
 //
 // Notes:
-//    Runs only over the blocks having bbFlags BBF_HAS_NEWOBJ set.
+//    Runs only over the blocks having bbFlags BBF_HAS_NEWOBJ or BBF_HAS_NEWARR set.
 
 bool ObjectAllocator::MorphAllocObjNodes()
 {
@@ -350,9 +406,10 @@ bool ObjectAllocator::MorphAllocObjNodes()
     for (BasicBlock* const block : comp->Blocks())
     {
         const bool basicBlockHasNewObj       = block->HasFlag(BBF_HAS_NEWOBJ);
+        const bool basicBlockHasNewArr       = block->HasFlag(BBF_HAS_NEWARR);
         const bool basicBlockHasBackwardJump = block->HasFlag(BBF_BACKWARD_JUMP);
 #ifndef DEBUG
-        if (!basicBlockHasNewObj)
+        if (!basicBlockHasNewObj && !basicBlockHasNewArr)
         {
             continue;
         }
@@ -364,6 +421,7 @@ bool ObjectAllocator::MorphAllocObjNodes()
             GenTree* data     = nullptr;
 
             bool canonicalAllocObjFound = false;
+            bool canonicalNewArrFound   = false;
 
             if (stmtExpr->OperIs(GT_STORE_LCL_VAR) && stmtExpr->TypeIs(TYP_REF))
             {
@@ -373,9 +431,47 @@ bool ObjectAllocator::MorphAllocObjNodes()
                 {
                     canonicalAllocObjFound = true;
                 }
+                else if (basicBlockHasNewArr && data->IsHelperCall())
+                {
+                    canonicalNewArrFound = true;
+                }
             }
 
-            if (canonicalAllocObjFound)
+            if (canonicalNewArrFound)
+            {
+                //------------------------------------------------------------------------
+                // We look for the following expression tree
+                //  STMTx (IL 0x... ???)
+                //    * STORE_LCL_VAR   ref
+                //    \--*  CALL help ref    CORINFO_HELP_NEWARR_1_VC
+                //       +--*  CNS_INT(h) long
+                //       \--*  CNS_INT    long
+                //------------------------------------------------------------------------
+
+                unsigned int lclNum    = stmtExpr->AsLclVar()->GetLclNum();
+                unsigned int length    = 0;
+                unsigned int blockSize = 0;
+
+                // Don't attempt to do stack allocations inside basic blocks that may be in a loop.
+                if (IsObjectStackAllocationEnabled() && !basicBlockHasBackwardJump &&
+                    IsStackAllocatableNewArr(data, &length) &&
+                    CanAllocateArrayOnStack(lclNum,
+                                            (CORINFO_CLASS_HANDLE)data->AsCall()->compileTimeHelperArgumentHandle,
+                                            length, &blockSize))
+                {
+                    JITDUMP("Allocating array local variable V%02u on the stack\n", lclNum);
+
+                    const unsigned int stackLclNum =
+                        MorphNewArrNodeIntoStackAlloc(data->AsCall(), length, blockSize, block, stmt);
+                    m_HeapLocalToStackLocalMap.AddOrUpdate(lclNum, stackLclNum);
+                    MarkLclVarAsDefinitelyStackPointing(lclNum);
+                    MarkLclVarAsPossiblyStackPointing(lclNum);
+                    stmt->GetRootNode()->gtBashToNOP();
+                    comp->optMethodFlags |= OMF_HAS_OBJSTACKALLOC;
+                    didStackAllocate = true;
+                }
+            }
+            else if (canonicalAllocObjFound)
             {
                 assert(basicBlockHasNewObj);
                 //------------------------------------------------------------------------
@@ -389,14 +485,16 @@ bool ObjectAllocator::MorphAllocObjNodes()
                 GenTreeAllocObj*     asAllocObj = data->AsAllocObj();
                 unsigned int         lclNum     = stmtExpr->AsLclVar()->GetLclNum();
                 CORINFO_CLASS_HANDLE clsHnd     = data->AsAllocObj()->gtAllocObjClsHnd;
+                unsigned int         blockSize  = 0;
 
                 // Don't attempt to do stack allocations inside basic blocks that may be in a loop.
                 if (IsObjectStackAllocationEnabled() && !basicBlockHasBackwardJump &&
-                    CanAllocateLclVarOnStack(lclNum, clsHnd))
+                    CanAllocateLclVarOnStack(lclNum, clsHnd, &blockSize))
                 {
                     JITDUMP("Allocating local variable V%02u on the stack\n", lclNum);
 
-                    const unsigned int stackLclNum = MorphAllocObjNodeIntoStackAlloc(asAllocObj, block, stmt);
+                    const unsigned int stackLclNum =
+                        MorphAllocObjNodeIntoStackAlloc(asAllocObj, blockSize, block, stmt);
                     m_HeapLocalToStackLocalMap.AddOrUpdate(lclNum, stackLclNum);
                     // We keep the set of possibly-stack-pointing pointers as a superset of the set of
                     // definitely-stack-pointing pointers. All definitely-stack-pointing pointers are in both sets.
@@ -487,9 +585,10 @@ GenTree* ObjectAllocator::MorphAllocObjNodeIntoHelperCall(GenTreeAllocObj* alloc
 // MorphAllocObjNodeIntoStackAlloc: Morph a GT_ALLOCOBJ node into stack
 //                                  allocation.
 // Arguments:
-//    allocObj - GT_ALLOCOBJ that will be replaced by a stack allocation
-//    block    - a basic block where allocObj is
-//    stmt     - a statement where allocObj is
+//    allocObj  - GT_ALLOCOBJ that will be replaced by a stack allocation
+//    blockSize - size of the stack allocation
+//    block     - a basic block where allocObj is
+//    stmt      - a statement where allocObj is
 //
 // Return Value:
 //    local num for the new stack allocated local
@@ -498,6 +597,7 @@ GenTree* ObjectAllocator::MorphAllocObjNodeIntoHelperCall(GenTreeAllocObj* alloc
 //    This function can insert additional statements before stmt.
 
 unsigned int ObjectAllocator::MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* allocObj,
+                                                              unsigned int     blockSize,
                                                               BasicBlock*      block,
                                                               Statement*       stmt)
 {
@@ -507,9 +607,107 @@ unsigned int ObjectAllocator::MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* a
     const bool         shortLifetime = false;
     const unsigned int lclNum = comp->lvaGrabTemp(shortLifetime DEBUGARG("MorphAllocObjNodeIntoStackAlloc temp"));
     const int          unsafeValueClsCheck = true;
-    comp->lvaSetStruct(lclNum, allocObj->gtAllocObjClsHnd, unsafeValueClsCheck);
 
-    // Initialize the object memory if necessary.
+    if (comp->info.compCompHnd->isValueClass(allocObj->gtAllocObjClsHnd))
+    {
+        // A box: the method table pointer followed by the struct, which has no gc fields.
+        comp->lvaSetStruct(lclNum, comp->typGetBlkLayout(blockSize), unsafeValueClsCheck);
+    }
+    else
+    {
+        comp->lvaSetStruct(lclNum, allocObj->gtAllocObjClsHnd, unsafeValueClsCheck);
+    }
+
+    InitializeStackAllocatedLocal(lclNum, block, stmt);
+
+    //------------------------------------------------------------------------
+    // STMTx (IL 0x... ???)
+    //   * STORE_LCL_FLD    long
+    //   \--*  CNS_INT(h) long
+    //------------------------------------------------------------------------
+
+    // Initialize the method table pointer.
+    GenTree*   init     = comp->gtNewStoreLclFldNode(lclNum, TYP_I_IMPL, 0, allocObj->gtGetOp1());
+    Statement* initStmt = comp->gtNewStmt(init);
+
+    comp->fgInsertStmtBefore(block, stmt, initStmt);
+
+    return lclNum;
+}
+
+//------------------------------------------------------------------------
+// MorphNewArrNodeIntoStackAlloc: Morph a new array helper call into stack
+//                                allocation.
+// Arguments:
+//    newArr    - new array helper call that will be replaced by a stack allocation
+//    length    - number of elements in the array
+//    blockSize - size of the stack allocation
+//    block     - a basic block where newArr is
+//    stmt      - a statement where newArr is
+//
+// Return Value:
+//    local num for the new stack allocated local
+//
+// Notes:
+//    This function can insert additional statements before stmt.
+
+unsigned int ObjectAllocator::MorphNewArrNodeIntoStackAlloc(
+    GenTreeCall* newArr, unsigned int length, unsigned int blockSize, BasicBlock* block, Statement* stmt)
+{
+    assert(newArr != nullptr);
+    assert(m_AnalysisDone);
+
+    const bool         shortLifetime = false;
+    const unsigned int lclNum = comp->lvaGrabTemp(shortLifetime DEBUGARG("MorphNewArrNodeIntoStackAlloc temp"));
+    const int          unsafeValueClsCheck = true;
+
+    // Arrays we allocate on the stack don't have gc references.
+    comp->lvaSetStruct(lclNum, comp->typGetBlkLayout(blockSize), unsafeValueClsCheck);
+
+    InitializeStackAllocatedLocal(lclNum, block, stmt);
+
+    //------------------------------------------------------------------------
+    // STMTx (IL 0x... ???)
+    //   * STORE_LCL_FLD    long
+    //   \--*  CNS_INT(h) long
+    //------------------------------------------------------------------------
+
+    // Initialize the method table pointer.
+    GenTree*   methodTable = newArr->gtArgs.GetUserArgByIndex(0)->GetNode();
+    GenTree*   init        = comp->gtNewStoreLclFldNode(lclNum, TYP_I_IMPL, 0, methodTable);
+    Statement* initStmt    = comp->gtNewStmt(init);
+
+    comp->fgInsertStmtBefore(block, stmt, initStmt);
+
+    //------------------------------------------------------------------------
+    // STMTx (IL 0x... ???)
+    //   * STORE_LCL_FLD    int
+    //   \--*  CNS_INT    int
+    //------------------------------------------------------------------------
+
+    // Initialize the length.
+    init     = comp->gtNewStoreLclFldNode(lclNum, TYP_INT, OFFSETOF__CORINFO_Array__length,
+                                          comp->gtNewIconNode(length, TYP_INT));
+    initStmt = comp->gtNewStmt(init);
+
+    comp->fgInsertStmtBefore(block, stmt, initStmt);
+
+    return lclNum;
+}
+
+//------------------------------------------------------------------------
+// InitializeStackAllocatedLocal: Zero the memory of a new stack allocated
+//                                local, or arrange for the prolog to do it.
+// Arguments:
+//    lclNum - the stack allocated local
+//    block  - a basic block where the allocation is
+//    stmt   - a statement where the allocation is
+//
+// Notes:
+//    This function can insert additional statements before stmt.
+
+void ObjectAllocator::InitializeStackAllocatedLocal(unsigned int lclNum, BasicBlock* block, Statement* stmt)
+{
     bool             bbInALoop  = block->HasFlag(BBF_BACKWARD_JUMP);
     bool             bbIsReturn = block->KindIs(BBJ_RETURN);
     LclVarDsc* const lclDsc     = comp->lvaGetDesc(lclNum);
@@ -532,20 +730,6 @@ unsigned int ObjectAllocator::MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* a
         lclDsc->lvSuppressedZeroInit = 1;
         comp->compSuppressedZeroInit = true;
     }
-
-    //------------------------------------------------------------------------
-    // STMTx (IL 0x... ???)
-    //   * STORE_LCL_FLD    long
-    //   \--*  CNS_INT(h) long
-    //------------------------------------------------------------------------
-
-    // Initialize the method table pointer.
-    GenTree*   init     = comp->gtNewStoreLclFldNode(lclNum, TYP_I_IMPL, 0, allocObj->gtGetOp1());
-    Statement* initStmt = comp->gtNewStmt(init);
-
-    comp->fgInsertStmtBefore(block, stmt, initStmt);
-
-    return lclNum;
 }
 
 //------------------------------------------------------------------------
@@ -621,7 +805,18 @@ bool ObjectAllocator::CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parent
                 keepChecking = true;
                 break;
 
+            case GT_INDEX_ADDR:
+                if (tree != parent->AsIndexAddr()->Arr())
+                {
+                    break;
+                }
+                // Check whether the element address escapes via its grandparent.
+                ++parentIndex;
+                keepChecking = true;
+                break;
+
             case GT_STOREIND:
+            case GT_STORE_BLK:
                 if (tree != parent->AsIndir()->Addr())
                 {
                     // TODO-ObjectStackAllocation: track stores to fields.
@@ -629,6 +824,8 @@ bool ObjectAllocator::CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parent
                 }
                 FALLTHROUGH;
             case GT_IND:
+            case GT_BLK:
+            case GT_ARR_LENGTH:
                 // Address of the field/ind is not taken so the local doesn't escape.
                 canLclVarEscapeViaParentStack = false;
                 break;
@@ -717,7 +914,14 @@ void ObjectAllocator::UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* p
                 keepChecking = true;
                 break;
 
+            case GT_INDEX_ADDR:
+                // The element address stays a byref wherever the array is.
+                ++parentIndex;
+                keepChecking = true;
+                break;
+
             case GT_STOREIND:
+            case GT_STORE_BLK:
                 assert(tree == parent->AsIndir()->Addr());
 
                 // The new target could be *not* on the heap.
@@ -733,6 +937,8 @@ void ObjectAllocator::UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* p
                 break;
 
             case GT_IND:
+            case GT_BLK:
+            case GT_ARR_LENGTH:
                 break;
 
             default:
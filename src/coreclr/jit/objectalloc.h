@@ -47,7 +47,11 @@ protected:
     virtual PhaseStatus DoPhase() override;
 
 private:
-    bool         CanAllocateLclVarOnStack(unsigned int lclNum, CORINFO_CLASS_HANDLE clsHnd);
+    bool         CanAllocateLclVarOnStack(unsigned int lclNum, CORINFO_CLASS_HANDLE clsHnd, unsigned int* blockSize);
+    bool         CanAllocateArrayOnStack(unsigned int         lclNum,
+                                         CORINFO_CLASS_HANDLE clsHnd,
+                                         unsigned int         length,
+                                         unsigned int*        blockSize);
     bool         CanLclVarEscape(unsigned int lclNum);
     void         MarkLclVarAsPossiblyStackPointing(unsigned int lclNum);
     void         MarkLclVarAsDefinitelyStackPointing(unsigned int lclNum);
@@ -62,7 +66,17 @@ private:
     bool         MorphAllocObjNodes();
     void         RewriteUses();
     GenTree*     MorphAllocObjNodeIntoHelperCall(GenTreeAllocObj* allocObj);
-    unsigned int MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* allocObj, BasicBlock* block, Statement* stmt);
+    unsigned int MorphAllocObjNodeIntoStackAlloc(GenTreeAllocObj* allocObj,
+                                                 unsigned int     blockSize,
+                                                 BasicBlock*      block,
+                                                 Statement*       stmt);
+    unsigned int MorphNewArrNodeIntoStackAlloc(GenTreeCall* newArr,
+                                               unsigned int length,
+                                               unsigned int blockSize,
+                                               BasicBlock*  block,
+                                               Statement*   stmt);
+    void         InitializeStackAllocatedLocal(unsigned int lclNum, BasicBlock* block, Statement* stmt);
+    bool         IsStackAllocatableNewArr(GenTree* tree, unsigned int* length);
     struct BuildConnGraphVisitorCallbackData;
     bool CanLclVarEscapeViaParentStack(ArrayStack<GenTree*>* parentStack, unsigned int lclNum);
     void UpdateAncestorTypes(GenTree* tree, ArrayStack<GenTree*>* parentStack, var_types newType);
@@ -109,35 +123,101 @@ inline void ObjectAllocator::EnableObjectStackAllocation()
 //                           allocated on the stack.
 //
 // Arguments:
-//    lclNum   - Local variable number
-//    clsHnd   - Class handle of the variable class
+//    lclNum    - Local variable number
+//    clsHnd    - Class handle of the variable class
+//    blockSize - [out] size of the stack allocation
 //
 // Return Value:
 //    Returns true iff local variable can be allocated on the stack.
 //
 // Notes:
-//    Stack allocation of objects with gc fields and boxed objects is currently disabled.
+//    Stack allocation of boxed structs with gc fields is currently disabled.
 
-inline bool ObjectAllocator::CanAllocateLclVarOnStack(unsigned int lclNum, CORINFO_CLASS_HANDLE clsHnd)
+inline bool ObjectAllocator::CanAllocateLclVarOnStack(unsigned int         lclNum,
+                                                      CORINFO_CLASS_HANDLE clsHnd,
+                                                      unsigned int*        blockSize)
 {
     assert(m_AnalysisDone);
 
-    DWORD classAttribs = comp->info.compCompHnd->getClassAttribs(clsHnd);
+    DWORD        classAttribs = comp->info.compCompHnd->getClassAttribs(clsHnd);
+    unsigned int classSize    = 0;
 
     if ((classAttribs & CORINFO_FLG_VALUECLASS) != 0)
     {
-        // TODO-ObjectStackAllocation: enable stack allocation of boxed structs
+        // This is a box. We use a block layout for it so the gc won't see
+        // any gc fields the struct may have.
+        ClassLayout* const layout = comp->typGetObjLayout(clsHnd);
+
+        if (layout->HasGCPtr())
+        {
+            // TODO-ObjectStackAllocation: enable stack allocation of boxed structs with gc fields
+            return false;
+        }
+
+        // Shared box temps may be reused for other boxes.
+        if (!comp->lvaGetDesc(lclNum)->lvSingleDef)
+        {
+            return false;
+        }
+
+        classSize = TARGET_POINTER_SIZE + layout->GetSize();
+    }
+    else
+    {
+        if (!comp->info.compCompHnd->canAllocateOnStack(clsHnd))
+        {
+            return false;
+        }
+
+        classSize = comp->info.compCompHnd->getHeapClassSize(clsHnd);
+    }
+
+    *blockSize = classSize;
+
+    return !CanLclVarEscape(lclNum) && (classSize <= s_StackAllocMaxSize);
+}
+
+//------------------------------------------------------------------------
+// CanAllocateArrayOnStack: Returns true iff the array assigned to the
+//                          local variable can be allocated on the stack.
+//
+// Arguments:
+//    lclNum    - Local variable number
+//    clsHnd    - Class handle of the array
+//    length    - Number of elements in the array
+//    blockSize - [out] size of the stack allocation
+//
+// Return Value:
+//    Returns true iff the array can be allocated on the stack.
+//
+// Notes:
+//    Only arrays of primitive types are currently allocated on the stack.
+
+inline bool ObjectAllocator::CanAllocateArrayOnStack(unsigned int         lclNum,
+                                                     CORINFO_CLASS_HANDLE clsHnd,
+                                                     unsigned int         length,
+                                                     unsigned int*        blockSize)
+{
+    assert(m_AnalysisDone);
+
+    CORINFO_CLASS_HANDLE elemClsHnd = NO_CLASS_HANDLE;
+    var_types            elemType   = JITtype2varType(comp->info.compCompHnd->getChildType(clsHnd, &elemClsHnd));
+
+    if (!varTypeIsArithmetic(elemType))
+    {
+        // TODO-ObjectStackAllocation: enable stack allocation of arrays of structs and refs
         return false;
     }
 
-    if (!comp->info.compCompHnd->canAllocateOnStack(clsHnd))
+    if (!comp->lvaGetDesc(lclNum)->lvSingleDef || (length > s_StackAllocMaxSize))
     {
         return false;
     }
 
-    const unsigned int classSize = comp->info.compCompHnd->getHeapClassSize(clsHnd);
+    const unsigned int arraySize = OFFSETOF__CORINFO_Array__data + length * genTypeSize(elemType);
+    *blockSize                   = roundUp(arraySize, TARGET_POINTER_SIZE);
 
-    return !CanLclVarEscape(lclNum) && (classSize <= s_StackAllocMaxSize);
+    return !CanLclVarEscape(lclNum) && (*blockSize <= s_StackAllocMaxSize);
 }
 
 //------------------------------------------------------------------------
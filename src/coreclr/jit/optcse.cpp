@@ -2311,6 +2311,15 @@ CSE_HeuristicParameterized::CSE_HeuristicParameterized(Compiler* pCompiler)
         m_parameters[i] = s_defaultParameters[i];
     }
 
+    // ...unless overridden by parameters trained for a particular code base
+    //
+    const WCHAR* const configParameters = JitConfig.JitRLCSEGreedyParameters();
+
+    if (configParameters != nullptr)
+    {
+        ParseParameters(configParameters);
+    }
+
     // These get set during...
     //
     m_localWeights = nullptr;
@@ -2330,6 +2339,46 @@ CSE_HeuristicParameterized::CSE_HeuristicParameterized(Compiler* pCompiler)
 #endif
 }
 
+//------------------------------------------------------------------------
+// ParseParameters: set parameters from a comma-separated list of values
+//
+// Arguments:
+//   str - list of values, in parameter order
+//
+// Notes:
+//   Parameters beyond the end of the list keep their current values.
+//   This runs for every method in release builds, so it parses in place
+//   rather than allocating a ConfigDoubleArray.
+//
+void CSE_HeuristicParameterized::ParseParameters(const WCHAR* str)
+{
+    const WCHAR* p     = str;
+    unsigned     index = 0;
+
+    while ((*p != 0) && (index < numParameters))
+    {
+        if (*p == L',')
+        {
+            p++;
+            continue;
+        }
+
+        WCHAR* pNext = nullptr;
+        errno        = 0;
+
+        const double value = u16_strtod(p, &pNext);
+
+        if ((pNext == p) || (errno != 0))
+        {
+            JITDUMP("Malformed CSE parameter list, ignoring the remaining values\n");
+            break;
+        }
+
+        m_parameters[index++] = value;
+        p                     = pNext;
+    }
+}
+
 //------------------------------------------------------------------------
 // ConsiderCandidates: examine candidates and perform CSEs.
 //
@@ -180,6 +180,7 @@ protected:
 
 public:
     CSE_HeuristicParameterized(Compiler*);
+    void ParseParameters(const WCHAR* str);
     void ConsiderCandidates();
     bool ConsiderTree(GenTree* tree, bool isReturn);
     void CaptureLocalWeights();
@@ -58,25 +58,27 @@ struct Access
     // Number of times this is passed as a call arg. We insert writebacks
     // before these.
     unsigned CountCallArgs = 0;
+    // Number of times this access is the destination of a store. Only
+    // stores can make a replacement newer than the struct local, so
+    // without them the writebacks before call args are never needed.
+    unsigned CountStoreDestination = 0;
 
-    weight_t CountWtd               = 0;
-    weight_t CountStoredFromCallWtd = 0;
-    weight_t CountCallArgsWtd       = 0;
+    weight_t CountWtd                 = 0;
+    weight_t CountStoredFromCallWtd   = 0;
+    weight_t CountCallArgsWtd         = 0;
+    weight_t CountStoreDestinationWtd = 0;
 
 #ifdef DEBUG
     // Number of times this access is the source of a store.
     unsigned CountStoreSource = 0;
-    // Number of times this access is the destination of a store.
-    unsigned CountStoreDestination = 0;
-    unsigned CountReturns          = 0;
+    unsigned CountReturns     = 0;
     // Number of times this is stored by being passed as the retbuf.
     // These stores need a readback
     unsigned CountPassedAsRetbuf = 0;
 
-    weight_t CountStoreSourceWtd      = 0;
-    weight_t CountStoreDestinationWtd = 0;
-    weight_t CountReturnsWtd          = 0;
-    weight_t CountPassedAsRetbufWtd   = 0;
+    weight_t CountStoreSourceWtd    = 0;
+    weight_t CountReturnsWtd        = 0;
+    weight_t CountPassedAsRetbufWtd = 0;
 #endif
 
     Access(unsigned offset, var_types accessType, ClassLayout* layout)
@@ -111,14 +113,14 @@ struct Access
 
 enum class AccessKindFlags : uint32_t
 {
-    None             = 0,
-    IsCallArg        = 1,
-    IsStoredFromCall = 2,
-    IsCallRetBuf     = 4,
+    None               = 0,
+    IsCallArg          = 1,
+    IsStoredFromCall   = 2,
+    IsCallRetBuf       = 4,
+    IsStoreDestination = 8,
 #ifdef DEBUG
-    IsStoreSource      = 8,
-    IsStoreDestination = 16,
-    IsReturned         = 32,
+    IsStoreSource = 16,
+    IsReturned    = 32,
 #endif
 };
 
@@ -360,6 +362,12 @@ public:
             access->CountStoredFromCallWtd += weight;
         }
 
+        if ((flags & AccessKindFlags::IsStoreDestination) != AccessKindFlags::None)
+        {
+            access->CountStoreDestination++;
+            access->CountStoreDestinationWtd += weight;
+        }
+
 #ifdef DEBUG
         if ((flags & AccessKindFlags::IsCallRetBuf) != AccessKindFlags::None)
         {
@@ -373,12 +381,6 @@ public:
             access->CountStoreSourceWtd += weight;
         }
 
-        if ((flags & AccessKindFlags::IsStoreDestination) != AccessKindFlags::None)
-        {
-            access->CountStoreDestination++;
-            access->CountStoreDestinationWtd += weight;
-        }
-
         if ((flags & AccessKindFlags::IsReturned) != AccessKindFlags::None)
         {
             access->CountReturns++;
@@ -661,6 +663,7 @@ public:
 
         unsigned countOverlappedCallArg        = 0;
         unsigned countOverlappedStoredFromCall = 0;
+        unsigned countOverlappedStores         = access.CountStoreDestination;
 
         weight_t countOverlappedCallArgWtd        = 0;
         weight_t countOverlappedStoredFromCallWtd = 0;
@@ -685,6 +688,7 @@ public:
 
             countOverlappedCallArg += otherAccess.CountCallArgs;
             countOverlappedStoredFromCall += otherAccess.CountStoredFromCall;
+            countOverlappedStores += otherAccess.CountStoreDestination;
 
             countOverlappedCallArgWtd += otherAccess.CountCallArgsWtd;
             countOverlappedStoredFromCallWtd += otherAccess.CountStoredFromCallWtd;
@@ -765,8 +769,19 @@ public:
         // Thus _not_ accounting for these is a CQ improvements.
         // (Additionally, if it weren't we could teach the backend some
         // store-forwarding/forward sub to make the write backs "free".)
-        weight_t countWriteBacksWtd = countOverlappedCallArgWtd;
-        unsigned countWriteBacks    = countOverlappedCallArg;
+        //
+        // A replacement that is never stored to is only ever read back, so the
+        // struct local stays up to date and none of these writebacks happen.
+        // This is common for span fields of reader-like structs that are
+        // passed around by value while only their position fields change.
+        weight_t countWriteBacksWtd = 0;
+        unsigned countWriteBacks    = 0;
+        if (countOverlappedStores > 0)
+        {
+            countWriteBacksWtd = countOverlappedCallArgWtd;
+            countWriteBacks    = countOverlappedCallArg;
+        }
+
         costWith += countWriteBacksWtd * writeBackCost;
         sizeWith += countWriteBacks * writeBackSize;
 
@@ -1415,7 +1430,7 @@ private:
         AccessKindFlags flags = AccessKindFlags::None;
         if (lcl->OperIsLocalStore())
         {
-            INDEBUG(flags |= AccessKindFlags::IsStoreDestination);
+            flags |= AccessKindFlags::IsStoreDestination;
 
             if (lcl->AsLclVarCommon()->Data()->gtEffectiveVal()->IsCall())
             {
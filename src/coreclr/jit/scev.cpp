@@ -1761,3 +1761,174 @@ Scev* ScalarEvolutionContext::ComputeExitNotTakenCount(BasicBlock* exiting)
 
     return backedgeCount;
 }
+
+//------------------------------------------------------------------------
+// IsIndexInBounds:
+//   Try to prove that an index computed inside the loop is always within the
+//   bounds of a length that is invariant in the loop, by relating the index
+//   to the IV that the exit test of the loop compares against that length.
+//
+// Parameters:
+//   exiting  - An exiting BBJ_COND block that dominates all backedges and
+//              that runs at most once per iteration.
+//   block    - The block containing the index
+//   index    - The index tree
+//   lengthVN - Conservative VN of the length the index is checked against
+//
+// Returns:
+//   True if 0 <= index < length holds whenever the index is evaluated.
+//
+// Remarks:
+//   Handles the loop staying in the loop while <L, testStart, step> < length
+//   + offset (or <=), with an index <L, indexStart, step>. On iteration k > 0
+//   the test passed on iteration k - 1, so the index is below the length when
+//   indexStart - testStart + step + offset (+ 1 for <=) <= 0. The first
+//   iteration is covered by proving that the loop guard already did the same
+//   comparison for the value the test IV had "before" the first iteration.
+//
+//   This catches strided and offset accesses such as
+//
+//     for (int i = 0; i < len - 1; i += 2) { a[i]; a[i + 1]; }
+//
+//   where the index is not syntactically the compared IV.
+//
+bool ScalarEvolutionContext::IsIndexInBounds(BasicBlock* exiting, BasicBlock* block, GenTree* index, ValueNum lengthVN)
+{
+    assert(exiting->KindIs(BBJ_COND));
+    assert(m_loop->ContainsBlock(exiting->GetTrueTarget()) != m_loop->ContainsBlock(exiting->GetFalseTarget()));
+
+    if (genActualType(index) != TYP_INT)
+    {
+        return false;
+    }
+
+    GenTree* cond = exiting->lastStmt()->GetRootNode()->gtGetOp1();
+    if (!cond->OperIs(GT_LT, GT_LE, GT_GT, GT_GE) || (genActualType(cond->gtGetOp1()) != TYP_INT) ||
+        (genActualType(cond->gtGetOp2()) != TYP_INT))
+    {
+        return false;
+    }
+
+    Scev* indexScev = Analyze(block, index);
+    if (indexScev == nullptr)
+    {
+        return false;
+    }
+
+    indexScev = Simplify(indexScev);
+    if (!indexScev->OperIs(ScevOper::AddRec))
+    {
+        return false;
+    }
+
+    Scev* op1 = Analyze(exiting, cond->gtGetOp1());
+    Scev* op2 = Analyze(exiting, cond->gtGetOp2());
+    if ((op1 == nullptr) || (op2 == nullptr))
+    {
+        return false;
+    }
+
+    // Phrase the test such that we stay in the loop when [lhs] [stayOp] [rhs].
+    Scev*      lhs    = Simplify(op1);
+    Scev*      rhs    = Simplify(op2);
+    genTreeOps stayOp = cond->gtOper;
+    if (!m_loop->ContainsBlock(exiting->GetTrueTarget()))
+    {
+        stayOp = GenTree::ReverseRelop(stayOp);
+    }
+
+    if (rhs->OperIs(ScevOper::AddRec) && lhs->IsInvariant())
+    {
+        stayOp = GenTree::SwapRelop(stayOp);
+        std::swap(lhs, rhs);
+    }
+
+    if (!lhs->OperIs(ScevOper::AddRec) || !rhs->IsInvariant() || !GenTree::StaticOperIs(stayOp, GT_LT, GT_LE))
+    {
+        return false;
+    }
+
+    ScevAddRec* testAddRec  = (ScevAddRec*)lhs;
+    ScevAddRec* indexAddRec = (ScevAddRec*)indexScev;
+
+    int64_t testStep;
+    int64_t indexStep;
+    int64_t testStart;
+    int64_t indexStart;
+    if (!testAddRec->Step->GetConstantValue(m_comp, &testStep) ||
+        !indexAddRec->Step->GetConstantValue(m_comp, &indexStep) ||
+        !testAddRec->Start->GetConstantValue(m_comp, &testStart) ||
+        !indexAddRec->Start->GetConstantValue(m_comp, &indexStart))
+    {
+        return false;
+    }
+
+    // Constants of TYP_INT SCEVs are not necessarily sign extended.
+    testStep   = (int32_t)testStep;
+    indexStep  = (int32_t)indexStep;
+    testStart  = (int32_t)testStart;
+    indexStart = (int32_t)indexStart;
+
+    if ((testStep <= 0) || (testStep != indexStep) || (indexStart < 0))
+    {
+        return false;
+    }
+
+    // The limit has to be the length, optionally minus a constant.
+    Scev*   limit       = rhs;
+    int64_t limitOffset = 0;
+    if (limit->OperIs(ScevOper::Add) && ((ScevBinop*)limit)->Op2->GetConstantValue(m_comp, &limitOffset))
+    {
+        limit       = ((ScevBinop*)limit)->Op1;
+        limitOffset = (int32_t)limitOffset;
+    }
+
+    if (!limit->OperIs(ScevOper::Local))
+    {
+        return false;
+    }
+
+    ScevLocal*    limitLcl = (ScevLocal*)limit;
+    LclSsaVarDsc* limitSsa = m_comp->lvaGetDesc(limitLcl->LclNum)->GetPerSsaData(limitLcl->SsaNum);
+    if (m_comp->vnStore->VNConservativeNormalValue(limitSsa->m_vnPair) != lengthVN)
+    {
+        return false;
+    }
+
+    // With an unsigned test a negative offset may wrap the limit around, and
+    // a negative start means the IV is not below the limit at all.
+    const bool isUnsigned = cond->IsUnsigned();
+    if ((limitOffset > 0) || (isUnsigned && ((limitOffset != 0) || (testStart - testStep < 0))))
+    {
+        return false;
+    }
+
+    const int64_t orEqual = (stayOp == GT_LE) ? 1 : 0;
+    if (indexStart - testStart + testStep + limitOffset + orEqual > 0)
+    {
+        return false;
+    }
+
+    // The reasoning above requires the test IV to not wrap around before the loop exits.
+    VNFunc stayOpVNF = MapRelopToVNFunc(stayOp, isUnsigned);
+    VNFunc exitOpVNF = MapRelopToVNFunc(GenTree::ReverseRelop(stayOp), isUnsigned);
+    if (MayOverflowBeforeExit(testAddRec, rhs, exitOpVNF))
+    {
+        return false;
+    }
+
+    // And the test must also have passed for the value before the first iteration.
+    int64_t testBeforeLoop = testStart - testStep;
+    if (testBeforeLoop != (int32_t)testBeforeLoop)
+    {
+        return false;
+    }
+
+    ValueNum relop = m_comp->vnStore->VNForFunc(TYP_INT, stayOpVNF, m_comp->vnStore->VNForIntCon((int32_t)testBeforeLoop),
+                                                MaterializeVN(rhs));
+    RelopEvaluationResult result = EvaluateRelop(relop);
+    JITDUMP("  Loop guard for index [%06u] evaluates to %s\n", Compiler::dspTreeID(index),
+            RelopEvaluationResultString(result));
+
+    return result == RelopEvaluationResult::True;
+}
@@ -247,6 +247,7 @@ public:
     Scev* Simplify(Scev* scev);
 
     Scev* ComputeExitNotTakenCount(BasicBlock* exiting);
+    bool  IsIndexInBounds(BasicBlock* exiting, BasicBlock* block, GenTree* index, ValueNum lengthVN);
 
     GenTree* Materialize(Scev* scev);
     ValueNum MaterializeVN(Scev* scev);
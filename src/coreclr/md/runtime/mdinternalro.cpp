@@ -60,6 +60,9 @@ HRESULT MDApplyEditAndContinue(         // S_OK or error.
 //*****************************************************************************
 MDInternalRO::MDInternalRO()
  :  m_pMethodSemanticsMap(0),
+    m_pMethodParentMap(0),
+    m_pTypeDefNameMap(0),
+    m_pCustomAttributeFilter(0),
     m_cRefs(1)
 {
 } // MDInternalRO::MDInternalRO
@@ -75,6 +78,15 @@ MDInternalRO::~MDInternalRO()
     if (m_pMethodSemanticsMap)
         delete[] m_pMethodSemanticsMap;
     m_pMethodSemanticsMap = 0;
+    if (m_pMethodParentMap)
+        delete[] m_pMethodParentMap;
+    m_pMethodParentMap = 0;
+    if (m_pTypeDefNameMap)
+        delete[] m_pTypeDefNameMap;
+    m_pTypeDefNameMap = 0;
+    if (m_pCustomAttributeFilter)
+        delete[] m_pCustomAttributeFilter;
+    m_pCustomAttributeFilter = 0;
 } // MDInternalRO::~MDInternalRO
 
 //*****************************************************************************
@@ -615,7 +627,7 @@ HRESULT MDInternalRO::GetParentToken(
         break;
 
     case mdtMethodDef:
-        IfFailRet(m_LiteWeightStgdb.m_MiniMd.FindParentOfMethod(RidFromToken(tkChild), (RID *)ptkParent));
+        IfFailRet(FindParentOfMethod(RidFromToken(tkChild), (RID *)ptkParent));
         RidToToken(*ptkParent, mdtTypeDef);
         break;
 
@@ -668,6 +680,71 @@ HRESULT MDInternalRO::GetParentToken(
     return hr;
 } // MDInternalRO::GetParentToken
 
+//*****************************************************************************
+// Given a methoddef RID, return the RID of the typedef that owns it. Reflection asks for the
+// parent of the same methods over and over, so instead of binary searching the TypeDef table
+// every time, the owner of every method is recorded in one pass over the method lists.
+//*****************************************************************************
+__checkReturn
+HRESULT MDInternalRO::FindParentOfMethod(
+    RID         ridMethod,              // [IN] given methoddef RID
+    RID         *pridParent)            // [OUT] returning typedef RID
+{
+    HRESULT hr = NOERROR;
+
+    ULONG cMethods = m_LiteWeightStgdb.m_MiniMd.getCountMethods();
+
+#ifndef DACCESS_COMPILE
+    // Lazy initialization of m_pMethodParentMap
+    if ((cMethods > 10) && (m_pMethodParentMap == NULL))
+    {
+        NewArrayHolder<RID> pMethodParentMap = new (nothrow) RID[cMethods];
+        if (pMethodParentMap != NULL)
+        {
+            memset(pMethodParentMap, 0, cMethods * sizeof(RID));
+
+            ULONG cTypeDefs = m_LiteWeightStgdb.m_MiniMd.getCountTypeDefs();
+            RID ridPrevStart = 0;
+            bool fOrdered = true;
+            for (RID ridTypeDef = 1; fOrdered && (ridTypeDef <= cTypeDefs); ridTypeDef++)
+            {
+                TypeDefRec *pTypeDefRec;
+                RID ridStart;
+                RID ridEnd;
+                IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(ridTypeDef, &pTypeDefRec));
+                ridStart = m_LiteWeightStgdb.m_MiniMd.getMethodListOfTypeDef(pTypeDefRec);
+                IfFailRet(m_LiteWeightStgdb.m_MiniMd.getEndMethodListOfTypeDef(ridTypeDef, &ridEnd));
+
+                // The binary search below only works on sorted method lists, don't try to be smarter than it
+                fOrdered = (ridStart >= ridPrevStart);
+                ridPrevStart = ridStart;
+
+                for (RID ridCur = max(ridStart, (RID)1); ridCur < min(ridEnd, (RID)(cMethods + 1)); ridCur++)
+                {
+                    pMethodParentMap[ridCur - 1] = ridTypeDef;
+                }
+            }
+
+            if (fOrdered && (InterlockedCompareExchangeT<RID *>(
+                &m_pMethodParentMap, pMethodParentMap, NULL) == NULL))
+            {   // The exchange did happen, suppress of the allocated map
+                pMethodParentMap.SuppressRelease();
+            }
+        }
+    }
+#endif //!DACCESS_COMPILE
+
+    // Use m_pMethodParentMap if it has been built, methods outside of any method list are left to the search.
+    if ((m_pMethodParentMap != NULL) && (ridMethod >= 1) && (ridMethod <= cMethods) &&
+        (m_pMethodParentMap[ridMethod - 1] != 0))
+    {
+        *pridParent = m_pMethodParentMap[ridMethod - 1];
+        return S_OK;
+    }
+
+    return m_LiteWeightStgdb.m_MiniMd.FindParentOfMethod(ridMethod, pridParent);
+} // MDInternalRO::FindParentOfMethod
+
 
 
 //*****************************************************************************
@@ -723,9 +800,124 @@ HRESULT MDInternalRO::GetCustomAttributeByName( // S_OK or error.
     _Outptr_result_bytebuffer_(*pcbData) const void  **ppData, // [OUT] Put pointer to data here.
     _Out_ ULONG *pcbData)               // [OUT] Put size of data here.
 {
+    // Most of these calls ask whether something has a well known attribute, and the answer is usually no
+    if (!MayHaveCustomAttribute(tkObj, szName))
+        return S_FALSE;
+
     return m_LiteWeightStgdb.m_MiniMd.CommonGetCustomAttributeByNameEx(tkObj, szName, NULL, ppData, pcbData);
 } // MDInternalRO::GetCustomAttributeByName
 
+//*****************************************************************************
+// Size in bytes of m_pCustomAttributeFilter, a power of 2 with 16 bits per custom attribute.
+//*****************************************************************************
+ULONG MDInternalRO::GetCustomAttributeFilterSize(
+    ULONG       cCustomAttributes)      // [IN] number of custom attributes
+{
+    ULONG cbFilter = 16;
+    while (cbFilter < cCustomAttributes * 2)
+        cbFilter *= 2;
+    return cbFilter;
+} // MDInternalRO::GetCustomAttributeFilterSize
+
+//*****************************************************************************
+// Continues ulHash with the characters of szName.
+//*****************************************************************************
+ULONG MDInternalRO::HashCustomAttributeName(
+    ULONG       ulHash,                 // [IN] hash so far
+    LPCUTF8     szName)                 // [IN] characters to add
+{
+    while (*szName != '\0')
+    {
+        ulHash = (ulHash * 33) ^ (BYTE)*szName++;
+    }
+    return ulHash;
+} // MDInternalRO::HashCustomAttributeName
+
+//*****************************************************************************
+// Returns FALSE if tkObj definitely doesn't have a custom attribute whose type is named szName
+// ("Namespace.Name"). The first call builds a bloom filter of every (parent, type name) pair
+// of the CustomAttribute table, so negative lookups no longer resolve the type of each of the
+// parent's attributes.
+//*****************************************************************************
+BOOL MDInternalRO::MayHaveCustomAttribute(
+    mdToken     tkObj,                  // [IN] Object with Custom Attribute.
+    LPCUTF8     szName)                 // [IN] Name of desired Custom Attribute.
+{
+    ULONG cCustomAttributes = m_LiteWeightStgdb.m_MiniMd.getCountCustomAttributes();
+    if (cCustomAttributes == 0)
+        return FALSE;
+
+    ULONG cbFilter = GetCustomAttributeFilterSize(cCustomAttributes);
+    ULONG ulBitMask = cbFilter * 8 - 1;
+
+#ifndef DACCESS_COMPILE
+    // Lazy initialization of m_pCustomAttributeFilter
+    if ((cCustomAttributes > 10) && (m_pCustomAttributeFilter == NULL))
+    {
+        NewArrayHolder<BYTE> pCustomAttributeFilter = new (nothrow) BYTE[cbFilter];
+        if (pCustomAttributeFilter != NULL)
+        {
+            memset(pCustomAttributeFilter, 0, cbFilter);
+
+            for (RID rid = 1; rid <= cCustomAttributes; rid++)
+            {
+                CustomAttributeRec *pRec;
+                LPCUTF8 szNamespaceTmp = NULL;
+                LPCUTF8 szNameTmp = NULL;
+                HRESULT hr;
+
+                hr = m_LiteWeightStgdb.m_MiniMd.GetCustomAttributeRecord(rid, &pRec);
+                if (SUCCEEDED(hr))
+                    hr = m_LiteWeightStgdb.m_MiniMd.CommonGetNameOfCustomAttribute(rid, &szNamespaceTmp, &szNameTmp);
+
+                if (FAILED(hr))
+                {
+                    // Let the lookups run into the error themselves
+                    memset(pCustomAttributeFilter, 0xFF, cbFilter);
+                    break;
+                }
+
+                // Attributes on types that aren't named by a typedef or typeref never match
+                if (hr != S_OK)
+                    continue;
+
+                ULONG ulHash = 5381;
+                if (*szNamespaceTmp != '\0')
+                {
+                    ulHash = HashCustomAttributeName(ulHash, szNamespaceTmp);
+                    ulHash = (ulHash * 33) ^ NAMESPACE_SEPARATOR_CHAR;
+                }
+                ulHash = HashCustomAttributeName(ulHash, szNameTmp);
+                ulHash ^= m_LiteWeightStgdb.m_MiniMd.getParentOfCustomAttribute(pRec) * 0x9E3779B1;
+
+                ULONG iBit1 = ulHash & ulBitMask;
+                ULONG iBit2 = ((ulHash >> 16) ^ (ulHash * 0x85EBCA6B)) & ulBitMask;
+                pCustomAttributeFilter[iBit1 / 8] |= (BYTE)(1 << (iBit1 % 8));
+                pCustomAttributeFilter[iBit2 / 8] |= (BYTE)(1 << (iBit2 % 8));
+            }
+
+            if (InterlockedCompareExchangeT<BYTE *>(
+                &m_pCustomAttributeFilter, pCustomAttributeFilter, NULL) == NULL)
+            {   // The exchange did happen, suppress of the allocated filter
+                pCustomAttributeFilter.SuppressRelease();
+            }
+        }
+    }
+#endif //!DACCESS_COMPILE
+
+    // Use m_pCustomAttributeFilter if it has been built.
+    if (m_pCustomAttributeFilter == NULL)
+        return TRUE;
+
+    ULONG ulHash = HashCustomAttributeName(5381, szName);
+    ulHash ^= tkObj * 0x9E3779B1;
+
+    ULONG iBit1 = ulHash & ulBitMask;
+    ULONG iBit2 = ((ulHash >> 16) ^ (ulHash * 0x85EBCA6B)) & ulBitMask;
+    return ((m_pCustomAttributeFilter[iBit1 / 8] & (1 << (iBit1 % 8))) != 0) &&
+           ((m_pCustomAttributeFilter[iBit2 / 8] & (1 << (iBit2 % 8))) != 0);
+} // MDInternalRO::MayHaveCustomAttribute
+
 
 //*****************************************************************************
 // return the name of a custom attribute
@@ -1752,6 +1944,90 @@ MDInternalRO::FindTypeDef(
         _ASSERTE(TypeFromToken(tkEnclosingClass) == mdtTypeDef);
     }
 
+#ifndef DACCESS_COMPILE
+    // Lazy initialization of m_pTypeDefNameMap. Typedefs are inserted in RID order, so for duplicate
+    // names the probe sequence meets the same typedef the linear search below would return.
+    if ((cTypeDefRecs > 10) && (m_pTypeDefNameMap == NULL))
+    {
+        ULONG cSlots = GetTypeDefNameMapSize(cTypeDefRecs);
+        NewArrayHolder<CTypeDefNameMapEntry> pTypeDefNameMap = new (nothrow) CTypeDefNameMapEntry[cSlots];
+        if (pTypeDefNameMap != NULL)
+        {
+            memset(pTypeDefNameMap, 0, cSlots * sizeof(CTypeDefNameMapEntry));
+
+            for (ULONG i = 1; i <= cTypeDefRecs; i++)
+            {
+                mdToken tkEnclosingClassTmp = mdTokenNil;
+
+                IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(i, &pTypeDefRec));
+                dwFlags = m_LiteWeightStgdb.m_MiniMd.getFlagsOfTypeDef(pTypeDefRec);
+                if (IsTdNested(dwFlags))
+                {
+                    RID              iNestedClassRec;
+                    NestedClassRec * pNestedClassRec;
+
+                    // Nested typedefs without a valid enclosing class never match
+                    IfFailRet(m_LiteWeightStgdb.m_MiniMd.FindNestedClassFor(i, &iNestedClassRec));
+                    if (InvalidRid(iNestedClassRec))
+                        continue;
+                    IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetNestedClassRecord(iNestedClassRec, &pNestedClassRec));
+                    tkEnclosingClassTmp = m_LiteWeightStgdb.m_MiniMd.getEnclosingClassOfNestedClass(pNestedClassRec);
+                    if (IsNilToken(tkEnclosingClassTmp))
+                        continue;
+                }
+
+                IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeDef(pTypeDefRec, &szName));
+                IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeDef(pTypeDefRec, &szNamespace));
+
+                ULONG iSlot = HashTypeDefName(szNamespace, szName, tkEnclosingClassTmp) & (cSlots - 1);
+                while (pTypeDefNameMap[iSlot].m_ridTypeDef != 0)
+                {
+                    iSlot = (iSlot + 1) & (cSlots - 1);
+                }
+                pTypeDefNameMap[iSlot].m_ridTypeDef = i;
+                pTypeDefNameMap[iSlot].m_tkEnclosingClass = tkEnclosingClassTmp;
+            }
+
+            if (InterlockedCompareExchangeT<CTypeDefNameMapEntry *>(
+                &m_pTypeDefNameMap, pTypeDefNameMap, NULL) == NULL)
+            {   // The exchange did happen, suppress of the allocated map
+                pTypeDefNameMap.SuppressRelease();
+            }
+        }
+    }
+#endif //!DACCESS_COMPILE
+
+    // Use m_pTypeDefNameMap if it has been built.
+    if (m_pTypeDefNameMap != NULL)
+    {
+        ULONG   cSlots = GetTypeDefNameMapSize(cTypeDefRecs);
+        mdToken tkEnclosingKey = IsNilToken(tkEnclosingClass) ? mdTokenNil : tkEnclosingClass;
+
+        for (ULONG iSlot = HashTypeDefName(szTypeDefNamespace, szTypeDefName, tkEnclosingKey) & (cSlots - 1);
+             m_pTypeDefNameMap[iSlot].m_ridTypeDef != 0;
+             iSlot = (iSlot + 1) & (cSlots - 1))
+        {
+            if (m_pTypeDefNameMap[iSlot].m_tkEnclosingClass != tkEnclosingKey)
+                continue;
+
+            RID ridTypeDef = m_pTypeDefNameMap[iSlot].m_ridTypeDef;
+            IfFailRet(m_LiteWeightStgdb.m_MiniMd.GetTypeDefRecord(ridTypeDef, &pTypeDefRec));
+            IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNameOfTypeDef(pTypeDefRec, &szName));
+            if (strcmp(szTypeDefName, szName) == 0)
+            {
+                IfFailRet(m_LiteWeightStgdb.m_MiniMd.getNamespaceOfTypeDef(pTypeDefRec, &szNamespace));
+                if (strcmp(szTypeDefNamespace, szNamespace) == 0)
+                {
+                    *ptkTypeDef = TokenFromRid(ridTypeDef, mdtTypeDef);
+                    return S_OK;
+                }
+            }
+        }
+
+        // Cannot find the TypeDef by name
+        return CLDB_E_RECORD_NOTFOUND;
+    }
+
     // Search for the TypeDef
     for (ULONG i = 1; i <= cTypeDefRecs; i++)
     {
@@ -1801,6 +2077,26 @@ MDInternalRO::FindTypeDef(
     return CLDB_E_RECORD_NOTFOUND;
 } // MDInternalRO::FindTypeDef
 
+//*****************************************************************************
+// Size of m_pTypeDefNameMap, a power of 2 that keeps it at most half full.
+//*****************************************************************************
+ULONG MDInternalRO::GetTypeDefNameMapSize(
+    ULONG       cTypeDefs)              // [IN] number of typedefs
+{
+    ULONG cSlots = 16;
+    while (cSlots < cTypeDefs * 2)
+        cSlots *= 2;
+    return cSlots;
+} // MDInternalRO::GetTypeDefNameMapSize
+
+ULONG MDInternalRO::HashTypeDefName(
+    LPCSTR      szNamespace,            // [IN] Namespace of the TypeDef.
+    LPCSTR      szName,                 // [IN] Name of the TypeDef.
+    mdToken     tkEnclosingClass)       // [IN] Enclosing class, mdTokenNil if not nested.
+{
+    return HashStringA(szName) + HashStringA(szNamespace) * 31 + HashBytes((const BYTE *) &tkEnclosingClass, sizeof(mdToken));
+} // MDInternalRO::HashTypeDefName
+
 //*****************************************************************************
 // Given a memberref, return a pointer to memberref's name and signature
 //*****************************************************************************
@@ -754,6 +754,27 @@ private:
     };
     CMethodSemanticsMap *m_pMethodSemanticsMap; // Possible array of method semantics pointers, ordered by method token.
 
+    RID                 *m_pMethodParentMap;    // Possible array of parent typedef RIDs, indexed by method RID - 1.
+
+    struct CTypeDefNameMapEntry
+    {
+        RID             m_ridTypeDef;       // RID of the typedef, 0 for an empty slot.
+        mdToken         m_tkEnclosingClass; // Enclosing class of nested typedefs, mdTokenNil otherwise.
+    };
+    CTypeDefNameMapEntry *m_pTypeDefNameMap;    // Possible open addressing hash of typedefs by name, namespace and enclosing class.
+
+    BYTE                *m_pCustomAttributeFilter;  // Possible bloom filter of (parent token, attribute type name) pairs.
+
+    __checkReturn
+    HRESULT FindParentOfMethod(RID ridMethod, RID *pridParent);
+
+    BOOL MayHaveCustomAttribute(mdToken tkObj, LPCUTF8 szName);
+    static ULONG GetCustomAttributeFilterSize(ULONG cCustomAttributes);
+    static ULONG HashCustomAttributeName(ULONG ulHash, LPCUTF8 szName);
+
+    static ULONG GetTypeDefNameMapSize(ULONG cTypeDefs);
+    static ULONG HashTypeDefName(LPCSTR szNamespace, LPCSTR szName, mdToken tkEnclosingClass);
+
 #ifndef DACCESS_COMPILE
     class CMethodSemanticsMapSorter : public CQuickSort<CMethodSemanticsMap>
     {
@@ -236,3 +236,11 @@ bool VMToOSInterface::ReleaseRWMapping(void* pStart, size_t size)
 {
     return munmap(pStart, size) != -1;
 }
+
+void VMToOSInterface::AdviseHugePages(void* pStart, size_t size)
+{
+#ifdef MADV_HUGEPAGE
+    // Best effort, this fails e.g. when transparent huge pages are disabled in the kernel
+    madvise(pStart, size, MADV_HUGEPAGE);
+#endif // MADV_HUGEPAGE
+}
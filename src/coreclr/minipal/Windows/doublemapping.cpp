@@ -210,3 +210,8 @@ bool VMToOSInterface::ReleaseRWMapping(void* pStart, size_t size)
 {
     return UnmapViewOfFile(pStart);
 }
+
+void VMToOSInterface::AdviseHugePages(void* pStart, size_t size)
+{
+    // Large pages on Windows can't be used for pageable memory
+}
@@ -75,4 +75,10 @@ public:
     // Return:
     //  true if it succeeded, false if it failed
     static bool ReleaseRWMapping(void* pStart, size_t size);
+
+    // Advise the OS to back the specified range with huge pages where it supports doing so transparently
+    // Parameters:
+    //  pStart       - Start address of the virtual address range
+    //  size         - Size of the range
+    static void AdviseHugePages(void* pStart, size_t size);
 };
@@ -31,6 +31,7 @@
 #include "RuntimeInstance.h"
 #include "MethodTable.inl"
 #include "CommonMacros.inl"
+#include "volatile.h"
 
 #include "CachedInterfaceDispatch.h"
 
@@ -39,6 +40,10 @@
 #define CID_MAX_CACHE_SIZE_LOG2 6
 #define CID_MAX_CACHE_SIZE      (1 << CID_MAX_CACHE_SIZE_LOG2)
 
+// Number of entries in the global cache used by cells that have outgrown the maximum cache size.
+#define CID_MEGAMORPHIC_CACHE_SIZE_LOG2 12
+#define CID_MEGAMORPHIC_CACHE_SIZE      (1 << CID_MEGAMORPHIC_CACHE_SIZE_LOG2)
+
 //#define FEATURE_CID_STATS 1
 
 #ifdef FEATURE_CID_STATS
@@ -54,6 +59,9 @@ extern "C"
     uint32_t CID_g_cCacheAllocates = 0;
     uint32_t CID_g_cCacheDiscards = 0;
     uint32_t CID_g_cInterfaceDispatches = 0;
+    uint32_t CID_g_cMegamorphicHits = 0;
+    uint32_t CID_g_cMegamorphicMisses = 0;
+    uint32_t CID_g_cMegamorphicInserts = 0;
     uint32_t CID_g_cbMemoryAllocated = 0;
     uint32_t CID_g_rgAllocatesBySize[CID_MAX_CACHE_SIZE_LOG2 + 1] = { 0 };
 };
@@ -377,6 +385,108 @@ static void DiscardCache(InterfaceDispatchCache * pCache)
 #endif // INTERFACE_DISPATCH_CACHE_HAS_CELL_BACKPOINTER
 }
 
+//
+// Megamorphic dispatch cache.
+//
+// A cell whose cache has reached the maximum size keeps missing for the types that didn't fit. Instead of
+// growing the cell's cache any further, the targets resolved for such cells are remembered in a global
+// direct-mapped hash table keyed by the cell and the instance type, which RhpSearchDispatchCellCache
+// consults when the cell's own cache doesn't have the type.
+//
+// Entries are immutable once published, so lookups don't need a lock. An entry that gets replaced may still
+// be read by a racing lookup so, like the cache blocks above, it's only re-used after the next GC.
+//
+
+struct MegamorphicCacheEntry
+{
+    InterfaceDispatchCell *     m_pCell;
+    MethodTable *               m_pInstanceType;
+    PCODE                       m_pTargetCode;
+    MegamorphicCacheEntry *     m_pNextFree;
+};
+
+// The hash table, allocated when the first cell becomes megamorphic.
+static MegamorphicCacheEntry ** g_rgMegamorphicCache = NULL;
+
+// Entries replaced in the hash table that can't be re-used just yet, and the entries that can. Both are
+// protected by g_sListLock.
+static MegamorphicCacheEntry * g_pDiscardedMegamorphicEntries = NULL;
+static MegamorphicCacheEntry * g_pFreeMegamorphicEntries = NULL;
+
+static uint32_t GetMegamorphicCacheIndex(InterfaceDispatchCell * pCell, MethodTable * pInstanceType)
+{
+    // Fibonacci hashing of the combined addresses, the low bits of which are always zero.
+    uint32_t hash = (uint32_t)(((uintptr_t)pCell >> 3) ^ ((uintptr_t)pInstanceType >> 3) ^ ((uintptr_t)pInstanceType >> 15));
+    return (hash * 2654435769u) >> (32 - CID_MEGAMORPHIC_CACHE_SIZE_LOG2);
+}
+
+static PCODE LookupMegamorphicCache(InterfaceDispatchCell * pCell, MethodTable * pInstanceType)
+{
+    MegamorphicCacheEntry ** rgCache = VolatileLoad(&g_rgMegamorphicCache);
+    if (rgCache == NULL)
+        return (PCODE)nullptr;
+
+    MegamorphicCacheEntry * pEntry = VolatileLoad(&rgCache[GetMegamorphicCacheIndex(pCell, pInstanceType)]);
+    if (pEntry != NULL && pEntry->m_pCell == pCell && pEntry->m_pInstanceType == pInstanceType)
+    {
+        CID_COUNTER_INC(MegamorphicHits);
+        return pEntry->m_pTargetCode;
+    }
+
+    CID_COUNTER_INC(MegamorphicMisses);
+    return (PCODE)nullptr;
+}
+
+static void InsertMegamorphicCache(InterfaceDispatchCell * pCell, MethodTable * pInstanceType, PCODE pTargetCode)
+{
+    CrstHolder lh(&g_sListLock);
+
+    MegamorphicCacheEntry ** rgCache = g_rgMegamorphicCache;
+    if (rgCache == NULL)
+    {
+        rgCache = (MegamorphicCacheEntry **)g_pAllocHeap->Alloc(sizeof(MegamorphicCacheEntry *) * CID_MEGAMORPHIC_CACHE_SIZE);
+        if (rgCache == NULL)
+        {
+            CID_COUNTER_INC(CacheOutOfMemory);
+            return;
+        }
+
+        memset(rgCache, 0, sizeof(MegamorphicCacheEntry *) * CID_MEGAMORPHIC_CACHE_SIZE);
+        VolatileStore(&g_rgMegamorphicCache, rgCache);
+    }
+
+    MegamorphicCacheEntry * pEntry = g_pFreeMegamorphicEntries;
+    if (pEntry != NULL)
+        g_pFreeMegamorphicEntries = pEntry->m_pNextFree;
+    else
+        pEntry = (MegamorphicCacheEntry *)g_pAllocHeap->Alloc(sizeof(MegamorphicCacheEntry));
+
+    if (pEntry == NULL)
+    {
+        CID_COUNTER_INC(CacheOutOfMemory);
+        return;
+    }
+
+    pEntry->m_pCell = pCell;
+    pEntry->m_pInstanceType = pInstanceType;
+    pEntry->m_pTargetCode = pTargetCode;
+    pEntry->m_pNextFree = NULL;
+
+    // Colliding entries are simply replaced, the hash table is a cache and not a complete map.
+    uint32_t idx = GetMegamorphicCacheIndex(pCell, pInstanceType);
+    MegamorphicCacheEntry * pOldEntry = rgCache[idx];
+    VolatileStore(&rgCache[idx], pEntry);
+
+    if (pOldEntry != NULL)
+    {
+        // Lookups only read the other fields, so the link can be overwritten right away.
+        pOldEntry->m_pNextFree = g_pDiscardedMegamorphicEntries;
+        g_pDiscardedMegamorphicEntries = pOldEntry;
+    }
+
+    CID_COUNTER_INC(MegamorphicInserts);
+}
+
 // Called during a GC to empty the list of discarded caches (which we can now guarantee aren't being accessed)
 // and sort the results into the free lists we maintain for each cache size.
 void ReclaimUnusedInterfaceDispatchCaches()
@@ -428,6 +538,18 @@ void ReclaimUnusedInterfaceDispatchCaches()
 
     // We processed all the discarded entries, so we can simply NULL the list head.
     g_pDiscardedCacheList = NULL;
+
+    // Replaced megamorphic cache entries can be re-used as well.
+    MegamorphicCacheEntry * pEntry = g_pDiscardedMegamorphicEntries;
+    while (pEntry)
+    {
+        MegamorphicCacheEntry * pNextEntry = pEntry->m_pNextFree;
+        pEntry->m_pNextFree = g_pFreeMegamorphicEntries;
+        g_pFreeMegamorphicEntries = pEntry;
+        pEntry = pNextEntry;
+    }
+
+    g_pDiscardedMegamorphicEntries = NULL;
 }
 
 // One time initialization of interface dispatch.
@@ -473,12 +595,11 @@ FCIMPL4(PCODE, RhpUpdateDispatchCellCache, InterfaceDispatchCell * pCell, PCODE
 
     if (cOldCacheEntries == CID_MAX_CACHE_SIZE)
     {
-        // We already reached the maximum cache size we wish to allocate. For now don't attempt to cache
-        // the mapping we just did: there's no safe way to update the existing cache right now if it
-        // doesn't have an empty entries. There are schemes that would let us do this at the next GC point
-        // but it's not clear whether we should do this or re-tune the cache max size, we need to measure
-        // this.
+        // We already reached the maximum cache size we wish to allocate. There's no safe way to update
+        // the existing cache right now if it doesn't have an empty entry, so the cell is treated as
+        // megamorphic from now on: the mapping goes to the global megamorphic cache instead.
         CID_COUNTER_INC(CacheSizeOverflows);
+        InsertMegamorphicCache(pCell, pInstanceType, pTargetCode);
         return (PCODE)pTargetCode;
     }
 
@@ -527,6 +648,10 @@ FCIMPL2(PCODE, RhpSearchDispatchCellCache, InterfaceDispatchCell * pCell, Method
         for (uint32_t i = 0; i < pCache->m_cEntries; i++, pCacheEntry++)
             if (pCacheEntry->m_pInstanceType == pInstanceType)
                 return pCacheEntry->m_pTargetCode;
+
+        // Cells with a full cache add any further mappings to the megamorphic cache.
+        if (pCache->m_cEntries == CID_MAX_CACHE_SIZE)
+            return LookupMegamorphicCache(pCell, pInstanceType);
     }
 
     return (PCODE)nullptr;
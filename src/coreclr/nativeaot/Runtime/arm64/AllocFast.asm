@@ -37,6 +37,9 @@
         ;; Update the alloc pointer to account for the allocation.
         str         x2, [x1, #OFFSETOF__Thread__m_alloc_context__alloc_ptr]
 
+        ;; Prefetch the memory that the next allocations from this context are going to write.
+        prfm        pstl1keep, [x2, #ALLOC_PREFETCH_DISTANCE]
+
         ;; Set the new object's MethodTable pointer
         str         x0, [x12, #OFFSETOF__Object__m_pEEType]
 
@@ -118,16 +121,16 @@ NewOutOfMemory
         ;; Determine whether the end of the object would lie outside of the current allocation context. If so,
         ;; we abandon the attempt to allocate the object directly and fall back to the slow helper.
         add         x2, x2, x12
-        ldr         x12, [x3, #OFFSETOF__Thread__m_alloc_context__alloc_limit]
-        cmp         x2, x12
+        ldr         x13, [x3, #OFFSETOF__Thread__m_alloc_context__alloc_limit]
+        cmp         x2, x13
         bhi         RhpNewArrayRare
 
-        ;; Reload new object address into r12.
-        ldr         x12, [x3, #OFFSETOF__Thread__m_alloc_context__alloc_ptr]
-
         ;; Update the alloc pointer to account for the allocation.
         str         x2, [x3, #OFFSETOF__Thread__m_alloc_context__alloc_ptr]
 
+        ;; Prefetch the memory that the next allocations from this context are going to write.
+        prfm        pstl1keep, [x2, #ALLOC_PREFETCH_DISTANCE]
+
         ;; Set the new object's MethodTable pointer and element count.
         str         x0, [x12, #OFFSETOF__Object__m_pEEType]
         str         x1, [x12, #OFFSETOF__Array__m_Length]
@@ -179,16 +182,16 @@ StringSizeOverflow
         ;; Determine whether the end of the object would lie outside of the current allocation context. If so,
         ;; we abandon the attempt to allocate the object directly and fall back to the slow helper.
         add         x2, x2, x12
-        ldr         x12, [x3, #OFFSETOF__Thread__m_alloc_context__alloc_limit]
-        cmp         x2, x12
+        ldr         x13, [x3, #OFFSETOF__Thread__m_alloc_context__alloc_limit]
+        cmp         x2, x13
         bhi         RhpNewArrayRare
 
-        ;; Reload new object address into x12.
-        ldr         x12, [x3, #OFFSETOF__Thread__m_alloc_context__alloc_ptr]
-
         ;; Update the alloc pointer to account for the allocation.
         str         x2, [x3, #OFFSETOF__Thread__m_alloc_context__alloc_ptr]
 
+        ;; Prefetch the memory that the next allocations from this context are going to write.
+        prfm        pstl1keep, [x2, #ALLOC_PREFETCH_DISTANCE]
+
         ;; Set the new object's MethodTable pointer and element count.
         str         x0, [x12, #OFFSETOF__Object__m_pEEType]
         str         x1, [x12, #OFFSETOF__Array__m_Length]
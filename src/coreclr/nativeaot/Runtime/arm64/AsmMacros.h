@@ -24,6 +24,9 @@ GC_ALLOC_FINALIZE               equ 1
 GC_ALLOC_ALIGN8_BIAS            equ 4
 GC_ALLOC_ALIGN8                 equ 8
 
+;; How far past the new allocation pointer the fast allocation helpers prefetch
+ALLOC_PREFETCH_DISTANCE         equ 256
+
 ;; Note: these must match the defs in PInvokeTransitionFrameFlags defined in rhbinder.h
 PTFF_SAVE_X19           equ 0x00000001
 PTFF_SAVE_X20           equ 0x00000002
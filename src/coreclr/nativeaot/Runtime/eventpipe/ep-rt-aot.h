@@ -481,6 +481,37 @@ ep_rt_config_value_get_output_streaming (void)
     return false;
 }
 
+static
+inline
+ep_char8_t *
+ep_rt_config_value_get_startup_session_config (void)
+{
+    STATIC_CONTRACT_NOTHROW;
+
+    char* value;
+    if (RhConfig::Environment::TryGetStringValue("EventPipeStartupSession", &value))
+        return (ep_char8_t*)value;
+
+    return nullptr;
+}
+
+static
+inline
+uint32_t
+ep_rt_config_value_get_startup_session_mb (void)
+{
+    STATIC_CONTRACT_NOTHROW;
+
+    uint64_t value;
+    if (RhConfig::Environment::TryGetIntegerValue("EventPipeStartupSessionMB", &value))
+    {
+        EP_ASSERT(value <= UINT32_MAX);
+        return static_cast<uint32_t>(value);
+    }
+
+    return 0;
+}
+
 static
 inline
 bool
@@ -495,6 +526,20 @@ ep_rt_config_value_get_enable_stackwalk (void)
     return false;
 }
 
+static
+inline
+bool
+ep_rt_config_value_get_sample_running_threads_only (void)
+{
+    STATIC_CONTRACT_NOTHROW;
+
+    bool value;
+    if (RhConfig::Environment::TryGetBooleanValue("EventPipeSampleRunningThreadsOnly", &value))
+        return value;
+
+    return false;
+}
+
 /*
  * EventPipeSampleProfiler.
  */
@@ -694,6 +739,17 @@ ep_rt_execute_rundown (dn_vector_ptr_t *execution_checkpoints)
     // NativeAOT does not currently support rundown
 }
 
+static
+inline
+bool
+ep_rt_enable_method_load_log (void)
+{
+    STATIC_CONTRACT_NOTHROW;
+
+    // NativeAOT has no jitted methods to log
+    return false;
+}
+
 /*
  * Objects.
  */
@@ -764,6 +764,16 @@ void GCToEEInterface::LogErrorToHost(const char *message)
 {
 }
 
+void GCToEEInterface::SyncBlockCacheWeakPtrScanPartition(HANDLESCANPROC /*scanProc*/, uintptr_t /*lp1*/, uintptr_t /*lp2*/)
+{
+}
+
+void GCToEEInterface::RefCountedHandleCallbacksBatch(Object** objects, bool* promote, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        promote[i] = RefCountedHandleCallbacks(objects[i]);
+}
+
 bool GCToEEInterface::GetStringConfigValue(const char* privateKey, const char* publicKey, const char** value)
 {
     UNREFERENCED_PARAMETER(privateKey);
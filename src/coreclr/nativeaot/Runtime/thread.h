@@ -118,6 +118,7 @@ struct RuntimeThreadLocals
 #ifdef FEATURE_GC_STRESS
     uint32_t                m_uRand;                                // current per-thread random number
 #endif // FEATURE_GC_STRESS
+    PTR_Thread              m_pPrev;                                // previous thread in ThreadStore's list, lets detach unlink in constant time
 };
 
 struct ReversePInvokeFrame
@@ -102,6 +102,45 @@ void ThreadStore::Destroy()
     delete this;
 }
 
+// Must be called with the threadstore lock held.
+void ThreadStore::AddThread(Thread * pThread)
+{
+    Thread * pHead = m_ThreadList.GetHead();
+    pThread->m_pPrev = NULL;
+    if (pHead != NULL)
+    {
+        pHead->m_pPrev = pThread;
+    }
+
+    m_ThreadList.PushHead(pThread);
+}
+
+// Must be called with the threadstore lock held. Unlinks the thread through its back link rather than by
+// searching the list, so the time spent holding the lock doesn't grow with the number of threads.
+void ThreadStore::RemoveThread(Thread * pThread)
+{
+    Thread * pPrev = pThread->m_pPrev;
+    Thread * pNext = pThread->m_pNext;
+
+    if (pPrev == NULL)
+    {
+        ASSERT(m_ThreadList.GetHead() == pThread);
+        m_ThreadList.PopHead();
+    }
+    else
+    {
+        pPrev->m_pNext = pNext;
+    }
+
+    if (pNext != NULL)
+    {
+        pNext->m_pPrev = pPrev;
+    }
+
+    pThread->m_pNext = NULL;
+    pThread->m_pPrev = NULL;
+}
+
 // static
 void ThreadStore::AttachCurrentThread(bool fAcquireThreadStoreLock)
 {
@@ -141,7 +180,7 @@ void ThreadStore::AttachCurrentThread(bool fAcquireThreadStoreLock)
     ASSERT(pAttachingThread->m_ThreadStateFlags == Thread::TSF_Unknown);
     pAttachingThread->m_ThreadStateFlags = Thread::TSF_Attached;
 
-    pTS->m_ThreadList.PushHead(pAttachingThread);
+    pTS->AddThread(pAttachingThread);
 }
 
 // static
@@ -188,7 +227,7 @@ void ThreadStore::DetachCurrentThread()
         CrstHolder threadStoreLock(&pTS->m_Lock);
         ASSERT(rh::std::count(pTS->m_ThreadList.Begin(), pTS->m_ThreadList.End(), pDetachingThread) == 1);
         // remove the thread from the list of managed threads.
-        pTS->m_ThreadList.RemoveFirst(pDetachingThread);
+        pTS->RemoveThread(pDetachingThread);
         // tidy up GC related stuff (release allocation context, etc..)
         pDetachingThread->Detach();
     }
@@ -29,6 +29,9 @@ class ThreadStore
 private:
     ThreadStore();
 
+    void                    AddThread(Thread * pThread);
+    void                    RemoveThread(Thread * pThread);
+
 public:
     void                    LockThreadStore();
     void                    UnlockThreadStore();
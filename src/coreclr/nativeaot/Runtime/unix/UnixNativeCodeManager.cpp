@@ -19,6 +19,7 @@
 
 #include "UnixContext.h"
 #include "UnwindHelpers.h"
+#include "volatile.h"
 
 #define UBF_FUNC_KIND_MASK      0x03
 #define UBF_FUNC_KIND_ROOT      0x00
@@ -51,7 +52,8 @@ UnixNativeCodeManager::UnixNativeCodeManager(TADDR moduleBase,
                                              PTR_PTR_VOID pClasslibFunctions, uint32_t nClasslibFunctions)
     : m_moduleBase(moduleBase),
       m_pvManagedCodeStartRange(pvManagedCodeStartRange), m_cbManagedCodeRange(cbManagedCodeRange),
-      m_pClasslibFunctions(pClasslibFunctions), m_nClasslibFunctions(nClasslibFunctions)
+      m_pClasslibFunctions(pClasslibFunctions), m_nClasslibFunctions(nClasslibFunctions),
+      m_unwindInfoCache()
 {
     // Cache the location of unwind sections
     libunwind::LocalAddressSpace::sThisAddressSpace.findUnwindSections(
@@ -71,6 +73,48 @@ bool UnixNativeCodeManager::VirtualUnwind(MethodInfo* pMethodInfo, REGDISPLAY* p
         pRegisterSet, pNativeMethodInfo->start_ip, pNativeMethodInfo->format, pNativeMethodInfo->unwind_info);
 }
 
+static uint32_t GetUnwindInfoCacheIndex(TADDR pc, uint32_t cacheSizeLog2)
+{
+    return ((uint32_t)(pc >> 2) * 2654435769u) >> (32 - cacheSizeLog2);
+}
+
+// Stack walks keep coming across the same return addresses, and finding their unwind info takes a
+// binary search of the unwind section followed by parsing the CIE and FDE, so the results are cached.
+bool UnixNativeCodeManager::LookupUnwindInfoCache(TADDR pc, unw_proc_info_t * pProcInfo)
+{
+    UnwindInfoCacheEntry * pEntry = &m_unwindInfoCache[GetUnwindInfoCacheIndex(pc, UnwindInfoCacheSizeLog2)];
+
+    int32_t sequence = VolatileLoad(&pEntry->sequence);
+    if ((sequence & 1) != 0 || VolatileLoad(&pEntry->pc) != pc)
+        return false;
+
+    pProcInfo->start_ip = VolatileLoad(&pEntry->start_ip);
+    pProcInfo->unwind_info = VolatileLoad(&pEntry->unwind_info);
+    pProcInfo->lsda = VolatileLoad(&pEntry->lsda);
+    pProcInfo->format = VolatileLoad(&pEntry->format);
+
+    // Ignore the entry if it was updated while we were reading it
+    return VolatileLoad(&pEntry->sequence) == sequence;
+}
+
+void UnixNativeCodeManager::UpdateUnwindInfoCache(TADDR pc, const unw_proc_info_t * pProcInfo)
+{
+    UnwindInfoCacheEntry * pEntry = &m_unwindInfoCache[GetUnwindInfoCacheIndex(pc, UnwindInfoCacheSizeLog2)];
+
+    // Give up if another thread is updating the same entry, it's just a cache.
+    int32_t sequence = VolatileLoad(&pEntry->sequence);
+    if ((sequence & 1) != 0 || PalInterlockedCompareExchange(&pEntry->sequence, sequence + 1, sequence) != sequence)
+        return;
+
+    VolatileStore(&pEntry->pc, pc);
+    VolatileStore(&pEntry->start_ip, (unw_word_t)pProcInfo->start_ip);
+    VolatileStore(&pEntry->unwind_info, (unw_word_t)pProcInfo->unwind_info);
+    VolatileStore(&pEntry->lsda, (unw_word_t)pProcInfo->lsda);
+    VolatileStore(&pEntry->format, (uint32_t)pProcInfo->format);
+
+    VolatileStore(&pEntry->sequence, sequence + 2);
+}
+
 bool UnixNativeCodeManager::FindMethodInfo(PTR_VOID        ControlPC,
                                            MethodInfo *    pMethodInfoOut)
 {
@@ -87,12 +131,17 @@ bool UnixNativeCodeManager::FindMethodInfo(PTR_VOID        ControlPC,
 
     unw_proc_info_t procInfo;
 
-    if (!UnwindHelpers::GetUnwindProcInfo((TADDR)ControlPC, m_UnwindInfoSections, &procInfo))
+    if (!LookupUnwindInfoCache((TADDR)ControlPC, &procInfo))
     {
-        return false;
-    }
+        if (!UnwindHelpers::GetUnwindProcInfo((TADDR)ControlPC, m_UnwindInfoSections, &procInfo))
+        {
+            return false;
+        }
 
-    assert((procInfo.start_ip <= (TADDR)ControlPC) && ((TADDR)ControlPC < procInfo.end_ip));
+        assert((procInfo.start_ip <= (TADDR)ControlPC) && ((TADDR)ControlPC < procInfo.end_ip));
+
+        UpdateUnwindInfoCache((TADDR)ControlPC, &procInfo);
+    }
 
     pMethodInfo->start_ip = procInfo.start_ip;
     pMethodInfo->format = procInfo.format;
@@ -20,6 +20,24 @@ class UnixNativeCodeManager : public ICodeManager
 
     libunwind::UnwindInfoSections m_UnwindInfoSections;
 
+    // Direct-mapped cache of the unwind info found for recently seen code addresses. The sequence
+    // number is odd while an entry is being updated.
+    struct UnwindInfoCacheEntry
+    {
+        int32_t sequence;
+        uint32_t format;
+        TADDR pc;
+        unw_word_t start_ip;
+        unw_word_t unwind_info;
+        unw_word_t lsda;
+    };
+
+    static const uint32_t UnwindInfoCacheSizeLog2 = 10;
+    UnwindInfoCacheEntry m_unwindInfoCache[1 << UnwindInfoCacheSizeLog2];
+
+    bool LookupUnwindInfoCache(TADDR pc, unw_proc_info_t * pProcInfo);
+    void UpdateUnwindInfoCache(TADDR pc, const unw_proc_info_t * pProcInfo);
+
     bool VirtualUnwind(MethodInfo* pMethodInfo, REGDISPLAY* pRegisterSet);
 
 public:
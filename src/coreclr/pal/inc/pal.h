@@ -416,10 +416,25 @@ bool
 PALAPI
 PAL_PerfJitDump_IsStarted();
 
+// Maps a native code address to a line of a "file" in the jitdump debug info
+typedef struct _PAL_PerfJitDumpLineInfo
+{
+    void* pCode;
+    int lineNumber;
+} PAL_PerfJitDumpLineInfo;
+
+// Debug info that can be passed to PAL_PerfJitDump_LogMethod as debugInfo
+typedef struct _PAL_PerfJitDumpDebugInfo
+{
+    const char* fileName;
+    size_t lineCount;
+    const PAL_PerfJitDumpLineInfo* lines;
+} PAL_PerfJitDumpDebugInfo;
+
 PALIMPORT
 int
 PALAPI
-// Log a method to the jitdump file.
+// Log a method to the jitdump file. debugInfo is an optional PAL_PerfJitDumpDebugInfo*.
 PAL_PerfJitDump_LogMethod(void* pCode, size_t codeSize, const char* symbol, void* debugInfo, void* unwindInfo);
 
 PALIMPORT
@@ -984,6 +999,11 @@ size_t
 PALAPI
 PAL_GetCurrentOSThreadId();
 
+PALIMPORT
+DWORD
+PALAPI
+GetCurrentProcessorNumber();
+
 // To work around multiply-defined symbols in the Carbon framework.
 #define GetCurrentThread PAL_GetCurrentThread
 PALIMPORT
@@ -2606,6 +2626,16 @@ BOOL
 PALAPI
 PAL_GetCpuLimit(UINT* val);
 
+PALIMPORT
+UINT64
+PALAPI
+PAL_GetProcessPageFaultCount();
+
+PALIMPORT
+BOOL
+PALAPI
+PAL_SetSveVectorLength(DWORD length);
+
 typedef BOOL(*UnwindReadMemoryCallback)(PVOID address, PVOID buffer, SIZE_T size);
 
 PALIMPORT BOOL PALAPI PAL_VirtualUnwind(CONTEXT *context, KNONVOLATILE_CONTEXT_POINTERS *contextPointers);
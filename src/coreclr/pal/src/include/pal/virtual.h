@@ -50,7 +50,8 @@ enum VIRTUAL_CONSTANTS
     VIRTUAL_EXECUTE,
     VIRTUAL_EXECUTE_READ,
 
-    VIRTUAL_64KB            = 0x10000
+    VIRTUAL_64KB            = 0x10000,
+    VIRTUAL_2MB             = 0x200000
 };
 
 size_t GetVirtualPageSize();
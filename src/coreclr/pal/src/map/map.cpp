@@ -2235,6 +2235,43 @@ void * MAPMapPEFile(HANDLE hFile, off_t offset)
         forceOveralign = true;
     }
 
+    // MAC64 requires we pass MAP_SHARED (or MAP_PRIVATE) flags - otherwise, the call is failed.
+    // Refer to mmap documentation at http://www.manpagez.com/man/2/mmap/ for details.
+    int mapFlags;
+    mapFlags = MAP_ANON|MAP_PRIVATE;
+#ifdef __APPLE__
+    if (IsRunningOnMojaveHardenedRuntime())
+    {
+        mapFlags |= MAP_JIT;
+    }
+#endif // __APPLE__
+
+    // If PAL_MAP_PE_AT_PREFERRED_BASE is set to 1, try to map the image at its preferred base first.
+    // An image loaded there needs no base relocations, so its read-only pages are never written and
+    // stay shared with all the other processes mapping the same file. This is meant for images
+    // compiled with distinct preferred bases (e.g. crossgen2 --imagebase), otherwise only the first
+    // image gets its preferred base and the others are rebased as usual.
+    char *mapAtPreferredBase;
+    mapAtPreferredBase = EnvironGetenv("PAL_MAP_PE_AT_PREFERRED_BASE");
+    if (mapAtPreferredBase != NULL)
+    {
+        if (!forceOveralign && (strcmp(mapAtPreferredBase, "1") == 0))
+        {
+            loadedBase = mmap((void*)preferredBase, reserveSize, PROT_NONE, mapFlags, -1, 0);
+            if (loadedBase != (void*)preferredBase)
+            {
+                TRACE_(LOADER)("Attempt to map image at preferred base of %p failed\n", (void*)preferredBase);
+                if (loadedBase != MAP_FAILED)
+                {
+                    munmap(loadedBase, reserveSize);
+                }
+                loadedBase = NULL;
+            }
+        }
+
+        free(mapAtPreferredBase);
+    }
+
 #ifdef HOST_64BIT
     // First try to reserve virtual memory using ExecutableAllocator. This allows all PE images to be
     // near each other and close to the coreclr library which also allows the runtime to generate
@@ -2245,6 +2282,7 @@ void * MAPMapPEFile(HANDLE hFile, off_t offset)
 #ifdef FEATURE_ENABLE_NO_ADDRESS_SPACE_RANDOMIZATION
     if (!g_useDefaultBaseAddr)
 #endif // FEATURE_ENABLE_NO_ADDRESS_SPACE_RANDOMIZATION
+    if (loadedBase == NULL)
     {
         loadedBase = ReserveMemoryFromExecutableAllocator(pThread, ALIGN_UP(reserveSize, VIRTUAL_64KB));
     }
@@ -2259,15 +2297,6 @@ void * MAPMapPEFile(HANDLE hFile, off_t offset)
             usedBaseAddr = (void*) preferredBase;
         }
 #endif // FEATURE_ENABLE_NO_ADDRESS_SPACE_RANDOMIZATION
-        // MAC64 requires we pass MAP_SHARED (or MAP_PRIVATE) flags - otherwise, the call is failed.
-        // Refer to mmap documentation at http://www.manpagez.com/man/2/mmap/ for details.
-        int mapFlags = MAP_ANON|MAP_PRIVATE;
-#ifdef __APPLE__
-        if (IsRunningOnMojaveHardenedRuntime())
-        {
-            mapFlags |= MAP_JIT;
-        }
-#endif // __APPLE__
         loadedBase = mmap(usedBaseAddr, reserveSize, PROT_NONE, mapFlags, -1, 0);
     }
 
@@ -1697,7 +1697,22 @@ void ExecutableMemoryAllocator::TryReserveInitialMemory()
     // Randomize the location at which we start allocating from the reserved memory range. Alignment to a 64 KB granularity
     // should not be necessary, but see AllocateMemory() for the reason why it is done.
     int32_t randomOffset = GenerateRandomStartOffset();
-    m_nextFreeAddress = ALIGN_UP((void*)(((UINT_PTR)m_startAddress) + randomOffset), VIRTUAL_64KB);
+    UINT_PTR startAlignment = VIRTUAL_64KB;
+
+#ifdef MADV_HUGEPAGE
+    // Optionally let the kernel back the code and loader heaps with transparent huge pages. Allocations are handed out
+    // contiguously from here, so starting at a 2 MB boundary lets them fill whole huge pages. The double mapped
+    // allocator maps over these ranges and advises its own mappings (see ExecutableAllocator).
+    CLRConfigNoCache executableHugePages = CLRConfigNoCache::Get("ExecutableHugePages", /*noprefix*/ false, &getenv);
+    DWORD useHugePages;
+    if (executableHugePages.IsSet() && executableHugePages.TryAsInteger(16, useHugePages) && (useHugePages != 0))
+    {
+        madvise(m_startAddress, sizeOfAllocation, MADV_HUGEPAGE);
+        startAlignment = VIRTUAL_2MB;
+    }
+#endif // MADV_HUGEPAGE
+
+    m_nextFreeAddress = ALIGN_UP((void*)(((UINT_PTR)m_startAddress) + randomOffset), startAlignment);
     _ASSERTE(sizeOfAllocation >= (int32_t)((UINT_PTR)m_nextFreeAddress - (UINT_PTR)m_startAddress));
     m_remainingReservedMemory =
         ALIGN_DOWN(sizeOfAllocation - ((UINT_PTR)m_nextFreeAddress - (UINT_PTR)m_startAddress), VIRTUAL_64KB);
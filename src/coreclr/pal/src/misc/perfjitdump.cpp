@@ -59,6 +59,7 @@ namespace
 #endif
 
         JIT_CODE_LOAD = 0,
+        JIT_CODE_DEBUG_INFO = 2,
     };
 
     static uint64_t GetTimeStampNS()
@@ -118,6 +119,82 @@ namespace
         // Null terminated name
         // Optional native code
     };
+
+    struct JitCodeDebugInfoRecord
+    {
+        JitCodeDebugInfoRecord()
+        {
+            header.id = JIT_CODE_DEBUG_INFO;
+            header.timestamp = GetTimeStampNS();
+        }
+
+        RecordHeader header;
+        uint64_t code_addr;
+        uint64_t nr_entry;
+        // JitCodeDebugInfoEntry[nr_entry]
+    };
+
+    struct JitCodeDebugInfoEntry
+    {
+        uint64_t code_addr;
+        int32_t line;
+        int32_t discrim;
+        // Null terminated file name, "\xff" if it is the same as the previous entry's
+    };
+
+    const char SAME_FILE_NAME[] = "\xff";
+
+    // Builds the debug info record for the method at pCode, the caller frees it.
+    // Returns nullptr if there is nothing to write or we are out of memory.
+    static char* CreateDebugInfoRecord(void* pCode, const PAL_PerfJitDumpDebugInfo* debugInfo, size_t* pSize)
+    {
+        if (debugInfo == nullptr || debugInfo->lineCount == 0)
+            return nullptr;
+
+        size_t fileNameLen = strlen(debugInfo->fileName);
+        size_t size = sizeof(JitCodeDebugInfoRecord) +
+            debugInfo->lineCount * sizeof(JitCodeDebugInfoEntry) +
+            (fileNameLen + 1) + (debugInfo->lineCount - 1) * sizeof(SAME_FILE_NAME);
+
+        char* buffer = (char*)malloc(size);
+        if (buffer == nullptr)
+            return nullptr;
+
+        JitCodeDebugInfoRecord record;
+        record.header.total_size = size;
+        record.code_addr = (uint64_t) pCode;
+        record.nr_entry = debugInfo->lineCount;
+
+        char* current = buffer;
+        memcpy(current, &record, sizeof(JitCodeDebugInfoRecord));
+        current += sizeof(JitCodeDebugInfoRecord);
+
+        for (size_t i = 0; i < debugInfo->lineCount; i++)
+        {
+            JitCodeDebugInfoEntry entry;
+            entry.code_addr = (uint64_t) debugInfo->lines[i].pCode;
+            entry.line = debugInfo->lines[i].lineNumber;
+            entry.discrim = 0;
+            memcpy(current, &entry, sizeof(JitCodeDebugInfoEntry));
+            current += sizeof(JitCodeDebugInfoEntry);
+
+            if (i == 0)
+            {
+                memcpy(current, debugInfo->fileName, fileNameLen + 1);
+                current += fileNameLen + 1;
+            }
+            else
+            {
+                memcpy(current, SAME_FILE_NAME, sizeof(SAME_FILE_NAME));
+                current += sizeof(SAME_FILE_NAME);
+            }
+        }
+
+        _ASSERTE((size_t)(current - buffer) == size);
+
+        *pSize = size;
+        return buffer;
+    }
 };
 
 struct PerfJitDumpState
@@ -232,29 +309,42 @@ exit:
 
             JitCodeLoadRecord record;
 
-            size_t bytesRemaining = sizeof(JitCodeLoadRecord) + symbolLen + 1 + codeSize;
+            size_t recordSize = sizeof(JitCodeLoadRecord) + symbolLen + 1 + codeSize;
 
             record.header.timestamp = GetTimeStampNS();
             record.vma = (uint64_t) pCode;
             record.code_addr = (uint64_t) pCode;
             record.code_size = codeSize;
-            record.header.total_size = bytesRemaining;
+            record.header.total_size = recordSize;
+
+            // The debug info record has to precede the JitCodeLoadRecord it describes
+            size_t debugInfoSize = 0;
+            char* debugInfoRecord = CreateDebugInfoRecord(pCode, (const PAL_PerfJitDumpDebugInfo*)debugInfo, &debugInfoSize);
+
+            size_t bytesRemaining = debugInfoSize + recordSize;
 
             iovec items[] = {
-                // ToDo insert debugInfo and unwindInfo record items immediately before the JitCodeLoadRecord.
+                // ToDo insert unwindInfo record items immediately before the JitCodeLoadRecord.
+                { debugInfoRecord, debugInfoSize },
                 { &record, sizeof(JitCodeLoadRecord) },
                 { (void *)symbol, symbolLen + 1 },
                 { pCode, codeSize },
             };
             size_t itemsCount = sizeof(items) / sizeof(items[0]);
 
-            size_t itemsWritten = 0;
+            size_t itemsWritten = (debugInfoRecord == nullptr) ? 1 : 0;
 
             if (result != 0)
+            {
+                free(debugInfoRecord);
                 return FatalError();
+            }
 
             if (!enabled)
+            {
+                free(debugInfoRecord);
                 goto exit;
+            }
 
             // Increment codeIndex while locked
             record.code_index = ++codeIndex;
@@ -271,6 +361,7 @@ exit:
                     if (errno == EINTR)
                         continue;
 
+                    free(debugInfoRecord);
                     return FatalError();
                 }
 
@@ -301,6 +392,7 @@ exit:
                 } while (result > 0);
             } while (true);
 
+            free(debugInfoRecord);
         }
 exit:
         return 0;
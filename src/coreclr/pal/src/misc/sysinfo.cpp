@@ -27,6 +27,11 @@ Revision History:
 #define __STDC_FORMAT_MACROS
 #include <inttypes.h>
 #include <sys/types.h>
+#include <sys/resource.h>
+
+#if defined(__linux__) && defined(HOST_ARM64)
+#include <sys/prctl.h>
+#endif
 
 #if HAVE_SYSCONF
 // <unistd.h> already included above
@@ -159,6 +164,44 @@ PAL_GetLogicalCpuCountFromOS()
     return nrcpus;
 }
 
+/*++
+Function:
+  PAL_SetSveVectorLength
+
+Sets the SVE vector length, in bytes, of the current thread and of the threads it creates.
+Returns FALSE if SVE is not supported or the length cannot be set exactly.
+--*/
+BOOL
+PALAPI
+PAL_SetSveVectorLength(DWORD length)
+{
+#if defined(__linux__) && defined(HOST_ARM64) && defined(PR_SVE_SET_VL)
+    int result = prctl(PR_SVE_SET_VL, length | PR_SVE_VL_INHERIT);
+    return (result >= 0) && ((DWORD)(result & PR_SVE_VL_LEN_MASK) == length);
+#else
+    return FALSE;
+#endif
+}
+
+/*++
+Function:
+  PAL_GetProcessPageFaultCount
+
+Returns the number of minor and major page faults of the current process, or 0 if it can't be determined.
+--*/
+UINT64
+PALAPI
+PAL_GetProcessPageFaultCount()
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+
+    return (UINT64)usage.ru_minflt + (UINT64)usage.ru_majflt;
+}
+
 /*++
 Function:
   GetSystemInfo
@@ -39,6 +39,11 @@ SET_DEFAULT_DEBUG_CHANNEL(SYNC); // some headers have code with asserts, so do t
 #include "pal/fakepoll.h"
 #endif // HAVE_POLL
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
+
 #include <algorithm>
 
 const int CorUnix::CThreadSynchronizationInfo::PendingSignalingsArraySize;
@@ -462,6 +467,43 @@ namespace CorUnix
             }
         }
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+        // The predicate is only ever set by SignalThreadCondition, which stores
+        // the wakeup reason and object index before publishing it, so consuming
+        // it with acquire semantics is all the synchronization needed here and
+        // an uncontended wake doesn't have to go through the pthread mutex.
+        while (FALSE == __atomic_exchange_n(&ptnwdNativeWaitData->iPred, FALSE, __ATOMIC_ACQUIRE))
+        {
+            iRet = syscall(SYS_futex,
+                           &ptnwdNativeWaitData->iPred,
+                           FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG,
+                           FALSE,
+                           (INFINITE == dwTimeout) ? NULL : &tsAbsTmo,
+                           NULL,
+                           FUTEX_BITSET_MATCH_ANY);
+            if (0 != iRet)
+            {
+                if (ETIMEDOUT == errno)
+                {
+                    // As in the pthread_cond_timedwait version, a signal racing with
+                    // the timeout leaves the predicate set for the second native
+                    // wait in BlockThread.
+                    _ASSERT_MSG(INFINITE != dwTimeout,
+                                "Got ETIMEDOUT despite timeout being INFINITE\n");
+                    iWaitRet = ETIMEDOUT;
+                    break;
+                }
+                else if ((EAGAIN != errno) && (EINTR != errno))
+                {
+                    ERROR("futex wait returned %d [errno=%d (%s)]\n",
+                          iRet, errno, strerror(errno));
+                    iWaitRet = errno;
+                    palErr = ERROR_INTERNAL_ERROR;
+                    break;
+                }
+            }
+        }
+#else // SYNCHMGR_FUTEX_NATIVE_WAIT
         // Lock the mutex
         iRet = pthread_mutex_lock(&ptnwdNativeWaitData->mutex);
         if (0 != iRet)
@@ -532,6 +574,7 @@ namespace CorUnix
         }
 
         _ASSERT_MSG(ETIMEDOUT != iRet || INFINITE != dwTimeout, "Got timeout return code with INFINITE timeout\n");
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
 
         if (0 == iWaitRet)
         {
@@ -2480,6 +2523,21 @@ namespace CorUnix
         PAL_ERROR palErr = NO_ERROR;
         int iRet;
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+        // Publish the wakeup reason and object index along with the predicate.
+        // The target thread may return from its wait as soon as the store is
+        // visible; the wake itself only uses the address as a key and never
+        // touches the target's memory, so that is fine.
+        __atomic_store_n(&ptnwdNativeWaitData->iPred, TRUE, __ATOMIC_RELEASE);
+
+        iRet = syscall(SYS_futex, &ptnwdNativeWaitData->iPred, FUTEX_WAKE | FUTEX_PRIVATE_FLAG, 1, NULL, NULL, 0);
+        if (0 > iRet)
+        {
+            WARN("futex wake returned %d [errno=%d (%s)]\n", iRet, errno, strerror(errno));
+        }
+
+        return palErr;
+#else // SYNCHMGR_FUTEX_NATIVE_WAIT
         // Lock the mutex
         iRet = pthread_mutex_lock(&ptnwdNativeWaitData->mutex);
         if (0 != iRet)
@@ -2511,6 +2569,7 @@ namespace CorUnix
         }
 
         return palErr;
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
     }
 
     /*++
@@ -40,6 +40,15 @@ Abstract:
 // #define SYNCH_STATISTICS
 #endif
 
+// On Linux, threads block in ThreadNativeWait on a futex on the native wait
+// predicate instead of the pthread condition/mutex pair. The absolute timeouts
+// are on CLOCK_MONOTONIC, which is what FUTEX_WAIT_BITSET uses by default.
+#if defined(__linux__) && HAVE_CLOCK_MONOTONIC && HAVE_PTHREAD_CONDATTR_SETCLOCK
+#define SYNCHMGR_FUTEX_NATIVE_WAIT 1
+#else
+#define SYNCHMGR_FUTEX_NATIVE_WAIT 0
+#endif
+
 #ifdef SYNCH_OBJECT_VALIDATION
 #define VALIDATEOBJECT(obj) ((obj)->ValidateObject())
 #else
@@ -356,6 +356,27 @@ PAL_GetCurrentOSThreadId(
     return threadId;
 }
 
+/*++
+Function:
+  GetCurrentProcessorNumber
+
+See MSDN doc. Returns 0 on platforms that can't tell which processor the thread is running on.
+--*/
+DWORD
+PALAPI
+GetCurrentProcessorNumber(
+            VOID)
+{
+#ifdef __linux__
+    int processorNumber = sched_getcpu();
+    if (processorNumber >= 0)
+    {
+        return (DWORD)processorNumber;
+    }
+#endif
+    return 0;
+}
+
 
 /*++
 Function:
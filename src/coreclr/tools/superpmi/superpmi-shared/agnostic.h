@@ -542,6 +542,9 @@ struct Agnostic_GetThreadLocalStaticBlocksInfo
     DWORD                         offsetOfMaxThreadStaticBlocks;
     DWORD                         offsetOfThreadStaticBlocks;
     DWORD                         offsetOfBaseOfThreadLocalData;
+    DWORD                         offsetOfMaxCollectibleThreadStaticBlocks;
+    DWORD                         offsetOfCollectibleThreadStaticBlocks;
+    DWORD                         collectibleTypeIndexFlag;
 };
 
 struct Agnostic_GetThreadStaticInfo_NativeAOT
@@ -3636,6 +3636,9 @@ void MethodContext::recGetThreadLocalStaticBlocksInfo(CORINFO_THREAD_STATIC_BLOC
     value.offsetOfMaxThreadStaticBlocks         = pInfo->offsetOfMaxThreadStaticBlocks;
     value.offsetOfThreadStaticBlocks            = pInfo->offsetOfThreadStaticBlocks;
     value.offsetOfBaseOfThreadLocalData         = pInfo->offsetOfBaseOfThreadLocalData;
+    value.offsetOfMaxCollectibleThreadStaticBlocks = pInfo->offsetOfMaxCollectibleThreadStaticBlocks;
+    value.offsetOfCollectibleThreadStaticBlocks = pInfo->offsetOfCollectibleThreadStaticBlocks;
+    value.collectibleTypeIndexFlag              = pInfo->collectibleTypeIndexFlag;
 
     // This data is same for entire process, so just add it against key '0'.
     DWORD key = 0;
@@ -3651,10 +3654,15 @@ void MethodContext::dmpGetThreadLocalStaticBlocksInfo(DWORD key, const Agnostic_
            ", offsetOfThreadLocalStoragePointer-%u"
            ", offsetOfMaxThreadStaticBlocks-%u"
            ", offsetOfThreadStaticBlocks-%u"
-           ", offsetOfBaseOfThreadLocalData-%u",
+           ", offsetOfBaseOfThreadLocalData-%u"
+           ", offsetOfMaxCollectibleThreadStaticBlocks-%u"
+           ", offsetOfCollectibleThreadStaticBlocks-%u"
+           ", collectibleTypeIndexFlag-%08X",
            key, SpmiDumpHelper::DumpAgnostic_CORINFO_CONST_LOOKUP(value.tlsIndex).c_str(), value.tlsGetAddrFtnPtr,
            value.tlsIndexObject, value.threadVarsSection, value.offsetOfThreadLocalStoragePointer,
-           value.offsetOfMaxThreadStaticBlocks, value.offsetOfThreadStaticBlocks, value.offsetOfBaseOfThreadLocalData);
+           value.offsetOfMaxThreadStaticBlocks, value.offsetOfThreadStaticBlocks, value.offsetOfBaseOfThreadLocalData,
+           value.offsetOfMaxCollectibleThreadStaticBlocks, value.offsetOfCollectibleThreadStaticBlocks,
+           value.collectibleTypeIndexFlag);
 }
 
 void MethodContext::repGetThreadLocalStaticBlocksInfo(CORINFO_THREAD_STATIC_BLOCKS_INFO* pInfo)
@@ -3672,6 +3680,9 @@ void MethodContext::repGetThreadLocalStaticBlocksInfo(CORINFO_THREAD_STATIC_BLOC
     pInfo->offsetOfMaxThreadStaticBlocks        = value.offsetOfMaxThreadStaticBlocks;
     pInfo->offsetOfThreadStaticBlocks           = value.offsetOfThreadStaticBlocks;
     pInfo->offsetOfBaseOfThreadLocalData        = value.offsetOfBaseOfThreadLocalData;
+    pInfo->offsetOfMaxCollectibleThreadStaticBlocks = value.offsetOfMaxCollectibleThreadStaticBlocks;
+    pInfo->offsetOfCollectibleThreadStaticBlocks = value.offsetOfCollectibleThreadStaticBlocks;
+    pInfo->collectibleTypeIndexFlag             = value.collectibleTypeIndexFlag;
 }
 
 void MethodContext::recGetThreadLocalStaticInfo_NativeAOT(CORINFO_THREAD_STATIC_INFO_NATIVEAOT* pInfo)
@@ -70,6 +70,9 @@ MethodContextReader::MethodContextReader(
     const char* inputFileName, const int* indexes, int indexCount, char* hash, int offset, int increment)
     : fileHandle(INVALID_HANDLE_VALUE)
     , fileSize(0)
+    , fileMapping(INVALID_HANDLE_VALUE)
+    , fileView(nullptr)
+    , viewPos(0)
     , curMCIndex(0)
     , Indexes(indexes)
     , IndexCount(indexCount)
@@ -113,6 +116,7 @@ MethodContextReader::MethodContextReader(
     if (this->fileHandle != INVALID_HANDLE_VALUE)
     {
         GetFileSizeEx(this->fileHandle, (PLARGE_INTEGER) & this->fileSize);
+        MapFile();
     }
 
     ReadExcludedMethods(mchFileName);
@@ -120,6 +124,16 @@ MethodContextReader::MethodContextReader(
 
 MethodContextReader::~MethodContextReader()
 {
+    if (fileView != nullptr)
+    {
+        UnmapViewOfFile(this->fileView);
+    }
+
+    if (fileMapping != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(this->fileMapping);
+    }
+
     if (fileHandle != INVALID_HANDLE_VALUE)
     {
         CloseHandle(this->fileHandle);
@@ -141,32 +155,106 @@ void MethodContextReader::ReleaseLock()
     ReleaseMutex(this->mutex);
 }
 
-bool MethodContextReader::atEof()
+// Mapping the file lets the parallel replay workers share the page cache instead of each
+// copying every method context through ReadFile, and makes the TOC driven random access
+// (-c, -m and parallel offset/increment) a pointer adjustment rather than a seek.
+void MethodContextReader::MapFile()
+{
+    if ((this->fileSize == 0) || ((uint64_t)this->fileSize > SIZE_MAX))
+    {
+        return;
+    }
+
+    LARGE_INTEGER size;
+    size.QuadPart = this->fileSize;
+    HANDLE mapping = CreateFileMapping(this->fileHandle, nullptr, PAGE_READONLY, size.u.HighPart, size.u.LowPart, nullptr);
+    if (mapping == nullptr)
+    {
+        LogDebug("Failed to map the input file, falling back to ReadFile. GetLastError()=%u", GetLastError());
+        return;
+    }
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr)
+    {
+        LogDebug("Failed to map a view of the input file, falling back to ReadFile. GetLastError()=%u", GetLastError());
+        CloseHandle(mapping);
+        return;
+    }
+
+    this->fileMapping = mapping;
+    this->fileView    = (unsigned char*)view;
+    this->viewPos     = 0;
+}
+
+int64_t MethodContextReader::GetFilePosition()
 {
+    if (this->fileView != nullptr)
+    {
+        return this->viewPos;
+    }
+
     int64_t pos = 0;
     SetFilePointerEx(this->fileHandle, *(PLARGE_INTEGER)&pos, (PLARGE_INTEGER)&pos,
                      FILE_CURRENT); // LARGE_INTEGER is a crime against humanity
-    return pos == this->fileSize;
+    return pos;
+}
+
+bool MethodContextReader::SetFilePosition(int64_t pos)
+{
+    if (this->fileView != nullptr)
+    {
+        if ((pos < 0) || (pos > this->fileSize))
+        {
+            return false;
+        }
+
+        this->viewPos = pos;
+        return true;
+    }
+
+    return SetFilePointerEx(this->fileHandle, *(PLARGE_INTEGER)&pos, NULL, FILE_BEGIN) == TRUE;
+}
+
+bool MethodContextReader::ReadBytes(void* buffer, DWORD count)
+{
+    if (this->fileView != nullptr)
+    {
+        if (count > this->fileSize - this->viewPos)
+        {
+            return false;
+        }
+
+        memcpy(buffer, this->fileView + this->viewPos, count);
+        this->viewPos += count;
+        return true;
+    }
+
+    DWORD bytesRead;
+    return (ReadFile(this->fileHandle, buffer, count, &bytesRead, NULL) == TRUE) && (bytesRead == count);
+}
+
+bool MethodContextReader::atEof()
+{
+    return GetFilePosition() == this->fileSize;
 }
 
 MethodContextBuffer MethodContextReader::ReadMethodContextNoLock(bool justSkip)
 {
-    DWORD        bytesRead;
     char         buff[512];
     unsigned int totalLen = 0;
     if (atEof())
     {
         return MethodContextBuffer();
     }
-    Assert(ReadFile(this->fileHandle, buff, 2 + sizeof(unsigned int), &bytesRead, NULL) == TRUE);
+    Assert(ReadBytes(buff, 2 + sizeof(unsigned int)));
     AssertMsg((buff[0] == 'm') && (buff[1] == 'c'), "Didn't find magic number");
     memcpy(&totalLen, &buff[2], sizeof(unsigned int));
     if (justSkip)
     {
-        int64_t pos = totalLen + 2;
+        int64_t pos = GetFilePosition() + totalLen + 2;
         // Just move the file pointer ahead the correct number of bytes
-        AssertMsg(SetFilePointerEx(this->fileHandle, *(PLARGE_INTEGER)&pos, (PLARGE_INTEGER)&pos, FILE_CURRENT) == TRUE,
-                  "SetFilePointerEx failed (Error %X)", GetLastError());
+        AssertMsg(SetFilePosition(pos), "Failed to skip a method context (Error %X)", GetLastError());
 
         // Increment curMCIndex as we advanced the file pointer by another MC
         ++curMCIndex;
@@ -176,7 +264,7 @@ MethodContextBuffer MethodContextReader::ReadMethodContextNoLock(bool justSkip)
     else
     {
         unsigned char* buff2 = new unsigned char[totalLen + 2]; // total + End Canary
-        Assert(ReadFile(this->fileHandle, buff2, totalLen + 2, &bytesRead, NULL) == TRUE);
+        Assert(ReadBytes(buff2, totalLen + 2));
 
         // Increment curMCIndex as we read another MC
         ++curMCIndex;
@@ -424,8 +512,7 @@ double MethodContextReader::Progress()
     else
     {
         this->AcquireLock();
-        int64_t pos = 0;
-        SetFilePointerEx(this->fileHandle, *(PLARGE_INTEGER)&pos, (PLARGE_INTEGER)&pos, FILE_CURRENT);
+        int64_t pos = GetFilePosition();
         this->ReleaseLock();
         return (double)pos;
     }
@@ -498,7 +585,7 @@ MethodContextBuffer MethodContextReader::GetSpecificMethodContext(unsigned int m
     {
         return MethodContextBuffer(-2);
     }
-    if (SetFilePointerEx(this->fileHandle, *(PLARGE_INTEGER)&pos, (PLARGE_INTEGER)&pos, FILE_BEGIN))
+    if (SetFilePosition(pos))
     {
         // ReadMethodContext will release the lock, but we already acquired it
         MethodContextBuffer mcb = this->ReadMethodContext(false);
@@ -622,8 +709,7 @@ bool MethodContextReader::IsMethodExcluded(MethodContext* mc)
 
 void MethodContextReader::Reset(const int* newIndexes, int newIndexCount)
 {
-    int64_t pos    = 0;
-    BOOL    result = SetFilePointerEx(fileHandle, *(PLARGE_INTEGER)&pos, NULL, FILE_BEGIN);
+    bool result = SetFilePosition(0);
     assert(result);
     
     Indexes     = newIndexes;
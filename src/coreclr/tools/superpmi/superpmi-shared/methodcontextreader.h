@@ -52,6 +52,13 @@ private:
     // The size of the MC/MCH file
     int64_t fileSize;
 
+    // Read-only view of the whole MC/MCH file, or nullptr if it couldn't be mapped.
+    // When mapped, the method contexts are copied straight out of the view and
+    // viewPos replaces the file pointer.
+    HANDLE         fileMapping;
+    unsigned char* fileView;
+    int64_t        viewPos;
+
     // Current MC index in the input MC/MCH file
     int curMCIndex;
 
@@ -95,6 +102,14 @@ private:
     // Just a helper...
     static HANDLE OpenFile(const char* inputFile, DWORD flags = FILE_ATTRIBUTE_NORMAL);
 
+    // Map the opened MC/MCH file, falling back to ReadFile if that fails
+    void MapFile();
+
+    // Position in and reads from the MC/MCH file, using the view if we have one
+    int64_t GetFilePosition();
+    bool    SetFilePosition(int64_t pos);
+    bool    ReadBytes(void* buffer, DWORD count);
+
     MethodContextBuffer ReadMethodContextNoLock(bool justSkip = false);
     MethodContextBuffer ReadMethodContext(bool acquireLock, bool justSkip = false);
     MethodContextBuffer GetSpecificMethodContext(unsigned int methodNumber);
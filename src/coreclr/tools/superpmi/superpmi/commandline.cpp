@@ -126,6 +126,11 @@ void CommandLine::DumpHelp(const char* program)
     printf("     Number of times compilation should repeat for each method context. Usually used when\n");
     printf("     trying to measure JIT throughput for a specific set of methods. Default=1.\n");
     printf("\n");
+    printf(" -throughputSamples <sample count>\n");
+    printf("     Number of times each method is compiled when measuring JIT throughput with\n");
+    printf("     -emitMethodStats t. The fastest compilations are reported. Default=10.\n");
+    printf("     Per-phase times can be collected with -jitoption JitTimeLogCsv=<file>.\n");
+    printf("\n");
     printf(" -target <target>\n");
     printf("     Used by the assembly differences calculator. This specifies the target\n");
     printf("     architecture for cross-compilation. Currently allowed <target> values: x64, x86, arm, arm64\n");
@@ -546,6 +551,23 @@ bool CommandLine::Parse(int argc, char* argv[], /* OUT */ Options* o)
             {
                 o->skipCleanup = true;
             }
+            else if ((_stricmp(&argv[i][1], "throughputSamples") == 0))
+            {
+                if (++i >= argc)
+                {
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+
+                o->throughputSampleCount = atoi(argv[i]);
+
+                if (o->throughputSampleCount < 2)
+                {
+                    LogError("Incorrect sample count specified for -throughputSamples. Count must be > 1.");
+                    DumpHelp(argv[0]);
+                    return false;
+                }
+            }
             else if ((_stricmp(&argv[i][1], "repeatCount") == 0))
             {
                 if (++i >= argc)
@@ -473,7 +473,7 @@ void JitInstance::timeResult(CORINFO_METHOD_INFO info, unsigned flags)
     uint8_t* NEntryBlock    = nullptr;
     uint32_t NCodeSizeBlock = 0;
 
-    int sampleSize = 10;
+    int sampleSize = throughputSampleCount;
     // Save 2 smallest times. To help reduce noise, we will look at the closest pair of these.
     uint64_t time;
 
@@ -53,6 +53,7 @@ public:
     CycleTimer       lt;
     MethodContext*   mc;
     ULONGLONG        times[2];
+    int              throughputSampleCount = 10;
     ICorJitCompiler* pJitInstance;
 
     // Allocate and initialize the jit provided
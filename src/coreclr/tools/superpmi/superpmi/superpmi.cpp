@@ -349,6 +349,16 @@ int __cdecl main(int argc, char* argv[])
     int index             = 0;
     int excludedCount     = 0;
 
+    // Throughput totals over the methods both JITs compiled, using the fastest
+    // compilation of each. The per-method log ratios give a geometric mean that
+    // isn't dominated by a few large methods.
+    int       throughputCount      = 0;
+    int       throughputJit2Faster = 0;
+    int       throughputJit2Slower = 0;
+    ULONGLONG throughputCycles     = 0;
+    ULONGLONG throughputCycles2    = 0;
+    double    throughputLogRatios  = 0;
+
     st1.Start();
     NearDiffer nearDiffer(o.targetArchitecture, o.useCoreDisTools);
 
@@ -433,6 +443,7 @@ int __cdecl main(int argc, char* argv[])
                     // InitJit already printed a failure message
                     return (int)SpmiResult::JitFailedToInit;
                 }
+                jit->throughputSampleCount = o.throughputSampleCount;
 
                 if (o.nameOfJit2 != nullptr)
                 {
@@ -443,6 +454,7 @@ int __cdecl main(int argc, char* argv[])
                         // InitJit already printed a failure message
                         return (int)SpmiResult::JitFailedToInit;
                     }
+                    jit2->throughputSampleCount = o.throughputSampleCount;
                 }
             }
 
@@ -634,6 +646,24 @@ int __cdecl main(int argc, char* argv[])
                             methodStatsEmitter->Emit(reader->GetMethodContextIndex(), mc, crl->clockCyclesToCompile,
                                                      mc->cr->clockCyclesToCompile);
                         }
+
+                        if ((crl->clockCyclesToCompile > 0) && (mc->cr->clockCyclesToCompile > 0))
+                        {
+                            throughputCount++;
+                            throughputCycles += crl->clockCyclesToCompile;
+                            throughputCycles2 += mc->cr->clockCyclesToCompile;
+                            throughputLogRatios +=
+                                log((double)mc->cr->clockCyclesToCompile / (double)crl->clockCyclesToCompile);
+
+                            if (mc->cr->clockCyclesToCompile < crl->clockCyclesToCompile)
+                            {
+                                throughputJit2Faster++;
+                            }
+                            else if (mc->cr->clockCyclesToCompile > crl->clockCyclesToCompile)
+                            {
+                                throughputJit2Slower++;
+                            }
+                        }
                     }
                     else
                     {
@@ -645,6 +675,9 @@ int __cdecl main(int argc, char* argv[])
                         {
                             methodStatsEmitter->Emit(reader->GetMethodContextIndex(), mc, mc->cr->clockCyclesToCompile, 0);
                         }
+
+                        throughputCount++;
+                        throughputCycles += mc->cr->clockCyclesToCompile;
                     }
                 }
 
@@ -794,6 +827,22 @@ doneRepeatCount:
         LogInfo(g_SummaryFormatString, loadedCount, jittedCount, failToReplayCount, excludedCount, missingCount);
     }
 
+    if (collectThroughput && (throughputCount > 0))
+    {
+        if (o.nameOfJit2 != nullptr)
+        {
+            LogInfo("Throughput: %d methods, JIT %llu cycles, JIT2 %llu cycles (%+.2f%%), geomean ratio %.4f, "
+                    "JIT2 faster on %d, slower on %d",
+                    throughputCount, throughputCycles, throughputCycles2,
+                    100.0 * ((double)throughputCycles2 - (double)throughputCycles) / (double)throughputCycles,
+                    exp(throughputLogRatios / throughputCount), throughputJit2Faster, throughputJit2Slower);
+        }
+        else
+        {
+            LogInfo("Throughput: %d methods, %llu cycles", throughputCount, throughputCycles);
+        }
+    }
+
     st2.Stop();
     LogVerbose("Total time: %fms", st2.GetMilliseconds());
 
@@ -17,6 +17,8 @@ BYTE * ExecutableAllocator::g_preferredRangeMax;
 
 bool ExecutableAllocator::g_isWXorXEnabled = false;
 
+bool ExecutableAllocator::g_isHugePagesEnabled = false;
+
 ExecutableAllocator::FatalErrorHandler ExecutableAllocator::g_fatalErrorHandler = NULL;
 ExecutableAllocator* ExecutableAllocator::g_instance = NULL;
 
@@ -262,6 +264,7 @@ HRESULT ExecutableAllocator::StaticInitialize(FatalErrorHandler fatalErrorHandle
 
     g_fatalErrorHandler = fatalErrorHandler;
     g_isWXorXEnabled = Configuration::GetKnobBooleanValue(W("System.Runtime.EnableWriteXorExecute"), CLRConfig::EXTERNAL_EnableWriteXorExecute);
+    g_isHugePagesEnabled = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_ExecutableHugePages) != 0;
     g_instance = new (nothrow) ExecutableAllocator();
     if (g_instance == NULL)
     {
@@ -552,10 +555,8 @@ void ExecutableAllocator::Release(void* pRX)
             {
                 g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Releasing the double mapped memory failed"));
             }
-            // Put the released block into the free block list
-            pBlock->baseRX = NULL;
-            pBlock->next = m_pFirstFreeBlockRX;
-            m_pFirstFreeBlockRX = pBlock;
+            // Put the released block into the free blocks
+            AddFreeBlock(pBlock);
         }
         else
         {
@@ -571,40 +572,131 @@ void ExecutableAllocator::Release(void* pRX)
     }
 }
 
-// Find a free block with the size == the requested size.
-// Returns NULL if no such block exists.
-ExecutableAllocator::BlockRX* ExecutableAllocator::FindBestFreeBlock(size_t size)
+int ExecutableAllocator::GetFreeBlockBucket(size_t size)
 {
     LIMITED_METHOD_CONTRACT;
 
-    BlockRX* pPrevBlock = NULL;
-    BlockRX* pBlock = m_pFirstFreeBlockRX;
+    size_t units = size / Granularity();
+    int bucket = 0;
+    while ((units >>= 1) != 0 && bucket < FreeBlockBucketCount - 1)
+    {
+        bucket++;
+    }
+
+    return bucket;
+}
+
+void ExecutableAllocator::RemoveFreeBlock(BlockRX* pBlock)
+{
+    LIMITED_METHOD_CONTRACT;
 
-    while (pBlock != NULL)
+    for (BlockRX** ppBlock = &m_pFreeBlocksRX[GetFreeBlockBucket(pBlock->size)]; *ppBlock != NULL; ppBlock = &((*ppBlock)->next))
     {
-        if (pBlock->size == size)
+        if (*ppBlock == pBlock)
         {
-            break;
+            *ppBlock = pBlock->next;
+            pBlock->next = NULL;
+            return;
+        }
+    }
+
+    _ASSERTE(!"The free block was not found");
+}
+
+// Add a released or backed out block to the free blocks. Merging it with the free blocks around it in the
+// shared memory lets the space be reused by requests of any size, not just of the size it was allocated with,
+// which matters when the code of collectible assemblies is repeatedly unloaded and loaded again.
+void ExecutableAllocator::AddFreeBlock(BlockRX* pBlock)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    pBlock->baseRX = NULL;
+
+    bool merged;
+    do
+    {
+        merged = false;
+        for (int i = 0; i < FreeBlockBucketCount && !merged; i++)
+        {
+            for (BlockRX* pFreeBlock = m_pFreeBlocksRX[i]; pFreeBlock != NULL; pFreeBlock = pFreeBlock->next)
+            {
+                if ((pFreeBlock->offset + pFreeBlock->size == pBlock->offset) ||
+                    (pBlock->offset + pBlock->size == pFreeBlock->offset))
+                {
+                    RemoveFreeBlock(pFreeBlock);
+                    pBlock->offset = min(pBlock->offset, pFreeBlock->offset);
+                    pBlock->size += pFreeBlock->size;
+                    delete pFreeBlock;
+                    merged = true;
+                    break;
+                }
+            }
         }
-        pPrevBlock = pBlock;
-        pBlock = pBlock->next;
     }
+    while (merged);
 
-    if (pBlock != NULL)
+    if (pBlock->offset + pBlock->size == m_freeOffset)
     {
-        if (pPrevBlock != NULL)
+        // The block is at the end of the used part of the shared memory, so just give it back
+        m_freeOffset = pBlock->offset;
+        delete pBlock;
+        return;
+    }
+
+    int bucket = GetFreeBlockBucket(pBlock->size);
+    pBlock->next = m_pFreeBlocksRX[bucket];
+    m_pFreeBlocksRX[bucket] = pBlock;
+}
+
+// Find a free block with the closest size >= the requested size. The rest of a larger block
+// stays free. Returns NULL if no such block exists.
+ExecutableAllocator::BlockRX* ExecutableAllocator::FindBestFreeBlock(size_t size)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Only the first bucket can contain blocks smaller than the requested size
+    for (int i = GetFreeBlockBucket(size); i < FreeBlockBucketCount; i++)
+    {
+        BlockRX* pBestBlock = NULL;
+        for (BlockRX* pBlock = m_pFreeBlocksRX[i]; pBlock != NULL; pBlock = pBlock->next)
         {
-            pPrevBlock->next = pBlock->next;
+            if ((pBlock->size >= size) &&
+                ((pBestBlock == NULL) || (pBlock->size < pBestBlock->size) ||
+                 ((pBlock->size == pBestBlock->size) && (pBlock->offset < pBestBlock->offset))))
+            {
+                pBestBlock = pBlock;
+            }
+        }
+
+        if (pBestBlock == NULL)
+        {
+            continue;
+        }
+
+        if (pBestBlock->size > size)
+        {
+            BlockRX* pRestBlock = new (nothrow) BlockRX();
+            if (pRestBlock == NULL)
+            {
+                return NULL;
+            }
+
+            RemoveFreeBlock(pBestBlock);
+            pRestBlock->offset = pBestBlock->offset + size;
+            pRestBlock->size = pBestBlock->size - size;
+            pRestBlock->next = NULL;
+            pBestBlock->size = size;
+            AddFreeBlock(pRestBlock);
         }
         else
         {
-            m_pFirstFreeBlockRX = pBlock->next;
+            RemoveFreeBlock(pBestBlock);
         }
 
-        pBlock->next = NULL;
+        return pBestBlock;
     }
 
-    return pBlock;
+    return NULL;
 }
 
 // Allocate a new block of executable memory and the related descriptor structure.
@@ -651,8 +743,7 @@ void ExecutableAllocator::BackoutBlock(BlockRX* pBlock, bool isFreeBlock)
     }
     else
     {
-        pBlock->next = m_pFirstFreeBlockRX;
-        m_pFirstFreeBlockRX = pBlock;
+        AddFreeBlock(pBlock);
     }
 }
 
@@ -684,6 +775,12 @@ void* ExecutableAllocator::ReserveWithinRange(size_t size, const void* loAddress
         {
             block->baseRX = result;
             AddRXBlock(block);
+
+            if (g_isHugePagesEnabled)
+            {
+                // The shared memory mapping replaces the advice the PAL gave the reserved range
+                VMToOSInterface::AdviseHugePages(result, size);
+            }
         }
         else
         {
@@ -776,6 +873,11 @@ void* ExecutableAllocator::Reserve(size_t size)
             {
                 block->baseRX = result;
                 AddRXBlock(block);
+
+                if (g_isHugePagesEnabled)
+                {
+                    VMToOSInterface::AdviseHugePages(result, size);
+                }
             }
             else
             {
@@ -827,6 +929,11 @@ void* ExecutableAllocator::ReserveAt(void* baseAddressRX, size_t size)
         {
             block->baseRX = result;
             AddRXBlock(block);
+
+            if (g_isHugePagesEnabled)
+            {
+                VMToOSInterface::AdviseHugePages(result, size);
+            }
         }
         else
         {
@@ -909,6 +1016,7 @@ void* ExecutableAllocator::MapRW(void* pRX, size_t size, CacheableMapping cacheM
             }
 
             AddRWBlock(pRW, (BYTE*)pBlock->baseRX + mapOffset, mapSize, cacheMapping);
+            m_rwMapCount++;
 
             return (void*)((size_t)pRW + (offset - mapOffset));
         }
@@ -957,8 +1065,57 @@ void ExecutableAllocator::UnmapRW(void* pRW)
         g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("The RW block to unmap was not found"));
     }
 
-    if (unmapAddress && !VMToOSInterface::ReleaseRWMapping(unmapAddress, unmapSize))
+    if (unmapAddress != NULL)
     {
-        g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Releasing the RW mapping failed"));
+        if (!VMToOSInterface::ReleaseRWMapping(unmapAddress, unmapSize))
+        {
+            g_fatalErrorHandler(COR_E_EXECUTIONENGINE, W("Releasing the RW mapping failed"));
+        }
+
+        m_rwUnmapCount++;
+    }
+}
+
+void ExecutableAllocator::GetSharedMemoryStatistics(size_t* pUsedSize, size_t* pFreeSize, size_t* pFreeBlockCount, size_t* pLargestFreeBlockSize)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    *pUsedSize = 0;
+    *pFreeSize = 0;
+    *pFreeBlockCount = 0;
+    *pLargestFreeBlockSize = 0;
+
+    if (!IsDoubleMappingEnabled())
+    {
+        return;
+    }
+
+    CRITSEC_Holder csh(m_CriticalSection);
+
+    *pUsedSize = m_freeOffset;
+    for (int i = 0; i < FreeBlockBucketCount; i++)
+    {
+        for (BlockRX* pBlock = m_pFreeBlocksRX[i]; pBlock != NULL; pBlock = pBlock->next)
+        {
+            *pFreeSize += pBlock->size;
+            (*pFreeBlockCount)++;
+            *pLargestFreeBlockSize = max(*pLargestFreeBlockSize, pBlock->size);
+        }
     }
 }
+
+void ExecutableAllocator::GetRWMappingCounts(UINT64* pMapCount, UINT64* pUnmapCount)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (!IsDoubleMappingEnabled())
+    {
+        *pMapCount = 0;
+        *pUnmapCount = 0;
+        return;
+    }
+
+    CRITSEC_Holder csh(m_CriticalSection);
+    *pMapCount = m_rwMapCount;
+    *pUnmapCount = m_rwUnmapCount;
+}
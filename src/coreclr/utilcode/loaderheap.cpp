@@ -950,6 +950,7 @@ UnlockedLoaderHeap::UnlockedLoaderHeap(DWORD dwReserveBlockSize,
 
     m_pPtrToEndOfCommittedRegion = NULL;
     m_pEndReservedRegion         = NULL;
+    m_pEndOfCommittedInterleavedPages = NULL;
     m_pAllocPtr                  = NULL;
 
     m_pRangeList                 = pRangeList;
@@ -1088,28 +1089,60 @@ void ReleaseReservedMemory(BYTE* value)
 
 using ReservedMemoryHolder = SpecializedWrapper<BYTE, ReleaseReservedMemory>;
 
-BOOL UnlockedLoaderHeap::CommitPages(void* pData, size_t dwSizeToCommitPart)
-{
-    // Commit first set of pages, since it will contain the LoaderHeapBlock
-    void *pTemp = ExecutableAllocator::Instance()->Commit(pData, dwSizeToCommitPart, IsExecutable());
-    if (pTemp == NULL)
-    {
-        return FALSE;
-    }
+// With W^X, filling each new interleaved code page requires creating and releasing a RW mapping. Commit this
+// many code/data page pairs at once and fill their code pages through a single mapping.
+#define INTERLEAVED_PAGE_PAIRS_PER_COMMIT 4
 
+BOOL UnlockedLoaderHeap::CommitPages(void* pData, size_t dwSizeToCommitPart, BYTE* pEndReservedRegion)
+{
     if (IsInterleaved())
     {
         _ASSERTE(dwSizeToCommitPart == GetStubCodePageSize());
 
-        void *pTemp = ExecutableAllocator::Instance()->Commit((BYTE*)pData + dwSizeToCommitPart, dwSizeToCommitPart, FALSE);
-        if (pTemp == NULL)
+        size_t dwPairSize = 2 * dwSizeToCommitPart;
+        size_t maxPairCount = 1;
+        if (ExecutableAllocator::IsWXORXEnabled())
         {
-            return FALSE;
+            maxPairCount = max((size_t)1, min((size_t)INTERLEAVED_PAGE_PAIRS_PER_COMMIT, (size_t)(pEndReservedRegion - (BYTE*)pData) / dwPairSize));
+        }
+
+        size_t pairCount = 0;
+        while (pairCount < maxPairCount)
+        {
+            BYTE* pCodePage = (BYTE*)pData + pairCount * dwPairSize;
+            if ((ExecutableAllocator::Instance()->Commit(pCodePage, dwSizeToCommitPart, IsExecutable()) == NULL) ||
+                (ExecutableAllocator::Instance()->Commit(pCodePage + dwSizeToCommitPart, dwSizeToCommitPart, FALSE) == NULL))
+            {
+                // The pairs committed ahead are only an optimization
+                if (pairCount == 0)
+                {
+                    return FALSE;
+                }
+                break;
+            }
+
+            pairCount++;
+        }
+
+        // The mapping also covers the data pages between the code pages, which are not written through it
+        size_t dwMappedSize = pairCount * dwPairSize - dwSizeToCommitPart;
+        {
+            ExecutableWriterHolder<BYTE> codePageWriterHolder((BYTE*)pData, dwMappedSize, ExecutableAllocator::DoNotAddToCache);
+            for (size_t i = 0; i < pairCount; i++)
+            {
+                m_codePageGenerator(codePageWriterHolder.GetRW() + i * dwPairSize, (BYTE*)pData + i * dwPairSize, dwSizeToCommitPart);
+            }
         }
+        FlushInstructionCache(GetCurrentProcess(), pData, dwMappedSize);
+
+        m_pEndOfCommittedInterleavedPages = (BYTE*)pData + pairCount * dwPairSize;
+        return TRUE;
+    }
 
-        ExecutableWriterHolder<BYTE> codePageWriterHolder((BYTE*)pData, dwSizeToCommitPart, ExecutableAllocator::DoNotAddToCache);
-        m_codePageGenerator(codePageWriterHolder.GetRW(), (BYTE*)pData, dwSizeToCommitPart);
-        FlushInstructionCache(GetCurrentProcess(), pData, dwSizeToCommitPart);
+    void *pTemp = ExecutableAllocator::Instance()->Commit(pData, dwSizeToCommitPart, IsExecutable());
+    if (pTemp == NULL)
+    {
+        return FALSE;
     }
 
     return TRUE;
@@ -1194,7 +1227,7 @@ BOOL UnlockedLoaderHeap::UnlockedReservePages(size_t dwSizeToCommit)
         dwSizeToCommitPart /= 2;
     }
 
-    if (!CommitPages(pData, dwSizeToCommitPart))
+    if (!CommitPages(pData, dwSizeToCommitPart, (BYTE*)pData + dwSizeToReserve))
     {
         return FALSE;
     }
@@ -1310,9 +1343,13 @@ BOOL UnlockedLoaderHeap::GetMoreCommittedPages(size_t dwMinSize)
             dwSizeToCommitPart /= 2;
         }
 
-        if (!CommitPages(pCommitBaseAddress, dwSizeToCommitPart))
+        // Interleaved page pairs may have been committed ahead already
+        if (!IsInterleaved() || (pCommitBaseAddress + dwSizeToCommit > m_pEndOfCommittedInterleavedPages))
         {
-            return FALSE;
+            if (!CommitPages(pCommitBaseAddress, dwSizeToCommitPart, m_pEndReservedRegion))
+            {
+                return FALSE;
+            }
         }
 
         if (IsInterleaved())
@@ -1673,6 +1710,214 @@ void UnlockedLoaderHeap::UnlockedBackoutMem(void *pMem,
     }
 }
 
+//=====================================================================================
+// Per-thread allocation buffers
+//
+// Small allocations from a locked data LoaderHeap are bump-allocated from a buffer owned by
+// the allocating thread, so that threads loading types or generating stubs in parallel only
+// take the heap lock when a buffer runs dry. A thread keeps buffers for a handful of heaps at
+// a time. The buffers are carved from the heap's allocation pointer and are zero-initialized
+// like any other LoaderHeap memory, and each allocation made from them has the same layout
+// (debug boundary, validation tag) as an allocation made through UnlockedAllocMem.
+//=====================================================================================
+#define LOADER_HEAP_THREAD_BUFFER_SIZE          512
+#define LOADER_HEAP_THREAD_BUFFER_MAX_ALLOC     128
+#define LOADER_HEAP_THREAD_BUFFER_COUNT         8
+
+static_assert(LOADER_HEAP_THREAD_BUFFER_MAX_ALLOC <= LOADER_HEAP_THREAD_BUFFER_SIZE, "Thread buffer must fit the largest allocation it serves");
+
+namespace
+{
+    struct LoaderHeapThreadBuffer
+    {
+        UINT64  m_heapId;       // LoaderHeap::m_threadBufferHeapId of the owning heap, 0 if unused
+        BYTE   *m_pAllocPtr;
+        BYTE   *m_pEnd;
+    };
+
+    thread_local LoaderHeapThreadBuffer t_loaderHeapThreadBuffers[LOADER_HEAP_THREAD_BUFFER_COUNT];
+    thread_local DWORD t_nextLoaderHeapThreadBufferToEvict;
+
+    LONG64 s_lastLoaderHeapThreadBufferHeapId = 0;
+
+    LoaderHeapThreadBuffer *FindLoaderHeapThreadBuffer(UINT64 heapId)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        for (DWORD i = 0; i < LOADER_HEAP_THREAD_BUFFER_COUNT; i++)
+        {
+            if (t_loaderHeapThreadBuffers[i].m_heapId == heapId)
+            {
+                return &t_loaderHeapThreadBuffers[i];
+            }
+        }
+        return NULL;
+    }
+}
+
+void *UnlockedLoaderHeap::UnlockedAllocThreadBuffer_NoThrow(size_t dwSize)
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        NOTHROW;
+        GC_NOTRIGGER;
+        INJECT_FAULT(return NULL;);
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(!IsExecutable() && !IsInterleaved() && !m_fExplicitControl);
+    _ASSERTE((dwSize & ALLOC_ALIGN_CONSTANT) == 0);
+
+    while (dwSize > GetBytesAvailCommittedRegion())
+    {
+        if (!GetMoreCommittedPages(dwSize))
+            return NULL;
+    }
+
+    void *pData = m_pAllocPtr;
+    m_pAllocPtr += dwSize;
+    return pData;
+}
+
+void UnlockedLoaderHeap::UnlockedReturnThreadBufferTail(BYTE *pStart, BYTE *pEnd)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE(pStart <= pEnd);
+
+    if (m_pAllocPtr == pEnd)
+    {
+        // The tail was never handed out so it is still zeroed; simply give it back.
+        m_pAllocPtr = pStart;
+    }
+    else
+    {
+        INDEBUG(m_dwDebugWastedBytes += (pEnd - pStart);)
+    }
+}
+
+UINT64 LoaderHeap::GetNewThreadBufferHeapId()
+{
+    LIMITED_METHOD_CONTRACT;
+    return (UINT64)InterlockedIncrement64(&s_lastLoaderHeapThreadBufferHeapId);
+}
+
+void *LoaderHeap::TryAllocFromThreadBuffer(size_t dwRequestedSize
+                                           COMMA_INDEBUG(_In_ const char *szFile)
+                                           COMMA_INDEBUG(int lineNum))
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        NOTHROW;
+        GC_NOTRIGGER;
+        INJECT_FAULT(return NULL;);
+    }
+    CONTRACTL_END;
+
+    if (m_threadBufferHeapId == 0 || dwRequestedSize == 0 || dwRequestedSize > LOADER_HEAP_THREAD_BUFFER_MAX_ALLOC)
+        return NULL;
+
+#ifdef _DEBUG
+    // Call tracing has to see every allocation in order, so keep everything on the locked path.
+    if (m_dwDebugFlags & kCallTracing)
+        return NULL;
+#endif
+
+    size_t dwSize = AllocMem_TotalSize(dwRequestedSize);
+    if (dwSize > LOADER_HEAP_THREAD_BUFFER_MAX_ALLOC)
+        return NULL;
+
+    LoaderHeapThreadBuffer *pBuffer = FindLoaderHeapThreadBuffer(m_threadBufferHeapId);
+    if (pBuffer == NULL || (size_t)(pBuffer->m_pEnd - pBuffer->m_pAllocPtr) < dwSize)
+    {
+        if (pBuffer == NULL)
+        {
+            // Take over an unused buffer if there is one, otherwise evict round-robin. The tail of
+            // an evicted buffer is dropped: its heap may already be gone, so it can't be given back.
+            pBuffer = FindLoaderHeapThreadBuffer(0);
+            if (pBuffer == NULL)
+            {
+                pBuffer = &t_loaderHeapThreadBuffers[t_nextLoaderHeapThreadBufferToEvict++ % LOADER_HEAP_THREAD_BUFFER_COUNT];
+            }
+            pBuffer->m_heapId = 0;
+        }
+
+        CRITSEC_Holder csh(m_CriticalSection);
+
+        if (pBuffer->m_heapId == m_threadBufferHeapId)
+        {
+            UnlockedReturnThreadBufferTail(pBuffer->m_pAllocPtr, pBuffer->m_pEnd);
+            pBuffer->m_heapId = 0;
+        }
+
+        BYTE *pNewBuffer = (BYTE *)UnlockedAllocThreadBuffer_NoThrow(LOADER_HEAP_THREAD_BUFFER_SIZE);
+        if (pNewBuffer == NULL)
+            return NULL;
+
+        pBuffer->m_heapId    = m_threadBufferHeapId;
+        pBuffer->m_pAllocPtr = pNewBuffer;
+        pBuffer->m_pEnd      = pNewBuffer + LOADER_HEAP_THREAD_BUFFER_SIZE;
+    }
+
+    BYTE *pData = pBuffer->m_pAllocPtr;
+    pBuffer->m_pAllocPtr += dwSize;
+
+#ifdef _DEBUG
+#if LOADER_HEAP_DEBUG_BOUNDARY > 0
+    memset(pData + dwRequestedSize, 0xEE, LOADER_HEAP_DEBUG_BOUNDARY);
+#endif
+    _ASSERTE_MSG(pData[0] == 0 && memcmp(pData, pData + 1, dwRequestedSize - 1) == 0,
+        "LoaderHeap must return zero-initialized memory");
+
+    LoaderHeapValidationTag *pTag = AllocMem_GetTag(pData, dwRequestedSize);
+    pTag->m_allocationType  = kAllocMem;
+    pTag->m_dwRequestedSize = dwRequestedSize;
+    pTag->m_szFile          = szFile;
+    pTag->m_lineNum         = lineNum;
+#endif
+
+    EtwAllocRequest(this, pData, dwSize);
+    return pData;
+}
+
+BOOL LoaderHeap::TryBackoutToThreadBuffer(void *pMem, size_t dwRequestedSize)
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        NOTHROW;
+        FORBID_FAULT;
+    }
+    CONTRACTL_END;
+
+    if (m_threadBufferHeapId == 0 || pMem == NULL)
+        return FALSE;
+
+    LoaderHeapThreadBuffer *pBuffer = FindLoaderHeapThreadBuffer(m_threadBufferHeapId);
+    if (pBuffer == NULL)
+        return FALSE;
+
+    size_t dwSize = AllocMem_TotalSize(dwRequestedSize);
+    if (pBuffer->m_pAllocPtr != ((BYTE *)pMem) + dwSize)
+        return FALSE;
+
+#ifdef _DEBUG
+    // Leave mismatched backouts to the locked path, which knows how to report them.
+    LoaderHeapValidationTag *pTag = AllocMem_GetTag(pMem, dwRequestedSize);
+    if (pTag->m_dwRequestedSize != dwRequestedSize || pTag->m_allocationType != kAllocMem)
+        return FALSE;
+#endif
+
+    // This was the last block handed out from this thread's buffer, so undo the allocation.
+    // Whatever precedes it in the buffer belongs to this thread's earlier allocations, which
+    // are unaffected.
+    memset(pMem, 0x00, dwSize);
+    pBuffer->m_pAllocPtr = (BYTE *)pMem;
+    return TRUE;
+}
+
 
 // Allocates memory aligned on power-of-2 boundary.
 //
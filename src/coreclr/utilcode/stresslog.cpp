@@ -221,6 +221,69 @@ static LPVOID CreateMemoryMappedFile(LPWSTR logFilename, size_t maxBytesTotal)
 }
 #endif //MEMORY_MAPPED_STRESSLOG
 
+/*********************************************************************************/
+unsigned StressLog::ParseFacilityNames(LPCWSTR names)
+{
+    STATIC_CONTRACT_LEAF;
+
+    static const struct
+    {
+        LPCWSTR name;
+        unsigned facilities;
+    } categories[] =
+    {
+        { W("GC"),          LF_GC | LF_GCALLOC | LF_GCROOTS },
+        { W("JIT"),         LF_JIT | LF_TIEREDCOMPILATION },
+        { W("ThreadPool"),  LF_THREADPOOL },
+        { W("Suspension"),  LF_SYNC },
+        { W("Loader"),      LF_LOADER | LF_CLASSLOADER },
+        { W("Interop"),     LF_INTEROP | LF_MARSHALER },
+        { W("EH"),          LF_EH },
+        { W("Startup"),     LF_STARTUP },
+    };
+
+    unsigned facilities = 0;
+    if (names == nullptr)
+    {
+        return facilities;
+    }
+
+    LPCWSTR start = names;
+    while (*start != W('\0'))
+    {
+        LPCWSTR end = start;
+        while ((*end != W('\0')) && (*end != W(',')))
+        {
+            end++;
+        }
+
+        // Ignore the spaces around each name
+        LPCWSTR nameEnd = end;
+        while ((start < nameEnd) && (*start == W(' ')))
+        {
+            start++;
+        }
+        while ((nameEnd > start) && (nameEnd[-1] == W(' ')))
+        {
+            nameEnd--;
+        }
+
+        COUNT_T length = (COUNT_T)(nameEnd - start);
+        for (size_t i = 0; i < ARRAY_SIZE(categories); i++)
+        {
+            if ((u16_strlen(categories[i].name) == length) && (SString::_wcsnicmp(start, categories[i].name, length) == 0))
+            {
+                facilities |= categories[i].facilities;
+                break;
+            }
+        }
+
+        start = (*end == W(',')) ? end + 1 : end;
+    }
+
+    return facilities;
+}
+
 /*********************************************************************************/
 void StressLog::Initialize(unsigned facilities, unsigned level, unsigned maxBytesPerThreadArg,
     unsigned maxBytesTotalArg, void* moduleBase, LPWSTR logFilename)
@@ -15,3 +15,4 @@ unsigned int YieldProcessorNormalization::s_optimalMaxNormalizedYieldsPerSpinIte
         YieldProcessorNormalization::TargetNsPerNormalizedYield +
         0.5
     );
+UINT32 YieldProcessorNormalization::s_normalizationByProcessor[YieldProcessorNormalization::MaxNormalizedProcessorCount];
@@ -36,6 +36,9 @@
     IMPORT  g_lowest_address
     IMPORT  g_highest_address
     IMPORT  g_card_table
+    IMPORT  g_region_to_generation_table
+    IMPORT  g_region_shr
+    IMPORT  g_region_use_bitwise_write_barrier
     IMPORT  g_dispatch_cache_chain_success_counter
 #ifdef WRITE_BARRIER_CHECK
     SETALIAS g_GCShadow, ?g_GCShadow@@3PEAEEA
@@ -254,7 +257,7 @@ ThePreStubPatchLabel
     LEAF_ENTRY JIT_UpdateWriteBarrierState
         PROLOG_SAVE_REG_PAIR   fp, lr, #-16!
 
-        ; x0-x7, x10 will contain intended new state
+        ; x0-x7, x10, x11, x13, x14 will contain intended new state
         ; x8 will preserve skipEphemeralCheck
         ; x12 will be used for pointers
 
@@ -292,6 +295,15 @@ EphemeralCheckEnabled
         adrp     x12, g_highest_address
         ldr      x6, [x12, g_highest_address]
 
+        adrp     x12, g_region_to_generation_table
+        ldr      x11, [x12, g_region_to_generation_table]
+
+        adrp     x12, g_region_shr
+        ldrb     w13, [x12, g_region_shr]
+
+        adrp     x12, g_region_use_bitwise_write_barrier
+        ldrb     w14, [x12, g_region_use_bitwise_write_barrier]
+
 #ifdef WRITE_BARRIER_CHECK
         adrp     x12, $g_GCShadow
         ldr      x7, [x12, $g_GCShadow]
@@ -307,7 +319,8 @@ EphemeralCheckEnabled
         stp      x0, x1, [x12], 16
         stp      x2, x3, [x12], 16
         stp      x4, x5, [x12], 16
-        str      x6, [x12], 8
+        stp      x6, x11, [x12], 16
+        stp      x13, x14, [x12], 16
 #ifdef WRITE_BARRIER_CHECK
         stp     x7, x10, [x12], 16
 #endif
@@ -5,8 +5,8 @@
 #include "asmconstants.h"
 #include "asmmacros.h"
 
-    ;;like TEXTAREA, but with 64 byte alignment so that we can align the patchable pool below to 64 without warning
-    AREA    |.text|,ALIGN=6,CODE,READONLY
+    ;;like TEXTAREA, but with 128 byte alignment so that we can align the patchable pool below to 128 without warning
+    AREA    |.text|,ALIGN=7,CODE,READONLY
 
 ;-----------------------------------------------------------------------------
 ; The following Macros help in WRITE_BARRIER Implementations
@@ -39,7 +39,7 @@
     LEAF_END
 
         ; Begin patchable literal pool
-        ALIGN 64  ; Align to power of two at least as big as patchable literal pool so that it fits optimally in cache line
+        ALIGN 128  ; Align to power of two at least as big as patchable literal pool so that it fits optimally in cache line
     WRITE_BARRIER_ENTRY JIT_WriteBarrier_Table
 wbs_begin
 wbs_card_table
@@ -56,6 +56,12 @@ wbs_lowest_address
         DCQ 0
 wbs_highest_address
         DCQ 0
+wbs_region_to_generation_table
+        DCQ 0
+wbs_region_shr
+        DCQ 0
+wbs_region_use_bitwise_write_barrier
+        DCQ 0
 #ifdef WRITE_BARRIER_CHECK
 wbs_GCShadow
         DCQ 0
@@ -74,7 +80,8 @@ wbs_GCShadowEnd
 ;   x13  : incremented by 8
 ;   x14  : incremented by 8
 ;   x15  : trashed
-;   x17  : trashed (ip1) if FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+;   x16  : trashed (ip0)
+;   x17  : trashed (ip1)
 ;
 ;   NOTE: Keep in sync with RBM_CALLEE_TRASH_WRITEBARRIER_BYREF and RBM_CALLEE_GCTRASH_WRITEBARRIER_BYREF
 ;         if you add more trashed registers.
@@ -97,7 +104,8 @@ wbs_GCShadowEnd
 ;   x12  : trashed
 ;   x14  : incremented by 8
 ;   x15  : trashed
-;   x17  : trashed (ip1) if FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+;   x16  : trashed (ip0)
+;   x17  : trashed (ip1)
 ;
     WRITE_BARRIER_ENTRY JIT_CheckedWriteBarrier
         ldr      x12,  wbs_lowest_address
@@ -121,7 +129,8 @@ NotInHeap
 ;   x12  : trashed
 ;   x14  : incremented by 8
 ;   x15  : trashed
-;   x17  : trashed (ip1) if FEATURE_USE_SOFTWARE_WRITE_WATCH_FOR_GC_HEAP
+;   x16  : trashed (ip0)
+;   x17  : trashed (ip1)
 ;
     WRITE_BARRIER_ENTRY JIT_WriteBarrier
         stlr     x15, [x14]
@@ -198,6 +207,49 @@ CheckCardTable
         bhs      Exit
 
 SkipEphemeralCheck
+        ; With regions, filter on the generations of the source and destination regions
+        ldr      x12, wbs_region_shr
+        cbz      x12, CheckCardTableByte
+        ldr      x17, wbs_region_to_generation_table
+
+        ; Check if the source is in gen 2 - then it's not an ephemeral pointer
+        lsr      x15, x15, x12
+        ldrb     w15, [x17, x15]
+        cmp      x15, #0x82
+        beq      Exit
+
+        ; Check if the destination happens to be in gen 0
+        lsr      x15, x14, x12
+        ldrb     w15, [x17, x15]
+        cbz      x15, Exit
+
+        ldr      x12, wbs_region_use_bitwise_write_barrier
+        cbz      x12, CheckCardTableByte
+
+        ; Compute the card table bit for the destination
+        ubfx     x12, x14, #8, #3
+        mov      w16, #1
+        lsl      w16, w16, w12
+
+        ; Check if this card table bit is already set
+        ldr      x12, wbs_card_table
+
+        ; x15 := pointer into card table
+        add      x15, x12, x14, lsr #11
+
+        ldrb     w12, [x15]
+        tst      w12, w16
+        bne      Exit
+
+        ; Other threads may be setting other bits in the same card byte
+SetCardTableBit
+        ldxrb    w12, [x15]
+        orr      w12, w12, w16
+        stxrb    w17, w12, [x15]
+        cbnz     w17, SetCardTableBit
+        b        CheckCardBundle
+
+CheckCardTableByte
         ; Check if we need to update the card table
         ldr      x12, wbs_card_table
 
@@ -212,6 +264,7 @@ UpdateCardTable
         mov      x12, 0xFF
         strb     w12, [x15]
 
+CheckCardBundle
 #ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
         ; Check if we need to update the card bundle table
         ldr      x12, wbs_card_bundle_table
@@ -36,6 +36,7 @@
 #include "../md/compiler/custattr.h"
 
 #include "peimagelayout.inl"
+#include "startupsummary.h"
 
 
 // Define these macro's to do strict validation for jit lock and class init entry leaks.
@@ -1443,9 +1444,13 @@ INT32 Assembly::ExecuteMainMethod(PTRARRAYREF *stringArgs, BOOL waitForOtherThre
             // Main thread wasn't started by the runtime.
             Thread::InitializationForManagedThreadInNative(pThread);
 
+            StartupSummary::PhaseStart(StartupSummary::Phase_StartupHooks);
             RunManagedStartup();
+            StartupSummary::PhaseEnd(StartupSummary::Phase_StartupHooks);
 
+            StartupSummary::PhaseStart(StartupSummary::Phase_Main);
             hr = RunMain(pMeth, 1, &iRetVal, stringArgs);
+            StartupSummary::PhaseEnd(StartupSummary::Phase_Main);
 
             Thread::CleanUpForManagedThreadInNative(pThread);
         }
@@ -28,7 +28,9 @@ CallCountingManager::CallCountingInfo::CallCountingInfo(NativeCodeVersion codeVe
     : m_codeVersion(codeVersion),
     m_callCountingStub(nullptr),
     m_remainingCallCount(0),
-    m_stage(Stage::Disabled)
+    m_stage(Stage::Disabled),
+    m_nextQueuedForCompletion(nullptr),
+    m_isQueuedForCompletion(0)
 {
     WRAPPER_NO_CONTRACT;
     _ASSERTE(!codeVersion.IsNull());
@@ -52,7 +54,9 @@ CallCountingManager::CallCountingInfo::CallCountingInfo(NativeCodeVersion codeVe
     : m_codeVersion(codeVersion),
     m_callCountingStub(nullptr),
     m_remainingCallCount(callCountThreshold),
-    m_stage(Stage::StubIsNotActive)
+    m_stage(Stage::StubIsNotActive),
+    m_nextQueuedForCompletion(nullptr),
+    m_isQueuedForCompletion(0)
 {
     WRAPPER_NO_CONTRACT;
     _ASSERTE(!codeVersion.IsNull());
@@ -178,6 +182,40 @@ FORCEINLINE void CallCountingManager::CallCountingInfo::SetStage(Stage stage)
 
     m_stage = stage;
 }
+
+bool CallCountingManager::CallCountingInfo::TryMarkQueuedForCompletion()
+{
+    WRAPPER_NO_CONTRACT;
+    _ASSERTE(m_stage != Stage::Disabled);
+
+    // The threshold may be reached again by another thread before the info is dequeued, only one of them may link it
+    return InterlockedCompareExchange(&m_isQueuedForCompletion, 1, 0) == 0;
+}
+
+CallCountingManager::CallCountingInfo *CallCountingManager::CallCountingInfo::GetNextQueuedForCompletion() const
+{
+    WRAPPER_NO_CONTRACT;
+    _ASSERTE(m_isQueuedForCompletion != 0);
+
+    return m_nextQueuedForCompletion;
+}
+
+void CallCountingManager::CallCountingInfo::SetNextQueuedForCompletion(CallCountingInfo *next)
+{
+    WRAPPER_NO_CONTRACT;
+    _ASSERTE(m_isQueuedForCompletion != 0);
+
+    m_nextQueuedForCompletion = next;
+}
+
+void CallCountingManager::CallCountingInfo::ClearQueuedForCompletion()
+{
+    WRAPPER_NO_CONTRACT;
+    _ASSERTE(m_isQueuedForCompletion != 0);
+
+    m_nextQueuedForCompletion = nullptr;
+    VolatileStore(&m_isQueuedForCompletion, (LONG)0);
+}
 #endif
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -433,8 +471,10 @@ CallCountingManager::PTR_CallCountingManagerHash CallCountingManager::s_callCoun
 COUNT_T CallCountingManager::s_callCountingStubCount = 0;
 COUNT_T CallCountingManager::s_activeCallCountingStubCount = 0;
 COUNT_T CallCountingManager::s_completedCallCountingStubCount = 0;
+ULONGLONG CallCountingManager::s_lastCallCountingStubDeletionTickCount = 0;
 
 CallCountingManager::CallCountingManager()
+    : m_callCountingInfosQueuedForCompletion(nullptr)
 {
     CONTRACTL
     {
@@ -770,10 +810,23 @@ PCODE CallCountingManager::OnCallCountThresholdReached(TransitionBlock *transiti
 
     // Get the code version from the call counting stub/info in cooperative GC mode to synchronize with deletion. The stub/info
     // may be deleted only when the runtime is suspended, so when we are in cooperative GC mode it is safe to read from them.
-    NativeCodeVersion codeVersion =
-        CallCountingInfo::From(CallCountingStub::From(stubIdentifyingToken)->GetRemainingCallCountCell())->GetCodeVersion();
+    CallCountingInfo *callCountingInfoForStub =
+        CallCountingInfo::From(CallCountingStub::From(stubIdentifyingToken)->GetRemainingCallCountCell());
+    NativeCodeVersion codeVersion = callCountingInfoForStub->GetCodeVersion();
 
     MethodDesc *methodDesc = codeVersion.GetMethodDesc();
+
+    // In batched completion mode, queue the info without taking the code versioning lock while it is still safe to use it.
+    // The stage is checked again under the lock when the background worker dequeues it. Only the thread that queues into an
+    // empty queue needs to request completion, the request covers everything queued until the background worker gets to it.
+    bool isBatchedCompletion = g_pConfig->TieredCompilation_CallCountingCompletionBatchMs() != 0;
+    bool requestBatchedCompletion = false;
+    if (isBatchedCompletion && callCountingInfoForStub->GetStage() < CallCountingInfo::Stage::PendingCompletion)
+    {
+        requestBatchedCompletion =
+            methodDesc->GetLoaderAllocator()->GetCallCountingManager()->QueueForCompletion(callCountingInfoForStub);
+    }
+
     FrameWithCookie<CallCountingHelperFrame> frameWithCookie(transitionBlock, methodDesc);
     CallCountingHelperFrame *frame = &frameWithCookie;
     frame->Push(CURRENT_THREAD);
@@ -790,6 +843,15 @@ PCODE CallCountingManager::OnCallCountThresholdReached(TransitionBlock *transiti
     codeEntryPoint = codeVersion.GetNativeCode();
     do
     {
+        if (isBatchedCompletion)
+        {
+            if (requestBatchedCompletion)
+            {
+                GetAppDomain()->GetTieredCompilationManager()->AsyncCompleteCallCounting();
+            }
+            break;
+        }
+
         {
             CallCountingManager *callCountingManager = methodDesc->GetLoaderAllocator()->GetCallCountingManager();
 
@@ -828,6 +890,71 @@ PCODE CallCountingManager::OnCallCountThresholdReached(TransitionBlock *transiti
     return codeEntryPoint;
 }
 
+bool CallCountingManager::QueueForCompletion(CallCountingInfo *callCountingInfo)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE; // synchronizes with deletion of the info, see OnCallCountThresholdReached
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(callCountingInfo != nullptr);
+
+    if (!callCountingInfo->TryMarkQueuedForCompletion())
+    {
+        return false;
+    }
+
+    // Infos are only ever dequeued all at once, so there is no ABA issue with pushing
+    CallCountingInfo *head;
+    do
+    {
+        head = m_callCountingInfosQueuedForCompletion;
+        callCountingInfo->SetNextQueuedForCompletion(head);
+    } while (InterlockedCompareExchangeT(&m_callCountingInfosQueuedForCompletion, callCountingInfo, head) != head);
+
+    return head == nullptr;
+}
+
+void CallCountingManager::MoveQueuedToPendingCompletion()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(CodeVersionManager::IsLockOwnedByCurrentThread());
+
+    CallCountingInfo *callCountingInfo =
+        InterlockedExchangeT(&m_callCountingInfosQueuedForCompletion, (CallCountingInfo *)nullptr);
+    while (callCountingInfo != nullptr)
+    {
+        CallCountingInfo *nextCallCountingInfo = callCountingInfo->GetNextQueuedForCompletion();
+        callCountingInfo->ClearQueuedForCompletion();
+
+        if (callCountingInfo->GetStage() < CallCountingInfo::Stage::PendingCompletion)
+        {
+            EX_TRY
+            {
+                m_callCountingInfosPendingCompletion.Append(callCountingInfo);
+                callCountingInfo->SetStage(CallCountingInfo::Stage::PendingCompletion);
+            }
+            EX_CATCH
+            {
+                // The info stays in its current stage, the stub will reach the threshold again after the call count wraps
+            }
+            EX_END_CATCH(RethrowTerminalExceptions);
+        }
+
+        callCountingInfo = nextCallCountingInfo;
+    }
+}
+
 COUNT_T CallCountingManager::GetCountOfCodeVersionsPendingCompletion()
 {
     CONTRACTL
@@ -873,6 +1000,8 @@ void CallCountingManager::CompleteCallCounting()
     for (auto itEnd = s_callCountingManagers->End(), it = s_callCountingManagers->Begin(); it != itEnd; ++it)
     {
         CallCountingManager *callCountingManager = *it;
+        callCountingManager->MoveQueuedToPendingCompletion();
+
         SArray<CallCountingInfo *> &callCountingInfosPendingCompletion =
             callCountingManager->m_callCountingInfosPendingCompletion;
         COUNT_T callCountingInfoCount = callCountingInfosPendingCompletion.GetCount();
@@ -987,6 +1116,18 @@ void CallCountingManager::StopAndDeleteAllCallCountingStubs()
         return;
     }
 
+    // In batched completion mode, also rate-limit the suspensions, stubs that complete in the meantime are deleted along with
+    // the others in the next batch
+    DWORD batchMs = g_pConfig->TieredCompilation_CallCountingCompletionBatchMs();
+    ULONGLONG tickCount = CLRGetTickCount64();
+    if (batchMs != 0 &&
+        s_lastCallCountingStubDeletionTickCount != 0 &&
+        tickCount - s_lastCallCountingStubDeletionTickCount < batchMs)
+    {
+        return;
+    }
+    s_lastCallCountingStubDeletionTickCount = tickCount;
+
     TieredCompilationManager *tieredCompilationManager = GetAppDomain()->GetTieredCompilationManager();
 
     ThreadSuspend::SuspendEE(ThreadSuspend::SUSPEND_OTHER);
@@ -1037,6 +1178,10 @@ void CallCountingManager::StopAllCallCounting(TieredCompilationManager *tieredCo
     {
         CallCountingManager *callCountingManager = *it;
 
+        // The runtime is suspended, so nothing can be queued concurrently. Queued infos become pending completion and are
+        // completed below along with the others.
+        callCountingManager->MoveQueuedToPendingCompletion();
+
         CallCountingInfoByCodeVersionHash &callCountingInfoByCodeVersionHash =
             callCountingManager->m_callCountingInfoByCodeVersionHash;
         for (auto itEnd = callCountingInfoByCodeVersionHash.End(), it = callCountingInfoByCodeVersionHash.Begin();
@@ -1128,6 +1273,7 @@ void CallCountingManager::DeleteAllCallCountingStubs()
     {
         CallCountingManager *callCountingManager = *it;
         _ASSERTE(callCountingManager->m_callCountingInfosPendingCompletion.IsEmpty());
+        _ASSERTE(callCountingManager->m_callCountingInfosQueuedForCompletion == nullptr);
 
         // Clear the call counting stub from call counting infos and delete completed infos
         MethodDescForwarderStubHash &methodDescForwarderStubHash = callCountingManager->m_methodDescForwarderStubHash;
@@ -29,10 +29,14 @@ When the call count threshold is reached (see CallCountingManager::OnCallCountTh
 - The helper call enqueues completion of call counting for background processing
 - When completing call counting in the background, the code version is enqueued for promotion, and the call counting stub is
   removed from the call chain
+- In batched completion mode (TC_CallCountingCompletionBatchMs), the helper call instead pushes the call counting info onto a
+  lock-free queue in cooperative GC mode. The background worker moves queued infos to the pending list under the code
+  versioning lock and completes them in batches at most once per batch interval.
 
 After all work queued for promotion is completed and methods transitioned to optimized tier, some cleanup follows
 (see CallCountingManager::StopAndDeleteAllCallCountingStubs):
-- Some heuristics are checked and if cleanup will be done, the runtime is suspended
+- Some heuristics are checked and if cleanup will be done, the runtime is suspended. In batched completion mode, cleanup is
+  also done at most once per batch interval.
 - All call counting stubs are deleted. For code versions that have not completed counting, the method's code entry point is
   reset such that call counting would be reestablished on the next call.
 - Completed call counting infos are deleted
@@ -200,6 +204,10 @@ private:
         CallCount m_remainingCallCount;
         Stage m_stage;
 
+        // Link and flag for the lock-free queue of infos that reached the call count threshold in batched completion mode
+        CallCountingInfo *m_nextQueuedForCompletion;
+        LONG m_isQueuedForCompletion;
+
     #ifndef DACCESS_COMPILE
     private:
         CallCountingInfo(NativeCodeVersion codeVersion);
@@ -226,6 +234,12 @@ private:
     #ifndef DACCESS_COMPILE
     public:
         void SetStage(Stage stage);
+
+    public:
+        bool TryMarkQueuedForCompletion();
+        CallCountingInfo *GetNextQueuedForCompletion() const;
+        void SetNextQueuedForCompletion(CallCountingInfo *next);
+        void ClearQueuedForCompletion();
     #endif
 
         ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -335,6 +349,7 @@ private:
     static COUNT_T s_callCountingStubCount;
     static COUNT_T s_activeCallCountingStubCount;
     static COUNT_T s_completedCallCountingStubCount;
+    static ULONGLONG s_lastCallCountingStubDeletionTickCount;
 
 private:
     CallCountingInfoByCodeVersionHash m_callCountingInfoByCodeVersionHash;
@@ -342,6 +357,11 @@ private:
     MethodDescForwarderStubHash m_methodDescForwarderStubHash;
     SArray<CallCountingInfo *> m_callCountingInfosPendingCompletion;
 
+    // In batched completion mode (see TC_CallCountingCompletionBatchMs), infos that reached the call count threshold are
+    // pushed here in cooperative GC mode without taking a lock, and are moved to m_callCountingInfosPendingCompletion by the
+    // background worker under the code versioning lock
+    CallCountingInfo *volatile m_callCountingInfosQueuedForCompletion;
+
 public:
     CallCountingManager();
     ~CallCountingManager();
@@ -367,6 +387,9 @@ public:
     static PCODE OnCallCountThresholdReached(TransitionBlock *transitionBlock, TADDR stubIdentifyingToken);
     static COUNT_T GetCountOfCodeVersionsPendingCompletion();
     static void CompleteCallCounting();
+private:
+    bool QueueForCompletion(CallCountingInfo *callCountingInfo);
+    void MoveQueuedToPendingCompletion();
 
 public:
     static void StopAndDeleteAllCallCountingStubs();
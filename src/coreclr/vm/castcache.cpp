@@ -12,6 +12,8 @@
 BASEARRAYREF* CastCache::s_pTableRef = NULL;
 OBJECTHANDLE CastCache::s_sentinelTable = NULL;
 DWORD CastCache::s_lastFlushSize     = INITIAL_CACHE_SIZE;
+CastCache::Sample CastCache::s_sample = {};
+bool CastCache::s_isContended        = false;
 const DWORD CastCache::INITIAL_CACHE_SIZE;
 
 BASEARRAYREF CastCache::CreateCastCache(DWORD size)
@@ -95,10 +97,56 @@ BOOL CastCache::MaybeReplaceCacheWithLarger(DWORD size)
         return FALSE;
     }
 
+    // growing past MAXIMUM_CACHE_SIZE once more has to be justified by another contended sample window
+    if (size > MAXIMUM_CACHE_SIZE)
+    {
+        s_isContended = false;
+    }
+
     SetObjectReference((OBJECTREF *)s_pTableRef, newTable);
     return TRUE;
 }
 
+void CastCache::UpdateSample(DWORD* tableData)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    s_sample.inserts++;
+
+    DWORD startTick = s_sample.startTick;
+    DWORD now = GetTickCount();
+    DWORD elapsed = now - startTick;
+    if (elapsed < SAMPLE_MS)
+        return;
+
+    // only one thread gets to close the sample window
+    if (InterlockedCompareExchangeT(&s_sample.startTick, now, startTick) != startTick)
+        return;
+
+    DWORD inserts = s_sample.inserts;
+    DWORD evictions = s_sample.evictions;
+    s_sample.inserts = 0;
+    s_sample.evictions = 0;
+
+    DWORD size = CacheElementCount(tableData);
+
+    // Normalize to a full window so that a long quiet period doesn't look like contention.
+    // Only a cache that already reached MAXIMUM_CACHE_SIZE evicts entries, smaller ones just grow.
+    UINT64 evictionsPerSample = (UINT64)evictions * SAMPLE_MS / elapsed;
+    s_isContended = (size >= MAXIMUM_CACHE_SIZE) && (evictionsPerSample >= size / CONTENDED_EVICTION_RATIO);
+
+    if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, CastCacheStats))
+    {
+        FireEtwCastCacheStats(GetClrInstanceId(), elapsed, inserts, evictions, size, CONTENDED_MAXIMUM_CACHE_SIZE);
+    }
+}
+
 void CastCache::FlushCurrentCache()
 {
     CONTRACTL
@@ -218,6 +266,8 @@ void CastCache::TrySet(TADDR source, TADDR target, BOOL result)
     DWORD bucket;
     DWORD* tableData;
 
+    UpdateSample(TableData(*s_pTableRef));
+
     do
     {
         tableData = TableData(*s_pTableRef);
@@ -334,6 +384,7 @@ void CastCache::TrySet(TADDR source, TADDR target, BOOL result)
         {
             pEntry->SetEntry(source, target, result);
             VolatileStore(&pEntry->version, newVersion + 1);
+            s_sample.evictions++;
         }
     }
 }
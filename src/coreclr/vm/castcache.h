@@ -176,6 +176,11 @@ private:
 // Considering that typically the cache size is small and that hit rates are high with good locality,
 // just keeping the cache around seems a simple and viable strategy.
 //
+// Some apps (e.g. heavy use of generic variance and interface casts) do have more hot pairs than that
+// though, and then keep evicting entries that are needed again shortly after. We sample the eviction rate,
+// and while it stays high we keep growing the cache past MAXIMUM_CACHE_SIZE, up to
+// CONTENDED_MAXIMUM_CACHE_SIZE. The rate is reported through the CastCacheStats event.
+//
 // Additional behaviors that could be considered, if there are scenarios that could be improved:
 //     - flush the cache based on some heuristics
 //     - shrink the cache based on some heuristics
@@ -183,11 +188,19 @@ private:
 #if DEBUG
     static const DWORD INITIAL_CACHE_SIZE = 8;    // MUST BE A POWER OF TWO
     static const DWORD MAXIMUM_CACHE_SIZE = 512;  // make this lower than release to make it easier to reach this in tests.
+    static const DWORD CONTENDED_MAXIMUM_CACHE_SIZE = 2048;
 #else
     static const DWORD INITIAL_CACHE_SIZE = 128;  // MUST BE A POWER OF TWO
     static const DWORD MAXIMUM_CACHE_SIZE = 4096; // 4096 * sizeof(CastCacheEntry) is 98304 bytes on 64bit. We will rarely need this much though.
+    static const DWORD CONTENDED_MAXIMUM_CACHE_SIZE = 65536; // 1.5MB on 64bit, only reached under sustained evictions.
 #endif
 
+// Length of a sample window for the eviction rate
+    static const DWORD SAMPLE_MS = 1000;
+
+// A cache that evicts more than its size / CONTENDED_EVICTION_RATIO entries per sample window is considered contended
+    static const DWORD CONTENDED_EVICTION_RATIO = 4;
+
 // Lower bucket size will cause the table to resize earlier
 // Higher bucket size will increase upper bound cost of Get
 //
@@ -206,6 +219,19 @@ private:
 
     static DWORD          s_lastFlushSize;
 
+    // Counts for the current sample window. Like the victim counter, these are not interlocked,
+    // we are ok if we lose counts here.
+    struct Sample
+    {
+        DWORD startTick;
+        DWORD inserts;
+        DWORD evictions;
+    };
+    static Sample         s_sample;
+
+    // set when the last sample window saw enough evictions to grow past MAXIMUM_CACHE_SIZE
+    static bool           s_isContended;
+
     FORCEINLINE static TypeHandle::CastResult TryGetFromCache(TADDR source, TADDR target)
     {
         CONTRACTL
@@ -251,7 +277,8 @@ private:
         CONTRACTL_END;
 
         DWORD newSize = CacheElementCount(tableData) * 2;
-        if (newSize <= MAXIMUM_CACHE_SIZE)
+        if (newSize <= MAXIMUM_CACHE_SIZE ||
+            (s_isContended && newSize <= CONTENDED_MAXIMUM_CACHE_SIZE))
         {
             return MaybeReplaceCacheWithLarger(newSize);
         }
@@ -320,6 +347,7 @@ private:
     static BOOL MaybeReplaceCacheWithLarger(DWORD size);
     static TypeHandle::CastResult TryGet(TADDR source, TADDR target);
     static void TrySet(TADDR source, TADDR target, BOOL result);
+    static void UpdateSample(DWORD* tableData);
 
 #else // !DACCESS_COMPILE
 public:
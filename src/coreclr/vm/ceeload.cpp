@@ -3570,6 +3570,108 @@ void Module::RunEagerFixupsUnlocked()
         RangeSection::RANGE_SECTION_NONE,
         this /* pHeapListOrZapModule */);
 }
+
+//-----------------------------------------------------------------------------
+// Resolves the lazy allocation and casting helper cells of the module ahead of their first use,
+// so that the startup path does not go through the delay load helper for each of them. Only the
+// kinds whose resolution has no side effects besides loading types are handled: static base and
+// class constructor cells would run class constructors early, and the remaining kinds depend on
+// the call site. Cells that fail to resolve are left to the delay load helper.
+void Module::PreResolveDynamicHelperCells()
+{
+    STANDARD_VM_CONTRACT;
+
+    if (!IsReadyToRun())
+        return;
+
+    COUNT_T nSections;
+    PTR_READYTORUN_IMPORT_SECTION pSections = GetImportSections(&nSections);
+    PEImageLayout *pNativeImage = GetReadyToRunImage();
+
+    TADDR imageBase = dac_cast<TADDR>(pNativeImage->GetBase());
+    TADDR imageEnd = imageBase + (TADDR)pNativeImage->GetVirtualSize();
+
+    for (COUNT_T iSection = 0; iSection < nSections; iSection++)
+    {
+        PTR_READYTORUN_IMPORT_SECTION pSection = pSections + iSection;
+
+        if (pSection->Type != ReadyToRunImportSectionType::Unknown ||
+            (pSection->Flags & ReadyToRunImportSectionFlags::Eager) == ReadyToRunImportSectionFlags::Eager ||
+            pSection->EntrySize != sizeof(TADDR) || pSection->Signatures == 0)
+            continue;
+
+        COUNT_T tableSize;
+        TADDR tableBase = pNativeImage->GetDirectoryData(&pSection->Section, &tableSize);
+
+        PTR_DWORD pSignatures = dac_cast<PTR_DWORD>(pNativeImage->GetRvaData(pSection->Signatures));
+
+        for (TADDR * pCell = (TADDR *)tableBase; pCell < (TADDR *)(tableBase + tableSize); pCell++)
+        {
+            // Unresolved cells point to the delay load thunks in the image
+            TADDR target = VolatileLoadWithoutBarrier(pCell);
+            if (target < imageBase || target >= imageEnd)
+                continue;
+
+            PCCOR_SIGNATURE pBlob = (BYTE *)pNativeImage->GetRvaData(pSignatures[pCell - (TADDR *)tableBase]);
+
+            BYTE kind = *pBlob++;
+
+            ModuleBase * pInfoModule = this;
+            if (kind & ENCODE_MODULE_OVERRIDE)
+            {
+                pInfoModule = GetModuleFromIndexIfLoaded(CorSigUncompressData(pBlob));
+                if (pInfoModule == NULL)
+                    continue;
+                kind &= ~ENCODE_MODULE_OVERRIDE;
+            }
+
+            if (kind != ENCODE_NEW_HELPER && kind != ENCODE_NEW_ARRAY_HELPER &&
+                kind != ENCODE_ISINSTANCEOF_HELPER && kind != ENCODE_CHKCAST_HELPER)
+                continue;
+
+            PCODE pHelper = (PCODE)NULL;
+
+            EX_TRY
+            {
+                TypeHandle th = ZapSig::DecodeType(this, pInfoModule, pBlob);
+
+                switch (kind)
+                {
+                case ENCODE_NEW_HELPER:
+                    {
+                        th.AsMethodTable()->EnsureInstanceActive();
+
+                        bool fHasSideEffectsUnused;
+                        CorInfoHelpFunc helpFunc = CEEInfo::getNewHelperStatic(th.AsMethodTable(), &fHasSideEffectsUnused);
+                        pHelper = DynamicHelpers::CreateHelper(GetLoaderAllocator(), th.AsTAddr(), CEEJitInfo::getHelperFtnStatic(helpFunc));
+                    }
+                    break;
+                case ENCODE_NEW_ARRAY_HELPER:
+                    {
+                        CorInfoHelpFunc helpFunc = CEEInfo::getNewArrHelperStatic(th);
+                        pHelper = DynamicHelpers::CreateHelperArgMove(GetLoaderAllocator(), dac_cast<TADDR>(th.AsMethodTable()), CEEJitInfo::getHelperFtnStatic(helpFunc));
+                    }
+                    break;
+                default:
+                    {
+                        CorInfoHelpFunc helpFunc = CEEInfo::getCastingHelperStatic(th, /* throwing */ (kind == ENCODE_CHKCAST_HELPER));
+                        pHelper = DynamicHelpers::CreateHelperArgMove(GetLoaderAllocator(), th.AsTAddr(), CEEJitInfo::getHelperFtnStatic(helpFunc));
+                    }
+                    break;
+                }
+            }
+            EX_CATCH
+            {
+                // The delay load helper reports the failure if the code ever gets there
+            }
+            EX_END_CATCH(SwallowAllExceptions);
+
+            // Racing with the delay load helper is benign, both store an equivalent helper
+            if (pHelper != (PCODE)NULL)
+                VolatileStoreWithoutBarrier(pCell, (TADDR)pHelper);
+        }
+    }
+}
 #endif // !DACCESS_COMPILE
 
 #ifndef DACCESS_COMPILE
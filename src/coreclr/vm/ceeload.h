@@ -1421,6 +1421,7 @@ public:
                            PEDecoder * pNativeImage, BOOL mayUsePrecompiledNDirectMethods = TRUE);
     void RunEagerFixups();
     void RunEagerFixupsUnlocked();
+    void PreResolveDynamicHelperCells();
 
     ModuleBase *GetModuleFromIndex(DWORD ix);
     ModuleBase *GetModuleFromIndexIfLoaded(DWORD ix);
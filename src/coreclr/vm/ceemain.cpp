@@ -211,6 +211,7 @@
 #endif // FEATURE_GDBJIT
 
 #include "genanalysis.h"
+#include "startupsummary.h"
 
 static int GetThreadUICultureId(_Out_ LocaleIDValue* pLocale);  // TODO: This shouldn't use the LCID.  We should rely on name instead
 
@@ -677,6 +678,15 @@ void EEStartupHelper()
 #ifdef STRESS_LOG
         if (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_StressLog, g_pConfig->StressLog()) != 0) {
             unsigned facilities = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_LogFacility, LF_ALL);
+            CLRConfigStringHolder facilityNames = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_StressLogFacilities);
+            if (facilityNames != NULL)
+            {
+                unsigned namedFacilities = StressLog::ParseFacilityNames(facilityNames);
+                if (namedFacilities != 0)
+                {
+                    facilities = namedFacilities;
+                }
+            }
             unsigned level = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_LogLevel, LL_INFO1000);
             unsigned bytesPerThread = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_StressLogSize, STRESSLOG_CHUNK_SIZE * 4);
             unsigned totalBytes = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TotalStressLogSize, STRESSLOG_CHUNK_SIZE * 1024);
@@ -1053,6 +1063,8 @@ HRESULT EEStartup()
 
     _ASSERTE(!g_fEEStarted && !g_fEEInit && SUCCEEDED (g_EEStartupStatus));
 
+    StartupSummary::PhaseStart(StartupSummary::Phase_EEStartup);
+
     PAL_TRY(PVOID, p, NULL)
     {
         InitializeClrNotifications();
@@ -1070,6 +1082,8 @@ HRESULT EEStartup()
     }
     PAL_ENDTRY
 
+    StartupSummary::PhaseEnd(StartupSummary::Phase_EEStartup);
+
     return g_EEStartupStatus;
 }
 
@@ -1251,6 +1265,15 @@ void STDMETHODCALLTYPE EEShutDownHelper(BOOL fIsDllUnloading)
         PerfMap::Disable();
 #endif
 
+        if (ExecutableAllocator::IsWXORXEnabled())
+        {
+            UINT64 rwMapCount, rwUnmapCount;
+            ExecutableAllocator::Instance()->GetRWMappingCounts(&rwMapCount, &rwUnmapCount);
+            STRESS_LOG2(LF_STUBS, LL_INFO10, "W^X: %llu RW mappings created, %llu released\n", rwMapCount, rwUnmapCount);
+        }
+
+        StartupSummary::Write();
+
         ceeInf.JitProcessShutdownWork();  // Do anything JIT-related that needs to happen at shutdown.
 
 #ifdef FEATURE_INTERPRETER
@@ -1608,6 +1631,8 @@ void InitializeGarbageCollector()
         ThrowHR(hr);
     }
 
+    PretenuringTracker::Init();
+
     // Apparently the Windows linker removes global variables if they are never
     // read from, which is a problem for g_gcDacGlobals since it's expected that
     // only the DAC will read from it. This forces the linker to include
@@ -741,6 +741,46 @@ void DECLSPEC_NORETURN ClassLoader::ThrowTypeLoadException(const TypeKey *pKey,
     ::ThrowTypeLoadException(fullName, assemblyName, NULL, resIDWhy);
 }
 
+namespace
+{
+    // Startup of generic heavy code keeps asking for the same handful of instantiations, so each
+    // thread remembers the last fully loaded ones it got back. This skips computing the loader
+    // module and walking its hash table. Only types that can never be unloaded are cached.
+    struct ConstructedTypeCacheEntry
+    {
+        DWORD dwHash;
+        TypeHandle typeHnd;
+    };
+
+    const DWORD CONSTRUCTED_TYPE_CACHE_SIZE = 64; // must be a power of 2
+
+    thread_local ConstructedTypeCacheEntry t_constructedTypeCache[CONSTRUCTED_TYPE_CACHE_SIZE];
+
+    TypeHandle LookupConstructedTypeCache(const TypeKey *pKey, DWORD dwHash)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        ConstructedTypeCacheEntry *pEntry = &t_constructedTypeCache[dwHash & (CONSTRUCTED_TYPE_CACHE_SIZE - 1)];
+        if (pEntry->dwHash != dwHash || pEntry->typeHnd.IsNull())
+            return TypeHandle();
+
+        TypeKey cachedKey = pEntry->typeHnd.GetTypeKey();
+        return TypeKey::Equals(pKey, &cachedKey) ? pEntry->typeHnd : TypeHandle();
+    }
+
+    void AddToConstructedTypeCache(DWORD dwHash, TypeHandle typeHnd)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        if (!typeHnd.IsFullyLoaded() || typeHnd.GetLoaderAllocator()->IsCollectible())
+            return;
+
+        ConstructedTypeCacheEntry *pEntry = &t_constructedTypeCache[dwHash & (CONSTRUCTED_TYPE_CACHE_SIZE - 1)];
+        pEntry->dwHash = dwHash;
+        pEntry->typeHnd = typeHnd;
+    }
+}
+
 #endif
 
 TypeHandle ClassLoader::LoadConstructedTypeThrowing(const TypeKey *pKey,
@@ -764,12 +804,28 @@ TypeHandle ClassLoader::LoadConstructedTypeThrowing(const TypeKey *pKey,
     }
     CONTRACT_END
 
+#ifndef DACCESS_COMPILE
+    DWORD dwCacheHash = 0;
+    if (pKey->IsConstructed())
+    {
+        // Everything in the cache is fully loaded so it satisfies any level
+        dwCacheHash = HashTypeKey(pKey);
+        TypeHandle thCached = LookupConstructedTypeCache(pKey, dwCacheHash);
+        if (!thCached.IsNull())
+            RETURN thCached;
+    }
+#endif
+
     // Lookup in the classes that this class loader knows about
     TypeHandle typeHnd = LookupTypeHandleForTypeKey(pKey);
     if (!typeHnd.IsNull())
     {
         if (typeHnd.GetLoadLevel() >= level)
         {
+#ifndef DACCESS_COMPILE
+            if (pKey->IsConstructed())
+                AddToConstructedTypeCache(dwCacheHash, typeHnd);
+#endif
             // If something has been published in the tables, and it's at the right level, just return it
             RETURN typeHnd;
         }
@@ -2622,7 +2678,18 @@ TypeHandle ClassLoader::DoIncrementalLoad(const TypeKey *pTypeKey, TypeHandle ty
                 CONSISTENCY_CHECK(!typeHnd.IsNull());
                 TypeHandle published = PublishType(pTypeKey, typeHnd);
                 if (published == typeHnd)
+                {
                     amTracker.SuppressRelease();
+
+#ifdef FEATURE_MULTICOREJIT
+                    // Record the new instantiation so that multi-core JIT playback can load it eagerly on the next start
+                    MulticoreJitManager & mcJitManager = GetAppDomain()->GetMulticoreJitManager();
+                    if (mcJitManager.IsGenericTypeRecorderActive() && MulticoreJitManager::IsGenericTypeSupported(typeHnd))
+                    {
+                        mcJitManager.RecordGenericTypeLoad(typeHnd);
+                    }
+#endif
+                }
                 typeHnd = published;
             }
             break;
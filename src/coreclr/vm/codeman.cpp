@@ -1512,6 +1512,13 @@ void EEJitManager::SetCpuInfo()
     if (((cpuFeatures & ARM64IntrinsicConstants_Sve) != 0) && CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_EnableArm64Sve))
     {
         uint32_t maxVectorTLength = (maxVectorTBitWidth / 8);
+
+#ifdef TARGET_LINUX
+        // With Arm64ClampSveVectorLength, all the threads running managed code are limited to 128-bit
+        // vectors. This runs during startup before the thread is set up, so clamp it here too.
+        ClampSveVectorLength();
+#endif // TARGET_LINUX
+
         uint64_t sveLengthFromOS = GetSveLengthFromOS();
 
         // For now, enable SVE only when the system vector length is 16 bytes (128-bits)
@@ -2439,6 +2446,7 @@ HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap
 
     pHp->mapBase         = ROUND_DOWN_TO_PAGE(pHp->startAddress);  // round down to next lower page align
     pHp->pHdrMap         = (DWORD*)(void*)pJitMetaHeap->AllocMem(S_SIZE_T(nibbleMapSize));
+    pHp->pHdrPageMap     = (DWORD*)(void*)pJitMetaHeap->AllocMem(S_SIZE_T(pHp->GetPageMapCount()) * S_SIZE_T(sizeof(DWORD)));
 
     pHp->pLoaderAllocator = pInfo->m_pAllocator;
 
@@ -3173,7 +3181,7 @@ JumpStubBlockHeader *  EEJitManager::allocJumpStubBlock(MethodDesc* pMD, DWORD n
         ExecutableWriterHolder<CodeHeader> codeHdrWriterHolder(pCodeHdr, sizeof(CodeHeader));
         codeHdrWriterHolder.GetRW()->SetStubCodeBlockKind(STUB_CODE_BLOCK_JUMPSTUB);
 
-        NibbleMapSetUnlocked(pCodeHeap, mem, TRUE);
+        NibbleMapSetUnlocked(pCodeHeap, mem, TRUE, blockSize);
 
         blockWriterHolder.AssignExecutableWriterHolder((JumpStubBlockHeader *)mem, sizeof(JumpStubBlockHeader));
 
@@ -3225,7 +3233,7 @@ void * EEJitManager::allocCodeFragmentBlock(size_t blockSize, unsigned alignment
         ExecutableWriterHolder<CodeHeader> codeHdrWriterHolder(pCodeHdr, sizeof(CodeHeader));
         codeHdrWriterHolder.GetRW()->SetStubCodeBlockKind(kind);
 
-        NibbleMapSetUnlocked(pCodeHeap, mem, TRUE);
+        NibbleMapSetUnlocked(pCodeHeap, mem, TRUE, blockSize);
 
         // Record the jump stub reservation
         pCodeHeap->reserveForJumpStubs += requestInfo.getReserveForJumpStubs();
@@ -3282,6 +3290,54 @@ PTR_EXCEPTION_CLAUSE_TOKEN EEJitManager::GetNextEHClause(EH_CLAUSE_ENUMERATOR* p
 }
 
 #ifndef DACCESS_COMPILE
+namespace
+{
+    // Hot throw sites run into the same typed EH clauses over and over, so each thread
+    // remembers its last few catch type resolutions instead of going through the token
+    // lookup in the module on every throw.
+    struct EHClauseTypeCacheEntry
+    {
+        MethodDesc* pMD;
+        mdToken typeTok;
+        TypeHandle typeHnd;
+    };
+
+    const size_t EH_CLAUSE_TYPE_CACHE_SIZE = 32; // must be a power of 2
+
+    thread_local EHClauseTypeCacheEntry t_ehClauseTypeCache[EH_CLAUSE_TYPE_CACHE_SIZE];
+
+    TypeHandle ResolveEHClauseToken(MethodDesc* pMD, mdToken typeTok)
+    {
+        STATIC_CONTRACT_THROWS;
+        STATIC_CONTRACT_GC_TRIGGERS;
+
+        EHClauseTypeCacheEntry* pEntry =
+            &t_ehClauseTypeCache[(((size_t)pMD >> 3) ^ typeTok) & (EH_CLAUSE_TYPE_CACHE_SIZE - 1)];
+
+        if (pEntry->pMD == pMD && pEntry->typeTok == typeTok)
+        {
+            return pEntry->typeHnd;
+        }
+
+        Module* pModule = pMD->GetModule();
+        PREFIX_ASSUME(pModule != NULL);
+
+        SigTypeContext typeContext(pMD);
+        TypeHandle typeHnd = ClassLoader::LoadTypeDefOrRefOrSpecThrowing(pModule, typeTok, &typeContext,
+                                                                         ClassLoader::ReturnNullIfNotFound);
+
+        // Dynamic and collectible methods can go away and have their MethodDesc reused
+        if (!typeHnd.IsNull() && !pMD->IsDynamicMethod() && !pMD->GetLoaderAllocator()->IsCollectible())
+        {
+            pEntry->pMD = pMD;
+            pEntry->typeTok = typeTok;
+            pEntry->typeHnd = typeHnd;
+        }
+
+        return typeHnd;
+    }
+}
+
 TypeHandle EEJitManager::ResolveEHClause(EE_ILEXCEPTION_CLAUSE* pEHClause,
                                          CrawlFrame *pCf)
 {
@@ -3309,13 +3365,7 @@ TypeHandle EEJitManager::ResolveEHClause(EE_ILEXCEPTION_CLAUSE* pEHClause,
         typeTok = pEHClause->ClassToken;
     }
 
-    MethodDesc* pMD = pCf->GetFunction();
-    Module* pModule = pMD->GetModule();
-    PREFIX_ASSUME(pModule != NULL);
-
-    SigTypeContext typeContext(pMD);
-    return ClassLoader::LoadTypeDefOrRefOrSpecThrowing(pModule, typeTok, &typeContext,
-                                                       ClassLoader::ReturnNullIfNotFound);
+    return ResolveEHClauseToken(pCf->GetFunction(), typeTok);
 }
 
 void EEJitManager::RemoveJitData (CodeHeader * pCHdr, size_t GCinfo_len, size_t EHinfo_len)
@@ -3472,6 +3522,42 @@ void EEJitManager::Unload(LoaderAllocator *pAllocator)
     ExecutableAllocator::ResetLazyPreferredRangeHint();
 }
 
+// Reports how much of the code heaps is in use and how fragmented the executable memory is after
+// the code of a collectible LoaderAllocator has been unloaded
+void EEJitManager::FireCodeHeapStatsEvent()
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+    } CONTRACTL_END;
+
+    if (!ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, CodeHeapStats))
+    {
+        return;
+    }
+
+    UINT32 codeHeapCount = 0;
+    UINT64 codeHeapReservedBytes = 0;
+    UINT64 codeHeapUsedBytes = 0;
+    {
+        CrstHolder ch(&m_CodeHeapCritSec);
+
+        for (HeapList *pHp = GetCodeHeapList(); pHp != NULL; pHp = pHp->GetNext())
+        {
+            codeHeapCount++;
+            codeHeapReservedBytes += pHp->maxCodeHeapSize;
+            codeHeapUsedBytes += pHp->endAddress - pHp->startAddress;
+        }
+    }
+
+    size_t sharedMemoryUsedBytes, sharedMemoryFreeBytes, sharedMemoryFreeBlocks, sharedMemoryLargestFreeBlock;
+    ExecutableAllocator::Instance()->GetSharedMemoryStatistics(&sharedMemoryUsedBytes, &sharedMemoryFreeBytes,
+                                                               &sharedMemoryFreeBlocks, &sharedMemoryLargestFreeBlock);
+
+    FireEtwCodeHeapStats(GetClrInstanceId(), codeHeapCount, codeHeapReservedBytes, codeHeapUsedBytes,
+                         sharedMemoryUsedBytes, sharedMemoryFreeBytes, (UINT32)sharedMemoryFreeBlocks, sharedMemoryLargestFreeBlock);
+}
+
 EEJitManager::DomainCodeHeapList::DomainCodeHeapList()
 {
     LIMITED_METHOD_CONTRACT;
@@ -4012,9 +4098,28 @@ TADDR EEJitManager::FindMethodCode(RangeSection * pRangeSection, PCODE currentPC
 
     startPos = ((startPos >> LOG2_NIBBLES_PER_DWORD) << LOG2_NIBBLES_PER_DWORD) - 1;
 
-    // Skip "headerless" DWORDS
+    // Skip "headerless" DWORDS up to the start of the page
+
+    PTR_DWORD pMapPageStart = pMapStart + (ADDR2PAGEMAPINDEX(delta) * DWORDS_PER_PAGEMAP_ENTRY);
+
+    while (pMapPageStart < pMap && 0 == (tmp = VolatileLoadWithoutBarrier<DWORD>(--pMap)))
+    {
+        startPos -= NIBBLES_PER_DWORD;
+    }
+
+    if (tmp == 0 && pHp->pHdrPageMap != NULL)
+    {
+        // No code block starts between the start of the page and currentPC, so the one covering
+        // the start of the page covers currentPC too. The page map may not know it (e.g. for code
+        // blocks published before it was populated), in which case keep scanning the nibble map.
+        DWORD pageStart = VolatileLoadWithoutBarrier<DWORD>(pHp->pHdrPageMap + ADDR2PAGEMAPINDEX(delta));
+        if (pageStart != 0)
+        {
+            return base + pageStart;
+        }
+    }
 
-    while (pMapStart < pMap && 0 == (tmp = VolatileLoadWithoutBarrier<DWORD>(--pMap)))
+    while (tmp == 0 && pMapStart < pMap && 0 == (tmp = VolatileLoadWithoutBarrier<DWORD>(--pMap)))
     {
         startPos -= NIBBLES_PER_DWORD;
     }
@@ -4040,7 +4145,7 @@ TADDR EEJitManager::FindMethodCode(RangeSection * pRangeSection, PCODE currentPC
 
 #if !defined(DACCESS_COMPILE)
 
-void EEJitManager::NibbleMapSet(HeapList * pHp, TADDR pCode, BOOL bSet)
+void EEJitManager::NibbleMapSet(HeapList * pHp, TADDR pCode, BOOL bSet, size_t codeSize)
 {
     CONTRACTL {
         NOTHROW;
@@ -4048,10 +4153,13 @@ void EEJitManager::NibbleMapSet(HeapList * pHp, TADDR pCode, BOOL bSet)
     } CONTRACTL_END;
 
     CrstHolder ch(&m_CodeHeapCritSec);
-    NibbleMapSetUnlocked(pHp, pCode, bSet);
+    NibbleMapSetUnlocked(pHp, pCode, bSet, codeSize);
 }
 
-void EEJitManager::NibbleMapSetUnlocked(HeapList * pHp, TADDR pCode, BOOL bSet)
+// codeSize is the number of bytes known to belong to the code block starting at pCode. It is
+// used to populate the page map when setting, and may be zero (or an underestimate), which just
+// makes FindMethodCode fall back to scanning the nibble map for the pages it does not cover.
+void EEJitManager::NibbleMapSetUnlocked(HeapList * pHp, TADDR pCode, BOOL bSet, size_t codeSize)
 {
     CONTRACTL {
         NOTHROW;
@@ -4080,8 +4188,53 @@ void EEJitManager::NibbleMapSetUnlocked(HeapList * pHp, TADDR pCode, BOOL bSet)
     // (it's a reset or it is empty)
     _ASSERTE(!value || !((*(pMap+index))& ~mask));
 
+    // The page map entries are populated before the code block gets published in the nibble map
+    // and cleared after it got removed from it.
+    if (bSet)
+    {
+        PageMapSetUnlocked(pHp, delta, codeSize);
+    }
+
     // It is important for this update to be atomic. Synchronization would be required with FindMethodCode otherwise.
     *(pMap+index) = ((*(pMap+index))&mask)|value;
+
+    if (!bSet)
+    {
+        PageMapClearUnlocked(pHp, delta);
+    }
+}
+
+void EEJitManager::PageMapSetUnlocked(HeapList * pHp, size_t delta, size_t codeSize)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (pHp->pHdrPageMap == NULL || codeSize == 0)
+        return;
+
+    // Only the pages starting within [delta, delta + codeSize) are covered by this code block
+    size_t index = ADDR2PAGEMAPINDEX(delta + BYTES_PER_PAGEMAP_ENTRY - 1);
+    size_t end   = min(ADDR2PAGEMAPINDEX(delta + codeSize - 1) + 1, pHp->GetPageMapCount());
+
+    for (; index < end; index++)
+    {
+        VolatileStoreWithoutBarrier<DWORD>(pHp->pHdrPageMap + index, (DWORD)delta);
+    }
+}
+
+void EEJitManager::PageMapClearUnlocked(HeapList * pHp, size_t delta)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (pHp->pHdrPageMap == NULL)
+        return;
+
+    size_t index = ADDR2PAGEMAPINDEX(delta + BYTES_PER_PAGEMAP_ENTRY - 1);
+    size_t count = pHp->GetPageMapCount();
+
+    for (; index < count && pHp->pHdrPageMap[index] == (DWORD)delta; index++)
+    {
+        VolatileStoreWithoutBarrier<DWORD>(pHp->pHdrPageMap + index, 0);
+    }
 }
 #endif // !DACCESS_COMPILE
 
@@ -4335,6 +4488,11 @@ void EEJitManager::EnumMemoryRegions(CLRDataEnumMemoryFlags flags)
                 HEAP2MAPSIZE(ROUND_UP_TO_PAGE(heap->maxCodeHeapSize));
             DacEnumMemoryRegion(dac_cast<TADDR>(heap->pHdrMap), nibbleMapSize);
         }
+
+        if (heap->pHdrPageMap.IsValid())
+        {
+            DacEnumMemoryRegion(dac_cast<TADDR>(heap->pHdrPageMap), (ULONG32)(heap->GetPageMapCount() * sizeof(DWORD)));
+        }
     }
 }
 #endif // #ifdef DACCESS_COMPILE
@@ -4865,6 +5023,7 @@ void ExecutionManager::Unload(LoaderAllocator *pLoaderAllocator)
     }
 
     GetEEJitManager()->Unload(pLoaderAllocator);
+    GetEEJitManager()->FireCodeHeapStatsEvent();
 }
 
 // This method is used by the JIT and the runtime for PreStubs. It will return
@@ -5664,13 +5823,7 @@ TypeHandle ReadyToRunJitManager::ResolveEHClause(EE_ILEXCEPTION_CLAUSE* pEHClaus
 
     _ASSERTE(pMD != NULL);
 
-    Module* pModule = pMD->GetModule();
-    PREFIX_ASSUME(pModule != NULL);
-
-    SigTypeContext typeContext(pMD);
-    mdToken typeTok = pEHClause->ClassToken;
-    return ClassLoader::LoadTypeDefOrRefOrSpecThrowing(pModule, typeTok, &typeContext,
-                                                          ClassLoader::ReturnNullIfNotFound);
+    return ResolveEHClauseToken(pMD, pEHClause->ClassToken);
 }
 
 #endif // #ifndef DACCESS_COMPILE
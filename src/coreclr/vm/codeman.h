@@ -366,6 +366,16 @@ protected:
 // The number of code heaps at which we increase the size of new code heaps.
 #define CODE_HEAP_SIZE_INCREASE_THRESHOLD 5
 
+// In addition to the nibble map, every code heap has a page map with one DWORD per
+// BYTES_PER_PAGEMAP_ENTRY bytes of the heap. An entry holds the mapBase-relative offset of the
+// start of the code block that covers the first byte of that page, or zero if there is no such
+// block (or it is not known). It lets FindMethodCode stop scanning the nibble map backwards at
+// the page boundary instead of walking over the whole body of a large method.
+#define BYTES_PER_PAGEMAP_ENTRY         4096
+#define LOG2_BYTES_PER_PAGEMAP_ENTRY    12
+#define ADDR2PAGEMAPINDEX(x)            ((x) >> LOG2_BYTES_PER_PAGEMAP_ENTRY)
+#define DWORDS_PER_PAGEMAP_ENTRY        (BYTES_PER_PAGEMAP_ENTRY / (BYTES_PER_BUCKET * NIBBLES_PER_DWORD))
+
 typedef DPTR(struct HeapList) PTR_HeapList;
 
 struct HeapList
@@ -388,6 +398,16 @@ struct HeapList
     BYTE*               CLRPersonalityRoutine;  // jump thunk to personality routine
 #endif
 
+    // Kept last so that the layout mirrored by FakeHeapList in fntableaccess.h is not affected
+    PTR_DWORD           pHdrPageMap;    // start of the code block covering each page, relative to mapBase
+
+    // Number of entries in pHdrPageMap
+    size_t GetPageMapCount()
+    {
+        LIMITED_METHOD_DAC_CONTRACT;
+        return ADDR2PAGEMAPINDEX(startAddress + maxCodeHeapSize - mapBase - 1) + 1;
+    }
+
     TADDR GetModuleBase()
     {
 #if defined(TARGET_AMD64) || defined(TARGET_ARM64) || defined(TARGET_LOONGARCH64) || defined(TARGET_RISCV64)
@@ -1820,8 +1840,10 @@ public:
 
 #ifndef DACCESS_COMPILE
 	// Heap Management functions
-    void NibbleMapSet(HeapList * pHp, TADDR pCode, BOOL bSet);
-    void NibbleMapSetUnlocked(HeapList * pHp, TADDR pCode, BOOL bSet);
+    void NibbleMapSet(HeapList * pHp, TADDR pCode, BOOL bSet, size_t codeSize = 0);
+    void NibbleMapSetUnlocked(HeapList * pHp, TADDR pCode, BOOL bSet, size_t codeSize = 0);
+    void PageMapSetUnlocked(HeapList * pHp, size_t delta, size_t codeSize);
+    void PageMapClearUnlocked(HeapList * pHp, size_t delta);
 #endif  // !DACCESS_COMPILE
 
     static TADDR FindMethodCode(RangeSection * pRangeSection, PCODE currentPC);
@@ -1833,6 +1855,7 @@ public:
     void        AddToCleanupList(HostCodeHeap *pCodeHeap);
     void        DeleteCodeHeap(HeapList *pHeapList);
     void        RemoveCodeHeapFromDomainList(CodeHeap *pHeap, LoaderAllocator *pAllocator);
+    void        FireCodeHeapStatsEvent();
 #endif // !DACCESS_COMPILE
 
 private :
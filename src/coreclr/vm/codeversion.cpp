@@ -1576,16 +1576,30 @@ HRESULT CodeVersionManager::SetActiveILCodeVersions(ILCodeVersion* pActiveVersio
     // MethodDescs that will need to be updated
     CDynArray<CDynArray<MethodDesc*>> methodDescsToUpdate;
     CDynArray<CodePublishError> errorRecords;
+
+    // Also parallel to activeVersions, the generic methods whose instantiations are found
+    // together after this loop, NULL for the others
+    CDynArray<MethodDesc*> genericMethodDescs;
+    DWORD cGenericMethodDescs = 0;
     for (DWORD i = 0; i < cActiveVersions; i++)
     {
         CDynArray<MethodDesc*>* pMethodDescs = methodDescsToUpdate.Append();
-        if (pMethodDescs == NULL)
+        MethodDesc** ppGenericMethodDesc = genericMethodDescs.Append();
+        if (pMethodDescs == NULL || ppGenericMethodDesc == NULL)
         {
             return E_OUTOFMEMORY;
         }
         *pMethodDescs = CDynArray<MethodDesc*>();
+        *ppGenericMethodDesc = NULL;
 
         MethodDesc* pLoadedMethodDesc = pActiveVersions[i].GetModule()->LookupMethodDef(pActiveVersions[i].GetMethodDef());
+        if (cActiveVersions > 1 && pLoadedMethodDesc != NULL && pLoadedMethodDesc->HasClassOrMethodInstantiation())
+        {
+            *ppGenericMethodDesc = pLoadedMethodDesc;
+            cGenericMethodDescs++;
+            continue;
+        }
+
         if (FAILED(hr = CodeVersionManager::EnumerateClosedMethodDescs(pLoadedMethodDesc, pMethodDescs, &errorRecords)))
         {
             _ASSERTE(hr == E_OUTOFMEMORY);
@@ -1593,6 +1607,19 @@ HRESULT CodeVersionManager::SetActiveILCodeVersions(ILCodeVersion* pActiveVersio
         }
     }
 
+    if (cGenericMethodDescs > 0)
+    {
+        if (FAILED(hr = CodeVersionManager::EnumerateGenericClosedMethodDescs(
+                genericMethodDescs.Ptr(),
+                cActiveVersions,
+                methodDescsToUpdate.Ptr(),
+                &errorRecords)))
+        {
+            _ASSERTE(hr == E_OUTOFMEMORY);
+            return hr;
+        }
+    }
+
     // step 3 - update each pre-existing method instantiation
     {
         LockHolder codeVersioningLockHolder;
@@ -2066,31 +2093,193 @@ HRESULT CodeVersionManager::EnumerateDomainClosedMethodDescs(
     CollectibleAssemblyHolder<DomainAssembly *> pDomainAssembly;
     while (it.Next(pDomainAssembly.This()))
     {
-        MethodDesc * pLoadedMD = it.Current();
+        if (FAILED(hr = AddClosedMethodDesc(pModuleContainingMethodDef, methodDef, it.Current(), pClosedMethodDescs, pUnsupportedMethodErrors)))
+        {
+            return hr;
+        }
+    }
+    return S_OK;
+}
+
+namespace
+{
+    // Maps the (module, token) of a generic type or method to the index of a method in
+    // the batch passed to EnumerateGenericClosedMethodDescs.  A generic type maps to
+    // each of its methods in the batch.
+    struct GenericMethodBatchEntry
+    {
+        ILCodeVersioningState::Key m_key;
+        DWORD m_index;
+    };
+
+    class GenericMethodBatchTraits : public DefaultSHashTraits<GenericMethodBatchEntry>
+    {
+    public:
+        typedef ILCodeVersioningState::Key key_t;
+
+        static key_t GetKey(const element_t &e) { LIMITED_METHOD_CONTRACT; return e.m_key; }
+        static BOOL Equals(const key_t &k1, const key_t &k2) { LIMITED_METHOD_CONTRACT; return k1 == k2; }
+        static count_t Hash(const key_t &k) { LIMITED_METHOD_CONTRACT; return (count_t)k.Hash(); }
+        static const element_t Null() { LIMITED_METHOD_CONTRACT; GenericMethodBatchEntry e; e.m_index = (DWORD)-1; return e; }
+        static bool IsNull(const element_t &e) { LIMITED_METHOD_CONTRACT; return e.m_index == (DWORD)-1; }
+    };
+
+    typedef SHash<GenericMethodBatchTraits> GenericMethodBatchMap;
+}
+
+// Does what EnumerateClosedMethodDescs does for each non-NULL entry of ppMethodDescs, but
+// walks the loaded generic types and instantiated methods of every assembly once for the
+// whole batch instead of once per method.  pClosedMethodDescs is parallel to ppMethodDescs.
+//
+// static
+HRESULT CodeVersionManager::EnumerateGenericClosedMethodDescs(
+    MethodDesc** ppMethodDescs,
+    DWORD cMethodDescs,
+    CDynArray<MethodDesc*> * pClosedMethodDescs,
+    CDynArray<CodePublishError> * pUnsupportedMethodErrors)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+        CAN_TAKE_LOCK;
+        PRECONDITION(CheckPointer(ppMethodDescs));
+        PRECONDITION(CheckPointer(pClosedMethodDescs));
+        PRECONDITION(CheckPointer(pUnsupportedMethodErrors));
+    }
+    CONTRACTL_END;
+
+    HRESULT hr;
+
+    // Methods with a method instantiation are found in the instantiated method tables,
+    // the others through the instantiations of their generic type
+    GenericMethodBatchMap methodMap;
+    GenericMethodBatchMap typeMap;
+    for (DWORD i = 0; i < cMethodDescs; i++)
+    {
+        MethodDesc* pMD = ppMethodDescs[i];
+        if (pMD == NULL)
+            continue;
+
+        _ASSERTE(pMD->HasClassOrMethodInstantiation());
+
+        GenericMethodBatchEntry entry;
+        entry.m_index = i;
+        if (pMD->HasMethodInstantiation())
+        {
+            entry.m_key = ILCodeVersioningState::Key(pMD->GetModule(), pMD->GetMemberDef());
+            if (!methodMap.AddNoThrow(entry))
+                return E_OUTOFMEMORY;
+        }
+        else
+        {
+            entry.m_key = ILCodeVersioningState::Key(pMD->GetModule(), pMD->GetMethodTable()->GetCl());
+            if (!typeMap.AddNoThrow(entry))
+                return E_OUTOFMEMORY;
+        }
+    }
+
+    _ASSERTE(AppDomain::GetCurrentDomain() != NULL);
+    AppDomain::AssemblyIterator assemIterator = AppDomain::GetCurrentDomain()->IterateAssembliesEx(
+        (AssemblyIterationFlags)(kIncludeAvailableToProfilers | kIncludeExecution));
+    CollectibleAssemblyHolder<DomainAssembly *> pDomainAssembly;
+    while (assemIterator.Next(pDomainAssembly.This()))
+    {
+        Module* pCurrentModule = pDomainAssembly->GetModule();
 
-        if (!pLoadedMD->IsVersionable())
+        if (typeMap.GetCount() != 0)
         {
-            // For compatibility with the rejit APIs we ensure certain errors are detected and reported using their
-            // original HRESULTS
-            HRESULT errorHR = GetNonVersionableError(pLoadedMD);
-            if (FAILED(errorHR))
+            EETypeHashTable* pParamTypes = pCurrentModule->GetAvailableParamTypes();
+            EETypeHashTable::Iterator typeIterator(pParamTypes);
+            EETypeHashEntry* pTypeEntry;
+            while (pParamTypes->FindNext(&typeIterator, &pTypeEntry))
             {
-                if (FAILED(hr = CodeVersionManager::AddCodePublishError(pModuleContainingMethodDef, methodDef, pLoadedMD, CORPROF_E_FUNCTION_IS_COLLECTIBLE, pUnsupportedMethodErrors)))
+                TypeHandle th = pTypeEntry->GetTypeHandle();
+                if (th.IsTypeDesc())
+                    continue;
+
+                MethodTable* pMT = th.AsMethodTable();
+                ILCodeVersioningState::Key key(pMT->GetModule(), pMT->GetCl());
+                for (GenericMethodBatchMap::KeyIterator iter = typeMap.Begin(key), end = typeMap.End(key); iter != end; ++iter)
                 {
-                    _ASSERTE(hr == E_OUTOFMEMORY);
-                    return hr;
+                    MethodDesc* pMD = ppMethodDescs[iter->m_index];
+                    MethodDesc* pLoadedMD = pMT->GetCanonicalMethodTable()->GetParallelMethodDesc(pMD);
+                    if (FAILED(hr = AddClosedMethodDesc(pMD->GetModule(), pMD->GetMemberDef(), pLoadedMD, &pClosedMethodDescs[iter->m_index], pUnsupportedMethodErrors)))
+                    {
+                        return hr;
+                    }
                 }
             }
-            continue;
         }
 
-        MethodDesc ** ppMD = pClosedMethodDescs->Append();
-        if (ppMD == NULL)
+        if (methodMap.GetCount() != 0)
         {
-            return E_OUTOFMEMORY;
+            InstMethodHashTable* pInstMethods = pCurrentModule->GetInstMethodHashTable();
+            InstMethodHashTable::Iterator methodIterator(pInstMethods);
+            InstMethodHashEntry* pMethodEntry;
+            while (pInstMethods->FindNext(&methodIterator, &pMethodEntry))
+            {
+                MethodDesc* pLoadedMD = pMethodEntry->GetMethod();
+                ILCodeVersioningState::Key key(pLoadedMD->GetModule(), pLoadedMD->GetMemberDef());
+                for (GenericMethodBatchMap::KeyIterator iter = methodMap.Begin(key), end = methodMap.End(key); iter != end; ++iter)
+                {
+                    MethodDesc* pMD = ppMethodDescs[iter->m_index];
+                    if (FAILED(hr = AddClosedMethodDesc(pMD->GetModule(), pMD->GetMemberDef(), pLoadedMD, &pClosedMethodDescs[iter->m_index], pUnsupportedMethodErrors)))
+                    {
+                        return hr;
+                    }
+                }
+            }
+        }
+    }
+
+    return S_OK;
+}
+
+// static
+HRESULT CodeVersionManager::AddClosedMethodDesc(
+    Module* pModuleContainingMethodDef,
+    mdMethodDef methodDef,
+    MethodDesc* pLoadedMD,
+    CDynArray<MethodDesc*> * pClosedMethodDescs,
+    CDynArray<CodePublishError> * pUnsupportedMethodErrors)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        PRECONDITION(CheckPointer(pLoadedMD));
+        PRECONDITION(CheckPointer(pClosedMethodDescs));
+        PRECONDITION(CheckPointer(pUnsupportedMethodErrors));
+    }
+    CONTRACTL_END;
+
+    HRESULT hr;
+
+    if (!pLoadedMD->IsVersionable())
+    {
+        // For compatibility with the rejit APIs we ensure certain errors are detected and reported using their
+        // original HRESULTS
+        HRESULT errorHR = GetNonVersionableError(pLoadedMD);
+        if (FAILED(errorHR))
+        {
+            if (FAILED(hr = CodeVersionManager::AddCodePublishError(pModuleContainingMethodDef, methodDef, pLoadedMD, CORPROF_E_FUNCTION_IS_COLLECTIBLE, pUnsupportedMethodErrors)))
+            {
+                _ASSERTE(hr == E_OUTOFMEMORY);
+                return hr;
+            }
         }
-        *ppMD = pLoadedMD;
+        return S_OK;
+    }
+
+    MethodDesc ** ppMD = pClosedMethodDescs->Append();
+    if (ppMD == NULL)
+    {
+        return E_OUTOFMEMORY;
     }
+    *ppMD = pLoadedMD;
     return S_OK;
 }
 #endif // DACCESS_COMPILE
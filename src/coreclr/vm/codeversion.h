@@ -584,6 +584,17 @@ private:
         mdMethodDef methodDef,
         CDynArray<MethodDesc*> * pClosedMethodDescs,
         CDynArray<CodePublishError> * pUnsupportedMethodErrors);
+    static HRESULT EnumerateGenericClosedMethodDescs(
+        MethodDesc** ppMethodDescs,
+        DWORD cMethodDescs,
+        CDynArray<MethodDesc*> * pClosedMethodDescs,
+        CDynArray<CodePublishError> * pUnsupportedMethodErrors);
+    static HRESULT AddClosedMethodDesc(
+        Module* pModuleContainingMethodDef,
+        mdMethodDef methodDef,
+        MethodDesc* pLoadedMD,
+        CDynArray<MethodDesc*> * pClosedMethodDescs,
+        CDynArray<CodePublishError> * pUnsupportedMethodErrors);
     static HRESULT GetNonVersionableError(MethodDesc* pMD);
     void ReportCodePublishError(CodePublishError* pErrorRecord);
     void ReportCodePublishError(MethodDesc* pMD, HRESULT hrStatus);
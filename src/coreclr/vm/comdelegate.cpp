@@ -2133,6 +2133,9 @@ FCIMPL1(MethodDesc*, COMDelegate::GetInvokeMethod, Object* refThisIn)
 }
 FCIMPLEND
 
+// Invocation lists up to this long get straight line calls in the multicast invoke stub
+#define MULTICAST_INVOKE_UNROLL_MAX 3
+
 FCIMPL1(PCODE, COMDelegate::GetMulticastInvoke, Object* refThisIn)
 {
     FCALL_CONTRACT;
@@ -2165,8 +2168,64 @@ FCIMPL1(PCODE, COMDelegate::GetMulticastInvoke, Object* refThisIn)
         if(fReturnVal)
             dwReturnValNum = pCode->NewLocal(sig.GetRetTypeHandleNT());
 
+        // Multicast delegates are immutable, so the invocation list and count are only loaded once
+        DWORD dwInvocationListNum = pCode->NewLocal(ELEMENT_TYPE_OBJECT);
+        DWORD dwInvocationCountNum = pCode->NewLocal(ELEMENT_TYPE_I);
+
         ILCodeLabel *nextDelegate = pCode->NewCodeLabel();
         ILCodeLabel *checkCount = pCode->NewCodeLabel();
+        ILCodeLabel *loopStart = pCode->NewCodeLabel();
+
+        pCode->EmitLoadThis();
+        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_LIST)));
+        pCode->EmitSTLOC(dwInvocationListNum);
+        pCode->EmitLoadThis();
+        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_COUNT)));
+        pCode->EmitSTLOC(dwInvocationCountNum);
+
+#ifdef DEBUGGING_SUPPORTED
+        // The debugger has to see every invocation through MulticastDebuggerTraceHelper, leave that to the loop
+        pCode->EmitLDC((DWORD_PTR)&g_CORDebuggerControlFlags);
+        pCode->EmitCONV_I();
+        pCode->EmitLDIND_I4();
+        pCode->EmitLDC(DBCF_ATTACHED);
+        pCode->EmitAND();
+        pCode->EmitBRTRUE(loopStart);
+#endif // DEBUGGING_SUPPORTED
+
+        // Most multicast delegates only have a couple of targets (e.g. events with two or three handlers),
+        // call those straight without going through the loop
+        for (UINT unrolledCount = 2; unrolledCount <= MULTICAST_INVOKE_UNROLL_MAX; unrolledCount++)
+        {
+            ILCodeLabel *notThisCount = pCode->NewCodeLabel();
+
+            pCode->EmitLDLOC(dwInvocationCountNum);
+            pCode->EmitLDC(unrolledCount);
+            pCode->EmitCONV_I();
+            pCode->EmitBNE_UN(notThisCount);
+
+            for (UINT i = 0; i < unrolledCount; i++)
+            {
+                pCode->EmitLDLOC(dwInvocationListNum);
+                pCode->EmitLDC(i);
+                pCode->EmitLDELEM_REF();
+
+                for (UINT paramCount = 0; paramCount < sig.NumFixedArgs(); paramCount++)
+                    pCode->EmitLDARG(paramCount);
+
+                pCode->EmitCALL(pCode->GetToken(pMD), sig.NumFixedArgs(), fReturnVal);
+
+                // return value from the last delegate call is returned
+                if (fReturnVal && (i + 1 < unrolledCount))
+                    pCode->EmitPOP();
+            }
+
+            pCode->EmitRET();
+
+            pCode->EmitLabel(notThisCount);
+        }
+
+        pCode->EmitLabel(loopStart);
 
         // initialize counter
         pCode->EmitLDC(0);
@@ -2179,8 +2238,7 @@ FCIMPL1(PCODE, COMDelegate::GetMulticastInvoke, Object* refThisIn)
         pCode->EmitLabel(nextDelegate);
 
         // Load next delegate from array using LoopCounter as index
-        pCode->EmitLoadThis();
-        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_LIST)));
+        pCode->EmitLDLOC(dwInvocationListNum);
         pCode->EmitLDLOC(dwLoopCounterNum);
         pCode->EmitLDELEM_REF();
 
@@ -2223,8 +2281,7 @@ FCIMPL1(PCODE, COMDelegate::GetMulticastInvoke, Object* refThisIn)
 
         // compare LoopCounter with InvocationCount. If less then branch to nextDelegate
         pCode->EmitLDLOC(dwLoopCounterNum);
-        pCode->EmitLoadThis();
-        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_COUNT)));
+        pCode->EmitLDLOC(dwInvocationCountNum);
         pCode->EmitBLT(nextDelegate);
 
         // load the return value. return value from the last delegate call is returned
@@ -898,6 +898,23 @@ extern "C" void QCALLTYPE GCInterface_WaitForPendingFinalizers()
     END_QCALL;
 }
 
+/*=========================GetFinalizationQueueInfo=============================
+**Action: Reports how far finalization is behind, for the runtime counters
+**Arguments: pLength - number of objects waiting to be finalized
+**           pLagMs - how long the oldest of them have been waiting
+**Exceptions: None
+==============================================================================*/
+extern "C" void QCALLTYPE GCInterface_GetFinalizationQueueInfo(UINT64* pLength, UINT64* pLagMs)
+{
+    QCALL_CONTRACT;
+
+    BEGIN_QCALL;
+
+    FinalizerThread::GetFinalizationQueueInfo(pLength, pLagMs);
+
+    END_QCALL;
+}
+
 
 /*===============================GetMaxGeneration===============================
 **Action: Returns the largest GC generation
@@ -201,6 +201,8 @@ extern "C" void QCALLTYPE GCInterface_Collect(INT32 generation, INT32 mode);
 extern "C" void* QCALLTYPE GCInterface_GetNextFinalizableObject(QCall::ObjectHandleOnStack pObj);
 
 extern "C" void QCALLTYPE GCInterface_WaitForPendingFinalizers();
+
+extern "C" void QCALLTYPE GCInterface_GetFinalizationQueueInfo(UINT64* pLength, UINT64* pLagMs);
 #ifdef FEATURE_BASICFREEZE
 extern "C" void* QCALLTYPE GCInterface_RegisterFrozenSegment(void *pSection, SIZE_T sizeSection);
 
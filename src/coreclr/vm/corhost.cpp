@@ -37,6 +37,7 @@
 #endif // !TARGET_UNIX
 
 #include "nativelibrary.h"
+#include "startupsummary.h"
 
 #ifndef DACCESS_COMPILE
 
@@ -319,7 +320,9 @@ HRESULT CorHost2::ExecuteAssembly(DWORD dwAppDomainId,
         g_EntryAssemblyPath = path.Extract();
     }
 
+    StartupSummary::PhaseStart(StartupSummary::Phase_LoadEntryAssembly);
     Assembly *pAssembly = AssemblySpec::LoadAssembly(pwzAssemblyPath);
+    StartupSummary::PhaseEnd(StartupSummary::Phase_LoadEntryAssembly);
 
 #if defined(FEATURE_MULTICOREJIT)
     pCurDomain->GetMulticoreJitManager().AutoStartProfile(pCurDomain);
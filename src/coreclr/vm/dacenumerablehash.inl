@@ -227,6 +227,14 @@ void DacEnumerableHashTable<DAC_ENUM_HASH_ARGS>::GrowTable()
         pNewBuckets[dwCurBucket] = dac_cast<PTR_VolatileEntry>(ComputeEndSentinel(newEndSentinel, dwCurBucket));
     }
 
+    // Remember the last entry of every new bucket so moving an entry doesn't have to walk the new chain
+    // again. The table is still correct without it, it just takes quadratic time in the chain length.
+    NewArrayHolder<PTR_VolatileEntry> pNewTails = new (nothrow) PTR_VolatileEntry[cNewBuckets];
+    if (pNewTails != NULL)
+    {
+        memset(pNewTails, 0, cNewBuckets * sizeof(PTR_VolatileEntry));
+    }
+
     // NOTE: DAC does not call add/grow, so this cast is ok.
     VolatileStore(&((PTR_VolatileEntry**)curBuckets)[SLOT_NEXT], pNewBuckets);
 
@@ -255,14 +263,26 @@ void DacEnumerableHashTable<DAC_ENUM_HASH_ARGS>::GrowTable()
             }
             else
             {
-                while (!IsEndSentinel(pTail->m_pNextEntry))
+                if (pNewTails != NULL)
+                {
+                    pTail = pNewTails[dwNewBucket - SKIP_SPECIAL_SLOTS];
+                }
+                else
                 {
-                    pTail = pTail->m_pNextEntry;
+                    while (!IsEndSentinel(pTail->m_pNextEntry))
+                    {
+                        pTail = pTail->m_pNextEntry;
+                    }
                 }
 
                 pTail->m_pNextEntry = pEntry;
             }
 
+            if (pNewTails != NULL)
+            {
+                pNewTails[dwNewBucket - SKIP_SPECIAL_SLOTS] = pEntry;
+            }
+
             // skip pEntry in the old bucket after it appears in the new.
             VolatileStore(&curBuckets[dwCurBucket], pNextEntry);
 
@@ -3020,6 +3020,23 @@ namespace
         return hr == S_OK;
     }
 
+    // Allows short, non-blocking native functions (e.g. SystemNative_GetTimestamp) to be called
+    // without a GC transition when the P/Invokes declaring them cannot be annotated.
+    bool IsSuppressGCTransitionConfigured(_In_ MethodDesc* pMD)
+    {
+        STANDARD_VM_CONTRACT;
+
+        LPCUTF8 entryPointName = NULL;
+        DWORD mappingFlags = 0;
+        if (FAILED(pMD->GetMDImport()->GetPinvokeMap(pMD->GetMemberDef(), &mappingFlags, &entryPointName, NULL /*pmrImportDLL*/)))
+            return false;
+
+        if (entryPointName == NULL || *entryPointName == '\0')
+            entryPointName = pMD->GetName();
+
+        return g_pConfig->SuppressGCTransition(entryPointName);
+    }
+
     bool TryGetCallingConventionFromPInvokeMetadata(_In_ MethodDesc* pMD, _Out_ CorInfoCallConvExtension* callConv)
     {
         CONTRACTL
@@ -3092,7 +3109,8 @@ void NDirect::GetCallingConvention_IgnoreErrors(_In_ MethodDesc* pMD, _Out_opt_
 
     if (suppressGCTransition != NULL)
     {
-        *suppressGCTransition = HasSuppressGCTransitionAttribute(pMD);
+        *suppressGCTransition = HasSuppressGCTransitionAttribute(pMD)
+            || (!pMD->GetMethodTable()->IsDelegate() && IsSuppressGCTransitionConfigured(pMD));
 
         // Caller only cares about SuppressGCTransition and we have already determined it is true.
         if (callConv == NULL && *suppressGCTransition)
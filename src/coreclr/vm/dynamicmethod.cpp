@@ -381,6 +381,9 @@ HostCodeHeap::~HostCodeHeap()
     if (m_pHeapList != NULL && m_pHeapList->pHdrMap != NULL)
         delete[] m_pHeapList->pHdrMap;
 
+    if (m_pHeapList != NULL && m_pHeapList->pHdrPageMap != NULL)
+        delete[] m_pHeapList->pHdrPageMap;
+
     if (m_pBaseAddr)
         ExecutableAllocator::Instance()->Release(m_pBaseAddr);
     LOG((LF_BCL, LL_INFO10, "Level1 - CodeHeap destroyed {0x%p}\n", this));
@@ -463,6 +466,7 @@ HeapList* HostCodeHeap::InitializeHeapList(CodeHeapRequestInfo *pInfo)
     pHp->startAddress = dac_cast<TADDR>(m_pBaseAddr) + (pTracker ? pTracker->size : 0);
     pHp->mapBase = ROUND_DOWN_TO_PAGE(pHp->startAddress);  // round down to next lower page align
     pHp->pHdrMap = NULL;
+    pHp->pHdrPageMap = NULL;
     pHp->endAddress = pHp->startAddress;
 
     pHp->maxCodeHeapSize = m_TotalBytesAvailable - (pTracker ? pTracker->size : 0);
@@ -477,6 +481,9 @@ HeapList* HostCodeHeap::InitializeHeapList(CodeHeapRequestInfo *pInfo)
     pHp->pHdrMap = new DWORD[nibbleMapSize / sizeof(DWORD)];
     ZeroMemory(pHp->pHdrMap, nibbleMapSize);
 
+    pHp->pHdrPageMap = new DWORD[pHp->GetPageMapCount()];
+    ZeroMemory(pHp->pHdrPageMap, pHp->GetPageMapCount() * sizeof(DWORD));
+
     return pHp;
 }
 
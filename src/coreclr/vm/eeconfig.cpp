@@ -189,6 +189,7 @@ HRESULT EEConfig::Init()
 
     m_fInteropValidatePinnedObjects = false;
     m_fInteropLogArguments = false;
+    m_pSuppressGCTransitionList = NULL;
 
 #if defined(_DEBUG) && defined(STUBLINKER_GENERATES_UNWIND_INFO)
     fStubLinkerUnwindInfoVerificationOn = FALSE;
@@ -216,8 +217,10 @@ HRESULT EEConfig::Init()
     fTieredCompilation_UseCallCountingStubs = false;
     tieredCompilation_CallCountThreshold = 1;
     tieredCompilation_BackgroundWorkerTimeoutMs = 0;
+    tieredCompilation_BackgroundWorkerCount = 1;
     tieredCompilation_CallCountingDelayMs = 0;
     tieredCompilation_DeleteCallCountingStubsAfter = 0;
+    tieredCompilation_CallCountingCompletionBatchMs = 0;
 #endif
 
 #if defined(FEATURE_PGO)
@@ -233,6 +236,7 @@ HRESULT EEConfig::Init()
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     dwOSR_HitLimit = 10;
     dwOSR_CounterBump = 5000;
+    fOSR_BackgroundCompilation = false;
 #endif
 
     backpatchEntryPointSlots = false;
@@ -261,6 +265,9 @@ HRESULT EEConfig::Cleanup()
     if (pReadyToRunExcludeList)
         delete pReadyToRunExcludeList;
 
+    if (m_pSuppressGCTransitionList)
+        delete m_pSuppressGCTransitionList;
+
 #ifdef FEATURE_COMINTEROP
     if (pszLogCCWRefCountChange)
         delete [] pszLogCCWRefCountChange;
@@ -323,6 +330,7 @@ HRESULT EEConfig::sync()
     // so we only update it once (to avoid reentrancy windows)
 
     fTrackDynamicMethodDebugInfo = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TrackDynamicMethodDebugInfo);
+    fTrackOptimizedVarInfo = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TrackOptimizedVarInfo) != 0;
 
 #ifdef _DEBUG
     iFastGCStress       = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_FastGCStress);
@@ -626,6 +634,13 @@ HRESULT EEConfig::sync()
     m_fInteropValidatePinnedObjects = (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_InteropValidatePinnedObjects) != 0);
     m_fInteropLogArguments = (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_InteropLogArguments) != 0);
 
+    {
+        NewArrayHolder<WCHAR> wszSuppressGCTransitionList;
+        IfFailRet(CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PInvokeSuppressGCTransition, &wszSuppressGCTransitionList));
+        if (wszSuppressGCTransitionList)
+            m_pSuppressGCTransitionList = new AssemblyNamesList(wszSuppressGCTransitionList);
+    }
+
 #if defined(_DEBUG) && defined(FEATURE_EH_FUNCLETS)
     fSuppressLockViolationsOnReentryFromOS = (CLRConfig::GetConfigValue(CLRConfig::INTERNAL_SuppressLockViolationsOnReentryFromOS) != 0);
 #endif
@@ -664,6 +679,21 @@ HRESULT EEConfig::sync()
         tieredCompilation_BackgroundWorkerTimeoutMs =
             CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_BackgroundWorkerTimeoutMs);
 
+        tieredCompilation_BackgroundWorkerCount =
+            Configuration::GetKnobDWORDValue(W("System.Runtime.TieredCompilation.BackgroundWorkerCount"), CLRConfig::EXTERNAL_TC_BackgroundWorkerCount);
+        if (tieredCompilation_BackgroundWorkerCount == 0)
+        {
+            tieredCompilation_BackgroundWorkerCount = 1;
+        }
+        else
+        {
+            DWORD processorCount = (DWORD)GetCurrentProcessCpuCount();
+            if (tieredCompilation_BackgroundWorkerCount > processorCount)
+            {
+                tieredCompilation_BackgroundWorkerCount = processorCount;
+            }
+        }
+
         fTieredCompilation_CallCounting = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_CallCounting) != 0;
 
         DWORD tieredCompilation_ConfiguredCallCountThreshold =
@@ -707,6 +737,8 @@ HRESULT EEConfig::sync()
             {
                 tieredCompilation_DeleteCallCountingStubsAfter =
                     CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_DeleteCallCountingStubsAfter);
+                tieredCompilation_CallCountingCompletionBatchMs =
+                    CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_CallCountingCompletionBatchMs);
             }
         }
 
@@ -752,6 +784,7 @@ HRESULT EEConfig::sync()
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     dwOSR_HitLimit = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_HitLimit);
     dwOSR_CounterBump = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_CounterBump);
+    fOSR_BackgroundCompilation = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_BackgroundCompilation) != 0;
 #endif
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT) && defined(_DEBUG)
@@ -775,6 +808,16 @@ HRESULT EEConfig::sync()
     return hr;
 }
 
+bool EEConfig::SuppressGCTransition(LPCUTF8 entryPoint) const
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_pSuppressGCTransitionList != NULL && m_pSuppressGCTransitionList->IsInList(entryPoint))
+        return true;
+
+    return false;
+}
+
 bool EEConfig::ExcludeReadyToRun(LPCUTF8 assemblyName) const
 {
     LIMITED_METHOD_CONTRACT;
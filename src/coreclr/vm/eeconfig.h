@@ -73,6 +73,7 @@ public:
 
     DWORD         JitHostMaxSlabCache(void)                 const {LIMITED_METHOD_CONTRACT;  return dwJitHostMaxSlabCache; }
     bool          GetTrackDynamicMethodDebugInfo(void)      const {LIMITED_METHOD_CONTRACT;  return fTrackDynamicMethodDebugInfo; }
+    bool          GetTrackOptimizedVarInfo(void)            const {LIMITED_METHOD_CONTRACT;  return fTrackOptimizedVarInfo; }
     unsigned int  GenOptimizeType(void)                     const {LIMITED_METHOD_CONTRACT;  return iJitOptimizeType; }
     bool          JitFramed(void)                           const {LIMITED_METHOD_CONTRACT;  return fJitFramed; }
     bool          JitMinOpts(void)                          const {LIMITED_METHOD_CONTRACT;  return fJitMinOpts; }
@@ -84,11 +85,13 @@ public:
     bool          TieredCompilation_QuickJit() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_QuickJit; }
     bool          TieredCompilation_QuickJitForLoops() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_QuickJitForLoops; }
     DWORD         TieredCompilation_BackgroundWorkerTimeoutMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_BackgroundWorkerTimeoutMs; }
+    DWORD         TieredCompilation_BackgroundWorkerCount() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_BackgroundWorkerCount; }
     bool          TieredCompilation_CallCounting()  const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_CallCounting; }
     UINT16        TieredCompilation_CallCountThreshold() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountThreshold; }
     DWORD         TieredCompilation_CallCountingDelayMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountingDelayMs; }
     bool          TieredCompilation_UseCallCountingStubs() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_UseCallCountingStubs; }
     DWORD         TieredCompilation_DeleteCallCountingStubsAfter() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_DeleteCallCountingStubsAfter; }
+    DWORD         TieredCompilation_CallCountingCompletionBatchMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountingCompletionBatchMs; }
 #endif
 
 #if defined(FEATURE_PGO)
@@ -105,6 +108,7 @@ public:
     // OSR Config
     DWORD         OSR_CounterBump() const { LIMITED_METHOD_CONTRACT; return dwOSR_CounterBump; }
     DWORD         OSR_HitLimit() const { LIMITED_METHOD_CONTRACT; return dwOSR_HitLimit; }
+    bool          OSR_BackgroundCompilation() const { LIMITED_METHOD_CONTRACT; return fOSR_BackgroundCompilation; }
 #endif
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT) && defined(_DEBUG)
@@ -143,6 +147,7 @@ public:
 
     bool InteropValidatePinnedObjects()             const { LIMITED_METHOD_CONTRACT;  return m_fInteropValidatePinnedObjects; }
     bool InteropLogArguments()                      const { LIMITED_METHOD_CONTRACT;  return m_fInteropLogArguments; }
+    bool SuppressGCTransition(LPCUTF8 entryPoint) const;
 
     bool GenDebuggableCode(void)                    const { LIMITED_METHOD_CONTRACT;  return fDebuggable; }
 
@@ -456,6 +461,7 @@ private: //----------------------------------------------------------------
 
     DWORD dwJitHostMaxSlabCache;       // max size for jit host slab cache
     bool fTrackDynamicMethodDebugInfo; //  Enable/Disable tracking dynamic method debug info
+    bool fTrackOptimizedVarInfo;       //  Enable/Disable storing var info for optimized code
     bool fJitFramed;                   // Enable/Disable EBP based frames
     bool fJitMinOpts;                  // Enable MinOpts for all jitted methods
     bool fJitEnableOptionalRelocs;     // Allow optional relocs
@@ -476,6 +482,7 @@ private: //----------------------------------------------------------------
 
     bool   m_fInteropValidatePinnedObjects; // After returning from a M->U interop call, validate GC heap around objects pinned by IL stubs.
     bool   m_fInteropLogArguments; // Log all pinned arguments passed to an interop call
+    AssemblyNamesList * m_pSuppressGCTransitionList; // Native entry points to call without a GC transition
 
     bool fDebuggable;
 
@@ -614,8 +621,10 @@ private: //----------------------------------------------------------------
     bool fTieredCompilation_UseCallCountingStubs;
     UINT16 tieredCompilation_CallCountThreshold;
     DWORD tieredCompilation_BackgroundWorkerTimeoutMs;
+    DWORD tieredCompilation_BackgroundWorkerCount;
     DWORD tieredCompilation_CallCountingDelayMs;
     DWORD tieredCompilation_DeleteCallCountingStubsAfter;
+    DWORD tieredCompilation_CallCountingCompletionBatchMs;
 #endif
 
 #if defined(FEATURE_PGO)
@@ -631,6 +640,7 @@ private: //----------------------------------------------------------------
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     DWORD dwOSR_HitLimit;
     DWORD dwOSR_CounterBump;
+    bool fOSR_BackgroundCompilation;
 #endif
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT) && defined(_DEBUG)
@@ -460,6 +460,8 @@ EEToProfInterfaceImpl::EEToProfInterfaceImpl() :
     m_pEnter3WithInfo(NULL),
     m_pLeave3WithInfo(NULL),
     m_pTailcall3WithInfo(NULL),
+    m_dwEnterLeaveSampleRate(1),
+    m_pEnterLeaveSampleCounters(NULL),
     m_fUnrevertiblyModifiedIL(FALSE),
     m_fModifiedRejitState(FALSE),
     m_pProfilerInfo(NULL),
@@ -568,6 +570,19 @@ HRESULT EEToProfInterfaceImpl::Init(
         return E_OUTOFMEMORY;
     }
 
+    // Sampling is best effort, so the profiler just gets every call if the counters
+    // can't be allocated.
+    NewArrayHolder<DWORD> pEnterLeaveSampleCounters(NULL);
+    DWORD dwEnterLeaveSampleRate = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_ProfAPI_EnterLeaveSampleRate);
+    if (dwEnterLeaveSampleRate > 1)
+    {
+        pEnterLeaveSampleCounters = new (nothrow) DWORD[kEnterLeaveHook_Count * s_cEnterLeaveSampleCounters];
+        if (pEnterLeaveSampleCounters != NULL)
+        {
+            memset(pEnterLeaveSampleCounters, 0, kEnterLeaveHook_Count * s_cEnterLeaveSampleCounters * sizeof(DWORD));
+        }
+    }
+
     // This wraps the following profiler calls in a try / catch:
     // * ClassFactory::CreateInstance
     // * AddRef/Release/QueryInterface
@@ -608,6 +623,12 @@ HRESULT EEToProfInterfaceImpl::Init(
     m_pFunctionIDHashTableRWLock = pFunctionIDHashTableRWLock.Extract();
     pFunctionIDHashTableRWLock = NULL;
 
+    if (pEnterLeaveSampleCounters != NULL)
+    {
+        m_dwEnterLeaveSampleRate = dwEnterLeaveSampleRate;
+        m_pEnterLeaveSampleCounters = pEnterLeaveSampleCounters.Extract();
+    }
+
     return S_OK;
 }
 
@@ -1045,6 +1066,12 @@ EEToProfInterfaceImpl::~EEToProfInterfaceImpl()
         delete m_pFunctionIDHashTableRWLock;
         m_pFunctionIDHashTableRWLock = NULL;
     }
+
+    if (m_pEnterLeaveSampleCounters != NULL)
+    {
+        delete [] m_pEnterLeaveSampleCounters;
+        m_pEnterLeaveSampleCounters = NULL;
+    }
 }
 
 //---------------------------------------------------------------------------------------
@@ -2060,16 +2087,18 @@ HRESULT EEToProfInterfaceImpl::DetermineAndSetEnterLeaveFunctionHooksForJit()
             // happy lucky fast path (i.e., direct call from JITd code right into the profiler's
             // hook or the JIT default stub (see below)), or the slow path (i.e., call into an
             // intermediary FCALL which then calls the profiler's hook) with extra information
-            // about the current function.
+            // about the current function.  When the hooks are sampled, the fast-path hooks go
+            // through the intermediary as well, since it is what skips the unsampled calls.
+            BOOL fSampled = IsEnterLeaveSampled();
 
             hr = SetEnterLeaveFunctionHooksForJit(
-                (m_pEnter3WithInfo != NULL) ?
+                ((m_pEnter3WithInfo != NULL) || (fSampled && (m_pEnter3 != NULL))) ?
                     PROFILECALLBACK(ProfileEnter) :
                     m_pEnter3,
-                (m_pLeave3WithInfo != NULL) ?
+                ((m_pLeave3WithInfo != NULL) || (fSampled && (m_pLeave3 != NULL))) ?
                     PROFILECALLBACK(ProfileLeave) :
                     m_pLeave3,
-                (m_pTailcall3WithInfo != NULL) ?
+                ((m_pTailcall3WithInfo != NULL) || (fSampled && (m_pTailcall3 != NULL))) ?
                     PROFILECALLBACK(ProfileTailcall) :
                     m_pTailcall3);
         }
@@ -93,6 +93,17 @@ public:
 
     BOOL IsClientIDToFunctionIDMappingEnabled();
 
+    enum EnterLeaveHook
+    {
+        kEnterLeaveHook_Enter,
+        kEnterLeaveHook_Leave,
+        kEnterLeaveHook_Tailcall,
+        kEnterLeaveHook_Count
+    };
+
+    BOOL IsEnterLeaveSampled();
+    BOOL ShouldCallEnterLeaveHook(EnterLeaveHook hook, UINT_PTR clientData);
+
     UINT_PTR LookupClientIDFromCache(FunctionID functionID);
 
     HRESULT SetEnterLeaveFunctionHooks(
@@ -588,6 +599,13 @@ private:
     FunctionLeave3WithInfo *    m_pLeave3WithInfo;
     FunctionTailcall3WithInfo * m_pTailcall3WithInfo;
 
+    // When ProfAPI_EnterLeaveSampleRate is set above one, each method's enter, leave and
+    // tailcall hooks fire for only one call in that many.  The counters are indexed by
+    // hook and by a hash of the method's FunctionID or ClientID.
+    static const DWORD s_cEnterLeaveSampleCounters = 1024;
+    DWORD                   m_dwEnterLeaveSampleRate;
+    DWORD *                 m_pEnterLeaveSampleCounters;
+
 
     // Remembers whether the profiler used SetILFunctionBody() which modifies IL in a
     // way that cannot be reverted.  This prevents a detach from succeeding.
@@ -191,6 +191,38 @@ inline BOOL EEToProfInterfaceImpl::IsClientIDToFunctionIDMappingEnabled()
     return m_fIsClientIDToFunctionIDMappingEnabled;
 }
 
+inline BOOL EEToProfInterfaceImpl::IsEnterLeaveSampled()
+{
+    LIMITED_METHOD_CONTRACT;
+    return m_pEnterLeaveSampleCounters != NULL;
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Decides whether the ELT intermediary should call the profiler's hook for this call.
+// Without sampling every call is reported.  With sampling, the first call of a method
+// is reported and then every m_dwEnterLeaveSampleRate-th one.
+//
+// Methods hashing to the same counter share it, and concurrent calls may lose an
+// update.  Both only make the sampling less regular, so the counters aren't synchronized.
+//
+
+inline BOOL EEToProfInterfaceImpl::ShouldCallEnterLeaveHook(EnterLeaveHook hook, UINT_PTR clientData)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_pEnterLeaveSampleCounters == NULL)
+        return TRUE;
+
+    _ASSERTE(hook < kEnterLeaveHook_Count);
+    DWORD index = (DWORD)((clientData >> 3) ^ (clientData >> 13)) % s_cEnterLeaveSampleCounters;
+    DWORD * pCounter = &m_pEnterLeaveSampleCounters[hook * s_cEnterLeaveSampleCounters + index];
+
+    DWORD count = *pCounter;
+    *pCounter = (count + 1 < m_dwEnterLeaveSampleRate) ? count + 1 : 0;
+    return (count == 0);
+}
+
 //---------------------------------------------------------------------------------------
 //
 // Lookup the clientID for a given functionID
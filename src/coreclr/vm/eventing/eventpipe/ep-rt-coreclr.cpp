@@ -7,6 +7,7 @@
 #include <eventpipe/ep-types.h>
 #include <eventpipe/ep.h>
 #include <eventpipe/ep-stack-contents.h>
+#include <eventpipe/ep-sample-profiler.h>
 #include <eventpipe/ep-rt.h>
 #include "threadsuspend.h"
 
@@ -107,9 +108,18 @@ walk_managed_stack_for_threads (
 
 	EP_ASSERT (current_stack_contents != NULL);
 
+	bool running_threads_only = ep_sample_profiler_get_sample_running_threads_only ();
+
 	// Iterate over all managed threads.
 	// Assumes that the ThreadStoreLock is held because we've suspended all threads.
 	while ((target_thread = ThreadStore::GetThreadList (target_thread)) != NULL) {
+		// Threads in preemptive mode didn't have to be interrupted to suspend the runtime, skip walking
+		// them too when only running threads are sampled.
+		if (running_threads_only && !target_thread->GetGCModeOnSuspension ()) {
+			target_thread->ClearGCModeOnSuspension ();
+			continue;
+		}
+
 		ep_stack_contents_reset (current_stack_contents);
 
 		// Walk the stack and write it out as an event.
@@ -17,6 +17,7 @@
 #include "typestring.h"
 #include "clrversion.h"
 #include "hostinformation.h"
+#include "perfmap.h"
 
 #undef EP_INFINITE_WAIT
 #define EP_INFINITE_WAIT INFINITE
@@ -539,6 +540,25 @@ ep_rt_config_value_get_output_streaming (void)
 	return CLRConfig::GetConfigValue (CLRConfig::INTERNAL_EventPipeOutputStreaming) != 0;
 }
 
+static
+inline
+ep_char8_t *
+ep_rt_config_value_get_startup_session_config (void)
+{
+	STATIC_CONTRACT_NOTHROW;
+	CLRConfigStringHolder value(CLRConfig::GetConfigValue (CLRConfig::INTERNAL_EventPipeStartupSession));
+	return ep_rt_utf16_to_utf8_string (reinterpret_cast<ep_char16_t *>(value.GetValue ()));
+}
+
+static
+inline
+uint32_t
+ep_rt_config_value_get_startup_session_mb (void)
+{
+	STATIC_CONTRACT_NOTHROW;
+	return CLRConfig::GetConfigValue (CLRConfig::INTERNAL_EventPipeStartupSessionMB);
+}
+
 static
 inline
 bool
@@ -548,6 +568,15 @@ ep_rt_config_value_get_enable_stackwalk (void)
 	return CLRConfig::GetConfigValue(CLRConfig::INTERNAL_EventPipeEnableStackwalk) != 0;
 }
 
+static
+inline
+bool
+ep_rt_config_value_get_sample_running_threads_only (void)
+{
+	STATIC_CONTRACT_NOTHROW;
+	return CLRConfig::GetConfigValue(CLRConfig::INTERNAL_EventPipeSampleRunningThreadsOnly) != 0;
+}
+
 /*
  * EventPipeSampleProfiler.
  */
@@ -775,6 +804,23 @@ ep_rt_execute_rundown (dn_vector_ptr_t *execution_checkpoints)
 	}
 }
 
+static
+inline
+bool
+ep_rt_enable_method_load_log (void)
+{
+	STATIC_CONTRACT_NOTHROW;
+
+#ifdef FEATURE_PERFMAP
+	// Once enabled, the perf map holds every jitted method, including the ones compiled before.
+	if (!PerfMap::IsEnabled ())
+		PerfMap::Enable (PerfMap::PerfMapType::PERFMAP, true);
+	return PerfMap::IsEnabled ();
+#else
+	return false;
+#endif
+}
+
 /*
  * Objects.
  */
@@ -768,6 +768,9 @@ BOOL ETW::TypeSystemLog::s_fHeapAllocEventEnabledOnStartup = FALSE;
 BOOL ETW::TypeSystemLog::s_fHeapAllocHighEventEnabledNow = FALSE;
 BOOL ETW::TypeSystemLog::s_fHeapAllocLowEventEnabledNow = FALSE;
 int ETW::TypeSystemLog::s_nCustomMsBetweenEvents = 0;
+BOOL ETW::TypeSystemLog::s_fAllocationSamplingEnabledOnStartup = FALSE;
+BOOL ETW::TypeSystemLog::s_fAllocationSamplingEnabledNow = FALSE;
+SIZE_T ETW::TypeSystemLog::s_cbAllocationSamplingMean = 0;
 
 
 //---------------------------------------------------------------------------------------
@@ -822,6 +825,18 @@ void ETW::TypeSystemLog::PostRegistrationInit()
     // keeps things consistent.
     s_fHeapAllocEventEnabledOnStartup = (s_fHeapAllocLowEventEnabledNow || s_fHeapAllocHighEventEnabledNow);
 
+    // The AllocationSampled event relies on the slow alloc JIT helper as well, so it is
+    // snapshotted the same way.
+    s_fAllocationSamplingEnabledNow = ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TRACE_LEVEL_INFORMATION, CLR_ALLOCATIONSAMPLING_KEYWORD);
+    s_fAllocationSamplingEnabledOnStartup = s_fAllocationSamplingEnabledNow;
+
+    if (s_fAllocationSamplingEnabledOnStartup)
+    {
+        s_cbAllocationSamplingMean = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_ETW_AllocationSamplingMeanBytes);
+        if (s_cbAllocationSamplingMean == 0)
+            s_cbAllocationSamplingMean = CLRConfig::UNSUPPORTED_ETW_AllocationSamplingMeanBytes.defaultValue;
+    }
+
     if (s_fHeapAllocEventEnabledOnStartup)
     {
         // Determine if a COMPLUS env var is overriding the frequency for the sampled
@@ -871,6 +886,7 @@ void ETW::TypeSystemLog::OnKeywordsChanged()
     // update our state.
     s_fHeapAllocLowEventEnabledNow = ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TRACE_LEVEL_INFORMATION, CLR_GCHEAPALLOCLOW_KEYWORD);
     s_fHeapAllocHighEventEnabledNow = ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TRACE_LEVEL_INFORMATION, CLR_GCHEAPALLOCHIGH_KEYWORD);
+    s_fAllocationSamplingEnabledNow = ETW_TRACING_CATEGORY_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, TRACE_LEVEL_INFORMATION, CLR_ALLOCATIONSAMPLING_KEYWORD);
 
     // FUTURE: Would be nice here to log an error event if (s_fHeapAllocLowEventEnabledNow ||
     // s_fHeapAllocHighEventEnabledNow), but !s_fHeapAllocEventEnabledOnStartup
@@ -1137,6 +1153,103 @@ void ETW::TypeSystemLog::SendObjectAllocatedEvent(Object * pObject)
     }
 }
 
+//---------------------------------------------------------------------------------------
+//
+// Use this to decide whether to sample allocations for the AllocationSampled event
+//
+// Return Value:
+//      nonzero iff allocations should be sampled.
+//
+
+// static
+BOOL ETW::TypeSystemLog::IsAllocationSamplingEnabled()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Same rules as code:ETW::TypeSystemLog::IsHeapAllocEventEnabled: the keyword must have
+    // been enabled at startup (so the slow-JIT new helper is used) and still be enabled.
+    return s_fAllocationSamplingEnabledOnStartup && s_fAllocationSamplingEnabledNow;
+}
+
+namespace
+{
+    struct AllocationSamplingState
+    {
+        CLRRandom random;
+
+        // Number of bytes this thread still has to allocate before the byte that gets sampled
+        SIZE_T cbUntilNextSample;
+    };
+
+    thread_local AllocationSamplingState t_allocationSamplingState;
+
+    // Draws the distance to the next sampled byte from an exponential distribution with the
+    // given mean. This makes the sampled bytes a Poisson process over the bytes allocated by
+    // the thread, so every allocated byte has the same chance of being sampled regardless of
+    // the size of the object it belongs to or of how allocation contexts are refilled.
+    SIZE_T GetNextAllocationSampleDistance(CLRRandom * pRandom, SIZE_T cbMean)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        double u = pRandom->NextDouble();
+        return (SIZE_T)(-log(1.0 - u) * (double)cbMean) + 1;
+    }
+}
+
+//---------------------------------------------------------------------------------------
+//
+// Accounts for the object's size on the current thread's sampling state and fires the
+// AllocationSampled event for every sampled byte that falls inside the object. The stack
+// of the allocating thread is attached to the event by EventPipe / ETW.
+//
+// Arguments:
+//      * pObject - Allocated object
+//      * allocationKind - 0 for SOH, 1 for LOH and 2 for POH allocations (see GCAllocationKindMap)
+//
+
+// static
+void ETW::TypeSystemLog::SampleObjectAllocation(Object * pObject, UINT32 allocationKind)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    if (!s_fAllocationSamplingEnabledOnStartup || !g_fEEStarted)
+        return;
+
+    AllocationSamplingState * pState = &t_allocationSamplingState;
+    if (!pState->random.IsInitialized())
+    {
+        pState->random.Init();
+        pState->cbUntilNextSample = GetNextAllocationSampleDistance(&pState->random, s_cbAllocationSamplingMean);
+    }
+
+    SIZE_T size = pObject->GetSize();
+    if (size < pState->cbUntilNextSample)
+    {
+        pState->cbUntilNextSample -= size;
+        return;
+    }
+
+    TypeHandle th = pObject->GetTypeHandle();
+    LogTypeAndParametersIfNecessary(NULL, th.AsTAddr(), kTypeLogBehaviorTakeLockAndLogIfFirstTime);
+
+    // Objects larger than the sampling distance can contain several sampled bytes; each is
+    // reported so that the samples stay proportional to the allocated bytes.
+    SIZE_T cbOffset = 0;
+    while (size - cbOffset >= pState->cbUntilNextSample)
+    {
+        cbOffset += pState->cbUntilNextSample;
+        FireEtwAllocationSampled(allocationKind, GetClrInstanceId(), (LPVOID) th.AsTAddr(), pObject, size, cbOffset - 1);
+        pState->cbUntilNextSample = GetNextAllocationSampleDistance(&pState->random, s_cbAllocationSamplingMean);
+    }
+    pState->cbUntilNextSample -= (size - cbOffset);
+}
+
 //---------------------------------------------------------------------------------------
 //
 // Accessor for global hash table crst
@@ -27,6 +27,10 @@ public:
     ~ForcedGCHolder() { LIMITED_METHOD_CONTRACT; s_forcedGCInProgress = false; }
 };
 
+// Heap dump settings, read before the forced GC so the heap walk doesn't need to
+static bool s_heapDumpAggregate = false;
+static DWORD s_heapDumpAggregateSampleInterval = 0;
+
 
 // Simple helpers called by the GC to decide whether it needs to do a walk of heap
 // objects and / or roots.
@@ -480,6 +484,9 @@ HRESULT ETW::GCLog::ForceGCForDiagnostics()
 
     ASSERT_NO_EE_LOCKS_HELD();
 
+    s_heapDumpAggregate = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_ETW_GCHeapDumpAggregate) != 0;
+    s_heapDumpAggregateSampleInterval = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_ETW_GCHeapDumpAggregateSampleInterval);
+
     EX_TRY
     {
         // Need to switch to cooperative mode as the thread will access managed
@@ -573,6 +580,11 @@ public:
         iCurBulkRootConditionalWeakTableElementEdge(0),
         iCurBulkNodeEvent(0),
         iCurBulkEdgeEvent(0),
+        fAggregate(s_heapDumpAggregate),
+        cObjectsUntilSample(s_heapDumpAggregateSampleInterval),
+        pTypeStats(NULL),
+        cTypeStatsCapacity(0),
+        cTypeStats(0),
         bulkTypeEventLogger()
     {
         LIMITED_METHOD_CONTRACT;
@@ -582,6 +594,12 @@ public:
         ClearEdges();
     }
 
+    ~EtwGcHeapDumpContext()
+    {
+        LIMITED_METHOD_CONTRACT;
+        delete [] pTypeStats;
+    }
+
     // These helpers clear the individual buffers, for use after a flush and on
     // construction.  They intentionally leave the indices (iCur*) alone, since they
     // persist across flushes within a GC
@@ -703,6 +721,99 @@ public:
     EventStructGCBulkEdgeValue rgGcBulkEdgeValues[(cbMaxEtwEvent - 0x100) / sizeof(EventStructGCBulkEdgeValue)];
 
 
+    //---------------------------------------------------------------------------------------
+    // GCBulkTypeStats
+    //
+    // In an aggregated heap dump (ETW_GCHeapDumpAggregate), objects are counted and sized
+    // per type and generation instead of being sent as GCBulkNode / GCBulkEdge values.
+    // Every Nth object (ETW_GCHeapDumpAggregateSampleInterval) is still sent as a node
+    // with its edges, so consumers can sample what the aggregated types reference. The
+    // stats are sent at the end of the heap dump.
+    //
+    //---------------------------------------------------------------------------------------
+
+    BOOL fAggregate;
+
+    // Number of objects left until the next one is sent as a node, 0 if none are sampled
+    DWORD cObjectsUntilSample;
+
+    // Open addressed hash table of the stats, keyed by TypeID and Generation. Unused
+    // entries have an ObjectCount of 0.
+    EventStructGCBulkTypeStatsValue* pTypeStats;
+    UINT cTypeStatsCapacity;
+    UINT cTypeStats;
+
+    // Returns the stats entry for the type and generation, adding an entry with an
+    // ObjectCount of 0 if there is none. Returns NULL if the table can't grow.
+    EventStructGCBulkTypeStatsValue* GetOrAddTypeStats(ULONGLONG typeID, ULONG generation)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        // Keep the table at most 3/4 full so probe sequences stay short
+        if ((cTypeStats + 1) * 4 > cTypeStatsCapacity * 3)
+        {
+            GrowTypeStats();
+
+            if (cTypeStats == cTypeStatsCapacity)
+                return NULL;
+        }
+
+        UINT mask = cTypeStatsCapacity - 1;
+        for (UINT i = HashTypeStats(typeID, generation) & mask; ; i = (i + 1) & mask)
+        {
+            EventStructGCBulkTypeStatsValue* pEntry = &pTypeStats[i];
+            if (pEntry->ObjectCount == 0)
+            {
+                pEntry->TypeID = typeID;
+                pEntry->Generation = generation;
+                cTypeStats++;
+                return pEntry;
+            }
+
+            if ((pEntry->TypeID == typeID) && (pEntry->Generation == generation))
+                return pEntry;
+        }
+    }
+
+private:
+    static UINT HashTypeStats(ULONGLONG typeID, ULONG generation)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (UINT)((((typeID >> 3) ^ ((ULONGLONG)generation << 56)) * 0x9E3779B97F4A7C15ULL) >> 32);
+    }
+
+    void GrowTypeStats()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        UINT cNewCapacity = (cTypeStatsCapacity == 0) ? 1024 : (cTypeStatsCapacity * 2);
+        EventStructGCBulkTypeStatsValue* pNewTypeStats = new (nothrow) EventStructGCBulkTypeStatsValue[cNewCapacity];
+        if (pNewTypeStats == NULL)
+            return;
+
+        ZeroMemory(pNewTypeStats, cNewCapacity * sizeof(pNewTypeStats[0]));
+
+        UINT mask = cNewCapacity - 1;
+        for (UINT i = 0; i < cTypeStatsCapacity; i++)
+        {
+            if (pTypeStats[i].ObjectCount == 0)
+                continue;
+
+            UINT j = HashTypeStats(pTypeStats[i].TypeID, pTypeStats[i].Generation) & mask;
+            while (pNewTypeStats[j].ObjectCount != 0)
+                j = (j + 1) & mask;
+
+            pNewTypeStats[j] = pTypeStats[i];
+        }
+
+        delete [] pTypeStats;
+        pTypeStats = pNewTypeStats;
+        cTypeStatsCapacity = cNewCapacity;
+    }
+
+public:
+
+
     //---------------------------------------------------------------------------------------
     // BulkType
     //
@@ -871,6 +982,43 @@ VOID ETW::GCLog::ObjectReference(
     if (pContext == NULL)
         return;
 
+    //---------------------------------------------------------------------------------------
+    //    GCBulkTypeStats events
+    //---------------------------------------------------------------------------------------
+
+    if (pContext->fAggregate)
+    {
+        ULONG generation = GCHeapUtilities::GetGCHeap()->WhichGeneration(pObjReferenceSource);
+        EventStructGCBulkTypeStatsValue* pTypeStatsValue = pContext->GetOrAddTypeStats(typeID, generation);
+        if (pTypeStatsValue != NULL)
+        {
+            if (pTypeStatsValue->ObjectCount == 0)
+            {
+                // Remember one instance, so the type can be found among the roots and
+                // the sampled nodes
+                pTypeStatsValue->SampleAddress = pObjReferenceSource;
+
+                if (typeID != 0)
+                {
+                    ETW::TypeSystemLog::LogTypeAndParametersIfNecessary(
+                        &pContext->bulkTypeEventLogger,
+                        typeID,
+                        ETW::TypeSystemLog::kTypeLogBehaviorTakeLockAndLogIfFirstTime
+                        );
+                }
+            }
+
+            pTypeStatsValue->ObjectCount++;
+            pTypeStatsValue->TotalSize += pObjReferenceSource->GetSize();
+        }
+
+        // Only the sampled objects are sent as nodes
+        if ((pContext->cObjectsUntilSample == 0) || (--pContext->cObjectsUntilSample != 0))
+            return;
+
+        pContext->cObjectsUntilSample = s_heapDumpAggregateSampleInterval;
+    }
+
     //---------------------------------------------------------------------------------------
     //    GCBulkNode events
     //---------------------------------------------------------------------------------------
@@ -1015,6 +1163,34 @@ VOID ETW::GCLog::EndHeapDump(ProfilerWalkHeapContext* profilerWalkHeapContext)
                 sizeof(pContext->rgGcBulkEdgeValues[0]),
                 &pContext->rgGcBulkEdgeValues[0]);
         }
+
+        if (pContext->cTypeStats > 0)
+        {
+            // The heap walk is done with the table, so pack the used entries to the front
+            // and send them straight from there
+            UINT cTypeStats = 0;
+            for (UINT i = 0; i < pContext->cTypeStatsCapacity; i++)
+            {
+                if (pContext->pTypeStats[i].ObjectCount != 0)
+                    pContext->pTypeStats[cTypeStats++] = pContext->pTypeStats[i];
+            }
+            _ASSERTE(cTypeStats == pContext->cTypeStats);
+
+            const UINT cMaxTypeStatsPerEvent = (cbMaxEtwEvent - 0x100) / sizeof(EventStructGCBulkTypeStatsValue);
+            UINT iCurBulkTypeStatsEvent = 0;
+            for (UINT i = 0; i < cTypeStats; i += cMaxTypeStatsPerEvent)
+            {
+                UINT cValues = min(cTypeStats - i, cMaxTypeStatsPerEvent);
+                FireEtwGCBulkTypeStats(
+                    iCurBulkTypeStatsEvent,
+                    cValues,
+                    GetClrInstanceId(),
+                    sizeof(pContext->pTypeStats[0]),
+                    &pContext->pTypeStats[i]);
+
+                iCurBulkTypeStatsEvent++;
+            }
+        }
     }
 
     // Ditto for type events
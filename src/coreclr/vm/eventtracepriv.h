@@ -63,6 +63,15 @@ struct EventStructGCBulkEdgeValue
     ULONG ReferencingFieldID;
 };
 
+struct EventStructGCBulkTypeStatsValue
+{
+    ULONGLONG TypeID;
+    ULONG Generation;
+    ULONGLONG ObjectCount;
+    ULONGLONG TotalSize;
+    LPVOID SampleAddress;
+};
+
 struct EventStructGCBulkSurvivingObjectRangesValue
 {
     LPVOID RangeBase;
@@ -9,6 +9,7 @@
 #include "jithost.h"
 #include "genanalysis.h"
 #include "eventpipeadapter.h"
+#include "configuration.h"
 
 #ifdef FEATURE_COMINTEROP
 #include "runtimecallablewrapper.h"
@@ -31,11 +32,49 @@ CLREvent * FinalizerThread::hEventFinalizerToShutDown = NULL;
 
 HANDLE FinalizerThread::MHandles[kHandleCount];
 
+LONG FinalizerThread::cFinalizerHelpers = 0;
+LONG FinalizerThread::cFinalizerHelpersBusy = 0;
+CLREvent * FinalizerThread::hEventFinalizerHelpersDone = NULL;
+
+ULONGLONG FinalizerThread::PendingFinalizationTime = 0;
+
+namespace
+{
+    struct FinalizerHelper
+    {
+        Thread* pThread;
+        CLREvent hEventStart;
+        Volatile<bool> fStarted;
+        bool fBusy;
+    };
+
+    FinalizerHelper* s_pFinalizerHelpers = NULL;
+
+    // With helper threads, critical finalizers must not start before the non-critical
+    // finalizers that are still running on other threads are done.
+    bool s_fOrderCriticalFinalizers = false;
+    LONG s_cNonCriticalFinalizersRunning = 0;
+
+    thread_local bool t_fRunningNonCriticalFinalizer = false;
+    thread_local FinalizerHelper* t_pFinalizerHelper = NULL;
+
+    void ReleaseNonCriticalFinalizer()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        if (t_fRunningNonCriticalFinalizer)
+        {
+            t_fRunningNonCriticalFinalizer = false;
+            InterlockedDecrement(&s_cNonCriticalFinalizersRunning);
+        }
+    }
+}
+
 BOOL FinalizerThread::IsCurrentThreadFinalizer()
 {
     LIMITED_METHOD_CONTRACT;
 
-    return GetThreadNULLOk() == g_pFinalizerThread;
+    return GetThreadNULLOk() == g_pFinalizerThread || t_pFinalizerHelper != NULL;
 }
 
 void FinalizerThread::EnableFinalization()
@@ -94,13 +133,19 @@ OBJECTREF FinalizerThread::GetNextFinalizableObject()
     STATIC_CONTRACT_GC_TRIGGERS;
     STATIC_CONTRACT_MODE_COOPERATIVE;
 
+    // The finalizer this thread got last time has run
+    ReleaseNonCriticalFinalizer();
+
 Again:
     if (fQuitFinalizer)
         return NULL;
 
     OBJECTREF obj = ObjectToOBJECTREF(GCHeapUtilities::GetGCHeap()->GetNextFinalizable());
     if (obj == NULL)
+    {
+        InterlockedExchange64((LONG64*)&PendingFinalizationTime, 0);
         return NULL;
+    }
 
     MethodTable     *pMT = obj->GetMethodTable();
     STRESS_LOG2(LF_GC, LL_INFO1000, "Finalizing object %p MT %pT\n", OBJECTREFToObject(obj), pMT);
@@ -153,9 +198,52 @@ Again:
         goto Again;
     }
 
+    if (s_fOrderCriticalFinalizers)
+    {
+        if (!pMT->HasCriticalFinalizer())
+        {
+            t_fRunningNonCriticalFinalizer = true;
+            InterlockedIncrement(&s_cNonCriticalFinalizersRunning);
+        }
+        else if (VolatileLoad(&s_cNonCriticalFinalizersRunning) != 0)
+        {
+            // The GC only hands out critical finalizers once all the other ones are dequeued,
+            // wait for the ones other threads are still running.
+            GCPROTECT_BEGIN(obj);
+            {
+                GCX_PREEMP();
+
+                DWORD dwSwitchCount = 0;
+                while (VolatileLoad(&s_cNonCriticalFinalizersRunning) != 0)
+                {
+                    __SwitchToThread(0, ++dwSwitchCount);
+                }
+            }
+            GCPROTECT_END();
+        }
+    }
+
     return obj;
 }
 
+void FinalizerThread::FinalizersQueued()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    InterlockedCompareExchange64((LONG64*)&PendingFinalizationTime, (LONG64)CLRGetTickCount64(), 0);
+}
+
+void FinalizerThread::GetFinalizationQueueInfo(UINT64* pLength, UINT64* pLagMs)
+{
+    WRAPPER_NO_CONTRACT;
+
+    *pLength = GCHeapUtilities::GetGCHeap()->GetNumberOfFinalizable();
+
+    ULONGLONG pendingSince = (ULONGLONG)InterlockedCompareExchange64((LONG64*)&PendingFinalizationTime, 0, 0);
+    ULONGLONG now = CLRGetTickCount64();
+    *pLagMs = (pendingSince != 0 && now > pendingSince) ? now - pendingSince : 0;
+}
+
 void FinalizerThread::FinalizeAllObjects()
 {
     STATIC_CONTRACT_THROWS;
@@ -369,6 +457,7 @@ VOID FinalizerThread::FinalizerThreadWorker(void *args)
         {
             s_InitializedFinalizerThreadForPlatform = TRUE;
             Thread::InitializationForManagedThreadInNative(GetFinalizerThread());
+            CreateFinalizerHelperThreads();
         }
 
         JitHost::Reclaim();
@@ -404,7 +493,9 @@ VOID FinalizerThread::FinalizerThreadWorker(void *args)
         }
         LOG((LF_GC, LL_INFO100, "***** Calling Finalizers\n"));
 
+        StartFinalizerHelpers();
         FinalizeAllObjects();
+        WaitForFinalizerHelpers();
 
         // Anyone waiting to drain the Q can now wake up.  Note that there is a
         // race in that another thread starting a drain, as we leave a drain, may
@@ -459,6 +550,8 @@ DWORD WINAPI FinalizerThread::FinalizerThreadStart(void *args)
                 // If we came out on an exception, then we probably lost the signal that
                 // there are objects in the queue ready to finalize.  The safest thing is
                 // to reenable finalization.
+                ReleaseNonCriticalFinalizer();
+                WaitForFinalizerHelpers();
                 if (!fQuitFinalizer)
                     EnableFinalization();
             }
@@ -491,6 +584,221 @@ DWORD WINAPI FinalizerThread::FinalizerThreadStart(void *args)
     return 0;
 }
 
+// The finalizer helper threads only run finalizers, the finalizer thread hands
+// them a share of each pass and waits for them to be done with it.
+VOID FinalizerThread::FinalizerHelperThreadWorker(void *args)
+{
+    SCAN_IGNORE_THROW;
+    SCAN_IGNORE_TRIGGER;
+
+    Thread* pThread = GetThread();
+    FinalizerHelper* pHelper = t_pFinalizerHelper;
+
+    while (!fQuitFinalizer)
+    {
+        _ASSERTE(pThread->PreemptiveGCDisabled());
+        pThread->EnablePreemptiveGC();
+
+        pHelper->hEventStart.Wait(INFINITE, FALSE);
+
+        pThread->DisablePreemptiveGC();
+
+        pHelper->fBusy = true;
+        FinalizeAllObjects();
+        pHelper->fBusy = false;
+
+        FinalizerHelperDone();
+    }
+}
+
+DWORD WINAPI FinalizerThread::FinalizerHelperThreadStart(void *args)
+{
+    SCAN_IGNORE_THROW;
+    SCAN_IGNORE_TRIGGER;
+
+    FinalizerHelper* pHelper = (FinalizerHelper*)args;
+    Thread* pThread = pHelper->pThread;
+
+    if (!pThread->HasStarted())
+    {
+        return 0;
+    }
+
+    _ASSERTE(GetThread() == pThread);
+    t_pFinalizerHelper = pHelper;
+    pHelper->fStarted = true;
+
+    INSTALL_UNHANDLED_MANAGED_EXCEPTION_TRAP;
+    {
+        while (!fQuitFinalizer)
+        {
+            ManagedThreadBase::FinalizerBase(FinalizerHelperThreadWorker);
+
+            // We came out on an exception, the finalizer thread is still waiting for us
+            ReleaseNonCriticalFinalizer();
+            if (pHelper->fBusy)
+            {
+                pHelper->fBusy = false;
+                FinalizerHelperDone();
+            }
+        }
+    }
+    UNINSTALL_UNHANDLED_MANAGED_EXCEPTION_TRAP;
+
+    GCX_PREEMP_NO_DTOR();
+
+    DestroyThread(pThread);
+    return 0;
+}
+
+// Creates the helper threads requested with System.GC.FinalizerThreadCount. A service
+// that frees many finalizable objects can outpace a single finalizer thread, and the
+// objects waiting in the queue keep everything they reference alive.
+void FinalizerThread::CreateFinalizerHelperThreads()
+{
+    CONTRACTL{
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    } CONTRACTL_END;
+
+    DWORD threadCount = Configuration::GetKnobDWORDValue(W("System.GC.FinalizerThreadCount"), CLRConfig::EXTERNAL_FinalizerThreadCount);
+    DWORD processorCount = (DWORD)GetCurrentProcessCpuCount();
+    if (threadCount > processorCount)
+    {
+        threadCount = processorCount;
+    }
+
+    if (threadCount <= 1)
+    {
+        return;
+    }
+
+    DWORD helperCount = threadCount - 1;
+    bool fAllocated = false;
+
+    EX_TRY
+    {
+        hEventFinalizerHelpersDone = new CLREvent();
+        hEventFinalizerHelpersDone->CreateManualEvent(FALSE);
+        s_pFinalizerHelpers = new FinalizerHelper[helperCount];
+        fAllocated = true;
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    if (!fAllocated)
+    {
+        return;
+    }
+
+    // Set before any helper can run a finalizer
+    s_fOrderCriticalFinalizers = true;
+
+    for (DWORD i = 0; i < helperCount; i++)
+    {
+        FinalizerHelper* pHelper = &s_pFinalizerHelpers[i];
+        pHelper->pThread = NULL;
+        pHelper->fStarted = false;
+        pHelper->fBusy = false;
+
+        bool fCreated = false;
+
+        EX_TRY
+        {
+            pHelper->hEventStart.CreateAutoEvent(FALSE);
+
+            Thread* pThread = SetupUnstartedThread();
+            _ASSERTE(pThread != NULL);
+#if defined(FEATURE_COMINTEROP_APARTMENT_SUPPORT) && !defined(FEATURE_COMINTEROP)
+            pThread->SetApartment(Thread::AS_InMTA);
+#endif // FEATURE_COMINTEROP_APARTMENT_SUPPORT && !FEATURE_COMINTEROP
+            pThread->SetBackground(TRUE);
+            pHelper->pThread = pThread;
+
+            if (!pThread->CreateNewThread(0, &FinalizerHelperThreadStart, pHelper, W(".NET Finalizer Helper")))
+            {
+                pThread->DecExternalCount(FALSE);
+                ThrowOutOfMemory();
+            }
+
+            pThread->StartThread();
+            fCreated = true;
+        }
+        EX_CATCH
+        {
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+
+        if (!fCreated)
+        {
+            // Keep going with the helpers we have
+            break;
+        }
+
+        cFinalizerHelpers++;
+    }
+
+    LOG((LF_GC, LL_INFO10, "Created %d finalizer helper threads\n", cFinalizerHelpers));
+}
+
+void FinalizerThread::StartFinalizerHelpers()
+{
+    WRAPPER_NO_CONTRACT;
+
+    // Helpers that haven't started yet join a later pass
+    LONG cStarted = 0;
+    for (LONG i = 0; i < cFinalizerHelpers; i++)
+    {
+        if (s_pFinalizerHelpers[i].fStarted)
+        {
+            cStarted++;
+        }
+    }
+
+    if (cStarted == 0)
+    {
+        return;
+    }
+
+    hEventFinalizerHelpersDone->Reset();
+    VolatileStore(&cFinalizerHelpersBusy, cStarted);
+
+    for (LONG i = 0; i < cFinalizerHelpers && cStarted > 0; i++)
+    {
+        if (s_pFinalizerHelpers[i].fStarted)
+        {
+            s_pFinalizerHelpers[i].hEventStart.Set();
+            cStarted--;
+        }
+    }
+}
+
+void FinalizerThread::WaitForFinalizerHelpers()
+{
+    WRAPPER_NO_CONTRACT;
+
+    if (VolatileLoad(&cFinalizerHelpersBusy) == 0)
+    {
+        return;
+    }
+
+    GCX_PREEMP();
+    hEventFinalizerHelpersDone->Wait(INFINITE, FALSE);
+}
+
+void FinalizerThread::FinalizerHelperDone()
+{
+    WRAPPER_NO_CONTRACT;
+
+    if (InterlockedDecrement(&cFinalizerHelpersBusy) == 0)
+    {
+        hEventFinalizerHelpersDone->Set();
+    }
+}
+
 void FinalizerThread::FinalizerThreadCreate()
 {
     CONTRACTL{
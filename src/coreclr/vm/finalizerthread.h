@@ -30,10 +30,24 @@ class FinalizerThread
 
     static HANDLE MHandles[kHandleCount];
 
+    // Optional helper threads that drain the finalization queue together with the
+    // finalizer thread, see CreateFinalizerHelperThreads.
+    static LONG cFinalizerHelpers;
+    static LONG cFinalizerHelpersBusy;
+    static CLREvent *hEventFinalizerHelpersDone;
+
+    // Tick count of when the oldest pending finalizers were queued, 0 if none are pending
+    static ULONGLONG PendingFinalizationTime;
+
     static void WaitForFinalizerEvent (CLREvent *event);
 
     static void FinalizeAllObjects();
 
+    static void CreateFinalizerHelperThreads();
+    static void StartFinalizerHelpers();
+    static void WaitForFinalizerHelpers();
+    static void FinalizerHelperDone();
+
 public:
     static Thread* GetFinalizerThread()
     {
@@ -50,6 +64,13 @@ public:
 
     static OBJECTREF GetNextFinalizableObject();
 
+    // Called when a GC found objects to finalize
+    static void FinalizersQueued();
+
+    // Number of objects waiting to be finalized and how long the oldest of them
+    // have been waiting, in milliseconds
+    static void GetFinalizationQueueInfo(UINT64* pLength, UINT64* pLagMs);
+
     static void RaiseShutdownEvents()
     {
         WRAPPER_NO_CONTRACT;
@@ -75,6 +96,9 @@ public:
     static VOID FinalizerThreadWorker(void *args);
     static DWORD WINAPI FinalizerThreadStart(void *args);
 
+    static VOID FinalizerHelperThreadWorker(void *args);
+    static DWORD WINAPI FinalizerHelperThreadStart(void *args);
+
     static void FinalizerThreadCreate();
 };
 
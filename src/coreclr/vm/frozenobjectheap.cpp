@@ -12,13 +12,15 @@
 FrozenObjectHeapManager::FrozenObjectHeapManager():
     m_Crst(CrstFrozenObjectHeap, CRST_UNSAFE_ANYMODE),
     m_SegmentRegistrationCrst(CrstFrozenObjectHeap),
-    m_CurrentSegment(nullptr)
+    m_CurrentSegment(nullptr),
+    m_MaxObjectSize(max((size_t)FOH_COMMIT_SIZE, (size_t)CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_FrozenObjectHeapMaxObjectSize)))
 {
 }
 
 // Allocates an object of the give size (including header) on a frozen segment.
-// May return nullptr if object is too large (larger than FOH_COMMIT_SIZE)
-// in such cases caller is responsible to find a more appropriate heap to allocate it
+// May return nullptr if object is too large (larger than m_MaxObjectSize) or if no segment large
+// enough to hold it could be reserved, in such cases caller is responsible to find a more appropriate
+// heap to allocate it
 
 Object* FrozenObjectHeapManager::TryAllocateObject(PTR_MethodTable type, size_t objectSize,
     void(*initFunc)(Object*, void*), void* pParam)
@@ -63,10 +65,10 @@ Object* FrozenObjectHeapManager::TryAllocateObject(PTR_MethodTable type, size_t
             // NOTE: objectSize is expected be the full size including header
             _ASSERT(objectSize >= MIN_OBJECT_SIZE);
 
-            if (objectSize > FOH_COMMIT_SIZE)
+            if (objectSize > m_MaxObjectSize)
             {
-                // The current design doesn't allow objects larger than FOH_COMMIT_SIZE and
-                // since FrozenObjectHeap is just an optimization, let's not fill it with huge objects.
+                // FrozenObjectHeap is just an optimization, let's not fill it with huge objects
+                // unless we were explicitly asked to.
                 return nullptr;
             }
 
@@ -83,14 +85,22 @@ Object* FrozenObjectHeapManager::TryAllocateObject(PTR_MethodTable type, size_t
                     newSegmentSize = max(prevSegmentSize, prevSegmentSize * 2);
                 }
 
+                // Make sure the new segment can hold this object, including the header of the next one.
+                newSegmentSize = max(newSegmentSize, ALIGN_UP(objectSize + 2 * sizeof(ObjHeader), FOH_COMMIT_SIZE));
+
                 m_CurrentSegment = new FrozenObjectSegment(newSegmentSize);
                 m_FrozenSegments.Append(m_CurrentSegment);
 
                 // Try again
                 obj = m_CurrentSegment->TryAllocateObject(type, objectSize);
 
-                // This time it's not expected to be null
-                _ASSERT(obj != nullptr);
+                if (obj == nullptr)
+                {
+                    // The segment may have been reserved with the default size under memory pressure,
+                    // which only guarantees room for objects up to FOH_COMMIT_SIZE.
+                    _ASSERT(objectSize > FOH_COMMIT_SIZE);
+                    return nullptr;
+                }
             }
 
             if (initFunc != nullptr)
@@ -215,7 +225,6 @@ Object* FrozenObjectSegment::TryAllocateObject(PTR_MethodTable type, size_t obje
     _ASSERT((m_pStart != nullptr) && (m_Size > 0));
     _ASSERT(IS_ALIGNED(m_pCurrent, DATA_ALIGNMENT));
     _ASSERT(IS_ALIGNED(objectSize, DATA_ALIGNMENT));
-    _ASSERT(objectSize <= FOH_COMMIT_SIZE);
     _ASSERT(m_pCurrent >= m_pStart + sizeof(ObjHeader));
 
     const size_t spaceUsed = (size_t)(m_pCurrent - m_pStart);
@@ -230,17 +239,19 @@ Object* FrozenObjectSegment::TryAllocateObject(PTR_MethodTable type, size_t obje
         return nullptr;
     }
 
-    // Check if we need to commit a new chunk
+    // Check if we need to commit more chunks, objects larger than FOH_COMMIT_SIZE may need several
     if (spaceUsed + objectSize + sizeof(ObjHeader) > m_SizeCommitted)
     {
+        const size_t sizeToCommit = ALIGN_UP(spaceUsed + objectSize + sizeof(ObjHeader) - m_SizeCommitted, FOH_COMMIT_SIZE);
+
         // Make sure we don't go out of bounds during this commit
-        _ASSERT(m_SizeCommitted + FOH_COMMIT_SIZE <= m_Size);
+        _ASSERT(m_SizeCommitted + sizeToCommit <= m_Size);
 
-        if (ClrVirtualAlloc(m_pStart + m_SizeCommitted, FOH_COMMIT_SIZE, MEM_COMMIT, PAGE_READWRITE) == nullptr)
+        if (ClrVirtualAlloc(m_pStart + m_SizeCommitted, sizeToCommit, MEM_COMMIT, PAGE_READWRITE) == nullptr)
         {
             ThrowOutOfMemory();
         }
-        m_SizeCommitted += FOH_COMMIT_SIZE;
+        m_SizeCommitted += sizeToCommit;
     }
 
     Object* object = reinterpret_cast<Object*>(m_pCurrent);
@@ -36,6 +36,9 @@ private:
     SArray<FrozenObjectSegment*> m_FrozenSegments;
     FrozenObjectSegment* m_CurrentSegment;
 
+    // Largest object (including header) we accept, see FrozenObjectHeapMaxObjectSize
+    size_t m_MaxObjectSize;
+
     friend class ProfilerObjectEnum;
     friend class ProfToEEInterfaceImpl;
 };
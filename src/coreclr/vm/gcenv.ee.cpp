@@ -72,6 +72,18 @@ VOID GCToEEInterface::SyncBlockCacheWeakPtrScan(HANDLESCANPROC scanProc, uintptr
     SyncBlockCache::GetSyncBlockCache()->GCWeakPtrScan(scanProc, lp1, lp2);
 }
 
+VOID GCToEEInterface::SyncBlockCacheWeakPtrScanPartition(HANDLESCANPROC scanProc, uintptr_t lp1, uintptr_t lp2)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    SyncBlockCache::GetSyncBlockCache()->GCWeakPtrScanPartition(scanProc, lp1, lp2);
+}
+
 void GCToEEInterface::BeforeGcScanRoots(int condemned, bool is_bgc, bool is_concurrent)
 {
     CONTRACTL
@@ -348,6 +360,8 @@ void GCToEEInterface::GcStartWork (int condemned, int max_gen)
     ETW::TypeSystemLog::Cleanup();
 #endif
 
+    PretenuringTracker::OnGCStart();
+
     Interop::OnGCStarted(condemned);
 
     if (condemned == max_gen)
@@ -398,6 +412,32 @@ bool GCToEEInterface::RefCountedHandleCallbacks(Object * pObject)
     return false;
 }
 
+void GCToEEInterface::RefCountedHandleCallbacksBatch(Object** objects, bool* promote, size_t count)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        Object* pObject = objects[i];
+
+        // COM, ComWrappers and Objective-C wrappers all hang off the interop info of
+        // the sync block, so most objects can be rejected without asking each of them.
+        SyncBlock* pSyncBlock = pObject->PassiveGetSyncBlock();
+        if (pSyncBlock == NULL || pSyncBlock->GetInteropInfoNoCreate() == NULL)
+        {
+            promote[i] = false;
+            continue;
+        }
+
+        promote[i] = RefCountedHandleCallbacks(pObject);
+    }
+}
+
 void GCToEEInterface::SyncBlockCacheDemote(int max_gen)
 {
     CONTRACTL
@@ -1123,6 +1163,11 @@ void GCToEEInterface::StompWriteBarrier(WriteBarrierParameters* args)
 
 void GCToEEInterface::EnableFinalization(bool gcHasWorkForFinalizerThread)
 {
+    if (gcHasWorkForFinalizerThread)
+    {
+        FinalizerThread::FinalizersQueued();
+    }
+
     if (gcHasWorkForFinalizerThread || FinalizerThread::HaveExtraWorkForFinalizer())
     {
         FinalizerThread::EnableFinalization();
@@ -339,6 +339,12 @@ void PublishObjectAndNotify(TObj* &orObject, GC_ALLOC_FLAGS flags)
     {
         ETW::TypeSystemLog::SendObjectAllocatedEvent(orObject);
     }
+
+    if (ETW::TypeSystemLog::IsAllocationSamplingEnabled())
+    {
+        UINT32 allocationKind = (flags & GC_ALLOC_LARGE_OBJECT_HEAP) ? 1 : ((flags & GC_ALLOC_PINNED_OBJECT_HEAP) ? 2 : 0);
+        ETW::TypeSystemLog::SampleObjectAllocation(orObject, allocationKind);
+    }
 #endif // FEATURE_EVENT_TRACE
 }
 
@@ -1092,6 +1098,16 @@ OBJECTREF AllocateObject(MethodTable *pMT
         }
 #endif // FEATURE_64BIT_ALIGNMENT
 
+        // The LOH doesn't support the biased headers of align8 boxed value types
+        bool sampleForPretenuring = false;
+        if (PretenuringTracker::IsEnabled() && !(flags & (GC_ALLOC_USER_OLD_HEAP | GC_ALLOC_ALIGN8_BIAS)))
+        {
+            if (pMT->IsPretenured())
+                flags |= GC_ALLOC_PRETENURED;
+            else
+                sampleForPretenuring = !pMT->Collectible();
+        }
+
         Object* orObject = (Object*)Alloc(totalSize, flags);
 
         if (flags & GC_ALLOC_USER_OLD_HEAP)
@@ -1103,6 +1119,11 @@ OBJECTREF AllocateObject(MethodTable *pMT
             orObject->SetMethodTable(pMT);
         }
 
+        if (sampleForPretenuring)
+        {
+            PretenuringTracker::SampleAllocation(orObject);
+        }
+
         PublishObjectAndNotify(orObject, flags);
         oref = OBJECTREF_TO_UNCHECKED_OBJECTREF(orObject);
     }
@@ -1110,6 +1131,140 @@ OBJECTREF AllocateObject(MethodTable *pMT
     return UNCHECKED_OBJECTREF_TO_OBJECTREF(oref);
 }
 
+//========================================================================
+//
+//      PRETENURING
+//
+//========================================================================
+
+bool PretenuringTracker::s_enabled = false;
+DWORD PretenuringTracker::s_sampleInterval = 0;
+DWORD PretenuringTracker::s_allocCount = 0;
+DWORD PretenuringTracker::s_nextSample = 0;
+PretenuringTracker::Sample PretenuringTracker::s_samples[NUM_SAMPLES];
+PretenuringTracker::TypeStats PretenuringTracker::s_typeStats[NUM_TYPES];
+
+void PretenuringTracker::Init()
+{
+    STANDARD_VM_CONTRACT;
+
+    s_enabled = (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_GCPretenuring) != 0);
+    s_sampleInterval = max(CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_GCPretenuringSampleInterval), (DWORD)1);
+}
+
+void PretenuringTracker::SampleAllocation(Object* pObject)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    // Racy on purpose, losing an increment only shifts the sampling a bit
+    if ((++s_allocCount % s_sampleInterval) != 0)
+        return;
+
+    MethodTable* pMT = pObject->GetMethodTable();
+    Sample* pSample = &s_samples[(s_nextSample++) % NUM_SAMPLES];
+
+    // A slot still in use is skipped rather than waited for
+    if (InterlockedCompareExchangeT(&pSample->pMT, pMT, (MethodTable*)NULL) != NULL)
+        return;
+
+    // Nothing below can trigger a GC, so OnGCStart never sees a slot that is only half set up
+    if (pSample->handle == NULL)
+    {
+        pSample->handle = GCHandleUtilities::GetGCHandleManager()->GetGlobalHandleStore()->CreateHandleOfType(pObject, HNDTYPE_WEAK_SHORT);
+        if (pSample->handle == NULL)
+        {
+            VolatileStore(&pSample->pMT, (MethodTable*)NULL);
+        }
+    }
+    else
+    {
+        StoreObjectInHandle(pSample->handle, ObjectToOBJECTREF(pObject));
+    }
+}
+
+void PretenuringTracker::OnGCStart()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    if (!s_enabled)
+        return;
+
+    IGCHeap* pHeap = GCHeapUtilities::GetGCHeap();
+    unsigned maxGeneration = pHeap->GetMaxGeneration();
+
+    for (int i = 0; i < NUM_SAMPLES; i++)
+    {
+        Sample* pSample = &s_samples[i];
+        if (pSample->pMT == NULL)
+            continue;
+
+        // Samples still in gen0 or gen1 are looked at again at the next GC. The handle is left
+        // holding a dead or old object when the slot is freed, it's weak so that's harmless.
+        Object* pObject = *(Object**)pSample->handle;
+        if (pObject == NULL)
+        {
+            RecordSample(pSample->pMT, false);
+            pSample->pMT = NULL;
+        }
+        else if (pHeap->WhichGeneration(pObject) >= maxGeneration)
+        {
+            RecordSample(pSample->pMT, true);
+            pSample->pMT = NULL;
+        }
+    }
+}
+
+void PretenuringTracker::RecordSample(MethodTable* pMT, bool survived)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Open addressing, types that don't fit once the table is full are simply not tracked
+    size_t start = ((size_t)pMT >> 4) % NUM_TYPES;
+    for (size_t probe = 0; probe < NUM_TYPES; probe++)
+    {
+        TypeStats* pStats = &s_typeStats[(start + probe) % NUM_TYPES];
+        if (pStats->pMT == NULL)
+        {
+            pStats->pMT = pMT;
+        }
+        else if (pStats->pMT != pMT)
+        {
+            continue;
+        }
+
+        pStats->decided++;
+        if (survived)
+            pStats->survived++;
+
+        if ((pStats->decided >= MIN_DECIDED_SAMPLES) &&
+            (pStats->survived * 100 >= pStats->decided * PRETENURE_SURVIVAL_PERCENT))
+        {
+            STRESS_LOG3(LF_GC, LL_INFO100, "Pretenuring MT %p, %u of %u samples reached gen2\n",
+                pMT, pStats->survived, pStats->decided);
+            pMT->SetIsPretenured();
+        }
+
+        // Keep adapting to recent behavior
+        if (pStats->decided >= 1024)
+        {
+            pStats->decided /= 2;
+            pStats->survived /= 2;
+        }
+        return;
+    }
+}
+
 OBJECTREF TryAllocateFrozenObject(MethodTable* pObjMT)
 {
     CONTRACTL {
@@ -90,4 +90,64 @@ void ErectWriteBarrier(OBJECTREF* dst, OBJECTREF ref);
 
 void PublishFrozenObject(Object*& orObject);
 
+//========================================================================
+//
+//      PRETENURING
+//
+//========================================================================
+
+// Per-type pretenuring, enabled with DOTNET_GCPretenuring. One in every GCPretenuringSampleInterval
+// objects allocated through AllocateObject is tracked with a short weak handle. At the start of each
+// GC we check which of the sampled objects died and which made it to gen2, and types whose samples
+// almost always reach gen2 are marked pretenured. Their instances are then allocated with
+// GC_ALLOC_PRETENURED, which saves copying them through gen0 and gen1, and the JIT uses the slow
+// allocation helper for them so newly jitted code allocates them through AllocateObject too.
+class PretenuringTracker
+{
+public:
+    static void Init();
+
+    static bool IsEnabled()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return s_enabled;
+    }
+
+    // Called on the allocation path in cooperative mode
+    static void SampleAllocation(Object* pObject);
+
+    // Called with the EE suspended
+    static void OnGCStart();
+
+private:
+    static const int NUM_SAMPLES = 64;
+    static const int NUM_TYPES = 256;
+
+    // Samples that reached gen2 or died before a type is decided on
+    static const DWORD MIN_DECIDED_SAMPLES = 8;
+    static const DWORD PRETENURE_SURVIVAL_PERCENT = 90;
+
+    struct Sample
+    {
+        MethodTable* pMT;           // NULL when the slot is free
+        OBJECTHANDLE handle;        // created on first use and reused afterwards
+    };
+
+    struct TypeStats
+    {
+        MethodTable* pMT;
+        DWORD decided;
+        DWORD survived;
+    };
+
+    static bool s_enabled;
+    static DWORD s_sampleInterval;
+    static DWORD s_allocCount;
+    static DWORD s_nextSample;
+    static Sample s_samples[NUM_SAMPLES];
+    static TypeStats s_typeStats[NUM_TYPES];
+
+    static void RecordSample(MethodTable* pMT, bool survived);
+};
+
 #endif // _GCHELPERS_H_
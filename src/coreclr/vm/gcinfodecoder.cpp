@@ -70,6 +70,9 @@
     }
 #endif // !LOG_PIPTR
 
+// Number of live state bits decoded at once. BitStreamReader::Read can't consume a whole word.
+#define LIVE_STATE_BITS_PER_READ    (BITS_PER_SIZE_T / 2)
+
 bool GcInfoDecoder::SetIsInterruptibleCB (UINT32 startOffset, UINT32 stopOffset, void * hCallback)
 {
     GcInfoDecoder *pThis = (GcInfoDecoder*)hCallback;
@@ -892,19 +895,29 @@ bool GcInfoDecoder::EnumerateLiveSlots(
                 m_Reader.Skip(m_SafePointIndex * numSlots);
             }
 
-            for(UINT32 slotIndex = 0; slotIndex < numSlots; slotIndex++)
+            // Only a few slots are live at any given safepoint, so read the live state in
+            // multi-bit pieces and skip over the dead slots instead of reading bit by bit.
+            for(UINT32 slotIndex = 0; slotIndex < numSlots; slotIndex += LIVE_STATE_BITS_PER_READ)
             {
-                if(m_Reader.ReadOneFast())
+                UINT32 numBits = numSlots - slotIndex;
+                if (numBits > LIVE_STATE_BITS_PER_READ)
+                    numBits = LIVE_STATE_BITS_PER_READ;
+
+                size_t liveBits = m_Reader.Read(numBits);
+                for(UINT32 liveSlotIndex = slotIndex; liveBits != 0; liveSlotIndex++, liveBits >>= 1)
                 {
-                    ReportSlotToGC(
-                            slotDecoder,
-                            slotIndex,
-                            pRD,
-                            reportScratchSlots,
-                            inputFlags,
-                            pCallBack,
-                            hCallBack
-                            );
+                    if(liveBits & 1)
+                    {
+                        ReportSlotToGC(
+                                slotDecoder,
+                                liveSlotIndex,
+                                pRD,
+                                reportScratchSlots,
+                                inputFlags,
+                                pCallBack,
+                                hCallBack
+                                );
+                    }
                 }
             }
             goto ReportUntracked;
@@ -979,9 +992,13 @@ bool GcInfoDecoder::EnumerateLiveSlots(
             }
             else
             {
-                for(UINT32 i = 0; i < numSlots; i++)
+                for(UINT32 i = 0; i < numSlots; i += LIVE_STATE_BITS_PER_READ)
                 {
-                    if(m_Reader.ReadOneFast())
+                    UINT32 numBits = numSlots - i;
+                    if (numBits > LIVE_STATE_BITS_PER_READ)
+                        numBits = LIVE_STATE_BITS_PER_READ;
+
+                    for(size_t bits = m_Reader.Read(numBits); bits != 0; bits &= bits - 1)
                         numCouldBeLiveSlots++;
                 }
             }
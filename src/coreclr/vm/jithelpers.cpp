@@ -4379,7 +4379,7 @@ HCIMPLEND
 //
 // Returns the address of the jitted code.
 // Returns NULL if osr method can't be created.
-static PCODE JitPatchpointWorker(MethodDesc* pMD, EECodeInfo& codeInfo, int ilOffset)
+PCODE JitPatchpointWorker(MethodDesc* pMD, EECodeInfo& codeInfo, int ilOffset)
 {
     STANDARD_VM_CONTRACT;
     PCODE osrVariant = (PCODE)NULL;
@@ -4440,6 +4440,22 @@ HCIMPL3(PCODE, JIT_Patchpoint_Framed, MethodDesc* pMD, EECodeInfo& codeInfo, int
 }
 HCIMPLEND
 
+// Helper method wrapper to set up a frame so we can queue the OSR method creation
+HCIMPL4(BOOL, JIT_Patchpoint_ScheduleFramed, MethodDesc* pMD, EECodeInfo& codeInfo, int ilOffset, PerPatchpointInfo* ppInfo)
+{
+    BOOL result = FALSE;
+
+    HELPER_METHOD_FRAME_BEGIN_RET_0();
+
+    GCX_PREEMP();
+    result = OnStackReplacementManager::ScheduleBackgroundCompilation(pMD, codeInfo.GetStartAddress(), ilOffset, ppInfo);
+
+    HELPER_METHOD_FRAME_END();
+
+    return result;
+}
+HCIMPLEND
+
 // Jit helper invoked at a patchpoint.
 //
 // Checks to see if this is a known patchpoint, if not,
@@ -4502,7 +4518,7 @@ void JIT_Patchpoint(int* counter, int ilOffset)
     }
 
     // See if we have an OSR method for this patchpoint.
-    osrMethodCode = ppInfo->m_osrMethodCode;
+    osrMethodCode = VolatileLoad(&ppInfo->m_osrMethodCode);
 
     if (osrMethodCode == (PCODE)NULL)
     {
@@ -4588,20 +4604,31 @@ void JIT_Patchpoint(int* counter, int ilOffset)
 
         // Time to create the OSR method.
         //
-        // We currently do this synchronously. We could instead queue
-        // up a request on some worker thread, like we do for
-        // rejitting, and return control to the Tier0 method. It may
-        // eventually return here, if the patchpoint is hit often
-        // enough.
+        // By default we do this synchronously, to expose bugs in the
+        // jitted code for OSR methods. Optionally we instead queue up
+        // a request on a worker thread and return control to the
+        // Tier0 method, so a long running loop doesn't stall while
+        // the OSR method is jitted. The Tier0 method transitions the
+        // next time it hits this patchpoint after the method is
+        // available.
         //
         // There is a chance the async version will create methods
         // that are never used (just like there is a chance that Tier1
         // methods are ever called).
         //
-        // In this prototype we want to expose bugs in the jitted code
-        // for OSR methods, so we stick with synchronous creation.
+        // Pending requests outlive the Tier0 frame, so this is only
+        // done for methods that can't be collected.
         LOG((LF_TIEREDCOMPILATION, LL_INFO10, "Jit_Patchpoint: patchpoint [%d] (0x%p) TRIGGER at count %d\n", ppId, ip, hitCount));
 
+        if (g_pConfig->OSR_BackgroundCompilation() && !allocator->IsCollectible())
+        {
+            if (HCCALL4(JIT_Patchpoint_ScheduleFramed, pMD, codeInfo, ilOffset, ppInfo))
+            {
+                LOG((LF_TIEREDCOMPILATION, LL_INFO10, "Jit_Patchpoint: patchpoint [%d] (0x%p) QUEUED OSR method creation\n", ppId, ip));
+                goto DONE;
+            }
+        }
+
         // Invoke the helper to build the OSR method
         osrMethodCode = HCCALL3(JIT_Patchpoint_Framed, pMD, codeInfo, ilOffset);
 
@@ -58,11 +58,136 @@ void JitHost::freeStringConfigValue(const WCHAR* value)
 // - Keep up to some limit worth of memory, with loose affinization of memory blocks to threads.
 // - On finalizer thread, release the extra memory that was not used recently.
 //
+// In front of the shared lists, each thread keeps the slabs freed by its last compilations, up to the
+// peak amount the JIT used on that thread recently. A compilation frees all of its slabs at the end
+// and the next one on the same thread typically asks for the same sizes again, so most slab requests
+// never take the lock. The per-thread budget decays whenever the finalizer thread flushes the
+// shared lists; slabs over the new budget go back to the shared lists on the next slab request
+// from that thread. A thread that stops jitting would keep its slabs forever, so the finalizer
+// thread also frees the cache of every thread that did not request a slab for a whole flush period.
+//
+
+#define MAX_THREAD_SLAB_CACHE 0x100000 // Do not keep more than 1MB on any single thread
+
+thread_local JitHost::ThreadSlabCache JitHost::t_slabCache;
+
+JitHost::ThreadSlabCache::~ThreadSlabCache()
+{
+    if (registered)
+    {
+        // Once unlinked, reclaim() can't look at this cache anymore
+        CrstHolder lock(&s_theJitHost.m_jitSlabAllocatorCrst);
+
+        if (pPrevCache != NULL)
+            pPrevCache->pNextCache = pNextCache;
+        else
+            s_theJitHost.m_pThreadCaches = pNextCache;
+
+        if (pNextCache != NULL)
+            pNextCache->pPrevCache = pPrevCache;
+
+        registered = false;
+    }
+
+    // The thread is going away, nobody else can reuse these
+    for (Slab* p = pList; p != NULL; )
+    {
+        Slab* pNext = p->pNext;
+        delete [] (BYTE*)p;
+        p = pNext;
+    }
+
+    pList = NULL;
+    cached = 0;
+}
+
+// Returns the current thread's cache with its lock held, release it with VolatileStore(&pCache->lock, 0)
+JitHost::ThreadSlabCache* JitHost::lockThreadCache()
+{
+    ThreadSlabCache* pCache = &t_slabCache;
+
+    if (!pCache->registered)
+    {
+        CrstHolder lock(&m_jitSlabAllocatorCrst);
+
+        pCache->pPrevCache = NULL;
+        pCache->pNextCache = m_pThreadCaches;
+        if (m_pThreadCaches != NULL)
+            m_pThreadCaches->pPrevCache = pCache;
+        m_pThreadCaches = pCache;
+        pCache->registered = true;
+    }
+
+    // Only contended while reclaim() empties the cache, which is short
+    while (InterlockedCompareExchange(&pCache->lock, 1, 0) != 0)
+    {
+        YieldProcessor();
+    }
+
+    pCache->useEpoch = VolatileLoadWithoutBarrier(&m_trimEpoch);
+    return pCache;
+}
+
+void JitHost::trimThreadCache(ThreadSlabCache* pCache)
+{
+    DWORD trimEpoch = VolatileLoadWithoutBarrier(&m_trimEpoch);
+    if (pCache->trimEpoch == trimEpoch)
+        return;
+
+    pCache->trimEpoch = trimEpoch;
+    pCache->peakInUse = max(pCache->inUse, pCache->peakInUse / 2);
+
+    // Hand the slabs over the new budget to the shared lists so the finalizer thread can release
+    // them if they stay unused
+    while (pCache->pList != NULL && pCache->cached > pCache->peakInUse)
+    {
+        Slab* p = pCache->pList;
+        pCache->pList = p->pNext;
+        pCache->cached -= p->size;
+
+        freeSharedSlab(p, p->size);
+    }
+}
 
 void* JitHost::allocateSlab(size_t size, size_t* pActualSize)
 {
     size = max(size, sizeof(Slab));
 
+    ThreadSlabCache* pCache = lockThreadCache();
+    trimThreadCache(pCache);
+
+    for (Slab ** ppList = &pCache->pList; *ppList != NULL; ppList = &(*ppList)->pNext)
+    {
+        Slab* p = *ppList;
+        if (p->size >= size && p->size <= 4 * size) // Avoid wasting more than 4x memory
+        {
+            *ppList = p->pNext;
+            pCache->cached -= p->size;
+
+            pCache->inUse += p->size;
+            pCache->peakInUse = max(pCache->peakInUse, pCache->inUse);
+
+            VolatileStore(&pCache->lock, (LONG)0);
+
+            *pActualSize = p->size;
+            return p;
+        }
+    }
+
+    VolatileStore(&pCache->lock, (LONG)0);
+
+    void* pSlab = allocateSharedSlab(size, pActualSize);
+
+    pCache = lockThreadCache();
+    pCache->inUse += *pActualSize;
+    pCache->peakInUse = max(pCache->peakInUse, pCache->inUse);
+    VolatileStore(&pCache->lock, (LONG)0);
+
+    return pSlab;
+}
+
+void* JitHost::allocateSharedSlab(size_t size, size_t* pActualSize)
+{
     Thread* pCurrentThread = GetThreadNULLOk();
     if (m_pCurrentCachedList != NULL || m_pPreviousCachedList != NULL)
     {
@@ -114,6 +239,33 @@ void JitHost::freeSlab(void* slab, size_t actualSize)
 {
     _ASSERTE(actualSize >= sizeof(Slab));
 
+    ThreadSlabCache* pCache = lockThreadCache();
+
+    // Slabs may be freed on a different thread than the one that allocated them
+    pCache->inUse -= min(pCache->inUse, actualSize);
+
+    trimThreadCache(pCache);
+
+    if (g_pConfig->JitHostMaxSlabCache() != 0 &&
+        pCache->cached + actualSize <= min(pCache->peakInUse, (size_t)MAX_THREAD_SLAB_CACHE))
+    {
+        Slab* pSlab = (Slab*)slab;
+        pSlab->size = actualSize;
+        pSlab->affinity = GetThreadNULLOk();
+        pSlab->pNext = pCache->pList;
+        pCache->pList = pSlab;
+        pCache->cached += actualSize;
+        VolatileStore(&pCache->lock, (LONG)0);
+        return;
+    }
+
+    VolatileStore(&pCache->lock, (LONG)0);
+
+    freeSharedSlab(slab, actualSize);
+}
+
+void JitHost::freeSharedSlab(void* slab, size_t actualSize)
+{
     if (actualSize < 0x100000) // Do not cache blocks that are more than 1MB
     {
         CrstHolder lock(&m_jitSlabAllocatorCrst);
@@ -141,20 +293,25 @@ void JitHost::init()
 
 void JitHost::reclaim()
 {
-    if (m_pCurrentCachedList != NULL || m_pPreviousCachedList != NULL)
+    DWORD ticks = ::GetTickCount();
+
+    if (m_lastFlush == 0) // Just update m_lastFlush first time around
     {
-        DWORD ticks = ::GetTickCount();
+        m_lastFlush = ticks;
+        return;
+    }
 
-        if (m_lastFlush == 0) // Just update m_lastFlush first time around
-        {
-            m_lastFlush = ticks;
-            return;
-        }
+    if ((DWORD)(ticks - m_lastFlush) < 2000) // Flush the free lists every 2 seconds
+        return;
+    m_lastFlush = ticks;
 
-        if ((DWORD)(ticks - m_lastFlush) < 2000) // Flush the free lists every 2 seconds
-            return;
-        m_lastFlush = ticks;
+    // Ask the threads to shrink their caches towards what they used recently
+    VolatileStore(&m_trimEpoch, m_trimEpoch + 1);
+
+    reclaimIdleThreadCaches();
 
+    if (m_pCurrentCachedList != NULL || m_pPreviousCachedList != NULL)
+    {
         // Flush all slabs in m_pPreviousCachedList
         for (;;)
         {
@@ -178,4 +335,44 @@ void JitHost::reclaim()
     }
 }
 
+// Frees the caches of the threads that did not use them since before the previous flush, they
+// would not trim them themselves until they jit again.
+void JitHost::reclaimIdleThreadCaches()
+{
+    Slab* slabsToDelete = NULL;
+
+    {
+        CrstHolder lock(&m_jitSlabAllocatorCrst);
+
+        for (ThreadSlabCache* pCache = m_pThreadCaches; pCache != NULL; pCache = pCache->pNextCache)
+        {
+            if (pCache->pList == NULL || (DWORD)(m_trimEpoch - VolatileLoadWithoutBarrier(&pCache->useEpoch)) < 2)
+                continue;
+
+            // Skip the cache if its thread just started using it again
+            if (InterlockedCompareExchange(&pCache->lock, 1, 0) != 0)
+                continue;
+
+            Slab* p = pCache->pList;
+            while (p->pNext != NULL)
+                p = p->pNext;
+            p->pNext = slabsToDelete;
+            slabsToDelete = pCache->pList;
+
+            pCache->pList = NULL;
+            pCache->cached = 0;
+            pCache->peakInUse = pCache->inUse;
+
+            VolatileStore(&pCache->lock, (LONG)0);
+        }
+    }
+
+    while (slabsToDelete != NULL)
+    {
+        Slab* pNext = slabsToDelete->pNext;
+        delete [] (BYTE*)slabsToDelete;
+        slabsToDelete = pNext;
+    }
+}
+
 JitHost JitHost::s_theJitHost;
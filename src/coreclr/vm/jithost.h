@@ -17,11 +17,37 @@ private:
         Thread* affinity;
     };
 
+    // Per-thread cache in front of the shared lists below, see jithost.cpp
+    struct ThreadSlabCache
+    {
+        Slab* pList;
+        size_t cached;      // bytes in pList
+        size_t inUse;       // bytes handed out to the JIT on this thread and not freed yet
+        size_t peakInUse;   // high-water mark of inUse since the last trim
+        DWORD trimEpoch;
+        DWORD useEpoch;     // m_trimEpoch when the thread last used the cache
+
+        // Held by the thread while it uses the fields above, and by reclaim() while it takes the
+        // slabs of an idle thread
+        LONG lock;
+
+        // Link in m_pThreadCaches, protected by m_jitSlabAllocatorCrst
+        bool registered;
+        ThreadSlabCache* pNextCache;
+        ThreadSlabCache* pPrevCache;
+
+        ~ThreadSlabCache();
+    };
+
+    static thread_local ThreadSlabCache t_slabCache;
+
     CrstStatic m_jitSlabAllocatorCrst;
     Slab* m_pCurrentCachedList;
     Slab* m_pPreviousCachedList;
     size_t m_totalCached;
     DWORD m_lastFlush;
+    DWORD m_trimEpoch;
+    ThreadSlabCache* m_pThreadCaches;
 
     JitHost() {}
     JitHost(const JitHost& other) = delete;
@@ -30,6 +56,12 @@ private:
     void init();
     void reclaim();
 
+    ThreadSlabCache* lockThreadCache();
+    void trimThreadCache(ThreadSlabCache* pCache);
+    void reclaimIdleThreadCaches();
+    void* allocateSharedSlab(size_t size, size_t* pActualSize);
+    void freeSharedSlab(void* slab, size_t actualSize);
+
 public:
     virtual void* allocateMemory(size_t size);
     virtual void freeMemory(void* block);
@@ -1367,13 +1367,18 @@ uint32_t CEEInfo::getThreadLocalFieldInfo (CORINFO_FIELD_HANDLE  field, bool isG
     MethodTable *pMT = fieldDesc->GetEnclosingMethodTable();
     pMT->EnsureTlsIndexAllocated();
 
-    if (isGCType)
+    ThreadStaticsInfo* pThreadStaticsInfo = MethodTableAuxiliaryData::GetThreadStaticsInfo(pMT->GetAuxiliaryData());
+    TLSIndex tlsIndex = isGCType ? pThreadStaticsInfo->GCTlsIndex : pThreadStaticsInfo->NonGCTlsIndex;
+
+    // Collectible indices keep their type, which is what the JIT and the optimized helpers use to
+    // tell them apart (see CORINFO_THREAD_STATIC_BLOCKS_INFO::collectibleTypeIndexFlag)
+    if (tlsIndex.GetTLSIndexType() == TLSIndexType::Collectible)
     {
-        typeIndex = MethodTableAuxiliaryData::GetThreadStaticsInfo(pMT->GetAuxiliaryData())->GCTlsIndex.GetIndexOffset();
+        typeIndex = tlsIndex.TLSIndexRawIndex;
     }
     else
     {
-        typeIndex = MethodTableAuxiliaryData::GetThreadStaticsInfo(pMT->GetAuxiliaryData())->NonGCTlsIndex.GetIndexOffset();
+        typeIndex = tlsIndex.GetIndexOffset();
     }
 
     assert(typeIndex != TypeIDProvider::INVALID_TYPE_ID);
@@ -1485,7 +1490,7 @@ void CEEInfo::getFieldInfo (CORINFO_RESOLVED_TOKEN * pResolvedToken,
                 fieldAccessor = intrinsicAccessor;
             }
             else
-            if (pFieldMT->Collectible())
+            if (pFieldMT->Collectible() && !pField->IsThreadStatic())
             {
                 // Static fields are not pinned in collectible types. We will always access
                 // them using a helper since the address cannot be embedded into the code.
@@ -1495,7 +1500,8 @@ void CEEInfo::getFieldInfo (CORINFO_RESOLVED_TOKEN * pResolvedToken,
             }
             else if (pField->IsThreadStatic())
             {
-                 // We always treat accessing thread statics as if we are in domain neutral code.
+                // We always treat accessing thread statics as if we are in domain neutral code. Thread
+                // statics of collectible types are never embedded either, only their TLS index is.
                 fieldAccessor = CORINFO_FIELD_STATIC_SHARED_STATIC_HELPER;
 
                 pResult->helper = getSharedStaticsHelper(pField, pFieldMT);
@@ -3741,12 +3747,21 @@ uint32_t CEEInfo::getClassAttribs (CORINFO_CLASS_HANDLE clsHnd)
     // we don't need to because the JIT only cares in the case of COM classes</REVISIT_TODO>
     uint32_t ret = 0;
 
+    size_t cacheIndex = ((size_t)clsHnd / sizeof(void*)) % ClassAttribsCacheSize;
+    if (clsHnd != NULL && m_classAttribsCache_Key[cacheIndex] == clsHnd)
+    {
+        return m_classAttribsCache_Value[cacheIndex];
+    }
+
     JIT_TO_EE_TRANSITION();
 
     ret = getClassAttribsInternal(clsHnd);
 
     EE_TO_JIT_TRANSITION();
 
+    m_classAttribsCache_Key[cacheIndex] = clsHnd;
+    m_classAttribsCache_Value[cacheIndex] = ret;
+
     return ret;
 }
 
@@ -5711,6 +5726,7 @@ bool __stdcall TrackAllocationsEnabled()
 #endif // PROFILING_SUPPORTED
 #ifdef FEATURE_EVENT_TRACE
         || ETW::TypeSystemLog::IsHeapAllocEventEnabled()
+        || ETW::TypeSystemLog::IsAllocationSamplingEnabled()
 #endif // FEATURE_EVENT_TRACE
         );
 }
@@ -5783,6 +5799,13 @@ CorInfoHelpFunc CEEInfo::getNewHelperStatic(MethodTable * pMT, bool * pHasSideEf
         _ASSERTE(helper == CORINFO_HELP_NEWFAST);
     }
     else
+    // pretenured types are allocated in an older generation by AllocateObject
+    if (pMT->IsPretenured())
+    {
+        // Use slow helper
+        _ASSERTE(helper == CORINFO_HELP_NEWFAST);
+    }
+    else
     // don't call the super-optimized one since that does not check
     // for GCStress
     if (GCStress<cfg_alloc>::IsEnabled())
@@ -10777,7 +10800,7 @@ void CEEJitInfo::WriteCode(EEJitManager * jitMgr)
     WriteCodeBytes();
 
     // Now that the code header was written to the final location, publish the code via the nibble map
-    jitMgr->NibbleMapSet(m_pCodeHeap, m_CodeHeader->GetCodeStartAddress(), TRUE);
+    jitMgr->NibbleMapSet(m_pCodeHeap, m_CodeHeader->GetCodeStartAddress(), TRUE, m_codeSize);
 
 #if defined(TARGET_AMD64)
     // Publish the new unwind information in a way that the ETW stack crawler can find
@@ -10870,6 +10893,28 @@ void CEEJitInfo::reportMetadata(
 
     JIT_TO_EE_TRANSITION_LEAF();
 
+    if ((length == sizeof(CORINFO_JIT_TELEMETRY)) &&
+        ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, MethodJitTelemetry) &&
+        (strcmp(key, CORINFO_JIT_TELEMETRY_KEY) == 0))
+    {
+        const CORINFO_JIT_TELEMETRY* telemetry = static_cast<const CORINFO_JIT_TELEMETRY*>(value);
+
+        ULONGLONG ullMethodIdentifier = 0;
+        ULONGLONG ullModuleID = 0;
+
+        if (m_pMethodBeingCompiled)
+        {
+            Module* pModule = m_pMethodBeingCompiled->GetModule();
+            ullModuleID = (ULONGLONG)(TADDR)pModule;
+            ullMethodIdentifier = (ULONGLONG)m_pMethodBeingCompiled;
+        }
+
+        FireEtwMethodJitTelemetry(ullMethodIdentifier, ullModuleID,
+            telemetry->ilCodeSize, telemetry->nativeCodeSize, telemetry->arenaBytes,
+            telemetry->totalMicroseconds, telemetry->importMicroseconds, telemetry->optimizeMicroseconds,
+            telemetry->lsraMicroseconds, telemetry->codegenMicroseconds, GetClrInstanceId());
+    }
+
     EE_TO_JIT_TRANSITION_LEAF();
 }
 
@@ -10938,7 +10983,19 @@ void CEEJitInfo::CompressDebugInfo()
         return;
     }
 
-    if ((m_iOffsetMapping == 0) && (m_iNativeVarInfo == 0) && (patchpointInfo == NULL) && (m_numInlineTreeNodes == 0) && (m_numRichOffsetMappings == 0))
+    // The variable locations are only used by the debugger, and mostly unavailable in optimized code
+    // anyway. Optionally don't keep them around for optimized code unless a debugger is attached.
+    ULONG iNativeVarInfo = m_iNativeVarInfo;
+    if (!g_pConfig->GetTrackOptimizedVarInfo() &&
+        !CORDebuggerAttached() &&
+        !m_jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_DEBUG_CODE) &&
+        !m_jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_MIN_OPT) &&
+        !m_jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0))
+    {
+        iNativeVarInfo = 0;
+    }
+
+    if ((m_iOffsetMapping == 0) && (iNativeVarInfo == 0) && (patchpointInfo == NULL) && (m_numInlineTreeNodes == 0) && (m_numRichOffsetMappings == 0))
         return;
 
     JIT_TO_EE_TRANSITION();
@@ -10954,7 +11011,7 @@ void CEEJitInfo::CompressDebugInfo()
 
         PTR_BYTE pDebugInfo = CompressDebugInfo::CompressBoundariesAndVars(
             m_pOffsetMapping, m_iOffsetMapping,
-            m_pNativeVarInfo, m_iNativeVarInfo,
+            (iNativeVarInfo > 0) ? m_pNativeVarInfo : NULL, iNativeVarInfo,
             patchpointInfo,
             m_inlineTreeNodes, m_numInlineTreeNodes,
             m_richOffsetMappings, m_numRichOffsetMappings,
@@ -488,6 +488,8 @@ public:
         m_allowInlining(fAllowInlining)
     {
         LIMITED_METHOD_CONTRACT;
+
+        memset(m_classAttribsCache_Key, 0, sizeof(m_classAttribsCache_Key));
     }
 
     virtual ~CEEInfo()
@@ -573,6 +575,12 @@ protected:
     CORINFO_METHOD_HANDLE   m_hMethodForSecurity_Key;
     MethodDesc *            m_pMethodForSecurity_Value;
 
+    // Direct mapped cache of getClassAttribs() lookups. The JIT asks for the attributes of the
+    // same few classes over and over again, and they never change.
+    static const size_t     ClassAttribsCacheSize = 32;
+    CORINFO_CLASS_HANDLE    m_classAttribsCache_Key[ClassAttribsCacheSize];
+    uint32_t                m_classAttribsCache_Value[ClassAttribsCacheSize];
+
 #if defined(FEATURE_GDBJIT)
     CalledMethod *          m_pCalledMethods;
 #endif
@@ -2086,9 +2086,10 @@ class MulticoreJitPrepareCodeConfig : public PrepareCodeConfig
 {
 private:
     bool m_wasTier0;
+    bool m_compileAtTier1;
 
 public:
-    MulticoreJitPrepareCodeConfig(MethodDesc* pMethod);
+    MulticoreJitPrepareCodeConfig(MethodDesc* pMethod, bool compileAtTier1 = false);
 
     bool WasTier0() const
     {
@@ -2103,6 +2104,7 @@ public:
     }
 
     virtual BOOL SetNativeCode(PCODE pCode, PCODE * ppAlternateCodeToUse) override;
+    virtual CORJIT_FLAGS GetJitCompilationFlags() override;
 };
 #endif // DACCESS_COMPILE
 
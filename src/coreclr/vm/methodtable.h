@@ -332,7 +332,7 @@ struct MethodTableAuxiliaryData
         enum_flag_CanCompareBitsOrUseFastGetHashCode       = 0x0004,     // Is any field type or sub field type overridden Equals or GetHashCode
 
         enum_flag_HasApproxParent           = 0x0010,
-        // enum_unused                      = 0x0020,
+        enum_flag_IsPretenured              = 0x0020,     // instances are allocated in an older generation, see PretenuringTracker
         enum_flag_IsNotFullyLoaded          = 0x0040,
         enum_flag_DependenciesLoaded        = 0x0080,     // class and all dependencies loaded up to CLASS_LOADED_BUT_NOT_VERIFIED
 
@@ -464,6 +464,20 @@ public:
         return (VolatileLoad(&m_dwFlags) & enum_flag_IsStaticDataAllocated);
     }
 
+    inline BOOL IsPretenured() const
+    {
+        LIMITED_METHOD_DAC_CONTRACT;
+        return (VolatileLoad(&m_dwFlags) & enum_flag_IsPretenured);
+    }
+
+#ifndef DACCESS_COMPILE
+    inline void SetIsPretenured()
+    {
+        LIMITED_METHOD_CONTRACT;
+        InterlockedOr((LONG*)&m_dwFlags, (LONG)enum_flag_IsPretenured);
+    }
+#endif
+
 #ifndef DACCESS_COMPILE
     inline void SetIsStaticDataAllocated()
     {
@@ -1073,6 +1087,18 @@ public:
     }
 #endif
 
+    BOOL IsPretenured()
+    {
+        return GetAuxiliaryData()->IsPretenured();
+    }
+
+#ifndef DACCESS_COMPILE
+    void SetIsPretenured()
+    {
+        GetAuxiliaryDataForWrite()->SetIsPretenured();
+    }
+#endif
+
     inline BOOL IsGlobalClass()
     {
         WRAPPER_NO_CONTRACT;
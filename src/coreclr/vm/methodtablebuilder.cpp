@@ -8055,6 +8055,27 @@ VOID MethodTableBuilder::PlaceThreadStaticFields()
     LOG((LF_CLASSLOADER, LL_INFO10000, "STATICS: ThreadStatic field bytes needed (0 is normal for non dynamic case)%i\n", bmtProp->dwNonGCThreadStaticFieldBytes));
 }
 
+//*******************************************************************************
+// By-value fields that the compact GC layout places right after the object references:
+// they contain GC pointers and need no more than pointer alignment.
+static BOOL IsCompactGCLayoutCandidate(MethodTable * pByValueMT)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (!pByValueMT->ContainsPointers())
+        return FALSE;
+
+#if !defined(TARGET_64BIT) && (DATA_ALIGNMENT > 4)
+    if (pByValueMT->GetNumInstanceFieldBytes() >= DATA_ALIGNMENT)
+        return FALSE;
+#elif defined(FEATURE_64BIT_ALIGNMENT)
+    if (pByValueMT->RequiresAlign8())
+        return FALSE;
+#endif
+
+    return TRUE;
+}
+
 //*******************************************************************************
 //
 // Used by BuildMethodTable
@@ -8141,6 +8162,32 @@ VOID    MethodTableBuilder::PlaceInstanceFields(MethodTable ** pByValueClassCach
         }
 #endif // FEATURE_READYTORUN
 
+        // Opt-in: place the by-value fields that contain GC pointers right after the object references,
+        // so their pointer series are adjacent and HandleGCForValueClasses can merge them. Types from
+        // ReadyToRun images keep the standard layout since precompiled code depends on it.
+        static ConfigDWORD compactGCLayout;
+        bmtFP->fCompactGCLayout = (compactGCLayout.val(CLRConfig::UNSUPPORTED_TypeLoader_CompactGCLayout) != 0) &&
+            !HasLayout() &&
+            (bmtFP->NumInlineArrayElements <= 1) &&
+            !GetModule()->GetPEAssembly()->IsReadyToRun();
+
+        DWORD dwCompactGCValueClassBytes = 0;
+        if (bmtFP->fCompactGCLayout)
+        {
+            for (i = 0; i < bmtEnumFields->dwNumInstanceFields; i++)
+            {
+                if (pFieldDescList[i].IsByValue() && IsCompactGCLayoutCandidate(pByValueClassCache[i]))
+                {
+                    dwCompactGCValueClassBytes += (DWORD)ALIGN_UP(pByValueClassCache[i]->GetNumInstanceFieldBytes(), TARGET_POINTER_SIZE);
+                }
+            }
+
+            if (dwCompactGCValueClassBytes == 0)
+            {
+                bmtFP->fCompactGCLayout = false;
+            }
+        }
+
         // place small fields first if the parent have a number of field bytes that is not aligned
         if (!IS_ALIGNED(dwCumulativeInstanceFieldPos, DATA_ALIGNMENT))
         {
@@ -8229,7 +8276,7 @@ VOID    MethodTableBuilder::PlaceInstanceFields(MethodTable ** pByValueClassCach
         // Place fields, largest first
         for (i = MAX_LOG2_PRIMITIVE_FIELD_SIZE; (signed int) i >= 0; i--)
         {
-            if (bmtFP->NumInstanceFieldsOfSize[i] == 0)
+            if (bmtFP->NumInstanceFieldsOfSize[i] == 0 && (i != LOG2SLOT || dwCompactGCValueClassBytes == 0))
                 continue;
 
             // Align instance fields if we aren't already
@@ -8244,6 +8291,10 @@ VOID    MethodTableBuilder::PlaceInstanceFields(MethodTable ** pByValueClassCach
             bmtFP->InstanceFieldStart[i] = dwCumulativeInstanceFieldPos;
             dwCumulativeInstanceFieldPos += (bmtFP->NumInstanceFieldsOfSize[i] << i);
 
+            // The pointer-size region also holds the by-value fields placed by the compact GC layout
+            if (i == LOG2SLOT)
+                dwCumulativeInstanceFieldPos += dwCompactGCValueClassBytes;
+
             // Reset counters for the loop after this one
             bmtFP->NumInstanceFieldsOfSize[i]  = 0;
         }
@@ -8260,6 +8311,10 @@ VOID    MethodTableBuilder::PlaceInstanceFields(MethodTable ** pByValueClassCach
             bmtFP->NumInstanceGCPointerFields = 0;     // reset to zero here, counts up as pointer slots are assigned below
         }
 
+        // The by-value fields placed by the compact GC layout follow the GC pointers
+        DWORD dwCompactGCValueClassPos = bmtFP->InstanceFieldStart[LOG2SLOT];
+        bmtFP->InstanceFieldStart[LOG2SLOT] += dwCompactGCValueClassBytes;
+
         // Place instance fields - be careful not to place any already-placed fields
         for (i = 0; i < bmtEnumFields->dwNumInstanceFields; i++)
         {
@@ -8302,38 +8357,50 @@ VOID    MethodTableBuilder::PlaceInstanceFields(MethodTable ** pByValueClassCach
             {
                 MethodTable * pByValueMT = pByValueClassCache[i];
 
-#if !defined(TARGET_64BIT) && (DATA_ALIGNMENT > 4)
-                if (pByValueMT->GetNumInstanceFieldBytes() >= DATA_ALIGNMENT)
+                if (bmtFP->fCompactGCLayout && IsCompactGCLayoutCandidate(pByValueMT))
                 {
-                    dwCumulativeInstanceFieldPos = (DWORD)ALIGN_UP(dwCumulativeInstanceFieldPos, DATA_ALIGNMENT);
-                    largestAlignmentRequirement = max(largestAlignmentRequirement, DATA_ALIGNMENT);
-                }
-                else
-#elif defined(FEATURE_64BIT_ALIGNMENT)
-                if (pByValueMT->RequiresAlign8())
-                {
-                    dwCumulativeInstanceFieldPos = (DWORD)ALIGN_UP(dwCumulativeInstanceFieldPos, 8);
-                    largestAlignmentRequirement = max(largestAlignmentRequirement, 8);
-                }
-                else
-#endif // FEATURE_64BIT_ALIGNMENT
-                if (pByValueMT->ContainsPointers())
-                {
-                    // this field type has GC pointers in it, which need to be pointer-size aligned
-                    // so do this if it has not been done already
-                    dwCumulativeInstanceFieldPos = (DWORD)ALIGN_UP(dwCumulativeInstanceFieldPos, TARGET_POINTER_SIZE);
+                    // The space was reserved right after the GC pointers
                     largestAlignmentRequirement = max(largestAlignmentRequirement, TARGET_POINTER_SIZE);
                     containsGCPointers = true;
+
+                    pFieldDescList[i].SetOffset(dwCompactGCValueClassPos - dwOffsetBias);
+                    dwCompactGCValueClassPos += (DWORD)ALIGN_UP(pByValueMT->GetNumInstanceFieldBytes(), TARGET_POINTER_SIZE);
                 }
                 else
                 {
-                    int fieldAlignmentRequirement = pByValueMT->GetFieldAlignmentRequirement();
-                    largestAlignmentRequirement = max(largestAlignmentRequirement, fieldAlignmentRequirement);
-                    dwCumulativeInstanceFieldPos = (DWORD)ALIGN_UP(dwCumulativeInstanceFieldPos, fieldAlignmentRequirement);
-                }
+#if !defined(TARGET_64BIT) && (DATA_ALIGNMENT > 4)
+                    if (pByValueMT->GetNumInstanceFieldBytes() >= DATA_ALIGNMENT)
+                    {
+                        dwCumulativeInstanceFieldPos = (DWORD)ALIGN_UP(dwCumulativeInstanceFieldPos, DATA_ALIGNMENT);
+                        largestAlignmentRequirement = max(largestAlignmentRequirement, DATA_ALIGNMENT);
+                    }
+                    else
+#elif defined(FEATURE_64BIT_ALIGNMENT)
+                    if (pByValueMT->RequiresAlign8())
+                    {
+                        dwCumulativeInstanceFieldPos = (DWORD)ALIGN_UP(dwCumulativeInstanceFieldPos, 8);
+                        largestAlignmentRequirement = max(largestAlignmentRequirement, 8);
+                    }
+                    else
+#endif // FEATURE_64BIT_ALIGNMENT
+                    if (pByValueMT->ContainsPointers())
+                    {
+                        // this field type has GC pointers in it, which need to be pointer-size aligned
+                        // so do this if it has not been done already
+                        dwCumulativeInstanceFieldPos = (DWORD)ALIGN_UP(dwCumulativeInstanceFieldPos, TARGET_POINTER_SIZE);
+                        largestAlignmentRequirement = max(largestAlignmentRequirement, TARGET_POINTER_SIZE);
+                        containsGCPointers = true;
+                    }
+                    else
+                    {
+                        int fieldAlignmentRequirement = pByValueMT->GetFieldAlignmentRequirement();
+                        largestAlignmentRequirement = max(largestAlignmentRequirement, fieldAlignmentRequirement);
+                        dwCumulativeInstanceFieldPos = (DWORD)ALIGN_UP(dwCumulativeInstanceFieldPos, fieldAlignmentRequirement);
+                    }
 
-                pFieldDescList[i].SetOffset(dwCumulativeInstanceFieldPos - dwOffsetBias);
-                dwCumulativeInstanceFieldPos += pByValueMT->GetNumInstanceFieldBytes();
+                    pFieldDescList[i].SetOffset(dwCumulativeInstanceFieldPos - dwOffsetBias);
+                    dwCumulativeInstanceFieldPos += pByValueMT->GetNumInstanceFieldBytes();
+                }
 
                 if (pByValueMT->ContainsPointers())
                 {
@@ -8360,6 +8427,38 @@ VOID    MethodTableBuilder::PlaceInstanceFields(MethodTable ** pByValueClassCach
             }
         }
 
+        if (bmtFP->fCompactGCLayout)
+        {
+            // Count the series the way HandleGCForValueClasses builds them, merging the adjacent ones
+            dwNumGCPointerSeries = bmtParent->NumParentPointerSeries;
+            DWORD dwLastSeriesEnd = (DWORD)-1;
+            if (bmtFP->NumInstanceGCPointerFields)
+            {
+                dwNumGCPointerSeries++;
+                dwLastSeriesEnd = bmtFP->GCPointerFieldStart + (bmtFP->NumInstanceGCPointerFields << LOG2SLOT);
+            }
+
+            for (i = 0; i < bmtEnumFields->dwNumInstanceFields; i++)
+            {
+                if (!pFieldDescList[i].IsByValue() || !pByValueClassCache[i]->ContainsPointers())
+                    continue;
+
+                MethodTable * pByValueMT = pByValueClassCache[i];
+                CGCDesc * pByValueGCDesc = CGCDesc::GetCGCDescFromMT(pByValueMT);
+                CGCDescSeries * pByValueSeries = pByValueGCDesc->GetLowestSeries();
+
+                for (SIZE_T j = 0; j < pByValueGCDesc->GetNumSeries(); j++, pByValueSeries++)
+                {
+                    // Series offsets include the object header, field offsets do not
+                    DWORD dwSeriesStart = pFieldDescList[i].GetOffset() + (DWORD)pByValueSeries->GetSeriesOffset() - OBJECT_SIZE;
+                    if (dwSeriesStart != dwLastSeriesEnd)
+                        dwNumGCPointerSeries++;
+
+                    dwLastSeriesEnd = dwSeriesStart + (DWORD)(pByValueSeries->GetSeriesSize() + pByValueMT->GetBaseSize());
+                }
+            }
+        }
+
             // Can be unaligned
         DWORD dwNumInstanceFieldBytes = dwCumulativeInstanceFieldPos - dwOffsetBias;
 
@@ -11644,8 +11743,6 @@ VOID MethodTableBuilder::HandleGCForValueClasses(MethodTable ** pByValueClassCac
                             size_t cbSeriesSize;
                             size_t cbSeriesOffset;
 
-                            _ASSERTE(pSeries <= CGCDesc::GetCGCDescFromMT(pMT)->GetHighestSeries());
-
                             cbSeriesSize = pByValueSeries->GetSeriesSize();
 
                             // Add back the base size of the by value class, since it's being transplanted to this class
@@ -11654,9 +11751,6 @@ VOID MethodTableBuilder::HandleGCForValueClasses(MethodTable ** pByValueClassCac
                             // Subtract the base size of the class we're building
                             cbSeriesSize -= pMT->GetBaseSize();
 
-                            // Set current series we're building
-                            pSeries->SetSeriesSize(cbSeriesSize);
-
                             // Get offset into the value class of the first pointer field (includes a +Object)
                             cbSeriesOffset = pByValueSeries->GetSeriesOffset();
 
@@ -11666,6 +11760,21 @@ VOID MethodTableBuilder::HandleGCForValueClasses(MethodTable ** pByValueClassCac
                             // Add it to the offset of the by value class in our class
                             cbSeriesOffset += dwCurrentOffset;
 
+                            // The compact GC layout merges series that start where the previous one ends,
+                            // PlaceInstanceFields accounted for this in NumGCPointerSeries
+                            if (bmtFP->fCompactGCLayout &&
+                                pSeries > CGCDesc::GetCGCDescFromMT(pMT)->GetLowestSeries() &&
+                                (pSeries - 1)->GetSeriesOffset() + (pSeries - 1)->GetSeriesSize() + pMT->GetBaseSize() == cbSeriesOffset)
+                            {
+                                (pSeries - 1)->SetSeriesSize((pSeries - 1)->GetSeriesSize() + cbSeriesSize + pMT->GetBaseSize());
+                                pByValueSeries++;
+                                continue;
+                            }
+
+                            _ASSERTE(pSeries <= CGCDesc::GetCGCDescFromMT(pMT)->GetHighestSeries());
+
+                            // Set current series we're building
+                            pSeries->SetSeriesSize(cbSeriesSize);
                             pSeries->SetSeriesOffset(cbSeriesOffset); // Offset of field
                             pSeries++;
                             pByValueSeries++;
@@ -1997,6 +1997,7 @@ private:
         DWORD NumInlineArrayElements;
 
         bool  fIsAllGCPointers;
+        bool  fCompactGCLayout;             // by-value fields with GC pointers follow the GC pointer fields
         bool  fIsByRefLikeType;
         bool  fHasFixedAddressValueTypes;
         bool  fHasSelfReferencingStaticValueTypeField_WithRVA;
@@ -388,6 +388,7 @@ HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
 
     // Preprocessing Methods
     LONG skipped = 0;
+    bool hasTypeRecords = false;
 
     for (LONG i = 0 ; i < m_JitInfoCount; i++)
     {
@@ -397,6 +398,58 @@ HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
             continue;
         }
 
+        if (m_JitInfoArray[i].IsGenericTypeInfo())
+        {
+            TypeHandle th = m_JitInfoArray[i].GetTypeHandleAndClean();
+
+            // The type was recorded when it was published, skip it if its load failed afterwards
+            if (!th.IsFullyLoaded())
+            {
+                skipped++;
+                continue;
+            }
+
+            SigBuilder sigBuilder;
+
+            BOOL fSuccess = false;
+            EX_TRY
+            {
+                ZapSig zapSig(th.GetModule(), (LPVOID)this, ZapSig::MulticoreJitTokens,
+                              (EncodeModuleCallback)MulticoreJitManager::EncodeModuleHelper, NULL);
+                fSuccess = zapSig.GetSignatureForTypeHandle(th, &sigBuilder);
+            }
+            EX_CATCH
+            {
+            }
+            EX_END_CATCH(SwallowAllExceptions);
+
+            if (!fSuccess)
+            {
+                skipped++;
+                continue;
+            }
+
+            DWORD dwLength;
+            BYTE * pBlob = (BYTE*)sigBuilder.GetSignature(&dwLength);
+            if (dwLength >= SIGNATURE_LENGTH_MASK + 1)
+            {
+                skipped++;
+                continue;
+            }
+
+            BYTE * pSignature = new (nothrow) BYTE[dwLength];
+            if (pSignature == nullptr)
+            {
+                skipped++;
+                continue;
+            }
+
+            memcpy(pSignature, pBlob, dwLength);
+            m_JitInfoArray[i].PackSignatureForGenericType(pSignature, dwLength);
+            hasTypeRecords = true;
+            continue;
+        }
+
         MethodDesc * pMethod = m_JitInfoArray[i].GetMethodDescAndClean();
 
         if (m_JitInfoArray[i].IsGenericMethodInfo())
@@ -452,7 +505,7 @@ HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
         memset(&header, 0, sizeof(header));
 
         header.recordID       = Pack8_24(MULTICOREJIT_HEADER_RECORD_ID, sizeof(HeaderRecord));
-        header.version        = MULTICOREJIT_PROFILE_VERSION;
+        header.version        = hasTypeRecords ? MULTICOREJIT_PROFILE_VERSION_TYPES : MULTICOREJIT_PROFILE_VERSION;
         header.moduleCount    = m_ModuleCount;
         header.methodCount    = m_JitInfoCount - skipped - m_ModuleDepCount;
         header.moduleDepCount = m_ModuleDepCount;
@@ -499,6 +552,37 @@ HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
             DWORD data1 = m_JitInfoArray[i].GetRawModuleData();
             hr = WriteData(pStream, &data1, sizeof(data1));
         }
+        else if (m_JitInfoArray[i].IsGenericTypeInfo())
+        {
+            // Type record
+            DWORD data1 = m_JitInfoArray[i].GetRawTypeData1();
+            unsigned short data2 = m_JitInfoArray[i].GetRawTypeData2();
+            BYTE * pSignature = m_JitInfoArray[i].GetRawTypeSignature();
+
+            if (pSignature == nullptr)
+            {
+                // Skipped type
+                continue;
+            }
+
+            DWORD sigSize = m_JitInfoArray[i].GetTypeSignatureSize();
+            DWORD paddingSize = m_JitInfoArray[i].GetTypeRecordPaddingSize();
+
+            hr = WriteData(pStream, &data1, sizeof(data1));
+            if (SUCCEEDED(hr))
+            {
+                hr = WriteData(pStream, &data2, sizeof(data2));
+            }
+            if (SUCCEEDED(hr))
+            {
+                hr = WriteData(pStream, pSignature, sigSize);
+            }
+            if (SUCCEEDED(hr) && paddingSize > 0)
+            {
+                DWORD tmp = 0;
+                hr = WriteData(pStream, &tmp, paddingSize);
+            }
+        }
         else if (m_JitInfoArray[i].IsGenericMethodInfo())
         {
             // Method record
@@ -552,6 +636,10 @@ HRESULT MulticoreJitRecorder::WriteOutput(IStream * pStream)
         {
             delete[] m_JitInfoArray[i].GetRawMethodSignature();
         }
+        else if (m_JitInfoArray[i].IsGenericTypeInfo())
+        {
+            delete[] m_JitInfoArray[i].GetRawTypeSignature();
+        }
     }
 
     MulticoreJitTrace(("New profile: %d modules, %d methods", m_ModuleCount, m_JitInfoCount));
@@ -603,7 +691,7 @@ unsigned MulticoreJitRecorder::GetOrAddModuleIndex(Module * pModule)
     return slot;
 }
 
-void MulticoreJitRecorder::RecordMethodInfo(unsigned moduleIndex, MethodDesc * pMethod, bool application)
+void MulticoreJitRecorder::RecordMethodInfo(unsigned moduleIndex, MethodDesc * pMethod, bool application, bool tier1Promoted)
 {
     LIMITED_METHOD_CONTRACT;
 
@@ -612,8 +700,37 @@ void MulticoreJitRecorder::RecordMethodInfo(unsigned moduleIndex, MethodDesc * p
 
     if (m_JitInfoCount < (LONG) MAX_METHODS)
     {
+        // Failing to index the record only means that a promotion adds another record for the method
+        LONG index;
+        if (!m_MethodInfoIndex.Lookup(pMethod, &index))
+        {
+            m_MethodInfoIndex.AddNoThrow(KeyValuePair<MethodDesc *, LONG>(pMethod, m_JitInfoCount));
+        }
+
+        m_ModuleList[moduleIndex].methodCount++;
+        m_JitInfoArray[m_JitInfoCount].PackMethod(moduleIndex, pMethod, application);
+
+        if (tier1Promoted)
+        {
+            m_JitInfoArray[m_JitInfoCount].SetTier1Promoted();
+        }
+
+        m_JitInfoCount++;
+    }
+}
+
+void MulticoreJitRecorder::RecordGenericTypeInfo(unsigned moduleIndex, TypeHandle th)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    _ASSERTE(m_JitInfoArray != nullptr);
+    _ASSERTE(m_ModuleList != nullptr);
+
+    if (m_JitInfoCount < (LONG) MAX_METHODS)
+    {
+        // Counted as a method so that the player keeps the module enabled
         m_ModuleList[moduleIndex].methodCount++;
-        m_JitInfoArray[m_JitInfoCount++].PackMethod(moduleIndex, pMethod, application);
+        m_JitInfoArray[m_JitInfoCount++].PackGenericType(moduleIndex, th);
     }
 }
 
@@ -889,6 +1006,62 @@ void MulticoreJitRecorder::RecordMethodJitOrLoad(MethodDesc * pMethod, bool appl
 }
 
 
+void MulticoreJitRecorder::RecordMethodTier1Promotion(MethodDesc * pMethod)
+{
+    STANDARD_VM_CONTRACT;
+
+    _ASSERTE(m_JitInfoArray != nullptr);
+
+    // Tag the method's existing record, so that playback jits it at tier 1 at its original place in the profile
+    LONG index;
+    if (m_MethodInfoIndex.Lookup(pMethod, &index))
+    {
+        _ASSERTE(m_JitInfoArray[index].IsMethodInfoFor(pMethod));
+        m_JitInfoArray[index].SetTier1Promoted();
+        return;
+    }
+
+    // The method was jitted or loaded before recording started
+    Module * pModule = pMethod->GetModule();
+
+    if (! MulticoreJitManager::IsSupportedModule(pModule, true))
+    {
+        return;
+    }
+
+    unsigned moduleIndex = RecordModuleInfo(pModule);
+
+    if (moduleIndex == UINT_MAX)
+    {
+        return;
+    }
+
+    RecordMethodInfo(moduleIndex, pMethod, true, true);
+}
+
+
+void MulticoreJitRecorder::RecordGenericTypeLoad(TypeHandle th)
+{
+    STANDARD_VM_CONTRACT;
+
+    Module * pModule = th.GetModule();
+
+    if (! MulticoreJitManager::IsSupportedModule(pModule, false))
+    {
+        return;
+    }
+
+    unsigned moduleIndex = RecordModuleInfo(pModule);
+
+    if (moduleIndex == UINT_MAX)
+    {
+        return;
+    }
+
+    RecordGenericTypeInfo(moduleIndex, th);
+}
+
+
 // Called from AppDomain::RaiseAssemblyResolveEvent, make it simple
 
 void MulticoreJitRecorder::AbortProfile()
@@ -1213,6 +1386,7 @@ void MulticoreJitManager::StartProfile(AppDomain * pDomain, AssemblyBinder *pBin
                 m_pMulticoreJitRecorder->Activate();
 
                 m_fRecorderActive = m_pMulticoreJitRecorder->CanGatherProfile();
+                m_fRecordGenericTypes = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MultiCoreJitRecordTypes) != 0;
             }
 
             _FireEtwMulticoreJit(W("STARTPROFILE"), W("Recorder"), m_fRecorderActive, hr, 0);
@@ -1352,6 +1526,7 @@ MulticoreJitManager::MulticoreJitManager()
     m_fSetProfileRootCalled = 0;
     m_fAutoStartCalled      = 0;
     m_fRecorderActive       = false;
+    m_fRecordGenericTypes   = false;
 
     m_playerLock.Init(CrstMulticoreJitManager, (CrstFlags)(CRST_TAKEN_DURING_SHUTDOWN));
     m_MulticoreJitCodeStorage.Init();
@@ -1446,6 +1621,68 @@ void MulticoreJitManager::RecordMethodJitOrLoad(MethodDesc * pMethod)
 }
 
 
+// Call back from TieredCompilationManager::OptimizeMethod when tier 1 code is activated for the default code version
+// Threading: protected by m_playerLock
+
+void MulticoreJitManager::RecordMethodTier1Promotion(MethodDesc * pMethod)
+{
+    STANDARD_VM_CONTRACT;
+
+    CrstHolder hold(& m_playerLock);
+
+    if (m_pMulticoreJitRecorder != NULL)
+    {
+        m_pMulticoreJitRecorder->RecordMethodTier1Promotion(pMethod);
+
+        if (m_pMulticoreJitRecorder->IsAtFullCapacity())
+        {
+            m_fRecorderActive = false;
+        }
+    }
+}
+
+
+// Call back from ClassLoader::DoIncrementalLoad when a generic instantiation is published
+// Threading: protected by m_playerLock
+
+void MulticoreJitManager::RecordGenericTypeLoad(TypeHandle th)
+{
+    STANDARD_VM_CONTRACT;
+
+    CrstHolder hold(& m_playerLock);
+
+    if (m_pMulticoreJitRecorder != NULL)
+    {
+        m_pMulticoreJitRecorder->RecordGenericTypeLoad(th);
+
+        if (m_pMulticoreJitRecorder->IsAtFullCapacity())
+        {
+            m_fRecorderActive = false;
+        }
+    }
+}
+
+
+// static
+bool MulticoreJitManager::IsGenericTypeSupported(TypeHandle th)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    // Only exact or shared instantiations of generic classes are worth replaying, open types and
+    // types that can be unloaded are not
+    return !th.IsTypeDesc() &&
+           th.HasInstantiation() &&
+           !th.ContainsGenericVariables() &&
+           !th.GetLoaderAllocator()->IsCollectible();
+}
+
+
 // static
 bool MulticoreJitManager::IsMethodSupported(MethodDesc * pMethod)
 {
@@ -209,6 +209,7 @@ private:
     LONG                    m_fSetProfileRootCalled;   // SetProfileRoot has been called
     LONG                    m_fAutoStartCalled;
     bool                    m_fRecorderActive;         // Manager open for recording/event, turned on when initialized properly, turned off when at full capacity
+    bool                    m_fRecordGenericTypes;     // Recorder also gathers generic type instantiations (MultiCoreJitRecordTypes)
     CrstExplicitInit        m_playerLock;              // Thread protection (accessing m_pMulticoreJitRecorder)
     MulticoreJitPlayerStat  m_stats;                   // Statistics: normally gathered by player, written to profile
 
@@ -230,6 +231,7 @@ public:
         m_fSetProfileRootCalled = 0;
         m_fAutoStartCalled      = 0;
         m_fRecorderActive       = false;
+        m_fRecordGenericTypes   = false;
     }
 
     ~MulticoreJitManager()
@@ -246,6 +248,22 @@ public:
         return m_fRecorderActive;
     }
 
+    inline bool IsGenericTypeRecorderActive() const
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        return m_fRecorderActive && m_fRecordGenericTypes;
+    }
+
+    // Tier 1 promotions only update existing records when the recorder is at full capacity, so they are tracked for as long
+    // as there is a recorder
+    inline bool IsTier1PromotionRecorderActive() const
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        return m_pMulticoreJitRecorder != NULL;
+    }
+
     inline MulticoreJitCounter & GetProfileSession()
     {
         LIMITED_METHOD_CONTRACT;
@@ -283,6 +301,14 @@ public:
 
     void RecordMethodJitOrLoad(MethodDesc * pMethod);
 
+    // Track methods promoted to tier 1 by the tiered compilation background worker for recording
+    void RecordMethodTier1Promotion(MethodDesc * pMethod);
+
+    // Track generic type instantiations created by the class loader for recording
+    void RecordGenericTypeLoad(TypeHandle th);
+
+    static bool IsGenericTypeSupported(TypeHandle th);
+
     MulticoreJitPlayerStat & GetStats()
     {
         LIMITED_METHOD_CONTRACT;
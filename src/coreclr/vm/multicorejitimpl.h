@@ -20,10 +20,11 @@
 
 #endif
 
-// Bits 0xff0000 are reserved method flags. Currently only first bit is used.
+// Bits 0xff0000 are reserved method flags. Currently only first two bits are used.
 const unsigned METHOD_FLAGS_MASK       = 0xff0000;
 const unsigned JIT_BY_APP_THREAD_TAG   = 0x10000;   // tag, that indicates whether method is jitted by application thread(1) or background thread(0)
-// Tags 0xfe0000 are currently free
+const unsigned JIT_TIER1_PROMOTED_TAG  = 0x20000;   // tag, that indicates whether method was promoted to tier 1 while recording
+// Tags 0xfc0000 are currently free
 
 const unsigned RECORD_TYPE_OFFSET      = 24;        // offset of type of record
 
@@ -33,6 +34,8 @@ const unsigned MODULE_MASK             = 0xffff;    // mask to get module index
 const unsigned MODULE_LEVEL_OFFSET     = 16;        // offset of module load level
 const unsigned MAX_MODULE_LEVELS       = 0x100;     // maximum allowed number of module levels (2^8 values)
 
+const unsigned MAX_TIER1_WORKERS       = 8;         // Maximum number of threads jitting methods promoted to tier 1 during playback
+
 const unsigned MAX_METHODS             = 0x4000;    // Maximum allowed number of methods (2^14 values) (in principle this is also limited by "unsigned short" counters)
 
 const unsigned SIGNATURE_LENGTH_MASK   = 0xffff;    // mask to get signature from packed data (2^16-1 max signature length)
@@ -45,13 +48,15 @@ const int      MAX_WALKBACK      = 128;
 
 enum
 {
-    MULTICOREJIT_PROFILE_VERSION   = 102,
+    MULTICOREJIT_PROFILE_VERSION       = 102,
+    MULTICOREJIT_PROFILE_VERSION_TYPES = 103,   // Profile also contains MULTICOREJIT_GENERICTYPE_RECORD_ID records
 
     MULTICOREJIT_HEADER_RECORD_ID           = 1,
     MULTICOREJIT_MODULE_RECORD_ID           = 2,
     MULTICOREJIT_MODULEDEPENDENCY_RECORD_ID = 3,
     MULTICOREJIT_METHOD_RECORD_ID           = 4,
     MULTICOREJIT_GENERICMETHOD_RECORD_ID    = 5,
+    MULTICOREJIT_GENERICTYPE_RECORD_ID      = 6,
 };
 
 inline unsigned Pack8_24(unsigned up, unsigned low)
@@ -63,7 +68,7 @@ inline unsigned Pack8_24(unsigned up, unsigned low)
 
 // Multicore JIT profile format.
 //
-// <profile>::= <HeaderRecord> { <ModuleRecord> | <JitInfRecord> }
+// <profile>::= <HeaderRecord> { <ModuleRecord> | <JitInfRecord> | <TypeInfRecord> }
 //
 //  1. Each record is DWORD aligned
 //  2. Each record starts with a 1 byte recordType identifier
@@ -72,12 +77,15 @@ inline unsigned Pack8_24(unsigned up, unsigned low)
 //  5. Maximum number of methods supported is MAX_METHODS
 //  6. Simple module name stored
 //  7. Method flag JIT_BY_APP_THREAD is for diagnosis only
+//  8. Generic type records are only gathered when MultiCoreJitRecordTypes is set, they share the MAX_METHODS limit with methods.
+//     Only profiles that contain them are written with MULTICOREJIT_PROFILE_VERSION_TYPES, so older players keep reading the others
 //
 // <HeaderRecord>::=     <recordType=MULTICOREJIT_HEADER_RECORD_ID> <3byte_recordSize> <version> <timeStamp> <moduleCount> <methodCount> <DependencyCount> <unsigned short counter>*14 <unsigned counter>*3
 // <ModuleRecord>::=     <recordType=MULTICOREJIT_MODULE_RECORD_ID> <3byte_recordSize> <ModuleVersion> <JitMethodCount> <loadLevel> <lenModuleName> char*lenModuleName <padding>
 // <ModuleDependency>::= <recordType=MULTICOREJIT_MODULEDEPENDENCY_RECORD_ID> <loadLevel_1byte> <moduleIndex_2bytes>
 // <GenericMethod>::=    <recordType=MULTICOREJIT_GENERICMETHOD_RECORD_ID> <methodFlags_1byte> <moduleIndex_2byte> <sigSize_2byte> <signature> <optional padding>
 // <NonGenericMethod>::= <recordType=MULTICOREJIT_METHOD_RECORD_ID> <methodFlags_1byte> <moduleIndex_2byte> <methodToken_4byte>
+// <GenericType>::=      <recordType=MULTICOREJIT_GENERICTYPE_RECORD_ID> <flags_1byte> <moduleIndex_2byte> <sigSize_2byte> <signature> <optional padding>
 //
 //
 // Actual profile has two representations: internal and the one, that is stored in file.
@@ -106,6 +114,15 @@ inline unsigned Pack8_24(unsigned up, unsigned low)
 //     - bits 16-23 store method flags
 //     - bits 24-31 store tag (MULTICOREJIT_METHOD_RECORD_ID or MULTICOREJIT_GENERICMETHOD_RECORD_ID).
 //
+//     When a recorded method is later promoted to tier 1, JIT_TIER1_PROMOTED_TAG is set on its existing record instead of
+//     adding a new one. Methods that are promoted without having been recorded (for instance because the recorder was
+//     started late) get a new record with the tag already set.
+//
+//   3. Generic types.
+//     For generic type instantiations RecorderInfo::data2 is set to 0.
+//     RecorderInfo::ptr is set to the TypeHandle of the instantiation.
+//     RecorderInfo::data1 stores the module index in bits 0-15 and MULTICOREJIT_GENERICTYPE_RECORD_ID tag in bits 24-31.
+//
 // II. Profile in file
 //
 //   Preprocessing is performed right before profile saving to file.
@@ -124,7 +141,12 @@ inline unsigned Pack8_24(unsigned up, unsigned low)
 //       b) RecorderInfo::data2 stores method token.
 //       c) RecorderInfo::ptr doesn't change.
 //
+//   3. Generic types.
+//     Binary signature of the instantiation is computed the same way as for generic methods: RecorderInfo::data2 stores
+//     signature length and RecorderInfo::ptr is replaced with pointer to the signature.
+//
 //     File write order for generic methods: RecorderInfo::data1, RecorderInfo::data2, signature, extra alignment (this is optional). All of these represent JitInfRecord.
+//     File write order for generic types is the same as for generic methods and represents TypeInfRecord.
 //     File write order for non-generic methods: RecorderInfo::data1, RecorderInfo::data2. All of these represent JitInfRecord.
 
 struct HeaderRecord
@@ -282,18 +304,47 @@ private:
     int                                m_nLoadedModuleCount;
 
     unsigned                           m_headerModuleCount;
+    bool                               m_fProfileHasTypes;
     unsigned                           m_moduleCount;
     PlayerModuleInfo                 * m_pModules;
 
+    struct Tier1Worker
+    {
+        MulticoreJitProfilePlayer    * m_pPlayer;
+        Thread                       * m_pThread;
+    };
+
+    // Methods promoted to tier 1 in the recorded run are jitted optimized after the rest of the profile, by the player
+    // thread and up to m_tier1WorkerCount - 1 additional threads which the player thread waits for
+    unsigned                           m_tier1WorkerCount;
+    bool                               m_fPreResolveHelperCells;
+    bool                               m_fPrefetchAssemblies;
+    SArray<MethodDesc *>               m_tier1Methods;
+    LONG                               m_nextTier1Method;
+    LONG                               m_nTier1Compiled;
+    LONG                               m_nActiveTier1Workers;
+    CLREvent                           m_tier1WorkersDone;
+    Tier1Worker                        m_tier1Workers[MAX_TIER1_WORKERS];
+
     HRESULT HandleModuleRecord(const ModuleRecord * pMod);
     HRESULT HandleModuleInfoRecord(unsigned moduleTo, unsigned level);
-    HRESULT HandleNonGenericMethodInfoRecord(unsigned moduleIndex, unsigned token);
-    HRESULT HandleGenericMethodInfoRecord(unsigned moduleIndex, BYTE * signature, unsigned length);
-    void CompileMethodInfoRecord(Module *pModule, MethodDesc *pMethod, bool isGeneric);
+    HRESULT HandleNonGenericMethodInfoRecord(unsigned moduleIndex, unsigned token, bool tier1Promoted);
+    HRESULT HandleGenericMethodInfoRecord(unsigned moduleIndex, BYTE * signature, unsigned length, bool tier1Promoted);
+    HRESULT HandleGenericTypeInfoRecord(unsigned moduleIndex, BYTE * signature, unsigned length);
+    void CompileMethodInfoRecord(Module *pModule, MethodDesc *pMethod, bool isGeneric, bool tier1Promoted);
+    void PreResolveHelperCells(PlayerModuleInfo & mod);
+    void PrefetchAssembly(PlayerModuleInfo & mod);
 
     bool CompileMethodDesc(Module * pModule, MethodDesc * pMD);
     HRESULT PlayProfile();
 
+    bool ShouldCompileAtTier1(MethodDesc * pMethod) const;
+    void PlayTier1Methods();
+    void CompileTier1Methods();
+    void Tier1WorkerDone();
+
+    static DWORD WINAPI StaticTier1WorkerThreadProc(void *args);
+
     bool ShouldAbort(bool fast) const;
 
     HRESULT JITThreadProc(Thread * pThread);
@@ -390,13 +441,21 @@ struct RecorderInfo
         return IsGenericMethodInfo() || IsNonGenericMethodInfo();
     }
 
+    bool IsGenericTypeInfo()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(IsPartiallyInitialized());
+        return (data1 >> RECORD_TYPE_OFFSET) == MULTICOREJIT_GENERICTYPE_RECORD_ID;
+    }
+
     bool IsModuleInfo()
     {
         LIMITED_METHOD_CONTRACT;
 
         _ASSERTE(IsPartiallyInitialized());
         bool ret = (data1 >> RECORD_TYPE_OFFSET) == MULTICOREJIT_MODULEDEPENDENCY_RECORD_ID;
-        _ASSERTE(ret == !IsMethodInfo());
+        _ASSERTE(ret == (!IsMethodInfo() && !IsGenericTypeInfo()));
         return ret;
     }
 
@@ -418,6 +477,7 @@ struct RecorderInfo
             }
             else
             {
+                // Generic methods and generic types carry a signature
                 return data2 != 0 && ptr != nullptr;
             }
         }
@@ -505,6 +565,123 @@ struct RecorderInfo
         return paddingSize;
     }
 
+    unsigned GetRawTypeData1()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(IsGenericTypeInfo());
+        return data1;
+    }
+
+    unsigned short GetRawTypeData2()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(IsGenericTypeInfo());
+        _ASSERTE(data2 < SIGNATURE_LENGTH_MASK + 1);
+        return (unsigned short) data2;
+    }
+
+    BYTE * GetRawTypeSignature()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(IsGenericTypeInfo());
+        return ptr;
+    }
+
+    unsigned GetTypeSignatureSize()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(IsGenericTypeInfo());
+        _ASSERTE(IsFullyInitialized());
+
+        return data2;
+    }
+
+    unsigned GetTypeRecordPaddingSize()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(IsGenericTypeInfo());
+        _ASSERTE(IsFullyInitialized());
+
+        unsigned unalignedrecSize = GetTypeSignatureSize() + sizeof(DWORD) + sizeof(unsigned short);
+        unsigned recSize = AlignUp(unalignedrecSize, sizeof(DWORD));
+        unsigned paddingSize = recSize - unalignedrecSize;
+        _ASSERTE(paddingSize < sizeof(unsigned));
+
+        return paddingSize;
+    }
+
+    TypeHandle GetTypeHandleAndClean()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(IsGenericTypeInfo());
+        _ASSERTE(data2 == 0);
+        _ASSERTE(ptr != nullptr);
+
+        TypeHandle ret = TypeHandle::FromPtr(ptr);
+        ptr = nullptr;
+
+        return ret;
+    }
+
+    void PackSignatureForGenericType(BYTE *pSignature, unsigned signatureLength)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(IsGenericTypeInfo());
+        _ASSERTE(data2 == 0);
+        _ASSERTE(ptr == nullptr);
+
+        _ASSERTE(pSignature != nullptr);
+        _ASSERTE(signatureLength > 0);
+
+        data2 = signatureLength & SIGNATURE_LENGTH_MASK;
+        ptr = pSignature;
+
+        _ASSERTE(IsFullyInitialized());
+    }
+
+    void PackGenericType(unsigned moduleIndex, TypeHandle th)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(data1 == 0);
+        _ASSERTE(data2 == 0);
+        _ASSERTE(ptr == nullptr);
+
+        _ASSERTE(moduleIndex < MAX_MODULES);
+        _ASSERTE(!th.IsNull());
+
+        data1 = Pack8_24(MULTICOREJIT_GENERICTYPE_RECORD_ID, moduleIndex);
+        data2 = 0;
+        // As for methods, only the pointer is recorded, the signature is computed when the profile is written
+        ptr = (BYTE *) th.AsPtr();
+
+        _ASSERTE(IsGenericTypeInfo());
+    }
+
+    bool IsMethodInfoFor(MethodDesc * pMethod)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        // Only valid while recording, before preprocessing replaces the MethodDesc pointer
+        return IsMethodInfo() && ptr == (BYTE *) pMethod;
+    }
+
+    void SetTier1Promoted()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        _ASSERTE(IsMethodInfo());
+
+        data1 |= JIT_TIER1_PROMOTED_TAG;
+    }
+
     MethodDesc * GetMethodDescAndClean()
     {
         LIMITED_METHOD_CONTRACT;
@@ -616,6 +793,9 @@ private:
     RecorderInfo              * m_JitInfoArray;
     LONG                      m_JitInfoCount;
 
+    // Index in m_JitInfoArray of the first record of each method, so that tier 1 promotions can tag it
+    MapSHash<MethodDesc *, LONG> m_MethodInfoIndex;
+
     bool                      m_fFirstMethod;
     bool                      m_fAborted;
 
@@ -628,7 +808,8 @@ private:
 
     HRESULT WriteModuleRecord(IStream * pStream,  const RecorderModuleInfo & module);
 
-    void RecordMethodInfo(unsigned moduleIndex, MethodDesc * pMethod, bool application);
+    void RecordMethodInfo(unsigned moduleIndex, MethodDesc * pMethod, bool application, bool tier1Promoted = false);
+    void RecordGenericTypeInfo(unsigned moduleIndex, TypeHandle th);
     unsigned RecordModuleInfo(Module * pModule);
     void RecordOrUpdateModuleInfo(FileLoadLevel needLevel, unsigned moduleIndex);
 
@@ -715,6 +896,10 @@ public:
 
     void RecordMethodJitOrLoad(MethodDesc * pMethod, bool application);
 
+    void RecordMethodTier1Promotion(MethodDesc * pMethod);
+
+    void RecordGenericTypeLoad(TypeHandle th);
+
     MulticoreJitCodeInfo RequestMethodCode(MethodDesc * pMethod, MulticoreJitManager * pManager);
 
     HRESULT StartProfile(const WCHAR * pRoot, const WCHAR * pFileName, int suffix, LONG nSession);
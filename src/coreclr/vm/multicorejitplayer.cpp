@@ -21,8 +21,10 @@
 #include "fstream.h"
 #include "hash.h"
 #include "clrex.h"
+#include "pgo.h"
 
 #include "appdomain.hpp"
+#include "../binder/inc/assemblybindercommon.hpp"
 
 #include "multicorejit.h"
 #include "multicorejitimpl.h"
@@ -173,6 +175,8 @@ public:
     int                  m_needLevel;
     int                  m_curLevel;
     bool                 m_enableJit;
+    bool                 m_helperCellsResolved;
+    PEImage            * m_pPrefetchedImage;
 
     PlayerModuleInfo()
     {
@@ -183,6 +187,18 @@ public:
         m_needLevel   = -1;
         m_curLevel    = -1;
         m_enableJit   = true;
+        m_helperCellsResolved = false;
+        m_pPrefetchedImage = NULL;
+    }
+
+    ~PlayerModuleInfo()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        if (m_pPrefetchedImage != NULL)
+        {
+            m_pPrefetchedImage->Release();
+        }
     }
 
     bool MeetLevel(FileLoadLevel level) const
@@ -373,6 +389,7 @@ MulticoreJitProfilePlayer::MulticoreJitProfilePlayer(AssemblyBinder * pBinder, L
     m_nMySession         = nSession;
     m_moduleCount        = 0;
     m_headerModuleCount  = 0;
+    m_fProfileHasTypes   = false;
     m_pModules           = NULL;
     m_nBlockingCount     = 0;
     m_nMissingModule     = 0;
@@ -382,6 +399,13 @@ MulticoreJitProfilePlayer::MulticoreJitProfilePlayer(AssemblyBinder * pBinder, L
     m_pFileBuffer        = NULL;
     m_nFileSize          = 0;
 
+    m_tier1WorkerCount    = 0;
+    m_fPreResolveHelperCells = false;
+    m_fPrefetchAssemblies = false;
+    m_nextTier1Method     = 0;
+    m_nTier1Compiled      = 0;
+    m_nActiveTier1Workers = 0;
+
     m_nStartTime         = GetTickCount();
 }
 
@@ -504,14 +528,43 @@ HRESULT MulticoreJitProfilePlayer::HandleModuleRecord(const ModuleRecord * pMod)
 
     m_moduleCount ++;
 
+    if (m_fPrefetchAssemblies)
+    {
+        PrefetchAssembly(info);
+    }
+
     return hr;
 }
 
+// Module records come before anything else in the profile, so open and map the assemblies they name while
+// the application threads are still starting up. Their binds then find the images already mapped, as long as
+// the player keeps them alive. Only the TPA assemblies of the default binder can be found without binding.
+void MulticoreJitProfilePlayer::PrefetchAssembly(PlayerModuleInfo & mod)
+{
+    STANDARD_VM_CONTRACT;
+
+    if ((m_pBinder != NULL) && !m_pBinder->IsDefault())
+    {
+        return;
+    }
+
+    AssemblyBinder * pDefaultBinder = AppDomain::GetCurrentDomain()->GetDefaultBinder();
+
+    SString simpleName(SString::Utf8, mod.m_pRecord->GetModuleName(), mod.m_pRecord->lenModuleName);
+
+    HRESULT hr = BINDER_SPACE::AssemblyBinderCommon::PrefetchTpaAssembly(pDefaultBinder->GetAppContext(), simpleName, &mod.m_pPrefetchedImage);
+
+    MulticoreJitTrace(("PrefetchAssembly(%s) hr=%x", simpleName.GetUTF8(), hr));
+}
+
 #ifndef DACCESS_COMPILE
-MulticoreJitPrepareCodeConfig::MulticoreJitPrepareCodeConfig(MethodDesc* pMethod) :
+MulticoreJitPrepareCodeConfig::MulticoreJitPrepareCodeConfig(MethodDesc* pMethod, bool compileAtTier1) :
     // Method code that was pregenerated and loaded is recorded in the multi-core JIT profile, so enable multi-core JIT to also
-    // look up pregenerated code to help parallelize the work
-    PrepareCodeConfig(NativeCodeVersion(pMethod), FALSE, TRUE), m_wasTier0(false)
+    // look up pregenerated code to help parallelize the work. Methods that were promoted to tier 1 in the recorded run are
+    // jitted instead, since the pregenerated code would have been replaced anyway.
+    PrepareCodeConfig(NativeCodeVersion(pMethod), FALSE, compileAtTier1 ? FALSE : TRUE),
+    m_wasTier0(false),
+    m_compileAtTier1(compileAtTier1)
 {
     WRAPPER_NO_CONTRACT;
 
@@ -529,6 +582,30 @@ BOOL MulticoreJitPrepareCodeConfig::SetNativeCode(PCODE pCode, PCODE * ppAlterna
     return TRUE;
 }
 
+CORJIT_FLAGS MulticoreJitPrepareCodeConfig::GetJitCompilationFlags()
+{
+    STANDARD_VM_CONTRACT;
+
+    CORJIT_FLAGS flags = PrepareCodeConfig::GetJitCompilationFlags();
+
+#ifdef FEATURE_TIERED_COMPILATION
+    if (m_compileAtTier1 && flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER0))
+    {
+        flags.Clear(CORJIT_FLAGS::CORJIT_FLAG_TIER0);
+        flags.Clear(CORJIT_FLAGS::CORJIT_FLAG_BBINSTR);
+        flags.Clear(CORJIT_FLAGS::CORJIT_FLAG_BBINSTR_IF_LOOPS);
+        flags.Set(CORJIT_FLAGS::CORJIT_FLAG_TIER1);
+
+        // The code is handed to the application thread the same way as tier 0 code for which the JIT switched to optimized,
+        // so that the default code version becomes optimized and call counting is not started for it
+        SetWasTier0();
+        SetJitSwitchedToOptimized();
+    }
+#endif
+
+    return flags;
+}
+
 MulticoreJitCodeInfo::MulticoreJitCodeInfo(PCODE entryPoint, const MulticoreJitPrepareCodeConfig *pConfig)
 {
     WRAPPER_NO_CONTRACT;
@@ -844,7 +921,7 @@ DomainAssembly * MulticoreJitProfilePlayer::LoadAssembly(SString & assemblyName)
         FALSE); // Don't throw on FileNotFound.
 }
 
-HRESULT MulticoreJitProfilePlayer::HandleNonGenericMethodInfoRecord(unsigned moduleIndex, unsigned token)
+HRESULT MulticoreJitProfilePlayer::HandleNonGenericMethodInfoRecord(unsigned moduleIndex, unsigned token, bool tier1Promoted)
 {
     STANDARD_VM_CONTRACT;
 
@@ -866,10 +943,12 @@ HRESULT MulticoreJitProfilePlayer::HandleNonGenericMethodInfoRecord(unsigned mod
         {
             Module * pModule = mod.m_pModule;
 
+            PreResolveHelperCells(mod);
+
             // Similar to Module::FindMethod + Module::FindMethodThrowing,
             // except it calls GetMethodDescFromMemberDefOrRefOrSpec with strictMetadataChecks=FALSE to allow generic instantiation
             MethodDesc * pMethod = MemberLoader::GetMethodDescFromMemberDefOrRefOrSpec(pModule, token, NULL, FALSE, FALSE);
-            CompileMethodInfoRecord(pModule, pMethod, false);
+            CompileMethodInfoRecord(pModule, pMethod, false, tier1Promoted);
         }
         else
         {
@@ -889,7 +968,7 @@ HRESULT MulticoreJitProfilePlayer::HandleNonGenericMethodInfoRecord(unsigned mod
     return hr;
 }
 
-HRESULT MulticoreJitProfilePlayer::HandleGenericMethodInfoRecord(unsigned moduleIndex, BYTE * signature, unsigned length)
+HRESULT MulticoreJitProfilePlayer::HandleGenericMethodInfoRecord(unsigned moduleIndex, BYTE * signature, unsigned length, bool tier1Promoted)
 {
     STANDARD_VM_CONTRACT;
 
@@ -911,6 +990,8 @@ HRESULT MulticoreJitProfilePlayer::HandleGenericMethodInfoRecord(unsigned module
         {
             Module * pModule = mod.m_pModule;
 
+            PreResolveHelperCells(mod);
+
             SigTypeContext typeContext;   // empty type context
             ZapSig::Context zapSigContext(pModule, (void *)this, ZapSig::MulticoreJitTokens);
             MethodDesc * pMethod = NULL;
@@ -923,7 +1004,7 @@ HRESULT MulticoreJitProfilePlayer::HandleGenericMethodInfoRecord(unsigned module
             }
             EX_END_CATCH(SwallowAllExceptions);
 
-            CompileMethodInfoRecord(pModule, pMethod, true);
+            CompileMethodInfoRecord(pModule, pMethod, true, tier1Promoted);
         }
         else
         {
@@ -943,7 +1024,76 @@ HRESULT MulticoreJitProfilePlayer::HandleGenericMethodInfoRecord(unsigned module
     return hr;
 }
 
-void MulticoreJitProfilePlayer::CompileMethodInfoRecord(Module *pModule, MethodDesc *pMethod, bool isGeneric)
+HRESULT MulticoreJitProfilePlayer::HandleGenericTypeInfoRecord(unsigned moduleIndex, BYTE * signature, unsigned length)
+{
+    STANDARD_VM_CONTRACT;
+
+    HRESULT hr = E_ABORT;
+
+    if (moduleIndex >= m_moduleCount)
+    {
+        m_stats.m_nMissingModuleSkip++;
+        hr = COR_E_BADIMAGEFORMAT;
+    }
+    else
+    {
+        PlayerModuleInfo & mod = m_pModules[moduleIndex];
+
+        if (mod.IsModuleLoaded() && mod.m_enableJit)
+        {
+            Module * pModule = mod.m_pModule;
+
+            PreResolveHelperCells(mod);
+
+            // Load the instantiation ahead of the application thread, so that methods using it later find the
+            // type, its dictionary layout and its dependencies already loaded
+            SigTypeContext typeContext;   // empty type context
+            ZapSig::Context zapSigContext(pModule, (void *)this, ZapSig::MulticoreJitTokens);
+            SigPointer sigPtr(signature, length);
+            TypeHandle th;
+            EX_TRY
+            {
+                th = sigPtr.GetTypeHandleThrowing(pModule, &typeContext, ClassLoader::LoadTypes, CLASS_LOADED, FALSE, NULL, &zapSigContext);
+            }
+            EX_CATCH
+            {
+            }
+            EX_END_CATCH(SwallowAllExceptions);
+
+            MulticoreJitTrace(("GenericTypeRecord %s", th.IsNull() ? "failed" : "loaded"));
+        }
+
+        hr = S_OK;
+    }
+
+    return hr;
+}
+
+// The first time playback reaches a module, resolve the module's allocation and casting helper cells on the
+// player thread, so that the startup methods don't each go through the delay load helper for them
+void MulticoreJitProfilePlayer::PreResolveHelperCells(PlayerModuleInfo & mod)
+{
+    STANDARD_VM_CONTRACT;
+
+    if (!m_fPreResolveHelperCells || mod.m_helperCellsResolved)
+    {
+        return;
+    }
+
+    mod.m_helperCellsResolved = true;
+
+    if (mod.m_pModule->IsReadyToRun())
+    {
+        MulticoreJitTrace(("PreResolveHelperCells for module %p", mod.m_pModule));
+
+        // Type loads may need to call managed code, same as compiling methods
+        ThreadStateNCStackHolder holder(-1, Thread::TSNC_CallingManagedCodeDisabled);
+
+        mod.m_pModule->PreResolveDynamicHelperCells();
+    }
+}
+
+void MulticoreJitProfilePlayer::CompileMethodInfoRecord(Module *pModule, MethodDesc *pMethod, bool isGeneric, bool tier1Promoted)
 {
     STANDARD_VM_CONTRACT;
 
@@ -968,7 +1118,14 @@ void MulticoreJitProfilePlayer::CompileMethodInfoRecord(Module *pModule, MethodD
 
         if (pMethod->GetNativeCode() == (PCODE)NULL && !GetAppDomain()->GetMulticoreJitManager().GetMulticoreJitCodeStorage().LookupMethodCode(pMethod))
         {
-            if (CompileMethodDesc(pModule, pMethod))
+            if (tier1Promoted && ShouldCompileAtTier1(pMethod))
+            {
+                // Optimized jitting is much slower than tier 0 jitting, leave it to the tier 1 workers at the end of the
+                // profile so that it does not delay the methods the application needs at startup
+                m_tier1Methods.Append(pMethod);
+                return;
+            }
+            else if (CompileMethodDesc(pModule, pMethod))
             {
                 return;
             }
@@ -983,6 +1140,186 @@ void MulticoreJitProfilePlayer::CompileMethodInfoRecord(Module *pModule, MethodD
     m_stats.m_nFilteredMethods++;
 }
 
+bool MulticoreJitProfilePlayer::ShouldCompileAtTier1(MethodDesc * pMethod) const
+{
+    STANDARD_VM_CONTRACT;
+
+#ifdef FEATURE_TIERED_COMPILATION
+    if (m_tier1WorkerCount == 0 || !pMethod->IsEligibleForTieredCompilation())
+    {
+        return false;
+    }
+
+#ifdef FEATURE_PGO
+    // With TieredPGO the tier 1 code is only as good as the profile it was jitted with, so without data persisted from a
+    // previous run the method is better off going through the instrumented tier as usual
+    if (g_pConfig->TieredPGO() && !PgoManager::HasPersistedPgoData(pMethod))
+    {
+        return false;
+    }
+#endif
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+// Jit the deferred tier 1 methods on the player thread and additional worker threads, and wait for the workers to finish,
+// as they use the player which is deleted when the player thread returns
+
+void MulticoreJitProfilePlayer::PlayTier1Methods()
+{
+    STANDARD_VM_CONTRACT;
+
+    COUNT_T count = m_tier1Methods.GetCount();
+
+    MulticoreJitTrace(("Tier1 playback of %d methods, up to %d threads", count, m_tier1WorkerCount));
+
+    m_nActiveTier1Workers = 1;
+
+    if (m_tier1WorkersDone.CreateManualEventNoThrow(FALSE))
+    {
+        for (unsigned i = 1; (i < m_tier1WorkerCount) && (i < count); i ++)
+        {
+            Tier1Worker & worker = m_tier1Workers[i];
+            worker.m_pPlayer = this;
+            worker.m_pThread = NULL;
+
+            InterlockedIncrement(& m_nActiveTier1Workers);
+
+            // Failing to create a worker is not a problem, the remaining threads jit its share of the methods
+            EX_TRY
+            {
+                worker.m_pThread = SetupUnstartedThread();
+                _ASSERTE(worker.m_pThread != NULL);
+
+                if (!worker.m_pThread->CreateNewThread(0, StaticTier1WorkerThreadProc, & worker, W(".NET MultiCoreJit Tier1 Worker")))
+                {
+                    worker.m_pThread->DecExternalCount(false);
+                    ThrowOutOfMemory();
+                }
+
+                worker.m_pThread->StartThread();
+            }
+            EX_CATCH
+            {
+                Tier1WorkerDone();
+            }
+            EX_END_CATCH(SwallowAllExceptions);
+        }
+    }
+
+    CompileTier1Methods();
+
+    if (InterlockedDecrement(& m_nActiveTier1Workers) != 0)
+    {
+        m_tier1WorkersDone.Wait(INFINITE, FALSE);
+    }
+
+    MulticoreJitTrace(("Tier1 playback compiled %d of %d methods", m_nTier1Compiled, count));
+
+    _FireEtwMulticoreJit(W("TIER1SUMMARY"), W(""), count, m_nTier1Compiled, m_tier1WorkerCount);
+}
+
+void MulticoreJitProfilePlayer::CompileTier1Methods()
+{
+    STANDARD_VM_CONTRACT;
+
+    MulticoreJitCodeStorage & curStorage = GetAppDomain()->GetMulticoreJitManager().GetMulticoreJitCodeStorage();
+
+    COUNT_T count = m_tier1Methods.GetCount();
+
+    // Reset the flag to allow managed code to be called in multicore JIT background thread from this routine
+    ThreadStateNCStackHolder holder(-1, Thread::TSNC_CallingManagedCodeDisabled);
+
+    while (! ShouldAbort(false))
+    {
+        COUNT_T index = (COUNT_T) (InterlockedIncrement(& m_nextTier1Method) - 1);
+
+        if (index >= count)
+        {
+            break;
+        }
+
+        MethodDesc * pMethod = m_tier1Methods[index];
+
+        // The application may have called the method since it was deferred
+        if (pMethod->GetNativeCode() != (PCODE)NULL || curStorage.LookupMethodCode(pMethod))
+        {
+            continue;
+        }
+
+        EX_TRY
+        {
+            // PrepareCode calls back to MulticoreJitCodeStorage::StoreMethodCode under MethodDesc lock
+            MulticoreJitPrepareCodeConfig config(pMethod, true);
+            pMethod->PrepareCode(&config);
+
+            InterlockedIncrement(& m_nTier1Compiled);
+        }
+        EX_CATCH
+        {
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+    }
+}
+
+void MulticoreJitProfilePlayer::Tier1WorkerDone()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // The player may be deleted as soon as the event is set
+    if (InterlockedDecrement(& m_nActiveTier1Workers) == 0)
+    {
+        m_tier1WorkersDone.Set();
+    }
+}
+
+DWORD WINAPI MulticoreJitProfilePlayer::StaticTier1WorkerThreadProc(void *args)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+        ENTRY_POINT;
+        INJECT_FAULT(COMPlusThrowOM(););
+    }
+    CONTRACTL_END;
+
+    Tier1Worker * pWorker = (Tier1Worker *) args;
+    MulticoreJitProfilePlayer * pPlayer = pWorker->m_pPlayer;
+    Thread * pThread = pWorker->m_pThread;
+
+    if (pThread->HasStarted())
+    {
+        {
+            // Same setup as the player thread
+            ThreadStateNCStackHolder holder(TRUE, Thread::TSNC_CallingManagedCodeDisabled);
+
+            pThread->SetBackground(TRUE);
+
+            EX_TRY
+            {
+                GCX_PREEMP();
+
+                pPlayer->CompileTier1Methods();
+            }
+            EX_CATCH
+            {
+            }
+            EX_END_CATCH(SwallowAllExceptions);
+        }
+
+        DestroyThread(pThread);
+    }
+
+    pPlayer->Tier1WorkerDone();
+
+    return 0;
+}
+
 void MulticoreJitProfilePlayer::TraceSummary()
 {
     LIMITED_METHOD_CONTRACT;
@@ -1050,10 +1387,11 @@ HRESULT MulticoreJitProfilePlayer::ReadCheckFile(const WCHAR * pFileName)
         else
         {
             m_headerModuleCount = header.moduleCount;
+            m_fProfileHasTypes = header.version == MULTICOREJIT_PROFILE_VERSION_TYPES;
 
             MulticoreJitTrace(("HeaderRecord(version=%d, module=%d, method=%d)", header.version, m_headerModuleCount, header.methodCount));
 
-            if ((header.version != MULTICOREJIT_PROFILE_VERSION) || (header.moduleCount > MAX_MODULES) || (header.methodCount > MAX_METHODS) ||
+            if (((header.version != MULTICOREJIT_PROFILE_VERSION) && !m_fProfileHasTypes) || (header.moduleCount > MAX_MODULES) || (header.methodCount > MAX_METHODS) ||
                 (header.recordID != Pack8_24(MULTICOREJIT_HEADER_RECORD_ID, sizeof(HeaderRecord))))
             {
                 hr = COR_E_BADIMAGEFORMAT;
@@ -1152,7 +1490,7 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
         {
             rcdLen = 2 * sizeof(unsigned);
         }
-        else if (rcdTyp == MULTICOREJIT_GENERICMETHOD_RECORD_ID)
+        else if (rcdTyp == MULTICOREJIT_GENERICMETHOD_RECORD_ID || (rcdTyp == MULTICOREJIT_GENERICTYPE_RECORD_ID && m_fProfileHasTypes))
         {
             if (nSize < sizeof(unsigned) + sizeof(unsigned short))
             {
@@ -1200,6 +1538,13 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
 
             hr = HandleModuleInfoRecord(moduleIndex, level);
         }
+        else if (rcdTyp == MULTICOREJIT_GENERICTYPE_RECORD_ID)
+        {
+            unsigned moduleIndex = data1 & MODULE_MASK;
+            unsigned signatureLength = * (const unsigned short *) (((const unsigned *) pBuffer) + 1);
+
+            hr = HandleGenericTypeInfoRecord(moduleIndex, (BYTE *) (pBuffer + sizeof(unsigned) + sizeof(unsigned short)), signatureLength);
+        }
         else if (rcdTyp == MULTICOREJIT_METHOD_RECORD_ID || rcdTyp == MULTICOREJIT_GENERICMETHOD_RECORD_ID)
         {
             // Find all subsequent methods and jit/load them reversed
@@ -1275,7 +1620,7 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
                 {
                     unsigned token = * (((const unsigned *) pCurBuf) + 1);
 
-                    hr = HandleNonGenericMethodInfoRecord(curmoduleIndex, token);
+                    hr = HandleNonGenericMethodInfoRecord(curmoduleIndex, token, (curdata1 & JIT_TIER1_PROMOTED_TAG) != 0);
                 }
                 else
                 {
@@ -1283,7 +1628,7 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
 
                     unsigned cursignatureLength = * (const unsigned short *) (((const unsigned *) pCurBuf) + 1);
 
-                    hr = HandleGenericMethodInfoRecord(curmoduleIndex, (BYTE *) (pCurBuf + sizeof(unsigned) + sizeof(unsigned short)), cursignatureLength);
+                    hr = HandleGenericMethodInfoRecord(curmoduleIndex, (BYTE *) (pCurBuf + sizeof(unsigned) + sizeof(unsigned short)), cursignatureLength, (curdata1 & JIT_TIER1_PROMOTED_TAG) != 0);
                 }
 
                 if (SUCCEEDED(hr) && ShouldAbort(false))
@@ -1311,6 +1656,11 @@ HRESULT MulticoreJitProfilePlayer::PlayProfile()
         }
     }
 
+    if (SUCCEEDED(hr) && (m_tier1Methods.GetCount() > 0))
+    {
+        PlayTier1Methods();
+    }
+
     start = GetTickCount() - start;
 
     {
@@ -1421,6 +1771,12 @@ HRESULT MulticoreJitProfilePlayer::ProcessProfile(const WCHAR * pFileName)
 
     if (SUCCEEDED(hr))
     {
+        // Leave at least one processor to the application threads
+        unsigned maxWorkers = (unsigned) max(GetCurrentProcessCpuCount() - 1, 1);
+        m_tier1WorkerCount = min(min((unsigned) CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MultiCoreJitTier1Workers), maxWorkers), MAX_TIER1_WORKERS);
+        m_fPreResolveHelperCells = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MultiCoreJitPreResolveHelperCells) != 0;
+        m_fPrefetchAssemblies = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_MultiCoreJitPrefetchAssemblies) != 0;
+
         _ASSERTE(m_pThread == NULL);
 
         m_pThread = SetupUnstartedThread();
@@ -19,6 +19,9 @@ int OnStackReplacementManager::s_patchpointId = 0;
 
 #ifndef DACCESS_COMPILE
 
+OsrCompilationRequest* OnStackReplacementManager::s_pendingRequests = NULL;
+LONG OnStackReplacementManager::s_isBackgroundWorkerRunning = 0;
+
 void OnStackReplacementManager::StaticInitialize()
 {
     WRAPPER_NO_CONTRACT;
@@ -76,6 +79,217 @@ PerPatchpointInfo* OnStackReplacementManager::GetPerPatchpointInfo(PCODE ip)
     return ppInfo;
 }
 
+bool OnStackReplacementManager::ScheduleBackgroundCompilation(MethodDesc* pMD, PCODE tier0Code, int ilOffset, PerPatchpointInfo* ppInfo)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    // The request refers to the method and patchpoint info after the Tier0 method
+    // has returned, so they must not be collected while it is pending.
+    _ASSERTE(!pMD->GetLoaderAllocator()->IsCollectible());
+
+    OsrCompilationRequest* request = new (nothrow) OsrCompilationRequest();
+    if (request == NULL)
+    {
+        return false;
+    }
+
+    request->m_pMD = pMD;
+    request->m_tier0Code = tier0Code;
+    request->m_ilOffset = ilOffset;
+    request->m_ppInfo = ppInfo;
+
+    OsrCompilationRequest* head;
+    do
+    {
+        head = VolatileLoad(&s_pendingRequests);
+        request->m_next = head;
+    }
+    while (InterlockedCompareExchangeT(&s_pendingRequests, request, head) != head);
+
+    if (InterlockedCompareExchange(&s_isBackgroundWorkerRunning, 1, 0) == 0)
+    {
+        if (!CreateBackgroundWorker())
+        {
+            // No worker, so create the queued methods on this thread. They become
+            // available the next time their patchpoints are hit.
+            DoBackgroundWork();
+        }
+    }
+
+    return true;
+}
+
+bool OnStackReplacementManager::CreateBackgroundWorker()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(s_isBackgroundWorkerRunning != 0);
+
+    bool created = false;
+
+    EX_TRY
+    {
+        Thread *newThread = SetupUnstartedThread();
+        _ASSERTE(newThread != nullptr);
+    #ifdef FEATURE_COMINTEROP
+        newThread->SetApartment(Thread::AS_InMTA);
+    #endif
+        newThread->SetBackground(true);
+
+        if (newThread->CreateNewThread(0, BackgroundWorkerBootstrapper0, newThread, W(".NET OSR Compilation Worker")))
+        {
+            newThread->StartThread();
+            created = true;
+        }
+        else
+        {
+            newThread->DecExternalCount(false);
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(RethrowTerminalExceptions);
+
+    return created;
+}
+
+DWORD WINAPI OnStackReplacementManager::BackgroundWorkerBootstrapper0(LPVOID args)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(args != nullptr);
+    Thread *thread = (Thread *)args;
+
+    if (!thread->HasStarted())
+    {
+        // Pending requests stay queued; the next patchpoint to schedule one will
+        // try to start a worker again.
+        InterlockedExchange(&s_isBackgroundWorkerRunning, 0);
+        return 0;
+    }
+
+    _ASSERTE(GetThread() == thread);
+    ManagedThreadBase::KickOff(BackgroundWorkerBootstrapper1, nullptr);
+
+    GCX_PREEMP_NO_DTOR();
+
+    DestroyThread(thread);
+    return 0;
+}
+
+void OnStackReplacementManager::BackgroundWorkerBootstrapper1(LPVOID)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    GCX_PREEMP();
+    DoBackgroundWork();
+}
+
+// Creates OSR methods until there are no more pending requests.
+//
+// Called with s_isBackgroundWorkerRunning set; clears it before returning.
+void OnStackReplacementManager::DoBackgroundWork()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    while (true)
+    {
+        OsrCompilationRequest* request = InterlockedExchangeT(&s_pendingRequests, (OsrCompilationRequest*)NULL);
+
+        if (request == NULL)
+        {
+            // A request may have been queued after the exchange above, by a thread that
+            // saw the worker still running. Pick it up unless another worker already has.
+            InterlockedExchange(&s_isBackgroundWorkerRunning, 0);
+
+            if ((VolatileLoad(&s_pendingRequests) == NULL) ||
+                (InterlockedCompareExchange(&s_isBackgroundWorkerRunning, 1, 0) != 0))
+            {
+                return;
+            }
+
+            continue;
+        }
+
+        while (request != NULL)
+        {
+            OsrCompilationRequest* next = request->m_next;
+            CompileOsrMethod(request);
+            delete request;
+            request = next;
+        }
+    }
+}
+
+void OnStackReplacementManager::CompileOsrMethod(OsrCompilationRequest* request)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    PerPatchpointInfo* ppInfo = request->m_ppInfo;
+    PCODE osrMethodCode = (PCODE)NULL;
+
+    EX_TRY
+    {
+        EECodeInfo codeInfo(request->m_tier0Code);
+        osrMethodCode = JitPatchpointWorker(request->m_pMD, codeInfo, request->m_ilOffset);
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(RethrowTerminalExceptions);
+
+    if (osrMethodCode == (PCODE)NULL)
+    {
+        // Unexpected, but not fatal
+        STRESS_LOG2(LF_TIEREDCOMPILATION, LL_WARNING, "OnStackReplacementManager: background OSR method creation failed,"
+            " marking patchpoint invalid for Method=0x%pM il offset %d\n", request->m_pMD, request->m_ilOffset);
+
+        InterlockedOr(&ppInfo->m_flags, (LONG)PerPatchpointInfo::patchpoint_invalid);
+        return;
+    }
+
+    // Publish the method; the Tier0 method transitions the next time it hits the patchpoint.
+    _ASSERTE(ppInfo->m_osrMethodCode == (PCODE)NULL);
+    VolatileStore(&ppInfo->m_osrMethodCode, osrMethodCode);
+}
+
 #endif // !DACCESS_COMPILE
 
 #endif // FEATURE_ON_STACK_REPLACEMENT
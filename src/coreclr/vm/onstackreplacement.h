@@ -53,6 +53,25 @@ struct PerPatchpointInfo
 typedef DPTR(PerPatchpointInfo) PTR_PerPatchpointInfo;
 typedef EEPtrHashTable JitPatchpointTable;
 
+#ifndef DACCESS_COMPILE
+class EECodeInfo;
+class MethodDesc;
+
+// Jits the OSR version of the method for the patchpoint at ilOffset in the
+// Tier0 code described by codeInfo. Returns NULL if the method can't be created.
+PCODE JitPatchpointWorker(MethodDesc* pMD, EECodeInfo& codeInfo, int ilOffset);
+
+// A patchpoint whose OSR method is waiting to be jitted by the background worker.
+struct OsrCompilationRequest
+{
+    MethodDesc* m_pMD;
+    PCODE m_tier0Code;
+    int m_ilOffset;
+    PerPatchpointInfo* m_ppInfo;
+    OsrCompilationRequest* m_next;
+};
+#endif // !DACCESS_COMPILE
+
 // OnStackReplacementManager keeps track of mapping from patchpoint id to 
 // per patchpoint info.
 //
@@ -73,6 +92,20 @@ public:
 
 public:
     PerPatchpointInfo* GetPerPatchpointInfo(PCODE ip);
+
+public:
+    // Queues creation of the OSR method for a triggered patchpoint, so the Tier0
+    // method can keep running until the method is available. Returns false if the
+    // request can't be queued, in which case the caller should create the method
+    // itself.
+    static bool ScheduleBackgroundCompilation(MethodDesc* pMD, PCODE tier0Code, int ilOffset, PerPatchpointInfo* ppInfo);
+
+private:
+    static bool CreateBackgroundWorker();
+    static DWORD WINAPI BackgroundWorkerBootstrapper0(LPVOID args);
+    static void BackgroundWorkerBootstrapper1(LPVOID args);
+    static void DoBackgroundWork();
+    static void CompileOsrMethod(OsrCompilationRequest* request);
 #endif // DACCESS_COMPILE
 
 private:
@@ -84,6 +117,11 @@ private:
 
     static CrstStatic s_lock;
 
+#ifndef DACCESS_COMPILE
+    static OsrCompilationRequest* s_pendingRequests;
+    static LONG s_isBackgroundWorkerRunning;
+#endif
+
 #if _DEBUG
     static int s_patchpointId;
 #endif
@@ -11,6 +11,7 @@
 
 #include "peimage.h"
 #include "../dlls/mscorrc/resource.h"
+#include "startupsummary.h"
 
 inline ULONG PEImage::AddRef()
 {
@@ -323,6 +324,7 @@ inline PTR_PEImage PEImage::OpenImage(LPCWSTR pPath, MDInternalImportFlags flags
     {
         PEImageHolder pImage(new PEImage);
         pImage->Init(pPath, bundleFileLocation);
+        StartupSummary::OnFileOpened();
         return dac_cast<PTR_PEImage>(pImage.Extract());
     }
 
@@ -339,6 +341,7 @@ inline PTR_PEImage PEImage::OpenImage(LPCWSTR pPath, MDInternalImportFlags flags
 
         PEImageHolder pImage(new PEImage);
         pImage->Init(pPath, bundleFileLocation);
+        StartupSummary::OnFileOpened();
 
         pImage->AddToHashMap();
         return dac_cast<PTR_PEImage>(pImage.Extract());
@@ -18,6 +18,12 @@
 
 #define FMT_CODE_ADDR "%p"
 
+// How often the writer thread writes out queued lines if nobody is waiting on it.
+#define PERFMAP_WRITER_FLUSH_INTERVAL_MS 100
+
+// Smallest ring buffer we use for queued lines, no line is expected to be longer than this.
+#define PERFMAP_MIN_RING_BUFFER_SIZE (64 * 1024)
+
 #ifndef __ANDROID__
 #define TEMP_DIRECTORY_PATH "/tmp"
 #else
@@ -28,8 +34,10 @@
 
 Volatile<bool> PerfMap::s_enabled = false;
 PerfMap * PerfMap::s_Current = nullptr;
+CLREvent * PerfMap::s_WriterDrainedEvent = nullptr;
 bool PerfMap::s_ShowOptimizationTiers = false;
 unsigned PerfMap::s_StubsMapped = 0;
+bool PerfMap::s_EmitJitDumpDebugInfo = false;
 CrstStatic PerfMap::s_csPerfMap;
 
 // Initialize the map for the process - called from EEStartupHelper.
@@ -88,6 +96,13 @@ void PerfMap::Enable(PerfMapType type, bool sendExisting)
 
             int currentPid = GetCurrentProcessId();
             s_Current->OpenFileForPid(currentPid, basePath);
+
+            DWORD bufferSizeKB = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapBufferSize);
+            if (bufferSizeKB != 0)
+            {
+                s_Current->StartWriterThread(max((size_t)PERFMAP_MIN_RING_BUFFER_SIZE, (size_t)bufferSizeKB * 1024));
+            }
+
             s_enabled = true;
         }
 
@@ -99,6 +114,11 @@ void PerfMap::Enable(PerfMapType type, bool sendExisting)
             {
                 s_ShowOptimizationTiers = true;
             }
+
+            if (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapJitDumpDebugInfo) != 0)
+            {
+                s_EmitJitDumpDebugInfo = true;
+            }
             
             s_enabled = true;
         }
@@ -181,17 +201,22 @@ void PerfMap::Disable()
 
     if (s_enabled)
     {
-        CrstHolder ch(&(s_csPerfMap));
+        PerfMap * pCurrent = nullptr;
 
-        s_enabled = false;
-        if (s_Current != nullptr)
         {
-            delete s_Current;
+            CrstHolder ch(&(s_csPerfMap));
+
+            s_enabled = false;
+            pCurrent = s_Current;
             s_Current = nullptr;
+
+            // PAL_PerfJitDump_Finish is lock protected and can safely be called multiple times
+            PAL_PerfJitDump_Finish();
         }
 
-        // PAL_PerfJitDump_Finish is lock protected and can safely be called multiple times
-        PAL_PerfJitDump_Finish();
+        // The writer thread takes s_csPerfMap to drain the queued lines, so the map
+        // has to be deleted outside of the lock.
+        delete pCurrent;
     }
 }
 
@@ -200,8 +225,21 @@ PerfMap::PerfMap()
 {
     LIMITED_METHOD_CONTRACT;
 
+    m_FileStream = nullptr;
+
     // Initialize with no failures.
     m_ErrorEncountered = false;
+
+    m_FileSize = 0;
+    m_MaxFileSize = (size_t)CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_PerfMapMaxFileSize) * 1024 * 1024;
+
+    m_RingBuffer = nullptr;
+    m_RingBufferSize = 0;
+    m_RingBufferStart = 0;
+    m_RingBufferCount = 0;
+    m_WriterBuffer = nullptr;
+    m_WriterThread = NULL;
+    m_WriterShutdown = false;
 }
 
 // Clean-up resources.
@@ -209,6 +247,21 @@ PerfMap::~PerfMap()
 {
     LIMITED_METHOD_CONTRACT;
 
+    if (m_WriterThread != NULL)
+    {
+        // The writer thread drains the ring buffer before it exits.
+        m_WriterShutdown = true;
+        m_WriterWakeEvent.Set();
+        WaitForSingleObject(m_WriterThread, INFINITE);
+        CloseHandle(m_WriterThread);
+        m_WriterThread = NULL;
+    }
+
+    delete [] m_RingBuffer;
+    m_RingBuffer = nullptr;
+    delete [] m_WriterBuffer;
+    m_WriterBuffer = nullptr;
+
     delete m_FileStream;
     m_FileStream = nullptr;
 }
@@ -217,11 +270,128 @@ void PerfMap::OpenFileForPid(int pid, const char* basePath)
 {
     SString fullPath;
     fullPath.Printf("%s/perf-%d.map", basePath, pid);
+    m_FilePath.Set(fullPath);
 
     // Open the map file for writing.
     OpenFile(fullPath);
 }
 
+void PerfMap::StartWriterThread(size_t bufferSize)
+{
+    STANDARD_VM_CONTRACT;
+    _ASSERTE(s_csPerfMap.OwnedByCurrentThread());
+
+    if (m_FileStream == nullptr)
+    {
+        return;
+    }
+
+    // If anything here fails we simply keep writing the map synchronously.
+    if (s_WriterDrainedEvent == nullptr)
+    {
+        CLREvent * pEvent = new (nothrow) CLREvent();
+        if (pEvent == nullptr || !pEvent->CreateManualEventNoThrow(FALSE))
+        {
+            delete pEvent;
+            return;
+        }
+
+        s_WriterDrainedEvent = pEvent;
+    }
+
+    m_RingBuffer = new (nothrow) char[bufferSize];
+    m_WriterBuffer = new (nothrow) char[bufferSize];
+    if (m_RingBuffer == nullptr || m_WriterBuffer == nullptr || !m_WriterWakeEvent.CreateAutoEventNoThrow(FALSE))
+    {
+        delete [] m_RingBuffer;
+        m_RingBuffer = nullptr;
+        delete [] m_WriterBuffer;
+        m_WriterBuffer = nullptr;
+        return;
+    }
+
+    m_WriterThread = Thread::CreateUtilityThread(Thread::StackSize_Small, WriterThreadStart, this, W(".NET Perf Map Writer"));
+    if (m_WriterThread == NULL)
+    {
+        delete [] m_RingBuffer;
+        m_RingBuffer = nullptr;
+        delete [] m_WriterBuffer;
+        m_WriterBuffer = nullptr;
+        return;
+    }
+
+    m_RingBufferSize = bufferSize;
+}
+
+DWORD WINAPI PerfMap::WriterThreadStart(void * args)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    PerfMap * pMap = (PerfMap *)args;
+
+    while (true)
+    {
+        pMap->m_WriterWakeEvent.Wait(PERFMAP_WRITER_FLUSH_INTERVAL_MS, FALSE);
+
+        // Read the flag before draining so that we don't miss lines queued before shutdown.
+        bool shutdown = pMap->m_WriterShutdown;
+
+        pMap->DrainRingBuffer();
+
+        if (shutdown)
+        {
+            break;
+        }
+    }
+
+    return 0;
+}
+
+void PerfMap::DrainRingBuffer()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    while (true)
+    {
+        size_t count;
+
+        {
+            CrstHolder ch(&(s_csPerfMap));
+
+            count = m_RingBufferCount;
+            if (count == 0)
+            {
+                return;
+            }
+
+            // Copy out the queued bytes, which may wrap around the end of the ring buffer.
+            size_t firstPart = min(count, m_RingBufferSize - m_RingBufferStart);
+            memcpy(m_WriterBuffer, m_RingBuffer + m_RingBufferStart, firstPart);
+            memcpy(m_WriterBuffer + firstPart, m_RingBuffer, count - firstPart);
+
+            m_RingBufferStart = (m_RingBufferStart + count) % m_RingBufferSize;
+            m_RingBufferCount = 0;
+
+            // Release the threads waiting for room in the ring buffer.
+            s_WriterDrainedEvent->Set();
+        }
+
+        WriteToFile(m_WriterBuffer, (ULONG)count);
+    }
+}
+
 // Open the specified destination map file.
 void PerfMap::OpenFile(SString& path)
 {
@@ -241,7 +411,7 @@ void PerfMap::OpenFile(SString& path)
 }
 
 // Write a line to the map file.
-void PerfMap::WriteLine(SString& line)
+bool PerfMap::WriteLine(SString& line)
 {
     STANDARD_VM_CONTRACT;
 #ifdef _DEBUG
@@ -250,29 +420,140 @@ void PerfMap::WriteLine(SString& line)
 
     if (m_FileStream == nullptr || m_ErrorEncountered)
     {
-        return;
+        return true;
+    }
+
+    const char * strLine = line.GetUTF8();
+    ULONG count = line.GetCount();
+
+    if (m_RingBuffer == nullptr)
+    {
+        WriteToFile(strLine, count);
+        return true;
+    }
+
+    if (count > m_RingBufferSize)
+    {
+        // Can't ever fit, drop it rather than block forever.
+        return true;
     }
 
+    if (count > m_RingBufferSize - m_RingBufferCount)
+    {
+        return false;
+    }
+
+    // Queue the line, it may wrap around the end of the ring buffer.
+    size_t end = (m_RingBufferStart + m_RingBufferCount) % m_RingBufferSize;
+    size_t firstPart = min((size_t)count, m_RingBufferSize - end);
+    memcpy(m_RingBuffer + end, strLine, firstPart);
+    memcpy(m_RingBuffer, strLine + firstPart, count - firstPart);
+    m_RingBufferCount += count;
+
+    // Wake the writer early once the buffer is half full so that we rarely have to wait for it.
+    if (m_RingBufferCount > m_RingBufferSize / 2)
+    {
+        m_WriterWakeEvent.Set();
+    }
+
+    return true;
+}
+
+// Either called under s_csPerfMap, or from the writer thread which is then the only one touching the file.
+void PerfMap::WriteToFile(const char * data, ULONG count)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
     EX_TRY
     {
-        // Write the line.
-        // The PAL already takes a lock when writing, so we don't need to do so here.
-        const char * strLine = line.GetUTF8();
-        ULONG inCount = line.GetCount();
-        ULONG outCount;
-        m_FileStream->Write(strLine, inCount, &outCount);
-
-        if (inCount != outCount)
+        if (m_MaxFileSize != 0 && m_FileSize != 0 && m_FileSize + count > m_MaxFileSize)
         {
-            // This will cause us to stop writing to the file.
-            // The file will still remain open until shutdown so that we don't have to take a lock at this level when we touch the file stream.
-            m_ErrorEncountered = true;
+            RotateFile();
         }
 
+        if (m_FileStream != nullptr && !m_ErrorEncountered)
+        {
+            // Write the line.
+            // The PAL already takes a lock when writing, so we don't need to do so here.
+            ULONG outCount;
+            m_FileStream->Write(data, count, &outCount);
+            m_FileSize += outCount;
+
+            if (count != outCount)
+            {
+                // This will cause us to stop writing to the file.
+                // The file will still remain open until shutdown so that we don't have to take a lock at this level when we touch the file stream.
+                m_ErrorEncountered = true;
+            }
+        }
     }
     EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
 }
 
+// Keep the previous map around as perf-<pid>.map.old, so that a long running process with collectible
+// code doesn't grow its map without bound.
+void PerfMap::RotateFile()
+{
+    STANDARD_VM_CONTRACT;
+
+    delete m_FileStream;
+    m_FileStream = nullptr;
+    m_FileSize = 0;
+
+    SString oldPath(m_FilePath);
+    oldPath.Append(W(".old"));
+    MoveFileExW(m_FilePath.GetUnicode(), oldPath.GetUnicode(), MOVEFILE_REPLACE_EXISTING);
+
+    OpenFile(m_FilePath);
+}
+
+static BYTE* PerfMapDebugInfoStoreNew(void * pData, size_t cBytes)
+{
+    return new BYTE[cBytes];
+}
+
+void PerfMap::LogLineAndJitDump(SString & line, PCODE pCode, size_t codeSize, const char * symbol, PAL_PerfJitDumpDebugInfo * debugInfo)
+{
+    STANDARD_VM_CONTRACT;
+
+    bool loggedToJitDump = false;
+
+    while (true)
+    {
+        PerfMap * pMap;
+
+        {
+            CrstHolder ch(&(s_csPerfMap));
+
+            if (!loggedToJitDump)
+            {
+                PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, symbol, debugInfo, nullptr);
+                loggedToJitDump = true;
+            }
+
+            pMap = s_Current;
+            if (pMap == nullptr || pMap->WriteLine(line))
+            {
+                return;
+            }
+
+            // The ring buffer is full, let the writer catch up. The drained event is reset under the lock
+            // so that a drain that happens before we start waiting still releases us.
+            s_WriterDrainedEvent->Reset();
+            pMap->m_WriterWakeEvent.Set();
+        }
+
+        // The event outlives the map, which may be deleted by Disable() while we wait.
+        s_WriterDrainedEvent->Wait(PERFMAP_WRITER_FLUSH_INTERVAL_MS, FALSE);
+    }
+}
+
 void PerfMap::LogJITCompiledMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, PrepareCodeConfig *pConfig)
 {
     LIMITED_METHOD_CONTRACT;
@@ -312,16 +593,46 @@ void PerfMap::LogJITCompiledMethod(MethodDesc * pMethod, PCODE pCode, size_t cod
         SString line;
         line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, name.GetUTF8());
 
+        // Map native code to IL offsets for the jitdump, perf reports them as line numbers of a "file"
+        // named after the method.
+        PAL_PerfJitDumpDebugInfo debugInfo = {};
+        NewArrayHolder<PAL_PerfJitDumpLineInfo> lines;
+        // The boundaries are allocated as bytes by PerfMapDebugInfoStoreNew, so they are freed as such.
+        NewArrayHolder<BYTE> mapBuffer(NULL);
+        ICorDebugInfo::OffsetMapping * map = NULL;
+        if (s_EmitJitDumpDebugInfo && PAL_PerfJitDump_IsStarted())
         {
-            CrstHolder ch(&(s_csPerfMap));
+            DebugInfoRequest request;
+            request.InitFromStartingAddr(pMethod, PCODEToPINSTR(pCode));
 
-            if(s_Current != nullptr)
+            ULONG32 cMap = 0;
+            BOOL gotBoundaries = DebugInfoManager::GetBoundariesAndVars(request, PerfMapDebugInfoStoreNew, nullptr, &cMap, &map, nullptr, nullptr);
+            mapBuffer = (BYTE *)map;
+            if (gotBoundaries && cMap > 0)
             {
-                s_Current->WriteLine(line);
-            }
+                lines = new PAL_PerfJitDumpLineInfo[cMap];
+
+                size_t lineCount = 0;
+                for (ULONG32 i = 0; i < cMap; i++)
+                {
+                    // Skip prolog, epilog and no-mapping entries, they don't have an IL offset.
+                    if ((int32_t)map[i].ilOffset < 0 || map[i].nativeOffset >= codeSize)
+                    {
+                        continue;
+                    }
+
+                    lines[lineCount].pCode = (void*)(pCode + map[i].nativeOffset);
+                    lines[lineCount].lineNumber = (int)map[i].ilOffset;
+                    lineCount++;
+                }
 
-            PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetUTF8(), nullptr, nullptr);
+                debugInfo.fileName = name.GetUTF8();
+                debugInfo.lineCount = lineCount;
+                debugInfo.lines = lines;
+            }
         }
+
+        LogLineAndJitDump(line, pCode, codeSize, name.GetUTF8(), (debugInfo.lineCount > 0) ? &debugInfo : nullptr);
     }
     EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
 
@@ -408,16 +719,7 @@ void PerfMap::LogStubs(const char* stubType, const char* stubOwner, PCODE pCode,
         SString line;
         line.Printf(FMT_CODE_ADDR " %x %s\n", pCode, codeSize, name.GetUTF8());
 
-        {
-            CrstHolder ch(&(s_csPerfMap));
-
-            if(s_Current != nullptr)
-            {
-                s_Current->WriteLine(line);
-            }
-
-            PAL_PerfJitDump_LogMethod((void*)pCode, codeSize, name.GetUTF8(), nullptr, nullptr);
-        }
+        LogLineAndJitDump(line, pCode, codeSize, name.GetUTF8(), nullptr);
     }
     EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
 }
@@ -25,22 +25,69 @@ private:
     // Set to true if an error is encountered when writing to the file.
     static unsigned s_StubsMapped;
 
+    // Indicates whether IL offset maps should be written to the jitdump file
+    static bool s_EmitJitDumpDebugInfo;
+
     static CrstStatic s_csPerfMap;
 
+    // Set by the writer thread whenever it empties the ring buffer, threads wait on it when the buffer is full.
+    static CLREvent * s_WriterDrainedEvent;
+
     // The file stream to write the map to.
     CFileStream * m_FileStream;
 
     // Set to true if an error is encountered when writing to the file.
     bool m_ErrorEncountered;
 
+    // Path of the map file, needed to rotate it.
+    SString m_FilePath;
+
+    // Number of bytes written to the current map file.
+    size_t m_FileSize;
+
+    // Once the map file grows past this many bytes it is rotated, 0 for no limit.
+    size_t m_MaxFileSize;
+
+    // When the writer thread is running, lines are queued in this ring buffer under s_csPerfMap
+    // and the writer thread is the only one that touches m_FileStream.
+    char * m_RingBuffer;
+    size_t m_RingBufferSize;
+    size_t m_RingBufferStart;
+    size_t m_RingBufferCount;
+
+    // Lines are copied out of the ring buffer into this one so that the file is written outside s_csPerfMap.
+    char * m_WriterBuffer;
+
+    HANDLE m_WriterThread;
+    CLREvent m_WriterWakeEvent;
+    Volatile<bool> m_WriterShutdown;
+
     // Construct a new map
     PerfMap();
 
     // Open a perfmap map for the specified pid
     void OpenFileForPid(int pid, const char* basePath);
 
-    // Write a line to the map file.
-    void WriteLine(SString & line);
+    // Queue up lines in a ring buffer of the given size and write them from a background thread.
+    void StartWriterThread(size_t bufferSize);
+
+    static DWORD WINAPI WriterThreadStart(void * args);
+
+    // Write whatever is queued in the ring buffer to the file.
+    void DrainRingBuffer();
+
+    // Write a line to the map file, or queue it if the writer thread is running.
+    // Returns false if the ring buffer is full.
+    bool WriteLine(SString & line);
+
+    // Write raw bytes to the map file, rotating it if it grew too large.
+    void WriteToFile(const char * data, ULONG count);
+
+    // Move the map file aside and start a new one.
+    void RotateFile();
+
+    // Write a line to the current map, if any, and log the code to the jitdump file.
+    static void LogLineAndJitDump(SString & line, PCODE pCode, size_t codeSize, const char * symbol, PAL_PerfJitDumpDebugInfo * debugInfo);
 
     // Default to /tmp or use DOTNET_PerfMapJitDumpPath if set
     static const char* InternalConstructPath();
@@ -60,9 +60,11 @@ void PgoManager::Initialize()
     STANDARD_VM_CONTRACT;
 
     s_pgoMgrLock.Init(CrstLeafLock, CRST_DEFAULT);
+    s_persistedPgoMethodsLock.Init(CrstLeafLock, CRST_UNSAFE_ANYMODE);
 
     // If we're reading in counts, do that now
     ReadPgoData();
+    ReadPersistedPgoData();
 }
 
 void PgoManager::Shutdown()
@@ -73,6 +75,7 @@ void PgoManager::Shutdown()
     {
         written = true;
         WritePgoData();
+        WritePersistedPgoData();
     }
 }
 
@@ -586,41 +589,772 @@ void PgoManager::ReadPgoData()
 
         methods++;
 
-        UINT offsetOfActualInstrumentationData;
-        HRESULT hr = ComputeOffsetOfActualInstrumentationData(schemaElements.GetElements(), schemaCount, sizeof(Header), &offsetOfActualInstrumentationData);
-        if (FAILED(hr))
+        Header* methodData = CreatePgoDataFromSchemaAndData(methodhash, codehash, ilSize,
+                                                            schemaElements.GetElements(), schemaCount,
+                                                            methodInstrumentationData.GetElements(), methodInstrumentationData.GetCount());
+        if (methodData == NULL)
         {
             continue;
         }
-        UINT offsetOfInstrumentationDataFromStartOfDataRegion = offsetOfActualInstrumentationData - sizeof(Header);
 
-        // Adjust schema offsets to account for embedding the instrumentation schema in front of the data
-        for (unsigned iSchema = 0; iSchema < schemaCount; iSchema++)
+        s_textFormatPgoData.Add(methodData);
+        probes += schemaCount;
+    }
+}
+
+// Build a malloc'd Header holding the given schema and instrumentation data, in the
+// layout used by s_textFormatPgoData. The schema offsets are expected to be relative to
+// the start of the instrumentation data, and are updated in place to be relative to
+// the start of the Header data region instead.
+//
+PgoManager::Header* PgoManager::CreatePgoDataFromSchemaAndData(unsigned methodhash,
+                                                               unsigned codehash,
+                                                               unsigned ilSize,
+                                                               ICorJitInfo::PgoInstrumentationSchema* pSchema,
+                                                               UINT32 countSchemaItems,
+                                                               const uint8_t* pInstrumentationData,
+                                                               COUNT_T cbInstrumentationData)
+{
+    UINT offsetOfActualInstrumentationData;
+    HRESULT hr = ComputeOffsetOfActualInstrumentationData(pSchema, countSchemaItems, sizeof(Header), &offsetOfActualInstrumentationData);
+    if (FAILED(hr))
+    {
+        return NULL;
+    }
+    UINT offsetOfInstrumentationDataFromStartOfDataRegion = offsetOfActualInstrumentationData - sizeof(Header);
+
+    // Adjust schema offsets to account for embedding the instrumentation schema in front of the data
+    for (UINT32 iSchema = 0; iSchema < countSchemaItems; iSchema++)
+    {
+        pSchema[iSchema].Offset += offsetOfInstrumentationDataFromStartOfDataRegion;
+    }
+
+    S_SIZE_T allocationSize = S_SIZE_T(offsetOfActualInstrumentationData) + S_SIZE_T(cbInstrumentationData);
+    if (allocationSize.IsOverflow())
+    {
+        _ASSERTE(!"Unexpected overflow");
+        return NULL;
+    }
+
+    Header* methodData = (Header*)malloc(allocationSize.Value());
+    if (methodData == NULL)
+    {
+        return NULL;
+    }
+
+    methodData->HashInit(methodhash, codehash, ilSize, offsetOfInstrumentationDataFromStartOfDataRegion);
+
+    if (!WriteInstrumentationSchema(pSchema, countSchemaItems, methodData->GetData(), offsetOfInstrumentationDataFromStartOfDataRegion))
+    {
+        _ASSERTE(!"Unable to write schema");
+        free(methodData);
+        return NULL;
+    }
+
+    memcpy(((uint8_t*)methodData) + offsetOfActualInstrumentationData, pInstrumentationData, cbInstrumentationData);
+    return methodData;
+}
+
+// Binary format for dynamic PGO data persisted across process restarts (see
+// TieredPGO_PersistedProfilePath). The file is memory mapped at startup and only
+// the sorted method table is consulted up front; the data for an individual method
+// is decoded the first time the JIT asks for it.
+//
+//   PersistedPgoFileHeader
+//   PersistedPgoMethodEntry[MethodCount], sorted by (CodeHash, MethodHash)
+//   For each method:
+//     - the schema and data in the compressed format of SchemaAndDataWriter
+//     - a name table: NameCount UINT32 offsets (relative to the start of the table)
+//       followed by the null terminated UTF8 type and method names they refer to
+//
+// Entries are keyed by the version resilient IL body hash as well as the method hash,
+// so data for methods whose IL changed since the profile was written is never found.
+// Type and method handles are stored either as null or unknown handle values, or
+// as PERSISTED_PGO_NAME_HANDLE_BASE plus an index into the method's name table. The
+// names use the same format as the text format, and are resolved lazily in the same way.
+
+#define PERSISTED_PGO_SIGNATURE          0x4F475044 // 'DPGO'
+#define PERSISTED_PGO_VERSION            1
+#define PERSISTED_PGO_NAME_HANDLE_BASE   0x40
+#define PERSISTED_PGO_MAX_NAME_LENGTH    8192
+
+static_assert_no_msg(PERSISTED_PGO_NAME_HANDLE_BASE > UNKNOWN_HANDLE_MAX);
+
+struct PersistedPgoFileHeader
+{
+    UINT32 Signature;
+    UINT32 Version;
+    UINT32 MethodCount;
+    UINT32 Reserved;
+};
+
+struct PersistedPgoMethodEntry
+{
+    UINT32 CodeHash;
+    UINT32 MethodHash;
+    UINT32 ILSize;
+    UINT32 DataOffset;
+    UINT32 DataSize;
+    UINT32 NameTableOffset;
+    UINT32 NameTableSize;
+    UINT32 NameCount;
+};
+
+const BYTE* PgoManager::s_persistedPgoView;
+size_t PgoManager::s_persistedPgoViewSize;
+PtrSHash<PgoManager::Header, PgoManager::CodeAndMethodHash> PgoManager::s_persistedPgoData;
+CrstStatic PgoManager::s_persistedPgoMethodsLock;
+SetSHash<MethodDesc*> PgoManager::s_persistedPgoMethods;
+
+static int __cdecl ComparePersistedPgoMethodEntries(const void* a, const void* b)
+{
+    const PersistedPgoMethodEntry* entryA = (const PersistedPgoMethodEntry*)a;
+    const PersistedPgoMethodEntry* entryB = (const PersistedPgoMethodEntry*)b;
+
+    if (entryA->CodeHash != entryB->CodeHash)
+        return (entryA->CodeHash < entryB->CodeHash) ? -1 : 1;
+    if (entryA->MethodHash != entryB->MethodHash)
+        return (entryA->MethodHash < entryB->MethodHash) ? -1 : 1;
+    return 0;
+}
+
+static const PersistedPgoMethodEntry* FindPersistedPgoMethodEntry(const PersistedPgoMethodEntry* pEntries, UINT32 count, unsigned codehash, unsigned methodhash)
+{
+    PersistedPgoMethodEntry key = {};
+    key.CodeHash = codehash;
+    key.MethodHash = methodhash;
+
+    UINT32 low = 0;
+    UINT32 high = count;
+    while (low < high)
+    {
+        UINT32 mid = low + (high - low) / 2;
+        int compare = ComparePersistedPgoMethodEntries(&key, &pEntries[mid]);
+        if (compare == 0)
+            return &pEntries[mid];
+
+        if (compare < 0)
+            high = mid;
+        else
+            low = mid + 1;
+    }
+
+    return NULL;
+}
+
+static bool IsPersistedPgoMethodEntryInBounds(const PersistedPgoMethodEntry* pEntry, size_t cbView)
+{
+    S_SIZE_T dataEnd = S_SIZE_T(pEntry->DataOffset) + S_SIZE_T(pEntry->DataSize);
+    S_SIZE_T nameTableEnd = S_SIZE_T(pEntry->NameTableOffset) + S_SIZE_T(pEntry->NameTableSize);
+    S_SIZE_T nameOffsetsSize = S_SIZE_T(pEntry->NameCount) * S_SIZE_T(sizeof(UINT32));
+
+    return !dataEnd.IsOverflow() && (dataEnd.Value() <= cbView) &&
+           !nameTableEnd.IsOverflow() && (nameTableEnd.Value() <= cbView) &&
+           !nameOffsetsSize.IsOverflow() && (nameOffsetsSize.Value() <= pEntry->NameTableSize) &&
+           ((pEntry->NameTableOffset % sizeof(UINT32)) == 0);
+}
+
+// Decodes the data for one method from the mapped file into arrays in the same shape
+// ReadPgoData produces for the text format.
+class PersistedPgoDataReader
+{
+    const BYTE* m_pNameTable;
+    UINT32 m_cbNameTable;
+    UINT32 m_nameCount;
+    ICorJitInfo::PgoInstrumentationSchema m_lastSchema = {};
+
+public:
+    StackSArray<ICorJitInfo::PgoInstrumentationSchema> schemaArray;
+    StackSArray<uint8_t> instrumentationData;
+
+    PersistedPgoDataReader(const BYTE* pNameTable, UINT32 cbNameTable, UINT32 nameCount) :
+        m_pNameTable(pNameTable),
+        m_cbNameTable(cbNameTable),
+        m_nameCount(nameCount)
+    {}
+
+    bool operator()(const ICorJitInfo::PgoInstrumentationSchema &schema, int64_t dataItem, int32_t iDataItem)
+    {
+        if (iDataItem == 0)
         {
-            schemaElements[iSchema].Offset += offsetOfInstrumentationDataFromStartOfDataRegion;
+            ICorJitInfo::PgoInstrumentationSchema laidOutSchema = schema;
+            LayoutPgoInstrumentationSchema(m_lastSchema, &laidOutSchema);
+
+            S_UINT32 dataSize = S_UINT32(laidOutSchema.Offset) + S_UINT32(laidOutSchema.Count) * S_UINT32(InstrumentationKindToSize(laidOutSchema.InstrumentationKind));
+            if (dataSize.IsOverflow())
+            {
+                return false;
+            }
+
+            schemaArray.Append(laidOutSchema);
+            instrumentationData.SetCount(dataSize.Value());
+            m_lastSchema = laidOutSchema;
         }
 
-        S_SIZE_T allocationSize = S_SIZE_T(offsetOfActualInstrumentationData) + S_SIZE_T(methodInstrumentationData.GetCount());
-        if (allocationSize.IsOverflow())
+        uint8_t* pData = instrumentationData.OpenRawBuffer() + m_lastSchema.Offset + iDataItem * InstrumentationKindToSize(m_lastSchema.InstrumentationKind);
+        bool result = true;
+
+        switch (m_lastSchema.InstrumentationKind & ICorJitInfo::PgoInstrumentationKind::MarshalMask)
+        {
+            case ICorJitInfo::PgoInstrumentationKind::None:
+                break;
+            case ICorJitInfo::PgoInstrumentationKind::FourByte:
+                *(uint32_t*)pData = (uint32_t)dataItem;
+                break;
+            case ICorJitInfo::PgoInstrumentationKind::EightByte:
+                *(int64_t*)pData = dataItem;
+                break;
+            case ICorJitInfo::PgoInstrumentationKind::TypeHandle:
+            case ICorJitInfo::PgoInstrumentationKind::MethodHandle:
+            {
+                INT_PTR ptrVal = (INT_PTR)dataItem;
+                if (dataItem >= PERSISTED_PGO_NAME_HANDLE_BASE)
+                {
+                    ptrVal = 0;
+                    const char* name = GetName(dataItem - PERSISTED_PGO_NAME_HANDLE_BASE);
+                    if (name != NULL)
+                    {
+                        // As in ReadPgoData, copy the name out and tag it with the low bit so that it is
+                        // resolved to a TypeHandle or MethodDesc when the JIT first asks for this data.
+                        size_t nameLength = strlen(name) + 1;
+                        void* tempString = malloc(nameLength);
+                        if (tempString != NULL)
+                        {
+                            memcpy(tempString, name, nameLength);
+                            ptrVal = (INT_PTR)tempString + 1;
+                        }
+                    }
+                }
+                else if ((dataItem != 0) && !ICorJitInfo::IsUnknownHandle((intptr_t)dataItem))
+                {
+                    result = false;
+                }
+
+                *(INT_PTR*)pData = ptrVal;
+                break;
+            }
+            default:
+                result = false;
+                break;
+        }
+
+        instrumentationData.CloseRawBuffer();
+        return result;
+    }
+
+private:
+    const char* GetName(int64_t index)
+    {
+        if ((index < 0) || (index >= m_nameCount))
+        {
+            return NULL;
+        }
+
+        UINT32 nameOffset = ((const UINT32*)m_pNameTable)[index];
+        if ((nameOffset < m_nameCount * sizeof(UINT32)) || (nameOffset >= m_cbNameTable))
+        {
+            return NULL;
+        }
+
+        // The name must be null terminated within the table
+        const char* name = (const char*)(m_pNameTable + nameOffset);
+        if (memchr(name, 0, m_cbNameTable - nameOffset) == NULL)
+        {
+            return NULL;
+        }
+
+        return name;
+    }
+};
+
+// Encodes the live data collected in this process, as well as any persisted data that
+// this process did not supersede, into the persisted binary format.
+class PersistedPgoDataWriter
+{
+    StackSArray<PersistedPgoMethodEntry> m_entries;
+    StackSArray<uint8_t> m_data;
+    COUNT_T m_liveEntryCount = 0;
+
+public:
+    void AppendLiveMethod(PgoManager::HeaderList* pgoData)
+    {
+        const PgoManager::Header& header = pgoData->header;
+
+        // Dynamic methods have no identity that survives the process.
+        if (header.method->IsDynamicMethod())
+        {
+            return;
+        }
+
+        StackSArray<ICorJitInfo::PgoInstrumentationSchema> schemaArray;
+        if (!ReadInstrumentationSchemaWithLayoutIntoSArray(header.GetData(), header.SchemaSizeMax(), header.countsOffset, &schemaArray) ||
+            (schemaArray.GetCount() == 0))
         {
-            _ASSERTE(!"Unexpected overflow");
             return;
         }
 
-        Header* methodData = (Header*)malloc(allocationSize.Value());
-        methodData->HashInit(methodhash, codehash, ilSize, offsetOfInstrumentationDataFromStartOfDataRegion);
+        // Take a copy of the counts so that handles can be replaced by name indices
+        const ICorJitInfo::PgoInstrumentationSchema& lastSchema = schemaArray[schemaArray.GetCount() - 1];
+        COUNT_T dataSize = lastSchema.Offset + lastSchema.Count * InstrumentationKindToSize(lastSchema.InstrumentationKind);
+        StackSArray<uint8_t> dataCopy;
+        dataCopy.SetCount(dataSize);
+        uint8_t* pDataCopy = dataCopy.OpenRawBuffer();
+        memcpy(pDataCopy, header.GetData(), dataSize);
 
-        if (!WriteInstrumentationSchema(schemaElements.GetElements(), schemaCount, methodData->GetData(), offsetOfInstrumentationDataFromStartOfDataRegion))
+        StackSArray<uint8_t> nameBytes;
+        StackSArray<UINT32> nameOffsets;
+
+        for (COUNT_T iSchema = 0; iSchema < schemaArray.GetCount(); iSchema++)
+        {
+            const ICorJitInfo::PgoInstrumentationSchema& schema = schemaArray[iSchema];
+            ICorJitInfo::PgoInstrumentationKind kind = schema.InstrumentationKind & ICorJitInfo::PgoInstrumentationKind::MarshalMask;
+            if ((kind != ICorJitInfo::PgoInstrumentationKind::TypeHandle) && (kind != ICorJitInfo::PgoInstrumentationKind::MethodHandle))
+            {
+                continue;
+            }
+
+            for (int32_t iEntry = 0; iEntry < schema.Count; iEntry++)
+            {
+                intptr_t* pHandle = (intptr_t*)(pDataCopy + schema.Offset + iEntry * InstrumentationKindToSize(schema.InstrumentationKind));
+                intptr_t handle = *pHandle;
+                if ((handle == 0) || ICorJitInfo::IsUnknownHandle(handle))
+                {
+                    continue;
+                }
+
+                StackSString name;
+                if (kind == ICorJitInfo::PgoInstrumentationKind::TypeHandle)
+                {
+                    TypeString::AppendType(name, TypeHandle::FromPtr((void*)handle), TypeString::FormatNamespace | TypeString::FormatFullInst | TypeString::FormatAssembly);
+                }
+                else
+                {
+                    // Format is:
+                    // MethodName|@|fully_qualified_type_name
+                    MethodDesc* md = reinterpret_cast<MethodDesc*>(handle);
+                    SString garbage1, tMethodName, garbage2;
+                    md->GetMethodInfo(garbage1, tMethodName, garbage2);
+                    name.Set(tMethodName);
+                    name.Append(W("|@|"));
+                    TypeString::AppendType(name, TypeHandle(md->GetMethodTable()), TypeString::FormatNamespace | TypeString::FormatFullInst | TypeString::FormatAssembly);
+                }
+
+                if (name.GetCount() > PERSISTED_PGO_MAX_NAME_LENGTH)
+                {
+                    *pHandle = DEFAULT_UNKNOWN_HANDLE;
+                    continue;
+                }
+
+                *pHandle = PERSISTED_PGO_NAME_HANDLE_BASE + AddName(nameBytes, nameOffsets, name.GetUTF8());
+            }
+        }
+
+        SArrayByteWriterFunctor byteWriter(m_data);
+        SchemaAndDataWriter<SArrayByteWriterFunctor> schemaWriter(byteWriter, pDataCopy);
+        auto handleProcessor = [](intptr_t) {};
+
+        PersistedPgoMethodEntry entry = {};
+        entry.CodeHash = header.codehash;
+        entry.MethodHash = header.methodhash;
+        entry.ILSize = header.ilSize;
+        entry.DataOffset = m_data.GetCount();
+
+        for (COUNT_T iSchema = 0; iSchema < schemaArray.GetCount(); iSchema++)
+        {
+            if (!schemaWriter.AppendSchema(schemaArray[iSchema]) ||
+                !schemaWriter.AppendDataFromLastSchema(handleProcessor, handleProcessor))
+            {
+                m_data.SetCount(entry.DataOffset);
+                dataCopy.CloseRawBuffer();
+                return;
+            }
+        }
+
+        schemaWriter.Finish();
+        dataCopy.CloseRawBuffer();
+        entry.DataSize = m_data.GetCount() - entry.DataOffset;
+
+        AlignData();
+        entry.NameTableOffset = m_data.GetCount();
+        entry.NameCount = nameOffsets.GetCount();
+        UINT32 nameOffsetsSize = nameOffsets.GetCount() * sizeof(UINT32);
+        for (COUNT_T iName = 0; iName < nameOffsets.GetCount(); iName++)
+        {
+            AppendBytes(nameOffsetsSize + nameOffsets[iName]);
+        }
+        for (COUNT_T iByte = 0; iByte < nameBytes.GetCount(); iByte++)
+        {
+            m_data.Append(nameBytes[iByte]);
+        }
+        entry.NameTableSize = m_data.GetCount() - entry.NameTableOffset;
+        AlignData();
+
+        m_entries.Append(entry);
+        m_liveEntryCount++;
+    }
+
+    // Sort the live entries and drop duplicates, which can arise when the same method
+    // was instrumented in more than one loader allocator.
+    void FinishLiveMethods()
+    {
+        _ASSERTE(m_liveEntryCount == m_entries.GetCount());
+        if (m_liveEntryCount == 0)
         {
-            _ASSERTE(!"Unable to write schema");
             return;
         }
 
-        methodInstrumentationData.Copy(((uint8_t*)methodData) + offsetOfActualInstrumentationData, methodInstrumentationData.Begin(), methodInstrumentationData.GetCount());
+        PersistedPgoMethodEntry* pEntries = m_entries.OpenRawBuffer();
+        qsort(pEntries, m_liveEntryCount, sizeof(PersistedPgoMethodEntry), ComparePersistedPgoMethodEntries);
 
-        s_textFormatPgoData.Add(methodData);
-        probes += schemaCount;
+        COUNT_T uniqueCount = 1;
+        for (COUNT_T i = 1; i < m_liveEntryCount; i++)
+        {
+            if (ComparePersistedPgoMethodEntries(&pEntries[uniqueCount - 1], &pEntries[i]) != 0)
+            {
+                pEntries[uniqueCount++] = pEntries[i];
+            }
+        }
+        m_entries.CloseRawBuffer();
+
+        m_entries.SetCount(uniqueCount);
+        m_liveEntryCount = uniqueCount;
+    }
+
+    // Carry forward data from the previous run for a method that was not profiled again in
+    // this one, so that methods which skipped instrumentation keep their profile.
+    void AppendPersistedMethod(const BYTE* pView, const PersistedPgoMethodEntry* pPersistedEntry)
+    {
+        if ((m_liveEntryCount != 0) &&
+            (FindPersistedPgoMethodEntry(m_entries.GetElements(), m_liveEntryCount, pPersistedEntry->CodeHash, pPersistedEntry->MethodHash) != NULL))
+        {
+            return;
+        }
+
+        PersistedPgoMethodEntry entry = *pPersistedEntry;
+
+        entry.DataOffset = m_data.GetCount();
+        for (UINT32 i = 0; i < pPersistedEntry->DataSize; i++)
+        {
+            m_data.Append(pView[pPersistedEntry->DataOffset + i]);
+        }
+
+        AlignData();
+        entry.NameTableOffset = m_data.GetCount();
+        for (UINT32 i = 0; i < pPersistedEntry->NameTableSize; i++)
+        {
+            m_data.Append(pView[pPersistedEntry->NameTableOffset + i]);
+        }
+        AlignData();
+
+        m_entries.Append(entry);
+    }
+
+    bool Write(LPCWSTR fileName)
+    {
+        if (m_entries.GetCount() == 0)
+        {
+            return true;
+        }
+
+        PersistedPgoMethodEntry* pEntries = m_entries.OpenRawBuffer();
+        qsort(pEntries, m_entries.GetCount(), sizeof(PersistedPgoMethodEntry), ComparePersistedPgoMethodEntries);
+
+        // Offsets were recorded relative to the start of the data; rebase them past the method table.
+        UINT32 dataStart = (UINT32)AlignUp(sizeof(PersistedPgoFileHeader) + m_entries.GetCount() * sizeof(PersistedPgoMethodEntry), sizeof(UINT64));
+        for (COUNT_T i = 0; i < m_entries.GetCount(); i++)
+        {
+            pEntries[i].DataOffset += dataStart;
+            pEntries[i].NameTableOffset += dataStart;
+        }
+        m_entries.CloseRawBuffer();
+
+        PersistedPgoFileHeader fileHeader = {};
+        fileHeader.Signature = PERSISTED_PGO_SIGNATURE;
+        fileHeader.Version = PERSISTED_PGO_VERSION;
+        fileHeader.MethodCount = m_entries.GetCount();
+
+        FILE* const pgoDataFile = _wfopen(fileName, W("wb"));
+        if (pgoDataFile == NULL)
+        {
+            return false;
+        }
+
+        FILEHolder fileHolder(pgoDataFile);
+
+        const uint8_t padding[sizeof(UINT64)] = {};
+        size_t paddingSize = dataStart - (sizeof(PersistedPgoFileHeader) + m_entries.GetCount() * sizeof(PersistedPgoMethodEntry));
+
+        return (fwrite(&fileHeader, sizeof(fileHeader), 1, pgoDataFile) == 1) &&
+               (fwrite(m_entries.GetElements(), sizeof(PersistedPgoMethodEntry), m_entries.GetCount(), pgoDataFile) == m_entries.GetCount()) &&
+               (fwrite(padding, 1, paddingSize, pgoDataFile) == paddingSize) &&
+               (fwrite(m_data.GetElements(), 1, m_data.GetCount(), pgoDataFile) == m_data.GetCount());
     }
+
+private:
+    static UINT32 AddName(SArray<uint8_t>& nameBytes, SArray<UINT32>& nameOffsets, const char* name)
+    {
+        // Names are commonly repeated across the sites in a method, so share them
+        for (COUNT_T iName = 0; iName < nameOffsets.GetCount(); iName++)
+        {
+            if (strcmp((const char*)nameBytes.GetElements() + nameOffsets[iName], name) == 0)
+            {
+                return iName;
+            }
+        }
+
+        nameOffsets.Append(nameBytes.GetCount());
+        for (const char* p = name; ; p++)
+        {
+            nameBytes.Append((uint8_t)*p);
+            if (*p == '\0')
+                break;
+        }
+
+        return nameOffsets.GetCount() - 1;
+    }
+
+    void AppendBytes(UINT32 value)
+    {
+        for (size_t i = 0; i < sizeof(UINT32); i++)
+        {
+            m_data.Append(((uint8_t*)&value)[i]);
+        }
+    }
+
+    void AlignData()
+    {
+        while ((m_data.GetCount() % sizeof(UINT32)) != 0)
+        {
+            m_data.Append(0);
+        }
+    }
+};
+
+void PgoManager::ReadPersistedPgoData()
+{
+    CLRConfigStringHolder fileName(CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_TieredPGO_PersistedProfilePath));
+
+    if (fileName == NULL)
+    {
+        return;
+    }
+
+    HANDLE hFile = WszCreateFile(fileName, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (hFile == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+
+    FileHandleHolder fileHolder(hFile);
+
+    DWORD fileSizeHigh = 0;
+    DWORD fileSize = GetFileSize(hFile, &fileSizeHigh);
+    if ((fileSize == INVALID_FILE_SIZE) || (fileSizeHigh != 0) || (fileSize < sizeof(PersistedPgoFileHeader)))
+    {
+        return;
+    }
+
+    HANDLE hMap = CreateFileMapping(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (hMap == NULL)
+    {
+        return;
+    }
+
+    HandleHolder mapHolder(hMap);
+
+    const BYTE* pView = (const BYTE*)CLRMapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+    if (pView == NULL)
+    {
+        return;
+    }
+
+    // Ignore files written by a different version of the runtime, or which are truncated
+    const PersistedPgoFileHeader* pFileHeader = (const PersistedPgoFileHeader*)pView;
+    S_SIZE_T tableEnd = S_SIZE_T(sizeof(PersistedPgoFileHeader)) + S_SIZE_T(pFileHeader->MethodCount) * S_SIZE_T(sizeof(PersistedPgoMethodEntry));
+    if ((pFileHeader->Signature != PERSISTED_PGO_SIGNATURE) ||
+        (pFileHeader->Version != PERSISTED_PGO_VERSION) ||
+        tableEnd.IsOverflow() || (tableEnd.Value() > fileSize))
+    {
+        CLRUnmapViewOfFile((LPVOID)pView);
+        return;
+    }
+
+    s_persistedPgoViewSize = fileSize;
+    s_persistedPgoView = pView;
+}
+
+void PgoManager::WritePersistedPgoData()
+{
+    CLRConfigStringHolder fileName(CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_TieredPGO_PersistedProfilePath));
+
+    if ((fileName == NULL) || (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_TieredPGO_PersistedProfileReadOnly) != 0))
+    {
+        return;
+    }
+
+    // Failing to save the profile must not take down the process as it shuts down
+    EX_TRY
+    {
+        PersistedPgoDataWriter writer;
+
+        EnumeratePGOHeaders([&writer](HeaderList *pgoData)
+        {
+            writer.AppendLiveMethod(pgoData);
+            return true;
+        });
+
+        writer.FinishLiveMethods();
+
+        {
+            CrstHolder lock(&s_pgoMgrLock);
+            if (s_persistedPgoView != NULL)
+            {
+                const PersistedPgoFileHeader* pFileHeader = (const PersistedPgoFileHeader*)s_persistedPgoView;
+                const PersistedPgoMethodEntry* pEntries = (const PersistedPgoMethodEntry*)(pFileHeader + 1);
+                for (UINT32 i = 0; i < pFileHeader->MethodCount; i++)
+                {
+                    if (IsPersistedPgoMethodEntryInBounds(&pEntries[i], s_persistedPgoViewSize))
+                    {
+                        writer.AppendPersistedMethod(s_persistedPgoView, &pEntries[i]);
+                    }
+                }
+
+                // The file is about to be replaced, so stop looking data up in the old contents.
+                // Data already decoded stays available in s_persistedPgoData.
+                CLRUnmapViewOfFile((LPVOID)s_persistedPgoView);
+                s_persistedPgoView = NULL;
+                s_persistedPgoViewSize = 0;
+            }
+        }
+
+        writer.Write(fileName);
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions)
+}
+
+// Look up, and decode on first use, the data persisted by a previous run for the given
+// method. Must be called with s_pgoMgrLock held.
+PgoManager::Header* PgoManager::FindPersistedPgoData(unsigned codehash, unsigned methodhash)
+{
+    _ASSERTE(s_pgoMgrLock.OwnedByCurrentThread());
+
+    Header* found = s_persistedPgoData.Lookup(CodeAndMethodHash(codehash, methodhash));
+    if ((found != NULL) || (s_persistedPgoView == NULL))
+    {
+        return found;
+    }
+
+    const PersistedPgoFileHeader* pFileHeader = (const PersistedPgoFileHeader*)s_persistedPgoView;
+    const PersistedPgoMethodEntry* pEntry = FindPersistedPgoMethodEntry((const PersistedPgoMethodEntry*)(pFileHeader + 1), pFileHeader->MethodCount, codehash, methodhash);
+    if ((pEntry == NULL) || !IsPersistedPgoMethodEntryInBounds(pEntry, s_persistedPgoViewSize))
+    {
+        return NULL;
+    }
+
+    PersistedPgoDataReader reader(s_persistedPgoView + pEntry->NameTableOffset, pEntry->NameTableSize, pEntry->NameCount);
+    if (!ReadInstrumentationData(s_persistedPgoView + pEntry->DataOffset, pEntry->DataSize, reader) ||
+        (reader.schemaArray.GetCount() == 0))
+    {
+        return NULL;
+    }
+
+    found = CreatePgoDataFromSchemaAndData(pEntry->MethodHash, pEntry->CodeHash, pEntry->ILSize,
+                                           reader.schemaArray.GetElements(), reader.schemaArray.GetCount(),
+                                           reader.instrumentationData.GetElements(), reader.instrumentationData.GetCount());
+    if (found != NULL)
+    {
+        s_persistedPgoData.Add(found);
+    }
+
+    return found;
+}
+
+bool PgoManager::HasPersistedPgoData(MethodDesc* pMD)
+{
+    STANDARD_VM_CONTRACT;
+
+    if ((s_persistedPgoView == NULL) || pMD->IsDynamicMethod())
+    {
+        return false;
+    }
+
+    int codehash;
+    unsigned ilSize;
+    if (!GetVersionResilientILCodeHashCode(pMD, &codehash, &ilSize))
+    {
+        return false;
+    }
+
+    COUNT_T methodhash = pMD->GetStableHash();
+
+    CrstHolder lock(&s_pgoMgrLock);
+    return FindPersistedPgoData(codehash, methodhash) != NULL;
+}
+
+void PgoManager::RecordPersistedPgoDataAvailability(MethodDesc* pMD)
+{
+    STANDARD_VM_CONTRACT;
+
+    // A collectible method's MethodDesc may be reused by another method after it is unloaded
+    if ((s_persistedPgoView == NULL) || pMD->GetLoaderAllocator()->IsCollectible() || !HasPersistedPgoData(pMD))
+    {
+        return;
+    }
+
+    CrstHolder lock(&s_persistedPgoMethodsLock);
+    if (s_persistedPgoMethods.Lookup(pMD) == NULL)
+    {
+        s_persistedPgoMethods.Add(pMD);
+    }
+}
+
+bool PgoManager::IsPersistedPgoDataAvailable(MethodDesc* pMD)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    CrstHolder lock(&s_persistedPgoMethodsLock);
+    return s_persistedPgoMethods.Lookup(pMD) != NULL;
+}
+
+HRESULT PgoManager::getPgoInstrumentationResultsFromPersistedData(MethodDesc* pMD, BYTE** pAllocatedData, ICorJitInfo::PgoInstrumentationSchema** ppSchema, UINT32* pCountSchemaItems, BYTE** pInstrumentationData, ICorJitInfo::PgoSource* pPgoSource)
+{
+    if (((s_persistedPgoView == NULL) && (s_persistedPgoData.GetCount() == 0)) || pMD->IsDynamicMethod())
+    {
+        return E_NOTIMPL;
+    }
+
+    int codehash;
+    unsigned ilSize;
+    if (!GetVersionResilientILCodeHashCode(pMD, &codehash, &ilSize))
+    {
+        return E_NOTIMPL;
+    }
+
+    COUNT_T methodhash = pMD->GetStableHash();
+
+    Header* found;
+    {
+        CrstHolder lock(&s_pgoMgrLock);
+        found = FindPersistedPgoData(codehash, methodhash);
+    }
+
+    if (found == NULL)
+    {
+        return E_NOTIMPL;
+    }
+
+    // The data is reported as coming from text: like the text format, it may have been produced
+    // by a different JIT, so the consistency guarantees of PgoSource::Dynamic do not hold.
+    return getPgoInstrumentationResultsFromHashedData(found, pAllocatedData, ppSchema, pCountSchemaItems, pInstrumentationData, pPgoSource);
 }
 #endif // DACCESS_COMPILE
 
@@ -841,6 +1575,11 @@ HRESULT PgoManager::getPgoInstrumentationResults(MethodDesc* pMD, BYTE** pAlloca
         {
             hr = mgr->getPgoInstrumentationResultsInstance(pMD, pAllocatedData, ppSchema, pCountSchemaItems, pInstrumentationData, pPgoSource);
         }
+        else
+        {
+            // No data was collected in this process, but a previous run may have profiled this method.
+            hr = getPgoInstrumentationResultsFromPersistedData(pMD, pAllocatedData, ppSchema, pCountSchemaItems, pInstrumentationData, pPgoSource);
+        }
     }
 
     return hr;
@@ -862,6 +1601,11 @@ HRESULT PgoManager::getPgoInstrumentationResultsFromText(MethodDesc* pMD, BYTE**
         return E_NOTIMPL;
     }
 
+    return getPgoInstrumentationResultsFromHashedData(found, pAllocatedData, ppSchema, pCountSchemaItems, pInstrumentationData, pPgoSource);
+}
+
+HRESULT PgoManager::getPgoInstrumentationResultsFromHashedData(Header* found, BYTE** pAllocatedData, ICorJitInfo::PgoInstrumentationSchema** ppSchema, UINT32* pCountSchemaItems, BYTE** pInstrumentationData, ICorJitInfo::PgoSource* pPgoSource)
+{
     StackSArray<ICorJitInfo::PgoInstrumentationSchema> schemaArray;
 
     if (!ReadInstrumentationSchemaWithLayoutIntoSArray(found->GetData(), found->countsOffset, found->countsOffset, &schemaArray))
@@ -1149,6 +1893,15 @@ HRESULT PgoManager::getPgoInstrumentationResultsInstance(MethodDesc* pMD, BYTE**
 
     if (found == NULL)
     {
+#ifndef DACCESS_COMPILE
+        // Prefer live collected data over data persisted by a previous run, as the live data was produced by this
+        // JIT for exactly this version of the method.
+        if (SUCCEEDED(getPgoInstrumentationResultsFromPersistedData(pMD, pAllocatedData, ppSchema, pCountSchemaItems, pInstrumentationData, pPgoSource)))
+        {
+            return S_OK;
+        }
+#endif // DACCESS_COMPILE
+
         // Prefer live collected data over data from pgo input, but if live data isn't present, use the data from the R2R file
         // Consider merging this data with the live data instead in the future
         if (pMD->GetModule()->IsReadyToRun() && pMD->GetModule()->GetReadyToRunInfo()->GetPgoInstrumentationData(pMD, pAllocatedData, ppSchema, pCountSchemaItems, pInstrumentationData))
@@ -18,6 +18,14 @@ public:
     static void Initialize();
     static void Shutdown();
 
+    // Whether a previous run persisted profile data for this exact version of the method's IL
+    static bool HasPersistedPgoData(MethodDesc* pMD);
+
+    // HasPersistedPgoData hashes the IL and may decode the profile, so it can't be used under the
+    // code versioning lock. Tier0 code records the result up front and tiering queries it later.
+    static void RecordPersistedPgoDataAvailability(MethodDesc* pMD);
+    static bool IsPersistedPgoDataAvailable(MethodDesc* pMD);
+
 #endif // FEATURE_PGO
 
 public:
@@ -159,8 +167,15 @@ private:
     static HRESULT ComputeOffsetOfActualInstrumentationData(const ICorJitInfo::PgoInstrumentationSchema* pSchema, UINT32 countSchemaItems, size_t headerInitialSize, UINT *offsetOfActualInstrumentationData);
     static HRESULT getPgoInstrumentationResultsFromText(MethodDesc* pMD, BYTE** pAllocatedData, ICorJitInfo::PgoInstrumentationSchema** ppSchema, UINT32 *pCountSchemaItems, BYTE**pInstrumentationData, ICorJitInfo::PgoSource *pPgoSource);
 
+    static HRESULT getPgoInstrumentationResultsFromPersistedData(MethodDesc* pMD, BYTE** pAllocatedData, ICorJitInfo::PgoInstrumentationSchema** ppSchema, UINT32 *pCountSchemaItems, BYTE**pInstrumentationData, ICorJitInfo::PgoSource *pPgoSource);
+    static HRESULT getPgoInstrumentationResultsFromHashedData(Header* found, BYTE** pAllocatedData, ICorJitInfo::PgoInstrumentationSchema** ppSchema, UINT32 *pCountSchemaItems, BYTE**pInstrumentationData, ICorJitInfo::PgoSource *pPgoSource);
+    static Header* CreatePgoDataFromSchemaAndData(unsigned methodhash, unsigned codehash, unsigned ilSize, ICorJitInfo::PgoInstrumentationSchema* pSchema, UINT32 countSchemaItems, const uint8_t* pInstrumentationData, COUNT_T cbInstrumentationData);
+    static Header* FindPersistedPgoData(unsigned codehash, unsigned methodhash);
+
     static void ReadPgoData();
     static void WritePgoData();
+    static void ReadPersistedPgoData();
+    static void WritePersistedPgoData();
 
 private:
 
@@ -179,6 +194,16 @@ private:
 
     static PtrSHash<Header, CodeAndMethodHash> s_textFormatPgoData;
 
+    // Memory mapped binary profile from a previous run, and the entries decoded from it so far
+    // (both protected by s_pgoMgrLock)
+    static const BYTE* s_persistedPgoView;
+    static size_t s_persistedPgoViewSize;
+    static PtrSHash<Header, CodeAndMethodHash> s_persistedPgoData;
+
+    // Methods found to have persisted data by RecordPersistedPgoDataAvailability
+    static CrstStatic s_persistedPgoMethodsLock;
+    static SetSHash<MethodDesc*> s_persistedPgoMethods;
+
     PgoManager *m_next = NULL;
     PgoManager *m_prev = NULL;
     HeaderList *m_pgoHeaders = NULL;
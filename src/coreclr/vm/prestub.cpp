@@ -2030,6 +2030,20 @@ const char *PrepareCodeConfig::GetJitOptimizationTierStr(PrepareCodeConfig *conf
 }
 
 #ifdef FEATURE_TIERED_COMPILATION
+// Called for tier0 code that will count calls. Promotion to tier1 happens under the code versioning lock, so anything it
+// needs to know about the method that is expensive to compute is determined here.
+static void PrepareForCallCounting(MethodDesc *pMD)
+{
+    STANDARD_VM_CONTRACT;
+
+#ifdef FEATURE_PGO
+    if (g_pConfig->TieredPGO() && g_pConfig->TieredPGO_InstrumentOnlyHotCode())
+    {
+        PgoManager::RecordPersistedPgoDataAvailability(pMD);
+    }
+#endif // FEATURE_PGO
+}
+
 // This function should be called before SetNativeCode() for consistency with usage of FinalizeOptimizationTierForTier0Jit
 bool PrepareCodeConfig::FinalizeOptimizationTierForTier0Load()
 {
@@ -2038,6 +2052,7 @@ bool PrepareCodeConfig::FinalizeOptimizationTierForTier0Load()
 
     if (!IsForMulticoreJit())
     {
+        PrepareForCallCounting(GetMethodDesc());
         return true; // should count calls if SetNativeCode() succeeds
     }
 
@@ -2087,6 +2102,7 @@ bool PrepareCodeConfig::FinalizeOptimizationTierForTier0LoadOrJit()
         return false; // don't count calls
     }
 
+    PrepareForCallCounting(GetMethodDesc());
     return true; // should count calls if SetNativeCode() succeeds
 }
 #endif // FEATURE_TIERED_COMPILATION
@@ -10676,8 +10676,24 @@ HCIMPL_PROLOG(ProfileEnter)
     }
 #endif // PROF_TEST_ONLY_FORCE_ELT
 
-    // ELT3 Fast-Path hooks should be NULL when ELT intermediary is used.
-    _ASSERTE(g_profControlBlock.mainProfilerInfo.pProfInterface->GetEnter3Hook() == NULL);
+    // Skip the calls that aren't sampled before paying for the frame.
+    if (!g_profControlBlock.mainProfilerInfo.pProfInterface->ShouldCallEnterLeaveHook(
+            EEToProfInterfaceImpl::kEnterLeaveHook_Enter, clientData))
+    {
+        return;
+    }
+
+    // ELT3 Fast-Path hooks only come through the ELT intermediary when they are sampled.
+    // Call them the way the JIT'd code would have, without a frame.
+    if (g_profControlBlock.mainProfilerInfo.pProfInterface->GetEnter3Hook() != NULL)
+    {
+        _ASSERTE(g_profControlBlock.mainProfilerInfo.pProfInterface->IsEnterLeaveSampled());
+        FunctionIDOrClientID functionIDOrClientID;
+        functionIDOrClientID.clientID = clientData;
+        g_profControlBlock.mainProfilerInfo.pProfInterface->GetEnter3Hook()(functionIDOrClientID);
+        return;
+    }
+
     _ASSERTE(GetThread()->PreemptiveGCDisabled());
     _ASSERTE(platformSpecificHandle != NULL);
 
@@ -10850,8 +10866,24 @@ HCIMPL_PROLOG(ProfileLeave)
     }
 #endif // PROF_TEST_ONLY_FORCE_ELT
 
-    // ELT3 Fast-Path hooks should be NULL when ELT intermediary is used.
-    _ASSERTE(g_profControlBlock.mainProfilerInfo.pProfInterface->GetLeave3Hook() == NULL);
+    // Skip the calls that aren't sampled before paying for the frame.
+    if (!g_profControlBlock.mainProfilerInfo.pProfInterface->ShouldCallEnterLeaveHook(
+            EEToProfInterfaceImpl::kEnterLeaveHook_Leave, clientData))
+    {
+        return;
+    }
+
+    // ELT3 Fast-Path hooks only come through the ELT intermediary when they are sampled.
+    // Call them the way the JIT'd code would have, without a frame.
+    if (g_profControlBlock.mainProfilerInfo.pProfInterface->GetLeave3Hook() != NULL)
+    {
+        _ASSERTE(g_profControlBlock.mainProfilerInfo.pProfInterface->IsEnterLeaveSampled());
+        FunctionIDOrClientID functionIDOrClientID;
+        functionIDOrClientID.clientID = clientData;
+        g_profControlBlock.mainProfilerInfo.pProfInterface->GetLeave3Hook()(functionIDOrClientID);
+        return;
+    }
+
     _ASSERTE(GetThread()->PreemptiveGCDisabled());
     _ASSERTE(platformSpecificHandle != NULL);
 
@@ -10982,8 +11014,24 @@ HCIMPL2(EXTERN_C void, ProfileTailcall, UINT_PTR clientData, void * platformSpec
     }
 #endif // PROF_TEST_ONLY_FORCE_ELT
 
-    // ELT3 fast-path hooks should be NULL when ELT intermediary is used.
-    _ASSERTE(g_profControlBlock.mainProfilerInfo.pProfInterface->GetTailcall3Hook() == NULL);
+    // Skip the calls that aren't sampled before paying for the frame.
+    if (!g_profControlBlock.mainProfilerInfo.pProfInterface->ShouldCallEnterLeaveHook(
+            EEToProfInterfaceImpl::kEnterLeaveHook_Tailcall, clientData))
+    {
+        return;
+    }
+
+    // ELT3 fast-path hooks only come through the ELT intermediary when they are sampled.
+    // Call them the way the JIT'd code would have, without a frame.
+    if (g_profControlBlock.mainProfilerInfo.pProfInterface->GetTailcall3Hook() != NULL)
+    {
+        _ASSERTE(g_profControlBlock.mainProfilerInfo.pProfInterface->IsEnterLeaveSampled());
+        FunctionIDOrClientID functionIDOrClientID;
+        functionIDOrClientID.clientID = clientData;
+        g_profControlBlock.mainProfilerInfo.pProfInterface->GetTailcall3Hook()(functionIDOrClientID);
+        return;
+    }
+
     _ASSERTE(GetThread()->PreemptiveGCDisabled());
     _ASSERTE(platformSpecificHandle != NULL);
 
@@ -16,6 +16,7 @@
 #include "method.hpp"
 #include "wellknownattributes.h"
 #include "nativeimage.h"
+#include "startupsummary.h"
 
 using namespace NativeFormat;
 
@@ -1205,6 +1206,8 @@ PCODE ReadyToRunInfo::GetEntryPoint(MethodDesc * pMD, PrepareCodeConfig* pConfig
         g_pDebugInterface->JITComplete(pConfig->GetCodeVersion(), pEntryPoint);
     }
 
+    StartupSummary::OnMethodReadyToRun();
+
 done:
     if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, R2RGetEntryPoint))
     {
@@ -406,6 +406,200 @@ public:
     }
 };
 
+namespace
+{
+    // Where one argument of a reflection invoke goes in the transition block, as computed by the ArgIterator
+    struct MethodInvokeArgInfo
+    {
+        TypeHandle      thShape;
+        int             ofs;
+        UINT            size;
+        CorElementType  argType;
+        bool            isByRef;
+        bool            hasArgLocDesc;
+        ArgLocDesc      argLocDesc;
+    };
+
+    // The argument placement only depends on the shape of the signature: object references, pointers and byrefs
+    // all travel as a pointer sized integer, so only value types need to match exactly. Layouts are computed
+    // once per shape, shared by all the methods with that shape and never freed. Signatures that mention
+    // collectible types are not cached since their types can go away.
+    struct MethodInvokeLayout
+    {
+        MethodInvokeLayout *    pNext;
+        DWORD                   dwHash;
+        BOOL                    fHasThis;
+        TypeHandle              thReturnShape;
+        DWORD                   cArgs;
+        MethodInvokeArgInfo     args[1];
+
+        bool HasSameShape(const MethodInvokeLayout * pOther) const
+        {
+            LIMITED_METHOD_CONTRACT;
+
+            if (dwHash != pOther->dwHash || fHasThis != pOther->fHasThis ||
+                thReturnShape != pOther->thReturnShape || cArgs != pOther->cArgs)
+                return false;
+
+            for (DWORD i = 0; i < cArgs; i++)
+            {
+                if (args[i].thShape != pOther->args[i].thShape)
+                    return false;
+            }
+            return true;
+        }
+    };
+
+    const DWORD METHOD_INVOKE_LAYOUT_BUCKETS = 256; // must be a power of 2
+
+    MethodInvokeLayout * g_methodInvokeLayouts[METHOD_INVOKE_LAYOUT_BUCKETS];
+
+    // Each thread remembers the layouts of the methods it invoked last, so repeated invokes skip the signature walk
+    struct MethodInvokeLayoutCacheEntry
+    {
+        MethodDesc *                pMD;
+        TypeHandle                  thOwner;
+        BOOL                        fCtorOfVariableSizedObject;
+        const MethodInvokeLayout *  pLayout;
+    };
+
+    const size_t METHOD_INVOKE_LAYOUT_CACHE_SIZE = 16; // must be a power of 2
+
+    thread_local MethodInvokeLayoutCacheEntry t_methodInvokeLayoutCache[METHOD_INVOKE_LAYOUT_CACHE_SIZE];
+
+    TypeHandle GetMethodInvokeShape(TypeHandle th)
+    {
+        WRAPPER_NO_CONTRACT;
+        return th.IsValueType() ? th : TypeHandle(g_pObjectClass);
+    }
+
+    // Returns NULL if the layout can't be cached, the caller falls back to walking the signature
+    const MethodInvokeLayout * GetMethodInvokeLayout(SIGNATURENATIVEREF * ppSig, MethodDesc * pMeth, TypeHandle ownerType, BOOL fCtorOfVariableSizedObject)
+    {
+        CONTRACTL
+        {
+            THROWS;
+            GC_TRIGGERS;
+            MODE_COOPERATIVE;
+        }
+        CONTRACTL_END;
+
+        MethodInvokeLayoutCacheEntry * pEntry =
+            &t_methodInvokeLayoutCache[((size_t)pMeth >> 3) & (METHOD_INVOKE_LAYOUT_CACHE_SIZE - 1)];
+
+        if (pEntry->pMD == pMeth && pEntry->thOwner == ownerType && pEntry->fCtorOfVariableSizedObject == fCtorOfVariableSizedObject)
+        {
+            return pEntry->pLayout;
+        }
+
+        // Dynamic and collectible methods can go away and have their MethodDesc reused
+        if (pMeth->IsDynamicMethod() || pMeth->GetLoaderAllocator()->IsCollectible() || ownerType.GetLoaderAllocator()->IsCollectible())
+        {
+            return NULL;
+        }
+
+        DWORD cArgs = (*ppSig)->NumFixedArgs();
+
+        S_SIZE_T cbLayout = S_SIZE_T(offsetof(MethodInvokeLayout, args)) + S_SIZE_T(cArgs) * S_SIZE_T(sizeof(MethodInvokeArgInfo));
+        if (cbLayout.IsOverflow())
+        {
+            return NULL;
+        }
+
+        NewArrayHolder<BYTE> pLayoutMem = new (nothrow) BYTE[cbLayout.Value()];
+        if (pLayoutMem == NULL)
+        {
+            return NULL;
+        }
+
+        MethodInvokeLayout * pLayout = (MethodInvokeLayout *)(BYTE *)pLayoutMem;
+        pLayout->pNext = NULL;
+        pLayout->fHasThis = (*ppSig)->HasThis() && !fCtorOfVariableSizedObject;
+        pLayout->thReturnShape = GetMethodInvokeShape((*ppSig)->GetReturnTypeHandle());
+        pLayout->cArgs = cArgs;
+
+        COUNT_T dwHash = HashCOUNT_T(HashCOUNT_T(5381, pLayout->fHasThis), cArgs);
+        dwHash = HashPtr(dwHash, pLayout->thReturnShape.AsPtr());
+        for (DWORD i = 0; i < cArgs; i++)
+        {
+            pLayout->args[i].thShape = GetMethodInvokeShape((*ppSig)->GetArgumentAt(i));
+            dwHash = HashPtr(dwHash, pLayout->args[i].thShape.AsPtr());
+        }
+        pLayout->dwHash = dwHash;
+
+        MethodInvokeLayout ** ppBucket = &g_methodInvokeLayouts[dwHash & (METHOD_INVOKE_LAYOUT_BUCKETS - 1)];
+
+        const MethodInvokeLayout * pFound = NULL;
+        for (MethodInvokeLayout * pCur = VolatileLoad(ppBucket); pCur != NULL; pCur = pCur->pNext)
+        {
+            if (pCur->HasSameShape(pLayout))
+            {
+                pFound = pCur;
+                break;
+            }
+        }
+
+        if (pFound == NULL)
+        {
+            ArgIteratorForMethodInvoke argit(ppSig, fCtorOfVariableSizedObject);
+
+            for (DWORD i = 0; i < cArgs; i++)
+            {
+                MethodInvokeArgInfo & info = pLayout->args[i];
+
+                info.ofs = argit.GetNextOffset();
+                _ASSERTE(info.ofs != TransitionBlock::InvalidOffset);
+
+                info.size = argit.GetArgSize();
+                info.argType = argit.GetArgType();
+#ifdef ENREGISTERED_PARAMTYPE_MAXSIZE
+                info.isByRef = !!argit.IsArgPassedByRef();
+#else
+                info.isByRef = false;
+#endif
+                ArgLocDesc * pArgLocDesc = argit.GetArgLocDescForStructInRegs();
+                info.hasArgLocDesc = (pArgLocDesc != NULL);
+                if (pArgLocDesc != NULL)
+                {
+                    info.argLocDesc = *pArgLocDesc;
+                }
+            }
+
+            // Publish the layout, unless another thread got the same shape in first
+            for (;;)
+            {
+                MethodInvokeLayout * pHead = VolatileLoad(ppBucket);
+                for (MethodInvokeLayout * pCur = pHead; pCur != NULL; pCur = pCur->pNext)
+                {
+                    if (pCur->HasSameShape(pLayout))
+                    {
+                        pFound = pCur;
+                        break;
+                    }
+                }
+
+                if (pFound != NULL)
+                    break;
+
+                pLayout->pNext = pHead;
+                if (InterlockedCompareExchangeT(ppBucket, pLayout, pHead) == pHead)
+                {
+                    pLayoutMem.SuppressRelease();
+                    pFound = pLayout;
+                    break;
+                }
+            }
+        }
+
+        pEntry->pMD = pMeth;
+        pEntry->thOwner = ownerType;
+        pEntry->fCtorOfVariableSizedObject = fCtorOfVariableSizedObject;
+        pEntry->pLayout = pFound;
+
+        return pFound;
+    }
+}
+
 FCIMPL4(Object*, RuntimeMethodHandle::InvokeMethod,
     Object *target,
     PVOID* args, // An array of byrefs
@@ -511,6 +705,8 @@ FCIMPL4(Object*, RuntimeMethodHandle::InvokeMethod,
     }
     callDescrData.pTarget = pTarget;
 
+    const MethodInvokeLayout * pLayout = GetMethodInvokeLayout(&gc.pSig, pMeth, ownerType, fCtorOfVariableSizedObject);
+
     // Build the arguments on the stack
 
     GCStress<cfg_any>::MaybeTrigger();
@@ -609,11 +805,37 @@ FCIMPL4(Object*, RuntimeMethodHandle::InvokeMethod,
     for (UINT i = 0 ; i < nNumArgs; i++) {
         TypeHandle th = gc.pSig->GetArgumentAt(i);
 
-        int ofs = argit.GetNextOffset();
+        int ofs;
+        UINT structSize;
+        CorElementType argType;
+        bool isArgPassedByRef;
+        ArgLocDesc * pArgLocDesc;
+
+        if (pLayout != NULL)
+        {
+            const MethodInvokeArgInfo & info = pLayout->args[i];
+            ofs = info.ofs;
+            structSize = info.size;
+            argType = info.argType;
+            isArgPassedByRef = info.isByRef;
+            pArgLocDesc = info.hasArgLocDesc ? const_cast<ArgLocDesc *>(&info.argLocDesc) : NULL;
+        }
+        else
+        {
+            ofs = argit.GetNextOffset();
+            structSize = argit.GetArgSize();
+            argType = argit.GetArgType();
+#ifdef ENREGISTERED_PARAMTYPE_MAXSIZE
+            isArgPassedByRef = !!argit.IsArgPassedByRef();
+#else
+            isArgPassedByRef = false;
+#endif
+            pArgLocDesc = argit.GetArgLocDescForStructInRegs();
+        }
         _ASSERTE(ofs != TransitionBlock::InvalidOffset);
 
 #ifdef CALLDESCR_REGTYPEMAP
-        FillInRegTypeMap(ofs, argit.GetArgType(), (BYTE *)&callDescrData.dwRegTypeMap);
+        FillInRegTypeMap(ofs, argType, (BYTE *)&callDescrData.dwRegTypeMap);
 #endif
 
 #ifdef CALLDESCR_FPARGREGS
@@ -622,7 +844,7 @@ FCIMPL4(Object*, RuntimeMethodHandle::InvokeMethod,
         // it null otherwise since the worker can perform a useful optimization if it knows no floating point
         // registers need to be set up).
 
-        if (TransitionBlock::HasFloatRegister(ofs, argit.GetArgLocDescForStructInRegs()) &&
+        if (TransitionBlock::HasFloatRegister(ofs, pArgLocDesc) &&
             (callDescrData.pFloatArgumentRegisters == NULL))
         {
             callDescrData.pFloatArgumentRegisters = (FloatArgumentRegisters*) (pTransitionBlock +
@@ -630,13 +852,11 @@ FCIMPL4(Object*, RuntimeMethodHandle::InvokeMethod,
         }
 #endif
 
-        UINT structSize = argit.GetArgSize();
-
         bool needsStackCopy = false;
-        ArgDestination argDest(pTransitionBlock, ofs, argit.GetArgLocDescForStructInRegs());
+        ArgDestination argDest(pTransitionBlock, ofs, pArgLocDesc);
 
 #ifdef ENREGISTERED_PARAMTYPE_MAXSIZE
-        if (argit.IsArgPassedByRef())
+        if (isArgPassedByRef)
         {
             MethodTable* pMT = th.GetMethodTable();
             _ASSERTE(pMT && pMT->IsValueType());
@@ -0,0 +1,226 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// ===========================================================================
+// File: startupsummary.cpp
+//
+
+#include "common.h"
+#include "startupsummary.h"
+#include "configuration.h"
+#include "jitinterface.h"
+#include <minipal/time.h>
+#include <corehost/host_runtime_contract.h>
+
+#ifndef TARGET_UNIX
+#include <psapi.h>
+#endif // !TARGET_UNIX
+
+bool StartupSummary::s_enabled = false;
+INT64 StartupSummary::s_phaseStart[Phase_Count];
+INT64 StartupSummary::s_phaseEnd[Phase_Count];
+char StartupSummary::s_hostPhases[256];
+Volatile<LONG> StartupSummary::s_filesOpened = 0;
+Volatile<LONG> StartupSummary::s_methodsReadyToRun = 0;
+StartupSummary::Counters StartupSummary::s_countersAtMain;
+
+namespace
+{
+    const char* const s_phaseNames[StartupSummary::Phase_Count] =
+    {
+        "initialize",
+        "eeStartup",
+        "loadEntryAssembly",
+        "startupHooks",
+        "main",
+    };
+
+    UINT64 GetPageFaultCount()
+    {
+        LIMITED_METHOD_CONTRACT;
+
+#ifdef TARGET_UNIX
+        return PAL_GetProcessPageFaultCount();
+#else
+        PROCESS_MEMORY_COUNTERS pmc;
+        return GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)) ? pmc.PageFaultCount : 0;
+#endif
+    }
+
+    INT64 TicksToMicroseconds(INT64 ticks)
+    {
+        LIMITED_METHOD_CONTRACT;
+        return ticks * 1000000 / minipal_hires_tick_frequency();
+    }
+}
+
+void StartupSummary::Initialize(INT64 initializeStartTicks)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_StartupSummary) == 0)
+    {
+        return;
+    }
+
+    s_phaseStart[Phase_Initialize] = initializeStartTicks;
+
+    // Only keep the host phases if they are well formed, they are written to the summary as is
+    LPCWSTR hostPhases = Configuration::GetKnobStringValue(_T(HOST_PROPERTY_STARTUP_PHASES));
+    if (hostPhases != NULL)
+    {
+        size_t i = 0;
+        for (; hostPhases[i] != W('\0') && i < ARRAY_SIZE(s_hostPhases) - 1; i++)
+        {
+            WCHAR c = hostPhases[i];
+            if (!((c >= W('a') && c <= W('z')) || (c >= W('A') && c <= W('Z')) || (c >= W('0') && c <= W('9')) || c == W('=') || c == W(';')))
+            {
+                break;
+            }
+
+            s_hostPhases[i] = (char)c;
+        }
+
+        s_hostPhases[(hostPhases[i] == W('\0')) ? i : 0] = '\0';
+    }
+
+    s_enabled = true;
+}
+
+void StartupSummary::GetCounters(Counters* pCounters)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    pCounters->PageFaults = GetPageFaultCount();
+    pCounters->FilesOpened = s_filesOpened;
+    pCounters->MethodsReadyToRun = s_methodsReadyToRun;
+    pCounters->MethodsJitted = g_cMethodsJitted;
+}
+
+void StartupSummary::PhaseStart(Phase phase)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (!s_enabled || s_phaseStart[phase] != 0)
+    {
+        return;
+    }
+
+    if (phase == Phase_Main)
+    {
+        GetCounters(&s_countersAtMain);
+    }
+
+    s_phaseStart[phase] = minipal_hires_ticks();
+}
+
+void StartupSummary::PhaseEnd(Phase phase)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (!s_enabled || s_phaseStart[phase] == 0 || s_phaseEnd[phase] != 0)
+    {
+        return;
+    }
+
+    s_phaseEnd[phase] = minipal_hires_ticks();
+}
+
+void StartupSummary::Write()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (!s_enabled)
+    {
+        return;
+    }
+
+    s_enabled = false;
+
+    Counters countersAtExit;
+    GetCounters(&countersAtExit);
+
+    // Build the whole line first so that concurrent processes appending to the same file don't interleave
+    char line[2048];
+    int length = sprintf_s(line, ARRAY_SIZE(line), "{\"pid\":%u", GetCurrentProcessId());
+
+    // Host phases are durations in microseconds, the host and the runtime don't share a clock
+    for (char* hostPhase = s_hostPhases; *hostPhase != '\0';)
+    {
+        char* next = strchr(hostPhase, ';');
+        if (next != NULL)
+        {
+            *next++ = '\0';
+        }
+
+        char* value = strchr(hostPhase, '=');
+        if (value != NULL && value != hostPhase && value[1] != '\0')
+        {
+            *value++ = '\0';
+            length += sprintf_s(line + length, ARRAY_SIZE(line) - length, ",\"%sUs\":%s", hostPhase, value);
+        }
+
+        if (next == NULL)
+        {
+            break;
+        }
+
+        hostPhase = next;
+    }
+
+    // Runtime phases are reported as an offset from the start of coreclr_initialize and a duration
+    INT64 origin = s_phaseStart[Phase_Initialize];
+    for (int phase = 0; phase < Phase_Count; phase++)
+    {
+        if (s_phaseStart[phase] == 0)
+        {
+            continue;
+        }
+
+        length += sprintf_s(line + length, ARRAY_SIZE(line) - length, ",\"%sStartUs\":%lld",
+            s_phaseNames[phase], (long long)TicksToMicroseconds(s_phaseStart[phase] - origin));
+
+        if (s_phaseEnd[phase] != 0)
+        {
+            length += sprintf_s(line + length, ARRAY_SIZE(line) - length, ",\"%sUs\":%lld",
+                s_phaseNames[phase], (long long)TicksToMicroseconds(s_phaseEnd[phase] - s_phaseStart[phase]));
+        }
+    }
+
+    if (s_phaseStart[Phase_Main] != 0)
+    {
+        length += sprintf_s(line + length, ARRAY_SIZE(line) - length,
+            ",\"pageFaultsAtMain\":%llu,\"filesOpenedAtMain\":%d,\"methodsJittedAtMain\":%lld,\"methodsR2RAtMain\":%d",
+            (unsigned long long)s_countersAtMain.PageFaults, (int)s_countersAtMain.FilesOpened,
+            (long long)s_countersAtMain.MethodsJitted, (int)s_countersAtMain.MethodsReadyToRun);
+    }
+
+    length += sprintf_s(line + length, ARRAY_SIZE(line) - length,
+        ",\"pageFaults\":%llu,\"filesOpened\":%d,\"methodsJitted\":%lld,\"methodsR2R\":%d}\n",
+        (unsigned long long)countersAtExit.PageFaults, (int)countersAtExit.FilesOpened,
+        (long long)countersAtExit.MethodsJitted, (int)countersAtExit.MethodsReadyToRun);
+
+    CLRConfigStringHolder path(CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_StartupSummaryPath));
+    FILE* file = (path != NULL) ? _wfopen(path, W("a")) : NULL;
+    if (file != NULL)
+    {
+        fputs(line, file);
+        fclose(file);
+    }
+    else
+    {
+        fputs(line, stderr);
+        fflush(stderr);
+    }
+}
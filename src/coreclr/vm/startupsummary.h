@@ -0,0 +1,90 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// ===========================================================================
+// File: startupsummary.h
+//
+// Records the wall time of the startup phases of the runtime, and of the host when it
+// reports them, and writes them as a single line of JSON at shutdown. Enabled with
+// DOTNET_StartupSummary=1; DOTNET_StartupSummaryPath appends the line to a file
+// instead of writing it to stderr so that repeated runs can be aggregated.
+//
+
+#ifndef STARTUPSUMMARY_H
+#define STARTUPSUMMARY_H
+
+class StartupSummary
+{
+public:
+    enum Phase
+    {
+        Phase_Initialize,           // coreclr_initialize, the phases below up to Main are nested in or follow it
+        Phase_EEStartup,
+        Phase_LoadEntryAssembly,
+        Phase_StartupHooks,
+        Phase_Main,
+        Phase_Count
+    };
+
+private:
+    struct Counters
+    {
+        UINT64 PageFaults;
+        LONG FilesOpened;
+        LONG MethodsReadyToRun;
+        INT64 MethodsJitted;
+    };
+
+    static bool s_enabled;
+
+    // Ticks of minipal_hires_ticks at the start and the end of each phase, zero if the phase was not reached
+    static INT64 s_phaseStart[Phase_Count];
+    static INT64 s_phaseEnd[Phase_Count];
+
+    // Phases reported by the host as name=microseconds pairs separated by ';'
+    static char s_hostPhases[256];
+
+    static Volatile<LONG> s_filesOpened;
+    static Volatile<LONG> s_methodsReadyToRun;
+
+    // Counters snapshotted when Main is called
+    static Counters s_countersAtMain;
+
+    static void GetCounters(Counters* pCounters);
+
+public:
+    // Called by coreclr_initialize once the configuration knobs are available, initializeStartTicks
+    // is the time it was entered.
+    static void Initialize(INT64 initializeStartTicks);
+
+    static bool IsEnabled()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return s_enabled;
+    }
+
+    static void PhaseStart(Phase phase);
+    static void PhaseEnd(Phase phase);
+
+    static void OnFileOpened()
+    {
+        LIMITED_METHOD_CONTRACT;
+        if (s_enabled)
+        {
+            InterlockedIncrement(&s_filesOpened);
+        }
+    }
+
+    static void OnMethodReadyToRun()
+    {
+        LIMITED_METHOD_CONTRACT;
+        if (s_enabled)
+        {
+            InterlockedIncrement(&s_methodsReadyToRun);
+        }
+    }
+
+    // Writes the summary, called once at shutdown
+    static void Write();
+};
+
+#endif // STARTUPSUMMARY_H
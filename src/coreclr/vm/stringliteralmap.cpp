@@ -39,6 +39,11 @@
     will all come before destruction of the map, the hash table is safe for multiple readers,
     and we know the StringLiteralEntry so found 1) can't be destroyed because that table keeps
     an AddRef on it and 2) isn't internally modified once created.
+
+    Non-collectible loader allocators don't have a StringLiteralMap table of their own, they
+    keep the reference they got on the global entry forever instead. Those entries go into the
+    global map's StringLiteralEntryCache, which can be read without the lock for the same
+    reasons, so ldstr and string.Intern only take the lock the first time they see a string.
 */
 
 #define GLOBAL_STRING_TABLE_BUCKET_SIZE 128
@@ -158,6 +163,24 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
     HashDatum Data;
 
     DWORD dwHash = m_StringToEntryHashTable->GetHash(pStringData);
+
+    // Don't use FOH for collectible modules to avoid potential memory leaks
+    const bool preferFrozenObjectHeap = !bIsCollectible;
+
+    if (!bIsCollectible)
+    {
+        StringLiteralEntry *pCachedEntry = SystemDomain::GetGlobalStringLiteralMap()->LookupImmortalEntry(pStringData, dwHash);
+        if (pCachedEntry != NULL)
+        {
+            STRINGREF *pStrObj = pCachedEntry->GetStringObject();
+            if (ppPinnedString != nullptr && pCachedEntry->IsStringFrozen())
+            {
+                *ppPinnedString = *reinterpret_cast<void**>(pStrObj);
+            }
+            return pStrObj;
+        }
+    }
+
     // Retrieve the string literal from the global string literal map.
     CrstHolder gch(&(SystemDomain::GetGlobalStringLiteralMap()->m_HashTableCrstGlobal));
 
@@ -165,8 +188,6 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
     // someone beat us to inserting it. (m_StringToEntryHashTable->GetValue(pStringData, &Data))
     // (Rather than waiting until after we look the string up in the global map)
 
-    // Don't use FOH for collectible modules to avoid potential memory leaks
-    const bool preferFrozenObjectHeap = !bIsCollectible;
     StringLiteralEntryHolder pEntry(SystemDomain::GetGlobalStringLiteralMap()->GetStringLiteral(pStringData, dwHash, bAddIfNotFound, preferFrozenObjectHeap));
 
     _ASSERTE(pEntry || !bAddIfNotFound);
@@ -192,12 +213,12 @@ STRINGREF *StringLiteralMap::GetStringLiteral(EEStringData *pStringData, BOOL bA
                 pEntry.Release(); //while we're still under lock
             }
         }
-#ifdef _DEBUG
         else
         {
+            // We never release this reference so the entry stays in the global map for good
+            SystemDomain::GetGlobalStringLiteralMap()->AddImmortalEntry(pEntry, dwHash);
             LOG((LF_APPDOMAIN, LL_INFO10000, "Avoided adding String literal to appdomain map: size: %d bytes\n", pStringData->GetCharCount()));
         }
-#endif
         pEntry.SuppressRelease();
         STRINGREF *pStrObj = NULL;
         // Retrieve the string objectref from the string literal entry.
@@ -243,6 +264,15 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
     }
     else
     {
+        if (!bIsCollectible)
+        {
+            StringLiteralEntry *pCachedEntry = SystemDomain::GetGlobalStringLiteralMap()->LookupImmortalEntry(&StringData, dwHash);
+            if (pCachedEntry != NULL)
+            {
+                return pCachedEntry->GetStringObject();
+            }
+        }
+
         CrstHolder gch(&(SystemDomain::GetGlobalStringLiteralMap()->m_HashTableCrstGlobal));
 
         // TODO: We can be more efficient by checking our local hash table now to see if
@@ -280,6 +310,11 @@ STRINGREF *StringLiteralMap::GetInternedString(STRINGREF *pString, BOOL bAddIfNo
                     pEntry.Release(); // while we're under lock
                 }
             }
+            else
+            {
+                // We never release this reference so the entry stays in the global map for good
+                SystemDomain::GetGlobalStringLiteralMap()->AddImmortalEntry(pEntry, dwHash);
+            }
             pEntry.SuppressRelease();
             // Retrieve the string objectref from the string literal entry.
             STRINGREF *pStrObj = NULL;
@@ -576,6 +611,146 @@ StringLiteralEntry *GlobalStringLiteralMap::AddInternedString(STRINGREF *pString
     return pRet;
 }
 
+void GlobalStringLiteralMap::AddImmortalEntry(StringLiteralEntry *pEntry, DWORD dwHash)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        PRECONDITION(CheckPointer(pEntry));
+        PRECONDITION(m_HashTableCrstGlobal.OwnedByCurrentThread());
+    }
+    CONTRACTL_END;
+
+    m_ImmortalEntryCache.Add(pEntry, dwHash);
+}
+
+StringLiteralEntryCache::StringLiteralEntryCache()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    for (DWORD i = 0; i < NUM_SHARDS; i++)
+    {
+        m_pShards[i] = NULL;
+    }
+}
+
+StringLiteralEntryCache::Shard *StringLiteralEntryCache::AllocateShard(DWORD dwCapacity, Shard *pPrevious)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+    }
+    CONTRACTL_END;
+
+    size_t cbShard = offsetof(Shard, slots) + (size_t)dwCapacity * sizeof(Slot);
+    Shard *pShard = (Shard*)new (nothrow) BYTE[cbShard];
+    if (pShard != NULL)
+    {
+        memset(pShard, 0, cbShard);
+        pShard->pPrevious = pPrevious;
+        pShard->dwCapacity = dwCapacity;
+    }
+
+    return pShard;
+}
+
+void StringLiteralEntryCache::InsertSlot(Shard *pShard, StringLiteralEntry *pEntry, DWORD dwHash)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    DWORD dwMask = pShard->dwCapacity - 1;
+    for (DWORD i = (dwHash / NUM_SHARDS) & dwMask; ; i = (i + 1) & dwMask)
+    {
+        Slot *pSlot = &pShard->slots[i];
+        if (pSlot->pEntry == pEntry)
+            return;
+
+        if (pSlot->pEntry == NULL)
+        {
+            pSlot->dwHash = dwHash;
+            VolatileStore(&pSlot->pEntry, pEntry);
+            pShard->dwCount++;
+            return;
+        }
+    }
+}
+
+StringLiteralEntry *StringLiteralEntryCache::Lookup(EEStringData *pStringData, DWORD dwHash)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_COOPERATIVE;
+        PRECONDITION(CheckPointer(pStringData));
+    }
+    CONTRACTL_END;
+
+    Shard *pShard = VolatileLoad(&m_pShards[dwHash % NUM_SHARDS]);
+    if (pShard == NULL)
+        return NULL;
+
+    // Shards are never more than 3/4 full so this always finds an empty slot eventually
+    DWORD dwMask = pShard->dwCapacity - 1;
+    for (DWORD i = (dwHash / NUM_SHARDS) & dwMask; ; i = (i + 1) & dwMask)
+    {
+        StringLiteralEntry *pEntry = VolatileLoad(&pShard->slots[i].pEntry);
+        if (pEntry == NULL)
+            return NULL;
+
+        if (pShard->slots[i].dwHash == dwHash)
+        {
+            EEStringData entryData;
+            pEntry->GetStringData(&entryData);
+            if ((entryData.GetCharCount() == pStringData->GetCharCount()) &&
+                (memcmp(entryData.GetStringBuffer(), pStringData->GetStringBuffer(), pStringData->GetCharCount() * sizeof(WCHAR)) == 0))
+            {
+                return pEntry;
+            }
+        }
+    }
+}
+
+void StringLiteralEntryCache::Add(StringLiteralEntry *pEntry, DWORD dwHash)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        PRECONDITION(CheckPointer(pEntry));
+    }
+    CONTRACTL_END;
+
+    Shard **ppShard = &m_pShards[dwHash % NUM_SHARDS];
+    Shard *pShard = *ppShard;
+
+    if ((pShard == NULL) || ((pShard->dwCount + 1) * 4 > pShard->dwCapacity * 3))
+    {
+        // Readers keep using the old table until the new one is published
+        Shard *pNewShard = AllocateShard((pShard == NULL) ? INITIAL_SHARD_CAPACITY : pShard->dwCapacity * 2, pShard);
+        if (pNewShard == NULL)
+            return;
+
+        if (pShard != NULL)
+        {
+            for (DWORD i = 0; i < pShard->dwCapacity; i++)
+            {
+                if (pShard->slots[i].pEntry != NULL)
+                {
+                    InsertSlot(pNewShard, pShard->slots[i].pEntry, pShard->slots[i].dwHash);
+                }
+            }
+        }
+
+        VolatileStore(ppShard, pNewShard);
+        pShard = pNewShard;
+    }
+
+    InsertSlot(pShard, pEntry, dwHash);
+}
+
 void GlobalStringLiteralMap::RemoveStringLiteralEntry(StringLiteralEntry *pEntry)
 {
    CONTRACTL
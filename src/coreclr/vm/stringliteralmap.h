@@ -55,6 +55,45 @@ private:
     MemoryPool                  *m_MemoryPool;
 };
 
+// Lock-free read cache of the global map entries that can never be removed, i.e. the ones handed
+// out to non-collectible loader allocators, which keep their reference forever. Entries are only
+// ever added, under the global map's crst, so lookups don't take any lock. The cache is split in
+// shards by hash so growing it only copies one shard at a time. Replaced shard tables are never
+// freed since lock-free readers may still be probing them.
+class StringLiteralEntryCache
+{
+public:
+    StringLiteralEntryCache();
+
+    StringLiteralEntry *Lookup(EEStringData *pStringData, DWORD dwHash);
+
+    // Best effort, the entry is simply not cached if we run out of memory.
+    void Add(StringLiteralEntry *pEntry, DWORD dwHash);
+
+private:
+    static const DWORD NUM_SHARDS = 16;
+    static const DWORD INITIAL_SHARD_CAPACITY = 64;
+
+    struct Slot
+    {
+        DWORD               dwHash;
+        StringLiteralEntry *pEntry;     // published last, NULL for an empty slot
+    };
+
+    struct Shard
+    {
+        Shard  *pPrevious;              // the table this one replaced
+        DWORD   dwCapacity;             // always a power of 2
+        DWORD   dwCount;
+        Slot    slots[1];
+    };
+
+    static Shard *AllocateShard(DWORD dwCapacity, Shard *pPrevious);
+    static void InsertSlot(Shard *pShard, StringLiteralEntry *pEntry, DWORD dwHash);
+
+    Shard *m_pShards[NUM_SHARDS];
+};
+
 // Global string literal map.
 class GlobalStringLiteralMap
 {
@@ -76,6 +115,16 @@ public:
     // Method to explicitly intern a string object. Takes a precomputed hash (for perf).
     StringLiteralEntry *GetInternedString(STRINGREF *pString, DWORD dwHash, BOOL bAddIfNotFound);
 
+    // Lock-free lookup of the entries that were handed out to non-collectible loader allocators.
+    StringLiteralEntry *LookupImmortalEntry(EEStringData *pStringData, DWORD dwHash)
+    {
+        WRAPPER_NO_CONTRACT;
+        return m_ImmortalEntryCache.Lookup(pStringData, dwHash);
+    }
+
+    // Records an entry handed out to a non-collectible loader allocator. Must hold the global crst.
+    void AddImmortalEntry(StringLiteralEntry *pEntry, DWORD dwHash);
+
     // Method to calculate the hash
     DWORD GetHash(EEStringData* pData)
     {
@@ -116,6 +165,9 @@ private:
     // The pinned heap handle table.
     PinnedHeapHandleTable        m_PinnedHeapHandleTable;
 
+    // Entries that can be looked up without taking m_HashTableCrstGlobal.
+    StringLiteralEntryCache      m_ImmortalEntryCache;
+
 };
 
 class StringLiteralEntryArray;
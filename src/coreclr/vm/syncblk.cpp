@@ -496,6 +496,7 @@ void SyncBlockCache::Init()
     m_OldSyncTables = 0;
     m_bSyncBlockCleanupInProgress = FALSE;
     m_EphemeralBitmap = 0;
+    m_GCScanLock = 0;
 }
 
 void SyncBlockCache::Destroy()
@@ -1223,11 +1224,141 @@ void SyncBlockCache::GCWeakPtrScan(HANDLESCANPROC scanProc, uintptr_t lp1, uintp
 #endif // VERIFY_HEAP
 }
 
+// Same as GCWeakPtrScan, but only scans the part of the table assigned to the GC thread described by the
+// ScanContext in lp1. The table is split in chunks of whole ephemeral bitmap words so no two threads touch the
+// same card. Entries freed by the scan are collected privately and spliced onto the free list at the end.
+void SyncBlockCache::GCWeakPtrScanPartition(HANDLESCANPROC scanProc, uintptr_t lp1, uintptr_t lp2)
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    ScanContext* sc = (ScanContext*)lp1;
+    size_t threadNumber = (size_t)sc->thread_number;
+    size_t threadCount = (size_t)max(sc->thread_count, 1);
+
+#ifdef VERIFY_HEAP
+    // Verification compares the scan against a copy of the whole table, leave it to a single thread
+    if (g_pConfig->GetHeapVerifyLevel() & EEConfig::HEAPVERIFY_SYNCBLK)
+    {
+        if (threadNumber == 0)
+        {
+            GCWeakPtrScan(scanProc, lp1, lp2);
+        }
+        return;
+    }
+#endif //VERIFY_HEAP
+
+    if (threadNumber == 0)
+    {
+        // Nothing else looks at the obsolete arrays, the first thread deletes them
+        SyncTableEntry* arr;
+        while ((arr = m_OldSyncTables) != NULL)
+        {
+            m_OldSyncTables = (SyncTableEntry*)arr[0].m_Object.Load();
+            delete[] arr;
+        }
+    }
+
+    size_t bitmapWords = BitMapSize (m_SyncTableSize);
+    size_t wordsPerThread = (bitmapWords + threadCount - 1) / threadCount;
+    size_t dwStart = min(bitmapWords, threadNumber * wordsPerThread);
+    size_t dwEnd = min(bitmapWords, dwStart + wordsPerThread);
+
+    BOOL fSetSyncBlockCleanup = FALSE;
+    GCScanFreeList freeList = { 0, 0 };
+
+    if (GCHeapUtilities::GetGCHeap()->GetCondemnedGeneration() < GCHeapUtilities::GetGCHeap()->GetMaxGeneration())
+    {
+        for (size_t dw = dwStart; dw < dwEnd; dw++)
+        {
+            if (m_EphemeralBitmap[dw] == 0)
+                continue;
+
+            for (int i = 0; i < card_word_width; i++)
+            {
+                size_t card = i+dw*card_word_width;
+                if (CardSetP (card))
+                {
+                    BOOL clear_card = TRUE;
+                    for (int idx = 0; idx < card_size; idx++)
+                    {
+                        size_t nb = CardIndex (card) + idx;
+                        if (( nb < m_FreeSyncTableIndex) && (nb > 0))
+                        {
+                            Object* o = SyncTableEntry::GetSyncTableEntry()[nb].m_Object;
+                            if (o && !((size_t)o & 1))
+                            {
+                                if (GCHeapUtilities::GetGCHeap()->IsEphemeral (o))
+                                {
+                                    clear_card = FALSE;
+
+                                    GCWeakPtrScanElement ((int)nb, scanProc,
+                                                          lp1, lp2, fSetSyncBlockCleanup, &freeList);
+                                }
+                            }
+                        }
+                    }
+                    if (clear_card)
+                        ClearCard (card);
+                }
+            }
+        }
+    }
+    else
+    {
+        size_t nbStart = max(CardIndex (dwStart * card_word_width), (size_t)1);
+        size_t nbEnd = min(CardIndex (dwEnd * card_word_width), (size_t)m_FreeSyncTableIndex);
+        for (size_t nb = nbStart; nb < nbEnd; nb++)
+        {
+            GCWeakPtrScanElement ((int)nb, scanProc, lp1, lp2, fSetSyncBlockCleanup, &freeList);
+        }
+    }
+
+    if (freeList.m_Head != 0)
+    {
+        EnterGCScanLock();
+        SyncTableEntry::GetSyncTableEntry()[freeList.m_Tail].m_Object = (Object *)(m_FreeSyncTableList | 1);
+        m_FreeSyncTableList = freeList.m_Head;
+        LeaveGCScanLock();
+    }
+
+    if (fSetSyncBlockCleanup)
+    {
+        // mark the finalizer thread saying requires cleanup
+        FinalizerThread::GetFinalizerThread()->SetSyncBlockCleanup();
+        FinalizerThread::EnableFinalization();
+    }
+}
+
+void SyncBlockCache::EnterGCScanLock()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    while (InterlockedCompareExchange(&m_GCScanLock, 1, 0) != 0)
+    {
+        YieldProcessor();
+    }
+}
+
+void SyncBlockCache::LeaveGCScanLock()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    VolatileStore(&m_GCScanLock, (LONG)0);
+}
+
 /* Scan the weak pointers in the SyncBlockEntry and report them to the GC.  If the
-   reference is dead, then return TRUE */
+   reference is dead, then return TRUE. During a parallel scan pFreeList receives
+   the freed entry instead of m_FreeSyncTableList. */
 
 BOOL SyncBlockCache::GCWeakPtrScanElement (int nb, HANDLESCANPROC scanProc, LPARAM lp1, LPARAM lp2,
-                                           BOOL& cleanup)
+                                           BOOL& cleanup, GCScanFreeList* pFreeList)
 {
     CONTRACTL
     {
@@ -1285,12 +1416,25 @@ BOOL SyncBlockCache::GCWeakPtrScanElement (int nb, HANDLESCANPROC scanProc, LPAR
             }
 #endif
 
+            // the cleanup and free block lists are shared by all the GC threads
+            if (pFreeList && pSB)
+                EnterGCScanLock();
+
             if (*keyv)
             {
                 _ASSERTE (pSB);
-                GCDeleteSyncBlock(pSB);
-                //clean the object syncblock header
+                //clean the object syncblock header, the object goes back to the thin lock state
                 ((Object*)(*keyv))->GetHeader()->GCResetIndex();
+                if (pSB->HasLockEvent())
+                {
+                    // the monitor event can't be closed during the GC, let the finalizer thread delete the block
+                    cleanup = TRUE;
+                    InsertCleanupSyncBlock (pSB);
+                }
+                else
+                {
+                    GCDeleteSyncBlock(pSB);
+                }
             }
             else if (pSB)
             {
@@ -1303,12 +1447,27 @@ BOOL SyncBlockCache::GCWeakPtrScanElement (int nb, HANDLESCANPROC scanProc, LPAR
 #endif
             }
 
+            if (pFreeList && pSB)
+                LeaveGCScanLock();
+
             // delete the entry
 #ifdef DUMP_SB
             LogSpewAlways("       Deleting block at %4.4d\n", nb);
 #endif
-            SyncTableEntry::GetSyncTableEntry()[nb].m_Object = (Object *)(m_FreeSyncTableList | 1);
-            m_FreeSyncTableList = nb << 1;
+            if (pFreeList)
+            {
+                // the first entry freed ends up last in the list
+                if (pFreeList->m_Head == 0)
+                    pFreeList->m_Tail = nb;
+
+                SyncTableEntry::GetSyncTableEntry()[nb].m_Object = (Object *)(pFreeList->m_Head | 1);
+                pFreeList->m_Head = nb << 1;
+            }
+            else
+            {
+                SyncTableEntry::GetSyncTableEntry()[nb].m_Object = (Object *)(m_FreeSyncTableList | 1);
+                m_FreeSyncTableList = nb << 1;
+            }
             SyncTableEntry::GetSyncTableEntry()[nb].m_SyncBlock = NULL;
             return TRUE;
         }
@@ -1317,6 +1476,12 @@ BOOL SyncBlockCache::GCWeakPtrScanElement (int nb, HANDLESCANPROC scanProc, LPAR
 #ifdef DUMP_SB
             LogSpewAlways("       Keeping block at %4.4d with oref %8.8x\n", nb, *keyv);
 #endif
+            // the block becomes reclaimable if its lock sees no waiter until the next GC, the
+            // scan also runs for relocation so only the mark phase starts a new interval
+            if (pSB && ((ScanContext*)lp1)->promotion)
+            {
+                pSB->ResetContendedSinceLastScan();
+            }
         }
     }
     return FALSE;
@@ -1596,15 +1761,17 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 return result;
             }
 
+            // Once the monitor is in AwareLock mode, spin for as long as spinning has recently been paying off for this lock
+            const DWORD lockSpinCount = awareLock->GetSpinCount();
             ++spinIteration;
-            if (spinIteration < spinCount)
+            if (spinIteration < lockSpinCount)
             {
                 while (true)
                 {
                     AwareLock::SpinWait(normalizationInfo, spinIteration);
 
                     ++spinIteration;
-                    if (spinIteration >= spinCount)
+                    if (spinIteration >= lockSpinCount)
                     {
                         // The last lock attempt for this spin will be done after the loop
                         break;
@@ -1613,6 +1780,7 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                     result = awareLock->TryEnterInsideSpinLoopHelper(pCurThread);
                     if (result == AwareLock::EnterHelperResult_Entered)
                     {
+                        awareLock->RecordSpinResult(true);
                         return AwareLock::EnterHelperResult_Entered;
                     }
                     if (result == AwareLock::EnterHelperResult_UseSlowPath)
@@ -1622,7 +1790,9 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 }
             }
 
-            if (awareLock->TryEnterAfterSpinLoopHelper(pCurThread))
+            bool acquiredLock = awareLock->TryEnterAfterSpinLoopHelper(pCurThread);
+            awareLock->RecordSpinResult(acquiredLock);
+            if (acquiredLock)
             {
                 return AwareLock::EnterHelperResult_Entered;
             }
@@ -2336,10 +2506,12 @@ void AwareLock::AllocLockSemEvent()
     }
     CONTRACTL_END;
 
-    // Before we switch from cooperative, ensure that this syncblock won't disappear
-    // under us.  For something as expensive as an event, do it permanently rather
-    // than transiently.
-    SetPrecious();
+    // The caller holds the syncblock transiently precious, so it won't disappear
+    // under us when we switch from cooperative. The event does not pin the syncblock
+    // permanently: once the lock has gone a full sync block scan without contention,
+    // the GC detaches the syncblock and the event is closed on the finalizer thread
+    // (see SyncBlockCache::GCWeakPtrScanElement).
+    _ASSERTE(m_TransientPrecious > 0);
 
     GCX_PREEMP();
 
@@ -2566,6 +2738,7 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
 
     // We cannot allow the AwareLock to be cleaned up underneath us by the GC.
     IncrementTransientPrecious();
+    m_contendedSinceLastScan = true;
 
     DWORD ret;
     GCPROTECT_BEGIN(obj);
@@ -2639,7 +2812,7 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
             {
                 bool acquiredLock = false;
                 YieldProcessorNormalizationInfo normalizationInfo;
-                const DWORD spinCount = g_SpinConstants.dwMonitorSpinCount;
+                const DWORD spinCount = GetSpinCount();
                 for (DWORD spinIteration = 0; spinIteration < spinCount; ++spinIteration)
                 {
                     if (m_lockState.InterlockedTry_LockAndUnregisterWaiterAndObserveWakeSignal(this))
@@ -2650,6 +2823,7 @@ BOOL AwareLock::EnterEpilogHelper(Thread* pCurThread, INT32 timeOut)
 
                     SpinWait(normalizationInfo, spinIteration);
                 }
+                RecordSpinResult(acquiredLock);
                 if (acquiredLock)
                 {
                     break;
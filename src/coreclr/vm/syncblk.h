@@ -450,7 +450,16 @@ private:
     DWORD m_waiterStarvationStartTimeMs;
     int m_emittedLockCreatedEvent;
 
+    // Number of spin iterations used by threads contending on this lock, see GetSpinCount(). 0 means that the lock has
+    // not been tuned yet and uses the global monitor spin count.
+    DWORD m_spinCount;
+
+    // Set when a thread has to wait for the lock and cleared by the GC sync block scan. A syncblock that keeps its
+    // monitor event only because of past contention is reclaimed once the lock has gone a full scan without waiters.
+    bool m_contendedSinceLastScan;
+
     static const DWORD WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters = 100;
+    static const DWORD MinimumSpinCount = 2;
 
     // Only SyncBlocks can create AwareLocks.  Hence this private constructor.
     AwareLock(DWORD indx)
@@ -463,7 +472,9 @@ private:
           m_TransientPrecious(0),
           m_dwSyncIndex(indx),
           m_waiterStarvationStartTimeMs(0),
-          m_emittedLockCreatedEvent(0)
+          m_emittedLockCreatedEvent(0),
+          m_spinCount(0),
+          m_contendedSinceLastScan(false)
     {
         LIMITED_METHOD_CONTRACT;
     }
@@ -542,6 +553,13 @@ private: // friend access is required for this unsafe function
 public:
     static void SpinWait(const YieldProcessorNormalizationInfo &normalizationInfo, DWORD spinIteration);
 
+    // Per-lock spin tuning. Spinning that ends up acquiring the lock means that the owner tends to release it within a
+    // spin, so the lock is allowed to spin a bit longer; spinning that ends in a wait means that the owner holds the lock
+    // for longer than a spin, so later contenders give up sooner. This tracks the owner's hold time without timing the
+    // uncontended path.
+    DWORD GetSpinCount() const;
+    void RecordSpinResult(bool acquiredLock);
+
     // Helper encapsulating the fast path entering monitor. Returns what kind of result was achieved.
     bool TryEnterHelper(Thread* pCurThread);
 
@@ -1073,7 +1091,29 @@ class SyncBlock
         WRAPPER_NO_CONTRACT;
         return (!IsPrecious() &&
                 m_Monitor.IsUnlockedWithNoWaiters() &&
-                m_Monitor.m_TransientPrecious == 0);
+                m_Monitor.m_TransientPrecious == 0 &&
+                (!HasLockEvent() || IsLockEventIdle()));
+    }
+
+    // A monitor event is only created once the lock has seen a waiter. Such a syncblock is kept across
+    // sync block scans while the lock keeps being contended, and is released through the cleanup list
+    // once it has gone idle, since the event cannot be closed during the GC.
+    BOOL HasLockEvent()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return m_Monitor.m_SemEvent.IsMonitorEventAllocated();
+    }
+
+    BOOL IsLockEventIdle()
+    {
+        LIMITED_METHOD_CONTRACT;
+        return (m_Monitor.GetLockState() == 0 && !m_Monitor.m_contendedSinceLastScan);
+    }
+
+    void ResetContendedSinceLastScan()
+    {
+        LIMITED_METHOD_CONTRACT;
+        m_Monitor.m_contendedSinceLastScan = false;
     }
 
     // Gets the InteropInfo block, creates a new one if none is present.
@@ -1337,8 +1377,20 @@ class SyncBlockCache
 
     BOOL        m_bSyncBlockCleanupInProgress;  // A flag indicating if sync block cleanup is in progress.
     DWORD*      m_EphemeralBitmap;      // card table for ephemeral scanning
+    LONG        m_GCScanLock;           // serializes GC threads retiring sync blocks during a parallel scan
 
-    BOOL        GCWeakPtrScanElement(int elindex, HANDLESCANPROC scanProc, LPARAM lp1, LPARAM lp2, BOOL& cleanup);
+    // Sync table entries freed by one GC thread during a parallel weak pointer scan. They're linked the
+    // same way as m_FreeSyncTableList so the whole list can be spliced onto it at once.
+    struct GCScanFreeList
+    {
+        size_t  m_Head;
+        DWORD   m_Tail;
+    };
+
+    BOOL        GCWeakPtrScanElement(int elindex, HANDLESCANPROC scanProc, LPARAM lp1, LPARAM lp2, BOOL& cleanup,
+                                     GCScanFreeList* pFreeList = NULL);
+    void        EnterGCScanLock();
+    void        LeaveGCScanLock();
 
     void SetCard (size_t card);
     void ClearCard (size_t card);
@@ -1383,6 +1435,9 @@ class SyncBlockCache
 
     void    GCWeakPtrScan(HANDLESCANPROC scanProc, uintptr_t lp1, uintptr_t lp2);
 
+    // scans the part of the table assigned to one GC thread, called on all GC threads concurrently
+    void    GCWeakPtrScanPartition(HANDLESCANPROC scanProc, uintptr_t lp1, uintptr_t lp2);
+
     void    GCDone(BOOL demoting, int max_gen);
 
     void    CleanupSyncBlocks();
@@ -468,6 +468,35 @@ FORCEINLINE void AwareLock::SpinWait(const YieldProcessorNormalizationInfo &norm
     YieldProcessorWithBackOffNormalized(normalizationInfo, spinIteration);
 }
 
+FORCEINLINE DWORD AwareLock::GetSpinCount() const
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // The global spin count is also the upper bound, which keeps SpinWait's iteration check valid
+    DWORD maxSpinCount = g_SpinConstants.dwMonitorSpinCount;
+    DWORD spinCount = VolatileLoadWithoutBarrier(&m_spinCount);
+    return (spinCount == 0 || spinCount > maxSpinCount) ? maxSpinCount : spinCount;
+}
+
+FORCEINLINE void AwareLock::RecordSpinResult(bool acquiredLock)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Races between contending threads only make the adjustment less precise, so no interlocked operation is used
+    DWORD spinCount = GetSpinCount();
+    if (acquiredLock)
+    {
+        if (spinCount < g_SpinConstants.dwMonitorSpinCount)
+        {
+            VolatileStoreWithoutBarrier(&m_spinCount, spinCount + 1);
+        }
+    }
+    else if (spinCount > MinimumSpinCount)
+    {
+        VolatileStoreWithoutBarrier(&m_spinCount, spinCount - 1);
+    }
+}
+
 FORCEINLINE bool AwareLock::TryEnterHelper(Thread* pCurThread)
 {
     CONTRACTL{
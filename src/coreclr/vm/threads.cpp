@@ -1593,6 +1593,32 @@ Thread::Thread()
 #endif // _DEBUG
 }
 
+#if defined(TARGET_ARM64) && defined(TARGET_LINUX)
+//--------------------------------------------------------------------
+// The JIT only supports SVE with 128-bit vectors. When asked to, limit the
+// vector length of each thread running managed code to that, so SVE can be
+// used on hardware with wider vectors (see EEJitManager::SetCpuInfo).
+//--------------------------------------------------------------------
+void ClampSveVectorLength()
+{
+    WRAPPER_NO_CONTRACT;
+
+    // 0: not initialized yet, 1: disabled, 2: enabled
+    static int s_clampState = 0;
+
+    if (s_clampState == 0)
+    {
+        s_clampState = (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_Arm64ClampSveVectorLength) != 0) ? 2 : 1;
+    }
+
+    if ((s_clampState == 2) && !PAL_SetSveVectorLength(16))
+    {
+        // No SVE support, there is nothing to clamp
+        s_clampState = 1;
+    }
+}
+#endif // TARGET_ARM64 && TARGET_LINUX
+
 //--------------------------------------------------------------------
 // Failable initialization occurs here.
 //--------------------------------------------------------------------
@@ -1615,6 +1641,10 @@ void Thread::InitThread()
         // log will not allocate memory at these critical times an avoid deadlock.
     STRESS_LOG2(LF_ALWAYS, LL_ALWAYS, "SetupThread  managed Thread %p Thread Id = %x\n", this, GetThreadId());
 
+#if defined(TARGET_ARM64) && defined(TARGET_LINUX)
+    ClampSveVectorLength();
+#endif // TARGET_ARM64 && TARGET_LINUX
+
 #ifndef TARGET_UNIX
     // workaround: Remove this when we flow impersonation token to host.
     BOOL    reverted = FALSE;
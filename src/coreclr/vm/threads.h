@@ -321,6 +321,10 @@ const CLONE_QUEUE_USER_APC_FLAGS SpecialUserModeApcWithContextFlags =
 Thread* SetupThread();
 Thread* SetupThreadNoThrow(HRESULT *phresult = NULL);
 
+#if defined(TARGET_ARM64) && defined(TARGET_LINUX)
+void ClampSveVectorLength();
+#endif // TARGET_ARM64 && TARGET_LINUX
+
 enum SetupUnstartedThreadFlags
 {
     SUTF_None = 0,
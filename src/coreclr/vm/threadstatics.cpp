@@ -960,6 +960,9 @@ void GetThreadLocalStaticBlocksInfo(CORINFO_THREAD_STATIC_BLOCKS_INFO* pInfo)
     pInfo->offsetOfMaxThreadStaticBlocks = (uint32_t)(threadStaticBaseOffset + offsetof(ThreadLocalData, cNonCollectibleTlsData));
     pInfo->offsetOfThreadStaticBlocks = (uint32_t)(threadStaticBaseOffset + offsetof(ThreadLocalData, pNonCollectibleTlsArrayData));
     pInfo->offsetOfBaseOfThreadLocalData = (uint32_t)threadStaticBaseOffset;
+    pInfo->offsetOfMaxCollectibleThreadStaticBlocks = (uint32_t)(threadStaticBaseOffset + offsetof(ThreadLocalData, cCollectibleTlsData));
+    pInfo->offsetOfCollectibleThreadStaticBlocks = (uint32_t)(threadStaticBaseOffset + offsetof(ThreadLocalData, pCollectibleTlsArrayData));
+    pInfo->collectibleTypeIndexFlag = TLSIndex(TLSIndexType::Collectible, 0).TLSIndexRawIndex;
 }
 #endif // !DACCESS_COMPILE
 
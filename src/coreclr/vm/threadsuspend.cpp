@@ -3305,28 +3305,79 @@ void ThreadSuspend::SuspendAllThreads()
     uint32_t rehijackDelay = 8;
     uint32_t usecsSinceYield = 0;
 
+    // A thread seen in preemptive mode can't switch back to cooperative mode until the suspension is over,
+    // so once few enough threads remain in cooperative mode only those are checked again. That keeps the
+    // passes cheap in processes with thousands of threads but only a few of them running managed code.
+    const int maxPendingThreads = 64;
+    Thread* pendingThreads[maxPendingThreads];
+    int pendingCount = -1; // -1 while the remaining threads don't fit and the whole list is walked
+
+    // Suspension telemetry: the time to reach the safe point, the number of hijacking passes and the
+    // last thread to get there. That thread surviving several hijacking passes usually means it was
+    // running a loop without GC polls.
+    int64_t startTicks = minipal_hires_ticks();
+    int hijackPasses = 0;
+    Thread* pSlowestThread = NULL;
+
     while(true)
     {
         int remaining = 0;
-        Thread* pTargetThread = NULL;
-        while ((pTargetThread = ThreadStore::GetThreadList(pTargetThread)) != NULL)
+        if (pendingCount < 0)
         {
-            if (pTargetThread == pCurThread)
-                continue;
+            Thread* pTargetThread = NULL;
+            while ((pTargetThread = ThreadStore::GetThreadList(pTargetThread)) != NULL)
+            {
+                if (pTargetThread == pCurThread)
+                    continue;
+
+                if (pTargetThread->m_fPreemptiveGCDisabled.LoadWithoutBarrier())
+                {
+                    if (remaining < maxPendingThreads)
+                    {
+                        pendingThreads[remaining] = pTargetThread;
+                    }
+
+                    remaining++;
+                    pSlowestThread = pTargetThread;
+                    if (!observeOnly)
+                    {
+                        pTargetThread->Hijack();
+                    }
+                }
+            }
 
-            if (pTargetThread->m_fPreemptiveGCDisabled.LoadWithoutBarrier())
+            if (remaining <= maxPendingThreads)
             {
-                remaining++;
-                if (!observeOnly)
+                pendingCount = remaining;
+            }
+        }
+        else
+        {
+            for (int i = 0; i < pendingCount; i++)
+            {
+                Thread* pTargetThread = pendingThreads[i];
+                if (pTargetThread->m_fPreemptiveGCDisabled.LoadWithoutBarrier())
                 {
-                    pTargetThread->Hijack();
+                    pendingThreads[remaining++] = pTargetThread;
+                    pSlowestThread = pTargetThread;
+                    if (!observeOnly)
+                    {
+                        pTargetThread->Hijack();
+                    }
                 }
             }
+
+            pendingCount = remaining;
         }
 
         if (remaining == 0)
             break;
 
+        if (!observeOnly)
+        {
+            hijackPasses++;
+        }
+
         // if we see progress or have just done a hijacking pass
         // do not hijack in the next iteration
         if (remaining < prevRemaining || !observeOnly)
@@ -3362,6 +3413,10 @@ void ThreadSuspend::SuspendAllThreads()
         }
     }
 
+    int64_t usecsToSafePoint = (minipal_hires_ticks() - startTicks) * 1000000 / minipal_hires_tick_frequency();
+    STRESS_LOG3(LF_SYNC, LL_INFO100, "Thread::SuspendAllThreads() - Time to safe point %d usec, %d hijacking passes, last thread %p\n",
+        (int)usecsToSafePoint, hijackPasses, pSlowestThread);
+
 #if defined(TARGET_ARM) || defined(TARGET_ARM64)
     // Flush the store buffers on all CPUs, to ensure that all changes made so far are seen
     // by the GC threads. This only matters on weak memory ordered processors as
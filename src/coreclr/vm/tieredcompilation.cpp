@@ -35,6 +35,12 @@
 // item we handle as many methods as possible in a fixed period of time, then
 // queue another threadpool work item if m_methodsToOptimize hasn't been drained.
 //
+// When TC_BackgroundWorkerCount is greater than one and a large number of methods
+// is queued at once (typically after a warmup phase), the background worker also
+// recruits helper worker threads. Helpers only drain m_methodsToOptimize and exit
+// once it is empty; everything else (the tiering delay, completing call counting
+// and deleting call counting stubs) is still only done by the background worker.
+//
 // The background thread enters at StaticBackgroundWorkCallback(), enters the
 // appdomain, and then begins calling OptimizeMethod on each method in the
 // queue. For each method we jit it, then update the precode so that future
@@ -58,6 +64,7 @@ Thread *TieredCompilationManager::s_backgroundWorkerThread = nullptr;
 CLREventStatic TieredCompilationManager::s_backgroundWorkAvailableEvent;
 bool TieredCompilationManager::s_isBackgroundWorkerRunning = false;
 bool TieredCompilationManager::s_isBackgroundWorkerProcessingWork = false;
+UINT32 TieredCompilationManager::s_helperWorkerCount = 0;
 
 // Called at AppDomain construction
 TieredCompilationManager::TieredCompilationManager() :
@@ -66,7 +73,8 @@ TieredCompilationManager::TieredCompilationManager() :
     m_methodsPendingCountingForTier1(nullptr),
     m_tier1CallCountingCandidateMethodRecentlyRecorded(false),
     m_isPendingCallCountingCompletion(false),
-    m_recentlyRequestedCallCountingCompletion(false)
+    m_recentlyRequestedCallCountingCompletion(false),
+    m_lastCallCountingCompletionTickCount(0)
 {
     WRAPPER_NO_CONTRACT;
     // On Unix, we can reach here before EEConfig is initialized, so defer config-based initialization to Init()
@@ -281,8 +289,12 @@ void TieredCompilationManager::AsyncPromoteToTier1(
 #ifdef FEATURE_PGO
     if (g_pConfig->TieredPGO())
     {
+        // If a previous run persisted a profile for this exact IL, skip the instrumented tier and
+        // produce Tier1 code from that profile right away. The lookup was done when the tier0 code
+        // was published, it can't be done here under the code versioning lock.
         if (currentNativeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier0 &&
-            g_pConfig->TieredPGO_InstrumentOnlyHotCode())
+            g_pConfig->TieredPGO_InstrumentOnlyHotCode() &&
+            !PgoManager::IsPersistedPgoDataAvailable(pMethodDesc))
         {
             if (ExecutionManager::IsReadyToRunCode(currentNativeCodeVersion.GetNativeCode()))
             {
@@ -575,6 +587,164 @@ void TieredCompilationManager::BackgroundWorkerStart()
     }
 }
 
+// Decides whether another helper worker should be created to jit queued methods in parallel with the background worker,
+// and if so accounts for it. It's the caller's responsibility to call CreateHelperWorker() after leaving the lock.
+bool TieredCompilationManager::TryReserveHelperWorker_Locked()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(IsLockOwnedByCurrentThread());
+
+    // Each worker should have a decent batch of methods to jit, otherwise the cost of starting a thread is not worth it
+    const UINT32 MinMethodsPerWorker = 16;
+
+    UINT32 maxHelperWorkerCount = g_pConfig->TieredCompilation_BackgroundWorkerCount() - 1;
+    if (s_helperWorkerCount >= maxHelperWorkerCount ||
+        m_countOfMethodsToOptimize < (s_helperWorkerCount + 2) * MinMethodsPerWorker)
+    {
+        return false;
+    }
+
+    ++s_helperWorkerCount;
+    return true;
+}
+
+void TieredCompilationManager::CreateHelperWorker()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(!IsLockOwnedByCurrentThread());
+    _ASSERTE(GetThread() == s_backgroundWorkerThread);
+
+    // Failing to create a helper is not a problem, the background worker will jit the methods instead
+    EX_TRY
+    {
+        Thread *newThread = SetupUnstartedThread();
+        _ASSERTE(newThread != nullptr);
+    #ifdef FEATURE_COMINTEROP
+        newThread->SetApartment(Thread::AS_InMTA);
+    #endif
+        newThread->SetBackground(true);
+
+        if (!newThread->CreateNewThread(0, HelperWorkerBootstrapper0, newThread, W(".NET Tiered Compilation Helper")))
+        {
+            newThread->DecExternalCount(false);
+            ThrowOutOfMemory();
+        }
+
+        newThread->StartThread();
+    }
+    EX_CATCH
+    {
+        {
+            LockHolder tieredCompilationLockHolder;
+
+            _ASSERTE(s_helperWorkerCount != 0);
+            --s_helperWorkerCount;
+        }
+
+        STRESS_LOG1(LF_TIEREDCOMPILATION, LL_WARNING, "TieredCompilationManager::CreateHelperWorker: "
+            "Exception creating a helper worker, hr=0x%x\n",
+            GET_EXCEPTION()->GetHR());
+    }
+    EX_END_CATCH(RethrowTerminalExceptions);
+}
+
+DWORD WINAPI TieredCompilationManager::HelperWorkerBootstrapper0(LPVOID args)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(args != nullptr);
+    Thread *thread = (Thread *)args;
+
+    if (!thread->HasStarted())
+    {
+        LockHolder tieredCompilationLockHolder;
+
+        _ASSERTE(s_helperWorkerCount != 0);
+        --s_helperWorkerCount;
+        return 0;
+    }
+
+    _ASSERTE(GetThread() == thread);
+    ManagedThreadBase::KickOff(HelperWorkerBootstrapper1, nullptr);
+
+    GCX_PREEMP_NO_DTOR();
+
+    DestroyThread(thread);
+    return 0;
+}
+
+void TieredCompilationManager::HelperWorkerBootstrapper1(LPVOID)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    GCX_PREEMP();
+    GetAppDomain()->GetTieredCompilationManager()->HelperWorkerStart();
+}
+
+void TieredCompilationManager::HelperWorkerStart()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    while (true)
+    {
+        NativeCodeVersion nativeCodeVersionToOptimize;
+        {
+            LockHolder tieredCompilationLockHolder;
+
+            // Leave the queue to the background worker while the tiering delay is active, it will recruit helpers again
+            // if necessary
+            if (!IsTieringDelayActive())
+            {
+                nativeCodeVersionToOptimize = GetNextMethodToOptimize();
+            }
+
+            if (nativeCodeVersionToOptimize.IsNull())
+            {
+                _ASSERTE(s_helperWorkerCount != 0);
+                --s_helperWorkerCount;
+                return;
+            }
+        }
+
+        OptimizeMethod(nativeCodeVersionToOptimize);
+
+        // Same as the background worker, give preference to possibly more important work
+        ClrSleepEx(0, false);
+    }
+}
+
 bool TieredCompilationManager::IsTieringDelayActive()
 {
     LIMITED_METHOD_CONTRACT;
@@ -748,6 +918,8 @@ bool TieredCompilationManager::DoBackgroundWork(
     do
     {
         bool completeCallCounting = false;
+        DWORD callCountingCompletionDelayMs = 0;
+        bool createHelperWorker = false;
         NativeCodeVersion nativeCodeVersionToOptimize;
         {
             LockHolder tieredCompilationLockHolder;
@@ -769,11 +941,12 @@ bool TieredCompilationManager::DoBackgroundWork(
                     // methods are continuing to reach the call count threshold.
                     m_recentlyRequestedCallCountingCompletion = false;
                 }
-                else
+                else if (GetCallCountingCompletionBatchDelayMs() == 0)
                 {
                     m_isPendingCallCountingCompletion = false;
                     completeCallCounting = true;
                 }
+                // else, in batched completion mode the next batch is not due yet, jit methods in the meantime
             }
 
             if (!completeCallCounting)
@@ -789,6 +962,7 @@ bool TieredCompilationManager::DoBackgroundWork(
                         m_isPendingCallCountingCompletion = false;
                         _ASSERTE(!m_recentlyRequestedCallCountingCompletion);
                         completeCallCounting = true;
+                        callCountingCompletionDelayMs = GetCallCountingCompletionBatchDelayMs();
                     }
                     else
                     {
@@ -796,12 +970,24 @@ bool TieredCompilationManager::DoBackgroundWork(
                         break;
                     }
                 }
+                else
+                {
+                    createHelperWorker = TryReserveHelperWorker_Locked();
+                }
             }
         }
 
         _ASSERTE(completeCallCounting == !!nativeCodeVersionToOptimize.IsNull());
         if (completeCallCounting)
         {
+            if (callCountingCompletionDelayMs != 0)
+            {
+                // There is nothing else to do until the next batch is due. Methods reaching the call count threshold in the
+                // meantime are queued and completed along with the others.
+                ClrSleepEx(callCountingCompletionDelayMs, false);
+            }
+            m_lastCallCountingCompletionTickCount = CLRGetTickCount64();
+
             EX_TRY
             {
                 CallCountingManager::CompleteCallCounting();
@@ -817,6 +1003,11 @@ bool TieredCompilationManager::DoBackgroundWork(
             continue;
         }
 
+        if (createHelperWorker)
+        {
+            CreateHelperWorker();
+        }
+
         OptimizeMethod(nativeCodeVersionToOptimize);
         ++jittedMethodCount;
 
@@ -925,6 +1116,23 @@ bool TieredCompilationManager::DoBackgroundWork(
     return allMethodsJitted;
 }
 
+// Returns how long the background worker should wait before completing call counting again, in batched completion mode.
+// Called on the background worker thread.
+DWORD TieredCompilationManager::GetCallCountingCompletionBatchDelayMs() const
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(GetThread() == s_backgroundWorkerThread);
+
+    DWORD batchMs = g_pConfig->TieredCompilation_CallCountingCompletionBatchMs();
+    if (batchMs == 0)
+    {
+        return 0;
+    }
+
+    ULONGLONG elapsedMs = CLRGetTickCount64() - m_lastCallCountingCompletionTickCount;
+    return elapsedMs >= batchMs ? 0 : (DWORD)(batchMs - elapsedMs);
+}
+
 // Jit compiles and installs new optimized code for a method.
 // Called on a background thread.
 void TieredCompilationManager::OptimizeMethod(NativeCodeVersion nativeCodeVersion)
@@ -935,6 +1143,22 @@ void TieredCompilationManager::OptimizeMethod(NativeCodeVersion nativeCodeVersio
     if (CompileCodeVersion(nativeCodeVersion))
     {
         ActivateCodeVersion(nativeCodeVersion);
+
+#ifdef FEATURE_MULTICOREJIT
+        // Let a multi-core JIT profile being recorded know about the promotion, so that playback can jit the method at tier 1
+        // right away. Only the default IL version is replayed.
+        MulticoreJitManager & mcJitManager = GetAppDomain()->GetMulticoreJitManager();
+        if (mcJitManager.IsTier1PromotionRecorderActive() &&
+            nativeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier1 &&
+            nativeCodeVersion.GetILCodeVersion().IsDefaultVersion())
+        {
+            MethodDesc *pMethod = nativeCodeVersion.GetMethodDesc();
+            if (MulticoreJitManager::IsMethodSupported(pMethod))
+            {
+                mcJitManager.RecordMethodTier1Promotion(pMethod);
+            }
+        }
+#endif // FEATURE_MULTICOREJIT
     }
 }
 
@@ -62,6 +62,13 @@ private:
     static void BackgroundWorkerBootstrapper1(LPVOID args);
     void BackgroundWorkerStart();
 
+private:
+    bool TryReserveHelperWorker_Locked();
+    static void CreateHelperWorker();
+    static DWORD WINAPI HelperWorkerBootstrapper0(LPVOID args);
+    static void HelperWorkerBootstrapper1(LPVOID args);
+    void HelperWorkerStart();
+
 private:
     bool TryDeactivateTieringDelay();
 
@@ -72,6 +79,7 @@ public:
 private:
     static DWORD StaticBackgroundWorkCallback(void* args);
     bool DoBackgroundWork(UINT64 *workDurationTicksRef, UINT64 minWorkDurationTicks, UINT64 maxWorkDurationTicks);
+    DWORD GetCallCountingCompletionBatchDelayMs() const;
 
 private:
     void OptimizeMethod(NativeCodeVersion nativeCodeVersion);
@@ -124,6 +132,7 @@ private:
     static CLREventStatic s_backgroundWorkAvailableEvent;
     static bool s_isBackgroundWorkerRunning;
     static bool s_isBackgroundWorkerProcessingWork;
+    static UINT32 s_helperWorkerCount;
 #endif // !DACCESS_COMPILE
 
 private:
@@ -134,6 +143,7 @@ private:
     bool m_tier1CallCountingCandidateMethodRecentlyRecorded;
     bool m_isPendingCallCountingCompletion;
     bool m_recentlyRequestedCallCountingCompletion;
+    ULONGLONG m_lastCallCountingCompletionTickCount;
 
 #endif // FEATURE_TIERED_COMPILATION
 };
@@ -1322,6 +1322,8 @@ PCODE VSD_ResolveWorker(TransitionBlock * pTransitionBlock,
         _ASSERTE(!"Throw returned");
     }
 
+    g_resolveCache->OnResolveWorkerCall();
+
 #ifndef TARGET_X86
     if (flags & SDF_ResolvePromoteChain)
     {
@@ -3325,6 +3327,10 @@ DispatchCache::DispatchCache()
 #ifdef STUB_LOGGING
     memset(&cacheData, 0, sizeof(cacheData));
 #endif
+
+    memset(&m_sample, 0, sizeof(m_sample));
+    m_sample.startTick = GetTickCount();
+    m_promotionInterval = CALL_STUB_CACHE_INITIAL_SUCCESS_COUNT;
 }
 
 ResolveCacheElem* DispatchCache::Lookup(size_t token, UINT16 tokenHash, void* mt)
@@ -3478,6 +3484,10 @@ BOOL DispatchCache::Insert(ResolveCacheElem* elem, InsertKind insertKind)
     else if (collide)
         stats.insert_cache_collide++;
 
+    m_sample.inserts++;
+    if (collide)
+        m_sample.collisions++;
+
     return write || miss;
 }
 
@@ -3492,6 +3502,11 @@ void DispatchCache::PromoteChainEntry(ResolveCacheElem* elem)
 
     CrstHolder lh(&m_writeLock);
     g_chained_entry_promoted++;
+    m_sample.promotions++;
+
+    // The resolve stubs reset the success counter to its initial value before asking
+    // for the promotion; apply the adaptive interval instead.
+    g_dispatch_cache_chain_success_counter = m_promotionInterval;
 
     // Figure out what bucket this element belongs in
     UINT16 tokHash = HashToken(elem->token);
@@ -3528,6 +3543,70 @@ void DispatchCache::PromoteChainEntry(ResolveCacheElem* elem)
 }
 #endif // CHAIN_LOOKUP
 
+void DispatchCache::OnResolveWorkerCall()
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        FORBID_FAULT;
+    } CONTRACTL_END;
+
+    m_sample.resolveWorkerCalls++;
+
+    DWORD startTick = m_sample.startTick;
+    DWORD now = GetTickCount();
+    DWORD elapsed = now - startTick;
+    if (elapsed < CALL_STUB_CACHE_SAMPLE_MS)
+        return;
+
+    UINT32 resolveWorkerCalls;
+    UINT32 promotions;
+    UINT32 inserts;
+    UINT32 collisions;
+    size_t promotionInterval;
+
+    {
+#ifdef CHAIN_LOOKUP
+        CrstHolder lh(&m_writeLock);
+#endif
+
+        // Another thread closed this sample window while we were waiting for the lock
+        if (m_sample.startTick != startTick)
+            return;
+
+        resolveWorkerCalls = m_sample.resolveWorkerCalls;
+        promotions = m_sample.promotions;
+        inserts = m_sample.inserts;
+        collisions = m_sample.collisions;
+
+        // Normalize to a full window so that a long quiet period doesn't look like low pressure
+        UINT64 promotionsPerSample = (UINT64)promotions * CALL_STUB_CACHE_SAMPLE_MS / elapsed;
+        if (promotionsPerSample > CALL_STUB_CACHE_PROMOTION_PRESSURE)
+        {
+            if (m_promotionInterval < CALL_STUB_CACHE_MAX_SUCCESS_COUNT)
+                m_promotionInterval *= 2;
+        }
+        else if (promotionsPerSample < CALL_STUB_CACHE_PROMOTION_PRESSURE / 4)
+        {
+            if (m_promotionInterval > CALL_STUB_CACHE_INITIAL_SUCCESS_COUNT)
+                m_promotionInterval /= 2;
+        }
+        promotionInterval = m_promotionInterval;
+
+        memset(&m_sample, 0, sizeof(m_sample));
+        m_sample.startTick = now;
+    }
+
+    if (ETW_EVENT_ENABLED(MICROSOFT_WINDOWS_DOTNETRUNTIME_PROVIDER_DOTNET_Context, VirtualStubDispatchCacheStats))
+    {
+        size_t total;
+        size_t used;
+        GetLoadFactor(&total, &used);
+        FireEtwVirtualStubDispatchCacheStats(GetClrInstanceId(), elapsed, resolveWorkerCalls, promotions, inserts, collisions,
+                                             (UINT32)used, (UINT32)total, (UINT32)promotionInterval);
+    }
+}
+
 void DispatchCache::LogStats()
 {
     LIMITED_METHOD_CONTRACT;
@@ -863,6 +863,12 @@ extern UINT32 STUB_COLLIDE_MONO_PCT;
 #define CALL_STUB_EMPTY_ENTRY   0
 // number of successes for a chained element before it gets moved to the front
 #define CALL_STUB_CACHE_INITIAL_SUCCESS_COUNT (0x100)
+// upper bound the number of successes before a promotion is raised to when promotions are frequent
+#define CALL_STUB_CACHE_MAX_SUCCESS_COUNT (0x10000)
+// length in milliseconds of the window over which resolve cache activity is sampled
+#define CALL_STUB_CACHE_SAMPLE_MS (1000)
+// number of chain promotions in a sample window above which promotions are made less frequent
+#define CALL_STUB_CACHE_PROMOTION_PRESSURE (1024)
 
 /*******************************************************************************************************
 Entry is an abstract class.  We will make specific subclasses for each kind of
@@ -1203,6 +1209,11 @@ public:
 
     void LogStats();
 
+    // Called on every entry into the resolve worker. Periodically adapts the
+    // chain promotion interval to the observed promotion rate, and reports the activity of the
+    // cache over the last sample window through the VirtualStubDispatchCacheStats event.
+    void OnResolveWorkerCall();
+
     // Unlocked iterator of entries. Use only when read/write access to the cache
     // is safe. This would typically be at GC sync points, currently needed during
     // appdomain unloading.
@@ -1236,6 +1247,22 @@ private:
     Crst m_writeLock;
 #endif
 
+    // Activity of the cache in the current sample window. These are updated without
+    // synchronization, and so are approximate.
+    struct
+    {
+        DWORD  startTick;
+        UINT32 resolveWorkerCalls;
+        UINT32 promotions;
+        UINT32 inserts;
+        UINT32 collisions;
+    } m_sample;
+
+    // Number of successful chained lookups before an entry is promoted to the head of its bucket.
+    // Two hot entries sharing a bucket keep displacing each other, and every promotion goes through
+    // the resolve worker, so the interval is raised while promotions remain frequent.
+    size_t m_promotionInterval;
+
     //the following hash computation is also inlined in the resolve stub in asm (SO NO TOUCHIE)
     inline static UINT16 HashMT(UINT16 tokenHash, void* mt)
     {
@@ -26,6 +26,7 @@ static UINT64 s_performanceCounterTicksPerS;
 static double s_nsPerYieldMeasurements[NsPerYieldMeasurementCount];
 static int s_nextMeasurementIndex;
 static double s_establishedNsPerYield = YieldProcessorNormalization::TargetNsPerNormalizedYield;
+static unsigned int s_measureDurationUs;
 
 static unsigned int DetermineMeasureDurationUs()
 {
@@ -60,7 +61,7 @@ static double MeasureNsPerYield(unsigned int measureDurationUs)
     {
         NOTHROW;
         GC_NOTRIGGER;
-        MODE_PREEMPTIVE;
+        MODE_ANY;
     }
     CONTRACTL_END;
 
@@ -129,7 +130,8 @@ void YieldProcessorNormalization::PerformMeasurement()
         }
 
         int nextMeasurementIndex = s_nextMeasurementIndex;
-        latestNsPerYield = MeasureNsPerYield(DetermineMeasureDurationUs());
+        s_measureDurationUs = DetermineMeasureDurationUs();
+        latestNsPerYield = MeasureNsPerYield(s_measureDurationUs);
         AtomicStore(&s_nsPerYieldMeasurements[nextMeasurementIndex], latestNsPerYield);
         if (++nextMeasurementIndex >= NsPerYieldMeasurementCount)
         {
@@ -149,6 +151,7 @@ void YieldProcessorNormalization::PerformMeasurement()
         s_performanceCounterTicksPerS = li.QuadPart;
 
         unsigned int measureDurationUs = DetermineMeasureDurationUs();
+        s_measureDurationUs = measureDurationUs;
         for (int i = 0; i < NsPerYieldMeasurementCount; ++i)
         {
             latestNsPerYield = MeasureNsPerYield(measureDurationUs);
@@ -200,6 +203,12 @@ void YieldProcessorNormalization::PerformMeasurement()
 
     GCHeapUtilities::GetGCHeap()->SetYieldProcessorScalingFactor((float)yieldsPerNormalizedYield);
 
+    // Have each processor measured again the next time a thread spins on it, in case its speed has changed
+    for (unsigned int i = 0; i < MaxNormalizedProcessorCount; ++i)
+    {
+        VolatileStoreWithoutBarrier(&s_normalizationByProcessor[i], (UINT32)0);
+    }
+
     s_previousNormalizationTimeMs = GetTickCount();
     s_normalizationState = NormalizationState::Initialized;
     s_isMeasurementScheduled = false;
@@ -243,6 +252,57 @@ void YieldProcessorNormalization::ScheduleMeasurementIfNecessary()
     FinalizerThread::EnableFinalization();
 }
 
+void YieldProcessorNormalization::GetNormalizationForCurrentProcessor(
+    unsigned int *yieldsPerNormalizedYieldRef,
+    unsigned int *optimalMaxNormalizedYieldsPerSpinIterationRef)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(yieldsPerNormalizedYieldRef != nullptr);
+    _ASSERTE(optimalMaxNormalizedYieldsPerSpinIterationRef != nullptr);
+
+    // Until the process-wide measurement is done, the defaults or the process-wide values are used
+    if (VolatileLoadWithoutBarrier(&s_normalizationState) != NormalizationState::Initialized)
+    {
+        return;
+    }
+
+    DWORD processorNumber = GetCurrentProcessorNumber();
+    if (processorNumber >= MaxNormalizedProcessorCount)
+    {
+        return;
+    }
+
+    UINT32 normalization = VolatileLoadWithoutBarrier(&s_normalizationByProcessor[processorNumber]);
+    if (normalization == 0)
+    {
+        // The thread is about to spin anyway, so measure the processor it's running on. The measurement is only a few
+        // microseconds long. Discard it if the thread was moved to another processor in the meantime.
+        double nsPerYield = MeasureNsPerYield(s_measureDurationUs);
+        if (GetCurrentProcessorNumber() != processorNumber)
+        {
+            return;
+        }
+
+        unsigned int yieldsPerNormalizedYield =
+            Min(MaxYieldsPerNormalizedYield, Max(1u, (unsigned int)(TargetNsPerNormalizedYield / nsPerYield + 0.5)));
+        unsigned int optimalMaxNormalizedYieldsPerSpinIteration =
+            Min(MaxOptimalMaxNormalizedYieldsPerSpinIteration,
+                Max(1u, (unsigned int)(TargetMaxNsPerSpinIteration / (yieldsPerNormalizedYield * nsPerYield) + 0.5)));
+
+        normalization = (optimalMaxNormalizedYieldsPerSpinIteration << 16) | yieldsPerNormalizedYield;
+        VolatileStoreWithoutBarrier(&s_normalizationByProcessor[processorNumber], normalization);
+    }
+
+    *yieldsPerNormalizedYieldRef = normalization & 0xffff;
+    *optimalMaxNormalizedYieldsPerSpinIterationRef = normalization >> 16;
+}
 
 void YieldProcessorNormalization::FireMeasurementEvents()
 {
@@ -201,8 +201,8 @@ type MonoConfig = {
      */
     pthreadPoolUnusedSize?: number;
     /**
-     * If true, a list of the methods optimized by the interpreter will be saved and used for faster startup
-     *  on future runs of the application
+     * If true, a list of the methods optimized by the interpreter and of the jiterpreter traces compiled
+     *  will be saved and used for faster startup on future runs of the application
      */
     interpreterPgo?: boolean;
     /**
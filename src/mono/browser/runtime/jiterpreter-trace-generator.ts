@@ -3748,6 +3748,39 @@ function emit_simd_3 (builder: WasmBuilder, ip: MintOpcodePtr, index: SimdIntrin
                 builder.appendU8(WasmOpcode.i32_eqz);
             append_stloc_tail(builder, getArgU16(ip, 1), WasmOpcode.i32_store);
             return true;
+        case SimdIntrinsic3.V128_I1_EQUALS_ANY:
+        case SimdIntrinsic3.V128_I2_EQUALS_ANY:
+        case SimdIntrinsic3.V128_I4_EQUALS_ANY:
+        case SimdIntrinsic3.V128_I8_EQUALS_ANY: {
+            const eqOpcode = index === SimdIntrinsic3.V128_I1_EQUALS_ANY
+                ? WasmSimdOpcode.i8x16_eq
+                : index === SimdIntrinsic3.V128_I2_EQUALS_ANY
+                    ? WasmSimdOpcode.i16x8_eq
+                    : index === SimdIntrinsic3.V128_I4_EQUALS_ANY
+                        ? WasmSimdOpcode.i32x4_eq
+                        : WasmSimdOpcode.i64x2_eq;
+            append_simd_3_load(builder, ip);
+            builder.appendSimd(eqOpcode);
+            builder.appendSimd(WasmSimdOpcode.v128_any_true);
+            append_stloc_tail(builder, getArgU16(ip, 1), WasmOpcode.i32_store);
+            return true;
+        }
+        case SimdIntrinsic3.V128_I1_MULTIPLY:
+            // There is no i8x16.mul, so multiply into 16-bit lanes and keep the low byte of each product
+            builder.local("pLocals");
+            append_ldloc(builder, getArgU16(ip, 2), WasmOpcode.PREFIX_simd, WasmSimdOpcode.v128_load);
+            builder.local("math_lhs128", WasmOpcode.tee_local);
+            append_ldloc(builder, getArgU16(ip, 3), WasmOpcode.PREFIX_simd, WasmSimdOpcode.v128_load);
+            builder.local("math_rhs128", WasmOpcode.tee_local);
+            builder.appendSimd(WasmSimdOpcode.i16x8_extmul_low_i8x16_u);
+            builder.local("math_lhs128");
+            builder.local("math_rhs128");
+            builder.appendSimd(WasmSimdOpcode.i16x8_extmul_high_i8x16_u);
+            builder.appendSimd(WasmSimdOpcode.i8x16_shuffle);
+            for (let i = 0; i < 16; i++)
+                builder.appendU8(i * 2);
+            append_simd_store(builder, ip);
+            return true;
         case SimdIntrinsic3.V128_R4_FLOAT_EQUALITY:
         case SimdIntrinsic3.V128_R8_FLOAT_EQUALITY: {
             /*
@@ -3802,8 +3835,12 @@ function emit_simd_3 (builder: WasmBuilder, ip: MintOpcodePtr, index: SimdIntrin
         }
         case SimdIntrinsic3.V128_I2_SHUFFLE:
         case SimdIntrinsic3.V128_I4_SHUFFLE:
-            // FIXME: I8
             return emit_shuffle(builder, ip, index === SimdIntrinsic3.V128_I2_SHUFFLE ? 8 : 4);
+        case SimdIntrinsic3.V128_I8_SHUFFLE:
+            // Only constant indices are supported, variable ones fall back to the C implementation
+            if (typeof (get_known_constant_value(builder, getArgU16(ip, 3))) !== "object")
+                return false;
+            return emit_shuffle(builder, ip, 2);
         default:
             return false;
     }
@@ -3817,7 +3854,7 @@ function emit_shuffle (builder: WasmBuilder, ip: MintOpcodePtr, elementCount: nu
     const elementSize = 16 / elementCount,
         indicesOffset = getArgU16(ip, 3),
         constantIndices = get_known_constant_value(builder, indicesOffset);
-    mono_assert((elementSize === 2) || (elementSize === 4), "Unsupported shuffle element size");
+    mono_assert((elementSize === 2) || (elementSize === 4) || ((elementSize === 8) && (typeof (constantIndices) === "object")), "Unsupported shuffle element size");
 
     // Pre-load destination ptr
     builder.local("pLocals");
@@ -3827,13 +3864,17 @@ function emit_shuffle (builder: WasmBuilder, ip: MintOpcodePtr, elementCount: nu
         // HACK: We have a known constant shuffle vector with char or int indices. Expand it to
         //  byte indices and then embed a new constant in the trace.
         const newShuffleVector = new Uint8Array(sizeOfV128),
-            nativeIndices = (elementSize === 2)
-                ? new Uint16Array(constantIndices.buffer, constantIndices.byteOffset, elementCount)
-                : new Uint32Array(constantIndices.buffer, constantIndices.byteOffset, elementCount);
+            indexView = new DataView(constantIndices.buffer, constantIndices.byteOffset, sizeOfV128);
         for (let i = 0, k = 0; i < elementCount; i++, k += elementSize) {
-            const elementIndex = nativeIndices[i];
+            // The high half of a 64-bit index is only relevant for range checking
+            const elementIndex = (elementSize === 2)
+                    ? indexView.getUint16(k, true)
+                    : indexView.getUint32(k, true),
+                inRange = (elementIndex < elementCount) &&
+                    ((elementSize !== 8) || (indexView.getUint32(k + 4, true) === 0));
             for (let j = 0; j < elementSize; j++)
-                newShuffleVector[k + j] = (elementIndex * elementSize) + j;
+                // Out of range byte indices make swizzle produce zero, matching Vector128.Shuffle
+                newShuffleVector[k + j] = inRange ? (elementIndex * elementSize) + j : 0xFF;
         }
         // console.log(`shuffle w/element size ${elementSize} with constant indices ${nativeIndices} (${constantIndices}) -> byte indices ${newShuffleVector}`);
         builder.appendSimd(WasmSimdOpcode.v128_const);
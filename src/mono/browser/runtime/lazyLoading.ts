@@ -5,7 +5,22 @@ import { loaderHelpers } from "./globals";
 import { load_lazy_assembly } from "./managed-exports";
 import { AssetEntry } from "./types";
 
-export async function loadLazyAssembly (assemblyNameToLoad: string): Promise<boolean> {
+// Lazy assemblies which are being downloaded, so that concurrent requests for the same assembly share one download
+const pendingLazyAssemblies = new Map<string, Promise<boolean>>();
+
+export function loadLazyAssembly (assemblyNameToLoad: string): Promise<boolean> {
+    let pending = pendingLazyAssemblies.get(assemblyNameToLoad);
+    if (!pending) {
+        pending = loadLazyAssemblyAsync(assemblyNameToLoad);
+        pendingLazyAssemblies.set(assemblyNameToLoad, pending);
+        pending.finally(() => pendingLazyAssemblies.delete(assemblyNameToLoad)).catch(() => { /* reported to the caller */ });
+        return pending;
+    }
+    // the first request is the one which loads the assembly
+    return pending.then(() => false);
+}
+
+async function loadLazyAssemblyAsync (assemblyNameToLoad: string): Promise<boolean> {
     const resources = loaderHelpers.config.resources!;
     const lazyAssemblies = resources.lazyAssembly;
     if (!lazyAssemblies) {
@@ -7,7 +7,7 @@ import { mono_wasm_new_root, mono_wasm_new_root_buffer } from "./roots";
 import { MonoString, MonoStringNull, WasmRoot, WasmRootBuffer } from "./types/internal";
 import { Module } from "./globals";
 import cwraps from "./cwraps";
-import { isSharedArrayBuffer, localHeapViewU8, getU32_local, setU16_local, localHeapViewU32, getU16_local, localHeapViewU16, _zero_region } from "./memory";
+import { isSharedArrayBuffer, localHeapViewU8, getU32_local, localHeapViewU32, getU16_local, localHeapViewU16, _zero_region } from "./memory";
 import { NativePointer, CharPtr, VoidPtr } from "./types/emscripten";
 
 export const interned_js_string_table = new Map<string, MonoString>();
@@ -82,10 +82,17 @@ export function utf8BufferToString (heapOrArray: Uint8Array, idx: number, maxByt
     return _text_decoder_utf8_validating.decode(view);
 }
 
+// Below this many UTF-16 code units, String.fromCharCode on a view of the heap is faster than
+// calling into TextDecoder and it never needs to copy the SharedArrayBuffer first.
+const utf16_short_string_length = 32;
+
 export function utf16ToString (startPtr: number, endPtr: number): string {
-    if (_text_decoder_utf16) {
+    if (_text_decoder_utf16 && (endPtr - startPtr) > utf16_short_string_length * 2) {
         const subArray = viewOrCopy(localHeapViewU8(), startPtr as any, endPtr as any);
         return _text_decoder_utf16.decode(subArray);
+    } else if (endPtr - startPtr <= utf16_short_string_length * 2) {
+        const heapU16 = localHeapViewU16();
+        return String.fromCharCode.apply(null, <any>heapU16.subarray(startPtr >>> 1, endPtr >>> 1));
     } else {
         return utf16ToStringLoop(startPtr, endPtr);
     }
@@ -102,12 +109,12 @@ export function utf16ToStringLoop (startPtr: number, endPtr: number): string {
 }
 
 export function stringToUTF16 (dstPtr: number, endPtr: number, text: string) {
-    const heapI16 = localHeapViewU16();
-    const len = text.length;
+    const heapU16 = localHeapViewU16();
+    // charCodeAt always returns a valid UTF-16 code unit, so there is no need to range check each one
+    const len = Math.min(text.length, (endPtr - dstPtr) >> 1);
+    const dstIndex = dstPtr >>> 1;
     for (let i = 0; i < len; i++) {
-        setU16_local(heapI16, dstPtr, text.charCodeAt(i));
-        dstPtr += 2;
-        if (dstPtr >= endPtr) break;
+        heapU16[dstIndex + i] = text.charCodeAt(i);
     }
 }
 
@@ -5,6 +5,7 @@
 #include <eventpipe/ep-types.h>
 #include <eventpipe/ep-rt.h>
 #include <eventpipe/ep.h>
+#include <eventpipe/ep-sample-profiler.h>
 
 #include <eglib/gmodule.h>
 #include <mono/metadata/profiler.h>
@@ -1284,8 +1285,11 @@ ep_rt_mono_sample_profiler_write_sampling_event_for_threads (
 	// Since we can't keep thread info around after runtime as been suspended, use an empty
 	// adapter instance and only set recorded tid as parameter inside adapter.
 	THREAD_INFO_TYPE adapter = { { 0 } };
+	bool running_threads_only = ep_sample_profiler_get_sample_running_threads_only ();
 	for (uint32_t thread_count = 0; thread_count < sampled_thread_count; ++thread_count) {
 		SampleProfileStackWalkData *data = &g_array_index (_sampled_thread_callstacks, SampleProfileStackWalkData, thread_count);
+		if (running_threads_only && data->payload_data != EP_SAMPLE_PROFILER_SAMPLE_TYPE_MANAGED)
+			continue;
 		if ((data->stack_walk_data.top_frame && data->payload_data == EP_SAMPLE_PROFILER_SAMPLE_TYPE_EXTERNAL) || (data->payload_data != EP_SAMPLE_PROFILER_SAMPLE_TYPE_ERROR && ep_stack_contents_get_length (&data->stack_contents) > 0)) {
 			// Check if we have an async frame, if so we will need to make sure all frames are registered in regular jit info table.
 			// TODO: An async frame can contain wrapper methods (no way to check during stackwalk), we could skip writing profile event
@@ -598,6 +598,32 @@ ep_rt_config_value_get_output_streaming (void)
 	return enable;
 }
 
+static
+inline
+ep_char8_t *
+ep_rt_config_value_get_startup_session_config (void)
+{
+	gchar *value = g_getenv ("DOTNET_EventPipeStartupSession");
+	if (!value)
+		value = g_getenv ("COMPlus_EventPipeStartupSession");
+	return (ep_char8_t *)value;
+}
+
+static
+inline
+uint32_t
+ep_rt_config_value_get_startup_session_mb (void)
+{
+	uint32_t startup_mb = 0;
+	gchar *value = g_getenv ("DOTNET_EventPipeStartupSessionMB");
+	if (!value)
+		value = g_getenv ("COMPlus_EventPipeStartupSessionMB");
+	if (value)
+		startup_mb = strtoul (value, NULL, 10);
+	g_free (value);
+	return startup_mb;
+}
+
 static
 inline
 uint32_t
@@ -628,6 +654,21 @@ ep_rt_config_value_get_enable_stackwalk (void)
 	return value_uint32_t != 0;
 }
 
+static
+inline
+bool
+ep_rt_config_value_get_sample_running_threads_only (void)
+{
+	bool enable = false;
+	gchar *value = g_getenv ("DOTNET_EventPipeSampleRunningThreadsOnly");
+	if (!value)
+		value = g_getenv ("COMPlus_EventPipeSampleRunningThreadsOnly");
+	if (value && atoi (value) == 1)
+		enable = true;
+	g_free (value);
+	return enable;
+}
+
 /*
  * EventPipeSampleProfiler.
  */
@@ -830,6 +871,14 @@ ep_rt_execute_rundown (dn_vector_ptr_t *execution_checkpoints)
 	}
 }
 
+static
+inline
+bool
+ep_rt_enable_method_load_log (void)
+{
+	return false;
+}
+
 /*
  * Objects.
  */
@@ -175,6 +175,131 @@ write_events (
 	return result;
 }
 
+#define ORDERING_TEST_THREAD_COUNT 4
+#define ORDERING_TEST_EVENTS_PER_THREAD 8
+#define ORDERING_TEST_EVENT_MAGIC 0x51A7C0DE
+#define ORDERING_TEST_FIRST_PASS_STEPS ORDERING_TEST_THREAD_COUNT
+#define ORDERING_TEST_TOTAL_STEPS (ORDERING_TEST_FIRST_PASS_STEPS + ORDERING_TEST_THREAD_COUNT * ORDERING_TEST_EVENTS_PER_THREAD)
+
+typedef struct _MemoryStreamWriter {
+	StreamWriter stream_writer;
+	uint8_t buffer [64 * 1024];
+	uint32_t size;
+} MemoryStreamWriter;
+
+static
+void
+memory_stream_writer_free_func (void *stream)
+{
+	g_free ((MemoryStreamWriter *)stream);
+}
+
+static
+bool
+memory_stream_writer_write_func (
+	void *stream,
+	const uint8_t *buffer,
+	uint32_t bytes_to_write,
+	uint32_t *bytes_written)
+{
+	*bytes_written = 0;
+
+	MemoryStreamWriter *memory_stream = (MemoryStreamWriter *)stream;
+	if (!stream || bytes_to_write > sizeof (memory_stream->buffer) - memory_stream->size)
+		return false;
+
+	memcpy (memory_stream->buffer + memory_stream->size, buffer, bytes_to_write);
+	memory_stream->size += bytes_to_write;
+	*bytes_written = bytes_to_write;
+
+	return true;
+}
+
+static StreamWriterVtable memory_stream_writer_vtable = {
+	memory_stream_writer_free_func,
+	memory_stream_writer_write_func };
+
+// Shared by the writer threads of test_buffer_manager_write_ordering_to_file_v4. Every event is
+// written in its own step and each step belongs to one thread, so the event timestamps follow the
+// step numbers.
+typedef struct _OrderingTestState {
+	EventPipeBufferManager *buffer_manager;
+	EventPipeSession *session;
+	EventPipeEvent *ep_event;
+	volatile uint32_t current_step;
+	volatile uint32_t step_limit;
+	volatile uint32_t threads_done;
+	volatile uint32_t failed;
+	volatile uint32_t stop;
+} OrderingTestState;
+
+typedef struct _OrderingTestThreadParams {
+	OrderingTestState *state;
+	uint32_t thread_index;
+} OrderingTestThreadParams;
+
+// Returns the thread that writes the event of a step. The first pass writes one event per thread in thread
+// order, so the threads' buffer lists are created in that order. The second pass interleaves the
+// threads and starts them in a different order, so the oldest event of each thread no longer
+// follows the order of the buffer lists.
+static
+uint32_t
+ordering_test_step_owner (uint32_t step)
+{
+	static const uint32_t second_pass_owners [ORDERING_TEST_THREAD_COUNT] = { 2, 0, 3, 1 };
+	if (step < ORDERING_TEST_FIRST_PASS_STEPS)
+		return step;
+	return second_pass_owners [(step - ORDERING_TEST_FIRST_PASS_STEPS) % ORDERING_TEST_THREAD_COUNT];
+}
+
+static
+void
+ordering_test_wait_for (
+	const volatile uint32_t *value,
+	uint32_t expected)
+{
+	while (ep_rt_volatile_load_uint32_t (value) != expected)
+		ep_rt_thread_sleep (100 * 1000);
+}
+
+EP_RT_DEFINE_THREAD_FUNC (ordering_test_writer_thread)
+{
+	ep_rt_thread_params_t *thread_params = (ep_rt_thread_params_t *)data;
+	OrderingTestThreadParams *params = (OrderingTestThreadParams *)thread_params->thread_params;
+	OrderingTestState *state = params->state;
+
+	ep_rt_thread_handle_t thread_handle = ep_rt_thread_get_handle ();
+	bool can_write = ep_thread_get_or_create () != NULL;
+	if (!can_write)
+		ep_rt_volatile_store_uint32_t (&state->failed, 1);
+
+	for (uint32_t step = 0; step < ORDERING_TEST_TOTAL_STEPS; ++step) {
+		if (ordering_test_step_owner (step) != params->thread_index)
+			continue;
+
+		while (ep_rt_volatile_load_uint32_t (&state->current_step) != step || step >= ep_rt_volatile_load_uint32_t (&state->step_limit)) {
+			if (ep_rt_volatile_load_uint32_t (&state->stop))
+				break;
+			ep_rt_thread_sleep (100 * 1000);
+		}
+
+		if (ep_rt_volatile_load_uint32_t (&state->stop))
+			break;
+
+		uint32_t data [3] = { ORDERING_TEST_EVENT_MAGIC, params->thread_index, step };
+		EventPipeEventPayload payload;
+		ep_event_payload_init (&payload, (uint8_t *)data, sizeof (data));
+		if (can_write && !ep_buffer_manager_write_event (state->buffer_manager, thread_handle, state->session, state->ep_event, &payload, NULL, NULL, thread_handle, NULL))
+			ep_rt_volatile_store_uint32_t (&state->failed, 1);
+		ep_event_payload_fini (&payload);
+
+		ep_rt_volatile_store_uint32_t (&state->current_step, step + 1);
+	}
+
+	ep_rt_atomic_inc_uint32_t (&state->threads_done);
+	return (ep_rt_thread_start_func_return_t)0;
+}
+
 static RESULT
 test_buffer_manager_setup (void)
 {
@@ -447,6 +572,123 @@ test_buffer_manager_write_events_to_file_v4 (void)
 	return test_buffer_manager_write_events_to_file (EP_SERIALIZATION_FORMAT_NETTRACE_V4);
 }
 
+static RESULT
+test_buffer_manager_write_ordering_to_file_v4 (void)
+{
+	RESULT result = NULL;
+	uint32_t test_location = 0;
+	EventPipeBufferManager *buffer_manager = NULL;
+	ep_rt_thread_handle_t thread_handle;
+	EventPipeThread *thread = NULL;
+	EventPipeSession *session = NULL;
+	EventPipeProvider *provider = NULL;
+	EventPipeEvent *ep_event = NULL;
+	MemoryStreamWriter *stream_writer = NULL;
+	EventPipeFile *file = NULL;
+	bool events_written = false;
+	uint32_t threads_started = 0;
+
+	OrderingTestState state;
+	OrderingTestThreadParams thread_params [ORDERING_TEST_THREAD_COUNT];
+	uint32_t expected_steps [ORDERING_TEST_TOTAL_STEPS];
+	uint32_t expected_count = 0;
+	uint32_t found_count = 0;
+
+	memset (&state, 0, sizeof (state));
+
+	result = buffer_manager_init (EP_SERIALIZATION_FORMAT_NETTRACE_V4, &buffer_manager, &thread_handle, &thread, &session, &provider, &ep_event);
+
+	ep_raise_error_if_nok (result == NULL);
+
+	test_location = 1;
+
+	stream_writer = g_new0 (MemoryStreamWriter, 1);
+	ep_raise_error_if_nok (stream_writer != NULL);
+
+	ep_stream_writer_init (&stream_writer->stream_writer, &memory_stream_writer_vtable);
+	file = ep_file_alloc ((StreamWriter *)stream_writer, EP_SERIALIZATION_FORMAT_NETTRACE_V4);
+	ep_raise_error_if_nok (file != NULL);
+
+	// file owns the stream writer from here on.
+	ep_raise_error_if_nok (ep_file_initialize_file (file) == true);
+
+	test_location = 2;
+
+	state.buffer_manager = buffer_manager;
+	state.session = session;
+	state.ep_event = ep_event;
+	state.step_limit = ORDERING_TEST_FIRST_PASS_STEPS;
+
+	for (; threads_started < ORDERING_TEST_THREAD_COUNT; ++threads_started) {
+		ep_rt_thread_id_t thread_id = ep_rt_uint64_t_to_thread_id_t (0);
+		thread_params [threads_started].state = &state;
+		thread_params [threads_started].thread_index = threads_started;
+		ep_raise_error_if_nok (ep_rt_thread_create ((void *)ordering_test_writer_thread, (void *)&thread_params [threads_started], EP_THREAD_TYPE_SESSION, &thread_id) == true);
+	}
+
+	test_location = 3;
+
+	// First pass, read while all writer threads are still alive.
+	ordering_test_wait_for (&state.current_step, ORDERING_TEST_FIRST_PASS_STEPS);
+	ep_buffer_manager_write_all_buffers_to_file (buffer_manager, file, ep_perf_timestamp_get (), &events_written);
+	ep_raise_error_if_nok (events_written == true);
+
+	test_location = 4;
+
+	// Second pass, with the threads' oldest events in a different order than their buffer lists.
+	ep_rt_volatile_store_uint32_t (&state.step_limit, ORDERING_TEST_TOTAL_STEPS);
+	ordering_test_wait_for (&state.threads_done, ORDERING_TEST_THREAD_COUNT);
+	ep_raise_error_if_nok (ep_rt_volatile_load_uint32_t (&state.failed) == 0);
+
+	events_written = false;
+	ep_buffer_manager_write_all_buffers_to_file (buffer_manager, file, ep_perf_timestamp_get (), &events_written);
+	ep_raise_error_if_nok (events_written == true);
+
+	ep_file_flush (file, EP_FILE_FLUSH_FLAGS_ALL_BLOCKS);
+
+	test_location = 5;
+
+	// Each pass writes the threads in the order of their oldest event, and all events of a thread
+	// before moving on to the next one.
+	for (uint32_t step = 0; step < ORDERING_TEST_FIRST_PASS_STEPS; ++step)
+		expected_steps [expected_count++] = step;
+	for (uint32_t first_step = ORDERING_TEST_FIRST_PASS_STEPS; first_step < ORDERING_TEST_FIRST_PASS_STEPS + ORDERING_TEST_THREAD_COUNT; ++first_step)
+		for (uint32_t step = first_step; step < ORDERING_TEST_TOTAL_STEPS; step += ORDERING_TEST_THREAD_COUNT)
+			expected_steps [expected_count++] = step;
+
+	for (uint32_t offset = 0; offset + sizeof (uint32_t) * 3 <= stream_writer->size; ++offset) {
+		uint32_t data [3];
+		memcpy (data, stream_writer->buffer + offset, sizeof (data));
+		if (data [0] != ORDERING_TEST_EVENT_MAGIC)
+			continue;
+
+		if (found_count >= expected_count || data [2] != expected_steps [found_count] || data [1] != ordering_test_step_owner (data [2])) {
+			result = FAILED ("Event %i in the file is step %i of thread %i, expected step %i", found_count, data [2], data [1], found_count < expected_count ? expected_steps [found_count] : -1);
+			ep_raise_error ();
+		}
+		found_count++;
+	}
+
+	test_location = 6;
+
+	ep_raise_error_if_nok (found_count == expected_count);
+
+ep_on_exit:
+	// Writer threads still waiting for their turn after a failure must be gone before the session is freed.
+	ep_rt_volatile_store_uint32_t (&state.stop, 1);
+	ordering_test_wait_for (&state.threads_done, threads_started);
+	ep_file_free (file);
+	buffer_manager_fini (buffer_manager, thread, session, provider, ep_event);
+	return result;
+
+ep_on_error:
+	if (!file)
+		g_free (stream_writer);
+	if (!result)
+		result = FAILED ("Failed at test location=%i", test_location);
+	ep_exit_error_handler ();
+}
+
 static RESULT
 test_buffer_manager_oom (void)
 {
@@ -606,6 +848,7 @@ static Test ep_buffer_manager_tests [] = {
 	{"test_buffer_manager_deallocate_buffers", test_buffer_manager_deallocate_buffers},
 	{"test_buffer_manager_write_events_to_file_v3", test_buffer_manager_write_events_to_file_v3},
 	{"test_buffer_manager_write_events_to_file_v4", test_buffer_manager_write_events_to_file_v4},
+	{"test_buffer_manager_write_ordering_to_file_v4", test_buffer_manager_write_ordering_to_file_v4},
 	{"test_buffer_manager_oom", test_buffer_manager_oom},
 #ifdef TEST_PERF
 	{"test_buffer_manager_perf", test_buffer_manager_perf},
@@ -0,0 +1,376 @@
+#if defined(_MSC_VER) && defined(_DEBUG)
+#include "ep-tests-debug.h"
+#endif
+
+#include <eventpipe/ep.h>
+#include <eventpipe/ep-event.h>
+#include <eventpipe/ep-event-filter.h>
+#include <eventpipe/ep-event-payload.h>
+#include <eventpipe/ep-provider.h>
+#include <eglib/test/test.h>
+
+#define TEST_PROVIDER_NAME "MyTestProvider"
+
+#ifdef _CRTDBG_MAP_ALLOC
+static _CrtMemState eventpipe_memory_start_snapshot;
+static _CrtMemState eventpipe_memory_end_snapshot;
+static _CrtMemState eventpipe_memory_diff_snapshot;
+#endif
+
+static EventPipeProvider *test_provider = NULL;
+static EventPipeEvent *test_event_1 = NULL;
+static EventPipeEvent *test_event_2 = NULL;
+
+// Writes a UTF-16LE string, including its terminator, at dst.
+static
+uint32_t
+write_utf16_string (uint8_t *dst, const char *text)
+{
+	uint32_t offset = 0;
+	do {
+		dst [offset++] = (uint8_t)*text;
+		dst [offset++] = 0;
+	} while (*text++ != '\0');
+
+	return offset;
+}
+
+static
+bool
+is_event_allowed (
+	const char *config,
+	EventPipeEvent *ep_event,
+	EventPipeEventPayload *payload)
+{
+	EventPipeEventFilter *filter = ep_event_filter_alloc (config);
+	if (!filter)
+		return false;
+
+	bool result = ep_event_filter_is_event_allowed (filter, ep_event, payload);
+	ep_event_filter_free (filter);
+	return result;
+}
+
+static RESULT
+test_event_filter_setup (void)
+{
+	RESULT result = NULL;
+	uint32_t test_location = 0;
+
+#ifdef _CRTDBG_MAP_ALLOC
+	_CrtMemCheckpoint (&eventpipe_memory_start_snapshot);
+#endif
+
+	test_provider = ep_create_provider (TEST_PROVIDER_NAME, NULL, NULL);
+	ep_raise_error_if_nok (test_provider != NULL);
+
+	test_location = 1;
+
+	test_event_1 = ep_provider_add_event (test_provider, 1, 1, 1, EP_EVENT_LEVEL_LOGALWAYS, false, NULL, 0);
+	ep_raise_error_if_nok (test_event_1 != NULL);
+
+	test_location = 2;
+
+	test_event_2 = ep_provider_add_event (test_provider, 2, 1, 1, EP_EVENT_LEVEL_LOGALWAYS, false, NULL, 0);
+	ep_raise_error_if_nok (test_event_2 != NULL);
+
+ep_on_exit:
+	return result;
+
+ep_on_error:
+	if (!result)
+		result = FAILED ("Failed at test location=%i", test_location);
+	ep_exit_error_handler ();
+}
+
+static RESULT
+test_event_filter_parse_valid (void)
+{
+	static const char *valid_configs [] = {
+		TEST_PROVIDER_NAME ":1:0:1:0",
+		TEST_PROVIDER_NAME ":1:0:2:0:10",
+		TEST_PROVIDER_NAME ":1:4:4:10:20",
+		TEST_PROVIDER_NAME ":1:8:8:0x10:0xffffffffffffffff",
+		TEST_PROVIDER_NAME ":1:0:d:1.5",
+		TEST_PROVIDER_NAME ":1:0:d:-1:1e9",
+		TEST_PROVIDER_NAME ":1:0:s:MyApp.Type",
+		TEST_PROVIDER_NAME ":1:2:p:MyApp.",
+		TEST_PROVIDER_NAME ":1:0:4:10,Other-Provider:2:0:s:text",
+		"Microsoft-Windows-DotNETRuntime:91:3:d:1000000",
+	};
+
+	for (uint32_t i = 0; i < ARRAY_SIZE (valid_configs); ++i) {
+		EventPipeEventFilter *filter = ep_event_filter_alloc (valid_configs [i]);
+		if (!filter)
+			return FAILED ("Failed to parse '%s'", valid_configs [i]);
+		ep_event_filter_free (filter);
+	}
+
+	return NULL;
+}
+
+static RESULT
+test_event_filter_parse_invalid (void)
+{
+	static const char *invalid_configs [] = {
+		"",
+		TEST_PROVIDER_NAME,
+		TEST_PROVIDER_NAME ":1",
+		TEST_PROVIDER_NAME ":1:0",
+		TEST_PROVIDER_NAME ":1:0:4",
+		TEST_PROVIDER_NAME ":x:0:4:1",
+		TEST_PROVIDER_NAME ":1:-:4:1",
+		TEST_PROVIDER_NAME ":1:0:3:1",
+		TEST_PROVIDER_NAME ":1:0:4:1x",
+		TEST_PROVIDER_NAME ":1:0:4:20:10",
+		TEST_PROVIDER_NAME ":1:0:4:1:2:3",
+		TEST_PROVIDER_NAME ":4294967296:0:4:1",
+		TEST_PROVIDER_NAME ":1:0:d:2.0:1.0",
+		TEST_PROVIDER_NAME ":1:0:d:abc",
+		TEST_PROVIDER_NAME ":1:0:s:",
+		TEST_PROVIDER_NAME ":1:0:p:a:b",
+		":1:0:4:1",
+		"," TEST_PROVIDER_NAME ":1:0:4:1",
+		TEST_PROVIDER_NAME ":1:0:4:1,,",
+	};
+
+	if (ep_event_filter_alloc (NULL))
+		return FAILED ("Parsed a NULL config");
+
+	for (uint32_t i = 0; i < ARRAY_SIZE (invalid_configs); ++i) {
+		EventPipeEventFilter *filter = ep_event_filter_alloc (invalid_configs [i]);
+		if (filter) {
+			ep_event_filter_free (filter);
+			return FAILED ("Parsed invalid config '%s'", invalid_configs [i]);
+		}
+	}
+
+	return NULL;
+}
+
+static RESULT
+test_event_filter_match_unsigned (void)
+{
+	RESULT result = NULL;
+	uint32_t test_location = 0;
+
+	uint8_t data [16] = { 0 };
+	uint32_t value = 15;
+	memcpy (data + 4, &value, sizeof (value));
+	data [9] = 0x80;
+
+	EventPipeEventPayload payload;
+	ep_event_payload_init (&payload, data, sizeof (data));
+
+	ep_raise_error_if_nok (is_event_allowed (TEST_PROVIDER_NAME ":1:4:4:10:20", test_event_1, &payload));
+
+	test_location = 1;
+
+	ep_raise_error_if_nok (is_event_allowed (TEST_PROVIDER_NAME ":1:4:4:15:15", test_event_1, &payload));
+	ep_raise_error_if_nok (is_event_allowed (TEST_PROVIDER_NAME ":1:4:4:15", test_event_1, &payload));
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:4:4:16:20", test_event_1, &payload));
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:4:4:0:14", test_event_1, &payload));
+
+	test_location = 2;
+
+	// Field sizes, the values are read little endian
+	ep_raise_error_if_nok (is_event_allowed (TEST_PROVIDER_NAME ":1:4:1:15:15", test_event_1, &payload));
+	ep_raise_error_if_nok (is_event_allowed (TEST_PROVIDER_NAME ":1:8:2:0x8000:0x8000", test_event_1, &payload));
+	ep_raise_error_if_nok (is_event_allowed (TEST_PROVIDER_NAME ":1:4:8:0x80000000000f:0x80000000000f", test_event_1, &payload));
+
+	test_location = 3;
+
+	// Fields that don't fit in the payload never match
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:12:8:0", test_event_1, &payload));
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:16:1:0", test_event_1, &payload));
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:4294967295:4:0", test_event_1, &payload));
+
+	test_location = 4;
+
+	// Provider names are compared ignoring case, events of other providers or ids aren't affected
+	ep_raise_error_if_nok (!is_event_allowed ("mytestprovider:1:4:4:16", test_event_1, &payload));
+	ep_raise_error_if_nok (is_event_allowed ("Other-Provider:1:4:4:16", test_event_1, &payload));
+	ep_raise_error_if_nok (is_event_allowed (TEST_PROVIDER_NAME ":1:4:4:16", test_event_2, &payload));
+
+	test_location = 5;
+
+	// An event is kept if any of its predicates holds
+	ep_raise_error_if_nok (is_event_allowed (TEST_PROVIDER_NAME ":1:4:4:16," TEST_PROVIDER_NAME ":1:4:4:0:15", test_event_1, &payload));
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:4:4:16," TEST_PROVIDER_NAME ":1:4:4:0:14", test_event_1, &payload));
+
+	test_location = 6;
+
+	// Events without a payload never match
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:0:1:0", test_event_1, NULL));
+	ep_raise_error_if_nok (is_event_allowed (TEST_PROVIDER_NAME ":1:0:1:0", test_event_2, NULL));
+
+ep_on_exit:
+	ep_event_payload_fini (&payload);
+	return result;
+
+ep_on_error:
+	if (!result)
+		result = FAILED ("Failed at test location=%i", test_location);
+	ep_exit_error_handler ();
+}
+
+static RESULT
+test_event_filter_match_double (void)
+{
+	RESULT result = NULL;
+	uint32_t test_location = 0;
+
+	// Not aligned on purpose
+	uint8_t data [11] = { 0 };
+	double value = 1500000.5;
+	memcpy (data + 3, &value, sizeof (value));
+
+	EventPipeEventPayload payload;
+	ep_event_payload_init (&payload, data, sizeof (data));
+
+	ep_raise_error_if_nok (is_event_allowed (TEST_PROVIDER_NAME ":1:3:d:1000000", test_event_1, &payload));
+	ep_raise_error_if_nok (is_event_allowed (TEST_PROVIDER_NAME ":1:3:d:1500000.5:1500000.5", test_event_1, &payload));
+
+	test_location = 1;
+
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:3:d:2000000", test_event_1, &payload));
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:3:d:0:1500000", test_event_1, &payload));
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:4:d:0", test_event_1, &payload));
+
+ep_on_exit:
+	ep_event_payload_fini (&payload);
+	return result;
+
+ep_on_error:
+	if (!result)
+		result = FAILED ("Failed at test location=%i", test_location);
+	ep_exit_error_handler ();
+}
+
+static RESULT
+test_event_filter_match_text (void)
+{
+	RESULT result = NULL;
+	uint32_t test_location = 0;
+
+	// An 8 byte id followed by an unaligned string and another field
+	uint8_t data [64] = { 0 };
+	uint32_t size = 9;
+	size += write_utf16_string (data + size, "MyApp.Type");
+	size += 4;
+
+	EventPipeEventPayload payload;
+	ep_event_payload_init (&payload, data, size);
+
+	ep_raise_error_if_nok (is_event_allowed (TEST_PROVIDER_NAME ":1:9:s:MyApp.Type", test_event_1, &payload));
+	ep_raise_error_if_nok (is_event_allowed (TEST_PROVIDER_NAME ":1:9:p:MyApp.", test_event_1, &payload));
+	ep_raise_error_if_nok (is_event_allowed (TEST_PROVIDER_NAME ":1:9:p:MyApp.Type", test_event_1, &payload));
+
+	test_location = 1;
+
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:9:s:MyApp.", test_event_1, &payload));
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:9:s:MyApp.Type2", test_event_1, &payload));
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:9:p:MyApp.Type2", test_event_1, &payload));
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:9:s:myapp.type", test_event_1, &payload));
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:11:p:MyApp.", test_event_1, &payload));
+
+	test_location = 2;
+
+	ep_event_payload_fini (&payload);
+
+	// A string cut off by the end of the payload only matches a shorter prefix
+	ep_event_payload_init (&payload, data, 9 + 2 * 5);
+	ep_raise_error_if_nok (is_event_allowed (TEST_PROVIDER_NAME ":1:9:p:MyAp", test_event_1, &payload));
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:9:p:MyApp", test_event_1, &payload));
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:9:p:MyApp.", test_event_1, &payload));
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:9:s:MyApp", test_event_1, &payload));
+
+ep_on_exit:
+	ep_event_payload_fini (&payload);
+	return result;
+
+ep_on_error:
+	if (!result)
+		result = FAILED ("Failed at test location=%i", test_location);
+	ep_exit_error_handler ();
+}
+
+static RESULT
+test_event_filter_match_event_data (void)
+{
+	RESULT result = NULL;
+	uint32_t test_location = 0;
+
+	// The same fields as a flat payload, split over EventData pieces so that they straddle
+	// piece boundaries.
+	uint8_t flat [64] = { 0 };
+	uint32_t value = 0x01020304;
+	memcpy (flat + 2, &value, sizeof (value));
+	uint32_t size = 6;
+	size += write_utf16_string (flat + size, "MyApp.Type");
+
+	EventData event_data [4];
+	ep_event_data_init (&event_data [0], (uint64_t)(uintptr_t)flat, 3, 0);
+	ep_event_data_init (&event_data [1], (uint64_t)(uintptr_t)(flat + 3), 0, 0);
+	ep_event_data_init (&event_data [2], (uint64_t)(uintptr_t)(flat + 3), 6, 0);
+	ep_event_data_init (&event_data [3], (uint64_t)(uintptr_t)(flat + 9), size - 9, 0);
+
+	EventPipeEventPayload payload;
+	ep_event_payload_init_2 (&payload, event_data, ARRAY_SIZE (event_data));
+	ep_raise_error_if_nok (ep_event_payload_get_size (&payload) == size);
+
+	test_location = 1;
+
+	ep_raise_error_if_nok (is_event_allowed (TEST_PROVIDER_NAME ":1:2:4:0x01020304:0x01020304", test_event_1, &payload));
+	ep_raise_error_if_nok (is_event_allowed (TEST_PROVIDER_NAME ":1:6:s:MyApp.Type", test_event_1, &payload));
+	ep_raise_error_if_nok (is_event_allowed (TEST_PROVIDER_NAME ":1:6:p:MyApp", test_event_1, &payload));
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:2:4:0x01020305", test_event_1, &payload));
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:6:s:MyApp", test_event_1, &payload));
+	ep_raise_error_if_nok (!is_event_allowed (TEST_PROVIDER_NAME ":1:30:8:0", test_event_1, &payload));
+
+	test_location = 2;
+
+	// Predicates read the pieces in place, the payload is only flattened if the event is kept
+	ep_raise_error_if_nok (!ep_event_payload_is_flattened (&payload));
+
+ep_on_exit:
+	ep_event_payload_fini (&payload);
+	return result;
+
+ep_on_error:
+	if (!result)
+		result = FAILED ("Failed at test location=%i", test_location);
+	ep_exit_error_handler ();
+}
+
+static RESULT
+test_event_filter_teardown (void)
+{
+	ep_delete_provider (test_provider);
+	test_provider = NULL;
+	test_event_1 = NULL;
+	test_event_2 = NULL;
+
+#ifdef _CRTDBG_MAP_ALLOC
+	_CrtMemCheckpoint (&eventpipe_memory_end_snapshot);
+	if ( _CrtMemDifference( &eventpipe_memory_diff_snapshot, &eventpipe_memory_start_snapshot, &eventpipe_memory_end_snapshot) ) {
+		_CrtMemDumpStatistics( &eventpipe_memory_diff_snapshot );
+		return FAILED ("Memory leak detected!");
+	}
+#endif
+	return NULL;
+}
+
+static Test ep_event_filter_tests [] = {
+	{"test_event_filter_setup", test_event_filter_setup},
+	{"test_event_filter_parse_valid", test_event_filter_parse_valid},
+	{"test_event_filter_parse_invalid", test_event_filter_parse_invalid},
+	{"test_event_filter_match_unsigned", test_event_filter_match_unsigned},
+	{"test_event_filter_match_double", test_event_filter_match_double},
+	{"test_event_filter_match_text", test_event_filter_match_text},
+	{"test_event_filter_match_event_data", test_event_filter_match_event_data},
+	{"test_event_filter_teardown", test_event_filter_teardown},
+	{NULL, NULL}
+};
+
+DEFINE_TEST_GROUP_INIT(ep_event_filter_tests_init, ep_event_filter_tests)
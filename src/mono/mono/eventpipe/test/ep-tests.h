@@ -18,6 +18,7 @@ DEFINE_TEST_GROUP_INIT_H(ep_fastserializer_tests_init);
 DEFINE_TEST_GROUP_INIT_H(ep_provider_callback_data_queue_tests_init);
 DEFINE_TEST_GROUP_INIT_H(ep_file_tests_init);
 DEFINE_TEST_GROUP_INIT_H(ep_session_tests_init);
+DEFINE_TEST_GROUP_INIT_H(ep_event_filter_tests_init);
 DEFINE_TEST_GROUP_INIT_H(ep_thread_tests_init);
 DEFINE_TEST_GROUP_INIT_H(ep_buffer_tests_init);
 DEFINE_TEST_GROUP_INIT_H(ep_buffer_manager_tests_init);
@@ -39,6 +40,7 @@ static Group test_groups [] = {
 	{"provider-callback-dataqueue", ep_provider_callback_data_queue_tests_init},
 	{"file", ep_file_tests_init},
 	{"session", ep_session_tests_init},
+	{"event-filter", ep_event_filter_tests_init},
 	{"thread", ep_thread_tests_init},
 	{"buffer", ep_buffer_tests_init},
 	{"buffer-manager", ep_buffer_manager_tests_init},
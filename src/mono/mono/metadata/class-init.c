@@ -1062,6 +1062,40 @@ class_kind_may_contain_generic_instances (MonoTypeKind kind)
 	return (kind == MONO_CLASS_GINST || kind == MONO_CLASS_ARRAY || kind == MONO_CLASS_POINTER);
 }
 
+/*
+ * get_szarray_cache:
+ *
+ *   Return the szarray cache of MM, or of IMAGE if MM is NULL, creating it if needed.
+ * Lookups are lock-free, inserts need to hold the lock of the owner of the cache.
+ */
+static MonoConcurrentHashTable*
+get_szarray_cache (MonoImage *image, MonoMemoryManager *mm)
+{
+	if (mm) {
+		if (!mm->szarray_cache) {
+			mono_mem_manager_lock (mm);
+			if (!mm->szarray_cache) {
+				MonoConcurrentHashTable *cache = mono_conc_hashtable_new (mono_aligned_addr_hash, NULL);
+				mono_memory_barrier ();
+				mm->szarray_cache = cache;
+			}
+			mono_mem_manager_unlock (mm);
+		}
+		return mm->szarray_cache;
+	} else {
+		if (!image->szarray_cache) {
+			mono_os_mutex_lock (&image->szarray_cache_lock);
+			if (!image->szarray_cache) {
+				MonoConcurrentHashTable *cache = mono_conc_hashtable_new (mono_aligned_addr_hash, NULL);
+				mono_memory_barrier ();
+				image->szarray_cache = cache;
+			}
+			mono_os_mutex_unlock (&image->szarray_cache_lock);
+		}
+		return image->szarray_cache;
+	}
+}
+
 /**
  * mono_class_create_bounded_array:
  * \param element_class element class
@@ -1092,24 +1126,12 @@ mono_class_create_bounded_array (MonoClass *eclass, guint32 rank, gboolean bound
 	/* Check cache */
 	cached = NULL;
 	if (rank == 1 && !bounded) {
-		if (mm) {
-			mono_mem_manager_lock (mm);
-			if (!mm->szarray_cache)
-				mm->szarray_cache = g_hash_table_new_full (mono_aligned_addr_hash, NULL, NULL, NULL);
-			cached = (MonoClass *)g_hash_table_lookup (mm->szarray_cache, eclass);
-			mono_mem_manager_unlock (mm);
-		} else {
-			/*
-			 * This case is very frequent not just during compilation because of calls
-			 * from mono_class_from_mono_type_internal (), mono_array_new (),
-			 * Array:CreateInstance (), etc, so use a separate cache + a separate lock.
-			 */
-			mono_os_mutex_lock (&image->szarray_cache_lock);
-			if (!image->szarray_cache)
-				image->szarray_cache = g_hash_table_new (mono_aligned_addr_hash, NULL);
-			cached = (MonoClass *)g_hash_table_lookup (image->szarray_cache, eclass);
-			mono_os_mutex_unlock (&image->szarray_cache_lock);
-		}
+		/*
+		 * This case is very frequent not just during compilation because of calls
+		 * from mono_class_from_mono_type_internal (), mono_array_new (),
+		 * Array:CreateInstance (), etc, so the lookup doesn't take any locks.
+		 */
+		cached = (MonoClass *)mono_conc_hashtable_lookup (get_szarray_cache (image, mm), eclass);
 	} else {
 		if (mm) {
 			mono_mem_manager_lock (mm);
@@ -1239,15 +1261,7 @@ mono_class_create_bounded_array (MonoClass *eclass, guint32 rank, gboolean bound
 	/* Check cache again */
 	cached = NULL;
 	if (rank == 1 && !bounded) {
-		if (mm) {
-			mono_mem_manager_lock (mm);
-			cached = (MonoClass *)g_hash_table_lookup (mm->szarray_cache, eclass);
-			mono_mem_manager_unlock (mm);
-		} else {
-			mono_os_mutex_lock (&image->szarray_cache_lock);
-			cached = (MonoClass *)g_hash_table_lookup (image->szarray_cache, eclass);
-			mono_os_mutex_unlock (&image->szarray_cache_lock);
-		}
+		cached = (MonoClass *)mono_conc_hashtable_lookup (get_szarray_cache (image, mm), eclass);
 	} else {
 		if (mm) {
 			mono_mem_manager_lock (mm);
@@ -1282,13 +1296,14 @@ mono_class_create_bounded_array (MonoClass *eclass, guint32 rank, gboolean bound
 	++class_array_count;
 
 	if (rank == 1 && !bounded) {
+		/* Writers still need to be serialized */
 		if (mm) {
 			mono_mem_manager_lock (mm);
-			g_hash_table_insert (mm->szarray_cache, eclass, klass);
+			mono_conc_hashtable_insert (mm->szarray_cache, eclass, klass);
 			mono_mem_manager_unlock (mm);
 		} else {
 			mono_os_mutex_lock (&image->szarray_cache_lock);
-			g_hash_table_insert (image->szarray_cache, eclass, klass);
+			mono_conc_hashtable_insert (image->szarray_cache, eclass, klass);
 			mono_os_mutex_unlock (&image->szarray_cache_lock);
 		}
 	} else {
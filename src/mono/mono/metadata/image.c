@@ -2076,7 +2076,7 @@ mono_image_close_except_pools (MonoImage *image)
 		g_hash_table_destroy (image->array_cache);
 	}
 	if (image->szarray_cache)
-		g_hash_table_destroy (image->szarray_cache);
+		mono_conc_hashtable_destroy (image->szarray_cache);
 	if (image->ptr_cache)
 		g_hash_table_destroy (image->ptr_cache);
 	if (image->name_cache) {
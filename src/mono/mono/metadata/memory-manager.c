@@ -241,7 +241,8 @@ memory_manager_delete (MonoMemoryManager *memory_manager, gboolean debug_unload)
 	free_simdhash (&mm->ginst_cache);
 	free_simdhash (&mm->gmethod_cache);
 	free_simdhash (&mm->gsignature_cache);
-	free_hash (&mm->szarray_cache);
+	if (mm->szarray_cache)
+		mono_conc_hashtable_destroy (mm->szarray_cache);
 	free_hash (&mm->array_cache);
 	free_hash (&mm->ptr_cache);
 	free_hash (&mm->aggregate_modifiers_cache);
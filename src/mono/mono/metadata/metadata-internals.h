@@ -448,8 +448,8 @@ struct _MonoImage {
 	GHashTable *array_cache;
 	GHashTable *ptr_cache;
 
-	GHashTable *szarray_cache;
-	/* This has a separate lock to improve scalability */
+	/* Lookups are lock-free, the lock serializes inserts */
+	MonoConcurrentHashTable *szarray_cache;
 	mono_mutex_t szarray_cache_lock;
 
 	/*
@@ -61,6 +61,7 @@
 #include <mono/utils/mono-rand.h>
 #include <mono/utils/json.h>
 #include <mono/utils/mono-threads-coop.h>
+#include <mono/utils/mono-proclib.h>
 #include <mono/profiler/aot.h>
 #include <mono/utils/w32api.h>
 
@@ -259,6 +260,7 @@ typedef struct MonoAotOptions {
 	gboolean use_current_cpu;
 	gboolean dump_json;
 	gboolean profile_only;
+	gboolean profile_order;
 	gboolean no_opt;
 	gboolean wrappers_only;
 	char *clangxx;
@@ -416,6 +418,8 @@ typedef struct MonoAotCompile {
 	GHashTable *objc_selector_to_index;
 	GList *profile_data;
 	GHashTable *profile_methods;
+	/* Maps MonoMethod*->(rank in the profile + 1), only used with 'profile-order' */
+	GHashTable *profile_method_ranks;
 	GHashTable *blob_hash;
 	/* Maps MonoMethod*->GPtrArray* */
 	GHashTable *gshared_instances;
@@ -8928,7 +8932,10 @@ mono_aot_parse_options (const char *aot_options, MonoAotOptions *opts)
 		} else if (str_begins_with (arg, "interp")) {
 			opts->interp = TRUE;
 		} else if (str_begins_with (arg, "threads=")) {
-			opts->nthreads = atoi (arg + strlen ("threads="));
+			if (!strcmp (arg + strlen ("threads="), "auto"))
+				opts->nthreads = mono_cpu_count ();
+			else
+				opts->nthreads = atoi (arg + strlen ("threads="));
 		} else if (str_begins_with (arg, "static")) {
 			opts->static_link = TRUE;
 			opts->no_dlsym = TRUE;
@@ -9063,6 +9070,8 @@ mono_aot_parse_options (const char *aot_options, MonoAotOptions *opts)
 			opts->profile_files = g_list_append (opts->profile_files, g_strdup (arg + strlen ("profile=")));
 		} else if (!strcmp (arg, "profile-only")) {
 			opts->profile_only = TRUE;
+		} else if (!strcmp (arg, "profile-order")) {
+			opts->profile_order = TRUE;
 		} else if (str_begins_with (arg, "mibc-profile=")) {
 			opts->mibc_profile_files = g_list_append (opts->mibc_profile_files, g_strdup (arg + strlen ("mibc-profile=")));
 		} else if (!strcmp (arg, "verbose")) {
@@ -9160,6 +9169,7 @@ mono_aot_parse_options (const char *aot_options, MonoAotOptions *opts)
 			printf ("    outfile=<string>                     - \n");
 			printf ("    profile=<string>                     - \n");
 			printf ("    profile-only                         - \n");
+			printf ("    profile-order                        - Emit methods referenced by the profile contiguously at the start of the code section.\n");
 			printf ("    mibc-profile=<string>                - \n");
 			printf ("    print-skipped-methods                - \n");
 			printf ("    readonly-value=<value>               - \n");
@@ -9171,7 +9181,7 @@ mono_aot_parse_options (const char *aot_options, MonoAotOptions *opts)
 			printf ("    stats                                - \n");
 			printf ("    temp-path=<string>                   - \n");
 			printf ("    tool-prefix=<value>                  - \n");
-			printf ("    threads=<value>                      - \n");
+			printf ("    threads=<value>|auto                 - Number of threads used to compile methods in parallel.\n");
 			printf ("    write-symbols                        - \n");
 			printf ("    verbose                              - \n");
 			printf ("    allow-errors                         - \n");
@@ -9873,16 +9883,33 @@ compile_method (MonoAotCompile *acfg, MonoMethod *method)
 	}
 }
 
+typedef struct {
+	MonoAotCompile *acfg;
+	MonoMethod **methods;
+	int nmethods;
+	/* Index of the next method to compile, shared by all the threads */
+	volatile gint32 next;
+} CompileThreadData;
+
 static mono_thread_start_return_t WINAPI
 compile_thread_main (gpointer user_data)
 {
-	MonoAotCompile *acfg = ((MonoAotCompile **)user_data) [0];
-	GPtrArray *methods = ((GPtrArray **)user_data) [1];
+	CompileThreadData *data = (CompileThreadData *)user_data;
 
 	mono_thread_set_name_constant_ignore_error (mono_thread_internal_current (), "AOT compiler", MonoSetThreadNameFlag_Permanent);
 
-	for (guint i = 0; i < methods->len; ++i)
-		compile_method (acfg, (MonoMethod *)g_ptr_array_index (methods, i));
+	/*
+	 * Methods are handed out one at a time instead of in fixed fragments, since
+	 * their compile times vary a lot and fragments lead to idle threads at the end.
+	 * The output doesn't depend on the compile order, method indexes are already
+	 * assigned and the code is emitted in acfg->method_order.
+	 */
+	while (TRUE) {
+		int i = mono_atomic_inc_i32 (&data->next) - 1;
+		if (i >= data->nmethods)
+			break;
+		compile_method (data->acfg, data->methods [i]);
+	}
 
 	return 0;
 }
@@ -11127,6 +11154,90 @@ emit_code (MonoAotCompile *acfg)
 	emit_int32 (acfg, 0);
 }
 
+static guint
+get_profile_method_rank (MonoAotCompile *acfg, MonoCompile *cfg)
+{
+	guint rank;
+
+	rank = GPOINTER_TO_UINT (g_hash_table_lookup (acfg->profile_method_ranks, cfg->orig_method));
+	if (!rank && cfg->method != cfg->orig_method)
+		rank = GPOINTER_TO_UINT (g_hash_table_lookup (acfg->profile_method_ranks, cfg->method));
+	return rank;
+}
+
+static int
+compare_profile_method_ranks (const void *a, const void *b)
+{
+	const guint *ra = (const guint*)a;
+	const guint *rb = (const guint*)b;
+
+	/* Entries are (rank, method_order index) pairs, the index keeps the sort stable */
+	if (ra [0] != rb [0])
+		return ra [0] < rb [0] ? -1 : 1;
+	return ra [1] < rb [1] ? -1 : (ra [1] > rb [1] ? 1 : 0);
+}
+
+/*
+ * order_methods_by_profile:
+ *
+ *   Reorder acfg->method_order so the methods referenced by the profile are emitted
+ * first, in profile order, followed by the rest of the methods in their original order.
+ * This keeps the code executed during startup on as few pages as possible, while the
+ * cold methods end up together at the end of the code section.
+ */
+static void
+order_methods_by_profile (MonoAotCompile *acfg)
+{
+	GPtrArray *new_order;
+	guint *hot;
+	guint nhot = 0;
+
+	if (!g_hash_table_size (acfg->profile_method_ranks))
+		return;
+
+	hot = g_new0 (guint, acfg->method_order->len * 2);
+	for (guint oindex = 0; oindex < acfg->method_order->len; ++oindex) {
+		guint idx = GPOINTER_TO_UINT (g_ptr_array_index (acfg->method_order, oindex));
+		MonoCompile *cfg = acfg->cfgs [idx];
+		guint rank;
+
+		if (!cfg)
+			continue;
+		rank = get_profile_method_rank (acfg, cfg);
+		if (rank) {
+			hot [nhot * 2] = rank;
+			hot [nhot * 2 + 1] = oindex;
+			nhot ++;
+		}
+	}
+
+	if (!nhot) {
+		g_free (hot);
+		return;
+	}
+
+	qsort (hot, nhot, sizeof (guint) * 2, compare_profile_method_ranks);
+
+	new_order = g_ptr_array_sized_new (acfg->method_order->len);
+	for (guint i = 0; i < nhot; ++i)
+		g_ptr_array_add (new_order, g_ptr_array_index (acfg->method_order, hot [i * 2 + 1]));
+	for (guint oindex = 0; oindex < acfg->method_order->len; ++oindex) {
+		guint idx = GPOINTER_TO_UINT (g_ptr_array_index (acfg->method_order, oindex));
+		MonoCompile *cfg = acfg->cfgs [idx];
+
+		if (cfg && get_profile_method_rank (acfg, cfg))
+			continue;
+		g_ptr_array_add (new_order, g_ptr_array_index (acfg->method_order, oindex));
+	}
+	g_assert (new_order->len == acfg->method_order->len);
+
+	g_ptr_array_free (acfg->method_order, TRUE);
+	acfg->method_order = new_order;
+	g_free (hot);
+
+	aot_printf (acfg, "Ordered %u profiled methods at the start of the code section.\n", nhot);
+}
+
 static void
 emit_method_info_table (MonoAotCompile *acfg)
 {
@@ -13114,56 +13225,41 @@ compile_methods (MonoAotCompile *acfg)
 	int methods_len;
 
 	if (acfg->aot_opts.nthreads > 0) {
-		GPtrArray *frag;
-		int len;
 		GPtrArray *threads;
 		MonoThreadHandle *thread_handle;
-		gpointer *user_data;
-		MonoMethod **methods;
+		CompileThreadData *data;
+		int nthreads;
 
 		methods_len = acfg->methods->len;
+		nthreads = MIN (acfg->aot_opts.nthreads, methods_len);
 
-		len = acfg->methods->len / acfg->aot_opts.nthreads;
-		g_assert (len > 0);
-		/*
-		 * Partition the list of methods into fragments, and hand it to threads to
-		 * process.
-		 */
-		threads = g_ptr_array_new ();
+		data = g_new0 (CompileThreadData, 1);
+		data->acfg = acfg;
+		data->nmethods = methods_len;
 		/* Make a copy since acfg->methods is modified by compile_method () */
-		methods = g_new0 (MonoMethod*, methods_len);
-		//memcpy (methods, g_ptr_array_index (acfg->methods, 0), sizeof (MonoMethod*) * methods_len);
+		data->methods = g_new0 (MonoMethod*, methods_len);
 		for (int i = 0; i < methods_len; ++i)
-			methods [i] = (MonoMethod *)g_ptr_array_index (acfg->methods, i);
-		int idx = 0;
-		while (idx < methods_len) {
+			data->methods [i] = (MonoMethod *)g_ptr_array_index (acfg->methods, i);
+
+		threads = g_ptr_array_new ();
+		for (int i = 0; i < nthreads; ++i) {
 			ERROR_DECL (error);
 			MonoInternalThread *thread;
 
-			frag = g_ptr_array_new ();
-			for (int j = 0; j < len; ++j) {
-				if (idx < methods_len) {
-					g_ptr_array_add (frag, methods [idx]);
-					idx ++;
-				}
-			}
-
-			user_data = g_new0 (gpointer, 3);
-			user_data [0] = acfg;
-			user_data [1] = frag;
-
-			thread = mono_thread_create_internal ((MonoThreadStart)compile_thread_main, user_data, MONO_THREAD_CREATE_FLAGS_NONE, error);
+			thread = mono_thread_create_internal ((MonoThreadStart)compile_thread_main, data, MONO_THREAD_CREATE_FLAGS_NONE, error);
 			mono_error_assert_ok (error);
 
 			thread_handle = mono_threads_open_thread_handle (thread->handle);
 			g_ptr_array_add (threads, thread_handle);
 		}
-		g_free (methods);
 
 		for (guint i = 0; i < threads->len; ++i) {
 			mono_thread_info_wait_one_handle ((MonoThreadHandle*)g_ptr_array_index (threads, i), MONO_INFINITE_WAIT, FALSE);
 			mono_threads_close_thread_handle ((MonoThreadHandle*)g_ptr_array_index (threads, i));
 		}
+		g_ptr_array_free (threads, TRUE);
+		g_free (data->methods);
+		g_free (data);
 	} else {
 		methods_len = 0;
 	}
@@ -13868,6 +13964,9 @@ add_single_profile_method (MonoAotCompile *acfg, MonoMethod *method)
 	if (!method)
 		return 0;
 
+	if (acfg->aot_opts.profile_order && !g_hash_table_lookup (acfg->profile_method_ranks, method))
+		g_hash_table_insert (acfg->profile_method_ranks, method, GUINT_TO_POINTER (g_hash_table_size (acfg->profile_method_ranks) + 1));
+
 	/*
 	* Add methods referenced by the profile and
 	* Add fully shared version of method instances 'related' to this assembly to the AOT image.
@@ -14253,6 +14352,7 @@ acfg_create (MonoAssembly *ass, guint32 jit_opts)
 	acfg->gsharedvt_in_signatures = g_hash_table_new ((GHashFunc)mono_signature_hash, (GEqualFunc)mono_metadata_signature_equal);
 	acfg->gsharedvt_out_signatures = g_hash_table_new ((GHashFunc)mono_signature_hash, (GEqualFunc)mono_metadata_signature_equal);
 	acfg->profile_methods = g_hash_table_new (NULL, NULL);
+	acfg->profile_method_ranks = g_hash_table_new (NULL, NULL);
 	acfg->gshared_instances = g_hash_table_new (NULL, NULL);
 	acfg->prefer_instances = g_hash_table_new (NULL, NULL);
 	acfg->exported_methods = g_ptr_array_new ();
@@ -15563,6 +15663,9 @@ emit_aot_image (MonoAotCompile *acfg)
 	}
 #endif /* EMIT_DWARF_INFO */
 
+	if (acfg->aot_opts.profile_order)
+		order_methods_by_profile (acfg);
+
 	if (acfg->w)
 		mono_img_writer_emit_start (acfg->w);
 
@@ -287,6 +287,7 @@ typedef struct {
 	gint64 ssa_rename_vars_time;
 	gint64 optimize_bblocks_time;
 	gint64 cprop_time;
+	gint64 licm_time;
 	gint64 super_instructions_time;
 	gint32 emitted_instructions;
 	gint32 inlined_methods;
@@ -298,6 +298,191 @@ mono_interp_pgo_method_was_tiered (MonoMethod *method) {
 	}
 }
 
+static void
+compute_trace_hash (MonoMethod *method, uint32_t trace_offset, uint32_t body_size, uint8_t outbuf[MM3_HASH_BYTE_SIZE]) {
+	// method token + trace offset + size of method body + image guid
+	// The body size acts as a validation hash, if the optimized code for the method changed
+	//  between runs the offset of the trace is meaningless and we shouldn't match it
+	size_t size = sizeof(uint32_t) * 3 + 16;
+	uint32_t *inbuf = alloca (size);
+	inbuf[0] = mono_method_get_token (method);
+	inbuf[1] = trace_offset;
+	inbuf[2] = body_size;
+	MonoImage *image = m_class_get_image (mono_method_get_class (method));
+	memcpy (inbuf + 3, mono_image_get_guid (image), 16);
+
+	// Use a different seed than compute_method_hash, trace hashes share the table with method hashes
+	MurmurHash3_128 (inbuf, size, 0x6a697465, (uint8_t *)outbuf);
+}
+
+gboolean
+mono_interp_pgo_should_jit_trace (MonoMethod *method, uint32_t trace_offset, uint32_t body_size) {
+	// If we didn't load a table, don't bother hashing the trace.
+	if (!loaded_table)
+		return FALSE;
+
+	uint8_t hash[MM3_HASH_BYTE_SIZE];
+	compute_trace_hash (method, trace_offset, body_size, hash);
+
+	if (table_lookup (loaded_table, hash)) {
+		if (mono_opt_interp_pgo_logging) {
+			char * name = mono_method_full_name (method, TRUE);
+			g_print ("Compiling trace %s @%d early because it was in the interp_pgo table\n", name, trace_offset);
+			g_free (name);
+		}
+
+		return TRUE;
+	}
+
+	return FALSE;
+}
+
+void
+mono_interp_pgo_trace_was_jitted (MonoMethod *method, uint32_t trace_offset, uint32_t body_size) {
+	if (!mono_opt_interp_pgo_recording)
+		return;
+
+	// Wrapper tokens are not stable between runs
+	if (method->wrapper_type != MONO_WRAPPER_NONE)
+		return;
+
+	uint8_t hash[MM3_HASH_BYTE_SIZE] = {0};
+	compute_trace_hash (method, trace_offset, body_size, hash);
+
+	mono_os_mutex_lock (&building_table_lock);
+	table_add_locked (&building_table, hash);
+	mono_os_mutex_unlock (&building_table_lock);
+
+	if (mono_opt_interp_pgo_logging) {
+		char * name = mono_method_full_name (method, TRUE);
+		g_print ("added trace %s @%d to table\n", name, trace_offset);
+		g_free (name);
+	}
+}
+
+// Opcode sequence recording. For methods that tier up, we count the pairs and triples of adjacent
+//  opcodes within each basic block of the optimized code. Tiered methods are the hot ones, so the
+//  most frequent sequences are the best candidates for new superinstructions. Pairs and triples share
+//  one table, pairs have SEQUENCE_NO_OPCODE as their third opcode.
+#define SEQUENCE_NO_OPCODE 0xffff
+#define SEQUENCE_KEY(op1, op2, op3) (((guint64)(op1) << 32) | ((guint64)(op2) << 16) | (guint64)(op3))
+
+typedef struct {
+	guint64 key;
+	guint32 count;
+} interp_pgo_sequence;
+
+// Protected by building_table_lock
+static GHashTable *sequence_counts;
+
+static guint
+sequence_key_hash (gconstpointer key) {
+	guint64 k = *(const guint64 *)key;
+	return (guint)(k ^ (k >> 32));
+}
+
+static gboolean
+sequence_key_equal (gconstpointer a, gconstpointer b) {
+	return *(const guint64 *)a == *(const guint64 *)b;
+}
+
+static void
+sequence_add_locked (guint64 key) {
+	guint count = GPOINTER_TO_UINT (g_hash_table_lookup (sequence_counts, &key));
+	// Replacing frees the key of the existing entry, if any
+	g_hash_table_replace (sequence_counts, g_memdup (&key, sizeof (key)), GUINT_TO_POINTER (count + 1));
+}
+
+void
+mono_interp_pgo_record_opcode_sequences (void *_td) {
+	if (!mono_opt_interp_pgo_sequences)
+		return;
+
+	TransformData *td = (TransformData *)_td;
+
+	mono_os_mutex_lock (&building_table_lock);
+	if (!sequence_counts)
+		sequence_counts = g_hash_table_new_full (sequence_key_hash, sequence_key_equal, g_free, NULL);
+
+	for (InterpBasicBlock *bb = td->entry_bb; bb != NULL; bb = bb->next_bb) {
+		// Superinstructions can't span basic blocks, so sequences restart with every bblock
+		guint16 prev_op = SEQUENCE_NO_OPCODE, prev_prev_op = SEQUENCE_NO_OPCODE;
+		for (InterpInst *ins = bb->first_ins; ins != NULL; ins = ins->next) {
+			guint16 opcode = ins->opcode;
+			// Skip instructions that are not present in the emitted code
+			if (MINT_IS_EMIT_NOP (opcode) || opcode == MINT_IL_SEQ_POINT)
+				continue;
+
+			if (prev_op != SEQUENCE_NO_OPCODE)
+				sequence_add_locked (SEQUENCE_KEY (prev_op, opcode, SEQUENCE_NO_OPCODE));
+			if (prev_prev_op != SEQUENCE_NO_OPCODE)
+				sequence_add_locked (SEQUENCE_KEY (prev_prev_op, prev_op, opcode));
+
+			prev_prev_op = prev_op;
+			prev_op = opcode;
+		}
+	}
+	mono_os_mutex_unlock (&building_table_lock);
+}
+
+static int
+sequence_comparer (const void *lhs, const void *rhs) {
+	const interp_pgo_sequence *a = (const interp_pgo_sequence *)lhs, *b = (const interp_pgo_sequence *)rhs;
+	gboolean a_is_pair = (a->key & 0xffff) == SEQUENCE_NO_OPCODE,
+		b_is_pair = (b->key & 0xffff) == SEQUENCE_NO_OPCODE;
+
+	// Pairs first, then triples, each sorted by descending count
+	if (a_is_pair != b_is_pair)
+		return a_is_pair ? -1 : 1;
+	if (a->count != b->count)
+		return a->count > b->count ? -1 : 1;
+	return 0;
+}
+
+void
+mono_interp_pgo_print_opcode_sequences (void) {
+	if (!mono_opt_interp_pgo_sequences)
+		return;
+
+	mono_os_mutex_lock (&building_table_lock);
+	if (!sequence_counts) {
+		mono_os_mutex_unlock (&building_table_lock);
+		return;
+	}
+
+	guint count = g_hash_table_size (sequence_counts), i = 0;
+	interp_pgo_sequence *sequences = g_new (interp_pgo_sequence, count);
+	GHashTableIter iter;
+	gpointer key, value;
+	g_hash_table_iter_init (&iter, sequence_counts);
+	while (g_hash_table_iter_next (&iter, &key, &value)) {
+		sequences [i].key = *(guint64 *)key;
+		sequences [i].count = GPOINTER_TO_UINT (value);
+		i++;
+	}
+	mono_os_mutex_unlock (&building_table_lock);
+
+	mono_qsort (sequences, count, sizeof (interp_pgo_sequence), sequence_comparer);
+
+	int printed_pairs = 0, printed_triples = 0;
+	g_print ("Most frequent opcode sequences in tiered methods:\n");
+	for (i = 0; i < count; i++) {
+		guint16 op1 = (guint16)(sequences [i].key >> 32),
+			op2 = (guint16)(sequences [i].key >> 16),
+			op3 = (guint16)sequences [i].key;
+
+		if (op3 == SEQUENCE_NO_OPCODE) {
+			if (printed_pairs++ < mono_opt_interp_pgo_sequences)
+				g_print ("%10u  %s %s\n", sequences [i].count, mono_interp_opname (op1), mono_interp_opname (op2));
+		} else {
+			if (printed_triples++ < mono_opt_interp_pgo_sequences)
+				g_print ("%10u  %s %s %s\n", sequences [i].count, mono_interp_opname (op1), mono_interp_opname (op2), mono_interp_opname (op3));
+		}
+	}
+
+	g_free (sequences);
+}
+
 #if HOST_BROWSER
 
 #include <emscripten.h>
@@ -345,6 +530,12 @@ mono_interp_pgo_load_table (uint8_t * data, int data_size) {
 	return 0;
 }
 
+// Browser applications don't usually shut down, so the sequence report can be requested explicitly
+EMSCRIPTEN_KEEPALIVE void
+mono_interp_pgo_dump_opcode_sequences (void) {
+	mono_interp_pgo_print_opcode_sequences ();
+}
+
 EMSCRIPTEN_KEEPALIVE int
 mono_interp_pgo_save_table (uint8_t * data, int data_size) {
 	if (!building_table)
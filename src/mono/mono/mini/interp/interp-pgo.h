@@ -7,10 +7,23 @@ mono_interp_pgo_should_tier_method (MonoMethod *method);
 void
 mono_interp_pgo_method_was_tiered (MonoMethod *method);
 
+gboolean
+mono_interp_pgo_should_jit_trace (MonoMethod *method, uint32_t trace_offset, uint32_t body_size);
+
+void
+mono_interp_pgo_trace_was_jitted (MonoMethod *method, uint32_t trace_offset, uint32_t body_size);
+
 void
 mono_interp_pgo_generate_start (void);
 
 void
 mono_interp_pgo_generate_end (void);
 
+// Pass void* so that this header can be included in files without the definition of TransformData
+void
+mono_interp_pgo_record_opcode_sequences (void *td);
+
+void
+mono_interp_pgo_print_opcode_sequences (void);
+
 #endif // __MONO_MINI_INTERP_PGO_H__
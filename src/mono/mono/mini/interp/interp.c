@@ -8023,6 +8023,8 @@ interp_parse_options (const char *options)
 				opt = INTERP_OPT_SSA;
 			else if (strncmp (arg, "precise", 7) == 0)
 				opt = INTERP_OPT_PRECISE_GC;
+			else if (strncmp (arg, "licm", 4) == 0)
+				opt = INTERP_OPT_LICM;
 			else if (strncmp (arg, "all", 3) == 0)
 				opt = ~INTERP_OPT_NONE;
 
@@ -8835,6 +8837,7 @@ interp_cleanup (void)
 #if PROFILE_INTERP
 	interp_print_method_counts ();
 #endif
+	mono_interp_pgo_print_opcode_sequences ();
 }
 
 #undef MONO_EE_CALLBACK
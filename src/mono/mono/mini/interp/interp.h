@@ -43,7 +43,8 @@ enum {
 #endif
 	INTERP_OPT_SSA = 128,
 	INTERP_OPT_PRECISE_GC = 256,
-	INTERP_OPT_DEFAULT = INTERP_OPT_INLINE | INTERP_OPT_CPROP | INTERP_OPT_SUPER_INSTRUCTIONS | INTERP_OPT_BBLOCKS | INTERP_OPT_TIERING | INTERP_OPT_SIMD | INTERP_OPT_SSA | INTERP_OPT_PRECISE_GC
+	INTERP_OPT_LICM = 512,
+	INTERP_OPT_DEFAULT = INTERP_OPT_INLINE | INTERP_OPT_CPROP | INTERP_OPT_SUPER_INSTRUCTIONS | INTERP_OPT_BBLOCKS | INTERP_OPT_TIERING | INTERP_OPT_SIMD | INTERP_OPT_SSA | INTERP_OPT_PRECISE_GC | INTERP_OPT_LICM
 #if HOST_BROWSER
 		| INTERP_OPT_JITERPRETER
 #endif
@@ -44,6 +44,7 @@ void jiterp_preserve_module (void);
 #include "transform.h"
 #include "interp-intrins.h"
 #include "tiering.h"
+#include "interp-pgo.h"
 
 #include <mono/utils/mono-math.h>
 #include <mono/mini/mini.h>
@@ -932,13 +933,26 @@ mono_interp_tier_prepare_jiterpreter_fast (
 	gint64 count = atomic_fetch_add ((atomic_llong *)&trace_info->hit_count, 1);
 #endif
 
-	if (count == mono_opt_jiterpreter_minimum_trace_hit_count) {
+	guint32 trace_offset = (guint32)(ip - start_of_body);
+	// Traces that were compiled during a previous run of the application are compiled on their
+	//  first hit, skipping the warmup period, if they are in the interp_pgo table
+	gboolean pgo_hit = (count == 0) &&
+		(mono_opt_jiterpreter_minimum_trace_hit_count > 0) &&
+		mono_interp_pgo_should_jit_trace (method, trace_offset, size_of_body);
+	if (pgo_hit) {
+		// Trace monitoring measures hits relative to the warmup period, so pretend we went through it
+		trace_info->hit_count = mono_opt_jiterpreter_minimum_trace_hit_count + 1;
+	}
+
+	if (pgo_hit || (count == mono_opt_jiterpreter_minimum_trace_hit_count)) {
 		JiterpreterThunk result = mono_interp_tier_prepare_jiterpreter (
 			frame, method, ip, (gint32)trace_index,
 			start_of_body, size_of_body, frame->imethod->is_verbose,
 			0
 		);
 		trace_info->thunk = result;
+		if ((gsize)(void*)result > JITERPRETER_NOT_JITTED)
+			mono_interp_pgo_trace_was_jitted (method, trace_offset, size_of_body);
 		return result;
 	} else {
 		// Hit count not reached, or already reached but compilation is not done yet
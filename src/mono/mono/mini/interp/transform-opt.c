@@ -3235,7 +3235,7 @@ retry_instruction:
 					td->var_values [ins->sregs [0]].ref_count--;
 					goto retry_instruction;
 				}
-			} else if (MINT_IS_BOX (opcode)) {
+			} else if (MINT_IS_BOX (opcode) || opcode == MINT_NEWARR) {
 				// TODO Add more relevant opcodes
 				td->var_values [dreg].type = VAR_VALUE_NON_NULL;
 			}
@@ -3243,6 +3243,225 @@ retry_instruction:
 	}
 }
 
+/*
+ * LOOP INVARIANT CODE MOTION
+ */
+
+// Instructions that compute their dreg only from their sregs, with no side effects and
+// no possibility of throwing. They can be executed speculatively, before entering a loop.
+static gboolean
+interp_ins_is_speculatable (int opcode)
+{
+	if (MINT_IS_LDC_I4 (opcode) || MINT_IS_LDC_I8 (opcode) || opcode == MINT_LDC_R4 || opcode == MINT_LDC_R8 || opcode == MINT_LDPTR)
+		return TRUE;
+	if (MINT_IS_BINOP (opcode))
+		return !(opcode >= MINT_DIV_I4 && opcode <= MINT_SUB_OVF_UN_I8) && !(opcode >= MINT_REM_I4 && opcode <= MINT_REM_UN_I8);
+	if (MINT_IS_UNOP (opcode))
+		return !(opcode >= MINT_CONV_OVF_I1_I4 && opcode <= MINT_CONV_OVF_U8_R8);
+	if (MINT_IS_BINOP_IMM (opcode))
+		return TRUE;
+	return FALSE;
+}
+
+static gboolean
+interp_bb_dominates (TransformData *td, InterpBasicBlock *dom, InterpBasicBlock *bb)
+{
+	// bblocks are ordered in reverse postorder, so an idom always has a smaller dfs index
+	while (bb->dfs_index > dom->dfs_index)
+		bb = td->idoms [bb->dfs_index];
+	return bb == dom;
+}
+
+// Computes the set of bblocks forming the natural loop of header, merging all back edges that
+// target it. Returns FALSE if header is not a loop header or if the loop contains bblocks that
+// are not part of the ssa cfg or that are not dominated by header (irreducible control flow).
+static gboolean
+interp_compute_loop_body (TransformData *td, InterpBasicBlock *header, MonoBitSet *body, InterpBasicBlock **worklist)
+{
+	gboolean has_back_edge = FALSE;
+	int count = 0;
+
+	mono_bitset_clear_all (body);
+	mono_bitset_set_fast (body, header->dfs_index);
+	for (int i = 0; i < header->in_count; i++) {
+		InterpBasicBlock *in_bb = header->in_bb [i];
+		if (!is_bblock_ssa_cfg (td, in_bb) || !interp_bb_dominates (td, header, in_bb))
+			continue;
+		has_back_edge = TRUE;
+		if (!mono_bitset_test_fast (body, in_bb->dfs_index)) {
+			mono_bitset_set_fast (body, in_bb->dfs_index);
+			worklist [count++] = in_bb;
+		}
+	}
+
+	if (!has_back_edge)
+		return FALSE;
+
+	while (count) {
+		InterpBasicBlock *bb = worklist [--count];
+		for (int i = 0; i < bb->in_count; i++) {
+			InterpBasicBlock *in_bb = bb->in_bb [i];
+			if (!is_bblock_ssa_cfg (td, in_bb) || !interp_bb_dominates (td, header, in_bb))
+				return FALSE;
+			if (!mono_bitset_test_fast (body, in_bb->dfs_index)) {
+				mono_bitset_set_fast (body, in_bb->dfs_index);
+				worklist [count++] = in_bb;
+			}
+		}
+	}
+	return TRUE;
+}
+
+static gboolean
+interp_var_is_loop_invariant (TransformData *td, int var, MonoBitSet *body)
+{
+	if (!var_is_ssa_form (td, var) || var_has_indirects (td, var))
+		return FALSE;
+	// Vars without a definition have a zeroed liveness, which places them in the entry bblock
+	guint32 def_bb_dfs_index = td->var_values [var].liveness.bb_dfs_index;
+	if (def_bb_dfs_index >= (guint32)td->bblocks_count_no_eh)
+		return FALSE;
+	return !mono_bitset_test_fast (body, def_bb_dfs_index);
+}
+
+static gboolean
+interp_var_can_be_hoisted (TransformData *td, int var)
+{
+	InterpVar *var_data = &td->vars [var];
+	if (!var_is_ssa_form (td, var) || var_has_indirects (td, var))
+		return FALSE;
+	// All renamed vars of an IL local share the same storage, we can't move their
+	// definitions without checking for liveness overlap
+	if (var_data->il_global || var_data->renamed_ssa_fixed || var_data->def_arg)
+		return FALSE;
+	return TRUE;
+}
+
+static void
+interp_hoist_loop_invariants (TransformData *td, InterpBasicBlock *header, InterpBasicBlock *preheader, MonoBitSet *body)
+{
+	// Hoisted instructions are added at the end of the preheader, before its branch
+	InterpInst *prev_ins = preheader->last_ins;
+	if (prev_ins && (MINT_IS_UNCONDITIONAL_BRANCH (prev_ins->opcode) || MINT_IS_CONDITIONAL_BRANCH (prev_ins->opcode) || prev_ins->opcode == MINT_SWITCH))
+		prev_ins = prev_ins->prev;
+
+	// New instructions don't have the liveness marker, they share the liveness index of prev_ins
+	InterpLivenessPosition liveness;
+	liveness.bb_dfs_index = preheader->dfs_index;
+	liveness.ins_index = 0;
+	for (InterpInst *ins = prev_ins; ins != NULL; ins = ins->prev) {
+		if (ins->flags & INTERP_INST_FLAG_LIVENESS_MARKER)
+			liveness.ins_index++;
+	}
+
+	// Loop bblocks are dominated by the header so they all follow it in dfs order. This guarantees
+	// we visit the definition of a hoisted var before its uses.
+	for (int bb_dfs_index = header->dfs_index; bb_dfs_index < td->bblocks_count_no_eh; bb_dfs_index++) {
+		if (!mono_bitset_test_fast (body, bb_dfs_index))
+			continue;
+		InterpBasicBlock *bb = td->bblocks [bb_dfs_index];
+
+		// Instructions that can throw are hoisted only if no other instruction with side effects
+		// would execute before them. The preheader always falls into the header, so moving the
+		// exception there is not observable. We don't bother with methods that have clauses.
+		gboolean can_hoist_faulting = bb == header && td->header->num_clauses == 0;
+
+		for (InterpInst *ins = bb->first_ins; ins != NULL; ins = ins->next) {
+			int opcode = ins->opcode;
+			if (MINT_IS_NOP (opcode) || opcode == MINT_PHI)
+				continue;
+
+			gboolean speculatable = interp_ins_is_speculatable (opcode);
+			gboolean hoist = speculatable;
+			// ldlen is a frequent loop invariant, as part of the loop condition
+			if (opcode == MINT_LDLEN)
+				hoist = can_hoist_faulting || get_var_value_type (td, ins->sregs [0]) == VAR_VALUE_NON_NULL;
+
+			if (hoist && interp_var_can_be_hoisted (td, ins->dreg)) {
+				int num_sregs = mono_interp_op_sregs [opcode];
+				for (int i = 0; i < num_sregs; i++) {
+					if (!interp_var_is_loop_invariant (td, ins->sregs [i], body)) {
+						hoist = FALSE;
+						break;
+					}
+				}
+			} else {
+				hoist = FALSE;
+			}
+
+			if (!hoist) {
+				if (!speculatable)
+					can_hoist_faulting = FALSE;
+				continue;
+			}
+
+			if (td->verbose_level) {
+				g_print ("hoist from BB%d to BB%d:\n\t", bb->index, preheader->index);
+				interp_dump_ins (ins, td->data_items);
+			}
+
+			InterpInst *new_ins = interp_insert_ins_bb (td, preheader, prev_ins, opcode);
+			new_ins->il_offset = ins->il_offset;
+			new_ins->dreg = ins->dreg;
+			memcpy (new_ins->sregs, ins->sregs, sizeof (ins->sregs));
+			memcpy (new_ins->data, ins->data, sizeof (guint16) * (mono_interp_oplen [opcode] - 1));
+			interp_clear_ins (ins);
+
+			td->var_values [new_ins->dreg].def = new_ins;
+			td->var_values [new_ins->dreg].liveness = liveness;
+			prev_ins = new_ins;
+		}
+	}
+}
+
+// Moves loop invariant computations out of loops. This pass needs to run in SSA form,
+// after cprop, so that var_values contains the definition point of every var.
+static void
+interp_licm (TransformData *td)
+{
+	if (td->verbose_level)
+		g_print ("\nLICM:\n");
+
+	int bitsize = mono_bitset_alloc_size (td->bblocks_count_no_eh, 0);
+	MonoBitSet *body = mono_bitset_mem_new (mono_mempool_alloc0 (td->opt_mempool, bitsize), td->bblocks_count_no_eh, 0);
+	InterpBasicBlock **worklist = (InterpBasicBlock**)mono_mempool_alloc (td->opt_mempool, sizeof (InterpBasicBlock*) * td->bblocks_count_no_eh);
+
+	// Visit headers in reverse dfs order. Inner loops are processed first, so instructions hoisted
+	// in their preheader can then be hoisted out of the enclosing loop.
+	for (int i = td->bblocks_count_no_eh - 1; i > 0; i--) {
+		InterpBasicBlock *header = td->bblocks [i];
+		if (!interp_compute_loop_body (td, header, body, worklist))
+			continue;
+
+		InterpBasicBlock *preheader = NULL;
+		gboolean valid = TRUE;
+		for (int j = 0; j < header->in_count; j++) {
+			InterpBasicBlock *in_bb = header->in_bb [j];
+			if (is_bblock_ssa_cfg (td, in_bb) && mono_bitset_test_fast (body, in_bb->dfs_index))
+				continue;
+			if (preheader || !is_bblock_ssa_cfg (td, in_bb)) {
+				valid = FALSE;
+				break;
+			}
+			preheader = in_bb;
+		}
+		if (!valid || !preheader || preheader->out_count != 1)
+			continue;
+
+		// With tiering, execution of the optimized code can start at a patchpoint bblock,
+		// which would skip the preheader
+		int bb_dfs_index;
+		mono_bitset_foreach_bit (body, bb_dfs_index, td->bblocks_count_no_eh) {
+			if (td->bblocks [bb_dfs_index]->patchpoint_data)
+				valid = FALSE;
+		}
+		if (!valid)
+			continue;
+
+		interp_hoist_loop_invariants (td, header, preheader, body);
+	}
+}
+
 void
 mono_test_interp_cprop (TransformData *td)
 {
@@ -3969,6 +4188,11 @@ optimization_retry:
 
 	interp_var_deadce (td);
 
+	// LICM needs the dominator tree, which is computed only with SSA. If the cfg changed during
+	// cprop, we will do another optimization iteration anyway.
+	if ((mono_interp_opt & INTERP_OPT_LICM) && !td->disable_ssa && !td->need_optimization_retry)
+		MONO_TIME_TRACK (mono_interp_stats.licm_time, interp_licm (td));
+
 	// We run this after var deadce to detect more single use vars. This pass will clear
 	// unnecessary instruction on the fly so deadce is no longer needed to run.
 	if (mono_interp_opt & INTERP_OPT_SUPER_INSTRUCTIONS) {
@@ -9530,6 +9530,8 @@ retry:
 	generate_compacted_code (rtm, td);
 
 	if (td->optimized) {
+		mono_interp_pgo_record_opcode_sequences (td);
+
 		// Offset allocator and compacted code generation use computed ref counts
 		// from var values. We have to free this table later here.
 		if (td->var_values != NULL) {
@@ -9702,9 +9704,17 @@ tiered_patcher (MiniTieredPatchPointContext *ctx, gpointer patchsite)
 	if (!jit_call2_supported (m, mono_method_signature_internal (m)))
 		return FALSE;
 
-	/* TODO: Force compilation here. Currently the JIT will be invoked upon
-	 *       first execution of `MINT_JIT_CALL2`. */
-	InterpMethod *rmethod = mono_interp_get_imethod (cm);
+	/* Compile here on the tiered compilation thread, so that the interpreter
+	 * doesn't stall on the JIT upon first execution of `MINT_JIT_CALL2`. The
+	 * JIT caches the code, so this is cheap for the method's other callsites. */
+	ERROR_DECL (error);
+	mono_jit_compile_method_jit_only (m, error);
+	if (!is_ok (error)) {
+		mono_error_cleanup (error);
+		return FALSE;
+	}
+
+	InterpMethod *rmethod = mono_interp_get_imethod (m);
 
 	guint16 *ip = ((guint16 *) patchsite);
 	*ip++ = MINT_JIT_CALL2;
@@ -287,6 +287,7 @@ mono_linear_scan2 (MonoCompile *cfg, GList *vars, GList *regs, regmask_t *used_m
 	GList *unhandled, *active, *inactive, *l;
 	MonoMethodVar *vmv;
 	gint32 free_pos [sizeof (regmask_t) * 8];
+	gint32 inactive_free_pos [sizeof (regmask_t) * 8];
 	gint32 gains [sizeof (regmask_t) * 8];
 	regmask_t used_regs = 0;
 	int n_regs, n_regvars, i;
@@ -371,27 +372,33 @@ mono_linear_scan2 (MonoCompile *cfg, GList *vars, GList *regs, regmask_t *used_m
 
 		/* Find a register for the current interval */
 		for (i = 0; i < n_regs; ++i)
-			free_pos [i] = ((gint32)0x7fffffff);
+			inactive_free_pos [i] = ((gint32)0x7fffffff);
 
-		for (l = active; l != NULL; l = l->next) {
+		/*
+		 * The inactive intervals limit a register even if it is freed by spilling
+		 * the active interval using it, so keep track of them separately.
+		 */
+		for (l = inactive; l != NULL; l = l->next) {
 			MonoMethodVar *v = (MonoMethodVar*)l->data;
+			gint32 intersect_pos;
 
 			if (v->reg >= 0) {
-				free_pos [v->reg] = 0;
-				LSCAN_DEBUG (printf ("\threg %d is busy (cost %d)\n", v->reg, v->spill_costs));
+				intersect_pos = mono_linterval_get_intersect_pos (current->interval, v->interval);
+				if (intersect_pos != -1 && intersect_pos < inactive_free_pos [v->reg]) {
+					inactive_free_pos [v->reg] = intersect_pos;
+					LSCAN_DEBUG (printf ("\threg %d becomes free at %d\n", v->reg, intersect_pos));
+				}
 			}
 		}
 
-		for (l = inactive; l != NULL; l = l->next) {
+		memcpy (free_pos, inactive_free_pos, n_regs * sizeof (gint32));
+
+		for (l = active; l != NULL; l = l->next) {
 			MonoMethodVar *v = (MonoMethodVar*)l->data;
-			gint32 intersect_pos;
 
 			if (v->reg >= 0) {
-				intersect_pos = mono_linterval_get_intersect_pos (current->interval, v->interval);
-				if (intersect_pos != -1) {
-					free_pos [v->reg] = intersect_pos;
-					LSCAN_DEBUG (printf ("\threg %d becomes free at %d\n", v->reg, intersect_pos));
-				}
+				free_pos [v->reg] = 0;
+				LSCAN_DEBUG (printf ("\threg %d is busy (cost %d)\n", v->reg, v->spill_costs));
 			}
 		}
 
@@ -420,44 +427,40 @@ mono_linear_scan2 (MonoCompile *cfg, GList *vars, GList *regs, regmask_t *used_m
 			 * supported, so we spill in this case too.
 			 */
 
-			/* Spill an interval */
+			/*
+			 * Spill the cheapest active interval whose register would then be free
+			 * for the whole current interval, and give the register to the current
+			 * interval. The spill costs are weighted by the loop nesting of the uses,
+			 * so this keeps the variables used in inner loops in registers. If no
+			 * such interval is cheaper than the current one, spill the current one.
+			 */
+			GList *min_spill_pos = NULL;
+			int min_spill_value = current->spill_costs;
 
-			/* FIXME: Optimize the selection of the interval */
+			for (l = active; l != NULL; l = l->next) {
+				vmv = (MonoMethodVar*)l->data;
 
-			if (active) {
-				GList *min_spill_pos;
-#if 0
-				/*
-				 * This favors registers with big spill costs, thus larger liveness ranges,
-				 * thus actually leading to worse code size.
-				 */
-				guint32 min_spill_value = G_MAXINT32;
-
-				for (l = active; l != NULL; l = l->next) {
-					vmv = (MonoMethodVar*)l->data;
-
-					if (vmv->spill_costs < min_spill_value) {
-						min_spill_pos = l;
-						min_spill_value = vmv->spill_costs;
-					}
+				if (vmv->reg >= 0 && vmv->spill_costs < min_spill_value && inactive_free_pos [vmv->reg] >= current->interval->last_range->to) {
+					min_spill_pos = l;
+					min_spill_value = vmv->spill_costs;
 				}
-#else
-				/* Spill either the first active or the current interval */
-				min_spill_pos = active;
-#endif
+			}
+
+			if (min_spill_pos) {
 				vmv = (MonoMethodVar*)min_spill_pos->data;
-				if (vmv->spill_costs < current->spill_costs) {
-				//				if (vmv->interval->last_range->to < current->interval->last_range->to) {
-					gains [vmv->reg] -= vmv->spill_costs;
-					vmv->reg = -1;
-					LSCAN_DEBUG (printf ("\tSpilled R%d\n", cfg->varinfo [vmv->idx]->dreg));
-					active = g_list_delete_link (active, min_spill_pos);
-				}
-				else
-					LSCAN_DEBUG (printf ("\tSpilled current (cost %d)\n", current->spill_costs));
+				reg = vmv->reg;
+				gains [reg] -= vmv->spill_costs;
+				vmv->reg = -1;
+				LSCAN_DEBUG (printf ("\tSpilled R%d\n", cfg->varinfo [vmv->idx]->dreg));
+				active = g_list_delete_link (active, min_spill_pos);
+
+				current->reg = reg;
+				LSCAN_DEBUG (printf ("\tAssigned hreg %d to R%d\n", reg, cfg->varinfo [current->idx]->dreg));
+				active = g_list_append (active, current);
+				gains [current->reg] += current->spill_costs;
+			} else {
+				LSCAN_DEBUG (printf ("\tSpilled current (cost %d)\n", current->spill_costs));
 			}
-			else
-				LSCAN_DEBUG (printf ("\tSpilled current\n"));
 		}
 	}
 
@@ -31,6 +31,16 @@ static const int threshold [NUM_TIERS] = {
 	3000, /* tier 1 */
 };
 
+static gboolean
+compilation_queue_empty (void)
+{
+	for (int tier_level = 0; tier_level < NUM_TIERS; tier_level++) {
+		if (compilation_queue [tier_level])
+			return FALSE;
+	}
+	return TRUE;
+}
+
 static void
 compiler_thread (void)
 {
@@ -40,8 +50,10 @@ compiler_thread (void)
 
 	mono_native_thread_set_name (mono_native_thread_id_get (), "Tiered Compilation Thread");
 
+	mono_coop_mutex_lock (&compilation_mutex);
 	while (TRUE) {
-		mono_coop_cond_wait (&compilation_wait, &compilation_mutex);
+		while (compilation_queue_empty ())
+			mono_coop_cond_wait (&compilation_wait, &compilation_mutex);
 
 		for (int tier_level = 0; tier_level < NUM_TIERS; tier_level++) {
 			GSList *ppcs = compilation_queue [tier_level];
@@ -55,9 +67,14 @@ compiler_thread (void)
 						continue;
 
 					GSList *patchsites = g_hash_table_lookup (callsites_hash [patch_kind], ppc->target_method);
+					g_hash_table_remove (callsites_hash [patch_kind], ppc->target_method);
+
+					/* Patchers compile the method, don't block the interpreter from
+					 * queueing methods and recording callsites meanwhile. */
+					mono_coop_mutex_unlock (&compilation_mutex);
 
-					for (; patchsites != NULL; patchsites = patchsites->next) {
-						gpointer patchsite = (gpointer) patchsites->data;
+					for (GSList *l = patchsites; l != NULL; l = l->next) {
+						gpointer patchsite = (gpointer) l->data;
 
 						mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_TIERED, "tiered: patching %p with patch_kind=%s @ tier_level=%d", patchsite, patch_kind_str [patch_kind], tier_level);
 						mono_trace (G_LOG_LEVEL_DEBUG, MONO_TRACE_TIERED, "\t-> caller=%s", mono_pmip (patchsite));
@@ -68,14 +85,14 @@ compiler_thread (void)
 						if (!success)
 							mono_trace (G_LOG_LEVEL_WARNING, MONO_TRACE_TIERED, "tiered: couldn't patch %p with target %s, dropping it.", patchsite, mono_method_full_name (ppc->target_method, TRUE));
 					}
-					g_hash_table_remove (callsites_hash [patch_kind], ppc->target_method);
 					g_slist_free (patchsites);
+
+					mono_coop_mutex_lock (&compilation_mutex);
 				}
 				g_free (ppc);
 			}
 			g_slist_free (ppcs);
 		}
-		mono_coop_mutex_unlock (&compilation_mutex);
 	}
 }
 
@@ -105,12 +122,14 @@ mini_tiered_register_callsite_patcher (CallsitePatcher func, int level)
 void
 mini_tiered_record_callsite (gpointer ip, MonoMethod *target_method, int patch_kind)
 {
+	mono_coop_mutex_lock (&compilation_mutex);
 	if (!callsites_hash [patch_kind])
 		callsites_hash [patch_kind] = g_hash_table_new (NULL, NULL);
 
 	GSList *patchsites = g_hash_table_lookup (callsites_hash [patch_kind], target_method);
 	patchsites = g_slist_prepend (patchsites, ip);
 	g_hash_table_insert (callsites_hash [patch_kind], target_method, patchsites);
+	mono_coop_mutex_unlock (&compilation_mutex);
 }
 
 void
@@ -128,8 +147,8 @@ mini_tiered_inc (MonoMethod *method, MiniTieredCounter *tcnt, int tier_level)
 
 		mono_coop_mutex_lock (&compilation_mutex);
 		compilation_queue [tier_level] = g_slist_append (compilation_queue [tier_level], ppc);
-		mono_coop_mutex_unlock (&compilation_mutex);
 		mono_coop_cond_signal (&compilation_wait);
+		mono_coop_mutex_unlock (&compilation_mutex);
 	} else if (!tcnt->promoted) {
 		/* FIXME: inline that into caller */
 		tcnt->hotness++;
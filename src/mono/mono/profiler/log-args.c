@@ -98,6 +98,8 @@ parse_arg (const char *arg, ProfilerConfig *config)
 	} else if (match_option (arg, "heapshot-on-shutdown", NULL)) {
 		config->hs_on_shutdown = TRUE;
 		config->enable_mask |= PROFLOG_HEAPSHOT_ALIAS;
+	} else if (match_option (arg, "sample-aggregate", NULL)) {
+		config->sample_aggregate = TRUE;
 	} else if (match_option (arg, "sample", &val)) {
 		set_sample_freq (config, val);
 		config->sampling_mode = MONO_PROFILER_SAMPLE_MODE_PROCESS;
@@ -329,6 +331,8 @@ usage (void)
 	mono_profiler_printf ("\tsample[-real][=FREQ] enable/disable statistical sampling of threads");
 	mono_profiler_printf ("\t                     FREQ in Hz, 100 by default");
 	mono_profiler_printf ("\t                     the -real variant uses wall clock time instead of process time");
+	mono_profiler_printf ("\tsample-aggregate     write the number of hits of each distinct stack every second");
+	mono_profiler_printf ("\t                     instead of one event per sample");
 	mono_profiler_printf ("\theapshot[=MODE]      record heapshot info (by default at each major collection)");
 	mono_profiler_printf ("\t                     MODE: every XXms milliseconds, every YYgc collections, ondemand");
 	mono_profiler_printf ("\theapshot-on-shutdown do a heapshot on runtime shutdown");
@@ -3053,6 +3053,130 @@ reuse_sample_hit (gpointer p)
 	mono_lock_free_queue_enqueue (&log_profiler.sample_reuse_queue, &sample->node);
 }
 
+/*
+ * With sample-aggregate, the dumper thread counts the hits of each distinct
+ * instruction pointer and backtrace, and periodically writes the counts as
+ * TYPE_SAMPLE_FOLDED events instead of writing one event per sample hit.
+ */
+typedef struct {
+	const void *ip;
+	guint32 hits;
+	int count;
+	MonoMethod *frames [MONO_ZERO_LEN_ARRAY];
+} FoldedSample;
+
+#define FOLDED_SAMPLE_SIZE(FRAMES) (sizeof (FoldedSample) + sizeof (MonoMethod *) * (FRAMES - MONO_ZERO_LEN_ARRAY))
+// Flush the folded samples at least this often (in nanoseconds), and whenever there are this many distinct stacks.
+#define FOLDED_SAMPLES_FLUSH_INTERVAL (1000 * 1000 * 1000)
+#define FOLDED_SAMPLES_MAX 4096
+
+static GHashTable *folded_samples;
+static uint64_t folded_samples_flush_time;
+
+static guint
+folded_sample_hash (gconstpointer key)
+{
+	const FoldedSample *folded = (const FoldedSample *) key;
+	guint hash = g_direct_hash (folded->ip);
+
+	for (int i = 0; i < folded->count; ++i)
+		hash = hash * 31 + g_direct_hash (folded->frames [i]);
+
+	return hash;
+}
+
+static gboolean
+folded_sample_equal (gconstpointer a, gconstpointer b)
+{
+	const FoldedSample *folded_a = (const FoldedSample *) a;
+	const FoldedSample *folded_b = (const FoldedSample *) b;
+
+	return folded_a->ip == folded_b->ip && folded_a->count == folded_b->count &&
+		!memcmp (folded_a->frames, folded_b->frames, sizeof (MonoMethod *) * folded_a->count);
+}
+
+static void
+flush_folded_samples (void)
+{
+	folded_samples_flush_time = current_time ();
+
+	if (!folded_samples || !g_hash_table_size (folded_samples))
+		return;
+
+	GHashTableIter iter;
+	FoldedSample *folded;
+
+	g_hash_table_iter_init (&iter, folded_samples);
+
+	while (g_hash_table_iter_next (&iter, (gpointer *) &folded, NULL)) {
+		ENTER_LOG (&sample_hits_ctr, logbuffer,
+			EVENT_SIZE /* event */ +
+			LEB128_SIZE /* hits */ +
+			LEB128_SIZE /* ip */ +
+			LEB128_SIZE /* managed count */ +
+			folded->count * (
+				LEB128_SIZE /* method */
+			)
+		);
+
+		emit_event (logbuffer, TYPE_SAMPLE | TYPE_SAMPLE_FOLDED);
+		emit_uvalue (logbuffer, folded->hits);
+		emit_ptr (logbuffer, folded->ip);
+		emit_uvalue (logbuffer, folded->count);
+
+		for (int i = 0; i < folded->count; ++i)
+			emit_method (logbuffer, folded->frames [i]);
+
+		EXIT_LOG;
+
+		for (int i = 0; i < folded->count; ++i) {
+			if (folded->frames [i])
+				dec_method_ref_count (folded->frames [i]);
+		}
+	}
+
+	g_hash_table_remove_all (folded_samples);
+}
+
+// Takes over the method references of the sample.
+static void
+fold_sample_hit (SampleHit *sample)
+{
+	if (!folded_samples) {
+		folded_samples = g_hash_table_new_full (folded_sample_hash, folded_sample_equal, g_free, NULL);
+		folded_samples_flush_time = sample->time;
+	}
+
+	FoldedSample *folded = (FoldedSample *) g_malloc (FOLDED_SAMPLE_SIZE (sample->count));
+
+	folded->ip = sample->ip;
+	folded->hits = 1;
+	folded->count = sample->count;
+
+	for (int i = 0; i < sample->count; ++i)
+		folded->frames [i] = sample->frames [i].method;
+
+	FoldedSample *existing = (FoldedSample *) g_hash_table_lookup (folded_samples, folded);
+
+	if (existing) {
+		existing->hits++;
+
+		// The existing entry already holds references to the same methods.
+		for (int i = 0; i < folded->count; ++i) {
+			if (folded->frames [i])
+				dec_method_ref_count (folded->frames [i]);
+		}
+
+		g_free (folded);
+	} else {
+		g_hash_table_add (folded_samples, folded);
+		add_code_pointer ((uintptr_t) folded->ip);
+	}
+
+	if (g_hash_table_size (folded_samples) >= FOLDED_SAMPLES_MAX || sample->time - folded_samples_flush_time >= FOLDED_SAMPLES_FLUSH_INTERVAL)
+		flush_folded_samples ();
+}
+
 static gboolean
 handle_dumper_queue_entry (void)
 {
@@ -3080,6 +3204,13 @@ handle_dumper_queue_entry (void)
 			}
 		}
 
+		if (log_config.sample_aggregate) {
+			fold_sample_hit (sample);
+			mono_thread_hazardous_try_free (sample, reuse_sample_hit);
+			dump_unmanaged_coderefs ();
+			return FALSE;
+		}
+
 		ENTER_LOG (&sample_hits_ctr, logbuffer,
 			EVENT_SIZE /* event */ +
 			LEB128_SIZE /* tid */ +
@@ -3140,8 +3271,10 @@ dumper_thread (void *arg)
 		 */
 		timedout = mono_os_sem_timedwait (&log_profiler.dumper_queue_sem, 1000, MONO_SEM_FLAGS_NONE) == MONO_SEM_TIMEDWAIT_RET_TIMEDOUT;
 		MONO_EXIT_GC_SAFE;
-		if (timedout)
+		if (timedout) {
+			flush_folded_samples ();
 			send_log_unsafe (FALSE);
+		}
 
 		handle_dumper_queue_entry ();
 
@@ -3151,6 +3284,8 @@ dumper_thread (void *arg)
 	/* Drain any remaining entries on shutdown. */
 	while (handle_dumper_queue_entry ());
 
+	flush_folded_samples ();
+
 	profiler_thread_end (thread, &log_profiler.dumper_thread_exited, TRUE);
 
 	return NULL;
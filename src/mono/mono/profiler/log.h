@@ -9,7 +9,7 @@
 #define LOG_HEADER_ID 0x4D505A01
 #define LOG_VERSION_MAJOR 3
 #define LOG_VERSION_MINOR 0
-#define LOG_DATA_VERSION 17
+#define LOG_DATA_VERSION 18
 
 /*
  * Changes in major/minor versions:
@@ -86,6 +86,7 @@
                added TYPE_AOT_ID
                removed TYPE_SAMPLE_UBIN
  * version 17: MONO_PROFILER_CODE_BUFFER_{METHOD_TRAMPOLINE,MONITOR} are no longer produced
+ * version 18: added TYPE_SAMPLE_FOLDED
  */
 
 /*
@@ -300,7 +301,7 @@
  *
  * type sample format
  * type: TYPE_SAMPLE
- * exinfo: one of TYPE_SAMPLE_HIT, TYPE_SAMPLE_USYM, TYPE_SAMPLE_COUNTERS_DESC, TYPE_SAMPLE_COUNTERS
+ * exinfo: one of TYPE_SAMPLE_HIT, TYPE_SAMPLE_USYM, TYPE_SAMPLE_COUNTERS_DESC, TYPE_SAMPLE_COUNTERS, TYPE_SAMPLE_FOLDED
  * if exinfo == TYPE_SAMPLE_HIT
  * 	[thread: sleb128] thread id as difference from ptr_base
  * 	[count: uleb128] number of following instruction addresses
@@ -308,6 +309,12 @@
  *	[mbt_count: uleb128] number of managed backtrace frames
  *	[method: sleb128]* MonoMethod* as a pointer difference from the last such
  * 	pointer or the buffer method_base (the first such method can be also indentified by ip, but this is not necessarily true)
+ * if exinfo == TYPE_SAMPLE_FOLDED
+ * 	[hits: uleb128] number of samples with this instruction pointer and backtrace since the last flush
+ * 	[ip: sleb128] instruction pointer as difference from ptr_base
+ *	[mbt_count: uleb128] number of managed backtrace frames
+ *	[method: sleb128]* MonoMethod* as a pointer difference from the last such
+ * 	pointer or the buffer method_base
  * if exinfo == TYPE_SAMPLE_USYM
  * 	[address: sleb128] symbol address as a difference from ptr_base
  * 	[size: uleb128] symbol size (may be 0 if unknown)
@@ -400,6 +407,7 @@ enum {
 	TYPE_SAMPLE_USYM          = 1 << 4,
 	TYPE_SAMPLE_COUNTERS_DESC = 3 << 4,
 	TYPE_SAMPLE_COUNTERS      = 4 << 4,
+	TYPE_SAMPLE_FOLDED        = 5 << 4,
 	/* extended type for TYPE_RUNTIME */
 	TYPE_JITHELPER = 1 << 4,
 	/* extended type for TYPE_META */
@@ -518,6 +526,9 @@ typedef struct {
 	// Maximum number of SampleHit structures. We'll drop samples if this number is not sufficient.
 	int max_allocated_sample_hits;
 
+	// Whether to aggregate identical sample hits and periodically write them as TYPE_SAMPLE_FOLDED events.
+	gboolean sample_aggregate;
+
 	// Sample mode. Only used at startup.
 	MonoProfilerSampleMode sampling_mode;
 
@@ -2936,6 +2936,28 @@ decode_buffer (ProfContext *ctx)
 						}
 					}
 				}
+			} else if (subtype == TYPE_SAMPLE_FOLDED) {
+				int i;
+				uint64_t tdiff = decode_uleb128 (p + 1, &p);
+				LOG_TIME (time_base, tdiff);
+				time_base += tdiff;
+				uint64_t hits = decode_uleb128 (p, &p);
+				uintptr_t ip = ptr_base + decode_sleb128 (p, &p);
+				if ((time_base >= time_from && time_base < time_to)) {
+					for (uint64_t h = 0; h < hits; ++h)
+						add_stat_sample (SAMPLE_CYCLES, ip);
+				}
+				if (debug)
+					fprintf (outfile, "folded sample, %" PRIu64 " hits at %p\n", hits, (void*)ip);
+				int count = decode_uleb128 (p, &p);
+				for (i = 0; i < count; ++i) {
+					MethodDesc *method;
+					int64_t ptrdiff = decode_sleb128 (p, &p);
+					method_base += ptrdiff;
+					method = lookup_method (method_base);
+					if (debug)
+						fprintf (outfile, "folded sample bt %d: %s\n", i, method->name);
+				}
 			} else if (subtype == TYPE_SAMPLE_USYM) {
 				/* un unmanaged symbol description */
 				uintptr_t addr;
@@ -3845,6 +3867,7 @@ dump_stats (void)
 	DUMP_EVENT_STAT (TYPE_SAMPLE, TYPE_SAMPLE_UBIN);
 	DUMP_EVENT_STAT (TYPE_SAMPLE, TYPE_SAMPLE_COUNTERS_DESC);
 	DUMP_EVENT_STAT (TYPE_SAMPLE, TYPE_SAMPLE_COUNTERS);
+	DUMP_EVENT_STAT (TYPE_SAMPLE, TYPE_SAMPLE_FOLDED);
 
 	DUMP_EVENT_STAT (TYPE_RUNTIME, TYPE_JITHELPER);
 
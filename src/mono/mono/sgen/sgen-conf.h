@@ -104,6 +104,12 @@ typedef target_mword SgenDescriptor;
 #endif
 
 #if defined (HOST_WASM) || defined(TARGET_WASM)
+/*
+ * The multithreaded browser runtime can run the sgen workers on web workers, so that
+ * marking and sweeping the major heap doesn't block the UI thread. This is opt-in with
+ * MONO_GC_PARAMS=major=marksweep-conc,concurrent-sweep, since the workers come out of
+ * the app's pthread pool, which has to be sized for them.
+ */
 #define DEFAULT_MAJOR SGEN_MAJOR_SERIAL
 #define DEFAULT_SWEEP_MODE SGEN_SWEEP_SERIAL
 #elif defined(HAVE_CONC_GC_AS_DEFAULT)
@@ -249,10 +255,27 @@ typedef target_mword SgenDescriptor;
 
 #define SGEN_PAUSE_MODE_MAX_PAUSE_MARGIN 0.5f
 
+/*
+ * If more than this ratio of the nursery size is promoted by a minor collection, the
+ * dynamic nursery is grown, giving short lived objects more time to die before they
+ * would get promoted. Growth is still subject to the pause time limits.
+ */
+#define SGEN_DEFAULT_NURSERY_GROW_SURVIVAL_RATIO 0.15
+
+#define SGEN_MIN_NURSERY_GROW_SURVIVAL_RATIO 0.01
+#define SGEN_MAX_NURSERY_GROW_SURVIVAL_RATIO 1.0
+
 /*
  * In practice, for nurseries smaller than this, the parallel minor tends to be
  * ineffective, even leading to regressions. Avoid using it for smaller nurseries.
  */
 #define SGEN_PARALLEL_MINOR_MIN_NURSERY_SIZE (1 << 24)
 
+/*
+ * Card table scanning during a minor grows with the major heap rather than with the
+ * nursery. With a major heap at least this big the parallel minor is used whatever the
+ * nursery size, unless changed through `minor-par-min-major-size`.
+ */
+#define SGEN_PARALLEL_MINOR_MIN_MAJOR_HEAP_SIZE ((mword)1 << 30)
+
 #endif
@@ -221,6 +221,10 @@ static gboolean whole_heap_check_before_collection = FALSE;
 static gboolean remset_consistency_checks = FALSE;
 /* If set, do parallel copy/clear of remset */
 static gboolean remset_copy_clear_par = FALSE;
+/* With minor=simple-par, nursery size from which the minor collection goes parallel */
+static mword parallel_minor_min_nursery_size = SGEN_PARALLEL_MINOR_MIN_NURSERY_SIZE;
+/* With minor=simple-par, major heap size from which the minor collection goes parallel, whatever the nursery size */
+static mword parallel_minor_min_major_heap_size = SGEN_PARALLEL_MINOR_MIN_MAJOR_HEAP_SIZE;
 /* If set, do a mod union consistency check before each finishing collection pause */
 static gboolean mod_union_consistency_check = FALSE;
 /* If set, check whether mark bits are consistent after major collections */
@@ -248,6 +252,7 @@ static gboolean precleaning_enabled = TRUE;
 static gboolean dynamic_nursery = FALSE;
 static size_t min_nursery_size = 0;
 static size_t max_nursery_size = 0;
+static double nursery_grow_survival_ratio = SGEN_DEFAULT_NURSERY_GROW_SURVIVAL_RATIO;
 
 #ifdef HEAVY_STATISTICS
 guint64 stat_objects_alloced_degraded = 0;
@@ -1017,9 +1022,10 @@ alloc_nursery (gboolean dynamic, size_t min_size, size_t max_size)
 
 	if (dynamic) {
 		if (!min_size)
-			min_size = SGEN_DEFAULT_NURSERY_MIN_SIZE;
+			min_size = MIN (SGEN_DEFAULT_NURSERY_MIN_SIZE, max_size ? max_size : SGEN_DEFAULT_NURSERY_MAX_SIZE);
 		if (!max_size)
-			max_size = SGEN_DEFAULT_NURSERY_MAX_SIZE;
+			max_size = MAX (SGEN_DEFAULT_NURSERY_MAX_SIZE, min_size);
+		SGEN_ASSERT (0, min_size <= max_size, "The minimum nursery size can't exceed the maximum.");
 	} else {
 		SGEN_ASSERT (0, min_size == max_size, "We can't have nursery ranges for static configuration.");
 		if (!min_size)
@@ -1778,6 +1784,20 @@ enqueue_scan_from_roots_jobs (SgenGrayQueue *gc_thread_gray_queue, char *heap_st
 	sgen_workers_enqueue_deferred_job (sgen_current_collection_generation, &sfej->scan_job.job, is_parallel);
 }
 
+/*
+ * The parallel minor pays off once there is enough to copy out of the nursery or enough
+ * cards to scan in the major heap and LOS, the remembered set growing with the old generation.
+ */
+static gboolean
+use_parallel_minor (void)
+{
+	if (sgen_nursery_size >= parallel_minor_min_nursery_size)
+		return TRUE;
+	if (sgen_major_collector.get_num_major_sections () * sgen_major_collector.section_size + sgen_los_memory_usage >= parallel_minor_min_major_heap_size)
+		return TRUE;
+	return FALSE;
+}
+
 /*
  * Perform a nursery collection.
  *
@@ -1798,6 +1818,8 @@ collect_nursery (const char *reason, gboolean is_overflow)
 	guint64 major_scan_start = time_minor_scan_major_blocks;
 	guint64 los_scan_start = time_minor_scan_los;
 	guint64 finish_gray_start = time_minor_finish_gray_stack;
+	mword promoted_start = sgen_total_promoted_size;
+	gboolean high_survival;
 
 	if (disable_minor_collections)
 		return TRUE;
@@ -1810,7 +1832,7 @@ collect_nursery (const char *reason, gboolean is_overflow)
 	object_ops_nopar = sgen_get_concurrent_collection_in_progress ()
 				? &sgen_minor_collector.serial_ops_with_concurrent_major
 				: &sgen_minor_collector.serial_ops;
-	if (sgen_minor_collector.is_parallel && sgen_nursery_size >= SGEN_PARALLEL_MINOR_MIN_NURSERY_SIZE) {
+	if (sgen_minor_collector.is_parallel && use_parallel_minor ()) {
 		object_ops_par = sgen_get_concurrent_collection_in_progress ()
 					? &sgen_minor_collector.parallel_ops_with_concurrent_major
 					: &sgen_minor_collector.parallel_ops;
@@ -1946,17 +1968,23 @@ collect_nursery (const char *reason, gboolean is_overflow)
 		sgen_check_remset_consistency ();
 
 
+	/*
+	 * A high survival rate means objects don't have enough time to die before
+	 * they get promoted, so we try to grow the nursery, within the pause time limits.
+	 */
+	high_survival = (sgen_total_promoted_size - promoted_start) > (mword)(sgen_nursery_size * nursery_grow_survival_ratio);
+
 	if (sgen_max_pause_time) {
 		int duration;
 
 		TV_GETTIME (btv);
 		duration = (int)(TV_ELAPSED (last_minor_collection_start_tv, btv) / 10000);
 		if (duration > (sgen_max_pause_time * sgen_max_pause_margin))
-			sgen_resize_nursery (TRUE);
+			sgen_resize_nursery (TRUE, FALSE);
 		else
-			sgen_resize_nursery (FALSE);
+			sgen_resize_nursery (FALSE, high_survival);
 	} else {
-			sgen_resize_nursery (FALSE);
+			sgen_resize_nursery (FALSE, high_survival);
 	}
 
 	/*
@@ -3294,6 +3322,35 @@ parse_double_in_interval (const char *env_var, const char *opt_name, const char
 	return TRUE;
 }
 
+static gboolean
+parse_nursery_size (const char *env_var, const char *opt_name, const char *opt, size_t *result)
+{
+	size_t val;
+
+	if (!*opt || !mono_gc_parse_environment_string_extract_number (opt, &val)) {
+		sgen_env_var_error (env_var, "Using default value.", "`%s` must be an integer.", opt_name);
+		return FALSE;
+	}
+	if ((val & (val - 1))) {
+		sgen_env_var_error (env_var, "Using default value.", "`%s` must be a power of two.", opt_name);
+		return FALSE;
+	}
+	if (val < SGEN_MAX_NURSERY_WASTE) {
+		sgen_env_var_error (env_var, "Using default value.",
+				"`%s` must be at least %d bytes.", opt_name, SGEN_MAX_NURSERY_WASTE);
+		return FALSE;
+	}
+#ifdef SGEN_MAX_NURSERY_SIZE
+	if (val > SGEN_MAX_NURSERY_SIZE) {
+		sgen_env_var_error (env_var, "Using default value.",
+				"`%s` must be smaller than %" PRId64 " bytes.", opt_name, SGEN_MAX_NURSERY_SIZE);
+		return FALSE;
+	}
+#endif
+	*result = val;
+	return TRUE;
+}
+
 static SgenMinor
 parse_sgen_minor (const char *opt)
 {
@@ -3600,29 +3657,37 @@ sgen_gc_init (void)
 			if (g_str_has_prefix (opt, "nursery-size=")) {
 				size_t val;
 				opt = strchr (opt, '=') + 1;
-				if (*opt && mono_gc_parse_environment_string_extract_number (opt, &val)) {
-					if ((val & (val - 1))) {
-						sgen_env_var_error (MONO_GC_PARAMS_NAME, "Using default value.", "`nursery-size` must be a power of two.");
-						continue;
-					}
-
-					if (val < SGEN_MAX_NURSERY_WASTE) {
-						sgen_env_var_error (MONO_GC_PARAMS_NAME, "Using default value.",
-								"`nursery-size` must be at least %d bytes.", SGEN_MAX_NURSERY_WASTE);
-						continue;
-					}
-#ifdef SGEN_MAX_NURSERY_SIZE
-					if (val > SGEN_MAX_NURSERY_SIZE) {
-						sgen_env_var_error (MONO_GC_PARAMS_NAME, "Using default value.",
-								"`nursery-size` must be smaller than %" PRId64 " bytes.", SGEN_MAX_NURSERY_SIZE);
-						continue;
-					}
-#endif
+				if (parse_nursery_size (MONO_GC_PARAMS_NAME, "nursery-size", opt, &val)) {
 					min_nursery_size = max_nursery_size = val;
 					dynamic_nursery = FALSE;
-				} else {
-					sgen_env_var_error (MONO_GC_PARAMS_NAME, "Using default value.", "`nursery-size` must be an integer.");
-					continue;
+				}
+				continue;
+			}
+			if (g_str_has_prefix (opt, "min-nursery-size=") || g_str_has_prefix (opt, "max-nursery-size=")) {
+				gboolean is_min = g_str_has_prefix (opt, "min-");
+				size_t val;
+				opt = strchr (opt, '=') + 1;
+				if (sgen_minor_collector.is_split) {
+					sgen_env_var_error (MONO_GC_PARAMS_NAME, "Ignoring.",
+							"`%s` not supported with split-nursery.", is_min ? "min-nursery-size" : "max-nursery-size");
+				} else if (parse_nursery_size (MONO_GC_PARAMS_NAME, is_min ? "min-nursery-size" : "max-nursery-size", opt, &val)) {
+					/* A nursery size range implies a dynamic nursery */
+					if (!dynamic_nursery)
+						min_nursery_size = max_nursery_size = 0;
+					if (is_min)
+						min_nursery_size = val;
+					else
+						max_nursery_size = val;
+					dynamic_nursery = TRUE;
+				}
+				continue;
+			}
+			if (g_str_has_prefix (opt, "nursery-grow-survival-ratio=")) {
+				double val;
+				opt = strchr (opt, '=') + 1;
+				if (parse_double_in_interval (MONO_GC_PARAMS_NAME, "nursery-grow-survival-ratio", opt,
+						SGEN_MIN_NURSERY_GROW_SURVIVAL_RATIO, SGEN_MAX_NURSERY_GROW_SURVIVAL_RATIO, &val)) {
+					nursery_grow_survival_ratio = val;
 				}
 				continue;
 			}
@@ -3676,6 +3741,31 @@ sgen_gc_init (void)
 				continue;
 			}
 
+			if (g_str_has_prefix (opt, "minor-par-min-nursery-size=")) {
+				size_t val;
+				opt = strchr (opt, '=') + 1;
+				if (!sgen_minor_collector.is_parallel)
+					sgen_env_var_error (MONO_GC_PARAMS_NAME, "Ignoring.",
+							"`minor-par-min-nursery-size` only applies to minor=simple-par.");
+				else if (*opt && mono_gc_parse_environment_string_extract_number (opt, &val))
+					parallel_minor_min_nursery_size = val;
+				else
+					sgen_env_var_error (MONO_GC_PARAMS_NAME, "Using default value.", "`minor-par-min-nursery-size` must be an integer.");
+				continue;
+			}
+			if (g_str_has_prefix (opt, "minor-par-min-major-size=")) {
+				size_t val;
+				opt = strchr (opt, '=') + 1;
+				if (!sgen_minor_collector.is_parallel)
+					sgen_env_var_error (MONO_GC_PARAMS_NAME, "Ignoring.",
+							"`minor-par-min-major-size` only applies to minor=simple-par.");
+				else if (*opt && mono_gc_parse_environment_string_extract_number (opt, &val))
+					parallel_minor_min_major_heap_size = val;
+				else
+					sgen_env_var_error (MONO_GC_PARAMS_NAME, "Using default value.", "`minor-par-min-major-size` must be an integer.");
+				continue;
+			}
+
 			if (!strcmp (opt, "remset-copy-clear-par")) {
 				if (!sgen_minor_collector.is_parallel)
 					sgen_env_var_error (MONO_GC_PARAMS_NAME, "Using default value.",
@@ -3704,12 +3794,15 @@ sgen_gc_init (void)
 			fprintf (stderr, "  soft-heap-limit=n (where N is an integer, possibly with a k, m or a g suffix)\n");
 			fprintf (stderr, "  mode=MODE (where MODE is 'balanced', 'throughput' or 'pause[:N]' and N is maximum pause in milliseconds)\n");
 			fprintf (stderr, "  nursery-size=N (where N is an integer, possibly with a k, m or a g suffix)\n");
+			fprintf (stderr, "  min-nursery-size=N, max-nursery-size=N (bounds for the dynamic nursery, where N is an integer, possibly with a k, m or a g suffix)\n");
 			fprintf (stderr, "  major=COLLECTOR (where COLLECTOR is `marksweep', `marksweep-conc', `marksweep-par')\n");
 			fprintf (stderr, "  minor=COLLECTOR (where COLLECTOR is `simple' or `split')\n");
 			fprintf (stderr, "  wbarrier=WBARRIER (where WBARRIER is `remset' or `cardtable')\n");
 			fprintf (stderr, "  [no-]cementing\n");
 			fprintf (stderr, "  [no-]dynamic-nursery\n");
 			fprintf (stderr, "  remset-copy-clear-par\n");
+			fprintf (stderr, "  minor-par-min-nursery-size=N (where N is an integer, possibly with a k, m or a g suffix)\n");
+			fprintf (stderr, "  minor-par-min-major-size=N (where N is an integer, possibly with a k, m or a g suffix)\n");
 			if (sgen_major_collector.print_gc_param_usage)
 				sgen_major_collector.print_gc_param_usage ();
 			if (sgen_minor_collector.print_gc_param_usage)
@@ -3718,6 +3811,7 @@ sgen_gc_init (void)
 			fprintf (stderr, " Experimental options:\n");
 			fprintf (stderr, "  save-target-ratio=R (where R must be between %.2f - %.2f).\n", SGEN_MIN_SAVE_TARGET_RATIO, SGEN_MAX_SAVE_TARGET_RATIO);
 			fprintf (stderr, "  default-allowance-ratio=R (where R must be between %.2f - %.2f).\n", SGEN_MIN_ALLOWANCE_NURSERY_SIZE_RATIO, SGEN_MAX_ALLOWANCE_NURSERY_SIZE_RATIO);
+			fprintf (stderr, "  nursery-grow-survival-ratio=R (where R must be between %.2f - %.2f).\n", SGEN_MIN_NURSERY_GROW_SURVIVAL_RATIO, SGEN_MAX_NURSERY_GROW_SURVIVAL_RATIO);
 			fprintf (stderr, "\n");
 
 			usage_printed = TRUE;
@@ -3728,6 +3822,14 @@ sgen_gc_init (void)
 	if (params_opts)
 		g_free (params_opts);
 
+	if (dynamic_nursery && min_nursery_size && max_nursery_size && min_nursery_size > max_nursery_size) {
+		sgen_env_var_error (MONO_GC_PARAMS_NAME, "Using default values.", "`min-nursery-size` must not be larger than `max-nursery-size`.");
+		min_nursery_size = max_nursery_size = 0;
+	} else if (!dynamic_nursery && min_nursery_size != max_nursery_size) {
+		sgen_env_var_error (MONO_GC_PARAMS_NAME, "Using default value.", "Nursery size ranges require a dynamic nursery.");
+		min_nursery_size = max_nursery_size = 0;
+	}
+
 	alloc_nursery (dynamic_nursery, min_nursery_size, max_nursery_size);
 
 	sgen_pinning_init ();
@@ -986,7 +986,7 @@ void sgen_los_mark_mod_union_card (GCObject *mono_obj, void **ptr);
 void sgen_clear_nursery_fragments (void);
 void sgen_nursery_allocator_prepare_for_pinning (void);
 void sgen_nursery_allocator_set_nursery_bounds (char *nursery_start, size_t min_size, size_t max_size);
-void sgen_resize_nursery (gboolean need_shrink);
+void sgen_resize_nursery (gboolean need_shrink, gboolean need_grow);
 mword sgen_build_nursery_fragments (GCMemSection *nursery_section);
 void sgen_init_nursery_allocator (void);
 void sgen_nursery_allocator_init_heavy_stats (void);
@@ -860,7 +860,19 @@ set_sweep_state (int new_, int expected)
 static gboolean ensure_block_is_checked_for_sweeping (guint32 block_index, gboolean wait, gboolean *have_checked);
 
 static SgenThreadPoolJob * volatile sweep_job;
-static SgenThreadPoolJob * volatile sweep_blocks_job;
+/* Background sweep of the blocks left unswept by the lazy sweep, split between the sweep threads */
+static SgenThreadPoolJob * volatile sweep_blocks_jobs [SGEN_THREADPOOL_MAX_NUM_THREADS];
+static volatile gint32 sweep_blocks_jobs_pending;
+static int sweep_threads = 1;
+
+typedef struct {
+	SgenThreadPoolJob job;
+	int job_index;
+	int job_split_count;
+	int block_count;
+} SweepBlocksJob;
+
+static void get_block_range_for_job (int job_index, int job_split_count, int block_count, int *start, int *end);
 
 static void
 major_finish_sweep_checking (void)
@@ -1741,18 +1753,25 @@ ensure_block_is_checked_for_sweeping (guint32 block_index, gboolean wait, gboole
 static void
 sweep_blocks_job_func (void *thread_data_untyped, SgenThreadPoolJob *job)
 {
-	volatile gpointer *slot;
+	SweepBlocksJob *job_data = (SweepBlocksJob*)job;
 	MSBlockInfo *bl;
+	int first_block, last_block, index;
 
-	SGEN_ARRAY_LIST_FOREACH_SLOT (&allocated_blocks, slot) {
-		bl = BLOCK_UNTAG (*slot);
+	/*
+	 * Blocks the allocator or a nursery collection already needed are swept by then,
+	 * sweep_block () skips them.
+	 */
+	get_block_range_for_job (job_data->job_index, job_data->job_split_count, job_data->block_count, &first_block, &last_block);
+	for (index = first_block; index < last_block; ++index) {
+		bl = BLOCK_UNTAG (*sgen_array_list_get_slot (&allocated_blocks, index));
 		if (bl)
 			sweep_block (bl);
-	} SGEN_ARRAY_LIST_END_FOREACH_SLOT;
+	}
 
 	mono_memory_write_barrier ();
 
-	sweep_blocks_job = NULL;
+	sweep_blocks_jobs [job_data->job_index] = NULL;
+	mono_atomic_dec_i32 (&sweep_blocks_jobs_pending);
 }
 
 static void
@@ -1799,8 +1818,18 @@ MONO_RESTORE_WARNING
 	 * the next major we need all blocks to be swept anyway.
 	 */
 	if (concurrent_sweep && lazy_sweep) {
-		sweep_blocks_job = sgen_thread_pool_job_alloc ("sweep_blocks", sweep_blocks_job_func, sizeof (SgenThreadPoolJob));
-		sgen_thread_pool_job_enqueue (sweep_pool_context, sweep_blocks_job);
+		int i;
+		SGEN_ASSERT (0, !sweep_blocks_jobs_pending, "We haven't finished the last background sweep?");
+		sweep_blocks_jobs_pending = sweep_threads;
+		for (i = 0; i < sweep_threads; i++) {
+			SweepBlocksJob *sbj = (SweepBlocksJob*)sgen_thread_pool_job_alloc ("sweep_blocks", sweep_blocks_job_func, sizeof (SweepBlocksJob));
+			sbj->job_index = i;
+			sbj->job_split_count = sweep_threads;
+			sbj->block_count = (int)(allocated_blocks.next_slot / sweep_threads);
+			sweep_blocks_jobs [i] = &sbj->job;
+		}
+		for (i = 0; i < sweep_threads; i++)
+			sgen_thread_pool_job_enqueue (sweep_pool_context, sweep_blocks_jobs [i]);
 	}
 
 	sweep_finish ();
@@ -1961,7 +1990,7 @@ major_start_nursery_collection (void)
 	old_num_major_sections = num_major_sections;
 
 	/* Compact the block list if it hasn't been compacted in a while and nobody is using it */
-	if (compact_blocks && !sweep_in_progress () && !sweep_blocks_job && !sgen_get_concurrent_collection_in_progress ()) {
+	if (compact_blocks && !sweep_in_progress () && !sweep_blocks_jobs_pending && !sgen_get_concurrent_collection_in_progress ()) {
 		/*
 		 * We support null elements in the array but do regular compaction to avoid
 		 * excessive traversal of the array and to facilitate splitting into well
@@ -2070,13 +2099,16 @@ major_start_major_collection (void)
 
 	if (lazy_sweep && concurrent_sweep) {
 		/*
-		 * sweep_blocks_job is created before sweep_finish, which we wait for above
-		 * (major_finish_sweep_checking). After the end of sweep, if we don't have
-		 * sweep_blocks_job set, it means that it has already been run.
+		 * sweep_blocks_jobs are created before sweep_finish, which we wait for above
+		 * (major_finish_sweep_checking). After the end of sweep, if a job isn't set
+		 * anymore, it means that it has already been run.
 		 */
-		SgenThreadPoolJob *job = sweep_blocks_job;
-		if (job)
-			sgen_thread_pool_job_wait (sweep_pool_context, job);
+		int i;
+		for (i = 0; i < sweep_threads; i++) {
+			SgenThreadPoolJob *job = sweep_blocks_jobs [i];
+			if (job)
+				sgen_thread_pool_job_wait (sweep_pool_context, job);
+		}
 	}
 
 	if (lazy_sweep && !concurrent_sweep)
@@ -2396,6 +2428,15 @@ major_handle_gc_param (const char *opt)
 		concurrent_sweep = FALSE;
 #endif
 		return TRUE;
+	} else if (g_str_has_prefix (opt, "sweep-threads=")) {
+		const char *arg = strchr (opt, '=') + 1;
+		int threads = atoi (arg);
+		if (threads < 1 || threads > SGEN_THREADPOOL_MAX_NUM_THREADS) {
+			fprintf (stderr, "sweep-threads must be an integer in the range 1-%d.\n", SGEN_THREADPOOL_MAX_NUM_THREADS);
+			exit (1);
+		}
+		sweep_threads = threads;
+		return TRUE;
 	}
 
 	return FALSE;
@@ -2409,6 +2450,7 @@ major_print_gc_param_usage (void)
 			"  evacuation-threshold=P (where P is a percentage, an integer in 0-100)\n"
 			"  (no-)lazy-sweep\n"
 			"  (no-)concurrent-sweep\n"
+			"  sweep-threads=N (where N is the number of background sweep threads, an integer in 1-8)\n"
 			);
 }
 
@@ -2775,6 +2817,12 @@ static void
 post_param_init (SgenMajorCollector *collector)
 {
 	collector->sweeps_lazily = lazy_sweep;
+
+#ifndef DISABLE_SGEN_MAJOR_MARKSWEEP_CONC
+	/* Created once the parameters are known, `concurrent-sweep` and `sweep-threads` can change it */
+	if (concurrent_sweep)
+		sweep_pool_context = sgen_thread_pool_create_context (lazy_sweep ? sweep_threads : 1, NULL, NULL, NULL, NULL, NULL);
+#endif
 }
 
 /*
@@ -2995,9 +3043,6 @@ sgen_marksweep_init_internal (SgenMajorCollector *collector, gboolean is_concurr
 		sgen_workers_create_context (GENERATION_OLD, mono_cpu_limit ());
 	else if (is_concurrent)
 		sgen_workers_create_context (GENERATION_OLD, 1);
-
-	if (concurrent_sweep)
-		sweep_pool_context = sgen_thread_pool_create_context (1, NULL, NULL, NULL, NULL, NULL);
 #endif
 }
 
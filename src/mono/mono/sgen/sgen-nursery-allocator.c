@@ -916,7 +916,7 @@ sgen_nursery_allocator_set_nursery_bounds (char *start, size_t min_size, size_t
 }
 
 void
-sgen_resize_nursery (gboolean need_shrink)
+sgen_resize_nursery (gboolean need_shrink, gboolean need_grow)
 {
 	size_t major_size;
 
@@ -926,19 +926,21 @@ sgen_resize_nursery (gboolean need_shrink)
 	major_size = sgen_major_collector.get_num_major_sections () * sgen_major_collector.section_size + sgen_los_memory_usage;
 	/*
 	 * We attempt to use a larger nursery size, as long as it doesn't
-	 * exceed a certain percentage of the major heap.
+	 * exceed a certain percentage of the major heap, or if too much of
+	 * the nursery survived the last collection. We don't shrink because
+	 * of the major heap size while the survival rate is high.
 	 *
 	 * FIXME
 	 * Commit memory when expanding and release it when shrinking (which
 	 * would only be possible if there aren't any pinned objects in the
 	 * section).
 	 */
-	if ((sgen_nursery_size * 2) < (major_size / SGEN_DEFAULT_ALLOWANCE_NURSERY_SIZE_RATIO) &&
+	if (((sgen_nursery_size * 2) < (major_size / SGEN_DEFAULT_ALLOWANCE_NURSERY_SIZE_RATIO) || need_grow) &&
 			(sgen_nursery_size * 2) <= sgen_nursery_max_size && !need_shrink) {
 		if ((sgen_nursery_section->end_data - sgen_nursery_section->data) == sgen_nursery_size)
 			sgen_nursery_section->end_data += sgen_nursery_size;
 		sgen_nursery_size *= 2;
-	} else if ((sgen_nursery_size > (major_size / SGEN_DEFAULT_ALLOWANCE_NURSERY_SIZE_RATIO) || need_shrink) &&
+	} else if (((sgen_nursery_size > (major_size / SGEN_DEFAULT_ALLOWANCE_NURSERY_SIZE_RATIO) && !need_grow) || need_shrink) &&
 			(sgen_nursery_size / 2) >= sgen_nursery_min_size) {
 		sgen_nursery_size /= 2;
 	}
@@ -26,9 +26,9 @@
  * we don't need the tag field and don't have to use 64 bit CAS.
  *
  * Descriptors are stored in two locations: The partial queue and the
- * active field.  They can only be in at most one of those at one time.
+ * active fields.  They can only be in at most one of those at one time.
  * If a thread wants to allocate, it needs to get a descriptor.  It
- * tries the active descriptor first, CASing it to NULL.  If that
+ * tries its active descriptor first, CASing it to NULL.  If that
  * doesn't work, it gets a descriptor out of the partial queue.  Once it
  * has the descriptor it owns it because it is not referenced anymore.
  * It allocates a slot and then gives the descriptor back (unless it is
@@ -59,6 +59,12 @@
  * the superblock to the descriptor, so we only need one word of
  * metadata per superblock.
  *
+ * Unlike in Michael's allocator, each allocator has several active
+ * fields and a thread only uses the one its stack address hashes to,
+ * so that many threads allocating from the same size class don't all
+ * CAS the same word.  We don't use thread-local caches because slots
+ * are also allocated from signal handlers and freed on other threads.
+ *
  * FIXME: Having more than one allocator per size class is probably
  * buggy because it was never tested.
  */
@@ -119,6 +125,24 @@ sb_header_for_addr (gpointer addr, size_t block_size)
 	return (gpointer)(((size_t)addr) & (~(block_size - 1)));
 }
 
+static MONO_ALWAYS_INLINE Descriptor * volatile *
+active_for_current_thread (MonoLockFreeAllocator *heap)
+{
+#if LOCK_FREE_ALLOC_ACTIVE_SLOTS == 1
+	return (Descriptor * volatile *)&heap->active [0];
+#else
+	/*
+	 * Thread stacks are disjoint, so any stack address identifies the
+	 * thread.  Dropping the low bits keeps a thread on the same slot
+	 * regardless of its call depth, and the multiplicative hash spreads
+	 * stacks that are a power of two apart.
+	 */
+	gsize stack_addr = (gsize)&heap;
+	guint32 hash = (guint32)(stack_addr >> 16) * 2654435761u;
+	return (Descriptor * volatile *)&heap->active [hash % LOCK_FREE_ALLOC_ACTIVE_SLOTS];
+#endif
+}
+
 /* Taken from SGen */
 
 static unsigned long
@@ -326,6 +350,31 @@ heap_put_partial (Descriptor *desc)
 	list_put_partial (desc);
 }
 
+/*
+ * Gives an owned partial descriptor back, either to the thread's active
+ * field or, if that is taken, to the partial queue.
+ */
+static void
+heap_put_active_or_partial (MonoLockFreeAllocator *heap, Descriptor *desc)
+{
+	if (mono_atomic_cas_ptr ((volatile gpointer *)active_for_current_thread (heap), desc, NULL) != NULL)
+		heap_put_partial (desc);
+}
+
+/*
+ * Tries to take ownership of desc by removing it from whichever active
+ * field it is in.
+ */
+static gboolean
+heap_take_active (MonoLockFreeAllocator *heap, Descriptor *desc)
+{
+	for (int i = 0; i < LOCK_FREE_ALLOC_ACTIVE_SLOTS; ++i) {
+		if (mono_atomic_cas_ptr ((volatile gpointer *)&heap->active [i], NULL, desc) == desc)
+			return TRUE;
+	}
+	return FALSE;
+}
+
 static gboolean
 set_anchor (Descriptor *desc, Anchor old_anchor, Anchor new_anchor)
 {
@@ -338,14 +387,15 @@ set_anchor (Descriptor *desc, Anchor old_anchor, Anchor new_anchor)
 static gpointer
 alloc_from_active_or_partial (MonoLockFreeAllocator *heap)
 {
+	Descriptor * volatile *active = active_for_current_thread (heap);
 	Descriptor *desc;
 	Anchor old_anchor, new_anchor;
 	gpointer addr;
 
  retry:
-	desc = heap->active;
+	desc = *active;
 	if (desc) {
-		if (mono_atomic_cas_ptr ((volatile gpointer *)&heap->active, NULL, desc) != desc)
+		if (mono_atomic_cas_ptr ((volatile gpointer *)active, NULL, desc) != desc)
 			goto retry;
 	} else {
 		desc = heap_get_partial (heap);
@@ -381,10 +431,8 @@ alloc_from_active_or_partial (MonoLockFreeAllocator *heap)
 	} while (!set_anchor (desc, old_anchor, new_anchor));
 
 	/* If the desc is partial we have to give it back. */
-	if (new_anchor.data.state == STATE_PARTIAL) {
-		if (mono_atomic_cas_ptr ((volatile gpointer *)&heap->active, desc, NULL) != NULL)
-			heap_put_partial (desc);
-	}
+	if (new_anchor.data.state == STATE_PARTIAL)
+		heap_put_active_or_partial (heap, desc);
 
 	return addr;
 }
@@ -422,7 +470,7 @@ alloc_from_new_sb (MonoLockFreeAllocator *heap)
 	mono_memory_write_barrier ();
 
 	/* Make it active or free it again. */
-	if (mono_atomic_cas_ptr ((volatile gpointer *)&heap->active, desc, NULL) == NULL) {
+	if (mono_atomic_cas_ptr ((volatile gpointer *)active_for_current_thread (heap), desc, NULL) == NULL) {
 		return desc->sb;
 	} else {
 		desc->anchor.data.state = STATE_EMPTY;
@@ -481,7 +529,7 @@ mono_lock_free_free (gpointer ptr, size_t block_size)
 	if (new_anchor.data.state == STATE_EMPTY) {
 		g_assert (old_anchor.data.state != STATE_EMPTY);
 
-		if (mono_atomic_cas_ptr ((volatile gpointer *)&heap->active, NULL, desc) == desc) {
+		if (heap_take_active (heap, desc)) {
 			/*
 			 * We own desc, check if it's still empty, in which case we retire it.
 			 * If it's partial we need to put it back either on the active slot or
@@ -490,9 +538,7 @@ mono_lock_free_free (gpointer ptr, size_t block_size)
 			if (desc->anchor.data.state == STATE_EMPTY) {
 				desc_retire (desc);
 			} else if (desc->anchor.data.state == STATE_PARTIAL) {
-				if (mono_atomic_cas_ptr ((volatile gpointer *)&heap->active, desc, NULL) != NULL)
-					heap_put_partial (desc);
-
+				heap_put_active_or_partial (heap, desc);
 			}
 		} else {
 			/*
@@ -509,8 +555,7 @@ mono_lock_free_free (gpointer ptr, size_t block_size)
 
 		g_assert (new_anchor.data.state == STATE_PARTIAL);
 
-		if (mono_atomic_cas_ptr ((volatile gpointer *)&desc->heap->active, desc, NULL) != NULL)
-			heap_put_partial (desc);
+		heap_put_active_or_partial (desc->heap, desc);
 	}
 }
 
@@ -586,11 +631,13 @@ descriptor_check_consistency (Descriptor *desc, gboolean print)
 gboolean
 mono_lock_free_allocator_check_consistency (MonoLockFreeAllocator *heap)
 {
-	Descriptor *active = heap->active;
 	Descriptor *desc;
-	if (active) {
-		g_assert (active->anchor.data.state == STATE_PARTIAL);
-		descriptor_check_consistency (active, FALSE);
+	for (int i = 0; i < LOCK_FREE_ALLOC_ACTIVE_SLOTS; ++i) {
+		Descriptor *active = heap->active [i];
+		if (active) {
+			g_assert (active->anchor.data.state == STATE_PARTIAL);
+			descriptor_check_consistency (active, FALSE);
+		}
 	}
 	while ((desc = (Descriptor*)mono_lock_free_queue_dequeue (&heap->sc->partial))) {
 		g_assert (desc->anchor.data.state == STATE_PARTIAL || desc->anchor.data.state == STATE_EMPTY);
@@ -615,6 +662,7 @@ void
 mono_lock_free_allocator_init_allocator (MonoLockFreeAllocator *heap, MonoLockFreeAllocSizeClass *sc, MonoMemAccountType account_type)
 {
 	heap->sc = sc;
-	heap->active = NULL;
+	for (int i = 0; i < LOCK_FREE_ALLOC_ACTIVE_SLOTS; ++i)
+		heap->active [i] = NULL;
 	heap->account_type = account_type;
 }
@@ -39,8 +39,18 @@ typedef struct {
 
 struct _MonoLockFreeAllocDescriptor;
 
+/*
+ * Number of active descriptors per allocator.  Threads are spread over
+ * them so that they don't all contend on the same CAS.
+ */
+#ifdef HOST_WASM
+#define LOCK_FREE_ALLOC_ACTIVE_SLOTS				1
+#else
+#define LOCK_FREE_ALLOC_ACTIVE_SLOTS				8
+#endif
+
 typedef struct {
-	struct _MonoLockFreeAllocDescriptor *active;
+	struct _MonoLockFreeAllocDescriptor *active [LOCK_FREE_ALLOC_ACTIVE_SLOTS];
 	MonoLockFreeAllocSizeClass *sc;
 	MonoMemAccountType account_type;
 } MonoLockFreeAllocator;
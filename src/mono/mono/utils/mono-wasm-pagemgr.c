@@ -44,7 +44,11 @@ static uint32_t
 	first_controlled_page_index = UINT32_MAX,
 	// The index of the last page we've allocated. Not all pages between this
 	//  and first_controlled_page_index belong to us, but scans can end here.
-	last_controlled_page_index = 0;
+	last_controlled_page_index = 0,
+	// No page before this one is free, so scans for free pages can start here
+	//  instead of at first_controlled_page_index. Long-running apps tend to
+	//  have a large run of pages in use at the front of the page table.
+	first_free_page_hint = UINT32_MAX;
 static uint8_t *prev_waste_start = NULL,
 	*prev_waste_end = NULL;
 
@@ -309,6 +313,23 @@ free_pages_initialized (uint32_t first_page, uint32_t page_count) {
 	// freeing FREE_ZEROED pages leaves them zeroed.
 	// freeing ALLOCATED or FREE_DIRTY pages makes them FREE_DIRTY.
 	transition_page_states (MWPM_ALLOCATED_TO_FREE, first_page, page_count);
+	if (first_page < first_free_page_hint)
+		first_free_page_hint = first_page;
+}
+
+// Counts the free pages at the very end of the range we control. New pages from
+//  sbrk() land right after them unless someone else called sbrk() in between.
+static uint32_t
+count_trailing_free_pages () {
+	uint32_t result = 0;
+	for (uint32_t i = last_controlled_page_index; i >= first_controlled_page_index; i--) {
+		if (!is_page_free (page_table[i]))
+			break;
+		result++;
+		if (i == 0)
+			break;
+	}
+	return result;
 }
 
 static uint32_t
@@ -398,7 +419,12 @@ find_n_free_pages (uint32_t page_count) {
 	// Start scanning from the beginning. This ensures we will try to grab small allocations
 	//  from the front of the page table, and large allocations from anywhere we can find.
 	// This does make scans slower, but other approaches I tried have much worse fragmentation.
-	uint32_t result = find_n_free_pages_in_range (first_controlled_page_index, last_controlled_page_index, page_count);
+	// Skipping the pages in front of first_free_page_hint doesn't change which pages are
+	//  found, since none of them are free.
+	uint32_t start_scan_where = first_controlled_page_index;
+	if ((first_free_page_hint != UINT32_MAX) && (first_free_page_hint > start_scan_where))
+		start_scan_where = first_free_page_hint;
+	uint32_t result = find_n_free_pages_in_range (start_scan_where, last_controlled_page_index, page_count);
 	return result;
 }
 
@@ -411,6 +437,7 @@ mwpm_init () {
 	void *first_controlled_page_address = acquire_new_pages_initialized (MWPM_MINIMUM_PAGE_COUNT);
 	g_assert (first_controlled_page_address);
 	first_controlled_page_index = first_page_from_address (first_controlled_page_address);
+	first_free_page_hint = first_controlled_page_index;
 }
 
 static inline void
@@ -438,7 +465,22 @@ mwpm_alloc_range (size_t size, uint8_t zeroed) {
 		first_existing_page = find_n_free_pages (page_count),
 		allocation_page_count = page_count;
 
-	// If we didn't find existing pages to service our alloc,
+	// If we didn't find existing pages to service our alloc, try to only grow the heap by
+	//  the pages that the free pages at the end of our range are missing. When nobody else
+	//  has called sbrk() in the meantime the new pages are adjacent to those, so e.g. a
+	//  freed SGen section at the end gets reused instead of being stranded.
+	if (first_existing_page == UINT32_MAX) {
+		uint32_t trailing_free_pages = count_trailing_free_pages ();
+		if ((trailing_free_pages > 0) && (trailing_free_pages < page_count)) {
+			uint32_t first_trailing_free_page = last_controlled_page_index - trailing_free_pages + 1,
+				missing_page_count = page_count - trailing_free_pages;
+			if (missing_page_count < MWPM_MINIMUM_PAGE_COUNT)
+				missing_page_count = MWPM_MINIMUM_PAGE_COUNT;
+			if (acquire_new_pages_initialized (missing_page_count))
+				first_existing_page = find_n_free_pages_in_range (first_trailing_free_page, last_controlled_page_index, page_count);
+		}
+	}
+
 	if (first_existing_page == UINT32_MAX) {
 		// g_print ("mwpm could not find %u free pages\n", page_count);
 		if (allocation_page_count < MWPM_MINIMUM_PAGE_COUNT)
@@ -446,8 +488,6 @@ mwpm_alloc_range (size_t size, uint8_t zeroed) {
 		// Ensure we have space for the whole allocation
 		void *start_of_new_pages = acquire_new_pages_initialized (allocation_page_count);
 		if (start_of_new_pages) {
-			// FIXME: Scan backwards from the new allocation to look for free pages
-			//  before it that we can use to reduce fragmentation
 			result = start_of_new_pages;
 		} else {
 #ifdef MWPM_LOGGING
@@ -465,6 +505,9 @@ mwpm_alloc_range (size_t size, uint8_t zeroed) {
 
 	uint32_t first_result_page = first_page_from_address (result);
 	transition_page_states (zeroed ? MWPM_FREE_TO_ALLOCATED_ZEROED : MWPM_FREE_TO_ALLOCATED, first_result_page, page_count);
+	// If we just took the first free page, the next free page can only come after this range
+	if (first_result_page == first_free_page_hint)
+		first_free_page_hint = first_result_page + page_count;
 
 #ifdef MWPM_LOGGING
 	g_print ("mwpm allocated %u bytes at %u\n", size, (uint32_t)result);
@@ -73,6 +73,7 @@ DEFINE_BOOL(interp_pgo_recording, "interp-pgo-recording", FALSE, "Record interpr
 DEFINE_BOOL(wasm_gc_safepoints, "wasm-gc-safepoints", FALSE, "Use GC safepoints on WASM")
 #endif
 DEFINE_BOOL(interp_pgo_logging, "interp-pgo-logging", FALSE, "Log messages when interpreter PGO optimizes a method or updates its table")
+DEFINE_INT(interp_pgo_sequences, "interp-pgo-sequences", 0, "Record adjacent opcode pairs and triples of tiered methods and print the N most frequent ones at shutdown")
 DEFINE_BOOL(interp_codegen_timing, "interp-codegen-timing", FALSE, "Measure time spent generating interpreter code and log it periodically")
 
 #if HOST_BROWSER
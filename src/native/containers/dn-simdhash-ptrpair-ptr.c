@@ -1,7 +1,9 @@
 // Licensed to the .NET Foundation under one or more agreements.
 // The .NET Foundation licenses this file to you under the MIT license.
 
+#ifndef NO_CONFIG_H
 #include <dn-config.h>
+#endif
 #include "dn-simdhash.h"
 
 #include "dn-simdhash-utils.h"
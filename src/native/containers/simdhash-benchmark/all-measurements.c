@@ -7,6 +7,8 @@
 #include <inttypes.h>
 #include <stdio.h>
 #include <assert.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "../dn-vector.h"
 #include "../dn-simdhash.h"
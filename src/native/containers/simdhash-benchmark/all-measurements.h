@@ -2,6 +2,9 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 
 #include "ghashtable.h"
+#include "../dn-list.h"
+#include "../dn-queue.h"
+#include "../dn-umap.h"
 
 #ifndef MEASUREMENTS_IMPLEMENTATION
 #define MEASUREMENTS_IMPLEMENTATION 1
@@ -11,6 +14,11 @@
 
 static dn_simdhash_u32_ptr_t *random_u32s_hash;
 static dn_vector_t *sequential_u32s, *random_u32s, *random_unused_u32s;
+// Keys shaped like the ones the runtime actually uses: heap pointers that are
+//  aligned and clustered, pairs of them, and type-name-like strings
+static void *pointer_keys[INNER_COUNT], *unused_pointer_keys[INNER_COUNT];
+static dn_ptrpair_t ptrpair_keys[INNER_COUNT];
+static char *string_keys[INNER_COUNT];
 
 // rand() isn't guaranteed to give 32 random bits on all targets, so
 //  use xoshiro seeded with 4 known integers
@@ -73,6 +81,33 @@ retry2: {
         dn_vector_push_back(random_unused_u32s, key);
 }
     }
+
+    // Allocations of 16-128 bytes in a single region, looked up in random order
+    uintptr_t address = (uintptr_t)0x10000000u;
+    for (uint32_t i = 0; i < INNER_COUNT; i++) {
+        address += 16 * (1 + (random_uint() % 8));
+        pointer_keys[i] = (void *)address;
+    }
+    for (uint32_t i = 0; i < INNER_COUNT; i++) {
+        address += 16 * (1 + (random_uint() % 8));
+        unused_pointer_keys[i] = (void *)address;
+    }
+    for (uint32_t i = INNER_COUNT - 1; i > 0; i--) {
+        uint32_t j = random_uint() % (i + 1);
+        void *temp = pointer_keys[i];
+        pointer_keys[i] = pointer_keys[j];
+        pointer_keys[j] = temp;
+    }
+
+    for (uint32_t i = 0; i < INNER_COUNT; i++) {
+        ptrpair_keys[i].first = pointer_keys[i];
+        ptrpair_keys[i].second = pointer_keys[(i * 7) % (INNER_COUNT)];
+
+        char buffer[128];
+        int length = snprintf(buffer, sizeof(buffer), "System.Namespace%u.Type%u`%u", random_uint() % 64, i, random_uint() % 3);
+        string_keys[i] = malloc(length + 1);
+        memcpy(string_keys[i], buffer, length + 1);
+    }
 }
 
 
@@ -132,6 +167,99 @@ static void destroy_instance_ght (void *data) {
     g_hash_table_destroy((GHashTable *)data);
 }
 
+static void * create_instance_ptr_ptr () {
+    if (!random_u32s)
+        init_data();
+
+    return dn_simdhash_ptr_ptr_new(INNER_COUNT, NULL);
+}
+
+static void * create_instance_ptr_ptr_pointer_keys () {
+    dn_simdhash_ptr_ptr_t *result = create_instance_ptr_ptr();
+    for (int i = 0; i < INNER_COUNT; i++)
+        dn_simdhash_ptr_ptr_try_add(result, pointer_keys[i], (void *)(size_t)i);
+    return result;
+}
+
+static void * create_instance_ptrpair_ptr_pointer_pairs () {
+    if (!random_u32s)
+        init_data();
+
+    dn_simdhash_ptrpair_ptr_t *result = dn_simdhash_ptrpair_ptr_new(INNER_COUNT, NULL);
+    for (int i = 0; i < INNER_COUNT; i++)
+        dn_simdhash_ptrpair_ptr_try_add(result, ptrpair_keys[i], (void *)(size_t)i);
+    return result;
+}
+
+static void * create_instance_string_ptr () {
+    if (!random_u32s)
+        init_data();
+
+    return dn_simdhash_string_ptr_new(INNER_COUNT, NULL);
+}
+
+static void * create_instance_string_ptr_type_names () {
+    dn_simdhash_string_ptr_t *result = create_instance_string_ptr();
+    for (int i = 0; i < INNER_COUNT; i++)
+        dn_simdhash_string_ptr_try_add(result, string_keys[i], (void *)(size_t)i);
+    return result;
+}
+
+static void * create_instance_umap () {
+    if (!random_u32s)
+        init_data();
+
+    return dn_umap_alloc();
+}
+
+static void * create_instance_umap_pointer_keys () {
+    dn_umap_t *result = create_instance_umap();
+    for (int i = 0; i < INNER_COUNT; i++)
+        dn_umap_insert(result, pointer_keys[i], (void *)(size_t)i);
+    return result;
+}
+
+static void destroy_instance_umap (void *data) {
+    dn_umap_free((dn_umap_t *)data);
+}
+
+static void * create_instance_vector () {
+    return dn_vector_alloc(sizeof(uint32_t));
+}
+
+static void * create_instance_vector_sequential () {
+    dn_vector_t *result = create_instance_vector();
+    for (uint32_t i = 0; i < INNER_COUNT; i++)
+        dn_vector_push_back(result, i);
+    return result;
+}
+
+static void destroy_instance_vector (void *data) {
+    dn_vector_free((dn_vector_t *)data);
+}
+
+static void * create_instance_list () {
+    if (!random_u32s)
+        init_data();
+
+    return dn_list_alloc();
+}
+
+static void destroy_instance_list (void *data) {
+    dn_list_free((dn_list_t *)data);
+}
+
+static void * create_instance_queue () {
+    if (!random_u32s)
+        init_data();
+
+    return dn_queue_alloc();
+}
+
+static void destroy_instance_queue (void *data) {
+    dn_queue_free((dn_queue_t *)data);
+}
+
 #endif // MEASUREMENTS_IMPLEMENTATION
 
 // These go outside the guard because we include this file multiple times.
@@ -217,3 +345,77 @@ MEASUREMENT(ght_find_missing_key, GHashTable *, create_instance_ght_random_value
         dn_simdhash_assert(g_hash_table_lookup(data, (gpointer)(size_t)key) == NULL);
     }
 })
+
+MEASUREMENT(dn_ptr_ptr_clear_then_fill_pointer_keys, dn_simdhash_ptr_ptr_t *, create_instance_ptr_ptr, destroy_instance, {
+    dn_simdhash_clear(data);
+    for (int i = 0; i < INNER_COUNT; i++)
+        dn_simdhash_assert(dn_simdhash_ptr_ptr_try_add(data, pointer_keys[i], (void *)(size_t)i));
+})
+
+MEASUREMENT(dn_ptr_ptr_find_pointer_keys, dn_simdhash_ptr_ptr_t *, create_instance_ptr_ptr_pointer_keys, destroy_instance, {
+    void *temp = NULL;
+    for (int i = 0; i < INNER_COUNT; i++)
+        dn_simdhash_assert(dn_simdhash_ptr_ptr_try_get_value(data, pointer_keys[i], &temp));
+})
+
+MEASUREMENT(dn_ptr_ptr_find_missing_pointer_key, dn_simdhash_ptr_ptr_t *, create_instance_ptr_ptr_pointer_keys, destroy_instance, {
+    void *temp = NULL;
+    for (int i = 0; i < INNER_COUNT; i++)
+        dn_simdhash_assert(!dn_simdhash_ptr_ptr_try_get_value(data, unused_pointer_keys[i], &temp));
+})
+
+MEASUREMENT(dn_ptrpair_ptr_find_pointer_pairs, dn_simdhash_ptrpair_ptr_t *, create_instance_ptrpair_ptr_pointer_pairs, destroy_instance, {
+    void *temp = NULL;
+    for (int i = 0; i < INNER_COUNT; i++)
+        dn_simdhash_assert(dn_simdhash_ptrpair_ptr_try_get_value(data, ptrpair_keys[i], &temp));
+})
+
+MEASUREMENT(dn_string_ptr_clear_then_fill_type_names, dn_simdhash_string_ptr_t *, create_instance_string_ptr, destroy_instance, {
+    dn_simdhash_clear(data);
+    for (int i = 0; i < INNER_COUNT; i++)
+        dn_simdhash_assert(dn_simdhash_string_ptr_try_add(data, string_keys[i], (void *)(size_t)i));
+})
+
+MEASUREMENT(dn_string_ptr_find_type_names, dn_simdhash_string_ptr_t *, create_instance_string_ptr_type_names, destroy_instance, {
+    void *temp = NULL;
+    for (int i = 0; i < INNER_COUNT; i++)
+        dn_simdhash_assert(dn_simdhash_string_ptr_try_get_value(data, string_keys[i], &temp));
+})
+
+MEASUREMENT(umap_clear_then_fill_pointer_keys, dn_umap_t *, create_instance_umap, destroy_instance_umap, {
+    dn_umap_clear(data);
+    for (int i = 0; i < INNER_COUNT; i++)
+        dn_simdhash_assert(dn_umap_insert(data, pointer_keys[i], (void *)(size_t)i).result);
+})
+
+MEASUREMENT(umap_find_pointer_keys, dn_umap_t *, create_instance_umap_pointer_keys, destroy_instance_umap, {
+    for (int i = 0; i < INNER_COUNT; i++)
+        dn_simdhash_assert(dn_umap_contains(data, pointer_keys[i]));
+})
+
+MEASUREMENT(vector_clear_then_push_back, dn_vector_t *, create_instance_vector, destroy_instance_vector, {
+    dn_vector_clear(data);
+    for (uint32_t i = 0; i < INNER_COUNT; i++)
+        dn_vector_push_back(data, i);
+})
+
+MEASUREMENT(vector_sum_sequential, dn_vector_t *, create_instance_vector_sequential, destroy_instance_vector, {
+    uint64_t sum = 0;
+    for (uint32_t i = 0; i < INNER_COUNT; i++)
+        sum += *dn_vector_index_t(data, uint32_t, i);
+    dn_simdhash_assert(sum == ((uint64_t)INNER_COUNT * (INNER_COUNT - 1)) / 2);
+})
+
+MEASUREMENT(list_push_back_then_pop_front, dn_list_t *, create_instance_list, destroy_instance_list, {
+    for (int i = 0; i < INNER_COUNT; i++)
+        dn_list_push_back(data, pointer_keys[i]);
+    while (!dn_list_empty(data))
+        dn_list_pop_front(data);
+})
+
+MEASUREMENT(queue_push_then_pop, dn_queue_t *, create_instance_queue, destroy_instance_queue, {
+    for (int i = 0; i < INNER_COUNT; i++)
+        dn_queue_push(data, pointer_keys[i]);
+    while (!dn_queue_empty(data))
+        dn_queue_pop(data);
+})
@@ -7,6 +7,7 @@
 #include <assert.h>
 #include <time.h>
 #include <string.h>
+#include <stdlib.h>
 
 #ifdef _MSC_VER
 #include <windows.h>
@@ -101,14 +102,37 @@ typedef struct {
     int argc;
     char **argv;
     int result;
+    // --csv: print one machine-readable line per measurement instead of the summary,
+    //  so results from different builds can be stored and compared
+    uint8_t csv;
 } main_args;
 
+// We keep the duration of every step so we can report percentiles
+#define MAX_STEPS 4096
+
+static int compare_int64 (const void *lhs, const void *rhs) {
+    int64_t l = *(const int64_t *)lhs, r = *(const int64_t *)rhs;
+    return (l > r) - (l < r);
+}
+
+// Nearest-rank percentile of a sorted array
+static int64_t percentile (const int64_t *sorted, int64_t count, int p) {
+    int64_t rank = (count * p + 99) / 100;
+    if (rank < 1)
+        rank = 1;
+    return sorted[rank - 1];
+}
+
 void foreach_measurement (const char *name, void *_info, void *_args) {
     measurement_info *info = _info;
     main_args *args = _args;
 
-    uint8_t match = args->argc <= 1;
+    uint8_t has_filter = 0, match = 0;
     for (int i = 1; i < args->argc; i++) {
+        if (strncmp(args->argv[i], "--", 2) == 0)
+            continue;
+
+        has_filter = 1;
 #ifdef _MSC_VER
         if (strstr(name, args->argv[i])) {
 #else
@@ -119,11 +143,13 @@ void foreach_measurement (const char *name, void *_info, void *_args) {
         }
     }
 
-    if (!match)
+    if (has_filter && !match)
         return;
 
-    printf("%s: ", name);
-    fflush(stdout);
+    if (!args->csv) {
+        printf("%s: ", name);
+        fflush(stdout);
+    }
 
     run_measurement(100, info->setup, info->func, info->teardown);
 
@@ -155,11 +181,15 @@ void foreach_measurement (const char *name, void *_info, void *_args) {
     // HACK: Reduce minor variation in iteration count
     necessary_iterations = next_power_of_two((uint32_t)necessary_iterations);
 
-    printf(
-        "Warmed %" PRId64 " time(s). Running %" PRId64 " iterations... ",
-        warmup_count, necessary_iterations
-    );
-    fflush(stdout);
+    if (!args->csv) {
+        printf(
+            "Warmed %" PRId64 " time(s). Running %" PRId64 " iterations... ",
+            warmup_count, necessary_iterations
+        );
+        fflush(stdout);
+    }
+
+    static int64_t step_durations[MAX_STEPS];
 
     do {
         int64_t step_duration = run_measurement(necessary_iterations, info->setup, info->func, info->teardown) - overhead;
@@ -168,19 +198,43 @@ void foreach_measurement (const char *name, void *_info, void *_args) {
             run_elapsed_min = step_duration;
         if (step_duration > run_elapsed_max)
             run_elapsed_max = step_duration;
+        step_durations[steps] = step_duration;
         steps++;
-    } while (get_100ns_ticks() < run_until);
+    } while ((get_100ns_ticks() < run_until) && (steps < MAX_STEPS));
+
+    qsort(step_durations, (size_t)steps, sizeof(int64_t), compare_int64);
 
-    double run_elapsed_average = (double)(run_elapsed_total) / steps / necessary_iterations / 100.0;
+    double run_elapsed_average = (double)(run_elapsed_total) / steps / necessary_iterations / 100.0,
+        run_elapsed_p50 = (double)percentile(step_durations, steps, 50) / necessary_iterations / 100.0,
+        run_elapsed_p90 = (double)percentile(step_durations, steps, 90) / necessary_iterations / 100.0,
+        run_elapsed_p99 = (double)percentile(step_durations, steps, 99) / necessary_iterations / 100.0;
 
     args->result = 0;
-    printf(
-        "%" PRId64 " step(s): avg %.3fns min %.3fns max %.3fns\n",
-        steps,
-        run_elapsed_average,
-        (double)run_elapsed_min / necessary_iterations / 100.0,
-        (double)run_elapsed_max / necessary_iterations / 100.0
-    );
+    if (args->csv) {
+        printf(
+            "%s,%" PRId64 ",%" PRId64 ",%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n",
+            name,
+            steps,
+            necessary_iterations,
+            run_elapsed_average,
+            (double)run_elapsed_min / necessary_iterations / 100.0,
+            run_elapsed_p50,
+            run_elapsed_p90,
+            run_elapsed_p99,
+            (double)run_elapsed_max / necessary_iterations / 100.0
+        );
+    } else {
+        printf(
+            "%" PRId64 " step(s): avg %.3fns min %.3fns p50 %.3fns p90 %.3fns p99 %.3fns max %.3fns\n",
+            steps,
+            run_elapsed_average,
+            (double)run_elapsed_min / necessary_iterations / 100.0,
+            run_elapsed_p50,
+            run_elapsed_p90,
+            run_elapsed_p99,
+            (double)run_elapsed_max / necessary_iterations / 100.0
+        );
+    }
     fflush(stdout);
 }
 
@@ -188,8 +242,16 @@ int main (int argc, char* argv[]) {
     init_measurements();
 
     main_args args = {
-        argc, argv, 1
+        argc, argv, 1, 0
     };
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--csv") == 0)
+            args.csv = 1;
+    }
+
+    if (args.csv)
+        printf("name,steps,iterations,avg_ns,min_ns,p50_ns,p90_ns,p99_ns,max_ns\n");
+
     dn_simdhash_string_ptr_foreach(all_measurements, foreach_measurement, &args);
 
     fflush(stdout);
@@ -1,2 +1,2 @@
-cl /GS- /O2 /std:c17 ./*.c ../dn-simdhash-u32-ptr.c ../dn-simdhash.c ../dn-vector.c ../dn-simdhash-string-ptr.c /DNO_CONFIG_H /DSIZEOF_VOID_P=8 /DNDEBUG /Fe:all-measurements.exe
+cl /GS- /O2 /std:c17 ./*.c ../dn-simdhash-u32-ptr.c ../dn-simdhash.c ../dn-vector.c ../dn-list.c ../dn-queue.c ../dn-umap.c ../dn-simdhash-string-ptr.c ../dn-simdhash-ptr-ptr.c ../dn-simdhash-ptrpair-ptr.c /DNO_CONFIG_H /I../.. /DSIZEOF_VOID_P=8 /DNDEBUG /Fe:all-measurements.exe
 ./all-measurements.exe
@@ -9,12 +9,49 @@ manifest_t manifest_t::read(reader_t& reader, const header_t& header)
 {
     manifest_t manifest;
 
+    manifest.files.reserve(header.num_embedded_files());
+    manifest.m_index.reserve(header.num_embedded_files());
     for (int32_t i = 0; i < header.num_embedded_files(); i++)
     {
         file_entry_t entry = file_entry_t::read(reader, header.major_version(), header.is_netcoreapp3_compat_mode());
-        manifest.files.push_back(std::move(entry));
         manifest.m_files_need_extraction |= entry.needs_extraction();
+
+        // The first entry for a path wins, same as a linear search would do
+        manifest.m_index.emplace(get_index_key(entry.relative_path()), manifest.files.size());
+        manifest.files.push_back(std::move(entry));
     }
 
     return manifest;
 }
+
+const file_entry_t* manifest_t::find(const pal::string_t& relative_path) const
+{
+    auto iter = m_index.find(get_index_key(relative_path));
+    if (iter == m_index.end())
+    {
+        return nullptr;
+    }
+
+    const file_entry_t& entry = files[iter->second];
+    assert(pal::pathcmp(entry.relative_path(), relative_path) == 0);
+    return &entry;
+}
+
+pal::string_t manifest_t::get_index_key(const pal::string_t& relative_path)
+{
+#if defined(_WIN32)
+    // Match pal::pathcmp, which only ignores the case of ASCII characters
+    pal::string_t key = relative_path;
+    for (pal::char_t& c : key)
+    {
+        if (c >= _X('A') && c <= _X('Z'))
+        {
+            c = c - _X('A') + _X('a');
+        }
+    }
+
+    return key;
+#else
+    return relative_path;
+#endif
+}
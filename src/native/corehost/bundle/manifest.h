@@ -5,6 +5,7 @@
 #define __MANIFEST_H__
 
 #include <list>
+#include <unordered_map>
 #include "file_entry.h"
 #include "header.h"
 
@@ -12,6 +13,9 @@ namespace bundle
 {
     // Bundle Manifest contains:
     //     Series of file entries (for each embedded file)
+    //
+    // The entries are indexed by relative path, since the host and the runtime
+    // probe the bundle for every assembly and native library they look for.
 
     class manifest_t
     {
@@ -25,13 +29,23 @@ namespace bundle
 
         static manifest_t read(reader_t &reader, const header_t &header);
 
+        // Returns the entry for the relative path, including disabled entries, or nullptr
+        const file_entry_t* find(const pal::string_t& relative_path) const;
+        file_entry_t* find(const pal::string_t& relative_path)
+        {
+            return const_cast<file_entry_t*>(static_cast<const manifest_t*>(this)->find(relative_path));
+        }
+
         bool files_need_extraction() const
         {
             return m_files_need_extraction;
         }
 
     private:
+        static pal::string_t get_index_key(const pal::string_t& relative_path);
+
         bool m_files_need_extraction;
+        std::unordered_map<pal::string_t, size_t> m_index;
     };
 }
 #endif // __MANIFEST_H__
@@ -50,16 +50,13 @@ StatusCode runner_t::extract()
 
 const file_entry_t*  runner_t::probe(const pal::string_t &relative_path) const
 {
-    for (const file_entry_t& entry : m_manifest.files)
+    const file_entry_t* entry = m_manifest.find(relative_path);
+    if (entry == nullptr || entry->is_disabled())
     {
-        if (entry.matches(relative_path))
-        {
-            assert(!entry.is_disabled());
-            return &entry;
-        }
+        return nullptr;
     }
 
-    return nullptr;
+    return entry;
 }
 
 bool runner_t::probe(const pal::string_t& relative_path, int64_t* offset, int64_t* size, int64_t* compressedSize) const
@@ -104,15 +101,13 @@ bool runner_t::locate(const pal::string_t& relative_path, pal::string_t& full_pa
 
 bool runner_t::disable(const pal::string_t& relative_path)
 {
-    for (file_entry_t& entry : m_manifest.files)
+    file_entry_t* entry = m_manifest.find(relative_path);
+    if (entry == nullptr || entry->is_disabled())
     {
-        if (entry.matches(relative_path))
-        {
-            entry.disable();
-            return true;
-        }
+        return false;
     }
 
-    return false;
+    entry->disable();
+    return true;
 }
 
@@ -3,6 +3,7 @@
 
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <error_codes.h>
@@ -11,6 +12,7 @@
 #include <utils.h>
 
 #include <corehost_context_contract.h>
+#include <host_runtime_contract.h>
 #include <hostpolicy.h>
 #include "corehost_init.h"
 #include "framework_info.h"
@@ -36,6 +38,9 @@ namespace
     // will block until the first context loads the runtime (or fails).
     std::mutex g_context_lock;
 
+    // Time at which hostfxr started activating the app, reported to the runtime's startup summary.
+    std::chrono::steady_clock::time_point g_activation_start_time;
+
     // Tracks the active host context. This is the context that was used to load and initialize hostpolicy and coreclr.
     // It will only be set once both hostpolicy and coreclr are loaded and initialized. Once set, it should not be changed.
     // This will remain set even if the context is closed through hostfxr_close. Since the context represents the active
@@ -483,6 +488,13 @@ namespace
             additional_properties.push_back(std::make_pair(_X("HOSTFXR_PATH"), fxr_path));
         }
 
+        if (startup_summary_enabled())
+        {
+            // Reported as a duration, the runtime doesn't use the same clock. hostpolicy appends its own phase.
+            auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - g_activation_start_time);
+            additional_properties.push_back(std::make_pair(_STRINGIFY(HOST_PROPERTY_STARTUP_PHASES), _X("hostfxr=") + pal::to_string(static_cast<int>(elapsed.count()))));
+        }
+
         const known_options opts_probe_path = known_options::additional_probing_path;
         std::vector<pal::string_t> spec_probe_paths = opts.count(opts_probe_path) ? opts.find(opts_probe_path)->second : std::vector<pal::string_t>();
         std::vector<pal::string_t> probe_realpaths = get_probe_realpaths(fx_definitions, spec_probe_paths);
@@ -553,6 +565,8 @@ int fx_muxer_t::execute(
     int32_t buffer_size,
     int32_t* required_buffer_size)
 {
+    g_activation_start_time = std::chrono::steady_clock::now();
+
     // Detect invocation mode
     host_mode_t mode = detect_operating_mode(host_info);
 
@@ -730,6 +744,8 @@ int fx_muxer_t::initialize_for_app(
         g_context_initializing.store(true);
     }
 
+    g_activation_start_time = std::chrono::steady_clock::now();
+
     host_mode_t mode = host_mode_t::apphost;
     pal::string_t hostpolicy_dir;
     std::unique_ptr<corehost_init_t> init;
@@ -283,6 +283,8 @@ namespace pal
     bool touch_file(const string_t& path);
     bool realpath(string_t* path, bool skip_error_logging = false);
     bool file_exists(const string_t& path);
+    // Returns the last write time and size of a file or directory, in platform-specific units
+    bool get_file_stamp(const string_t& path, uint64_t* last_write_time, uint64_t* size);
     inline bool directory_exists(const string_t& path) { return file_exists(path); }
     void readdir(const string_t& path, const string_t& pattern, std::vector<string_t>* list);
     void readdir(const string_t& path, std::vector<string_t>* list);
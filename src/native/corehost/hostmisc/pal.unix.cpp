@@ -988,6 +988,25 @@ bool pal::file_exists(const pal::string_t& path)
     return (::access(path.c_str(), F_OK) == 0);
 }
 
+bool pal::get_file_stamp(const pal::string_t& path, uint64_t* last_write_time, uint64_t* size)
+{
+    struct stat buf;
+    if (::stat(path.c_str(), &buf) != 0)
+    {
+        return false;
+    }
+
+    // In nanoseconds, so that a file replaced within the same second gets a different stamp
+#if defined(__APPLE__)
+    const struct timespec& mtime = buf.st_mtimespec;
+#else
+    const struct timespec& mtime = buf.st_mtim;
+#endif
+    *last_write_time = static_cast<uint64_t>(mtime.tv_sec) * 1000000000 + static_cast<uint64_t>(mtime.tv_nsec);
+    *size = static_cast<uint64_t>(buf.st_size);
+    return true;
+}
+
 static void readdir(const pal::string_t& path, const pal::string_t& pattern, bool onlydirectories, std::vector<pal::string_t>* list)
 {
     assert(list != nullptr);
@@ -862,6 +862,19 @@ bool pal::file_exists(const string_t& path)
     return pal::realpath(&tmp, true);
 }
 
+bool pal::get_file_stamp(const string_t& path, uint64_t* last_write_time, uint64_t* size)
+{
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &data) == 0)
+    {
+        return false;
+    }
+
+    *last_write_time = (static_cast<uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime;
+    *size = (static_cast<uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+    return true;
+}
+
 static void readdir(const pal::string_t& path, const pal::string_t& pattern, bool onlydirectories, std::vector<pal::string_t>* list)
 {
     assert(list != nullptr);
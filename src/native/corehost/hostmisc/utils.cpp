@@ -277,6 +277,15 @@ bool multilevel_lookup_enabled()
     return multilevel_lookup;
 }
 
+/**
+* The host reports how long it took to the runtime's startup summary when DOTNET_StartupSummary is set to 1
+*/
+bool startup_summary_enabled()
+{
+    pal::string_t env_summary;
+    return pal::getenv(_X("DOTNET_StartupSummary"), &env_summary) && pal::xtoi(env_summary.c_str()) == 1;
+}
+
 void get_framework_and_sdk_locations(const pal::string_t& dotnet_dir, const bool disable_multilevel_lookup, std::vector<pal::string_t>* locations)
 {
     bool multilevel_lookup = disable_multilevel_lookup ? false : multilevel_lookup_enabled();
@@ -20,6 +20,20 @@ static pal::string_t normalize_dir_separator(const pal::string_t& path)
     return normalized_path;
 }
 
+bool probe_dir_cache_t::file_exists(const pal::string_t& path)
+{
+    pal::string_t dir = get_directory(path);
+    auto iter = m_dir_files.find(dir);
+    if (iter == m_dir_files.end())
+    {
+        std::vector<pal::string_t> files;
+        pal::readdir(dir, &files);
+        iter = m_dir_files.emplace(dir, std::unordered_set<pal::string_t>(files.begin(), files.end())).first;
+    }
+
+    return iter->second.count(get_filename(path)) != 0 || pal::file_exists(path);
+}
+
 // -----------------------------------------------------------------------------
 // Given a "base" directory, determine the resolved path for this file.
 //
@@ -33,12 +47,13 @@ static pal::string_t normalize_dir_separator(const pal::string_t& path)
 //    str  - (out parameter) If the method returns true, contains the file path for this deps entry
 //    search_options - Flags to instruct where to look for this deps entry
 //    found_in_bundle - (out parameter) True if the candidate is located within the single-file bundle.
+//    dir_cache - If not null, used to check the existence of the file on disk
 //
 // Returns:
 //    If the file exists in the path relative to the "base" directory within the
 //    single-file or on disk.
 
-bool deps_entry_t::to_path(const pal::string_t& base, const pal::string_t& ietf_dir, pal::string_t* str, uint32_t search_options, bool &found_in_bundle) const
+bool deps_entry_t::to_path(const pal::string_t& base, const pal::string_t& ietf_dir, pal::string_t* str, uint32_t search_options, bool &found_in_bundle, probe_dir_cache_t* dir_cache) const
 {
     pal::string_t& candidate = *str;
 
@@ -98,7 +113,8 @@ bool deps_entry_t::to_path(const pal::string_t& base, const pal::string_t& ietf_
     const pal::char_t* query_type = look_in_base ? _X("Local") : _X("Relative");
     if (search_options & deps_entry_t::search_options::file_existence)
     {
-        if (!pal::file_exists(candidate))
+        bool exists = dir_cache != nullptr ? dir_cache->file_exists(candidate) : pal::file_exists(candidate);
+        if (!exists)
         {
             trace::verbose(_X("    %s path query did not exist %s"), query_type, candidate.c_str());
             candidate.clear();
@@ -144,7 +160,7 @@ bool deps_entry_t::to_path(const pal::string_t& base, const pal::string_t& ietf_
 // Returns:
 //    If the file exists in the path relative to the "base" directory.
 //
-bool deps_entry_t::to_dir_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, bool& found_in_bundle) const
+bool deps_entry_t::to_dir_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, bool& found_in_bundle, probe_dir_cache_t* dir_cache) const
 {
     pal::string_t ietf_dir;
 
@@ -169,7 +185,7 @@ bool deps_entry_t::to_dir_path(const pal::string_t& base, pal::string_t* str, ui
 
     search_options |= deps_entry_t::search_options::look_in_base;
     search_options &= ~deps_entry_t::search_options::is_servicing;
-    return to_path(base, ietf_dir, str, search_options, found_in_bundle);
+    return to_path(base, ietf_dir, str, search_options, found_in_bundle, dir_cache);
 }
 
 // -----------------------------------------------------------------------------
@@ -184,11 +200,11 @@ bool deps_entry_t::to_dir_path(const pal::string_t& base, pal::string_t* str, ui
 // Returns:
 //    If the file exists in the path relative to the "base" directory.
 //
-bool deps_entry_t::to_rel_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options) const
+bool deps_entry_t::to_rel_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, probe_dir_cache_t* dir_cache) const
 {
     bool found_in_bundle;
     search_options &= ~deps_entry_t::search_options::look_in_base;
-    bool result = to_path(base, _X(""), str, search_options, found_in_bundle);
+    bool result = to_path(base, _X(""), str, search_options, found_in_bundle, dir_cache);
     assert(!found_in_bundle);
     return result;
 }
@@ -205,7 +221,7 @@ bool deps_entry_t::to_rel_path(const pal::string_t& base, pal::string_t* str, ui
 // Returns:
 //    If the file exists in the path relative to the "base" directory.
 //
-bool deps_entry_t::to_full_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options) const
+bool deps_entry_t::to_full_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, probe_dir_cache_t* dir_cache) const
 {
     str->clear();
 
@@ -228,5 +244,5 @@ bool deps_entry_t::to_full_path(const pal::string_t& base, pal::string_t* str, u
     }
 
     search_options &= ~deps_entry_t::search_options::look_in_bundle;
-    return to_rel_path(new_base, str, search_options);
+    return to_rel_path(new_base, str, search_options, dir_cache);
 }
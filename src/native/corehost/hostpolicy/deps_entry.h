@@ -7,6 +7,8 @@
 #include <iostream>
 #include <array>
 #include <vector>
+#include <unordered_map>
+#include <unordered_set>
 #include "pal.h"
 #include "version.h"
 
@@ -26,6 +28,18 @@ struct deps_asset_t
     version_t file_version;
 };
 
+// Caches the file names of the directories probed while resolving deps entries, so that
+// each directory is read once instead of checking every asset in it separately.
+class probe_dir_cache_t
+{
+public:
+    // Files missing from the listing are checked on disk, since the file system may be case-insensitive.
+    bool file_exists(const pal::string_t& path);
+
+private:
+    std::unordered_map<pal::string_t, std::unordered_set<pal::string_t>> m_dir_files;
+};
+
 struct deps_entry_t
 {
     enum asset_types
@@ -61,19 +75,19 @@ struct deps_entry_t
     bool is_rid_specific;
 
     // Given a "base" dir, yield the file path within this directory or single-file bundle.
-    bool to_dir_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, bool& found_in_bundle) const;
+    bool to_dir_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, bool& found_in_bundle, probe_dir_cache_t* dir_cache = nullptr) const;
 
     // Given a "base" dir, yield the relative path in the package layout or servicing directory.
-    bool to_rel_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options) const;
+    bool to_rel_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, probe_dir_cache_t* dir_cache = nullptr) const;
 
     // Given a "base" dir, yield the relative path with package name/version in the package layout or servicing location.
-    bool to_full_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options) const;
+    bool to_full_path(const pal::string_t& base, pal::string_t* str, uint32_t search_options, probe_dir_cache_t* dir_cache = nullptr) const;
 
 private:
     // Given a "base" dir, yield the filepath within this directory or relative to this directory based on "look_in_base"
     // flag in "search_options".
     // Returns a path within the single-file bundle, or a file on disk,
-    bool to_path(const pal::string_t& base, const pal::string_t& ietf_code, pal::string_t* str, uint32_t search_options, bool & found_in_bundle) const;
+    bool to_path(const pal::string_t& base, const pal::string_t& ietf_code, pal::string_t* str, uint32_t search_options, bool & found_in_bundle, probe_dir_cache_t* dir_cache) const;
 
 };
 
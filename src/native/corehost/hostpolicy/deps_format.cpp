@@ -41,6 +41,52 @@ namespace
         return path;
     }
 
+    // Drops the parts of the deps file the host never reads while it is parsed: compile-time
+    // information and the targets other than the runtime target. The runtime target is usually
+    // written before the targets, if it isn't all targets are kept.
+    class deps_member_filter_t : public json_parser_t::member_filter_t
+    {
+    public:
+        bool keep_member(const std::vector<pal::string_t>& path, const pal::char_t* name) override
+        {
+            switch (path.size())
+            {
+            case 1: // Root
+                return pal::strcmp(name, _X("compilationOptions")) != 0;
+            case 2: // Targets
+                return m_target_name.empty() || path[1] != _X("targets") || m_target_name == name;
+            case 4: // Packages of a target
+                return path[1] != _X("targets")
+                    || (pal::strcmp(name, _X("dependencies")) != 0 && pal::strcmp(name, _X("compile")) != 0);
+            default:
+                return true;
+            }
+        }
+
+        void on_string(const std::vector<pal::string_t>& path, const pal::string_t& name, const pal::char_t* value) override
+        {
+            // "runtimeTarget" is either the name of the target or an object with a "name" member
+            if ((path.size() == 1 && name == _X("runtimeTarget"))
+                || (path.size() == 2 && path[1] == _X("runtimeTarget") && name == _X("name")))
+            {
+                m_target_name = value;
+            }
+        }
+
+    private:
+        pal::string_t m_target_name;
+    };
+
+    // Only keeps the RID fallback graph
+    class rid_fallback_graph_filter_t : public json_parser_t::member_filter_t
+    {
+    public:
+        bool keep_member(const std::vector<pal::string_t>& path, const pal::char_t* name) override
+        {
+            return path.size() != 1 || pal::strcmp(name, _X("runtimes")) == 0;
+        }
+    };
+
     void populate_rid_fallback_graph(const json_parser_t::value_t& json, deps_json_t::rid_fallback_graph_t& rid_fallback_graph)
     {
         const auto& json_object = json.GetObject();
@@ -94,7 +140,8 @@ deps_json_t::rid_fallback_graph_t deps_json_t::get_rid_fallback_graph(const pal:
         return rid_fallback_graph;
 
     json_parser_t json;
-    if (!json.parse_file(deps_path_local))
+    rid_fallback_graph_filter_t filter;
+    if (!json.parse_file(deps_path_local, &filter))
         return rid_fallback_graph;
 
     populate_rid_fallback_graph(json.document(), rid_fallback_graph);
@@ -586,7 +633,8 @@ void deps_json_t::load(bool is_framework_dependent, std::function<void(const jso
     }
 
     json_parser_t json;
-    if (!json.parse_file(m_deps_file))
+    deps_member_filter_t filter;
+    if (!json.parse_file(m_deps_file, &filter))
         return;
 
     m_valid = true;
@@ -317,7 +317,7 @@ bool deps_resolver_t::probe_deps_entry(const deps_entry_t& entry, const pal::str
             // If the deps json has the package name and version, then someone has already done rid selection and
             // put the right asset in the dir. So checking just package name and version would suffice.
             // No need to check further for the exact asset relative sub path.
-            if (config.probe_deps_json->has_package(entry.library_name, entry.library_version) && entry.to_dir_path(config.probe_dir, candidate, search_options, found_in_bundle))
+            if (config.probe_deps_json->has_package(entry.library_name, entry.library_version) && entry.to_dir_path(config.probe_dir, candidate, search_options, found_in_bundle, &m_probe_dir_cache))
             {
                 assert(!found_in_bundle);
                 trace::verbose(_X("    Probed deps json and matched '%s'"), candidate->c_str());
@@ -332,7 +332,7 @@ bool deps_resolver_t::probe_deps_entry(const deps_entry_t& entry, const pal::str
             if (entry.is_rid_specific)
             {
                 // Look up rid specific assets in the rid folders.
-                if (entry.to_rel_path(deps_dir, candidate, search_options | deps_entry_t::search_options::look_in_bundle))
+                if (entry.to_rel_path(deps_dir, candidate, search_options | deps_entry_t::search_options::look_in_bundle, &m_probe_dir_cache))
                 {
                     trace::verbose(_X("    Probed deps dir and matched '%s'"), candidate->c_str());
                     return true;
@@ -341,7 +341,7 @@ bool deps_resolver_t::probe_deps_entry(const deps_entry_t& entry, const pal::str
             else
             {
                 // Non-rid assets, lookup in the published dir.
-                if (entry.to_dir_path(deps_dir, candidate, search_options | deps_entry_t::search_options::look_in_bundle, found_in_bundle))
+                if (entry.to_dir_path(deps_dir, candidate, search_options | deps_entry_t::search_options::look_in_bundle, found_in_bundle, &m_probe_dir_cache))
                 {
                     trace::verbose(_X("    Probed deps dir and matched '%s'"), candidate->c_str());
                     return true;
@@ -352,7 +352,7 @@ bool deps_resolver_t::probe_deps_entry(const deps_entry_t& entry, const pal::str
         }
         else
         {
-            if (entry.to_full_path(config.probe_dir, candidate, search_options | (config.is_servicing() ? deps_entry_t::search_options::is_servicing : 0)))
+            if (entry.to_full_path(config.probe_dir, candidate, search_options | (config.is_servicing() ? deps_entry_t::search_options::is_servicing : 0), &m_probe_dir_cache))
             {
                 trace::verbose(_X("    Probed package dir and matched '%s'"), candidate->c_str());
                 return true;
@@ -256,6 +256,9 @@ private:
 
     // File existence checks must be performed for probed paths.This will cause symlinks to be resolved.
     bool m_needs_file_existence_checks;
+
+    // Contents of the probed directories, used for the file existence checks
+    probe_dir_cache_t m_probe_dir_cache;
 };
 
 #endif // DEPS_RESOLVER_H
@@ -4,6 +4,7 @@
 #include "hostpolicy_context.h"
 #include <hostpolicy.h>
 #include <host_runtime_contract.h>
+#include <chrono>
 
 #include "deps_resolver.h"
 #include <error_codes.h>
@@ -148,13 +149,12 @@ bool hostpolicy_context_t::should_read_rid_fallback_graph(const hostpolicy_init_
     return false;
 }
 
-int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, const arguments_t &args, bool enable_breadcrumbs)
+int hostpolicy_context_t::resolve_dependencies(
+    const hostpolicy_init_t &hostpolicy_init,
+    const arguments_t &args,
+    const std::vector<pal::string_t> &shared_store_paths,
+    startup_cache::resolved_paths_t *resolved)
 {
-    application = args.managed_application;
-    host_mode = hostpolicy_init.host_mode;
-    host_path = hostpolicy_init.host_info.host_path;
-    breadcrumbs_enabled = enable_breadcrumbs;
-
     deps_json_t::rid_resolution_options_t rid_resolution_options
     {
         should_read_rid_fallback_graph(hostpolicy_init),
@@ -165,7 +165,7 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
         args,
         hostpolicy_init.fx_definitions,
         hostpolicy_init.additional_deps_serialized.c_str(),
-        shared_store::get_paths(hostpolicy_init.tfm, host_mode, host_path),
+        shared_store_paths,
         hostpolicy_init.probe_paths,
         rid_resolution_options,
         hostpolicy_init.is_framework_dependent
@@ -178,8 +178,6 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
         return StatusCode::ResolverInitFailure;
     }
 
-    probe_paths_t probe_paths;
-
     // Setup breadcrumbs.
     if (breadcrumbs_enabled)
     {
@@ -190,19 +188,90 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
         breadcrumbs.insert(policy_name);
         breadcrumbs.insert(policy_name + _X(",") + policy_version);
 
-        if (!resolver.resolve_probe_paths(&probe_paths, &breadcrumbs))
+        if (!resolver.resolve_probe_paths(&resolved->probe_paths, &breadcrumbs))
         {
             return StatusCode::ResolverResolveFailure;
         }
+
+        resolved->breadcrumbs.assign(breadcrumbs.cbegin(), breadcrumbs.cend());
     }
     else
     {
-        if (!resolver.resolve_probe_paths(&probe_paths, nullptr))
+        if (!resolver.resolve_probe_paths(&resolved->probe_paths, nullptr))
         {
             return StatusCode::ResolverResolveFailure;
         }
     }
 
+    if (resolver.is_framework_dependent())
+    {
+        // Use the root fx to define FX_DEPS_FILE
+        resolved->fx_deps = resolver.get_root_deps().get_deps_file();
+    }
+
+    pal::string_t& app_context_deps_str = resolved->app_context_deps;
+    resolver.enum_app_context_deps_files([&](const pal::string_t& deps_file)
+    {
+        if (!app_context_deps_str.empty())
+            app_context_deps_str += _X(';');
+
+        // For the application's .deps.json if this is single file, 3.1 backward compat
+        // then the path used internally is the bundle path, but externally we need to report
+        // the path to the extraction folder.
+        if (app_context_deps_str.empty() && bundle::info_t::is_single_file_bundle() && bundle::runner_t::app()->is_netcoreapp3_compat_mode())
+        {
+            pal::string_t deps_path = bundle::runner_t::app()->extraction_path();
+            append_path(&deps_path, get_filename(deps_file).c_str());
+            app_context_deps_str += deps_path;
+        }
+        else
+        {
+            app_context_deps_str += deps_file;
+        }
+    });
+
+    resolver.get_app_dir(&resolved->app_base);
+    resolved->probing_directories = resolver.get_lookup_probe_directories();
+
+    return StatusCode::Success;
+}
+
+int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, const arguments_t &args, bool enable_breadcrumbs)
+{
+    application = args.managed_application;
+    host_mode = hostpolicy_init.host_mode;
+    host_path = hostpolicy_init.host_info.host_path;
+    breadcrumbs_enabled = enable_breadcrumbs;
+
+    auto resolve_start_time = std::chrono::steady_clock::now();
+    std::vector<pal::string_t> shared_store_paths = shared_store::get_paths(hostpolicy_init.tfm, host_mode, host_path);
+
+    // The resolved paths only depend on the app, the frameworks and the probe directories,
+    // so they can come from the startup cache when none of those changed since the last run.
+    startup_cache::resolved_paths_t resolved;
+    pal::string_t startup_cache_key;
+    bool use_startup_cache = startup_cache::get_key(hostpolicy_init, args, shared_store_paths, breadcrumbs_enabled, &startup_cache_key);
+    if (use_startup_cache && startup_cache::try_load(startup_cache_key, &resolved))
+    {
+        breadcrumbs.insert(resolved.breadcrumbs.cbegin(), resolved.breadcrumbs.cend());
+    }
+    else
+    {
+        int rc = resolve_dependencies(hostpolicy_init, args, shared_store_paths, &resolved);
+        if (rc != StatusCode::Success)
+        {
+            return rc;
+        }
+
+        if (use_startup_cache)
+        {
+            startup_cache::save(startup_cache_key, resolved);
+        }
+    }
+
+    auto resolve_elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - resolve_start_time);
+
+    probe_paths_t& probe_paths = resolved.probe_paths;
     clr_path = probe_paths.coreclr;
     if (clr_path.empty() || !pal::realpath(&clr_path))
     {
@@ -242,44 +311,15 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
         probe_paths.tpa.append(corelib_path);
     }
 
-    pal::string_t fx_deps_str;
-    if (resolver.is_framework_dependent())
-    {
-        // Use the root fx to define FX_DEPS_FILE
-        fx_deps_str = resolver.get_root_deps().get_deps_file();
-    }
-
-    pal::string_t app_context_deps_str;
-    resolver.enum_app_context_deps_files([&](const pal::string_t& deps_file)
-    {
-        if (!app_context_deps_str.empty())
-            app_context_deps_str += _X(';');
-
-        // For the application's .deps.json if this is single file, 3.1 backward compat
-        // then the path used internally is the bundle path, but externally we need to report
-        // the path to the extraction folder.
-        if (app_context_deps_str.empty() && bundle::info_t::is_single_file_bundle() && bundle::runner_t::app()->is_netcoreapp3_compat_mode())
-        {
-            pal::string_t deps_path = bundle::runner_t::app()->extraction_path();
-            append_path(&deps_path, get_filename(deps_file).c_str());
-            app_context_deps_str += deps_path;
-        }
-        else
-        {
-            app_context_deps_str += deps_file;
-        }
-    });
-
     // Build properties for CoreCLR instantiation
-    pal::string_t app_base;
-    resolver.get_app_dir(&app_base);
+    const pal::string_t& app_base = resolved.app_base;
     coreclr_properties.add(common_property::TrustedPlatformAssemblies, probe_paths.tpa.c_str());
     coreclr_properties.add(common_property::NativeDllSearchDirectories, probe_paths.native.c_str());
     coreclr_properties.add(common_property::PlatformResourceRoots, probe_paths.resources.c_str());
     coreclr_properties.add(common_property::AppContextBaseDirectory, app_base.c_str());
-    coreclr_properties.add(common_property::AppContextDepsFiles, app_context_deps_str.c_str());
-    coreclr_properties.add(common_property::FxDepsFile, fx_deps_str.c_str());
-    coreclr_properties.add(common_property::ProbingDirectories, resolver.get_lookup_probe_directories().c_str());
+    coreclr_properties.add(common_property::AppContextDepsFiles, resolved.app_context_deps.c_str());
+    coreclr_properties.add(common_property::FxDepsFile, resolved.fx_deps.c_str());
+    coreclr_properties.add(common_property::ProbingDirectories, resolved.probing_directories.c_str());
     coreclr_properties.add(common_property::RuntimeIdentifier, get_runtime_id().c_str());
 
     bool set_app_paths = false;
@@ -294,7 +334,16 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
             set_app_paths = (pal::strcasecmp(hostpolicy_init.cfg_values[i].data(), _X("true")) == 0);
         }
 
-        if (!coreclr_properties.add(key, hostpolicy_init.cfg_values[i].c_str()))
+        // hostfxr only passes its startup phase when the startup summary is enabled, add the dependency resolution to it
+        pal::string_t startup_phases;
+        const pal::char_t *value = hostpolicy_init.cfg_values[i].c_str();
+        if (pal::strcmp(key, _STRINGIFY(HOST_PROPERTY_STARTUP_PHASES)) == 0)
+        {
+            startup_phases = hostpolicy_init.cfg_values[i] + _X(";hostpolicy=") + pal::to_string(static_cast<int>(resolve_elapsed.count()));
+            value = startup_phases.c_str();
+        }
+
+        if (!coreclr_properties.add(key, value))
         {
             log_duplicate_property_error(key);
             return StatusCode::LibHostDuplicateProperty;
@@ -11,6 +11,7 @@
 #include <corehost_context_contract.h>
 #include <host_runtime_contract.h>
 #include "hostpolicy_init.h"
+#include "startup_cache.h"
 
 struct hostpolicy_context_t
 {
@@ -32,6 +33,13 @@ public:
 
     int initialize(const hostpolicy_init_t &hostpolicy_init, const arguments_t &args, bool enable_breadcrumbs);
 
+private:
+    int resolve_dependencies(
+        const hostpolicy_init_t &hostpolicy_init,
+        const arguments_t &args,
+        const std::vector<pal::string_t> &shared_store_paths,
+        startup_cache::resolved_paths_t *resolved);
+
 public: // static
     static bool should_read_rid_fallback_graph(const hostpolicy_init_t &init);
 };
@@ -0,0 +1,286 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "startup_cache.h"
+#include "hostpolicy_context.h"
+#include <trace.h>
+#include <utils.h>
+#include "bundle/info.h"
+
+#define STARTUP_CACHE_DIR_ENV _X("DOTNET_HOST_STARTUP_CACHE_DIR")
+
+namespace
+{
+    const char cache_header[] = "dotnet-host-startup-cache/1";
+
+    // Appends the path and its timestamp to the key, missing paths are part of the key too
+    void append_path_stamp(pal::stringstream_t& key, const pal::string_t& path)
+    {
+        uint64_t last_write_time = 0;
+        uint64_t size = 0;
+        key << _X('|') << path;
+        if (pal::get_file_stamp(path, &last_write_time, &size))
+        {
+            key << _X('@') << last_write_time << _X(':') << size;
+        }
+        else
+        {
+            key << _X("@missing");
+        }
+    }
+
+    uint64_t hash_key(const pal::string_t& key)
+    {
+        // FNV-1a
+        uint64_t hash = 14695981039346656037ULL;
+        for (pal::char_t c : key)
+        {
+            hash ^= static_cast<uint64_t>(c);
+            hash *= 1099511628211ULL;
+        }
+
+        return hash;
+    }
+
+    bool get_cache_file_path(const pal::string_t& key, pal::string_t* path)
+    {
+        if (!pal::getenv(STARTUP_CACHE_DIR_ENV, path) || !pal::directory_exists(*path))
+        {
+            return false;
+        }
+
+        pal::char_t name[STRING_LENGTH("0123456789abcdef.cache") + 1];
+        pal::snwprintf(name, ARRAY_SIZE(name), _X("%016llx.cache"), static_cast<unsigned long long>(hash_key(key)));
+        append_path(path, name);
+        return true;
+    }
+
+    // The key only stamps the top level directories, so a file removed from a subdirectory, like the
+    // runtimes/<rid> directories of the app or the packages of a store, doesn't invalidate the cache.
+    // Check that every path in the list still exists instead.
+    bool all_paths_exist(const pal::string_t& paths)
+    {
+        pal::stringstream_t ss(paths);
+        pal::string_t path;
+        while (std::getline(ss, path, PATH_SEPARATOR))
+        {
+            if (!path.empty() && !pal::file_exists(path))
+            {
+                trace::verbose(_X("Startup cache entry [%s] no longer exists"), path.c_str());
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void append_line(std::vector<char>* contents, const pal::string_t& line)
+    {
+        std::vector<char> utf8;
+        pal::pal_utf8string(line, &utf8);
+
+        // pal_utf8string null-terminates the buffer
+        contents->insert(contents->end(), utf8.begin(), utf8.end() - 1);
+        contents->push_back('\n');
+    }
+}
+
+bool startup_cache::get_key(
+    const hostpolicy_init_t& init,
+    const arguments_t& args,
+    const std::vector<pal::string_t>& shared_store_paths,
+    bool breadcrumbs_enabled,
+    pal::string_t* key)
+{
+    pal::string_t cache_dir;
+    if (!pal::getenv(STARTUP_CACHE_DIR_ENV, &cache_dir) || cache_dir.empty())
+    {
+        return false;
+    }
+
+    // Single-file apps resolve against the bundle and the extraction directory, and additional
+    // deps files can come from anywhere, so don't try to validate those.
+    if (bundle::info_t::is_single_file_bundle() || !init.additional_deps_serialized.empty())
+    {
+        trace::verbose(_X("Startup cache is not supported for this app"));
+        return false;
+    }
+
+    pal::stringstream_t ss;
+    ss << _STRINGIFY(HOST_VERSION)
+        << _X('|') << static_cast<int>(init.host_mode)
+        << _X('|') << init.is_framework_dependent
+        << _X('|') << breadcrumbs_enabled
+        << _X('|') << hostpolicy_context_t::should_read_rid_fallback_graph(init)
+        << _X('|') << get_runtime_id()
+        << _X('|') << init.tfm
+        << _X('|') << args.managed_application;
+
+    // Adding or removing files in the app directory or a framework changes the directory timestamp,
+    // updating the app or a framework rewrites its .deps.json.
+    append_path_stamp(ss, args.app_root);
+    append_path_stamp(ss, args.deps_path);
+    for (size_t i = 1; i < init.fx_definitions.size(); ++i)
+    {
+        const fx_definition_t& fx = *init.fx_definitions[i];
+        pal::string_t fx_deps_file = fx.get_dir();
+        append_path(&fx_deps_file, (fx.get_name() + _X(".deps.json")).c_str());
+
+        ss << _X('|') << fx.get_name() << _X(',') << fx.get_found_version();
+        append_path_stamp(ss, fx.get_dir());
+        append_path_stamp(ss, fx_deps_file);
+    }
+
+    for (const pal::string_t& probe_path : init.probe_paths)
+    {
+        append_path_stamp(ss, probe_path);
+    }
+
+    for (const pal::string_t& shared_store_path : shared_store_paths)
+    {
+        append_path_stamp(ss, shared_store_path);
+    }
+
+    pal::string_t servicing;
+    if (pal::get_default_servicing_directory(&servicing))
+    {
+        append_path_stamp(ss, servicing);
+    }
+
+    *key = ss.str();
+
+    // The key is stored as a single line in the cache file
+    if (key->find(_X('\n')) != pal::string_t::npos)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+bool startup_cache::try_load(const pal::string_t& key, resolved_paths_t* resolved)
+{
+    pal::string_t cache_file;
+    if (!get_cache_file_path(key, &cache_file) || !pal::file_exists(cache_file))
+    {
+        return false;
+    }
+
+    size_t length = 0;
+    const char* data = static_cast<const char*>(pal::mmap_read(cache_file, &length));
+    if (data == nullptr)
+    {
+        return false;
+    }
+
+    std::vector<pal::string_t> lines;
+    size_t start = 0;
+    for (size_t i = 0; i < length; ++i)
+    {
+        if (data[i] == '\n')
+        {
+            pal::string_t line;
+            pal::clr_palstring(std::string(data + start, i - start).c_str(), &line);
+            lines.push_back(std::move(line));
+            start = i + 1;
+        }
+    }
+
+    pal::munmap(const_cast<char*>(data), length);
+
+    // Header, key and the fixed fields, followed by the breadcrumbs
+    const size_t fixed_lines = 10;
+    pal::string_t header;
+    pal::clr_palstring(cache_header, &header);
+    if (lines.size() < fixed_lines || lines[0] != header || lines[1] != key)
+    {
+        trace::verbose(_X("Ignoring stale startup cache [%s]"), cache_file.c_str());
+        return false;
+    }
+
+    resolved->probe_paths.tpa = lines[2];
+    resolved->probe_paths.native = lines[3];
+    resolved->probe_paths.resources = lines[4];
+    resolved->probe_paths.coreclr = lines[5];
+    resolved->app_base = lines[6];
+    resolved->app_context_deps = lines[7];
+    resolved->fx_deps = lines[8];
+    resolved->probing_directories = lines[9];
+    resolved->breadcrumbs.assign(lines.begin() + fixed_lines, lines.end());
+
+    if (!all_paths_exist(resolved->probe_paths.tpa) ||
+        !all_paths_exist(resolved->probe_paths.native) ||
+        !all_paths_exist(resolved->probe_paths.resources) ||
+        !all_paths_exist(resolved->probe_paths.coreclr))
+    {
+        trace::verbose(_X("Ignoring stale startup cache [%s]"), cache_file.c_str());
+        return false;
+    }
+
+    trace::info(_X("Using startup cache [%s]"), cache_file.c_str());
+    return true;
+}
+
+void startup_cache::save(const pal::string_t& key, const resolved_paths_t& resolved)
+{
+    pal::string_t cache_file;
+    if (!get_cache_file_path(key, &cache_file))
+    {
+        return;
+    }
+
+    // Every value is stored as a single line
+    std::vector<const pal::string_t*> values =
+    {
+        &resolved.probe_paths.tpa,
+        &resolved.probe_paths.native,
+        &resolved.probe_paths.resources,
+        &resolved.probe_paths.coreclr,
+        &resolved.app_base,
+        &resolved.app_context_deps,
+        &resolved.fx_deps,
+        &resolved.probing_directories,
+    };
+    for (const pal::string_t& breadcrumb : resolved.breadcrumbs)
+    {
+        values.push_back(&breadcrumb);
+    }
+
+    for (const pal::string_t* value : values)
+    {
+        if (value->find(_X('\n')) != pal::string_t::npos)
+        {
+            return;
+        }
+    }
+
+    std::vector<char> contents;
+    pal::string_t header;
+    pal::clr_palstring(cache_header, &header);
+    append_line(&contents, header);
+    append_line(&contents, key);
+    for (const pal::string_t* value : values)
+    {
+        append_line(&contents, *value);
+    }
+
+    // Write to a process-specific file first so concurrent launches never see a partial cache
+    pal::string_t tmp_file = cache_file + _X(".") + pal::to_string(pal::get_pid()) + _X(".tmp");
+    FILE* file = pal::file_open(tmp_file, _X("wb"));
+    if (file == nullptr)
+    {
+        trace::verbose(_X("Failed to create startup cache [%s]"), tmp_file.c_str());
+        return;
+    }
+
+    bool written = fwrite(contents.data(), 1, contents.size(), file) == contents.size();
+    written = (fclose(file) == 0) && written;
+    if (!written || pal::rename(tmp_file.c_str(), cache_file.c_str()) != 0)
+    {
+        trace::verbose(_X("Failed to write startup cache [%s]"), cache_file.c_str());
+        pal::remove(tmp_file.c_str());
+        return;
+    }
+
+    trace::info(_X("Wrote startup cache [%s]"), cache_file.c_str());
+}
@@ -0,0 +1,46 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef __STARTUP_CACHE_H__
+#define __STARTUP_CACHE_H__
+
+#include <pal.h>
+
+#include "args.h"
+#include "deps_resolver.h"
+#include "hostpolicy_init.h"
+
+// Opt-in on-disk cache of the dependency resolution results, enabled by setting
+// DOTNET_HOST_STARTUP_CACHE_DIR to a writable directory. Entries are keyed by the
+// host version, the app and framework locations and the timestamps of the app and
+// framework directories and their .deps.json files, so any change to them causes
+// a cache miss and the dependencies are resolved again. Changes further down in those
+// directories are caught by checking that the cached paths still exist.
+namespace startup_cache
+{
+    // Everything hostpolicy computes from the .deps.json files and the probe directories
+    struct resolved_paths_t
+    {
+        probe_paths_t probe_paths;
+        pal::string_t app_base;
+        pal::string_t app_context_deps;
+        pal::string_t fx_deps;
+        pal::string_t probing_directories;
+        std::vector<pal::string_t> breadcrumbs;
+    };
+
+    // Computes the cache key, returns false if the cache is disabled or can't be used for this app
+    bool get_key(
+        const hostpolicy_init_t& init,
+        const arguments_t& args,
+        const std::vector<pal::string_t>& shared_store_paths,
+        bool breadcrumbs_enabled,
+        pal::string_t* key);
+
+    bool try_load(const pal::string_t& key, resolved_paths_t* resolved);
+
+    // Failing to write the cache is not an error, the next run will just resolve again
+    void save(const pal::string_t& key, const resolved_paths_t& resolved);
+}
+
+#endif // __STARTUP_CACHE_H__
@@ -66,6 +66,166 @@ void get_line_column_from_offset(const char* data, uint64_t size, size_t offset,
     }
 }
 
+// Forwards the SAX events of the reader to the document, except for the object members
+// dropped by the filter and everything nested in them.
+class filtering_handler_t
+{
+public:
+    using ch_t = json_parser_t::document_t::Ch;
+
+    filtering_handler_t(json_parser_t::document_t& document, json_parser_t::member_filter_t& filter)
+        : m_document(document)
+        , m_filter(filter)
+        , m_skip_depth(0)
+        , m_skip_value(false) { }
+
+    bool Null() { return skip_value() || m_document.Null(); }
+    bool Bool(bool b) { return skip_value() || m_document.Bool(b); }
+    bool Int(int i) { return skip_value() || m_document.Int(i); }
+    bool Uint(unsigned i) { return skip_value() || m_document.Uint(i); }
+    bool Int64(int64_t i) { return skip_value() || m_document.Int64(i); }
+    bool Uint64(uint64_t i) { return skip_value() || m_document.Uint64(i); }
+    bool Double(double d) { return skip_value() || m_document.Double(d); }
+    bool RawNumber(const ch_t* str, rapidjson::SizeType length, bool copy) { return skip_value() || m_document.RawNumber(str, length, copy); }
+
+    bool String(const ch_t* str, rapidjson::SizeType length, bool copy)
+    {
+        if (skip_value())
+            return true;
+
+        if (!m_key.empty())
+            m_filter.on_string(m_path, m_key, str);
+
+        return m_document.String(str, length, copy);
+    }
+
+    bool StartObject()
+    {
+        if (skip_container_start())
+            return true;
+
+        enter();
+        return m_document.StartObject();
+    }
+
+    bool Key(const ch_t* str, rapidjson::SizeType length, bool copy)
+    {
+        if (m_skip_depth > 0)
+            return true;
+
+        if (!m_filter.keep_member(m_path, str))
+        {
+            m_skip_value = true;
+            return true;
+        }
+
+        m_key.assign(str, length);
+        m_member_counts.back()++;
+        return m_document.Key(str, length, copy);
+    }
+
+    bool EndObject(rapidjson::SizeType)
+    {
+        if (skip_container_end())
+            return true;
+
+        // The reader counts the dropped members too
+        rapidjson::SizeType member_count = m_member_counts.back();
+        leave();
+        return m_document.EndObject(member_count);
+    }
+
+    bool StartArray()
+    {
+        if (skip_container_start())
+            return true;
+
+        enter();
+        return m_document.StartArray();
+    }
+
+    bool EndArray(rapidjson::SizeType element_count)
+    {
+        if (skip_container_end())
+            return true;
+
+        leave();
+        return m_document.EndArray(element_count);
+    }
+
+private:
+    bool skip_value()
+    {
+        if (m_skip_depth > 0)
+            return true;
+
+        if (m_skip_value)
+        {
+            m_skip_value = false;
+            return true;
+        }
+
+        return false;
+    }
+
+    bool skip_container_start()
+    {
+        if (m_skip_depth > 0)
+        {
+            m_skip_depth++;
+            return true;
+        }
+
+        if (m_skip_value)
+        {
+            m_skip_value = false;
+            m_skip_depth = 1;
+            return true;
+        }
+
+        return false;
+    }
+
+    bool skip_container_end()
+    {
+        if (m_skip_depth == 0)
+            return false;
+
+        m_skip_depth--;
+        return true;
+    }
+
+    void enter()
+    {
+        m_path.push_back(m_key);
+        m_member_counts.push_back(0);
+        m_key.clear();
+    }
+
+    void leave()
+    {
+        m_path.pop_back();
+        m_member_counts.pop_back();
+        m_key.clear();
+    }
+
+    json_parser_t::document_t& m_document;
+    json_parser_t::member_filter_t& m_filter;
+
+    // Names of the members enclosing the current value and the number of kept members of each of them
+    std::vector<pal::string_t> m_path;
+    std::vector<rapidjson::SizeType> m_member_counts;
+
+    // Name of the member whose value is being parsed, empty for array elements
+    pal::string_t m_key;
+
+    // Nesting level inside a dropped object or array
+    size_t m_skip_depth;
+
+    // Whether the next value belongs to a dropped member
+    bool m_skip_value;
+};
+
 } // empty namespace
 
 void json_parser_t::realloc_buffer(size_t size)
@@ -74,31 +234,57 @@ void json_parser_t::realloc_buffer(size_t size)
     m_json[size] = '\0';
 }
 
-bool json_parser_t::parse_raw_data(char* data, int64_t size, const pal::string_t& context)
+bool json_parser_t::parse_raw_data(char* data, int64_t size, const pal::string_t& context, member_filter_t* filter)
 {
     assert(data != nullptr);
 
     constexpr auto flags = rapidjson::ParseFlag::kParseStopWhenDoneFlag | rapidjson::ParseFlag::kParseCommentsFlag;
+    rapidjson::ParseResult result;
+    if (filter == nullptr)
+    {
 #ifdef _WIN32
-    // Can't use in-situ parsing on Windows, as JSON data is encoded in
-    // UTF-8 and the host expects wide strings.  m_document will store
-    // data in UTF-16 (with pal::char_t as the character type), but it
-    // has to know that data is encoded in UTF-8 to convert during parsing.
-    m_document.Parse<flags, rapidjson::UTF8<>>(data);
+        // Can't use in-situ parsing on Windows, as JSON data is encoded in
+        // UTF-8 and the host expects wide strings.  m_document will store
+        // data in UTF-16 (with pal::char_t as the character type), but it
+        // has to know that data is encoded in UTF-8 to convert during parsing.
+        m_document.Parse<flags, rapidjson::UTF8<>>(data);
 #else // _WIN32
-    m_document.ParseInsitu<flags>(data);
+        m_document.ParseInsitu<flags>(data);
 #endif // _WIN32
+        result = m_document;
+    }
+    else
+    {
+        // Same as above, but the reader events go through the filter before reaching the document
+#ifdef _WIN32
+        rapidjson::GenericStringStream<rapidjson::UTF8<>> stream(data);
+        rapidjson::GenericReader<rapidjson::UTF8<>, internal_encoding_type_t> reader;
+        constexpr auto reader_flags = flags;
+#else // _WIN32
+        rapidjson::GenericInsituStringStream<internal_encoding_type_t> stream(data);
+        rapidjson::GenericReader<internal_encoding_type_t, internal_encoding_type_t> reader;
+        constexpr auto reader_flags = flags | rapidjson::ParseFlag::kParseInsituFlag;
+#endif // _WIN32
+
+        auto generator = [&](document_t& document)
+        {
+            filtering_handler_t handler(document, *filter);
+            result = reader.Parse<reader_flags>(stream, handler);
+            return !result.IsError();
+        };
+        m_document.Populate(generator);
+    }
 
-    if (m_document.HasParseError())
+    if (result.IsError())
     {
         int line, column;
-        size_t offset = m_document.GetErrorOffset();
+        size_t offset = result.Offset();
 
         get_line_column_from_offset(data, size, offset, &line, &column);
 
         trace::error(_X("A JSON parsing exception occurred in [%s], offset %zu (line %d, column %d): %s"),
             context.c_str(), offset, line, column,
-            rapidjson::GetParseError_En(m_document.GetParseError()));
+            rapidjson::GetParseError_En(result.Code()));
         return false;
     }
 
@@ -111,7 +297,7 @@ bool json_parser_t::parse_raw_data(char* data, int64_t size, const pal::string_t
     return true;
 }
 
-bool json_parser_t::parse_file(const pal::string_t& path)
+bool json_parser_t::parse_file(const pal::string_t& path, member_filter_t* filter)
 {
     // This code assumes that the caller has checked that the file `path` exists
     // either within the bundle, or as a real file on disk.
@@ -127,7 +313,7 @@ bool json_parser_t::parse_file(const pal::string_t& path)
 
         if (m_bundle_data != nullptr)
         {
-            bool result = parse_raw_data(m_bundle_data, m_bundle_location->size, path);
+            bool result = parse_raw_data(m_bundle_data, m_bundle_location->size, path, filter);
             return result;
         }
     }
@@ -153,7 +339,7 @@ bool json_parser_t::parse_file(const pal::string_t& path)
     realloc_buffer(static_cast<size_t>(stream_size - current_pos));
     file.read(m_json.data(), stream_size - current_pos);
 
-    return parse_raw_data(m_json.data(), m_json.size(), path);
+    return parse_raw_data(m_json.data(), m_json.size(), path, filter);
 }
 
 json_parser_t::~json_parser_t()
@@ -34,10 +34,26 @@ class json_parser_t {
         using value_t = rapidjson::GenericValue<internal_encoding_type_t>;
         using document_t = rapidjson::GenericDocument<internal_encoding_type_t>;
 
+        // Lets callers drop object members they never read while the JSON is being parsed,
+        // so that their values are never allocated in the document.
+        class member_filter_t
+        {
+        public:
+            virtual ~member_filter_t() = default;
+
+            // Called before the value of each object member is parsed. `path` holds the names of
+            // the members enclosing the object, starting with an empty name for the root.
+            // Return false to drop the member and its value.
+            virtual bool keep_member(const std::vector<pal::string_t>& path, const pal::char_t* name) = 0;
+
+            // Called for each kept string value of an object member
+            virtual void on_string(const std::vector<pal::string_t>& /*path*/, const pal::string_t& /*name*/, const pal::char_t* /*value*/) { }
+        };
+
         const document_t& document() const { return m_document; }
 
-        bool parse_raw_data(char* data, int64_t size, const pal::string_t& context);
-        bool parse_file(const pal::string_t& path);
+        bool parse_raw_data(char* data, int64_t size, const pal::string_t& context, member_filter_t* filter = nullptr);
+        bool parse_file(const pal::string_t& path, member_filter_t* filter = nullptr);
 
         json_parser_t()
             : m_bundle_data(nullptr)
@@ -5,6 +5,27 @@ check_symbol_exists(
     sys/socket.h
     HAVE_ACCEPT4)
 
+# Compressed nettrace blocks use the system LZ4 and zstd when the runtime asks for them, the runtime
+# then links EP_BLOCK_COMPRESSION_LIBRARIES.
+set(EP_BLOCK_COMPRESSION_LIBRARIES)
+if (EP_ENABLE_BLOCK_COMPRESSION)
+    find_library(EP_LZ4_LIBRARY lz4)
+    find_path(EP_LZ4_INCLUDE_DIR lz4.h)
+    if (EP_LZ4_LIBRARY AND EP_LZ4_INCLUDE_DIR)
+        set(HAVE_LZ4 1)
+        include_directories(SYSTEM ${EP_LZ4_INCLUDE_DIR})
+        list(APPEND EP_BLOCK_COMPRESSION_LIBRARIES ${EP_LZ4_LIBRARY})
+    endif ()
+
+    find_library(EP_ZSTD_LIBRARY zstd)
+    find_path(EP_ZSTD_INCLUDE_DIR zstd.h)
+    if (EP_ZSTD_LIBRARY AND EP_ZSTD_INCLUDE_DIR)
+        set(HAVE_ZSTD 1)
+        include_directories(SYSTEM ${EP_ZSTD_INCLUDE_DIR})
+        list(APPEND EP_BLOCK_COMPRESSION_LIBRARIES ${EP_ZSTD_LIBRARY})
+    endif ()
+endif (EP_ENABLE_BLOCK_COMPRESSION)
+
 if (NOT DEFINED EP_GENERATED_HEADER_PATH)
     message(FATAL_ERROR "Required configuration EP_GENERATED_HEADER_PATH not set.")
 endif (NOT DEFINED EP_GENERATED_HEADER_PATH)
@@ -7,6 +7,7 @@
 #include "ds-protocol.h"
 #include "ds-eventpipe-protocol.h"
 #include "ep.h"
+#include "ep-block.h"
 #include "ds-rt.h"
 
 /*
@@ -60,6 +61,51 @@ eventpipe_collect_tracing_command_try_parse_stackwalk_requested (
 	uint32_t *buffer_len,
 	bool *stackwalk_requested);
 
+static
+bool
+eventpipe_collect_tracing_command_try_parse_block_compression (
+	uint8_t **buffer,
+	uint32_t *buffer_len,
+	EventPipeBlockCompression *block_compression);
+
+static
+bool
+eventpipe_collect_tracing_command_try_parse_shared_memory_path (
+	uint8_t **buffer,
+	uint32_t *buffer_len,
+	ep_char8_t **shared_memory_path);
+
+static
+bool
+eventpipe_collect_tracing_command_try_parse_aggregation (
+	uint8_t **buffer,
+	uint32_t *buffer_len,
+	uint32_t *aggregation_interval_ms,
+	ep_char8_t **aggregation_config);
+
+static
+bool
+eventpipe_collect_tracing_command_try_parse_flight_recorder (
+	uint8_t **buffer,
+	uint32_t *buffer_len,
+	bool *flight_recorder,
+	ep_char8_t **trigger_config);
+
+static
+inline
+bool
+eventpipe_collect_tracing_command_try_parse_incremental_method_metadata (
+	uint8_t **buffer,
+	uint32_t *buffer_len,
+	bool *incremental_method_metadata);
+
+static
+bool
+eventpipe_collect_tracing_command_try_parse_event_filter (
+	uint8_t **buffer,
+	uint32_t *buffer_len,
+	ep_char8_t **event_filter_config);
+
 static
 bool
 eventpipe_collect_tracing_command_try_parse_config (
@@ -91,12 +137,97 @@ eventpipe_collect_tracing4_command_try_parse_payload (
 	uint8_t *buffer,
 	uint16_t buffer_len);
 
+static
+uint8_t *
+eventpipe_collect_tracing5_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len);
+
+static
+uint8_t *
+eventpipe_collect_tracing6_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len);
+
+static
+uint8_t *
+eventpipe_collect_tracing7_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len);
+
+static
+uint8_t *
+eventpipe_collect_tracing8_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len);
+
+static
+uint8_t *
+eventpipe_collect_tracing9_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len);
+
+static
+uint8_t *
+eventpipe_collect_tracing10_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len);
+
 static
 bool
 eventpipe_protocol_helper_stop_tracing (
 	DiagnosticsIpcMessage *message,
 	DiagnosticsIpcStream *stream);
 
+static
+bool
+eventpipe_protocol_helper_trigger_dump (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream);
+
+static
+bool
+eventpipe_protocol_helper_attach_startup_session (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream);
+
+static
+bool
+eventpipe_protocol_helper_trigger_dump (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream)
+{
+	ep_return_false_if_nok (message != NULL && stream != NULL);
+
+	bool result = false;
+	EventPipeStopTracingCommandPayload *payload;
+	payload = (EventPipeStopTracingCommandPayload *)ds_ipc_message_try_parse_payload (message, NULL);
+
+	if (!payload) {
+		ds_ipc_message_send_error (stream, DS_IPC_E_BAD_ENCODING);
+		ep_raise_error ();
+	}
+
+	if (!ep_trigger_dump (payload->session_id)) {
+		ds_ipc_message_send_error (stream, DS_IPC_E_FAIL);
+		ep_raise_error ();
+	}
+
+	eventpipe_protocol_helper_send_stop_tracing_success (stream, payload->session_id);
+	ds_ipc_stream_flush (stream);
+
+	result = true;
+
+ep_on_exit:
+	ds_eventpipe_stop_tracing_command_payload_free (payload);
+	ds_ipc_stream_free (stream);
+	return result;
+
+ep_on_error:
+	EP_ASSERT (!result);
+	ep_exit_error_handler ();
+}
+
 static
 bool
 eventpipe_protocol_helper_collect_tracing (
@@ -193,6 +324,146 @@ eventpipe_collect_tracing_command_try_parse_stackwalk_requested (
 	return ds_ipc_message_try_parse_bool (buffer, buffer_len, stackwalk_requested);
 }
 
+static
+inline
+bool
+eventpipe_collect_tracing_command_try_parse_block_compression (
+	uint8_t **buffer,
+	uint32_t *buffer_len,
+	EventPipeBlockCompression *block_compression)
+{
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT (buffer_len != NULL);
+	EP_ASSERT (block_compression != NULL);
+
+	uint32_t compression;
+	bool can_parse = ds_ipc_message_try_parse_uint32_t (buffer, buffer_len, &compression);
+
+	*block_compression = (EventPipeBlockCompression)compression;
+	return can_parse && (compression < (uint32_t)EP_BLOCK_COMPRESSION_COUNT);
+}
+
+static
+bool
+eventpipe_collect_tracing_command_try_parse_shared_memory_path (
+	uint8_t **buffer,
+	uint32_t *buffer_len,
+	ep_char8_t **shared_memory_path)
+{
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT (buffer_len != NULL);
+	EP_ASSERT (shared_memory_path != NULL);
+
+	uint8_t *path_byte_array = NULL;
+	uint32_t path_byte_array_len = 0;
+	bool can_parse = ds_ipc_message_try_parse_string_utf16_t_byte_array_alloc (buffer, buffer_len, &path_byte_array, &path_byte_array_len);
+
+	// An empty path streams over the connection as before.
+	if (can_parse && path_byte_array) {
+		*shared_memory_path = ep_rt_utf16le_to_utf8_string ((const ep_char16_t *)path_byte_array);
+		can_parse = *shared_memory_path != NULL;
+	}
+
+	ep_rt_byte_array_free (path_byte_array);
+	return can_parse;
+}
+
+static
+bool
+eventpipe_collect_tracing_command_try_parse_aggregation (
+	uint8_t **buffer,
+	uint32_t *buffer_len,
+	uint32_t *aggregation_interval_ms,
+	ep_char8_t **aggregation_config)
+{
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT (buffer_len != NULL);
+	EP_ASSERT (aggregation_interval_ms != NULL);
+	EP_ASSERT (aggregation_config != NULL);
+
+	uint8_t *config_byte_array = NULL;
+	uint32_t config_byte_array_len = 0;
+	bool can_parse = ds_ipc_message_try_parse_uint32_t (buffer, buffer_len, aggregation_interval_ms) &&
+		ds_ipc_message_try_parse_string_utf16_t_byte_array_alloc (buffer, buffer_len, &config_byte_array, &config_byte_array_len);
+
+	// An empty config aggregates nothing.
+	if (can_parse && config_byte_array) {
+		*aggregation_config = ep_rt_utf16le_to_utf8_string ((const ep_char16_t *)config_byte_array);
+		can_parse = *aggregation_config != NULL && *aggregation_interval_ms != 0;
+	}
+
+	ep_rt_byte_array_free (config_byte_array);
+	return can_parse;
+}
+
+static
+bool
+eventpipe_collect_tracing_command_try_parse_flight_recorder (
+	uint8_t **buffer,
+	uint32_t *buffer_len,
+	bool *flight_recorder,
+	ep_char8_t **trigger_config)
+{
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT (buffer_len != NULL);
+	EP_ASSERT (flight_recorder != NULL);
+	EP_ASSERT (trigger_config != NULL);
+
+	uint8_t *config_byte_array = NULL;
+	uint32_t config_byte_array_len = 0;
+	bool can_parse = ds_ipc_message_try_parse_bool (buffer, buffer_len, flight_recorder) &&
+		ds_ipc_message_try_parse_string_utf16_t_byte_array_alloc (buffer, buffer_len, &config_byte_array, &config_byte_array_len);
+
+	// An empty config leaves dumps to the TriggerDump command.
+	if (can_parse && config_byte_array) {
+		*trigger_config = ep_rt_utf16le_to_utf8_string ((const ep_char16_t *)config_byte_array);
+		can_parse = *trigger_config != NULL && *flight_recorder;
+	}
+
+	ep_rt_byte_array_free (config_byte_array);
+	return can_parse;
+}
+
+static
+inline
+bool
+eventpipe_collect_tracing_command_try_parse_incremental_method_metadata (
+	uint8_t **buffer,
+	uint32_t *buffer_len,
+	bool *incremental_method_metadata)
+{
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT (buffer_len != NULL);
+	EP_ASSERT (incremental_method_metadata != NULL);
+
+	return ds_ipc_message_try_parse_bool (buffer, buffer_len, incremental_method_metadata);
+}
+
+static
+bool
+eventpipe_collect_tracing_command_try_parse_event_filter (
+	uint8_t **buffer,
+	uint32_t *buffer_len,
+	ep_char8_t **event_filter_config)
+{
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT (buffer_len != NULL);
+	EP_ASSERT (event_filter_config != NULL);
+
+	uint8_t *config_byte_array = NULL;
+	uint32_t config_byte_array_len = 0;
+	bool can_parse = ds_ipc_message_try_parse_string_utf16_t_byte_array_alloc (buffer, buffer_len, &config_byte_array, &config_byte_array_len);
+
+	// An empty config filters nothing.
+	if (can_parse && config_byte_array) {
+		*event_filter_config = ep_rt_utf16le_to_utf8_string ((const ep_char16_t *)config_byte_array);
+		can_parse = *event_filter_config != NULL;
+	}
+
+	ep_rt_byte_array_free (config_byte_array);
+	return can_parse;
+}
+
 static
 bool
 eventpipe_collect_tracing_command_try_parse_config (
@@ -298,6 +569,10 @@ ds_eventpipe_collect_tracing_command_payload_free (EventPipeCollectTracingComman
 		ep_rt_utf8_string_free ((ep_char8_t *)ep_provider_config_get_filter_data (&config));
 	} DN_VECTOR_FOREACH_END;
 
+	ep_rt_utf8_string_free (payload->shared_memory_path);
+	ep_rt_utf8_string_free (payload->aggregation_config);
+	ep_rt_utf8_string_free (payload->flight_recorder_trigger_config);
+	ep_rt_utf8_string_free (payload->event_filter_config);
 	ep_rt_object_free (payload);
 }
 
@@ -441,6 +716,231 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+static
+uint8_t *
+eventpipe_collect_tracing5_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len)
+{
+	EP_ASSERT (buffer != NULL);
+
+	uint8_t * buffer_cursor = buffer;
+	uint32_t buffer_cursor_len = buffer_len;
+
+	EventPipeCollectTracingCommandPayload *instance = ds_eventpipe_collect_tracing_command_payload_alloc ();
+	ep_raise_error_if_nok (instance != NULL);
+
+	instance->incoming_buffer = buffer;
+
+	if (!eventpipe_collect_tracing_command_try_parse_circular_buffer_size (&buffer_cursor, &buffer_cursor_len, &instance->circular_buffer_size_in_mb ) ||
+		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format) ||
+		!eventpipe_collect_tracing_command_try_parse_rundown_keyword (&buffer_cursor, &buffer_cursor_len, &instance->rundown_keyword) ||
+		!eventpipe_collect_tracing_command_try_parse_stackwalk_requested (&buffer_cursor, &buffer_cursor_len, &instance->stackwalk_requested) ||
+		!eventpipe_collect_tracing_command_try_parse_block_compression (&buffer_cursor, &buffer_cursor_len, &instance->block_compression) ||
+		!eventpipe_collect_tracing_command_try_parse_config (&buffer_cursor, &buffer_cursor_len, &instance->provider_configs))
+		ep_raise_error ();
+
+	instance->rundown_requested = instance->rundown_keyword != 0;
+
+ep_on_exit:
+	return (uint8_t *)instance;
+
+ep_on_error:
+	ds_eventpipe_collect_tracing_command_payload_free (instance);
+	instance = NULL;
+	ep_exit_error_handler ();
+}
+
+static
+uint8_t *
+eventpipe_collect_tracing6_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len)
+{
+	EP_ASSERT (buffer != NULL);
+
+	uint8_t * buffer_cursor = buffer;
+	uint32_t buffer_cursor_len = buffer_len;
+
+	EventPipeCollectTracingCommandPayload *instance = ds_eventpipe_collect_tracing_command_payload_alloc ();
+	ep_raise_error_if_nok (instance != NULL);
+
+	instance->incoming_buffer = buffer;
+
+	if (!eventpipe_collect_tracing_command_try_parse_circular_buffer_size (&buffer_cursor, &buffer_cursor_len, &instance->circular_buffer_size_in_mb ) ||
+		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format) ||
+		!eventpipe_collect_tracing_command_try_parse_rundown_keyword (&buffer_cursor, &buffer_cursor_len, &instance->rundown_keyword) ||
+		!eventpipe_collect_tracing_command_try_parse_stackwalk_requested (&buffer_cursor, &buffer_cursor_len, &instance->stackwalk_requested) ||
+		!eventpipe_collect_tracing_command_try_parse_block_compression (&buffer_cursor, &buffer_cursor_len, &instance->block_compression) ||
+		!eventpipe_collect_tracing_command_try_parse_shared_memory_path (&buffer_cursor, &buffer_cursor_len, &instance->shared_memory_path) ||
+		!eventpipe_collect_tracing_command_try_parse_config (&buffer_cursor, &buffer_cursor_len, &instance->provider_configs))
+		ep_raise_error ();
+
+	instance->rundown_requested = instance->rundown_keyword != 0;
+
+ep_on_exit:
+	return (uint8_t *)instance;
+
+ep_on_error:
+	ds_eventpipe_collect_tracing_command_payload_free (instance);
+	instance = NULL;
+	ep_exit_error_handler ();
+}
+
+static
+uint8_t *
+eventpipe_collect_tracing7_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len)
+{
+	EP_ASSERT (buffer != NULL);
+
+	uint8_t * buffer_cursor = buffer;
+	uint32_t buffer_cursor_len = buffer_len;
+
+	EventPipeCollectTracingCommandPayload *instance = ds_eventpipe_collect_tracing_command_payload_alloc ();
+	ep_raise_error_if_nok (instance != NULL);
+
+	instance->incoming_buffer = buffer;
+
+	if (!eventpipe_collect_tracing_command_try_parse_circular_buffer_size (&buffer_cursor, &buffer_cursor_len, &instance->circular_buffer_size_in_mb ) ||
+		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format) ||
+		!eventpipe_collect_tracing_command_try_parse_rundown_keyword (&buffer_cursor, &buffer_cursor_len, &instance->rundown_keyword) ||
+		!eventpipe_collect_tracing_command_try_parse_stackwalk_requested (&buffer_cursor, &buffer_cursor_len, &instance->stackwalk_requested) ||
+		!eventpipe_collect_tracing_command_try_parse_block_compression (&buffer_cursor, &buffer_cursor_len, &instance->block_compression) ||
+		!eventpipe_collect_tracing_command_try_parse_shared_memory_path (&buffer_cursor, &buffer_cursor_len, &instance->shared_memory_path) ||
+		!eventpipe_collect_tracing_command_try_parse_aggregation (&buffer_cursor, &buffer_cursor_len, &instance->aggregation_interval_ms, &instance->aggregation_config) ||
+		!eventpipe_collect_tracing_command_try_parse_config (&buffer_cursor, &buffer_cursor_len, &instance->provider_configs))
+		ep_raise_error ();
+
+	instance->rundown_requested = instance->rundown_keyword != 0;
+
+ep_on_exit:
+	return (uint8_t *)instance;
+
+ep_on_error:
+	ds_eventpipe_collect_tracing_command_payload_free (instance);
+	instance = NULL;
+	ep_exit_error_handler ();
+}
+
+static
+uint8_t *
+eventpipe_collect_tracing8_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len)
+{
+	EP_ASSERT (buffer != NULL);
+
+	uint8_t * buffer_cursor = buffer;
+	uint32_t buffer_cursor_len = buffer_len;
+
+	EventPipeCollectTracingCommandPayload *instance = ds_eventpipe_collect_tracing_command_payload_alloc ();
+	ep_raise_error_if_nok (instance != NULL);
+
+	instance->incoming_buffer = buffer;
+
+	if (!eventpipe_collect_tracing_command_try_parse_circular_buffer_size (&buffer_cursor, &buffer_cursor_len, &instance->circular_buffer_size_in_mb ) ||
+		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format) ||
+		!eventpipe_collect_tracing_command_try_parse_rundown_keyword (&buffer_cursor, &buffer_cursor_len, &instance->rundown_keyword) ||
+		!eventpipe_collect_tracing_command_try_parse_stackwalk_requested (&buffer_cursor, &buffer_cursor_len, &instance->stackwalk_requested) ||
+		!eventpipe_collect_tracing_command_try_parse_block_compression (&buffer_cursor, &buffer_cursor_len, &instance->block_compression) ||
+		!eventpipe_collect_tracing_command_try_parse_shared_memory_path (&buffer_cursor, &buffer_cursor_len, &instance->shared_memory_path) ||
+		!eventpipe_collect_tracing_command_try_parse_aggregation (&buffer_cursor, &buffer_cursor_len, &instance->aggregation_interval_ms, &instance->aggregation_config) ||
+		!eventpipe_collect_tracing_command_try_parse_flight_recorder (&buffer_cursor, &buffer_cursor_len, &instance->flight_recorder, &instance->flight_recorder_trigger_config) ||
+		!eventpipe_collect_tracing_command_try_parse_config (&buffer_cursor, &buffer_cursor_len, &instance->provider_configs))
+		ep_raise_error ();
+
+	instance->rundown_requested = instance->rundown_keyword != 0;
+
+ep_on_exit:
+	return (uint8_t *)instance;
+
+ep_on_error:
+	ds_eventpipe_collect_tracing_command_payload_free (instance);
+	instance = NULL;
+	ep_exit_error_handler ();
+}
+
+static
+uint8_t *
+eventpipe_collect_tracing9_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len)
+{
+	EP_ASSERT (buffer != NULL);
+
+	uint8_t * buffer_cursor = buffer;
+	uint32_t buffer_cursor_len = buffer_len;
+
+	EventPipeCollectTracingCommandPayload *instance = ds_eventpipe_collect_tracing_command_payload_alloc ();
+	ep_raise_error_if_nok (instance != NULL);
+
+	instance->incoming_buffer = buffer;
+
+	if (!eventpipe_collect_tracing_command_try_parse_circular_buffer_size (&buffer_cursor, &buffer_cursor_len, &instance->circular_buffer_size_in_mb ) ||
+		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format) ||
+		!eventpipe_collect_tracing_command_try_parse_rundown_keyword (&buffer_cursor, &buffer_cursor_len, &instance->rundown_keyword) ||
+		!eventpipe_collect_tracing_command_try_parse_stackwalk_requested (&buffer_cursor, &buffer_cursor_len, &instance->stackwalk_requested) ||
+		!eventpipe_collect_tracing_command_try_parse_block_compression (&buffer_cursor, &buffer_cursor_len, &instance->block_compression) ||
+		!eventpipe_collect_tracing_command_try_parse_shared_memory_path (&buffer_cursor, &buffer_cursor_len, &instance->shared_memory_path) ||
+		!eventpipe_collect_tracing_command_try_parse_aggregation (&buffer_cursor, &buffer_cursor_len, &instance->aggregation_interval_ms, &instance->aggregation_config) ||
+		!eventpipe_collect_tracing_command_try_parse_flight_recorder (&buffer_cursor, &buffer_cursor_len, &instance->flight_recorder, &instance->flight_recorder_trigger_config) ||
+		!eventpipe_collect_tracing_command_try_parse_incremental_method_metadata (&buffer_cursor, &buffer_cursor_len, &instance->incremental_method_metadata) ||
+		!eventpipe_collect_tracing_command_try_parse_config (&buffer_cursor, &buffer_cursor_len, &instance->provider_configs))
+		ep_raise_error ();
+
+	instance->rundown_requested = instance->rundown_keyword != 0;
+
+ep_on_exit:
+	return (uint8_t *)instance;
+
+ep_on_error:
+	ds_eventpipe_collect_tracing_command_payload_free (instance);
+	instance = NULL;
+	ep_exit_error_handler ();
+}
+
+static
+uint8_t *
+eventpipe_collect_tracing10_command_try_parse_payload (
+	uint8_t *buffer,
+	uint16_t buffer_len)
+{
+	EP_ASSERT (buffer != NULL);
+
+	uint8_t * buffer_cursor = buffer;
+	uint32_t buffer_cursor_len = buffer_len;
+
+	EventPipeCollectTracingCommandPayload *instance = ds_eventpipe_collect_tracing_command_payload_alloc ();
+	ep_raise_error_if_nok (instance != NULL);
+
+	instance->incoming_buffer = buffer;
+
+	if (!eventpipe_collect_tracing_command_try_parse_circular_buffer_size (&buffer_cursor, &buffer_cursor_len, &instance->circular_buffer_size_in_mb ) ||
+		!eventpipe_collect_tracing_command_try_parse_serialization_format (&buffer_cursor, &buffer_cursor_len, &instance->serialization_format) ||
+		!eventpipe_collect_tracing_command_try_parse_rundown_keyword (&buffer_cursor, &buffer_cursor_len, &instance->rundown_keyword) ||
+		!eventpipe_collect_tracing_command_try_parse_stackwalk_requested (&buffer_cursor, &buffer_cursor_len, &instance->stackwalk_requested) ||
+		!eventpipe_collect_tracing_command_try_parse_block_compression (&buffer_cursor, &buffer_cursor_len, &instance->block_compression) ||
+		!eventpipe_collect_tracing_command_try_parse_shared_memory_path (&buffer_cursor, &buffer_cursor_len, &instance->shared_memory_path) ||
+		!eventpipe_collect_tracing_command_try_parse_aggregation (&buffer_cursor, &buffer_cursor_len, &instance->aggregation_interval_ms, &instance->aggregation_config) ||
+		!eventpipe_collect_tracing_command_try_parse_flight_recorder (&buffer_cursor, &buffer_cursor_len, &instance->flight_recorder, &instance->flight_recorder_trigger_config) ||
+		!eventpipe_collect_tracing_command_try_parse_incremental_method_metadata (&buffer_cursor, &buffer_cursor_len, &instance->incremental_method_metadata) ||
+		!eventpipe_collect_tracing_command_try_parse_event_filter (&buffer_cursor, &buffer_cursor_len, &instance->event_filter_config) ||
+		!eventpipe_collect_tracing_command_try_parse_config (&buffer_cursor, &buffer_cursor_len, &instance->provider_configs))
+		ep_raise_error ();
+
+	instance->rundown_requested = instance->rundown_keyword != 0;
+
+ep_on_exit:
+	return (uint8_t *)instance;
+
+ep_on_error:
+	ds_eventpipe_collect_tracing_command_payload_free (instance);
+	instance = NULL;
+	ep_exit_error_handler ();
+}
+
 /*
 * EventPipeProtocolHelper
 */
@@ -517,6 +1017,38 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+static
+bool
+eventpipe_protocol_helper_attach_startup_session (
+	DiagnosticsIpcMessage *message,
+	DiagnosticsIpcStream *stream)
+{
+	ep_return_false_if_nok (message != NULL && stream != NULL);
+
+	bool result = false;
+
+	// The startup session has been buffering since ep_init, possibly while the runtime was still
+	// suspended waiting for a ResumeRuntime command. From here on it streams like any IPC session.
+	EventPipeSessionID session_id = ep_attach_startup_session (ds_ipc_stream_get_stream_ref (stream));
+	if (session_id == 0) {
+		ds_ipc_message_send_error (stream, DS_IPC_E_FAIL);
+		ep_raise_error ();
+	}
+
+	eventpipe_protocol_helper_send_start_tracing_success (stream, session_id);
+	ep_start_streaming (session_id);
+
+	result = true;
+
+ep_on_exit:
+	return result;
+
+ep_on_error:
+	EP_ASSERT (!result);
+	ds_ipc_stream_free (stream);
+	ep_exit_error_handler ();
+}
+
 static
 bool
 eventpipe_protocol_helper_collect_tracing (
@@ -530,6 +1062,21 @@ eventpipe_protocol_helper_collect_tracing (
 		return false;
 	}
 
+	if (!ep_block_compression_is_supported (payload->block_compression)) {
+		ds_ipc_message_send_error (stream, DS_IPC_E_NOTSUPPORTED);
+		ds_eventpipe_collect_tracing_command_payload_free (payload);
+		ds_ipc_stream_free (stream);
+		return false;
+	}
+
+	// Only the trace moves to the ring, replies keep going over the connection.
+	if (payload->shared_memory_path && !ds_ipc_stream_map_shared_memory (stream, payload->shared_memory_path)) {
+		ds_ipc_message_send_error (stream, DS_IPC_E_NOTSUPPORTED);
+		ds_eventpipe_collect_tracing_command_payload_free (payload);
+		ds_ipc_stream_free (stream);
+		return false;
+	}
+
 	EventPipeSessionOptions options;
 	ep_session_options_init(
 		&options,
@@ -544,6 +1091,13 @@ eventpipe_protocol_helper_collect_tracing (
 		ds_ipc_stream_get_stream_ref (stream),
 		NULL,
 		NULL);
+	options.block_compression = payload->block_compression;
+	options.aggregation_config = payload->aggregation_config;
+	options.aggregation_interval_ms = payload->aggregation_interval_ms;
+	options.flight_recorder = payload->flight_recorder;
+	options.flight_recorder_trigger_config = payload->flight_recorder_trigger_config;
+	options.incremental_method_metadata = payload->incremental_method_metadata;
+	options.event_filter_config = payload->event_filter_config;
 
 	EventPipeSessionID session_id = 0;
 	bool result = false;
@@ -616,9 +1170,39 @@ ds_eventpipe_protocol_helper_handle_ipc_message (
 		payload = (EventPipeCollectTracingCommandPayload *)ds_ipc_message_try_parse_payload (message, eventpipe_collect_tracing4_command_try_parse_payload);
 		result = eventpipe_protocol_helper_collect_tracing (payload, stream);
 		break;
+	case EP_COMMANDID_COLLECT_TRACING_5:
+		payload = (EventPipeCollectTracingCommandPayload *)ds_ipc_message_try_parse_payload (message, eventpipe_collect_tracing5_command_try_parse_payload);
+		result = eventpipe_protocol_helper_collect_tracing (payload, stream);
+		break;
+	case EP_COMMANDID_COLLECT_TRACING_6:
+		payload = (EventPipeCollectTracingCommandPayload *)ds_ipc_message_try_parse_payload (message, eventpipe_collect_tracing6_command_try_parse_payload);
+		result = eventpipe_protocol_helper_collect_tracing (payload, stream);
+		break;
+	case EP_COMMANDID_COLLECT_TRACING_7:
+		payload = (EventPipeCollectTracingCommandPayload *)ds_ipc_message_try_parse_payload (message, eventpipe_collect_tracing7_command_try_parse_payload);
+		result = eventpipe_protocol_helper_collect_tracing (payload, stream);
+		break;
+	case EP_COMMANDID_COLLECT_TRACING_8:
+		payload = (EventPipeCollectTracingCommandPayload *)ds_ipc_message_try_parse_payload (message, eventpipe_collect_tracing8_command_try_parse_payload);
+		result = eventpipe_protocol_helper_collect_tracing (payload, stream);
+		break;
+	case EP_COMMANDID_COLLECT_TRACING_9:
+		payload = (EventPipeCollectTracingCommandPayload *)ds_ipc_message_try_parse_payload (message, eventpipe_collect_tracing9_command_try_parse_payload);
+		result = eventpipe_protocol_helper_collect_tracing (payload, stream);
+		break;
+	case EP_COMMANDID_COLLECT_TRACING_10:
+		payload = (EventPipeCollectTracingCommandPayload *)ds_ipc_message_try_parse_payload (message, eventpipe_collect_tracing10_command_try_parse_payload);
+		result = eventpipe_protocol_helper_collect_tracing (payload, stream);
+		break;
 	case EP_COMMANDID_STOP_TRACING:
 		result = eventpipe_protocol_helper_stop_tracing (message, stream);
 		break;
+	case EP_COMMANDID_TRIGGER_DUMP:
+		result = eventpipe_protocol_helper_trigger_dump (message, stream);
+		break;
+	case EP_COMMANDID_ATTACH_STARTUP_SESSION:
+		result = eventpipe_protocol_helper_attach_startup_session (message, stream);
+		break;
 	default:
 		result = eventpipe_protocol_helper_unknown_command (message, stream);
 		break;
@@ -21,6 +21,12 @@
 // Command = 0x0203
 // Command = 0x0204
 // Command = 0x0205
+// Command = 0x0206
+// Command = 0x0207
+// Command = 0x0208
+// Command = 0x0209
+// Command = 0x020B
+// Command = 0x020C
 #if defined(DS_INLINE_GETTER_SETTER) || defined(DS_IMPL_EVENTPIPE_PROTOCOL_GETTER_SETTER)
 struct _EventPipeCollectTracingCommandPayload {
 #else
@@ -34,6 +40,17 @@ struct _EventPipeCollectTracingCommandPayload_Internal {
 	// array<T> = uint length, length # of Ts
 	// string = (array<char> where the last char must = 0) or (length = 0)
 	// provider_config = ulong keywords, uint logLevel, string provider_name, string filter_data
+	// CollectTracing5 adds uint blockCompression (EventPipeBlockCompression) before the providers
+	// CollectTracing6 adds string sharedMemoryPath after blockCompression, the trace is then written
+	// to that shared memory ring (see DiagnosticsIpcSharedMemoryRing) instead of the connection
+	// CollectTracing7 adds uint aggregationIntervalMs, string aggregationConfig after sharedMemoryPath,
+	// the events selected by aggregationConfig are then aggregated in process (see ep-session-aggregator.h)
+	// CollectTracing8 adds bool flightRecorder, string triggerConfig after aggregationConfig, the buffers
+	// are then only streamed when dumped (see ep-session-flight-recorder.h)
+	// CollectTracing9 adds bool incrementalMethodMetadata after triggerConfig, jitted methods are then
+	// left out of the rundown if the runtime logs them as they are compiled (see ep_rt_enable_method_load_log)
+	// CollectTracing10 adds string eventFilterConfig after incrementalMethodMetadata, events failing its
+	// payload predicates are then dropped before being recorded (see ep-event-filter.h)
 
 	uint8_t *incoming_buffer;
 	dn_vector_t *provider_configs;
@@ -42,6 +59,14 @@ struct _EventPipeCollectTracingCommandPayload_Internal {
 	bool rundown_requested;
 	bool stackwalk_requested;
 	uint64_t rundown_keyword;
+	EventPipeBlockCompression block_compression;
+	ep_char8_t *shared_memory_path;
+	ep_char8_t *aggregation_config;
+	uint32_t aggregation_interval_ms;
+	ep_char8_t *flight_recorder_trigger_config;
+	ep_char8_t *event_filter_config;
+	bool flight_recorder;
+	bool incremental_method_metadata;
 };
 
 #if !defined(DS_INLINE_GETTER_SETTER) && !defined(DS_IMPL_EVENTPIPE_PROTOCOL_GETTER_SETTER)
@@ -61,6 +86,7 @@ ds_eventpipe_collect_tracing_command_payload_free (EventPipeCollectTracingComman
 */
 
 // Command = 0x0201
+// Command = 0x020A, dumps the ring of a flight recorder session
 #if defined(DS_INLINE_GETTER_SETTER) || defined(DS_IMPL_EVENTPIPE_PROTOCOL_GETTER_SETTER)
 struct _EventPipeStopTracingCommandPayload {
 #else
@@ -78,6 +104,13 @@ struct _EventPipeStopTracingCommandPayload {
 void
 ds_eventpipe_stop_tracing_command_payload_free (EventPipeStopTracingCommandPayload *payload);
 
+/*
+* EventPipeAttachStartupSession
+*/
+
+// Command = 0x020D, no payload. Streams the session configured through DOTNET_EventPipeStartupSession
+// over the connection, the reply is the same as for CollectTracing.
+
 /*
 * EventPipeProtocolHelper
 */
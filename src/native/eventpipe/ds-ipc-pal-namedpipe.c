@@ -928,6 +928,15 @@ ds_ipc_stream_flush (DiagnosticsIpcStream *ipc_stream)
 	return ipc_stream_flush_func (ipc_stream);
 }
 
+bool
+ds_ipc_stream_map_shared_memory (
+	DiagnosticsIpcStream *ipc_stream,
+	const ep_char8_t *path)
+{
+	// Shared memory streaming is only implemented by the socket PAL.
+	return false;
+}
+
 bool
 ds_ipc_stream_close (
 	DiagnosticsIpcStream *ipc_stream,
@@ -28,8 +28,10 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include <errno.h>
+#include <string.h>
 #include <sys/un.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 
 #if __GNUC__
 #include <poll.h>
@@ -203,6 +205,30 @@ ipc_stream_write_func (
 	uint32_t *bytes_written,
 	uint32_t timeout_ms);
 
+static
+bool
+ipc_stream_socket_write (
+	DiagnosticsIpcStream *ipc_stream,
+	const uint8_t *buffer,
+	uint32_t bytes_to_write,
+	uint32_t *bytes_written,
+	uint32_t timeout_ms);
+
+#ifndef HOST_WIN32
+static
+bool
+ipc_stream_shared_memory_write (
+	DiagnosticsIpcStream *ipc_stream,
+	const uint8_t *buffer,
+	uint32_t bytes_to_write,
+	uint32_t *bytes_written,
+	uint32_t timeout_ms);
+
+static
+void
+ipc_stream_shared_memory_unmap (DiagnosticsIpcStream *ipc_stream);
+#endif
+
 static
 bool
 ipc_stream_flush_func (void *object);
@@ -1417,11 +1443,31 @@ ipc_stream_write_func (
 	uint32_t timeout_ms)
 {
 	EP_ASSERT (object != NULL);
+
+	DiagnosticsIpcStream *ipc_stream = (DiagnosticsIpcStream *)object;
+
+#ifndef HOST_WIN32
+	if (ipc_stream->shared_memory)
+		return ipc_stream_shared_memory_write (ipc_stream, buffer, bytes_to_write, bytes_written, timeout_ms);
+#endif
+
+	return ipc_stream_socket_write (ipc_stream, buffer, bytes_to_write, bytes_written, timeout_ms);
+}
+
+static
+bool
+ipc_stream_socket_write (
+	DiagnosticsIpcStream *ipc_stream,
+	const uint8_t *buffer,
+	uint32_t bytes_to_write,
+	uint32_t *bytes_written,
+	uint32_t timeout_ms)
+{
+	EP_ASSERT (ipc_stream != NULL);
 	EP_ASSERT (buffer != NULL);
 	EP_ASSERT (bytes_written != NULL);
 
 	bool success = false;
-	DiagnosticsIpcStream *ipc_stream = (DiagnosticsIpcStream *)object;
 	ssize_t total_bytes_written = 0;
 
 	if (timeout_ms != DS_IPC_TIMEOUT_INFINITE) {
@@ -1451,6 +1497,91 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+#ifndef HOST_WIN32
+static
+bool
+ipc_stream_shared_memory_write (
+	DiagnosticsIpcStream *ipc_stream,
+	const uint8_t *buffer,
+	uint32_t bytes_to_write,
+	uint32_t *bytes_written,
+	uint32_t timeout_ms)
+{
+	EP_ASSERT (ipc_stream != NULL);
+	EP_ASSERT (ipc_stream->shared_memory != NULL);
+	EP_ASSERT (buffer != NULL);
+	EP_ASSERT (bytes_written != NULL);
+
+	DiagnosticsIpcSharedMemoryRing *ring = (DiagnosticsIpcSharedMemoryRing *)ipc_stream->shared_memory;
+	uint8_t *data = ipc_stream->shared_memory + sizeof (DiagnosticsIpcSharedMemoryRing);
+	uint32_t capacity = ipc_stream->shared_memory_capacity;
+	uint64_t write_offset = ipc_stream->shared_memory_write_offset;
+	uint32_t total_bytes_written = 0;
+	uint32_t waited_ms = 0;
+
+	while (total_bytes_written < bytes_to_write) {
+		if (__atomic_load_n (&ring->state, __ATOMIC_ACQUIRE) & DS_IPC_SHARED_MEMORY_RING_STATE_READER_CLOSED)
+			break;
+
+		uint64_t used = write_offset - __atomic_load_n (&ring->read_offset, __ATOMIC_ACQUIRE);
+		if (used > capacity)
+			break;
+
+		if (used == capacity) {
+			// The ring is full, wait for the collector to catch up. Nothing is expected on the control
+			// connection while streaming, so it becoming readable means the collector went away.
+			if (timeout_ms != DS_IPC_TIMEOUT_INFINITE && waited_ms >= timeout_ms)
+				break;
+
+			ds_ipc_pollfd_t pfd;
+			pfd.fd = ipc_stream->client_socket;
+			pfd.events = POLLIN;
+			pfd.revents = 0;
+			if (ipc_poll_fds (&pfd, 1, DS_IPC_SHARED_MEMORY_RING_FULL_WAIT_MS) != 0)
+				break;
+
+			waited_ms += DS_IPC_SHARED_MEMORY_RING_FULL_WAIT_MS;
+			continue;
+		}
+
+		uint32_t chunk = capacity - (uint32_t)used;
+		if (chunk > bytes_to_write - total_bytes_written)
+			chunk = bytes_to_write - total_bytes_written;
+
+		uint32_t offset = (uint32_t)(write_offset & (capacity - 1));
+		uint32_t first_part = chunk < capacity - offset ? chunk : capacity - offset;
+
+		memcpy (data + offset, buffer + total_bytes_written, first_part);
+		memcpy (data, buffer + total_bytes_written + first_part, chunk - first_part);
+
+		write_offset += chunk;
+		total_bytes_written += chunk;
+		__atomic_store_n (&ring->write_offset, write_offset, __ATOMIC_RELEASE);
+	}
+
+	ipc_stream->shared_memory_write_offset = write_offset;
+	*bytes_written = total_bytes_written;
+	return total_bytes_written == bytes_to_write;
+}
+
+static
+void
+ipc_stream_shared_memory_unmap (DiagnosticsIpcStream *ipc_stream)
+{
+	EP_ASSERT (ipc_stream != NULL);
+
+	if (!ipc_stream->shared_memory)
+		return;
+
+	DiagnosticsIpcSharedMemoryRing *ring = (DiagnosticsIpcSharedMemoryRing *)ipc_stream->shared_memory;
+	__atomic_fetch_or (&ring->state, DS_IPC_SHARED_MEMORY_RING_STATE_WRITER_CLOSED, __ATOMIC_RELEASE);
+
+	munmap (ipc_stream->shared_memory, ipc_stream->shared_memory_size);
+	ipc_stream->shared_memory = NULL;
+	ipc_stream->shared_memory_size = 0;
+}
+#endif
+
 static
 bool
 ipc_stream_flush_func (void *object)
@@ -1543,7 +1674,7 @@ ds_ipc_stream_write (
 	uint32_t *bytes_written,
 	uint32_t timeout_ms)
 {
-	return ipc_stream_write_func (
+	return ipc_stream_socket_write (
 		ipc_stream,
 		buffer,
 		bytes_to_write,
@@ -1557,6 +1688,67 @@ ds_ipc_stream_flush (DiagnosticsIpcStream *ipc_stream)
 	return ipc_stream_flush_func (ipc_stream);
 }
 
+bool
+ds_ipc_stream_map_shared_memory (
+	DiagnosticsIpcStream *ipc_stream,
+	const ep_char8_t *path)
+{
+	EP_ASSERT (ipc_stream != NULL);
+	EP_ASSERT (path != NULL);
+
+#ifndef HOST_WIN32
+	bool result = false;
+	uint8_t *mapping = NULL;
+	size_t mapping_size = 0;
+	DiagnosticsIpcSharedMemoryRing *ring = NULL;
+	struct stat file_stat;
+	int fd;
+
+	if (ipc_stream->shared_memory)
+		return false;
+
+	DS_ENTER_BLOCKING_PAL_SECTION;
+	fd = open (path, O_RDWR | O_CLOEXEC | O_NOFOLLOW);
+	DS_EXIT_BLOCKING_PAL_SECTION;
+	if (fd == -1)
+		return false;
+
+	ep_raise_error_if_nok (fstat (fd, &file_stat) == 0 && S_ISREG (file_stat.st_mode));
+	ep_raise_error_if_nok ((uint64_t)file_stat.st_size > sizeof (DiagnosticsIpcSharedMemoryRing));
+	mapping_size = (size_t)file_stat.st_size;
+
+	mapping = (uint8_t *)mmap (NULL, mapping_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (mapping == (uint8_t *)MAP_FAILED) {
+		mapping = NULL;
+		ep_raise_error ();
+	}
+
+	ring = (DiagnosticsIpcSharedMemoryRing *)mapping;
+	ep_raise_error_if_nok (ring->magic == DS_IPC_SHARED_MEMORY_RING_MAGIC && ring->version == DS_IPC_SHARED_MEMORY_RING_VERSION);
+	ep_raise_error_if_nok (ring->capacity >= DS_IPC_SHARED_MEMORY_RING_MIN_CAPACITY && (ring->capacity & (ring->capacity - 1)) == 0);
+	ep_raise_error_if_nok ((uint64_t)ring->capacity <= mapping_size - sizeof (DiagnosticsIpcSharedMemoryRing));
+	ep_raise_error_if_nok (ring->state == 0 && ring->write_offset == 0 && ring->read_offset == 0);
+
+	ipc_stream->shared_memory = mapping;
+	ipc_stream->shared_memory_size = mapping_size;
+	ipc_stream->shared_memory_capacity = ring->capacity;
+	ipc_stream->shared_memory_write_offset = 0;
+	result = true;
+
+ep_on_exit:
+	close (fd);
+	return result;
+
+ep_on_error:
+	if (mapping)
+		munmap (mapping, mapping_size);
+	result = false;
+	ep_exit_error_handler ();
+#else
+	return false;
+#endif
+}
+
 bool
 ds_ipc_stream_close (
 	DiagnosticsIpcStream *ipc_stream,
@@ -1564,6 +1756,10 @@ ds_ipc_stream_close (
 {
 	EP_ASSERT (ipc_stream != NULL);
 
+#ifndef HOST_WIN32
+	ipc_stream_shared_memory_unmap (ipc_stream);
+#endif
+
 	if (ipc_stream->client_socket != DS_IPC_INVALID_SOCKET) {
 		ds_ipc_stream_flush (ipc_stream);
 
@@ -63,6 +63,11 @@ struct _DiagnosticsIpcStream_Internal {
 	IpcStream stream;
 	ds_ipc_socket_t client_socket;
 	DiagnosticsIpcConnectionMode mode;
+	// Set once trace data is redirected to a shared memory ring, see ds_ipc_stream_map_shared_memory.
+	uint8_t *shared_memory;
+	size_t shared_memory_size;
+	uint64_t shared_memory_write_offset;
+	uint32_t shared_memory_capacity;
 };
 
 #if !defined(DS_INLINE_GETTER_SETTER) && !defined(DS_IMPL_IPC_PAL_SOCKET_GETTER_SETTER)
@@ -42,6 +42,38 @@ typedef enum {
 #define DS_IPC_POLL_TIMEOUT_MIN_MS (uint32_t)10
 #define DS_IPC_POLL_TIMEOUT_MAX_MS (uint32_t)500
 
+/*
+ * DiagnosticsIpcSharedMemoryRing.
+ */
+
+// Header at the start of a shared memory ring used to stream a trace to a collector on the same
+// host. The collector creates the file, sizes it to sizeof (header) + capacity, fills in magic,
+// version and capacity (a power of 2) and zeroes the rest. The runtime only advances write_offset
+// and the collector only advances read_offset; both are free running byte counts, published with
+// release semantics after the data they cover has been copied. The data follows the header.
+#define DS_IPC_SHARED_MEMORY_RING_MAGIC (uint32_t)0x42525045 // "EPRB"
+#define DS_IPC_SHARED_MEMORY_RING_VERSION (uint32_t)1
+#define DS_IPC_SHARED_MEMORY_RING_MIN_CAPACITY (uint32_t)(64 * 1024)
+
+#define DS_IPC_SHARED_MEMORY_RING_STATE_WRITER_CLOSED (uint32_t)0x1
+#define DS_IPC_SHARED_MEMORY_RING_STATE_READER_CLOSED (uint32_t)0x2
+
+// How long the writer waits on the control connection between checks of a full ring.
+#define DS_IPC_SHARED_MEMORY_RING_FULL_WAIT_MS (uint32_t)1
+
+typedef struct _DiagnosticsIpcSharedMemoryRing {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t capacity;
+	uint32_t state;
+	uint8_t _padding0 [48];
+	// Separate cache lines, each side only writes its own.
+	uint64_t write_offset;
+	uint8_t _padding1 [56];
+	uint64_t read_offset;
+	uint8_t _padding2 [56];
+} DiagnosticsIpcSharedMemoryRing;
+
 /*
  * DiagnosticsIpcPollHandle.
  */
@@ -124,6 +124,15 @@ ds_ipc_stream_write (
 bool
 ds_ipc_stream_flush (DiagnosticsIpcStream *ipc_stream);
 
+// Redirects the data written through the stream's IpcStream (the trace) into the shared memory
+// ring at path, created and initialized by the collector (layout in ds-ipc-pal-types.h). Messages
+// sent with ds_ipc_stream_write keep going over the connection, which stays open as the control
+// channel. Returns false if the ring can't be mapped or shared memory isn't supported.
+bool
+ds_ipc_stream_map_shared_memory (
+	DiagnosticsIpcStream *ipc_stream,
+	const ep_char8_t *path);
+
 bool
 ds_ipc_stream_close (
 	DiagnosticsIpcStream *ipc_stream,
@@ -105,6 +105,14 @@ typedef enum {
 	EP_COMMANDID_COLLECT_TRACING_2 = 0x03,
 	EP_COMMANDID_COLLECT_TRACING_3 = 0x04,
 	EP_COMMANDID_COLLECT_TRACING_4 = 0x05,
+	EP_COMMANDID_COLLECT_TRACING_5 = 0x06,
+	EP_COMMANDID_COLLECT_TRACING_6 = 0x07,
+	EP_COMMANDID_COLLECT_TRACING_7 = 0x08,
+	EP_COMMANDID_COLLECT_TRACING_8 = 0x09,
+	EP_COMMANDID_TRIGGER_DUMP = 0x0A,
+	EP_COMMANDID_COLLECT_TRACING_9 = 0x0B,
+	EP_COMMANDID_COLLECT_TRACING_10 = 0x0C,
+	EP_COMMANDID_ATTACH_STARTUP_SESSION = 0x0D,
 	// future
 } EventPipeCommandId;
 
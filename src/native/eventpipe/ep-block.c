@@ -10,6 +10,14 @@
 #include "ep-file.h"
 #include "ep-rt.h"
 
+#if HAVE_LZ4
+#include <lz4.h>
+#endif
+
+#if HAVE_ZSTD
+#include <zstd.h>
+#endif
+
 /*
  * Forward declares of all static functions.
  */
@@ -28,6 +36,22 @@ block_fast_serialize_func (
 	void *object,
 	FastSerializer *fast_serializer);
 
+static
+uint32_t
+block_get_compress_bound (
+	EventPipeBlockCompression compression,
+	uint32_t size);
+
+static
+uint32_t
+block_compress (
+	EventPipeBlock *block,
+	uint32_t size);
+
+static
+void
+block_free_compression (EventPipeBlock *block);
+
 static
 void
 block_clear_func (void *object);
@@ -160,6 +184,73 @@ block_get_block_minimum_version (EventPipeSerializationFormat format)
 	}
 }
 
+static
+uint32_t
+block_get_compress_bound (
+	EventPipeBlockCompression compression,
+	uint32_t size)
+{
+	switch (compression) {
+#if HAVE_LZ4
+	case EP_BLOCK_COMPRESSION_LZ4 :
+		return (uint32_t)LZ4_compressBound ((int)size);
+#endif
+#if HAVE_ZSTD
+	case EP_BLOCK_COMPRESSION_ZSTD :
+		return (uint32_t)ZSTD_compressBound (size);
+#endif
+	default :
+		return 0;
+	}
+}
+
+// Compresses the first size bytes of the block into compressed_block, returns the compressed
+// size or 0 on failure.
+static
+uint32_t
+block_compress (
+	EventPipeBlock *block,
+	uint32_t size)
+{
+	EP_ASSERT (block != NULL);
+	EP_ASSERT (block->compressed_block != NULL);
+
+	switch (block->compression) {
+#if HAVE_LZ4
+	case EP_BLOCK_COMPRESSION_LZ4 : {
+		int result = LZ4_compress_default ((const char *)block->block, (char *)block->compressed_block, (int)size, (int)block->compressed_block_size);
+		return result > 0 ? (uint32_t)result : 0;
+	}
+#endif
+#if HAVE_ZSTD
+	case EP_BLOCK_COMPRESSION_ZSTD : {
+		// Level 1, streaming sessions care more about the cost on the traced process than the ratio.
+		size_t result = ZSTD_compressCCtx ((ZSTD_CCtx *)block->compression_context, block->compressed_block, block->compressed_block_size, block->block, size, 1);
+		return ZSTD_isError (result) ? 0 : (uint32_t)result;
+	}
+#endif
+	default :
+		return 0;
+	}
+}
+
+static
+void
+block_free_compression (EventPipeBlock *block)
+{
+	EP_ASSERT (block != NULL);
+
+#if HAVE_ZSTD
+	if (block->compression_context)
+		ZSTD_freeCCtx ((ZSTD_CCtx *)block->compression_context);
+#endif
+	block->compression_context = NULL;
+
+	ep_rt_byte_array_free (block->compressed_block);
+	block->compressed_block = NULL;
+	block->compressed_block_size = 0;
+}
+
 static
 void
 block_fast_serialize_func (
@@ -208,6 +299,11 @@ ep_block_init (
 	EP_ASSERT (block != NULL);
 	EP_ASSERT (vtable != NULL);
 
+	block->compressed_block = NULL;
+	block->compression_context = NULL;
+	block->compressed_block_size = 0;
+	block->compression = EP_BLOCK_COMPRESSION_NONE;
+
 	ep_raise_error_if_nok (ep_fast_serializable_object_init (
 		&block->fast_serializer_object,
 		(FastSerializableObjectVtable *)vtable,
@@ -236,9 +332,72 @@ void
 ep_block_fini (EventPipeBlock *block)
 {
 	ep_return_void_if_nok (block != NULL);
+	block_free_compression (block);
 	ep_rt_byte_array_free (block->block);
 }
 
+bool
+ep_block_compression_is_supported (EventPipeBlockCompression compression)
+{
+	switch (compression) {
+	case EP_BLOCK_COMPRESSION_NONE :
+		return true;
+	case EP_BLOCK_COMPRESSION_LZ4 :
+		return HAVE_LZ4 == 1;
+	case EP_BLOCK_COMPRESSION_ZSTD :
+		return HAVE_ZSTD == 1;
+	default :
+		return false;
+	}
+}
+
+bool
+ep_block_set_compression (
+	EventPipeBlock *block,
+	EventPipeBlockCompression compression)
+{
+	EP_ASSERT (block != NULL);
+	EP_ASSERT (block->compression == EP_BLOCK_COMPRESSION_NONE);
+
+	if (compression == EP_BLOCK_COMPRESSION_NONE)
+		return true;
+
+	ep_return_false_if_nok (block->format >= EP_SERIALIZATION_FORMAT_NETTRACE_V4 && ep_block_compression_is_supported (compression));
+
+	bool result = false;
+
+	block->compressed_block_size = block_get_compress_bound (compression, (uint32_t)(block->end_of_the_buffer - block->block));
+	block->compressed_block = ep_rt_byte_array_alloc (block->compressed_block_size);
+	ep_raise_error_if_nok (block->compressed_block != NULL);
+
+#if HAVE_ZSTD
+	if (compression == EP_BLOCK_COMPRESSION_ZSTD) {
+		block->compression_context = ZSTD_createCCtx ();
+		ep_raise_error_if_nok (block->compression_context != NULL);
+	}
+#endif
+
+	block->compression = compression;
+
+	// Readers that predate compression reject version 3 blocks instead of misparsing them.
+	ep_fast_serializable_object_init (
+		&block->fast_serializer_object,
+		ep_fast_serializable_object_get_vtable (&block->fast_serializer_object),
+		3,
+		3,
+		true);
+
+	result = true;
+
+ep_on_exit:
+	return result;
+
+ep_on_error:
+	block_free_compression (block);
+	EP_ASSERT (!result);
+	ep_exit_error_handler ();
+}
+
 void
 ep_block_clear_vcall (EventPipeBlock *block)
 {
@@ -326,8 +485,24 @@ ep_block_fast_serialize (
 	uint32_t data_size = ep_block_get_bytes_written (block);
 	EP_ASSERT (data_size != 0);
 
+	// Compressed blocks carry the codec actually used and the uncompressed size after the header,
+	// contents that don't shrink are stored as is.
+	const uint8_t *data = block->block;
+	uint32_t serialized_data_size = data_size;
+	uint32_t compression_info_size = 0;
+	EventPipeBlockCompression compression = EP_BLOCK_COMPRESSION_NONE;
+	if (block->compression != EP_BLOCK_COMPRESSION_NONE) {
+		compression_info_size = 2 * sizeof (uint32_t);
+		uint32_t compressed_size = block_compress (block, data_size);
+		if (compressed_size != 0 && compressed_size < data_size) {
+			data = block->compressed_block;
+			serialized_data_size = compressed_size;
+			compression = block->compression;
+		}
+	}
+
 	uint32_t header_size =  ep_block_get_header_size_vcall (block);
-	uint32_t total_size = data_size + header_size;
+	uint32_t total_size = serialized_data_size + header_size + compression_info_size;
 	ep_fast_serializer_write_uint32_t (fast_serializer, total_size);
 
 	uint32_t required_padding = ep_fast_serializer_get_required_padding (fast_serializer);
@@ -341,7 +516,11 @@ ep_block_fast_serialize (
 	}
 
 	ep_block_serialize_header_vcall (block, fast_serializer);
-	ep_fast_serializer_write_buffer (fast_serializer, block->block, data_size);
+	if (compression_info_size != 0) {
+		ep_fast_serializer_write_uint32_t (fast_serializer, (uint32_t)compression);
+		ep_fast_serializer_write_uint32_t (fast_serializer, data_size);
+	}
+	ep_fast_serializer_write_buffer (fast_serializer, data, serialized_data_size);
 }
 
 /*
@@ -43,6 +43,11 @@ struct _EventPipeBlock_Internal {
 	uint8_t *block;
 	uint8_t *write_pointer;
 	uint8_t *end_of_the_buffer;
+	// Scratch buffer and codec state used when the block contents are compressed.
+	uint8_t *compressed_block;
+	void *compression_context;
+	uint32_t compressed_block_size;
+	EventPipeBlockCompression compression;
 	EventPipeSerializationFormat format;
 };
 
@@ -57,6 +62,7 @@ EP_DEFINE_GETTER(EventPipeBlock *, block, uint8_t*, write_pointer)
 EP_DEFINE_SETTER(EventPipeBlock *, block, uint8_t*, write_pointer)
 EP_DEFINE_GETTER(EventPipeBlock *, block, uint8_t*, end_of_the_buffer)
 EP_DEFINE_GETTER(EventPipeBlock *, block, EventPipeSerializationFormat, format)
+EP_DEFINE_GETTER(EventPipeBlock *, block, EventPipeBlockCompression, compression)
 
 static
 inline
@@ -76,6 +82,22 @@ ep_block_init (
 void
 ep_block_fini (EventPipeBlock *block);
 
+// Returns true if this build of the runtime can write blocks compressed with compression.
+bool
+ep_block_compression_is_supported (EventPipeBlockCompression compression);
+
+// Compresses the contents of every block serialized from now on. Compressed blocks are
+// written with object version 3:
+//   header (same as version 2)
+//   uint32 compression (EventPipeBlockCompression, NONE if the contents didn't shrink)
+//   uint32 uncompressed size of the contents
+//   compressed contents
+// so the contents decompress to exactly what a version 2 block holds after its header.
+bool
+ep_block_set_compression (
+	EventPipeBlock *block,
+	EventPipeBlockCompression compression);
+
 void
 ep_block_clear (EventPipeBlock *block);
 
@@ -83,6 +83,18 @@ buffer_manager_release_buffer(
 	EventPipeBufferManager *buffer_manager,
 	uint32_t size);
 
+// Frees the oldest read only buffer of a flight recorder, returns false if there is none to take.
+static
+bool
+buffer_manager_try_steal_buffer (EventPipeBufferManager *buffer_manager);
+
+// Carves size bytes out of the preallocated arena, returns NULL once it is used up.
+static
+uint8_t *
+buffer_manager_try_carve_arena (
+	EventPipeBufferManager *buffer_manager,
+	uint32_t size);
+
 // An iterator that can enumerate all the events which have been written into this buffer manager.
 // Initially the iterator starts uninitialized and get_current_event () returns NULL. Calling move_next_xxx ()
 // attempts to advance the cursor to the next event. If there is no event prior to stop_timestamp then
@@ -98,6 +110,24 @@ buffer_manager_move_next_event_any_thread (
 	EventPipeBufferManager *buffer_manager,
 	ep_timestamp_t stop_timestamp);
 
+// Head of one thread's buffer list, captured by buffer_manager_snapshot_oldest_events.
+typedef struct _EventPipeBufferListCursor {
+	ep_timestamp_t timestamp;
+	EventPipeBufferList *buffer_list;
+	EventPipeBuffer *buffer;
+	EventPipeEventInstance *event;
+} EventPipeBufferListCursor;
+
+// Captures the oldest readable event prior to stop_timestamp for every thread that has one and
+// orders them by timestamp, oldest first. Only the reader thread removes events from the buffers,
+// so each captured cursor stays valid until that thread's events are read.
+static
+bool
+buffer_manager_snapshot_oldest_events (
+	EventPipeBufferManager *buffer_manager,
+	ep_timestamp_t stop_timestamp,
+	dn_vector_t *cursors);
+
 // Moves to the next oldest event from the same thread as the current event. If there is no event
 // older than stopTimeStamp then GetCurrentEvent() will return NULL. This should only be called
 // when GetCurrentEvent() is non-null (because we need to know what thread's events to iterate)
@@ -300,6 +330,73 @@ buffer_manager_release_buffer(
 	} while (new_size_of_all_buffers >= 0 && ep_rt_atomic_compare_exchange_size_t (&buffer_manager->size_of_all_buffers, old_size_of_all_buffers, new_size_of_all_buffers) != old_size_of_all_buffers);
 }
 
+static
+uint8_t *
+buffer_manager_try_carve_arena (
+	EventPipeBufferManager *buffer_manager,
+	uint32_t size)
+{
+	EP_ASSERT (buffer_manager != NULL);
+
+	ep_return_null_if_nok (buffer_manager->arena != NULL);
+
+	// The arena is never rewound, buffers freed after a flush go back to the regular allocator.
+	size_t old_arena_used;
+	size_t new_arena_used;
+	do {
+		old_arena_used = buffer_manager->arena_used;
+		new_arena_used = old_arena_used + size;
+		ep_return_null_if_nok (new_arena_used <= buffer_manager->arena_size);
+	} while (ep_rt_atomic_compare_exchange_size_t (&buffer_manager->arena_used, old_arena_used, new_arena_used) != old_arena_used);
+
+	return buffer_manager->arena + old_arena_used;
+}
+
+static
+bool
+buffer_manager_try_steal_buffer (EventPipeBufferManager *buffer_manager)
+{
+	EP_ASSERT (buffer_manager != NULL);
+	EP_ASSERT (buffer_manager->flight_recorder);
+
+	ep_buffer_manager_requires_lock_not_held (buffer_manager);
+
+	bool result = false;
+
+	EP_SPIN_LOCK_ENTER (&buffer_manager->rt_lock, section1)
+		if (!buffer_manager->flight_recorder_dumping) {
+			// A read only buffer is never written again and, outside of a dump, never read either,
+			// so it can go without synchronizing with its thread.
+			EventPipeBufferList *oldest_buffer_list = NULL;
+			EventPipeBuffer *buffer;
+			DN_LIST_FOREACH_BEGIN (EventPipeThreadSessionState *, thread_session_state, buffer_manager->thread_session_state_list) {
+				EventPipeBufferList *buffer_list = ep_thread_session_state_get_buffer_list (thread_session_state);
+				buffer = buffer_list->head_buffer;
+				if (buffer && ep_buffer_get_volatile_state (buffer) == EP_BUFFER_STATE_READ_ONLY &&
+					(!oldest_buffer_list || ep_buffer_get_creation_timestamp (buffer) < ep_buffer_get_creation_timestamp (oldest_buffer_list->head_buffer)))
+					oldest_buffer_list = buffer_list;
+			} DN_LIST_FOREACH_END;
+
+			if (oldest_buffer_list) {
+				buffer = ep_buffer_list_get_and_remove_head (oldest_buffer_list);
+				buffer_manager_deallocate_buffer (buffer_manager, buffer);
+#ifdef EP_CHECKED_BUILD
+				buffer_manager->num_buffers_stolen++;
+#endif
+				result = true;
+			}
+		}
+	EP_SPIN_LOCK_EXIT (&buffer_manager->rt_lock, section1)
+
+ep_on_exit:
+	ep_buffer_manager_requires_lock_not_held (buffer_manager);
+	return result;
+
+ep_on_error:
+	EP_ASSERT (!result);
+	ep_exit_error_handler ();
+}
+
 #ifdef EP_CHECKED_BUILD
 bool
 ep_buffer_list_ensure_consistency (EventPipeBufferList *buffer_list)
@@ -487,13 +584,14 @@ buffer_manager_allocate_buffer_for_thread (
 	// Make the buffer size fit into with pagesize-aligned block, since ep_rt_valloc0 expects page-aligned sizes to be passed as arguments
 	buffer_size = (buffer_size + ep_rt_system_get_alloc_granularity () - 1) & ~(uint32_t)(ep_rt_system_get_alloc_granularity () - 1);
 
-	// Attempt to reserve the necessary buffer size
+	// Attempt to reserve the necessary buffer size, a flight recorder makes room by dropping its oldest buffers.
 	EP_ASSERT(buffer_size > 0);
-	ep_return_null_if_nok(buffer_manager_try_reserve_buffer(buffer_manager, buffer_size));
+	while (!buffer_manager_try_reserve_buffer(buffer_manager, buffer_size))
+		ep_return_null_if_nok(buffer_manager->flight_recorder && buffer_manager_try_steal_buffer (buffer_manager));
 
 	// The sequence counter is exclusively mutated on this thread so this is a thread-local read.
 	sequence_number = ep_thread_session_state_get_volatile_sequence_number (thread_session_state);
-	new_buffer = ep_buffer_alloc (buffer_size, ep_thread_session_state_get_thread (thread_session_state), sequence_number);
+	new_buffer = ep_buffer_alloc_2 (buffer_size, ep_thread_session_state_get_thread (thread_session_state), sequence_number, buffer_manager_try_carve_arena (buffer_manager, buffer_size));
 	ep_raise_error_if_nok (new_buffer != NULL);
 
 	// Adding a buffer to the buffer list requires us to take the lock.
@@ -652,6 +750,86 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+static
+int32_t
+DN_CALLBACK_CALLTYPE
+buffer_list_cursor_compare_func (
+	const void *a,
+	const void *b)
+{
+	ep_timestamp_t timestamp_a = ((const EventPipeBufferListCursor *)a)->timestamp;
+	ep_timestamp_t timestamp_b = ((const EventPipeBufferListCursor *)b)->timestamp;
+	return (timestamp_a > timestamp_b) - (timestamp_a < timestamp_b);
+}
+
+static
+bool
+buffer_manager_snapshot_oldest_events (
+	EventPipeBufferManager *buffer_manager,
+	ep_timestamp_t stop_timestamp,
+	dn_vector_t *cursors)
+{
+	EP_ASSERT (buffer_manager != NULL);
+	EP_ASSERT (cursors != NULL);
+
+	ep_buffer_manager_requires_lock_not_held (buffer_manager);
+
+	bool result = false;
+	dn_vector_clear (cursors);
+
+	// Same two steps as buffer_manager_move_next_event_any_thread, but every non-empty thread is
+	// kept instead of only the oldest one.
+	DN_DEFAULT_LOCAL_ALLOCATOR (allocator, dn_vector_ptr_default_local_allocator_byte_size * 2);
+
+	dn_vector_ptr_t buffer_array;
+	dn_vector_ptr_t buffer_list_array;
+
+	dn_vector_ptr_custom_init_params_t params = {0, };
+	params.allocator = (dn_allocator_t *)&allocator;
+	params.capacity = dn_vector_ptr_default_local_allocator_capacity_size;
+
+	ep_raise_error_if_nok (dn_vector_ptr_custom_init (&buffer_array, &params));
+	ep_raise_error_if_nok (dn_vector_ptr_custom_init (&buffer_list_array, &params));
+
+	EP_SPIN_LOCK_ENTER (&buffer_manager->rt_lock, section1)
+		EventPipeBufferList *buffer_list;
+		EventPipeBuffer *buffer;
+		DN_LIST_FOREACH_BEGIN (EventPipeThreadSessionState *, thread_session_state, buffer_manager->thread_session_state_list) {
+			buffer_list = ep_thread_session_state_get_buffer_list (thread_session_state);
+			buffer = buffer_list->head_buffer;
+			if (buffer && ep_buffer_get_creation_timestamp (buffer) < stop_timestamp) {
+				dn_vector_ptr_push_back (&buffer_list_array, buffer_list);
+				dn_vector_ptr_push_back (&buffer_array, buffer);
+			}
+		} DN_LIST_FOREACH_END;
+	EP_SPIN_LOCK_EXIT (&buffer_manager->rt_lock, section1)
+
+	EventPipeBufferListCursor cursor;
+	for (uint32_t i = 0; i < dn_vector_ptr_size (&buffer_array) && i < dn_vector_ptr_size (&buffer_list_array); ++i) {
+		cursor.buffer_list = (EventPipeBufferList *)*dn_vector_ptr_index (&buffer_list_array, i);
+		cursor.buffer = buffer_manager_advance_to_non_empty_buffer (buffer_manager, cursor.buffer_list, (EventPipeBuffer *)*dn_vector_ptr_index (&buffer_array, i), stop_timestamp);
+		if (cursor.buffer) {
+			cursor.event = ep_buffer_get_current_read_event (cursor.buffer);
+			if (cursor.event && ep_event_instance_get_timestamp (cursor.event) < stop_timestamp) {
+				cursor.timestamp = ep_event_instance_get_timestamp (cursor.event);
+				ep_raise_error_if_nok (dn_vector_push_back (cursors, cursor));
+			}
+		}
+	}
+
+	dn_vector_sort (cursors, buffer_list_cursor_compare_func);
+	result = true;
+
+ep_on_exit:
+	ep_buffer_manager_requires_lock_not_held (buffer_manager);
+	dn_vector_ptr_dispose (&buffer_list_array);
+	dn_vector_ptr_dispose (&buffer_array);
+	return result;
+
+ep_on_error:
+	ep_exit_error_handler ();
+}
+
 static
 void
 buffer_manager_move_next_event_same_thread (
@@ -798,7 +976,6 @@ ep_on_exit:
 	return result;
 
 ep_on_error:
-	EP_ASSERT (!result);
 	ep_exit_error_handler ();
 }
 
@@ -826,6 +1003,11 @@ ep_buffer_manager_alloc (
 	instance->session = session;
 	instance->size_of_all_buffers = 0;
 	instance->num_oversized_events_dropped = 0;
+	instance->flight_recorder = false;
+	instance->flight_recorder_dumping = false;
+	instance->arena = NULL;
+	instance->arena_size = 0;
+	instance->arena_used = 0;
 
 #ifdef EP_CHECKED_BUILD
 	instance->num_buffers_allocated = 0;
@@ -867,6 +1049,9 @@ ep_buffer_manager_free (EventPipeBufferManager * buffer_manager)
 
 	ep_buffer_manager_deallocate_buffers (buffer_manager);
 
+	if (buffer_manager->arena)
+		ep_rt_vfree (buffer_manager->arena, buffer_manager->arena_size);
+
 	dn_list_free (buffer_manager->sequence_points);
 
 	dn_list_free (buffer_manager->thread_session_state_list);
@@ -878,6 +1063,55 @@ ep_buffer_manager_free (EventPipeBufferManager * buffer_manager)
 	ep_rt_object_free (buffer_manager);
 }
 
+void
+ep_buffer_manager_enable_flight_recorder (EventPipeBufferManager *buffer_manager)
+{
+	EP_ASSERT (buffer_manager != NULL);
+	EP_ASSERT (dn_list_empty (buffer_manager->thread_session_state_list));
+
+	buffer_manager->flight_recorder = true;
+	buffer_manager->sequence_point_alloc_budget = 0;
+	buffer_manager->remaining_sequence_point_alloc_budget = 0;
+}
+
+bool
+ep_buffer_manager_alloc_arena (EventPipeBufferManager *buffer_manager)
+{
+	EP_ASSERT (buffer_manager != NULL);
+	EP_ASSERT (buffer_manager->arena == NULL);
+	EP_ASSERT (dn_list_empty (buffer_manager->thread_session_state_list));
+
+	size_t arena_size = (buffer_manager->max_size_of_all_buffers + ep_rt_system_get_alloc_granularity () - 1) & ~(size_t)(ep_rt_system_get_alloc_granularity () - 1);
+	buffer_manager->arena = ep_rt_valloc0 (arena_size);
+	ep_return_false_if_nok (buffer_manager->arena != NULL);
+
+	buffer_manager->arena_size = arena_size;
+	buffer_manager->arena_used = 0;
+	return true;
+}
+
+void
+ep_buffer_manager_set_flight_recorder_dumping (
+	EventPipeBufferManager *buffer_manager,
+	bool dumping)
+{
+	EP_ASSERT (buffer_manager != NULL);
+	EP_ASSERT (buffer_manager->flight_recorder);
+
+	ep_buffer_manager_requires_lock_not_held (buffer_manager);
+
+	EP_SPIN_LOCK_ENTER (&buffer_manager->rt_lock, section1)
+		buffer_manager->flight_recorder_dumping = dumping;
+	EP_SPIN_LOCK_EXIT (&buffer_manager->rt_lock, section1)
+
+ep_on_exit:
+	ep_buffer_manager_requires_lock_not_held (buffer_manager);
+	return;
+
+ep_on_error:
+	ep_exit_error_handler ();
+}
+
 #ifdef EP_CHECKED_BUILD
 void
 ep_buffer_manager_requires_lock_held (const EventPipeBufferManager *buffer_manager)
@@ -1210,7 +1444,9 @@ ep_buffer_manager_write_all_buffers_to_file_v4 (
 	params.capacity = dn_vector_ptr_default_local_allocator_capacity_size;
 
 	dn_vector_ptr_t session_states_to_delete;
+	dn_vector_t cursors = {0, };
 	ep_raise_error_if_nok (dn_vector_ptr_custom_init (&session_states_to_delete, &params));
+	ep_raise_error_if_nok (dn_vector_init_t (&cursors, EventPipeBufferListCursor));
 
 	EP_SPIN_LOCK_ENTER (&buffer_manager->rt_lock, section1)
 		if (buffer_manager_try_peek_sequence_point (buffer_manager, &sequence_point))
@@ -1221,32 +1457,42 @@ ep_buffer_manager_write_all_buffers_to_file_v4 (
 	while(true) {
 		 // loop across events within a sequence point boundary
 		while (true) {
-			// pick the thread that has the oldest event
-			buffer_manager_move_next_event_any_thread (buffer_manager, current_timestamp_boundary);
-			if (buffer_manager->current_event == NULL)
+			// Order the threads by their oldest event once, rather than rescanning every thread (and taking
+			// every writer thread's lock) each time one thread has been drained. A thread's head event is older
+			// than the heads of the threads after it, and anything written since the snapshot is newer still,
+			// so the first event of each thread is still the oldest one cached at the time it is emitted.
+			ep_raise_error_if_nok (buffer_manager_snapshot_oldest_events (buffer_manager, current_timestamp_boundary, &cursors));
+			if (dn_vector_size (&cursors) == 0)
 				break;
 
-			uint64_t capture_thread_id = ep_thread_get_os_thread_id (ep_buffer_get_writer_thread (buffer_manager->current_buffer));
+			for (uint32_t cursor_index = 0; cursor_index < dn_vector_size (&cursors); ++cursor_index) {
+				EventPipeBufferListCursor *cursor = dn_vector_index_t (&cursors, EventPipeBufferListCursor, cursor_index);
+				buffer_manager->current_event = cursor->event;
+				buffer_manager->current_buffer = cursor->buffer;
+				buffer_manager->current_buffer_list = cursor->buffer_list;
 
-			EventPipeBufferList *buffer_list = buffer_manager->current_buffer_list;
+				uint64_t capture_thread_id = ep_thread_get_os_thread_id (ep_buffer_get_writer_thread (buffer_manager->current_buffer));
 
-			// loop across events on this thread
-			bool events_written_for_thread = false;
+				EventPipeBufferList *buffer_list = buffer_manager->current_buffer_list;
 
-			uint32_t sequence_number = 0;
+				// loop across events on this thread
+				bool events_written_for_thread = false;
 
-			while (buffer_manager->current_event != NULL) {
-				// The first event emitted on each thread (detected by !events_written_for_thread) is guaranteed to
-				// be the oldest  event cached in our buffers so we mark it. This implements mechanism #2
-				// in the big comment above.
-				sequence_number = ep_buffer_get_current_sequence_number (buffer_manager->current_buffer);
-				ep_file_write_event (file, buffer_manager->current_event, capture_thread_id, sequence_number, !events_written_for_thread);
-				events_written_for_thread = true;
-				buffer_manager_move_next_event_same_thread (buffer_manager, current_timestamp_boundary);
+				uint32_t sequence_number = 0;
+
+				while (buffer_manager->current_event != NULL) {
+					// The first event emitted on each thread (detected by !events_written_for_thread) is guaranteed to
+					// be the oldest  event cached in our buffers so we mark it. This implements mechanism #2
+					// in the big comment above.
+					sequence_number = ep_buffer_get_current_sequence_number (buffer_manager->current_buffer);
+					ep_file_write_event (file, buffer_manager->current_event, capture_thread_id, sequence_number, !events_written_for_thread);
+					events_written_for_thread = true;
+					buffer_manager_move_next_event_same_thread (buffer_manager, current_timestamp_boundary);
+				}
+				buffer_list->last_read_sequence_number = sequence_number;
+				// Have we written events in any sequence point?
+				*events_written = events_written_for_thread || *events_written;
 			}
-			buffer_list->last_read_sequence_number = sequence_number;
-			// Have we written events in any sequence point?
-			*events_written = events_written_for_thread || *events_written;
 		}
 
 		// This finishes any current partially filled EventPipeBlock, and flushes it to the stream
@@ -1349,6 +1595,7 @@ ep_buffer_manager_write_all_buffers_to_file_v4 (
 	} DN_VECTOR_PTR_FOREACH_END;
 
 ep_on_exit:
+	dn_vector_dispose (&cursors);
 	dn_vector_ptr_dispose (&session_states_to_delete);
 	return;
 ep_on_error:
@@ -128,6 +128,16 @@ struct _EventPipeBufferManager_Internal {
 	// number of times an event was dropped due to it being too
 	// large to fit in the 64KB size limit
 	volatile int64_t num_oversized_events_dropped;
+	// When set, the oldest read only buffers are stolen to make room for new ones instead of
+	// dropping events once max_size_of_all_buffers is reached.
+	bool flight_recorder;
+	// Set while a flight recorder is being written out, buffers are not stolen then.
+	// Protected by rt_lock.
+	bool flight_recorder_dumping;
+	// When set, buffers are carved out of this block, allocated up front, until it is used up.
+	uint8_t *arena;
+	size_t arena_size;
+	volatile size_t arena_used;
 
 #ifdef EP_CHECKED_BUILD
 	volatile int64_t num_events_stored;
@@ -156,6 +166,22 @@ ep_buffer_manager_alloc (
 void
 ep_buffer_manager_free (EventPipeBufferManager *buffer_manager);
 
+// Keeps the buffers as a ring, see EventPipeSessionFlightRecorder. Sequence points are disabled
+// since nothing drains them until a dump. Must be called before any event is written.
+void
+ep_buffer_manager_enable_flight_recorder (EventPipeBufferManager *buffer_manager);
+
+// Allocates max_size_of_all_buffers up front, new buffers are then carved out of it instead of
+// going to the allocator until it is used up. Must be called before any event is written.
+bool
+ep_buffer_manager_alloc_arena (EventPipeBufferManager *buffer_manager);
+
+// Suspends buffer stealing while the reader walks the buffers.
+void
+ep_buffer_manager_set_flight_recorder_dumping (
+	EventPipeBufferManager *buffer_manager,
+	bool dumping);
+
 #ifdef EP_CHECKED_BUILD
 void
 ep_buffer_manager_requires_lock_held (const EventPipeBufferManager *buffer_manager);
@@ -20,6 +20,16 @@ ep_buffer_alloc (
 	uint32_t buffer_size,
 	EventPipeThread *writer_thread,
 	uint32_t event_sequence_number)
+{
+	return ep_buffer_alloc_2 (buffer_size, writer_thread, event_sequence_number, NULL);
+}
+
+EventPipeBuffer *
+ep_buffer_alloc_2 (
+	uint32_t buffer_size,
+	EventPipeThread *writer_thread,
+	uint32_t event_sequence_number,
+	uint8_t *memory)
 {
 	EventPipeBuffer *instance = ep_rt_object_alloc (EventPipeBuffer);
 	ep_raise_error_if_nok (instance != NULL);
@@ -27,7 +37,8 @@ ep_buffer_alloc (
 	instance->writer_thread = writer_thread;
 	instance->event_sequence_number = event_sequence_number;
 
-	instance->buffer = ep_rt_valloc0 (buffer_size);
+	instance->owns_buffer = memory == NULL;
+	instance->buffer = memory ? memory : ep_rt_valloc0 (buffer_size);
 	ep_raise_error_if_nok (instance->buffer);
 
 	instance->limit = instance->buffer + buffer_size;
@@ -59,7 +70,8 @@ ep_buffer_free (EventPipeBuffer *buffer)
 	// We should never be deleting a buffer that a writer thread might still try to write to
 	EP_ASSERT (ep_rt_volatile_load_uint32_t (&buffer->state) == (uint32_t)EP_BUFFER_STATE_READ_ONLY);
 
-	ep_rt_vfree (buffer->buffer, buffer->limit - buffer->buffer);
+	if (buffer->owns_buffer)
+		ep_rt_vfree (buffer->buffer, buffer->limit - buffer->buffer);
 	ep_rt_object_free (buffer);
 }
 
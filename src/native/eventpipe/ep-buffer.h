@@ -63,6 +63,8 @@ struct _EventPipeBuffer_Internal {
 	// The sequence number corresponding to current_read_event
 	// Prior to read iteration it is the sequence number of the first event in the buffer
 	uint32_t event_sequence_number;
+	// False when the memory was carved out of a buffer manager arena, it is then not freed with the buffer.
+	bool owns_buffer;
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_BUFFER_GETTER_SETTER)
@@ -87,6 +89,15 @@ ep_buffer_alloc (
 	EventPipeThread *writer_thread,
 	uint32_t event_sequence_number);
 
+// Same as ep_buffer_alloc but writes into memory, when not NULL, instead of allocating it.
+// The caller keeps ownership of memory, which must be buffer_size bytes long.
+EventPipeBuffer *
+ep_buffer_alloc_2 (
+	uint32_t buffer_size,
+	EventPipeThread *writer_thread,
+	uint32_t event_sequence_number,
+	uint8_t *memory);
+
 void
 ep_buffer_free (EventPipeBuffer *buffer);
 
@@ -0,0 +1,388 @@
+#include "ep-rt-config.h"
+
+#ifdef ENABLE_PERFTRACING
+#if !defined(EP_INCLUDE_SOURCE_FILES) || defined(EP_FORCE_INCLUDE_SOURCE_FILES)
+
+#define EP_IMPL_EVENT_FILTER_GETTER_SETTER
+#include "ep.h"
+#include "ep-event.h"
+#include "ep-event-filter.h"
+#include "ep-event-payload.h"
+#include "ep-provider.h"
+#include "ep-rt.h"
+
+#include <float.h>
+
+/*
+ * Forward declares of all static functions.
+ */
+
+static
+bool
+event_filter_next_field (
+	const ep_char8_t **cursor,
+	const ep_char8_t *entry_end,
+	const ep_char8_t **start,
+	const ep_char8_t **end);
+
+static
+bool
+event_filter_parse_uint64_t (
+	const ep_char8_t *start,
+	const ep_char8_t *end,
+	uint64_t *value);
+
+static
+bool
+event_filter_parse_uint32_t (
+	const ep_char8_t *start,
+	const ep_char8_t *end,
+	uint32_t *value);
+
+static
+bool
+event_filter_parse_double (
+	const ep_char8_t *start,
+	const ep_char8_t *end,
+	double *value);
+
+static
+bool
+event_filter_parse_predicate (
+	EventPipeEventPredicate *predicate,
+	const ep_char8_t *entry,
+	const ep_char8_t *entry_end);
+
+static
+bool
+event_filter_parse_config (
+	EventPipeEventFilter *filter,
+	const ep_char8_t *config);
+
+static
+bool
+event_predicate_evaluate (
+	const EventPipeEventPredicate *predicate,
+	EventPipeEventPayload *payload);
+
+/*
+ * EventPipeEventFilter.
+ */
+
+static
+bool
+event_filter_next_field (
+	const ep_char8_t **cursor,
+	const ep_char8_t *entry_end,
+	const ep_char8_t **start,
+	const ep_char8_t **end)
+{
+	EP_ASSERT (cursor != NULL);
+	EP_ASSERT (start != NULL);
+	EP_ASSERT (end != NULL);
+
+	if (*cursor > entry_end)
+		return false;
+
+	*start = *cursor;
+	while (*cursor < entry_end && **cursor != ':')
+		(*cursor)++;
+
+	*end = *cursor;
+
+	// Step over the separator, past the end once the last field has been consumed.
+	(*cursor)++;
+	return *end != *start;
+}
+
+static
+bool
+event_filter_parse_uint64_t (
+	const ep_char8_t *start,
+	const ep_char8_t *end,
+	uint64_t *value)
+{
+	EP_ASSERT (value != NULL);
+
+	ep_char8_t *value_as_utf8 = ep_rt_utf8_string_dup_range (start, end);
+	ep_return_false_if_nok (value_as_utf8 != NULL);
+
+	ep_char8_t *value_end = NULL;
+	*value = strtoull (value_as_utf8, &value_end, 0);
+	bool result = value_end != value_as_utf8 && *value_end == '\0';
+
+	ep_rt_utf8_string_free (value_as_utf8);
+	return result;
+}
+
+static
+bool
+event_filter_parse_uint32_t (
+	const ep_char8_t *start,
+	const ep_char8_t *end,
+	uint32_t *value)
+{
+	EP_ASSERT (value != NULL);
+
+	uint64_t parsed = 0;
+	ep_return_false_if_nok (event_filter_parse_uint64_t (start, end, &parsed) && parsed <= UINT32_MAX);
+
+	*value = (uint32_t)parsed;
+	return true;
+}
+
+static
+bool
+event_filter_parse_double (
+	const ep_char8_t *start,
+	const ep_char8_t *end,
+	double *value)
+{
+	EP_ASSERT (value != NULL);
+
+	ep_char8_t *value_as_utf8 = ep_rt_utf8_string_dup_range (start, end);
+	ep_return_false_if_nok (value_as_utf8 != NULL);
+
+	ep_char8_t *value_end = NULL;
+	*value = strtod (value_as_utf8, &value_end);
+	bool result = value_end != value_as_utf8 && *value_end == '\0';
+
+	ep_rt_utf8_string_free (value_as_utf8);
+	return result;
+}
+
+static
+bool
+event_filter_parse_predicate (
+	EventPipeEventPredicate *predicate,
+	const ep_char8_t *entry,
+	const ep_char8_t *entry_end)
+{
+	EP_ASSERT (predicate != NULL);
+
+	const ep_char8_t *cursor = entry;
+	const ep_char8_t *start = NULL;
+	const ep_char8_t *end = NULL;
+
+	ep_return_false_if_nok (event_filter_next_field (&cursor, entry_end, &start, &end));
+	predicate->provider_name = ep_rt_utf8_string_dup_range (start, end);
+	ep_return_false_if_nok (predicate->provider_name != NULL);
+
+	ep_return_false_if_nok (event_filter_next_field (&cursor, entry_end, &start, &end));
+	ep_return_false_if_nok (event_filter_parse_uint32_t (start, end, &predicate->event_id));
+
+	ep_return_false_if_nok (event_filter_next_field (&cursor, entry_end, &start, &end));
+	ep_return_false_if_nok (event_filter_parse_uint32_t (start, end, &predicate->field_offset));
+
+	ep_return_false_if_nok (event_filter_next_field (&cursor, entry_end, &start, &end));
+	if (end - start == 1 && (*start == 's' || *start == 'p')) {
+		predicate->kind = *start == 's' ? EP_EVENT_PREDICATE_KIND_TEXT_EQUALS : EP_EVENT_PREDICATE_KIND_TEXT_PREFIX;
+		ep_return_false_if_nok (event_filter_next_field (&cursor, entry_end, &start, &end));
+
+		ep_char8_t *text = ep_rt_utf8_string_dup_range (start, end);
+		ep_return_false_if_nok (text != NULL);
+		predicate->text = ep_rt_utf8_to_utf16le_string (text);
+		ep_rt_utf8_string_free (text);
+
+		return predicate->text != NULL && cursor > entry_end;
+	}
+
+	if (end - start == 1 && *start == 'd') {
+		predicate->kind = EP_EVENT_PREDICATE_KIND_DOUBLE;
+		predicate->field_size = sizeof (double);
+		ep_return_false_if_nok (event_filter_next_field (&cursor, entry_end, &start, &end));
+		ep_return_false_if_nok (event_filter_parse_double (start, end, &predicate->min_double));
+
+		// The upper bound is optional.
+		predicate->max_double = DBL_MAX;
+		if (event_filter_next_field (&cursor, entry_end, &start, &end))
+			ep_return_false_if_nok (event_filter_parse_double (start, end, &predicate->max_double));
+
+		return cursor > entry_end && predicate->min_double <= predicate->max_double;
+	}
+
+	predicate->kind = EP_EVENT_PREDICATE_KIND_UNSIGNED;
+	ep_return_false_if_nok (event_filter_parse_uint32_t (start, end, &predicate->field_size));
+	ep_return_false_if_nok (predicate->field_size == 1 || predicate->field_size == 2 || predicate->field_size == 4 || predicate->field_size == 8);
+	ep_return_false_if_nok (event_filter_next_field (&cursor, entry_end, &start, &end));
+	ep_return_false_if_nok (event_filter_parse_uint64_t (start, end, &predicate->min));
+
+	// The upper bound is optional.
+	predicate->max = UINT64_MAX;
+	if (event_filter_next_field (&cursor, entry_end, &start, &end))
+		ep_return_false_if_nok (event_filter_parse_uint64_t (start, end, &predicate->max));
+
+	return cursor > entry_end && predicate->min <= predicate->max;
+}
+
+static
+bool
+event_filter_parse_config (
+	EventPipeEventFilter *filter,
+	const ep_char8_t *config)
+{
+	EP_ASSERT (filter != NULL);
+	EP_ASSERT (config != NULL);
+
+	const ep_char8_t *entry = config;
+
+	while (*entry != '\0') {
+		const ep_char8_t *entry_end = entry;
+		while (*entry_end != '\0' && *entry_end != ',')
+			entry_end++;
+
+		EventPipeEventPredicate predicate;
+		memset (&predicate, 0, sizeof (predicate));
+
+		// Ownership transferred, freed with the filter.
+		if (!dn_vector_push_back (filter->predicates, predicate))
+			return false;
+
+		EventPipeEventPredicate *added = dn_vector_index_t (filter->predicates, EventPipeEventPredicate, dn_vector_size (filter->predicates) - 1);
+		ep_return_false_if_nok (event_filter_parse_predicate (added, entry, entry_end));
+
+		entry = *entry_end == ',' ? entry_end + 1 : entry_end;
+	}
+
+	return dn_vector_size (filter->predicates) != 0;
+}
+
+EventPipeEventFilter *
+ep_event_filter_alloc (const ep_char8_t *config)
+{
+	ep_return_null_if_nok (config != NULL);
+
+	EventPipeEventFilter *instance = ep_rt_object_alloc (EventPipeEventFilter);
+	ep_raise_error_if_nok (instance != NULL);
+
+	instance->predicates = dn_vector_alloc_t (EventPipeEventPredicate);
+	ep_raise_error_if_nok (instance->predicates != NULL);
+
+	ep_raise_error_if_nok (event_filter_parse_config (instance, config));
+
+ep_on_exit:
+	return instance;
+
+ep_on_error:
+	ep_event_filter_free (instance);
+	instance = NULL;
+	ep_exit_error_handler ();
+}
+
+void
+ep_event_filter_free (EventPipeEventFilter *filter)
+{
+	ep_return_void_if_nok (filter != NULL);
+
+	if (filter->predicates) {
+		DN_VECTOR_FOREACH_BEGIN (EventPipeEventPredicate, predicate, filter->predicates) {
+			ep_rt_utf8_string_free (predicate.provider_name);
+			ep_rt_utf16_string_free (predicate.text);
+		} DN_VECTOR_FOREACH_END;
+		dn_vector_free (filter->predicates);
+	}
+
+	ep_rt_object_free (filter);
+}
+
+static
+bool
+event_predicate_evaluate (
+	const EventPipeEventPredicate *predicate,
+	EventPipeEventPayload *payload)
+{
+	EP_ASSERT (predicate != NULL);
+
+	ep_return_false_if_nok (payload != NULL);
+
+	// Fields are read straight out of the payload, which is only flattened later on if the
+	// event is kept. Payload strings aren't necessarily aligned.
+	if (predicate->kind == EP_EVENT_PREDICATE_KIND_TEXT_EQUALS || predicate->kind == EP_EVENT_PREDICATE_KIND_TEXT_PREFIX) {
+		const ep_char16_t *text = predicate->text;
+		ep_char16_t c;
+		for (uint32_t offset = predicate->field_offset; ep_event_payload_copy_range (payload, offset, (uint8_t *)&c, sizeof (c)); offset += sizeof (c)) {
+			if (*text == 0)
+				return c == 0 || predicate->kind == EP_EVENT_PREDICATE_KIND_TEXT_PREFIX;
+			if (c != *text)
+				return false;
+			text++;
+		}
+		return false;
+	}
+
+	if (predicate->kind == EP_EVENT_PREDICATE_KIND_DOUBLE) {
+		double value;
+		ep_return_false_if_nok (ep_event_payload_copy_range (payload, predicate->field_offset, (uint8_t *)&value, sizeof (value)));
+		return value >= predicate->min_double && value <= predicate->max_double;
+	}
+
+	uint64_t value = 0;
+	switch (predicate->field_size) {
+	case 1 : {
+		uint8_t field;
+		ep_return_false_if_nok (ep_event_payload_copy_range (payload, predicate->field_offset, &field, sizeof (field)));
+		value = field;
+		break;
+	}
+	case 2 : {
+		uint16_t field;
+		ep_return_false_if_nok (ep_event_payload_copy_range (payload, predicate->field_offset, (uint8_t *)&field, sizeof (field)));
+		value = field;
+		break;
+	}
+	case 4 : {
+		uint32_t field;
+		ep_return_false_if_nok (ep_event_payload_copy_range (payload, predicate->field_offset, (uint8_t *)&field, sizeof (field)));
+		value = field;
+		break;
+	}
+	default : {
+		ep_return_false_if_nok (ep_event_payload_copy_range (payload, predicate->field_offset, (uint8_t *)&value, sizeof (value)));
+		break;
+	}
+	}
+
+	return value >= predicate->min && value <= predicate->max;
+}
+
+bool
+ep_event_filter_is_event_allowed (
+	const EventPipeEventFilter *filter,
+	EventPipeEvent *ep_event,
+	EventPipeEventPayload *payload)
+{
+	EP_ASSERT (filter != NULL);
+	EP_ASSERT (ep_event != NULL);
+
+	bool has_predicates = false;
+	const uint32_t event_id = ep_event_get_event_id (ep_event);
+	const ep_char8_t *provider_name = NULL;
+
+	for (uint32_t i = 0; i < dn_vector_size (filter->predicates); ++i) {
+		const EventPipeEventPredicate *predicate = dn_vector_index_t (filter->predicates, EventPipeEventPredicate, i);
+
+		// Event ids are compared first, the provider name only for the few candidates left.
+		if (predicate->event_id != event_id)
+			continue;
+
+		if (!provider_name)
+			provider_name = ep_provider_get_provider_name (ep_event_get_provider (ep_event));
+		if (ep_rt_utf8_string_compare_ignore_case (predicate->provider_name, provider_name) != 0)
+			continue;
+
+		if (event_predicate_evaluate (predicate, payload))
+			return true;
+
+		has_predicates = true;
+	}
+
+	return !has_predicates;
+}
+
+#endif /* !defined(EP_INCLUDE_SOURCE_FILES) || defined(EP_FORCE_INCLUDE_SOURCE_FILES) */
+#endif /* ENABLE_PERFTRACING */
+
+#if !defined(ENABLE_PERFTRACING) || (defined(EP_INCLUDE_SOURCE_FILES) && !defined(EP_FORCE_INCLUDE_SOURCE_FILES))
+extern const char quiet_linker_empty_file_warning_eventpipe_event_filter;
+const char quiet_linker_empty_file_warning_eventpipe_event_filter = 0;
+#endif
@@ -0,0 +1,97 @@
+#ifndef __EVENTPIPE_EVENT_FILTER_H__
+#define __EVENTPIPE_EVENT_FILTER_H__
+
+#include "ep-rt-config.h"
+
+#ifdef ENABLE_PERFTRACING
+#include "ep-types.h"
+
+#undef EP_IMPL_GETTER_SETTER
+#ifdef EP_IMPL_EVENT_FILTER_GETTER_SETTER
+#define EP_IMPL_GETTER_SETTER
+#endif
+#include "ep-getter-setter.h"
+
+typedef enum {
+	// Unsigned field of 1, 2, 4 or 8 bytes in [min, max].
+	EP_EVENT_PREDICATE_KIND_UNSIGNED,
+	// Double field in [min_double, max_double].
+	EP_EVENT_PREDICATE_KIND_DOUBLE,
+	// UTF-16 field equal to the text.
+	EP_EVENT_PREDICATE_KIND_TEXT_EQUALS,
+	// UTF-16 field starting with the text.
+	EP_EVENT_PREDICATE_KIND_TEXT_PREFIX
+} EventPipeEventPredicateKind;
+
+/*
+ * EventPipeEventPredicate.
+ */
+
+#if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_EVENT_FILTER_GETTER_SETTER)
+struct _EventPipeEventPredicate {
+#else
+struct _EventPipeEventPredicate_Internal {
+#endif
+	ep_char8_t *provider_name;
+	ep_char16_t *text;
+	uint64_t min;
+	uint64_t max;
+	double min_double;
+	double max_double;
+	EventPipeEventPredicateKind kind;
+	uint32_t event_id;
+	uint32_t field_offset;
+	uint32_t field_size;
+};
+
+#if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_EVENT_FILTER_GETTER_SETTER)
+struct _EventPipeEventPredicate {
+	uint8_t _internal [sizeof (struct _EventPipeEventPredicate_Internal)];
+};
+#endif
+
+/*
+ * EventPipeEventFilter.
+ */
+
+// Payload predicates of a session, evaluated before an event goes into the session buffers.
+// An event with predicates is kept if any of them holds, events without any are not affected.
+#if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_EVENT_FILTER_GETTER_SETTER)
+struct _EventPipeEventFilter {
+#else
+struct _EventPipeEventFilter_Internal {
+#endif
+	// Array of EventPipeEventPredicate.
+	dn_vector_t *predicates;
+};
+
+#if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_EVENT_FILTER_GETTER_SETTER)
+struct _EventPipeEventFilter {
+	uint8_t _internal [sizeof (struct _EventPipeEventFilter_Internal)];
+};
+#endif
+
+// config is a comma separated list of predicates:
+//   ProviderName:EventID:FieldOffset:FieldSize:Min[:Max] unsigned field (1, 2, 4 or 8 bytes) in [Min, Max]
+//   ProviderName:EventID:FieldOffset:d:Min[:Max]         double field in [Min, Max]
+//   ProviderName:EventID:FieldOffset:s:Text              UTF-16 field equal to Text
+//   ProviderName:EventID:FieldOffset:p:Text              UTF-16 field starting with Text
+// For instance Microsoft-Windows-DotNETRuntime:91:3:d:1000000 only keeps ContentionStop_V1 events
+// of a millisecond or more and Microsoft-Windows-DotNETRuntime:10:26:p:MyApp. only keeps
+// GCAllocationTick_V4 events of MyApp types (64-bit processes, TypeName follows an 8 byte TypeID).
+// Returns NULL if it doesn't parse.
+EventPipeEventFilter *
+ep_event_filter_alloc (const ep_char8_t *config);
+
+void
+ep_event_filter_free (EventPipeEventFilter *filter);
+
+// Returns false if the event has predicates and none of them holds.
+bool
+ep_event_filter_is_event_allowed (
+	const EventPipeEventFilter *filter,
+	EventPipeEvent *ep_event,
+	EventPipeEventPayload *payload);
+
+#endif /* ENABLE_PERFTRACING */
+#endif /* __EVENTPIPE_EVENT_FILTER_H__ */
@@ -150,6 +150,42 @@ ep_event_payload_copy_data (
 	}
 }
 
+bool
+ep_event_payload_copy_range (
+	const EventPipeEventPayload *event_payload,
+	uint32_t offset,
+	uint8_t *dst,
+	uint32_t len)
+{
+	EP_ASSERT (event_payload != NULL);
+	EP_ASSERT (dst != NULL || len == 0);
+
+	if (offset > event_payload->size || len > event_payload->size - offset)
+		return false;
+
+	if (ep_event_payload_is_flattened (event_payload)) {
+		memcpy (dst, event_payload->data + offset, len);
+		return true;
+	}
+
+	EventData *event_data = event_payload->event_data;
+	for (uint32_t i = 0; i < event_payload->event_data_len && len > 0; ++i) {
+		uint32_t size = ep_event_data_get_size (&event_data[i]);
+		if (offset >= size) {
+			offset -= size;
+			continue;
+		}
+
+		uint32_t count = (size - offset < len) ? size - offset : len;
+		memcpy (dst, (uint8_t *)(uintptr_t)ep_event_data_get_ptr (&event_data[i]) + offset, count);
+		dst += count;
+		len -= count;
+		offset = 0;
+	}
+
+	return len == 0;
+}
+
 void
 ep_event_payload_flatten (EventPipeEventPayload *event_payload)
 {
@@ -88,6 +88,15 @@ ep_event_payload_is_flattened (const EventPipeEventPayload *event_payload)
 	return (ep_event_payload_get_data (event_payload) != NULL);
 }
 
+// Copies len bytes starting at offset out of the payload without flattening it.
+// Returns false if the range isn't within the payload.
+bool
+ep_event_payload_copy_range (
+	const EventPipeEventPayload *event_payload,
+	uint32_t offset,
+	uint8_t *dst,
+	uint32_t len);
+
 // Build this payload with a flat buffer inside.
 EventPipeEventPayload *
 ep_event_payload_init (
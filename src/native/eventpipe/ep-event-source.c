@@ -56,6 +56,17 @@ const ep_char8_t* _ep_arch_info = "Unknown";
 
 EventPipeEventSource _ep_event_source_instance = { 0 };
 
+static const ep_char8_t *_ep_aggregate_event_arg_names [] = {
+	"ProviderName",
+	"EventID",
+	"FieldOffset",
+	"Count",
+	"Sum",
+	"Min",
+	"Max",
+	"Histogram"
+};
+
 /*
  * Forward declares of all static functions.
  */
@@ -99,6 +110,9 @@ ep_event_source_init (EventPipeEventSource *event_source)
 	ep_char16_t *arch_info_arg_utf16 = NULL;
 	ep_char16_t *event_name_utf16  = NULL;
 	uint8_t *metadata = NULL;
+	ep_char16_t *aggregate_event_name_utf16 = NULL;
+	ep_char16_t *aggregate_arg_names_utf16 [ARRAY_SIZE (_ep_aggregate_event_arg_names)] = { 0 };
+	uint8_t *aggregate_metadata = NULL;
 
 	EP_ASSERT (event_source != NULL);
 
@@ -155,13 +169,64 @@ ep_event_source_init (EventPipeEventSource *event_source)
 
 	ep_raise_error_if_nok (event_source->process_info_event);
 
+	// Generate the aggregate event metadata.
+	EventPipeParameterDesc aggregate_params [ARRAY_SIZE (_ep_aggregate_event_arg_names)];
+	for (uint32_t i = 0; i < ARRAY_SIZE (_ep_aggregate_event_arg_names); ++i) {
+		aggregate_arg_names_utf16 [i] = ep_rt_utf8_to_utf16le_string (_ep_aggregate_event_arg_names [i]);
+		ep_raise_error_if_nok (aggregate_arg_names_utf16 [i] != NULL);
+	}
+
+	ep_parameter_desc_init (&aggregate_params[0], EP_PARAMETER_TYPE_STRING, aggregate_arg_names_utf16 [0]);
+	ep_parameter_desc_init (&aggregate_params[1], EP_PARAMETER_TYPE_UINT32, aggregate_arg_names_utf16 [1]);
+	ep_parameter_desc_init (&aggregate_params[2], EP_PARAMETER_TYPE_UINT32, aggregate_arg_names_utf16 [2]);
+	ep_parameter_desc_init (&aggregate_params[3], EP_PARAMETER_TYPE_UINT64, aggregate_arg_names_utf16 [3]);
+	ep_parameter_desc_init (&aggregate_params[4], EP_PARAMETER_TYPE_UINT64, aggregate_arg_names_utf16 [4]);
+	ep_parameter_desc_init (&aggregate_params[5], EP_PARAMETER_TYPE_UINT64, aggregate_arg_names_utf16 [5]);
+	ep_parameter_desc_init (&aggregate_params[6], EP_PARAMETER_TYPE_UINT64, aggregate_arg_names_utf16 [6]);
+	ep_parameter_desc_init (&aggregate_params[7], EP_PARAMETER_TYPE_ARRAY, aggregate_arg_names_utf16 [7]);
+	aggregate_params[7].element_type = EP_PARAMETER_TYPE_UINT64;
+
+	aggregate_event_name_utf16 = ep_rt_utf8_to_utf16le_string ("EventAggregate");
+	ep_raise_error_if_nok (aggregate_event_name_utf16 != NULL);
+
+	size_t aggregate_metadata_len;
+	aggregate_metadata_len = 0;
+	aggregate_metadata = ep_metadata_generator_generate_event_metadata (
+		2,		/* eventID */
+		aggregate_event_name_utf16,
+		0,		/* keywords */
+		1,		/* version */
+		EP_EVENT_LEVEL_LOGALWAYS,
+		0,		/* opcode */
+		aggregate_params,
+		(uint32_t)ARRAY_SIZE (aggregate_params),
+		&aggregate_metadata_len);
+
+	ep_raise_error_if_nok (aggregate_metadata != NULL);
+
+	event_source->aggregate_event = ep_provider_add_event (
+		event_source->provider,
+		2,		/* eventID */
+		0,		/* keywords */
+		0,		/* eventVersion */
+		EP_EVENT_LEVEL_LOGALWAYS,
+		false,  /* needStack */
+		aggregate_metadata,
+		(uint32_t)aggregate_metadata_len);
+
+	ep_raise_error_if_nok (event_source->aggregate_event);
+
 ep_on_exit:
 	// Delete the metadata after the event is created.
 	// The metadata blob will be copied into EventPipe-owned memory.
+	ep_rt_byte_array_free (aggregate_metadata);
 	ep_rt_byte_array_free (metadata);
 
 	// Delete the strings after the event is created.
 	// The strings will be copied into EventPipe-owned memory.
+	for (uint32_t i = 0; i < ARRAY_SIZE (aggregate_arg_names_utf16); ++i)
+		ep_rt_utf16_string_free (aggregate_arg_names_utf16 [i]);
+	ep_rt_utf16_string_free (aggregate_event_name_utf16);
 	ep_rt_utf16_string_free (event_name_utf16);
 	ep_rt_utf16_string_free (arch_info_arg_utf16);
 	ep_rt_utf16_string_free (os_info_arg_utf16);
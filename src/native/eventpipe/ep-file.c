@@ -167,6 +167,14 @@ file_get_stack_id (
 	EventPipeStackContentsInstance *stack_contents = ep_event_instance_get_stack_contents_instance_ref (event_instance);
 	EventPipeStackBlock *stack_block = file->stack_block;
 	dn_umap_t *stack_hash = file->stack_hash;
+
+	// Comparing against the previous stack is a lot cheaper than hashing it.
+	StackHashEntry *last_entry = file->last_stack_entry;
+	if (last_entry &&
+		last_entry->key.stack_size_in_bytes == ep_stack_contents_instance_get_size (stack_contents) &&
+		!memcmp (last_entry->key.stack_bytes, ep_stack_contents_instance_get_pointer (stack_contents), last_entry->key.stack_size_in_bytes))
+		return last_entry->id;
+
 	StackHashKey key;
 	ep_stack_hash_key_init (&key, stack_contents);
 	dn_umap_it_t found = dn_umap_find (stack_hash, &key);
@@ -175,7 +183,9 @@ file_get_stack_id (
 		file->stack_id_counter = stack_id;
 		StackHashEntry *entry = ep_stack_hash_entry_alloc (stack_contents, stack_id, ep_stack_hash_key_get_hash (&key));
 		if (entry) {
-			if (!dn_umap_insert (stack_hash, ep_stack_hash_entry_get_key_ref (entry), entry).result)
+			if (dn_umap_insert (stack_hash, ep_stack_hash_entry_get_key_ref (entry), entry).result)
+				file->last_stack_entry = entry;
+			else
 				ep_stack_hash_entry_free (entry);
 			entry = NULL;
 		}
@@ -189,7 +199,8 @@ file_get_stack_id (
 				EP_UNREACHABLE ("Should never fail to add event to a clear block. If we do the max size is too small.");
 		}
 	} else {
-		stack_id = ep_stack_hash_entry_get_id (dn_umap_it_value_t (found, StackHashEntry *));
+		file->last_stack_entry = dn_umap_it_value_t (found, StackHashEntry *);
+		stack_id = ep_stack_hash_entry_get_id (file->last_stack_entry);
 	}
 
 	ep_stack_hash_key_fini (&key);
@@ -362,6 +373,7 @@ ep_file_alloc (
 
 	// Start at 0 - The value is always incremented prior to use, so the first ID will be 1.
 	instance->stack_id_counter = 0;
+	instance->last_stack_entry = NULL;
 
 	ep_rt_volatile_store_uint32_t (&instance->initialized, 0);
 
@@ -430,6 +442,19 @@ ep_file_initialize_file (EventPipeFile *file)
 	return success;
 }
 
+bool
+ep_file_set_block_compression (
+	EventPipeFile *file,
+	EventPipeBlockCompression compression)
+{
+	EP_ASSERT (file != NULL);
+	EP_ASSERT (ep_rt_volatile_load_uint32_t (&file->initialized) == 0);
+
+	return ep_block_set_compression ((EventPipeBlock *)file->event_block, compression) &&
+		ep_block_set_compression ((EventPipeBlock *)file->metadata_block, compression) &&
+		ep_block_set_compression ((EventPipeBlock *)file->stack_block, compression);
+}
+
 void
 ep_file_write_event (
 	EventPipeFile *file,
@@ -501,6 +526,7 @@ ep_file_write_sequence_point (
 
 	// stack cache resets on sequence points
 	file->stack_id_counter = 0;
+	file->last_stack_entry = NULL;
 	dn_umap_clear (file->stack_hash);
 
 ep_on_exit:
@@ -597,11 +623,18 @@ hash_bytes (const uint8_t *data, size_t data_len)
 {
 	EP_ASSERT (data != NULL);
 
-	uint32_t hash = 5381;
+	// Stacks are arrays of frame addresses, so mix a 64-bit word at a time rather than a byte at a time.
+	uint64_t hash = 0xcbf29ce484222325ULL;
 	const uint8_t *data_end = data + data_len;
+	for (/**/ ; data + sizeof (uint64_t) <= data_end; data += sizeof (uint64_t)) {
+		uint64_t word;
+		memcpy (&word, data, sizeof (word));
+		hash = (hash ^ word) * 0x9e3779b97f4a7c15ULL;
+		hash ^= hash >> 32;
+	}
 	for (/**/ ; data < data_end; data++)
-		hash = ((hash << 5) + hash) ^ *data;
-	return hash;
+		hash = (hash ^ *data) * 0x100000001b3ULL;
+	return (uint32_t)hash;
 }
 
 static
@@ -36,6 +36,9 @@ struct _EventPipeFile_Internal {
 	// Hashtable of metadata labels.
 	dn_umap_t *metadata_ids;
 	dn_umap_t *stack_hash;
+	// The entry of the last stack looked up, events from one thread are written together and
+	// often repeat the same stack.
+	StackHashEntry *last_stack_entry;
 	// The timestamp when the file was opened.  Used for calculating file-relative timestamps.
 	ep_timestamp_t file_open_timestamp;
 #ifdef EP_CHECKED_BUILD
@@ -80,6 +83,13 @@ ep_file_free (EventPipeFile *file);
 bool
 ep_file_initialize_file (EventPipeFile *file);
 
+// Compresses the event, metadata and stack blocks written to the file, see ep_block_set_compression.
+// Must be called before anything has been written.
+bool
+ep_file_set_block_compression (
+	EventPipeFile *file,
+	EventPipeBlockCompression compression);
+
 void
 ep_file_write_event (
 	EventPipeFile *file,
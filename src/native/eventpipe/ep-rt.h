@@ -191,11 +191,25 @@ inline
 bool
 ep_rt_config_value_get_output_streaming (void);
 
+// Providers config (EventPipeConfig syntax) of the startup session, NULL if there is none.
+static
+ep_char8_t *
+ep_rt_config_value_get_startup_session_config (void);
+
+static
+uint32_t
+ep_rt_config_value_get_startup_session_mb (void);
+
 static
 inline
 bool
 ep_rt_config_value_get_enable_stackwalk (void);
 
+static
+inline
+bool
+ep_rt_config_value_get_sample_running_threads_only (void);
+
 /*
  * EventPipeSampleProfiler.
  */
@@ -284,6 +298,12 @@ static
 void
 ep_rt_execute_rundown (dn_vector_ptr_t *execution_checkpoints);
 
+// Starts logging every jitted method with its symbol, the ones compiled so far included, outside
+// of the trace. Returns false if the runtime has no such log, the rundown is then still needed.
+static
+bool
+ep_rt_enable_method_load_log (void);
+
 /*
  * Objects.
  */
@@ -18,6 +18,7 @@ static EventPipeEvent *_thread_time_event = NULL;
 static ep_rt_wait_event_handle_t _thread_shutdown_event;
 static uint64_t _sampling_rate_in_ns = NUM_NANOSECONDS_IN_1_MS; // 1ms
 static bool _time_period_is_set = false;
+static volatile uint32_t _sample_running_threads_only = (uint32_t)false;
 static volatile uint32_t _can_start_sampling = (uint32_t)false;
 static int32_t _ref_count = 0;
 
@@ -211,6 +212,8 @@ ep_sample_profiler_init (EventPipeProviderCallbackDataQueue *provider_callback_d
 	ep_requires_lock_held ();
 
 	if (!_sampling_provider) {
+		ep_sample_profiler_set_sample_running_threads_only (ep_rt_config_value_get_sample_running_threads_only ());
+
 		_sampling_provider = provider_create_register (ep_config_get_sample_profiler_provider_name_utf8 (), NULL, NULL, provider_callback_data_queue);
 		ep_raise_error_if_nok (_sampling_provider != NULL);
 		_thread_time_event = provider_add_event (
@@ -333,6 +336,18 @@ ep_sample_profiler_get_sampling_rate (void)
 	return _sampling_rate_in_ns;
 }
 
+void
+ep_sample_profiler_set_sample_running_threads_only (bool running_threads_only)
+{
+	ep_rt_volatile_store_uint32_t (&_sample_running_threads_only, running_threads_only ? 1 : 0);
+}
+
+bool
+ep_sample_profiler_get_sample_running_threads_only (void)
+{
+	return ep_rt_volatile_load_uint32_t (&_sample_running_threads_only) != 0;
+}
+
 #endif /* !defined(EP_INCLUDE_SOURCE_FILES) || defined(EP_FORCE_INCLUDE_SOURCE_FILES) */
 #endif /* ENABLE_PERFTRACING */
 
@@ -37,5 +37,14 @@ ep_sample_profiler_set_sampling_rate (uint64_t nanoseconds);
 uint64_t
 ep_sample_profiler_get_sampling_rate (void);
 
+// When set, the runtime only walks and samples threads that were running managed code when
+// they were suspended. Threads blocked in native code or waits are neither walked nor written,
+// which keeps the time the runtime stays suspended proportional to the busy threads.
+void
+ep_sample_profiler_set_sample_running_threads_only (bool running_threads_only);
+
+bool
+ep_sample_profiler_get_sample_running_threads_only (void);
+
 #endif /* ENABLE_PERFTRACING */
 #endif /* __EVENTPIPE_SAMPLE_PROFILER_H__ */
@@ -0,0 +1,422 @@
+#include "ep-rt-config.h"
+
+#ifdef ENABLE_PERFTRACING
+#if !defined(EP_INCLUDE_SOURCE_FILES) || defined(EP_FORCE_INCLUDE_SOURCE_FILES)
+
+#define EP_IMPL_SESSION_AGGREGATOR_GETTER_SETTER
+#include "ep.h"
+#include "ep-buffer-manager.h"
+#include "ep-event.h"
+#include "ep-event-payload.h"
+#include "ep-event-source.h"
+#include "ep-provider.h"
+#include "ep-session.h"
+#include "ep-session-aggregator.h"
+#include "ep-thread.h"
+#include "ep-rt.h"
+
+/*
+ * Forward declares of all static functions.
+ */
+
+static
+bool
+session_aggregator_next_field (
+	const ep_char8_t **cursor,
+	const ep_char8_t *entry_end,
+	const ep_char8_t **start,
+	const ep_char8_t **end);
+
+static
+bool
+session_aggregator_parse_uint32_t (
+	const ep_char8_t *start,
+	const ep_char8_t *end,
+	uint32_t *value);
+
+static
+bool
+session_aggregator_parse_config (
+	EventPipeSessionAggregator *aggregator,
+	const ep_char8_t *config);
+
+static
+uint32_t
+session_aggregation_get_bucket (uint64_t value);
+
+static
+void
+session_aggregation_write (
+	EventPipeSessionAggregation *aggregation,
+	EventPipeSession *session,
+	EventPipeEvent *aggregate_event);
+
+/*
+ * EventPipeSessionAggregator.
+ */
+
+static
+bool
+session_aggregator_next_field (
+	const ep_char8_t **cursor,
+	const ep_char8_t *entry_end,
+	const ep_char8_t **start,
+	const ep_char8_t **end)
+{
+	EP_ASSERT (cursor != NULL);
+	EP_ASSERT (start != NULL);
+	EP_ASSERT (end != NULL);
+
+	if (*cursor > entry_end)
+		return false;
+
+	*start = *cursor;
+	while (*cursor < entry_end && **cursor != ':')
+		(*cursor)++;
+
+	*end = *cursor;
+
+	// Step over the separator, past the end once the last field has been consumed.
+	(*cursor)++;
+	return *end != *start;
+}
+
+static
+bool
+session_aggregator_parse_uint32_t (
+	const ep_char8_t *start,
+	const ep_char8_t *end,
+	uint32_t *value)
+{
+	EP_ASSERT (value != NULL);
+
+	ep_char8_t *value_as_utf8 = ep_rt_utf8_string_dup_range (start, end);
+	ep_return_false_if_nok (value_as_utf8 != NULL);
+
+	ep_char8_t *value_end = NULL;
+	uint64_t parsed = strtoull (value_as_utf8, &value_end, 0);
+	bool result = value_end != value_as_utf8 && *value_end == '\0' && parsed <= UINT32_MAX;
+
+	ep_rt_utf8_string_free (value_as_utf8);
+
+	*value = (uint32_t)parsed;
+	return result;
+}
+
+static
+bool
+session_aggregator_parse_config (
+	EventPipeSessionAggregator *aggregator,
+	const ep_char8_t *config)
+{
+	EP_ASSERT (aggregator != NULL);
+	EP_ASSERT (config != NULL);
+
+	bool result = false;
+	const ep_char8_t *entry = config;
+
+	while (*entry != '\0') {
+		const ep_char8_t *entry_end = entry;
+		while (*entry_end != '\0' && *entry_end != ',')
+			entry_end++;
+
+		EventPipeSessionAggregation aggregation;
+		memset (&aggregation, 0, sizeof (aggregation));
+		aggregation.min = UINT64_MAX;
+
+		const ep_char8_t *cursor = entry;
+		const ep_char8_t *start = NULL;
+		const ep_char8_t *end = NULL;
+
+		ep_raise_error_if_nok (session_aggregator_next_field (&cursor, entry_end, &start, &end));
+		aggregation.provider_name = ep_rt_utf8_string_dup_range (start, end);
+		ep_raise_error_if_nok (aggregation.provider_name != NULL);
+
+		// Ownership transferred, freed with the aggregator.
+		if (!dn_vector_push_back (aggregator->aggregations, aggregation)) {
+			ep_rt_utf8_string_free (aggregation.provider_name);
+			ep_raise_error ();
+		}
+
+		EventPipeSessionAggregation *added = dn_vector_index_t (aggregator->aggregations, EventPipeSessionAggregation, dn_vector_size (aggregator->aggregations) - 1);
+
+		ep_raise_error_if_nok (session_aggregator_next_field (&cursor, entry_end, &start, &end));
+		ep_raise_error_if_nok (session_aggregator_parse_uint32_t (start, end, &added->event_id));
+
+		// The field is optional.
+		if (session_aggregator_next_field (&cursor, entry_end, &start, &end)) {
+			ep_raise_error_if_nok (session_aggregator_parse_uint32_t (start, end, &added->field_offset));
+			ep_raise_error_if_nok (session_aggregator_next_field (&cursor, entry_end, &start, &end));
+			ep_raise_error_if_nok (session_aggregator_parse_uint32_t (start, end, &added->field_size));
+			ep_raise_error_if_nok (added->field_size == 1 || added->field_size == 2 || added->field_size == 4 || added->field_size == 8);
+		}
+
+		ep_raise_error_if_nok (cursor > entry_end);
+
+		entry = *entry_end == ',' ? entry_end + 1 : entry_end;
+	}
+
+	result = dn_vector_size (aggregator->aggregations) != 0;
+
+ep_on_exit:
+	return result;
+
+ep_on_error:
+	result = false;
+	ep_exit_error_handler ();
+}
+
+EventPipeSessionAggregator *
+ep_session_aggregator_alloc (
+	const ep_char8_t *config,
+	uint32_t interval_ms)
+{
+	ep_return_null_if_nok (config != NULL && interval_ms != 0);
+
+	EventPipeSessionAggregator *instance = ep_rt_object_alloc (EventPipeSessionAggregator);
+	ep_raise_error_if_nok (instance != NULL);
+
+	ep_rt_spin_lock_alloc (&instance->rt_lock);
+	ep_raise_error_if_nok (ep_rt_spin_lock_is_valid (&instance->rt_lock));
+
+	instance->aggregations = dn_vector_alloc_t (EventPipeSessionAggregation);
+	ep_raise_error_if_nok (instance->aggregations != NULL);
+
+	ep_raise_error_if_nok (session_aggregator_parse_config (instance, config));
+
+	instance->interval_ms = interval_ms;
+	instance->last_flush_timestamp = ep_perf_timestamp_get ();
+
+ep_on_exit:
+	return instance;
+
+ep_on_error:
+	ep_session_aggregator_free (instance);
+	instance = NULL;
+	ep_exit_error_handler ();
+}
+
+void
+ep_session_aggregator_free (EventPipeSessionAggregator *aggregator)
+{
+	ep_return_void_if_nok (aggregator != NULL);
+
+	if (aggregator->aggregations) {
+		DN_VECTOR_FOREACH_BEGIN (EventPipeSessionAggregation, aggregation, aggregator->aggregations) {
+			ep_rt_utf8_string_free (aggregation.provider_name);
+		} DN_VECTOR_FOREACH_END;
+		dn_vector_free (aggregator->aggregations);
+	}
+
+	ep_rt_spin_lock_free (&aggregator->rt_lock);
+	ep_rt_object_free (aggregator);
+}
+
+static
+uint32_t
+session_aggregation_get_bucket (uint64_t value)
+{
+	uint32_t bucket = 0;
+	while (value != 0 && bucket < EP_SESSION_AGGREGATION_BUCKET_COUNT - 1) {
+		value >>= 1;
+		bucket++;
+	}
+
+	return bucket;
+}
+
+bool
+ep_session_aggregator_aggregate_event (
+	EventPipeSessionAggregator *aggregator,
+	EventPipeEvent *ep_event,
+	EventPipeEventPayload *payload)
+{
+	EP_ASSERT (aggregator != NULL);
+	EP_ASSERT (ep_event != NULL);
+
+	bool result = false;
+	EventPipeSessionAggregation *aggregation = NULL;
+	const uint32_t event_id = ep_event_get_event_id (ep_event);
+	const ep_char8_t *provider_name = ep_provider_get_provider_name (ep_event_get_provider (ep_event));
+
+	for (uint32_t i = 0; i < dn_vector_size (aggregator->aggregations); ++i) {
+		EventPipeSessionAggregation *candidate = dn_vector_index_t (aggregator->aggregations, EventPipeSessionAggregation, i);
+		if (candidate->event_id == event_id && ep_rt_utf8_string_compare_ignore_case (candidate->provider_name, provider_name) == 0) {
+			aggregation = candidate;
+			break;
+		}
+	}
+
+	ep_return_false_if_nok (aggregation != NULL);
+
+	// Events too short to hold the field are still counted.
+	uint64_t value = 0;
+	bool has_value = false;
+	if (aggregation->field_size != 0 && payload != NULL && (uint64_t)aggregation->field_offset + aggregation->field_size <= ep_event_payload_get_size (payload)) {
+		const uint8_t *data = ep_event_payload_get_flat_data (payload);
+		if (data) {
+			switch (aggregation->field_size) {
+			case 1 :
+				value = *(data + aggregation->field_offset);
+				break;
+			case 2 : {
+				uint16_t field;
+				memcpy (&field, data + aggregation->field_offset, sizeof (field));
+				value = field;
+				break;
+			}
+			case 4 : {
+				uint32_t field;
+				memcpy (&field, data + aggregation->field_offset, sizeof (field));
+				value = field;
+				break;
+			}
+			default : {
+				memcpy (&value, data + aggregation->field_offset, sizeof (value));
+				break;
+			}
+			}
+			has_value = true;
+		}
+	}
+
+	EP_SPIN_LOCK_ENTER (&aggregator->rt_lock, section1)
+		aggregation->count++;
+		if (has_value) {
+			aggregation->sum += value;
+			if (value < aggregation->min)
+				aggregation->min = value;
+			if (value > aggregation->max)
+				aggregation->max = value;
+			aggregation->buckets [session_aggregation_get_bucket (value)]++;
+		}
+	EP_SPIN_LOCK_EXIT (&aggregator->rt_lock, section1)
+
+	result = true;
+
+ep_on_exit:
+	return result;
+
+ep_on_error:
+	ep_exit_error_handler ();
+}
+
+bool
+ep_session_aggregator_is_flush_due (
+	EventPipeSessionAggregator *aggregator,
+	ep_timestamp_t timestamp)
+{
+	EP_ASSERT (aggregator != NULL);
+
+	const int64_t interval_ticks = ((int64_t)aggregator->interval_ms * ep_perf_frequency_query ()) / 1000;
+	return (timestamp - aggregator->last_flush_timestamp) >= interval_ticks;
+}
+
+static
+void
+session_aggregation_write (
+	EventPipeSessionAggregation *aggregation,
+	EventPipeSession *session,
+	EventPipeEvent *aggregate_event)
+{
+	EP_ASSERT (aggregation != NULL);
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (aggregate_event != NULL);
+
+	ep_char16_t *provider_name_utf16 = ep_rt_utf8_to_utf16le_string (aggregation->provider_name);
+	ep_return_void_if_nok (provider_name_utf16 != NULL);
+
+	// Trailing empty buckets are left out, arrays are prefixed with a 16-bit element count.
+	uint16_t bucket_count = EP_SESSION_AGGREGATION_BUCKET_COUNT;
+	while (bucket_count > 0 && aggregation->buckets [bucket_count - 1] == 0)
+		bucket_count--;
+
+	uint64_t min = aggregation->count != 0 && aggregation->min != UINT64_MAX ? aggregation->min : 0;
+
+	EventData data [9] = { { 0 } };
+	ep_event_data_init (&data[0], (uint64_t)(uintptr_t)provider_name_utf16, (uint32_t)((ep_rt_utf16_string_len (provider_name_utf16) + 1) * sizeof (ep_char16_t)), 0);
+	ep_event_data_init (&data[1], (uint64_t)(uintptr_t)&aggregation->event_id, sizeof (aggregation->event_id), 0);
+	ep_event_data_init (&data[2], (uint64_t)(uintptr_t)&aggregation->field_offset, sizeof (aggregation->field_offset), 0);
+	ep_event_data_init (&data[3], (uint64_t)(uintptr_t)&aggregation->count, sizeof (aggregation->count), 0);
+	ep_event_data_init (&data[4], (uint64_t)(uintptr_t)&aggregation->sum, sizeof (aggregation->sum), 0);
+	ep_event_data_init (&data[5], (uint64_t)(uintptr_t)&min, sizeof (min), 0);
+	ep_event_data_init (&data[6], (uint64_t)(uintptr_t)&aggregation->max, sizeof (aggregation->max), 0);
+	ep_event_data_init (&data[7], (uint64_t)(uintptr_t)&bucket_count, sizeof (bucket_count), 0);
+	ep_event_data_init (&data[8], (uint64_t)(uintptr_t)aggregation->buckets, (uint32_t)(bucket_count * sizeof (uint64_t)), 0);
+
+	EventPipeEventPayload payload;
+	if (ep_event_payload_init_2 (&payload, data, (uint32_t)ARRAY_SIZE (data))) {
+		ep_buffer_manager_write_event (
+			ep_session_get_buffer_manager (session),
+			ep_rt_thread_get_handle (),
+			session,
+			aggregate_event,
+			&payload,
+			NULL,
+			NULL,
+			NULL,
+			NULL);
+		ep_event_payload_fini (&payload);
+	}
+
+	ep_rt_utf16_string_free (provider_name_utf16);
+}
+
+void
+ep_session_aggregator_flush (
+	EventPipeSessionAggregator *aggregator,
+	EventPipeSession *session,
+	ep_timestamp_t timestamp)
+{
+	EP_ASSERT (aggregator != NULL);
+	EP_ASSERT (session != NULL);
+
+	aggregator->last_flush_timestamp = timestamp;
+
+	EventPipeEvent *aggregate_event = ep_event_source_get_aggregate_event (ep_event_source_get ());
+	ep_return_void_if_nok (aggregate_event != NULL && ep_session_get_buffer_manager (session) != NULL);
+
+	EventPipeThread *const current_thread = ep_thread_get_or_create ();
+	ep_return_void_if_nok (current_thread != NULL);
+
+	// Same handshake as any other writer, so disabling the session waits for us
+	// before the buffers are suspended.
+	ep_thread_set_session_write_in_progress (current_thread, ep_session_get_index (session));
+	if ((ep_volatile_load_allow_write () & ep_session_get_mask (session)) != 0) {
+		for (uint32_t i = 0; i < dn_vector_size (aggregator->aggregations); ++i) {
+			EventPipeSessionAggregation *aggregation = dn_vector_index_t (aggregator->aggregations, EventPipeSessionAggregation, i);
+			EventPipeSessionAggregation snapshot;
+			bool has_events = false;
+
+			EP_SPIN_LOCK_ENTER (&aggregator->rt_lock, section1)
+				has_events = aggregation->count != 0;
+				if (has_events) {
+					snapshot = *aggregation;
+					aggregation->count = 0;
+					aggregation->sum = 0;
+					aggregation->min = UINT64_MAX;
+					aggregation->max = 0;
+					memset (aggregation->buckets, 0, sizeof (aggregation->buckets));
+				}
+			EP_SPIN_LOCK_EXIT (&aggregator->rt_lock, section1)
+
+			if (has_events)
+				session_aggregation_write (&snapshot, session, aggregate_event);
+		}
+	}
+
+ep_on_exit:
+	ep_thread_set_session_write_in_progress (current_thread, UINT32_MAX);
+	return;
+
+ep_on_error:
+	ep_exit_error_handler ();
+}
+
+#endif /* !defined(EP_INCLUDE_SOURCE_FILES) || defined(EP_FORCE_INCLUDE_SOURCE_FILES) */
+#endif /* ENABLE_PERFTRACING */
+
+#if !defined(ENABLE_PERFTRACING) || (defined(EP_INCLUDE_SOURCE_FILES) && !defined(EP_FORCE_INCLUDE_SOURCE_FILES))
+extern const char quiet_linker_empty_file_warning_eventpipe_session_aggregator;
+const char quiet_linker_empty_file_warning_eventpipe_session_aggregator = 0;
+#endif
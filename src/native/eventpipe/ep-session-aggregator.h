@@ -0,0 +1,110 @@
+#ifndef __EVENTPIPE_SESSION_AGGREGATOR_H__
+#define __EVENTPIPE_SESSION_AGGREGATOR_H__
+
+#include "ep-rt-config.h"
+
+#ifdef ENABLE_PERFTRACING
+#include "ep-types.h"
+
+#undef EP_IMPL_GETTER_SETTER
+#ifdef EP_IMPL_SESSION_AGGREGATOR_GETTER_SETTER
+#define EP_IMPL_GETTER_SETTER
+#endif
+#include "ep-getter-setter.h"
+
+// Number of log2 buckets in an aggregation histogram. Bucket 0 counts zero values and bucket n
+// counts values in [2^(n-1), 2^n), the last bucket also takes everything above.
+#define EP_SESSION_AGGREGATION_BUCKET_COUNT 64
+
+/*
+ * EventPipeSessionAggregation.
+ */
+
+// Count, sum, min, max and histogram of one event, or of one unsigned payload field of it,
+// since the last flush.
+#if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_SESSION_AGGREGATOR_GETTER_SETTER)
+struct _EventPipeSessionAggregation {
+#else
+struct _EventPipeSessionAggregation_Internal {
+#endif
+	ep_char8_t *provider_name;
+	uint32_t event_id;
+	// Byte offset and size (1, 2, 4 or 8) of the field in the event payload,
+	// a size of 0 only counts the events.
+	uint32_t field_offset;
+	uint32_t field_size;
+	uint64_t count;
+	uint64_t sum;
+	uint64_t min;
+	uint64_t max;
+	uint64_t buckets [EP_SESSION_AGGREGATION_BUCKET_COUNT];
+};
+
+#if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_SESSION_AGGREGATOR_GETTER_SETTER)
+struct _EventPipeSessionAggregation {
+	uint8_t _internal [sizeof (struct _EventPipeSessionAggregation_Internal)];
+};
+#endif
+
+/*
+ * EventPipeSessionAggregator.
+ */
+
+// Aggregates the selected events of a streaming session in process. Matching events are folded
+// into their aggregation instead of being buffered, and every interval the streaming thread writes
+// one EventAggregate event (Microsoft-DotNETCore-EventPipe, event id 2) per aggregation that saw
+// events and resets it.
+#if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_SESSION_AGGREGATOR_GETTER_SETTER)
+struct _EventPipeSessionAggregator {
+#else
+struct _EventPipeSessionAggregator_Internal {
+#endif
+	// Protects the aggregation values, taken by every writer of an aggregated event.
+	ep_rt_spin_lock_handle_t rt_lock;
+	// Array of EventPipeSessionAggregation.
+	dn_vector_t *aggregations;
+	ep_timestamp_t last_flush_timestamp;
+	uint32_t interval_ms;
+};
+
+#if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_SESSION_AGGREGATOR_GETTER_SETTER)
+struct _EventPipeSessionAggregator {
+	uint8_t _internal [sizeof (struct _EventPipeSessionAggregator_Internal)];
+};
+#endif
+
+EP_DEFINE_GETTER(EventPipeSessionAggregator *, session_aggregator, uint32_t, interval_ms)
+
+// config is a comma separated list of ProviderName:EventID[:FieldOffset:FieldSize] entries.
+// Returns NULL if it doesn't parse.
+EventPipeSessionAggregator *
+ep_session_aggregator_alloc (
+	const ep_char8_t *config,
+	uint32_t interval_ms);
+
+void
+ep_session_aggregator_free (EventPipeSessionAggregator *aggregator);
+
+// Returns true if the event belongs to an aggregation and has been folded into it.
+bool
+ep_session_aggregator_aggregate_event (
+	EventPipeSessionAggregator *aggregator,
+	EventPipeEvent *ep_event,
+	EventPipeEventPayload *payload);
+
+// Returns true once the interval has elapsed since the last flush.
+bool
+ep_session_aggregator_is_flush_due (
+	EventPipeSessionAggregator *aggregator,
+	ep_timestamp_t timestamp);
+
+// Writes the aggregates into the session buffers and resets them.
+// Must be called on the session streaming thread while writes to the session are allowed.
+void
+ep_session_aggregator_flush (
+	EventPipeSessionAggregator *aggregator,
+	EventPipeSession *session,
+	ep_timestamp_t timestamp);
+
+#endif /* ENABLE_PERFTRACING */
+#endif /* __EVENTPIPE_SESSION_AGGREGATOR_H__ */
@@ -0,0 +1,439 @@
+#include "ep-rt-config.h"
+
+#ifdef ENABLE_PERFTRACING
+#if !defined(EP_INCLUDE_SOURCE_FILES) || defined(EP_FORCE_INCLUDE_SOURCE_FILES)
+
+#define EP_IMPL_SESSION_FLIGHT_RECORDER_GETTER_SETTER
+#include "ep.h"
+#include "ep-event.h"
+#include "ep-event-payload.h"
+#include "ep-provider.h"
+#include "ep-session-flight-recorder.h"
+#include "ep-rt.h"
+
+/*
+ * Forward declares of all static functions.
+ */
+
+static
+bool
+session_flight_recorder_next_field (
+	const ep_char8_t **cursor,
+	const ep_char8_t *entry_end,
+	const ep_char8_t **start,
+	const ep_char8_t **end);
+
+static
+bool
+session_flight_recorder_parse_uint64_t (
+	const ep_char8_t *start,
+	const ep_char8_t *end,
+	uint64_t *value);
+
+static
+bool
+session_flight_recorder_parse_uint32_t (
+	const ep_char8_t *start,
+	const ep_char8_t *end,
+	uint32_t *value);
+
+static
+bool
+session_flight_recorder_field_equals (
+	const ep_char8_t *start,
+	const ep_char8_t *end,
+	const ep_char8_t *value);
+
+static
+bool
+session_flight_recorder_parse_trigger (
+	EventPipeSessionTrigger *trigger,
+	const ep_char8_t *entry,
+	const ep_char8_t *entry_end);
+
+static
+bool
+session_flight_recorder_parse_config (
+	EventPipeSessionFlightRecorder *flight_recorder,
+	const ep_char8_t *trigger_config);
+
+static
+bool
+session_trigger_is_match (
+	const EventPipeSessionTrigger *trigger,
+	uint32_t event_id,
+	const ep_char8_t *provider_name);
+
+static
+bool
+session_trigger_evaluate_field (
+	const EventPipeSessionTrigger *trigger,
+	EventPipeEventPayload *payload);
+
+/*
+ * EventPipeSessionFlightRecorder.
+ */
+
+static
+bool
+session_flight_recorder_next_field (
+	const ep_char8_t **cursor,
+	const ep_char8_t *entry_end,
+	const ep_char8_t **start,
+	const ep_char8_t **end)
+{
+	EP_ASSERT (cursor != NULL);
+	EP_ASSERT (start != NULL);
+	EP_ASSERT (end != NULL);
+
+	if (*cursor > entry_end)
+		return false;
+
+	*start = *cursor;
+	while (*cursor < entry_end && **cursor != ':')
+		(*cursor)++;
+
+	*end = *cursor;
+
+	// Step over the separator, past the end once the last field has been consumed.
+	(*cursor)++;
+	return *end != *start;
+}
+
+static
+bool
+session_flight_recorder_parse_uint64_t (
+	const ep_char8_t *start,
+	const ep_char8_t *end,
+	uint64_t *value)
+{
+	EP_ASSERT (value != NULL);
+
+	ep_char8_t *value_as_utf8 = ep_rt_utf8_string_dup_range (start, end);
+	ep_return_false_if_nok (value_as_utf8 != NULL);
+
+	ep_char8_t *value_end = NULL;
+	*value = strtoull (value_as_utf8, &value_end, 0);
+	bool result = value_end != value_as_utf8 && *value_end == '\0';
+
+	ep_rt_utf8_string_free (value_as_utf8);
+	return result;
+}
+
+static
+bool
+session_flight_recorder_parse_uint32_t (
+	const ep_char8_t *start,
+	const ep_char8_t *end,
+	uint32_t *value)
+{
+	EP_ASSERT (value != NULL);
+
+	uint64_t parsed = 0;
+	ep_return_false_if_nok (session_flight_recorder_parse_uint64_t (start, end, &parsed) && parsed <= UINT32_MAX);
+
+	*value = (uint32_t)parsed;
+	return true;
+}
+
+static
+bool
+session_flight_recorder_field_equals (
+	const ep_char8_t *start,
+	const ep_char8_t *end,
+	const ep_char8_t *value)
+{
+	EP_ASSERT (value != NULL);
+
+	size_t len = strlen (value);
+	return (size_t)(end - start) == len && memcmp (start, value, len) == 0;
+}
+
+static
+bool
+session_flight_recorder_parse_trigger (
+	EventPipeSessionTrigger *trigger,
+	const ep_char8_t *entry,
+	const ep_char8_t *entry_end)
+{
+	EP_ASSERT (trigger != NULL);
+
+	const ep_char8_t *cursor = entry;
+	const ep_char8_t *start = NULL;
+	const ep_char8_t *end = NULL;
+
+	ep_return_false_if_nok (session_flight_recorder_next_field (&cursor, entry_end, &start, &end));
+	trigger->provider_name = ep_rt_utf8_string_dup_range (start, end);
+	ep_return_false_if_nok (trigger->provider_name != NULL);
+
+	ep_return_false_if_nok (session_flight_recorder_next_field (&cursor, entry_end, &start, &end));
+	ep_return_false_if_nok (session_flight_recorder_parse_uint32_t (start, end, &trigger->event_id));
+
+	trigger->kind = EP_SESSION_TRIGGER_KIND_EVENT;
+	if (!session_flight_recorder_next_field (&cursor, entry_end, &start, &end))
+		return cursor > entry_end;
+
+	if (session_flight_recorder_field_equals (start, end, "since")) {
+		trigger->kind = EP_SESSION_TRIGGER_KIND_DURATION;
+		ep_return_false_if_nok (session_flight_recorder_next_field (&cursor, entry_end, &start, &end));
+		ep_return_false_if_nok (session_flight_recorder_parse_uint32_t (start, end, &trigger->begin_event_id));
+		ep_return_false_if_nok (session_flight_recorder_next_field (&cursor, entry_end, &start, &end));
+		ep_return_false_if_nok (session_flight_recorder_parse_uint64_t (start, end, &trigger->min));
+		return cursor > entry_end;
+	}
+
+	ep_return_false_if_nok (session_flight_recorder_parse_uint32_t (start, end, &trigger->field_offset));
+	ep_return_false_if_nok (session_flight_recorder_next_field (&cursor, entry_end, &start, &end));
+
+	if (session_flight_recorder_field_equals (start, end, "s")) {
+		trigger->kind = EP_SESSION_TRIGGER_KIND_FIELD_TEXT;
+		ep_return_false_if_nok (session_flight_recorder_next_field (&cursor, entry_end, &start, &end));
+
+		ep_char8_t *text = ep_rt_utf8_string_dup_range (start, end);
+		ep_return_false_if_nok (text != NULL);
+		trigger->text = ep_rt_utf8_to_utf16le_string (text);
+		ep_rt_utf8_string_free (text);
+
+		return trigger->text != NULL && cursor > entry_end;
+	}
+
+	trigger->kind = EP_SESSION_TRIGGER_KIND_FIELD_RANGE;
+	ep_return_false_if_nok (session_flight_recorder_parse_uint32_t (start, end, &trigger->field_size));
+	ep_return_false_if_nok (trigger->field_size == 1 || trigger->field_size == 2 || trigger->field_size == 4 || trigger->field_size == 8);
+	ep_return_false_if_nok (session_flight_recorder_next_field (&cursor, entry_end, &start, &end));
+	ep_return_false_if_nok (session_flight_recorder_parse_uint64_t (start, end, &trigger->min));
+
+	// The upper bound is optional.
+	trigger->max = UINT64_MAX;
+	if (session_flight_recorder_next_field (&cursor, entry_end, &start, &end))
+		ep_return_false_if_nok (session_flight_recorder_parse_uint64_t (start, end, &trigger->max));
+
+	return cursor > entry_end && trigger->min <= trigger->max;
+}
+
+static
+bool
+session_flight_recorder_parse_config (
+	EventPipeSessionFlightRecorder *flight_recorder,
+	const ep_char8_t *trigger_config)
+{
+	EP_ASSERT (flight_recorder != NULL);
+	EP_ASSERT (trigger_config != NULL);
+
+	const ep_char8_t *entry = trigger_config;
+
+	while (*entry != '\0') {
+		const ep_char8_t *entry_end = entry;
+		while (*entry_end != '\0' && *entry_end != ',')
+			entry_end++;
+
+		EventPipeSessionTrigger trigger;
+		memset (&trigger, 0, sizeof (trigger));
+
+		// Ownership transferred, freed with the flight recorder.
+		if (!dn_vector_push_back (flight_recorder->triggers, trigger))
+			return false;
+
+		EventPipeSessionTrigger *added = dn_vector_index_t (flight_recorder->triggers, EventPipeSessionTrigger, dn_vector_size (flight_recorder->triggers) - 1);
+		ep_return_false_if_nok (session_flight_recorder_parse_trigger (added, entry, entry_end));
+
+		entry = *entry_end == ',' ? entry_end + 1 : entry_end;
+	}
+
+	return true;
+}
+
+EventPipeSessionFlightRecorder *
+ep_session_flight_recorder_alloc (const ep_char8_t *trigger_config)
+{
+	EventPipeSessionFlightRecorder *instance = ep_rt_object_alloc (EventPipeSessionFlightRecorder);
+	ep_raise_error_if_nok (instance != NULL);
+
+	instance->triggers = dn_vector_alloc_t (EventPipeSessionTrigger);
+	ep_raise_error_if_nok (instance->triggers != NULL);
+
+	if (trigger_config)
+		ep_raise_error_if_nok (session_flight_recorder_parse_config (instance, trigger_config));
+
+	ep_rt_volatile_store_uint32_t (&instance->dump_requested, 0);
+
+ep_on_exit:
+	return instance;
+
+ep_on_error:
+	ep_session_flight_recorder_free (instance);
+	instance = NULL;
+	ep_exit_error_handler ();
+}
+
+void
+ep_session_flight_recorder_free (EventPipeSessionFlightRecorder *flight_recorder)
+{
+	ep_return_void_if_nok (flight_recorder != NULL);
+
+	if (flight_recorder->triggers) {
+		DN_VECTOR_FOREACH_BEGIN (EventPipeSessionTrigger, trigger, flight_recorder->triggers) {
+			ep_rt_utf8_string_free (trigger.provider_name);
+			ep_rt_utf16_string_free (trigger.text);
+		} DN_VECTOR_FOREACH_END;
+		dn_vector_free (flight_recorder->triggers);
+	}
+
+	ep_rt_object_free (flight_recorder);
+}
+
+static
+bool
+session_trigger_is_match (
+	const EventPipeSessionTrigger *trigger,
+	uint32_t event_id,
+	const ep_char8_t *provider_name)
+{
+	EP_ASSERT (trigger != NULL);
+
+	if (trigger->event_id != event_id && (trigger->kind != EP_SESSION_TRIGGER_KIND_DURATION || trigger->begin_event_id != event_id))
+		return false;
+
+	return ep_rt_utf8_string_compare_ignore_case (trigger->provider_name, provider_name) == 0;
+}
+
+static
+bool
+session_trigger_evaluate_field (
+	const EventPipeSessionTrigger *trigger,
+	EventPipeEventPayload *payload)
+{
+	EP_ASSERT (trigger != NULL);
+
+	ep_return_false_if_nok (payload != NULL);
+
+	const uint32_t payload_size = ep_event_payload_get_size (payload);
+	ep_return_false_if_nok (trigger->field_offset < payload_size);
+
+	const uint8_t *data = ep_event_payload_get_flat_data (payload);
+	ep_return_false_if_nok (data != NULL);
+
+	data += trigger->field_offset;
+	const uint32_t field_capacity = payload_size - trigger->field_offset;
+
+	if (trigger->kind == EP_SESSION_TRIGGER_KIND_FIELD_TEXT) {
+		// Compare up to and including the terminator, payload strings aren't necessarily aligned.
+		const ep_char16_t *text = trigger->text;
+		for (uint32_t offset = 0; offset + sizeof (ep_char16_t) <= field_capacity; offset += sizeof (ep_char16_t)) {
+			ep_char16_t c;
+			memcpy (&c, data + offset, sizeof (c));
+			if (c != *text)
+				return false;
+			if (c == 0)
+				return true;
+			text++;
+		}
+		return false;
+	}
+
+	ep_return_false_if_nok (trigger->field_size <= field_capacity);
+
+	uint64_t value = 0;
+	switch (trigger->field_size) {
+	case 1 :
+		value = *data;
+		break;
+	case 2 : {
+		uint16_t field;
+		memcpy (&field, data, sizeof (field));
+		value = field;
+		break;
+	}
+	case 4 : {
+		uint32_t field;
+		memcpy (&field, data, sizeof (field));
+		value = field;
+		break;
+	}
+	default : {
+		memcpy (&value, data, sizeof (value));
+		break;
+	}
+	}
+
+	return value >= trigger->min && value <= trigger->max;
+}
+
+bool
+ep_session_flight_recorder_evaluate_event (
+	EventPipeSessionFlightRecorder *flight_recorder,
+	EventPipeEvent *ep_event,
+	EventPipeEventPayload *payload)
+{
+	EP_ASSERT (flight_recorder != NULL);
+	EP_ASSERT (ep_event != NULL);
+
+	bool fired = false;
+	const uint32_t event_id = ep_event_get_event_id (ep_event);
+	const ep_char8_t *provider_name = ep_provider_get_provider_name (ep_event_get_provider (ep_event));
+
+	for (uint32_t i = 0; i < dn_vector_size (flight_recorder->triggers); ++i) {
+		EventPipeSessionTrigger *trigger = dn_vector_index_t (flight_recorder->triggers, EventPipeSessionTrigger, i);
+		if (!session_trigger_is_match (trigger, event_id, provider_name))
+			continue;
+
+		switch (trigger->kind) {
+		case EP_SESSION_TRIGGER_KIND_EVENT :
+			fired = true;
+			break;
+		case EP_SESSION_TRIGGER_KIND_FIELD_RANGE :
+		case EP_SESSION_TRIGGER_KIND_FIELD_TEXT :
+			fired |= session_trigger_evaluate_field (trigger, payload);
+			break;
+		case EP_SESSION_TRIGGER_KIND_DURATION : {
+			// Begin and end are expected to be process wide (a GC suspension for instance), nesting
+			// isn't tracked and the latest begin wins.
+			ep_timestamp_t now = ep_perf_timestamp_get ();
+			if (event_id == trigger->begin_event_id) {
+				ep_rt_volatile_store_int64_t (&trigger->begin_timestamp, now);
+			} else {
+				int64_t begin_timestamp = ep_rt_volatile_load_int64_t (&trigger->begin_timestamp);
+				if (begin_timestamp != 0) {
+					ep_rt_volatile_store_int64_t (&trigger->begin_timestamp, 0);
+					const int64_t min_ticks = (int64_t)((trigger->min * (uint64_t)ep_perf_frequency_query ()) / 1000);
+					fired |= (now - begin_timestamp) >= min_ticks;
+				}
+			}
+			break;
+		}
+		default :
+			EP_UNREACHABLE ("Unknown trigger kind.");
+		}
+	}
+
+	if (fired)
+		ep_session_flight_recorder_request_dump (flight_recorder);
+
+	return fired;
+}
+
+void
+ep_session_flight_recorder_request_dump (EventPipeSessionFlightRecorder *flight_recorder)
+{
+	EP_ASSERT (flight_recorder != NULL);
+	ep_rt_volatile_store_uint32_t (&flight_recorder->dump_requested, 1);
+}
+
+bool
+ep_session_flight_recorder_take_dump_request (EventPipeSessionFlightRecorder *flight_recorder)
+{
+	EP_ASSERT (flight_recorder != NULL);
+
+	// Cleared before the dump starts, a trigger firing meanwhile asks for the next one.
+	ep_return_false_if_nok (ep_rt_volatile_load_uint32_t (&flight_recorder->dump_requested) != 0);
+	ep_rt_volatile_store_uint32_t (&flight_recorder->dump_requested, 0);
+	return true;
+}
+
+#endif /* !defined(EP_INCLUDE_SOURCE_FILES) || defined(EP_FORCE_INCLUDE_SOURCE_FILES) */
+#endif /* ENABLE_PERFTRACING */
+
+#if !defined(ENABLE_PERFTRACING) || (defined(EP_INCLUDE_SOURCE_FILES) && !defined(EP_FORCE_INCLUDE_SOURCE_FILES))
+extern const char quiet_linker_empty_file_warning_eventpipe_session_flight_recorder;
+const char quiet_linker_empty_file_warning_eventpipe_session_flight_recorder = 0;
+#endif
@@ -0,0 +1,109 @@
+#ifndef __EVENTPIPE_SESSION_FLIGHT_RECORDER_H__
+#define __EVENTPIPE_SESSION_FLIGHT_RECORDER_H__
+
+#include "ep-rt-config.h"
+
+#ifdef ENABLE_PERFTRACING
+#include "ep-types.h"
+
+#undef EP_IMPL_GETTER_SETTER
+#ifdef EP_IMPL_SESSION_FLIGHT_RECORDER_GETTER_SETTER
+#define EP_IMPL_GETTER_SETTER
+#endif
+#include "ep-getter-setter.h"
+
+typedef enum {
+	// Fires on every occurrence of the event.
+	EP_SESSION_TRIGGER_KIND_EVENT,
+	// Fires when an unsigned payload field falls into [min, max].
+	EP_SESSION_TRIGGER_KIND_FIELD_RANGE,
+	// Fires when a UTF-16 payload string equals the text.
+	EP_SESSION_TRIGGER_KIND_FIELD_TEXT,
+	// Fires when the event comes at least min milliseconds after the begin event.
+	EP_SESSION_TRIGGER_KIND_DURATION
+} EventPipeSessionTriggerKind;
+
+/*
+ * EventPipeSessionTrigger.
+ */
+
+#if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_SESSION_FLIGHT_RECORDER_GETTER_SETTER)
+struct _EventPipeSessionTrigger {
+#else
+struct _EventPipeSessionTrigger_Internal {
+#endif
+	ep_char8_t *provider_name;
+	ep_char16_t *text;
+	// Timestamp of the last begin event, or 0 while none is pending.
+	volatile int64_t begin_timestamp;
+	uint64_t min;
+	uint64_t max;
+	EventPipeSessionTriggerKind kind;
+	uint32_t event_id;
+	uint32_t begin_event_id;
+	uint32_t field_offset;
+	uint32_t field_size;
+};
+
+#if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_SESSION_FLIGHT_RECORDER_GETTER_SETTER)
+struct _EventPipeSessionTrigger {
+	uint8_t _internal [sizeof (struct _EventPipeSessionTrigger_Internal)];
+};
+#endif
+
+/*
+ * EventPipeSessionFlightRecorder.
+ */
+
+// Turns a streaming session into a flight recorder. Its buffers are kept in memory as a ring,
+// the oldest buffers being dropped once the circular buffer size is reached, and they are only
+// written out when a dump is requested, either over the diagnostics IPC or by one of the triggers.
+#if defined(EP_INLINE_GETTER_SETTER) || defined(EP_IMPL_SESSION_FLIGHT_RECORDER_GETTER_SETTER)
+struct _EventPipeSessionFlightRecorder {
+#else
+struct _EventPipeSessionFlightRecorder_Internal {
+#endif
+	// Array of EventPipeSessionTrigger, evaluated on every event written to the session.
+	dn_vector_t *triggers;
+	volatile uint32_t dump_requested;
+};
+
+#if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_SESSION_FLIGHT_RECORDER_GETTER_SETTER)
+struct _EventPipeSessionFlightRecorder {
+	uint8_t _internal [sizeof (struct _EventPipeSessionFlightRecorder_Internal)];
+};
+#endif
+
+// trigger_config is a comma separated list of triggers, NULL or empty if dumps are only requested
+// over the diagnostics IPC:
+//   ProviderName:EventID                                any occurrence of the event
+//   ProviderName:EventID:FieldOffset:FieldSize:Min[:Max] unsigned field (1, 2, 4 or 8 bytes) in [Min, Max]
+//   ProviderName:EventID:FieldOffset:s:Text             UTF-16 field equal to Text
+//   ProviderName:EventID:since:BeginEventID:Ms          event at least Ms after BeginEventID
+// For instance Microsoft-Windows-DotNETRuntime:3:since:9:200 dumps on GC pauses (SuspendEEBegin to
+// RestartEEEnd) of 200 ms or more, Microsoft-Windows-DotNETRuntime:80:0:s:System.OutOfMemoryException
+// on that exception being thrown and Microsoft-Windows-DotNETRuntime:55:12:4:6:6 on thread pool
+// starvation adjustments. The events have to be enabled in the session to be seen.
+// Returns NULL if it doesn't parse.
+EventPipeSessionFlightRecorder *
+ep_session_flight_recorder_alloc (const ep_char8_t *trigger_config);
+
+void
+ep_session_flight_recorder_free (EventPipeSessionFlightRecorder *flight_recorder);
+
+// Returns true if the event fired a trigger, a dump is then pending.
+bool
+ep_session_flight_recorder_evaluate_event (
+	EventPipeSessionFlightRecorder *flight_recorder,
+	EventPipeEvent *ep_event,
+	EventPipeEventPayload *payload);
+
+void
+ep_session_flight_recorder_request_dump (EventPipeSessionFlightRecorder *flight_recorder);
+
+// Returns true and clears the request if a dump is pending.
+bool
+ep_session_flight_recorder_take_dump_request (EventPipeSessionFlightRecorder *flight_recorder);
+
+#endif /* ENABLE_PERFTRACING */
+#endif /* __EVENTPIPE_SESSION_FLIGHT_RECORDER_H__ */
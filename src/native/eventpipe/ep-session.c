@@ -10,6 +10,9 @@
 #include "ep-event.h"
 #include "ep-file.h"
 #include "ep-session.h"
+#include "ep-session-aggregator.h"
+#include "ep-session-flight-recorder.h"
+#include "ep-event-filter.h"
 #include "ep-event-payload.h"
 #include "ep-rt.h"
 
@@ -58,15 +61,31 @@ EP_RT_DEFINE_THREAD_FUNC (streaming_thread)
 
 	EP_GCX_PREEMP_ENTER
 		while (ep_session_get_streaming_enabled (session)) {
+			if (session->aggregator) {
+				ep_timestamp_t now = ep_perf_timestamp_get ();
+				if (ep_session_aggregator_is_flush_due (session->aggregator, now))
+					ep_session_aggregator_flush (session->aggregator, session, now);
+			}
+
 			bool events_written = false;
-			if (!ep_session_write_all_buffers_to_file (session, &events_written)) {
+			if (session->flight_recorder) {
+				// Buffers stay in the ring until a dump is asked for.
+				if (ep_session_flight_recorder_take_dump_request (session->flight_recorder)) {
+					ep_buffer_manager_set_flight_recorder_dumping (session->buffer_manager, true);
+					success = ep_session_write_all_buffers_to_file (session, &events_written);
+					ep_buffer_manager_set_flight_recorder_dumping (session->buffer_manager, false);
+					if (!success)
+						break;
+				}
+			} else if (!ep_session_write_all_buffers_to_file (session, &events_written)) {
 				success = false;
 				break;
 			}
 
 			if (!events_written) {
-				// No events were available, sleep until more are available
-				ep_rt_wait_event_wait (wait_event, EP_INFINITE_WAIT, false);
+				// No events were available, sleep until more are available,
+				// or until the next aggregates are due.
+				ep_rt_wait_event_wait (wait_event, session->aggregator ? ep_session_aggregator_get_interval_ms (session->aggregator) : EP_INFINITE_WAIT, false);
 			}
 
 			// Wait until it's time to sample again.
@@ -195,11 +214,14 @@ ep_session_alloc (
 		break;
 
 	case EP_SESSION_TYPE_IPCSTREAM:
-		ipc_stream_writer = ep_ipc_stream_writer_alloc ((uint64_t)instance, stream);
-		ep_raise_error_if_nok (ipc_stream_writer != NULL);
-		instance->file = ep_file_alloc (ep_ipc_stream_writer_get_stream_writer_ref (ipc_stream_writer), format);
-		ep_raise_error_if_nok (instance->file != NULL);
-		ipc_stream_writer = NULL;
+		// A NULL stream means that the stream will be attached later, see ep_session_attach_stream.
+		if (stream) {
+			ipc_stream_writer = ep_ipc_stream_writer_alloc ((uint64_t)instance, stream);
+			ep_raise_error_if_nok (ipc_stream_writer != NULL);
+			instance->file = ep_file_alloc (ep_ipc_stream_writer_get_stream_writer_ref (ipc_stream_writer), format);
+			ep_raise_error_if_nok (instance->file != NULL);
+			ipc_stream_writer = NULL;
+		}
 		break;
 
 	default:
@@ -280,6 +302,9 @@ ep_session_free (EventPipeSession *session)
 
 	ep_buffer_manager_free (session->buffer_manager);
 	ep_file_free (session->file);
+	ep_session_aggregator_free (session->aggregator);
+	ep_session_flight_recorder_free (session->flight_recorder);
+	ep_event_filter_free (session->event_filter);
 
 	ep_session_remove_dangling_session_states (session);
 
@@ -343,6 +368,102 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+bool
+ep_session_enable_aggregation (
+	EventPipeSession *session,
+	const ep_char8_t *config,
+	uint32_t interval_ms)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (session->session_type == EP_SESSION_TYPE_IPCSTREAM || session->session_type == EP_SESSION_TYPE_FILESTREAM);
+	EP_ASSERT (session->aggregator == NULL);
+	EP_ASSERT (!ep_session_get_streaming_enabled (session));
+
+	ep_requires_lock_held ();
+
+	session->aggregator = ep_session_aggregator_alloc (config, interval_ms);
+	return session->aggregator != NULL;
+}
+
+bool
+ep_session_enable_flight_recorder (
+	EventPipeSession *session,
+	const ep_char8_t *trigger_config)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (session->session_type == EP_SESSION_TYPE_IPCSTREAM || session->session_type == EP_SESSION_TYPE_FILESTREAM);
+	EP_ASSERT (session->flight_recorder == NULL);
+	EP_ASSERT (!ep_session_get_streaming_enabled (session));
+
+	ep_requires_lock_held ();
+
+	session->flight_recorder = ep_session_flight_recorder_alloc (trigger_config);
+	ep_return_false_if_nok (session->flight_recorder != NULL);
+
+	ep_buffer_manager_enable_flight_recorder (session->buffer_manager);
+	return true;
+}
+
+bool
+ep_session_enable_event_filter (
+	EventPipeSession *session,
+	const ep_char8_t *config)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (session->event_filter == NULL);
+
+	ep_requires_lock_held ();
+
+	session->event_filter = ep_event_filter_alloc (config);
+	return session->event_filter != NULL;
+}
+
+bool
+ep_session_attach_stream (
+	EventPipeSession *session,
+	IpcStream *stream)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (session->session_type == EP_SESSION_TYPE_IPCSTREAM);
+	EP_ASSERT (stream != NULL);
+	EP_ASSERT (!ep_session_get_streaming_enabled (session));
+
+	ep_requires_lock_held ();
+
+	ep_return_false_if_nok (session->file == NULL);
+
+	bool result = false;
+	IpcStreamWriter *ipc_stream_writer = ep_ipc_stream_writer_alloc ((uint64_t)session, stream);
+	ep_raise_error_if_nok (ipc_stream_writer != NULL);
+
+	session->file = ep_file_alloc (ep_ipc_stream_writer_get_stream_writer_ref (ipc_stream_writer), session->format);
+	ep_raise_error_if_nok (session->file != NULL);
+	ipc_stream_writer = NULL;
+
+	result = true;
+
+ep_on_exit:
+	ep_requires_lock_held ();
+	return result;
+
+ep_on_error:
+	ep_ipc_stream_writer_free (ipc_stream_writer);
+	EP_ASSERT (!result);
+	ep_exit_error_handler ();
+}
+
+bool
+ep_session_trigger_dump (EventPipeSession *session)
+{
+	EP_ASSERT (session != NULL);
+
+	ep_return_false_if_nok (session->flight_recorder != NULL);
+
+	ep_session_flight_recorder_request_dump (session->flight_recorder);
+	ep_rt_wait_event_set (ep_buffer_manager_get_rt_wait_event_ref (session->buffer_manager));
+	return true;
+}
+
 void
 ep_session_execute_rundown (
 	EventPipeSession *session,
@@ -462,6 +583,15 @@ ep_session_disable (EventPipeSession *session)
 	if ((session->session_type == EP_SESSION_TYPE_IPCSTREAM || session->session_type == EP_SESSION_TYPE_FILESTREAM) && ep_session_get_streaming_enabled (session))
 		session_disable_streaming_thread (session);
 
+	// Whatever is left in a flight recorder ring gets written out, for good this time.
+	if (session->flight_recorder)
+		ep_buffer_manager_set_flight_recorder_dumping (session->buffer_manager, true);
+
+	// Ship whatever was aggregated since the last interval, writes are still allowed until the
+	// session is suspended.
+	if (session->aggregator)
+		ep_session_aggregator_flush (session->aggregator, session, ep_perf_timestamp_get ());
+
 	bool ignored;
 	ep_session_write_all_buffers_to_file (session, &ignored);
 	ep_session_provider_list_clear (session->providers);
@@ -504,7 +634,17 @@ ep_session_write_event (
 
 	// Filter events specific to "this" session based on precomputed flag on provider/events.
 	if (ep_event_is_enabled_by_mask (ep_event, ep_session_get_mask (session))) {
-		if (session->synchronous_callback) {
+		// Only flags the dump, the streaming thread does the writing.
+		if (session->flight_recorder && ep_session_flight_recorder_evaluate_event (session->flight_recorder, ep_event, payload))
+			ep_rt_wait_event_set (ep_buffer_manager_get_rt_wait_event_ref (session->buffer_manager));
+
+		// Dropped before any stack walk or copy into the buffers.
+		if (session->event_filter && !ep_event_filter_is_event_allowed (session->event_filter, ep_event, payload))
+			return false;
+
+		if (session->aggregator && ep_session_aggregator_aggregate_event (session->aggregator, ep_event, payload)) {
+			result = true;
+		} else if (session->synchronous_callback) {
 			session->synchronous_callback (
 				ep_event_get_provider (ep_event),
 				ep_event_get_event_id (ep_event),
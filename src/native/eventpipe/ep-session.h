@@ -33,6 +33,12 @@ struct _EventPipeSession_Internal {
 	EventPipeBufferManager *buffer_manager;
 	// Object used to flush event data (File, IPC stream, etc.).
 	EventPipeFile *file;
+	// When set, the events it selects are aggregated in process instead of being streamed.
+	EventPipeSessionAggregator *aggregator;
+	// When set, the buffers are only written out when a dump is requested.
+	EventPipeSessionFlightRecorder *flight_recorder;
+	// When set, events failing its payload predicates are dropped before being recorded.
+	EventPipeEventFilter *event_filter;
 	// For synchoronous sessions.
 	EventPipeSessionSynchronousCallback synchronous_callback;
 	// Additional data to pass to the callback
@@ -113,6 +119,48 @@ ep_session_get_session_provider (
 bool
 ep_session_enable_rundown (EventPipeSession *session);
 
+// Aggregates the events selected by config (see ep_session_aggregator_alloc) instead of
+// streaming them, flushing the aggregates every interval_ms. Streaming sessions only, before
+// ep_session_start_streaming.
+// _Requires_lock_held (ep)
+bool
+ep_session_enable_aggregation (
+	EventPipeSession *session,
+	const ep_char8_t *config,
+	uint32_t interval_ms);
+
+// Keeps the session buffers in memory as a ring and writes them out only when a dump is
+// requested, over the diagnostics IPC or by the triggers in trigger_config (see
+// ep_session_flight_recorder_alloc), and when the session is disabled. Streaming sessions only,
+// before ep_session_start_streaming.
+// _Requires_lock_held (ep)
+bool
+ep_session_enable_flight_recorder (
+	EventPipeSession *session,
+	const ep_char8_t *trigger_config);
+
+// Drops the events failing the payload predicates in config (see ep_event_filter_alloc) before
+// they are recorded. Before ep_session_start_streaming.
+// _Requires_lock_held (ep)
+bool
+ep_session_enable_event_filter (
+	EventPipeSession *session,
+	const ep_char8_t *config);
+
+// Gives an IPC stream session allocated without a stream the stream to write to. What was
+// buffered until then goes out once ep_session_start_streaming is called. Returns false if the
+// session already has one.
+// _Requires_lock_held (ep)
+bool
+ep_session_attach_stream (
+	EventPipeSession *session,
+	IpcStream *stream);
+
+// Asks the streaming thread to write out the buffers of a flight recorder session.
+// Returns false if the session isn't one.
+bool
+ep_session_trigger_dump (EventPipeSession *session);
+
 // _Requires_lock_held (ep)
 void
 ep_session_execute_rundown (
@@ -19,6 +19,7 @@ typedef struct _EventPipeEvent EventPipeEvent;
 typedef struct _EventPipeEventBlockBase EventPipeEventBlockBase;
 typedef struct _EventPipeEventBlock EventPipeEventBlock;
 typedef struct _EventPipeEventHeader EventPipeEventHeader;
+typedef struct _EventPipeEventFilter EventPipeEventFilter;
 typedef struct _EventPipeEventInstance EventPipeEventInstance;
 typedef struct _EventPipeEventMetadataEvent EventPipeEventMetadataEvent;
 typedef struct _EventPipeEventPayload EventPipeEventPayload;
@@ -33,8 +34,12 @@ typedef struct _EventPipeProviderCallbackDataQueue EventPipeProviderCallbackData
 typedef struct _EventPipeProviderConfiguration EventPipeProviderConfiguration;
 typedef struct _EventPipeExecutionCheckpoint EventPipeExecutionCheckpoint;
 typedef struct _EventPipeSession EventPipeSession;
+typedef struct _EventPipeSessionAggregation EventPipeSessionAggregation;
+typedef struct _EventPipeSessionAggregator EventPipeSessionAggregator;
+typedef struct _EventPipeSessionFlightRecorder EventPipeSessionFlightRecorder;
 typedef struct _EventPipeSessionProvider EventPipeSessionProvider;
 typedef struct _EventPipeSessionProviderList EventPipeSessionProviderList;
+typedef struct _EventPipeSessionTrigger EventPipeSessionTrigger;
 typedef struct _EventPipeSequencePoint EventPipeSequencePoint;
 typedef struct _EventPipeSequencePointBlock EventPipeSequencePointBlock;
 typedef struct _EventPipeStackBlock EventPipeStackBlock;
@@ -142,6 +147,13 @@ typedef enum {
 	EP_SERIALIZATION_FORMAT_COUNT
 } EventPipeSerializationFormat;
 
+typedef enum {
+	EP_BLOCK_COMPRESSION_NONE = 0,
+	EP_BLOCK_COMPRESSION_LZ4 = 1,
+	EP_BLOCK_COMPRESSION_ZSTD = 2,
+	EP_BLOCK_COMPRESSION_COUNT
+} EventPipeBlockCompression;
+
 typedef enum {
 	EP_SESSION_TYPE_FILE,
 	EP_SESSION_TYPE_LISTENER,
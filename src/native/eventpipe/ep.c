@@ -5,11 +5,14 @@
 
 #define EP_IMPL_EP_GETTER_SETTER
 #include "ep.h"
+#include "ep-block.h"
+#include "ep-buffer-manager.h"
 #include "ep-config.h"
 #include "ep-config-internals.h"
 #include "ep-event.h"
 #include "ep-event-payload.h"
 #include "ep-event-source.h"
+#include "ep-file.h"
 #include "ep-provider.h"
 #include "ep-provider-internals.h"
 #include "ep-session.h"
@@ -26,6 +29,10 @@
 //!  ThreadTransferKeyword              (0x80000000)
 uint64_t ep_default_rundown_keyword = 0x80020139;
 
+// Rundown keywords describing jitted methods (JitKeyword, JittedMethodILToNativeMapKeyword),
+// left out of sessions asking for incremental method metadata.
+#define EP_RUNDOWN_JITTED_METHOD_KEYWORDS ((uint64_t)0x00020010)
+
 static bool _ep_can_start_threads = false;
 
 static dn_vector_t *_ep_deferred_enable_session_ids = NULL;
@@ -35,6 +42,9 @@ static EventPipeIpcStreamFactorySuspendedPortsCallback _ep_ipc_stream_factory_su
 
 static dn_vector_ptr_t *_ep_rundown_execution_checkpoints = NULL;
 
+// Session started by ep_init from DOTNET_EventPipeStartupSession, until a diagnostics client attaches to it.
+static EventPipeSessionID _ep_startup_session_id = 0;
+
 /*
  * Forward declares of all static functions.
  */
@@ -111,10 +121,26 @@ static
 uint32_t
 get_next_config_value_as_uint32_t (const ep_char8_t **data);
 
+static
+EventPipeProviderConfiguration *
+providers_config_parse (
+	const ep_char8_t *providers_config,
+	int32_t *providers_len);
+
+static
+void
+providers_config_free (
+	EventPipeProviderConfiguration *providers,
+	int32_t providers_len);
+
 static
 void
 enable_default_session_via_env_variables (void);
 
+static
+void
+enable_startup_session_via_env_variables (void);
+
 static
 bool
 session_requested_sampling (EventPipeSession *session);
@@ -471,7 +497,17 @@ static bool check_options_valid (const EventPipeSessionOptions *options)
 		return false;
 	if ((options->session_type == EP_SESSION_TYPE_FILE || options->session_type == EP_SESSION_TYPE_FILESTREAM) && options->output_path == NULL)
 		return false;
-	if (options->session_type == EP_SESSION_TYPE_IPCSTREAM && options->stream == NULL)
+	if (options->session_type == EP_SESSION_TYPE_IPCSTREAM && options->stream == NULL && !options->startup_session)
+		return false;
+	if (options->block_compression != EP_BLOCK_COMPRESSION_NONE && (options->format < EP_SERIALIZATION_FORMAT_NETTRACE_V4 || !ep_block_compression_is_supported (options->block_compression)))
+		return false;
+	if (options->aggregation_config != NULL && (options->aggregation_interval_ms == 0 || (options->session_type != EP_SESSION_TYPE_IPCSTREAM && options->session_type != EP_SESSION_TYPE_FILESTREAM)))
+		return false;
+	if (options->flight_recorder && options->session_type != EP_SESSION_TYPE_IPCSTREAM && options->session_type != EP_SESSION_TYPE_FILESTREAM)
+		return false;
+	if (options->flight_recorder_trigger_config != NULL && !options->flight_recorder)
+		return false;
+	if (options->startup_session && (options->session_type != EP_SESSION_TYPE_IPCSTREAM || options->stream != NULL))
 		return false;
 
 	return true;
@@ -495,6 +531,7 @@ enable (
 	uint32_t session_index = 0;
 
 	ep_raise_error_if_nok (ep_volatile_load_eventpipe_state () == EP_STATE_INITIALIZED);
+	ep_raise_error_if_nok (!options->startup_session || _ep_startup_session_id == 0);
 
 	session_index = generate_session_index ();
 	ep_raise_error_if_nok (session_index < EP_MAX_NUMBER_OF_SESSIONS);
@@ -515,6 +552,21 @@ enable (
 
 	ep_raise_error_if_nok (session != NULL && ep_session_is_valid (session));
 
+	if (ep_session_get_file (session) != NULL)
+		ep_raise_error_if_nok (ep_file_set_block_compression (ep_session_get_file (session), options->block_compression));
+
+	if (options->aggregation_config != NULL)
+		ep_raise_error_if_nok (ep_session_enable_aggregation (session, options->aggregation_config, options->aggregation_interval_ms));
+
+	if (options->flight_recorder)
+		ep_raise_error_if_nok (ep_session_enable_flight_recorder (session, options->flight_recorder_trigger_config));
+
+	if (options->event_filter_config != NULL)
+		ep_raise_error_if_nok (ep_session_enable_event_filter (session, options->event_filter_config));
+
+	if (options->startup_session)
+		ep_raise_error_if_nok (ep_buffer_manager_alloc_arena (ep_session_get_buffer_manager (session)));
+
 	session_id = (EventPipeSessionID)session;
 
 	// Return if the index is invalid.
@@ -551,6 +603,9 @@ enable (
 	if (session_requested_sampling (session))
 		ep_sample_profiler_enable ();
 
+	if (options->startup_session)
+		_ep_startup_session_id = session_id;
+
 ep_on_exit:
 	ep_requires_lock_held ();
 	return session_id;
@@ -586,6 +641,9 @@ disable_holding_lock (
 	if (is_session_id_in_collection (id)) {
 		EventPipeSession *const session = (EventPipeSession *)(uintptr_t)id;
 
+		if (id == _ep_startup_session_id)
+			_ep_startup_session_id = 0;
+
 		if (session_requested_sampling (session)) {
 			// Disable the profiler.
 			ep_sample_profiler_disable ();
@@ -876,6 +934,106 @@ get_next_config_value_as_uint32_t (const ep_char8_t **data)
 	return value;
 }
 
+static
+EventPipeProviderConfiguration *
+providers_config_parse (
+	const ep_char8_t *providers_config,
+	int32_t *providers_len)
+{
+	EP_ASSERT (providers_len != NULL);
+
+	const ep_char8_t *providers_config_to_parse = providers_config;
+	EventPipeProviderConfiguration *providers = NULL;
+	int32_t current_provider = 0;
+
+	*providers_len = 0;
+
+	// If no specific providers config is used, enable EventPipe session
+	// with the default provider configurations.
+	if (!providers_config_to_parse || *providers_config_to_parse == '\0') {
+		*providers_len = 3;
+
+		providers = ep_rt_object_array_alloc (EventPipeProviderConfiguration, *providers_len);
+		ep_raise_error_if_nok (providers != NULL);
+
+		ep_provider_config_init (&providers [0], ep_rt_utf8_string_dup (ep_config_get_public_provider_name_utf8 ()), 0x4c14fccbd, EP_EVENT_LEVEL_VERBOSE, NULL);
+		ep_provider_config_init (&providers [1], ep_rt_utf8_string_dup (ep_config_get_private_provider_name_utf8 ()), 0x4002000b, EP_EVENT_LEVEL_VERBOSE, NULL);
+		ep_provider_config_init (&providers [2], ep_rt_utf8_string_dup (ep_config_get_sample_profiler_provider_name_utf8 ()), 0x0, EP_EVENT_LEVEL_VERBOSE, NULL);
+	} else {
+		// Count number of providers to parse.
+		while (*providers_config_to_parse != '\0') {
+			*providers_len += 1;
+			while (*providers_config_to_parse != '\0' && *providers_config_to_parse != ',')
+				providers_config_to_parse++;
+
+			if (*providers_config_to_parse != '\0')
+				providers_config_to_parse++;
+		}
+
+		providers_config_to_parse = providers_config;
+
+		providers = ep_rt_object_array_alloc (EventPipeProviderConfiguration, *providers_len);
+		ep_raise_error_if_nok (providers != NULL);
+
+		while (*providers_config_to_parse != '\0') {
+			ep_char8_t *provider_name = NULL;
+			uint64_t keyword_mask = 0;
+			EventPipeEventLevel level = EP_EVENT_LEVEL_VERBOSE;
+			ep_char8_t *args = NULL;
+
+			if (providers_config_to_parse && *providers_config_to_parse != ',') {
+				provider_name = get_next_config_value_as_utf8_string (&providers_config_to_parse);
+				ep_raise_error_if_nok (provider_name != NULL);
+			}
+
+			if (providers_config_to_parse && *providers_config_to_parse != ',')
+				keyword_mask = get_next_config_value_as_uint64_t (&providers_config_to_parse);
+
+			if (providers_config_to_parse && *providers_config_to_parse != ',')
+				level = (EventPipeEventLevel)get_next_config_value_as_uint32_t (&providers_config_to_parse);
+
+			if (providers_config_to_parse && *providers_config_to_parse != ',')
+				args = get_next_config_value_as_utf8_string (&providers_config_to_parse);
+
+			ep_provider_config_init (&providers [current_provider++], provider_name, keyword_mask, level, args);
+
+			if (!providers_config_to_parse)
+				break;
+
+			while (*providers_config_to_parse != '\0' && *providers_config_to_parse != ',')
+				providers_config_to_parse++;
+
+			if (*providers_config_to_parse != '\0')
+				providers_config_to_parse++;
+		}
+	}
+
+ep_on_exit:
+	return providers;
+
+ep_on_error:
+	providers_config_free (providers, *providers_len);
+	providers = NULL;
+	*providers_len = 0;
+	ep_exit_error_handler ();
+}
+
+static
+void
+providers_config_free (
+	EventPipeProviderConfiguration *providers,
+	int32_t providers_len)
+{
+	ep_return_void_if_nok (providers != NULL);
+
+	for (int32_t i = 0; i < providers_len; ++i) {
+		ep_provider_config_fini (&providers [i]);
+		ep_rt_utf8_string_free ((ep_char8_t *)providers [i].provider_name);
+		ep_rt_utf8_string_free ((ep_char8_t *)providers [i].filter_data);
+	}
+	ep_rt_object_array_free (providers);
+}
+
 //
 // If EventPipe environment variables are specified, parse them and start a session.
 //
@@ -933,6 +1091,55 @@ enable_default_session_via_env_variables (void)
 	return;
 }
 
+//
+// If a startup session is configured, start buffering right away. Nothing is written until a
+// diagnostics client attaches to it, see ep_attach_startup_session.
+//
+static
+void
+enable_startup_session_via_env_variables (void)
+{
+	ep_char8_t *startup_config = ep_rt_config_value_get_startup_session_config ();
+	EventPipeProviderConfiguration *providers = NULL;
+	int32_t providers_len = 0;
+
+	if (startup_config && *startup_config != '\0') {
+		providers = providers_config_parse (startup_config, &providers_len);
+		ep_raise_error_if_nok (providers != NULL);
+
+		// Unlike the circular buffer of other sessions, all of it is allocated up front.
+		uint32_t startup_mb = ep_rt_config_value_get_startup_session_mb ();
+
+		EventPipeSessionOptions options;
+		ep_session_options_init (
+			&options,
+			NULL,
+			startup_mb > 0 ? startup_mb : 16,
+			providers,
+			providers_len,
+			EP_SESSION_TYPE_IPCSTREAM,
+			EP_SERIALIZATION_FORMAT_NETTRACE_V4,
+			ep_default_rundown_keyword,
+			true, // stackwalk_requested
+			NULL,
+			NULL,
+			NULL);
+		options.startup_session = true;
+
+		ep_enable_3 (&options);
+
+		ep_session_options_fini (&options);
+	}
+
+ep_on_exit:
+	providers_config_free (providers, providers_len);
+	ep_rt_utf8_string_free (startup_config);
+	return;
+
+ep_on_error:
+	ep_exit_error_handler ();
+}
+
 static
 bool
 session_requested_sampling (EventPipeSession *session)
@@ -1011,71 +1218,11 @@ ep_enable_2 (
 	EventPipeSessionSynchronousCallback sync_callback,
 	void *callback_additional_data)
 {
-	const ep_char8_t *providers_config_to_parse = providers_config;
 	int32_t providers_len = 0;
-	EventPipeProviderConfiguration *providers = NULL;
-	int32_t current_provider = 0;
 	uint64_t session_id = 0;
 
-	// If no specific providers config is used, enable EventPipe session
-	// with the default provider configurations.
-	if (!providers_config_to_parse || *providers_config_to_parse == '\0') {
-		providers_len = 3;
-
-		providers = ep_rt_object_array_alloc (EventPipeProviderConfiguration, providers_len);
-		ep_raise_error_if_nok (providers != NULL);
-
-		ep_provider_config_init (&providers [0], ep_rt_utf8_string_dup (ep_config_get_public_provider_name_utf8 ()), 0x4c14fccbd, EP_EVENT_LEVEL_VERBOSE, NULL);
-		ep_provider_config_init (&providers [1], ep_rt_utf8_string_dup (ep_config_get_private_provider_name_utf8 ()), 0x4002000b, EP_EVENT_LEVEL_VERBOSE, NULL);
-		ep_provider_config_init (&providers [2], ep_rt_utf8_string_dup (ep_config_get_sample_profiler_provider_name_utf8 ()), 0x0, EP_EVENT_LEVEL_VERBOSE, NULL);
-	} else {
-		// Count number of providers to parse.
-		while (*providers_config_to_parse != '\0') {
-			providers_len += 1;
-			while (*providers_config_to_parse != '\0' && *providers_config_to_parse != ',')
-				providers_config_to_parse++;
-
-			if (*providers_config_to_parse != '\0')
-				providers_config_to_parse++;
-		}
-
-		providers_config_to_parse = providers_config;
-
-		providers = ep_rt_object_array_alloc (EventPipeProviderConfiguration, providers_len);
-		ep_raise_error_if_nok (providers != NULL);
-
-		while (*providers_config_to_parse != '\0') {
-			ep_char8_t *provider_name = NULL;
-			uint64_t keyword_mask = 0;
-			EventPipeEventLevel level = EP_EVENT_LEVEL_VERBOSE;
-			ep_char8_t *args = NULL;
-
-			if (providers_config_to_parse && *providers_config_to_parse != ',') {
-				provider_name = get_next_config_value_as_utf8_string (&providers_config_to_parse);
-				ep_raise_error_if_nok (provider_name != NULL);
-			}
-
-			if (providers_config_to_parse && *providers_config_to_parse != ',')
-				keyword_mask = get_next_config_value_as_uint64_t (&providers_config_to_parse);
-
-			if (providers_config_to_parse && *providers_config_to_parse != ',')
-				level = (EventPipeEventLevel)get_next_config_value_as_uint32_t (&providers_config_to_parse);
-
-			if (providers_config_to_parse && *providers_config_to_parse != ',')
-				args = get_next_config_value_as_utf8_string (&providers_config_to_parse);
-
-			ep_provider_config_init (&providers [current_provider++], provider_name, keyword_mask, level, args);
-
-			if (!providers_config_to_parse)
-				break;
-
-			while (*providers_config_to_parse != '\0' && *providers_config_to_parse != ',')
-				providers_config_to_parse++;
-
-			if (*providers_config_to_parse != '\0')
-				providers_config_to_parse++;
-		}
-	}
+	EventPipeProviderConfiguration *providers = providers_config_parse (providers_config, &providers_len);
+	ep_return_zero_if_nok (providers != NULL);
 
 	session_id = ep_enable (
 		output_path,
@@ -1089,22 +1236,8 @@ ep_enable_2 (
 		sync_callback,
 		callback_additional_data);
 
-ep_on_exit:
-
-	if (providers) {
-		for (int32_t i = 0; i < providers_len; ++i) {
-			ep_provider_config_fini (&providers [i]);
-			ep_rt_utf8_string_free ((ep_char8_t *)providers [i].provider_name);
-			ep_rt_utf8_string_free ((ep_char8_t *)providers [i].filter_data);
-		}
-		ep_rt_object_array_free (providers);
-	}
-
+	providers_config_free (providers, providers_len);
 	return session_id;
-
-ep_on_error:
-	ep_exit_error_handler ();
-
 }
 
 void
@@ -1132,6 +1265,14 @@ ep_session_options_init (
 	options->format = format;
 	options->rundown_keyword = rundown_keyword;
 	options->stackwalk_requested = stackwalk_requested;
+	options->block_compression = EP_BLOCK_COMPRESSION_NONE;
+	options->aggregation_config = NULL;
+	options->aggregation_interval_ms = 0;
+	options->flight_recorder = false;
+	options->flight_recorder_trigger_config = NULL;
+	options->incremental_method_metadata = false;
+	options->event_filter_config = NULL;
+	options->startup_session = false;
 	options->stream = stream;
 	options->sync_callback = sync_callback;
 	options->callback_additional_data = callback_additional_data;
@@ -1152,9 +1293,16 @@ ep_enable_3 (const EventPipeSessionOptions *options)
 	EventPipeProviderCallbackDataQueue callback_data_queue;
 	EventPipeProviderCallbackData provider_callback_data;
 	EventPipeProviderCallbackDataQueue *provider_callback_data_queue = ep_provider_callback_data_queue_init (&callback_data_queue);
+	EventPipeSessionOptions session_options = *options;
+
+	// Once the runtime logs jitted methods as they are compiled, starting with the ones that
+	// already are, the rundown only has to describe the modules. The log is started before the
+	// session so no method falls in between.
+	if (session_options.incremental_method_metadata && ep_rt_enable_method_load_log ())
+		session_options.rundown_keyword &= ~EP_RUNDOWN_JITTED_METHOD_KEYWORDS;
 
 	EP_LOCK_ENTER (section1)
-		session_id = enable (options, provider_callback_data_queue);
+		session_id = enable (&session_options, provider_callback_data_queue);
 	EP_LOCK_EXIT (section1)
 
 	while (ep_provider_callback_data_queue_try_dequeue (provider_callback_data_queue, &provider_callback_data)) {
@@ -1228,6 +1376,52 @@ ep_on_error:
 	ep_exit_error_handler ();
 }
 
+bool
+ep_trigger_dump (EventPipeSessionID session_id)
+{
+	ep_requires_lock_not_held ();
+
+	bool result = false;
+
+	EP_LOCK_ENTER (section1)
+		ep_raise_error_if_nok_holding_lock (is_session_id_in_collection (session_id), section1);
+		result = ep_session_trigger_dump ((EventPipeSession *)(uintptr_t)session_id);
+	EP_LOCK_EXIT (section1)
+
+ep_on_exit:
+	ep_requires_lock_not_held ();
+	return result;
+
+ep_on_error:
+	EP_ASSERT (!result);
+	ep_exit_error_handler ();
+}
+
+EventPipeSessionID
+ep_attach_startup_session (IpcStream *stream)
+{
+	ep_return_zero_if_nok (stream != NULL);
+
+	ep_requires_lock_not_held ();
+
+	EventPipeSessionID session_id = 0;
+
+	EP_LOCK_ENTER (section1)
+		ep_raise_error_if_nok_holding_lock (_ep_startup_session_id != 0 && is_session_id_in_collection (_ep_startup_session_id), section1);
+		ep_raise_error_if_nok_holding_lock (ep_session_attach_stream ((EventPipeSession *)(uintptr_t)_ep_startup_session_id, stream), section1);
+		session_id = _ep_startup_session_id;
+		_ep_startup_session_id = 0;
+	EP_LOCK_EXIT (section1)
+
+ep_on_exit:
+	ep_requires_lock_not_held ();
+	return session_id;
+
+ep_on_error:
+	EP_ASSERT (session_id == 0);
+	ep_exit_error_handler ();
+}
+
 bool
 ep_is_session_enabled (EventPipeSessionID session_id)
 {
@@ -1421,6 +1615,7 @@ ep_init (void)
 	EP_LOCK_EXIT (section1)
 
 	enable_default_session_via_env_variables ();
+	enable_startup_session_via_env_variables ();
 
 ep_on_exit:
 	ep_requires_lock_not_held ();
@@ -119,14 +119,29 @@ typedef struct EventPipeSessionOptions {
 	const EventPipeProviderConfiguration *providers;
 	IpcStream *stream;
 	const ep_char8_t *output_path;
+	// ProviderName:EventID[:FieldOffset:FieldSize],... events to aggregate in process, see ep-session-aggregator.h.
+	const ep_char8_t *aggregation_config;
+	// With flight_recorder, the triggers dumping the ring, see ep-session-flight-recorder.h.
+	const ep_char8_t *flight_recorder_trigger_config;
+	// ProviderName:EventID:FieldOffset:Kind:Value,... payload predicates, see ep-event-filter.h.
+	const ep_char8_t *event_filter_config;
 	void *callback_additional_data;
 	EventPipeSessionSynchronousCallback sync_callback;
 	uint32_t circular_buffer_size_in_mb;
 	uint32_t providers_len;
+	uint32_t aggregation_interval_ms;
 	EventPipeSessionType session_type;
 	EventPipeSerializationFormat format;
 	uint64_t rundown_keyword;
+	EventPipeBlockCompression block_compression;
 	bool stackwalk_requested;
+	bool flight_recorder;
+	// Leaves jitted methods out of the rundown when the runtime can log them as they are compiled
+	// instead (the perf map for CoreCLR), see ep_rt_enable_method_load_log.
+	bool incremental_method_metadata;
+	// IPC stream session started without a stream, buffering into memory allocated up front until a
+	// diagnostics client attaches, see ep_attach_startup_session. At most one at a time.
+	bool startup_session;
 } EventPipeSessionOptions;
 
 void
@@ -198,6 +213,15 @@ ep_disable (EventPipeSessionID id);
 EventPipeSession *
 ep_get_session (EventPipeSessionID session_id);
 
+// Writes out the ring of a flight recorder session, returns false if there is no such session.
+bool
+ep_trigger_dump (EventPipeSessionID session_id);
+
+// Hands stream to the startup session, which then has to be started with ep_start_streaming.
+// Returns 0 if there is no startup session or a client already attached to it.
+EventPipeSessionID
+ep_attach_startup_session (IpcStream *stream);
+
 bool
 ep_is_session_enabled (EventPipeSessionID session_id);
 
@@ -0,0 +1,32 @@
+# Builds the in-tree zlib-ng as a static library with the zlib compatible API.
+#
+# zlib-ng detects the CPU at runtime and picks SSE2/SSSE3/SSE4.2/PCLMULQDQ/AVX2/AVX512 (x86) or
+# NEON/ACLE (Arm) implementations of crc32, adler32, the longest match and slide hash, so one build
+# serves every machine. Consumers link the `zlib` target and include <zlib.h>.
+
+set(ZLIB_COMPAT ON)
+set(ZLIB_ENABLE_TESTS OFF)
+set(ZLIBNG_ENABLE_TESTS OFF)
+set(WITH_GTEST OFF)
+set(WITH_GZFILEOP OFF)
+set(WITH_NATIVE_INSTRUCTIONS OFF) # keep runtime dispatch instead of targeting the build machine
+set(WITH_NEW_STRATEGIES ON)       # deflate_quick for level 1 and deflate_medium for levels 3-6
+set(SKIP_INSTALL_ALL ON)
+
+if (CLR_CMAKE_TARGET_BROWSER OR CLR_CMAKE_TARGET_WASI)
+    # No runtime CPU detection on wasm.
+    set(WITH_OPTIM OFF)
+endif()
+
+set(_ZLIB_NG_BUILD_SHARED_LIBS ${BUILD_SHARED_LIBS})
+set(BUILD_SHARED_LIBS OFF)
+add_subdirectory(${CMAKE_CURRENT_LIST_DIR}/zlib-ng ${CMAKE_CURRENT_BINARY_DIR}/zlib-ng EXCLUDE_FROM_ALL)
+set(BUILD_SHARED_LIBS ${_ZLIB_NG_BUILD_SHARED_LIBS})
+set(SKIP_INSTALL_ALL OFF)
+
+set_target_properties(zlib PROPERTIES POSITION_INDEPENDENT_CODE ON)
+
+# zlib-ng is third party code, don't hold it to our warning levels.
+target_compile_options(zlib PRIVATE
+    $<$<COMPILE_LANG_AND_ID:C,Clang,AppleClang,GNU>:-w>
+    $<$<COMPILE_LANG_AND_ID:C,MSVC>:/W0>)
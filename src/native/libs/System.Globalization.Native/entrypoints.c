@@ -24,6 +24,7 @@ static const Entry s_globalizationNative[] =
     DllImportEntry(GlobalizationNative_ChangeCaseTurkish)
     DllImportEntry(GlobalizationNative_CloseSortHandle)
     DllImportEntry(GlobalizationNative_CompareString)
+    DllImportEntry(GlobalizationNative_EnableSortKeyCache)
     DllImportEntry(GlobalizationNative_EndsWith)
     DllImportEntry(GlobalizationNative_EnumCalendarInfo)
     DllImportEntry(GlobalizationNative_GetCalendarInfo)
@@ -40,6 +41,7 @@ static const Entry s_globalizationNative[] =
     DllImportEntry(GlobalizationNative_GetLocaleTimeFormat)
     DllImportEntry(GlobalizationNative_GetSortHandle)
     DllImportEntry(GlobalizationNative_GetSortKey)
+    DllImportEntry(GlobalizationNative_GetSortKeys)
     DllImportEntry(GlobalizationNative_GetSortVersion)
     DllImportEntry(GlobalizationNative_GetTimeZoneDisplayName)
     DllImportEntry(GlobalizationNative_IanaIdToWindowsId)
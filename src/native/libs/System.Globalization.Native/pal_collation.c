@@ -38,15 +38,57 @@ c_static_assert_msg(USEARCH_DONE == -1, "managed side requires -1 for not found"
 // change ICU's default behavior here isn't really justified unless someone has a strong reason
 // for !StringSort to behave differently.
 
-#define USED_STRING_SEARCH ((UStringSearch*) (-1))
-
 typedef struct { int32_t key; UCollator* UCollator; } TCollatorMap;
 
-typedef struct SearchIteratorNode
+/*
+ * A pooled search iterator. usearch keeps a pointer to the pattern rather than a copy, so the
+ * entry owns the pattern the iterator was last set up with; a repeated needle can then skip
+ * usearch_setPattern, which recomputes the pattern's collation elements.
+ */
+typedef struct SearchIteratorEntry
 {
     UStringSearch* searchIterator;
-    struct SearchIteratorNode* next;
-} SearchIteratorNode;
+    UChar* pattern;
+    int32_t patternLength;
+    int32_t patternCapacity;
+    int32_t options;
+} SearchIteratorEntry;
+
+// Idle search iterators kept per set of options. A thread starts looking at the slot its stack
+// hashes to, so under parallel load each thread mostly gets back the iterator (and needle) it
+// used last, and lookups never walk more than this many slots.
+#define SearchIteratorSlotCount 16
+
+/*
+ * A sort key computed for one string with one set of options. The string and the sort key
+ * are stored inline after the header.
+ */
+typedef struct SortKeyCacheEntry
+{
+    uint32_t hash;
+    int32_t options;
+    int32_t stringLength;
+    int32_t sortKeyLength;
+} SortKeyCacheEntry;
+
+#define SortKeyCacheEntryString(pEntry) ((const UChar*)((pEntry) + 1))
+#define SortKeyCacheEntrySortKey(pEntry) ((uint8_t*)((pEntry) + 1) + (size_t)(pEntry)->stringLength * sizeof(UChar))
+
+/*
+ * Sort keys for recently compared short strings. ucol_strcoll has to walk both strings every
+ * time, while comparing two sort keys is a memcmp, so repeated comparisons of the same strings
+ * (sorting, ordered lookups) get much cheaper.
+ *
+ * The cache is direct mapped and lock free: a thread takes an entry out of its slot with a CAS
+ * and puts it back when done, so whoever removed an entry from a slot owns it and may free it.
+ * The most recently used string wins a contended slot.
+ */
+typedef struct SortKeyCache
+{
+    uint32_t slotMask;
+    int32_t maxStringLength;
+    SortKeyCacheEntry* volatile slots[];
+} SortKeyCache;
 
 /*
  * For increased performance, we cache the UCollator objects for a locale and
@@ -56,7 +98,8 @@ typedef struct SearchIteratorNode
 struct SortHandle
 {
     UCollator* collatorsPerOption[CompareOptionsMask + 1];
-    SearchIteratorNode searchIteratorList[CompareOptionsMask + 1];
+    SearchIteratorEntry* volatile searchIterators[CompareOptionsMask + 1][SearchIteratorSlotCount];
+    SortKeyCache* volatile sortKeyCache;
 };
 
 // Hiragana character range
@@ -631,40 +674,44 @@ static void CloseSearchIterator(UStringSearch* pSearch)
     }
 }
 
+static void FreeSearchIteratorEntry(SearchIteratorEntry* pEntry)
+{
+    CloseSearchIterator(pEntry->searchIterator);
+    free(pEntry->pattern);
+    free(pEntry);
+}
+
 void GlobalizationNative_CloseSortHandle(SortHandle* pSortHandle)
 {
     for (int i = 0; i <= CompareOptionsMask; i++)
     {
-        if (pSortHandle->collatorsPerOption[i] != NULL)
+        for (int j = 0; j < SearchIteratorSlotCount; j++)
         {
-            UStringSearch* pSearch = pSortHandle->searchIteratorList[i].searchIterator;
-            if (pSearch != NULL)
+            if (pSortHandle->searchIterators[i][j] != NULL)
             {
-                if (pSearch != USED_STRING_SEARCH)
-                {
-                    CloseSearchIterator(pSearch);
-                }
-                pSortHandle->searchIteratorList[i].searchIterator = NULL;
-                SearchIteratorNode* pNext = pSortHandle->searchIteratorList[i].next;
-                pSortHandle->searchIteratorList[i].next = NULL;
-
-                while (pNext != NULL)
-                {
-                    if (pNext->searchIterator != NULL && pNext->searchIterator != USED_STRING_SEARCH)
-                    {
-                        CloseSearchIterator(pNext->searchIterator);
-                    }
-                    SearchIteratorNode* pCurrent = pNext;
-                    pNext = pCurrent->next;
-                    free(pCurrent);
-                }
+                FreeSearchIteratorEntry(pSortHandle->searchIterators[i][j]);
+                pSortHandle->searchIterators[i][j] = NULL;
             }
+        }
 
+        if (pSortHandle->collatorsPerOption[i] != NULL)
+        {
             ucol_close(pSortHandle->collatorsPerOption[i]);
             pSortHandle->collatorsPerOption[i] = NULL;
         }
     }
 
+    SortKeyCache* pCache = pSortHandle->sortKeyCache;
+    if (pCache != NULL)
+    {
+        for (uint32_t i = 0; i <= pCache->slotMask; i++)
+        {
+            free(pCache->slots[i]);
+        }
+
+        free(pCache);
+    }
+
     free(pSortHandle);
 }
 
@@ -697,176 +744,159 @@ static const UCollator* GetCollatorFromSortHandle(SortHandle* pSortHandle, int32
     }
 }
 
-// CreateNewSearchNode will create a new node in the linked list and mark this node search handle as borrowed handle.
-static inline int32_t CreateNewSearchNode(SortHandle* pSortHandle, int32_t options)
+static uint32_t GetSearchIteratorSlotHint(void)
 {
-    SearchIteratorNode* node = (SearchIteratorNode*)calloc(1, sizeof(SearchIteratorNode));
-    if (node == NULL)
-    {
-        return false;
-    }
-
-    node->searchIterator = USED_STRING_SEARCH; // Mark the new node search handle as borrowed.
-    node->next = NULL;
-
-    SearchIteratorNode* pCurrent = &pSortHandle->searchIteratorList[options];
-    assert(pCurrent->searchIterator != NULL && "Search iterator not expected to be NULL at this stage.");
+    // Threads run on distinct stacks, so the address of a local is a cheap per-thread hint.
+    volatile uint8_t local = 0;
+    uintptr_t address = (uintptr_t)&local;
+    return (uint32_t)((address >> 16) * 2654435761u) >> 28;
+}
 
-    SearchIteratorNode* pNull = NULL;
-    do
+// Points the entry's iterator at the pattern, copying it into the entry.
+static int32_t SetSearchIteratorPattern(SearchIteratorEntry* pEntry, const UChar* lpTarget, int32_t cwTargetLength, UErrorCode* pErr)
+{
+    if (cwTargetLength > pEntry->patternCapacity)
     {
-        if (pCurrent->next == NULL && pal_atomic_cas_ptr((void* volatile*)&(pCurrent->next), node, pNull))
+        int32_t capacity = cwTargetLength < 32 ? 32 : cwTargetLength;
+        UChar* pattern = (UChar*)malloc((size_t)capacity * sizeof(UChar));
+        if (pattern == NULL)
         {
-            break;
+            return false;
         }
 
-        assert(pCurrent->next != NULL && "next pointer shouldn't be null.");
-
-        pCurrent = pCurrent->next;
+        // usearch keeps pointing at the old copy until it's given the new one, so free it only after that.
+        memcpy(pattern, lpTarget, (size_t)cwTargetLength * sizeof(UChar));
+        if (pEntry->searchIterator != NULL)
+        {
+            usearch_setPattern(pEntry->searchIterator, pattern, cwTargetLength, pErr);
+        }
 
-    } while (true);
+        free(pEntry->pattern);
+        pEntry->pattern = pattern;
+        pEntry->patternCapacity = capacity;
+    }
+    else
+    {
+        memcpy(pEntry->pattern, lpTarget, (size_t)cwTargetLength * sizeof(UChar));
+        if (pEntry->searchIterator != NULL)
+        {
+            usearch_setPattern(pEntry->searchIterator, pEntry->pattern, cwTargetLength, pErr);
+        }
+    }
 
-    return true;
+    pEntry->patternLength = cwTargetLength;
+    return U_SUCCESS(*pErr);
 }
 
-// Restore previously borrowed search handle to the linked list.
-static inline int32_t RestoreSearchHandle(SortHandle* pSortHandle, UStringSearch* pSearchIterator, int32_t options)
+// Returns a borrowed search iterator to the pool, or closes it if the pool is full.
+static void RestoreSearchHandle(SortHandle* pSortHandle, SearchIteratorEntry* pEntry)
 {
-    SearchIteratorNode* pCurrent = &pSortHandle->searchIteratorList[options];
+    SearchIteratorEntry* volatile* pSlots = pSortHandle->searchIterators[pEntry->options];
+    uint32_t hint = GetSearchIteratorSlotHint();
 
-    while (pCurrent != NULL)
+    for (uint32_t i = 0; i < SearchIteratorSlotCount; i++)
     {
-        if (pCurrent->searchIterator == USED_STRING_SEARCH && pal_atomic_cas_ptr((void* volatile*)&(pCurrent->searchIterator), pSearchIterator, USED_STRING_SEARCH))
+        uint32_t slot = (hint + i) % SearchIteratorSlotCount;
+        SearchIteratorEntry* pNull = NULL;
+        if (pSlots[slot] == NULL && pal_atomic_cas_ptr((void* volatile*)&pSlots[slot], pEntry, pNull))
         {
-            return true;
+            return;
         }
-        pCurrent = pCurrent->next;
     }
 
-    return false;
+    FreeSearchIteratorEntry(pEntry);
 }
 
-// return -1 if couldn't borrow search handle from the SortHandle cache, otherwise, it return the slot number of the cache.
-static int32_t GetSearchIteratorUsingCollator(
+// Borrows a search iterator from the pool, or creates a new one, set up to search lpSource for lpTarget.
+// Returns NULL on failure; otherwise the iterator must be handed back with RestoreSearchHandle.
+static SearchIteratorEntry* GetSearchIteratorUsingCollator(
                         SortHandle* pSortHandle,
                         const UCollator* pColl,
                         const UChar* lpTarget,
                         int32_t cwTargetLength,
                         const UChar* lpSource,
                         int32_t cwSourceLength,
-                        int32_t options,
-                        UStringSearch** pSearchIterator)
+                        int32_t options)
 {
     options &= CompareOptionsMask;
-    *pSearchIterator = pSortHandle->searchIteratorList[options].searchIterator;
+    SearchIteratorEntry* volatile* pSlots = pSortHandle->searchIterators[options];
+    uint32_t hint = GetSearchIteratorSlotHint();
     UErrorCode err = U_ZERO_ERROR;
 
-    if (*pSearchIterator == NULL)
+    for (uint32_t i = 0; i < SearchIteratorSlotCount; i++)
     {
-        UBreakIterator* breakIterator = CreateCustomizedBreakIterator();
-        *pSearchIterator = usearch_openFromCollator(lpTarget, cwTargetLength, lpSource, cwSourceLength, pColl, breakIterator, &err);
-        if (!U_SUCCESS(err))
+        uint32_t slot = (hint + i) % SearchIteratorSlotCount;
+        SearchIteratorEntry* pEntry = pSlots[slot];
+        if (pEntry == NULL || !pal_atomic_cas_ptr((void* volatile*)&pSlots[slot], NULL, pEntry))
         {
-            if (breakIterator != NULL)
-            {
-                ubrk_close(breakIterator);
-            }
-            assert(false && "Couldn't open the search iterator.");
-            return -1;
+            continue;
         }
 
-        UStringSearch* pNull = NULL;
-        if (!pal_atomic_cas_ptr((void* volatile*)&(pSortHandle->searchIteratorList[options].searchIterator), USED_STRING_SEARCH, pNull))
+        usearch_setText(pEntry->searchIterator, lpSource, cwSourceLength, &err);
+        if (U_SUCCESS(err) &&
+            (pEntry->patternLength != cwTargetLength ||
+             memcmp(pEntry->pattern, lpTarget, (size_t)cwTargetLength * sizeof(UChar)) != 0))
         {
-            if (!CreateNewSearchNode(pSortHandle, options))
-            {
-                CloseSearchIterator(*pSearchIterator);
-                return -1;
-            }
+            SetSearchIteratorPattern(pEntry, lpTarget, cwTargetLength, &err);
         }
 
-        return options;
-    }
-
-    assert(*pSearchIterator != NULL && "Should having a valid search handle at this stage.");
-
-    SearchIteratorNode* pCurrent = &pSortHandle->searchIteratorList[options];
-
-    while (*pSearchIterator == USED_STRING_SEARCH || !pal_atomic_cas_ptr((void* volatile*)&(pCurrent->searchIterator), USED_STRING_SEARCH, *pSearchIterator))
-    {
-        pCurrent = pCurrent->next;
-        if (pCurrent == NULL)
+        if (!U_SUCCESS(err))
         {
-            *pSearchIterator = NULL;
-            break;
+            RestoreSearchHandle(pSortHandle, pEntry);
+            return NULL;
         }
 
-        *pSearchIterator = pCurrent->searchIterator;
+        return pEntry;
     }
 
-    if (*pSearchIterator == NULL) // Couldn't find any available handle to borrow then create a new one.
+    // Nothing idle to borrow, create a new one.
+    SearchIteratorEntry* pEntry = (SearchIteratorEntry*)calloc(1, sizeof(SearchIteratorEntry));
+    if (pEntry == NULL)
     {
-        UBreakIterator* breakIterator = CreateCustomizedBreakIterator();
-        *pSearchIterator = usearch_openFromCollator(lpTarget, cwTargetLength, lpSource, cwSourceLength, pColl, breakIterator, &err);
-        if (!U_SUCCESS(err))
-        {
-            if (breakIterator != NULL)
-            {
-                ubrk_close(breakIterator);
-            }
-
-            assert(false && "Couldn't open a new search iterator.");
-            return -1;
-        }
-
-        if (!CreateNewSearchNode(pSortHandle, options))
-        {
-            CloseSearchIterator(*pSearchIterator);
-            return -1;
-        }
-
-        return options;
+        return NULL;
     }
 
-    usearch_setText(*pSearchIterator, lpSource, cwSourceLength, &err);
-    if (!U_SUCCESS(err))
+    pEntry->options = options;
+    if (!SetSearchIteratorPattern(pEntry, lpTarget, cwTargetLength, &err))
     {
-        int32_t r;
-        (void)r;
-        r = RestoreSearchHandle(pSortHandle, *pSearchIterator, options);
-        assert(r && "restoring search handle shouldn't fail.");
-        return -1;
+        free(pEntry->pattern);
+        free(pEntry);
+        return NULL;
     }
 
-    usearch_setPattern(*pSearchIterator, lpTarget, cwTargetLength, &err);
+    UBreakIterator* breakIterator = CreateCustomizedBreakIterator();
+    pEntry->searchIterator = usearch_openFromCollator(pEntry->pattern, cwTargetLength, lpSource, cwSourceLength, pColl, breakIterator, &err);
     if (!U_SUCCESS(err))
     {
-        int32_t r;
-        (void)r;
-        r = RestoreSearchHandle(pSortHandle, *pSearchIterator, options);
-        assert(r && "restoring search handle shouldn't fail.");
-        return -1;
+        if (breakIterator != NULL)
+        {
+            ubrk_close(breakIterator);
+        }
+
+        assert(false && "Couldn't open a new search iterator.");
+        free(pEntry->pattern);
+        free(pEntry);
+        return NULL;
     }
 
-    return options;
+    return pEntry;
 }
 
-// return -1 if couldn't borrow search handle from the SortHandle cache, otherwise, it return the slot number of the cache.
-static inline int32_t GetSearchIterator(
+// Returns NULL if no search iterator could be borrowed or created.
+static inline SearchIteratorEntry* GetSearchIterator(
                         SortHandle* pSortHandle,
                         const UChar* lpTarget,
                         int32_t cwTargetLength,
                         const UChar* lpSource,
                         int32_t cwSourceLength,
-                        int32_t options,
-                        UStringSearch** pSearchIterator)
+                        int32_t options)
 {
     UErrorCode err = U_ZERO_ERROR;
     const UCollator* pColl = GetCollatorFromSortHandle(pSortHandle, options, &err);
     if (!U_SUCCESS(err))
     {
         assert(false && "Couldn't get the collator.");
-        return -1;
+        return NULL;
     }
 
     return GetSearchIteratorUsingCollator(
@@ -876,8 +906,7 @@ static inline int32_t GetSearchIterator(
                         cwTargetLength,
                         lpSource,
                         cwSourceLength,
-                        options,
-                        pSearchIterator);
+                        options);
 }
 
 int32_t GlobalizationNative_GetSortVersion(SortHandle* pSortHandle)
@@ -897,6 +926,145 @@ int32_t GlobalizationNative_GetSortVersion(SortHandle* pSortHandle)
     return result;
 }
 
+static uint32_t HashString(const UChar* lpStr, int32_t cwStrLength, int32_t options)
+{
+    // FNV-1a
+    uint32_t hash = 2166136261u ^ (uint32_t)options;
+    for (int32_t i = 0; i < cwStrLength; i++)
+    {
+        hash = (hash ^ lpStr[i]) * 16777619u;
+    }
+
+    return hash;
+}
+
+static SortKeyCacheEntry* CreateSortKeyCacheEntry(const UCollator* pColl, const UChar* lpStr, int32_t cwStrLength, int32_t options, uint32_t hash)
+{
+    uint8_t stackKey[256];
+    int32_t sortKeyLength = ucol_getSortKey(pColl, lpStr, cwStrLength, stackKey, (int32_t)sizeof(stackKey));
+    if (sortKeyLength <= 0)
+    {
+        return NULL;
+    }
+
+    SortKeyCacheEntry* pEntry = (SortKeyCacheEntry*)malloc(sizeof(SortKeyCacheEntry) + (size_t)cwStrLength * sizeof(UChar) + (size_t)sortKeyLength);
+    if (pEntry == NULL)
+    {
+        return NULL;
+    }
+
+    pEntry->hash = hash;
+    pEntry->options = options;
+    pEntry->stringLength = cwStrLength;
+    pEntry->sortKeyLength = sortKeyLength;
+    memcpy((UChar*)SortKeyCacheEntryString(pEntry), lpStr, (size_t)cwStrLength * sizeof(UChar));
+
+    if (sortKeyLength <= (int32_t)sizeof(stackKey))
+    {
+        memcpy(SortKeyCacheEntrySortKey(pEntry), stackKey, (size_t)sortKeyLength);
+    }
+    else
+    {
+        ucol_getSortKey(pColl, lpStr, cwStrLength, SortKeyCacheEntrySortKey(pEntry), sortKeyLength);
+    }
+
+    return pEntry;
+}
+
+// Takes the cached entry for the string out of its slot, or computes a new one. The caller owns the result.
+static SortKeyCacheEntry* AcquireSortKey(SortKeyCache* pCache, const UCollator* pColl, const UChar* lpStr, int32_t cwStrLength, int32_t options)
+{
+    uint32_t hash = HashString(lpStr, cwStrLength, options);
+    SortKeyCacheEntry* volatile* pSlot = &pCache->slots[hash & pCache->slotMask];
+
+    SortKeyCacheEntry* pEntry = *pSlot;
+    if (pEntry != NULL && pal_atomic_cas_ptr((void* volatile*)pSlot, NULL, pEntry))
+    {
+        if (pEntry->hash == hash &&
+            pEntry->options == options &&
+            pEntry->stringLength == cwStrLength &&
+            memcmp(SortKeyCacheEntryString(pEntry), lpStr, (size_t)cwStrLength * sizeof(UChar)) == 0)
+        {
+            return pEntry;
+        }
+
+        // Not ours; put it back unless the slot has been refilled meanwhile.
+        if (!pal_atomic_cas_ptr((void* volatile*)pSlot, pEntry, NULL))
+        {
+            free(pEntry);
+        }
+    }
+
+    return CreateSortKeyCacheEntry(pColl, lpStr, cwStrLength, options, hash);
+}
+
+// Stores the entry in its slot, freeing whatever it displaces.
+static void ReleaseSortKey(SortKeyCache* pCache, SortKeyCacheEntry* pEntry)
+{
+    SortKeyCacheEntry* volatile* pSlot = &pCache->slots[pEntry->hash & pCache->slotMask];
+
+    while (true)
+    {
+        SortKeyCacheEntry* pDisplaced = *pSlot;
+        if (pal_atomic_cas_ptr((void* volatile*)pSlot, pEntry, pDisplaced))
+        {
+            free(pDisplaced);
+            return;
+        }
+    }
+}
+
+static int32_t CompareSortKeys(const SortKeyCacheEntry* pEntry1, const SortKeyCacheEntry* pEntry2)
+{
+    int32_t length = pEntry1->sortKeyLength < pEntry2->sortKeyLength ? pEntry1->sortKeyLength : pEntry2->sortKeyLength;
+    int result = memcmp(SortKeyCacheEntrySortKey(pEntry1), SortKeyCacheEntrySortKey(pEntry2), (size_t)length);
+    if (result == 0)
+    {
+        result = pEntry1->sortKeyLength - pEntry2->sortKeyLength;
+    }
+
+    return result < 0 ? UCOL_LESS : result > 0 ? UCOL_GREATER : UCOL_EQUAL;
+}
+
+/*
+Function:
+EnableSortKeyCache
+*/
+int32_t GlobalizationNative_EnableSortKeyCache(SortHandle* pSortHandle, int32_t capacity, int32_t maxStringLength)
+{
+    assert(pSortHandle != NULL);
+
+    if (capacity <= 0 || maxStringLength <= 0)
+    {
+        return false;
+    }
+
+    uint32_t slotCount = 1;
+    while (slotCount < (uint32_t)capacity && slotCount < (1u << 20))
+    {
+        slotCount <<= 1;
+    }
+
+    SortKeyCache* pCache = (SortKeyCache*)calloc(1, sizeof(SortKeyCache) + slotCount * sizeof(SortKeyCacheEntry*));
+    if (pCache == NULL)
+    {
+        return false;
+    }
+
+    pCache->slotMask = slotCount - 1;
+    pCache->maxStringLength = maxStringLength;
+
+    SortKeyCache* pNull = NULL;
+    if (!pal_atomic_cas_ptr((void* volatile*)&pSortHandle->sortKeyCache, pCache, pNull))
+    {
+        // already enabled
+        free(pCache);
+        return false;
+    }
+
+    return true;
+}
+
 /*
 Function:
 CompareString
@@ -924,6 +1092,33 @@ int32_t GlobalizationNative_CompareString(
             lpStr2 = &dummyChar;
         }
 
+        SortKeyCache* pCache = pSortHandle->sortKeyCache;
+        if (pCache != NULL &&
+            cwStr1Length >= 0 && cwStr1Length <= pCache->maxStringLength &&
+            cwStr2Length >= 0 && cwStr2Length <= pCache->maxStringLength)
+        {
+            options &= CompareOptionsMask;
+            SortKeyCacheEntry* pEntry1 = AcquireSortKey(pCache, pColl, lpStr1, cwStr1Length, options);
+            SortKeyCacheEntry* pEntry2 = AcquireSortKey(pCache, pColl, lpStr2, cwStr2Length, options);
+
+            if (pEntry1 != NULL && pEntry2 != NULL)
+            {
+                result = CompareSortKeys(pEntry1, pEntry2);
+                ReleaseSortKey(pCache, pEntry1);
+                ReleaseSortKey(pCache, pEntry2);
+                return result;
+            }
+
+            if (pEntry1 != NULL)
+            {
+                ReleaseSortKey(pCache, pEntry1);
+            }
+            if (pEntry2 != NULL)
+            {
+                ReleaseSortKey(pCache, pEntry2);
+            }
+        }
+
         result = ucol_strcoll(pColl, lpStr1, cwStr1Length, lpStr2, cwStr2Length);
     }
 
@@ -967,13 +1162,14 @@ int32_t GlobalizationNative_IndexOf(
 
     UErrorCode err = U_ZERO_ERROR;
 
-    UStringSearch* pSearch;
-    int32_t searchCacheSlot = GetSearchIterator(pSortHandle, lpTarget, cwTargetLength, lpSource, cwSourceLength, options, &pSearch);
-    if (searchCacheSlot < 0)
+    SearchIteratorEntry* pEntry = GetSearchIterator(pSortHandle, lpTarget, cwTargetLength, lpSource, cwSourceLength, options);
+    if (pEntry == NULL)
     {
         return result;
     }
 
+    UStringSearch* pSearch = pEntry->searchIterator;
+
     result = usearch_first(pSearch, &err);
 
     // if the search was successful,
@@ -983,7 +1179,7 @@ int32_t GlobalizationNative_IndexOf(
         *pMatchedLength = usearch_getMatchedLength(pSearch);
     }
 
-    RestoreSearchHandle(pSortHandle, pSearch, searchCacheSlot);
+    RestoreSearchHandle(pSortHandle, pEntry);
 
     return result;
 }
@@ -1024,14 +1220,14 @@ int32_t GlobalizationNative_LastIndexOf(
     }
 
     UErrorCode err = U_ZERO_ERROR;
-    UStringSearch* pSearch;
-
-    int32_t searchCacheSlot = GetSearchIterator(pSortHandle, lpTarget, cwTargetLength, lpSource, cwSourceLength, options, &pSearch);
-    if (searchCacheSlot < 0)
+    SearchIteratorEntry* pEntry = GetSearchIterator(pSortHandle, lpTarget, cwTargetLength, lpSource, cwSourceLength, options);
+    if (pEntry == NULL)
     {
         return result;
     }
 
+    UStringSearch* pSearch = pEntry->searchIterator;
+
     result = usearch_last(pSearch, &err);
 
     // if the search was successful, we'll try to get the matched string length.
@@ -1065,7 +1261,7 @@ int32_t GlobalizationNative_LastIndexOf(
         }
     }
 
-    RestoreSearchHandle(pSortHandle, pSearch, searchCacheSlot);
+    RestoreSearchHandle(pSortHandle, pEntry);
 
     return result;
 }
@@ -1209,13 +1405,14 @@ static int32_t ComplexStartsWith(SortHandle* pSortHandle, const UChar* pPattern,
         return result;
     }
 
-    UStringSearch* pSearch;
-    int32_t searchCacheSlot = GetSearchIteratorUsingCollator(pSortHandle, pCollator, pPattern, patternLength, pText, textLength, options, &pSearch);
-    if (searchCacheSlot < 0)
+    SearchIteratorEntry* pEntry = GetSearchIteratorUsingCollator(pSortHandle, pCollator, pPattern, patternLength, pText, textLength, options);
+    if (pEntry == NULL)
     {
         return result;
     }
 
+    UStringSearch* pSearch = pEntry->searchIterator;
+
     int32_t idx = usearch_first(pSearch, &err);
     if (idx != USEARCH_DONE)
     {
@@ -1235,7 +1432,7 @@ static int32_t ComplexStartsWith(SortHandle* pSortHandle, const UChar* pPattern,
         }
     }
 
-    RestoreSearchHandle(pSortHandle, pSearch, searchCacheSlot);
+    RestoreSearchHandle(pSortHandle, pEntry);
 
     return result;
 }
@@ -1278,13 +1475,14 @@ static int32_t ComplexEndsWith(SortHandle* pSortHandle, const UChar* pPattern, i
         return result;
     }
 
-    UStringSearch* pSearch;
-    int32_t searchCacheSlot = GetSearchIteratorUsingCollator(pSortHandle, pCollator, pPattern, patternLength, pText, textLength, options, &pSearch);
-    if (searchCacheSlot < 0)
+    SearchIteratorEntry* pEntry = GetSearchIteratorUsingCollator(pSortHandle, pCollator, pPattern, patternLength, pText, textLength, options);
+    if (pEntry == NULL)
     {
         return result;
     }
 
+    UStringSearch* pSearch = pEntry->searchIterator;
+
     int32_t idx = usearch_last(pSearch, &err);
     if (idx != USEARCH_DONE)
     {
@@ -1309,7 +1507,7 @@ static int32_t ComplexEndsWith(SortHandle* pSortHandle, const UChar* pPattern, i
         }
     }
 
-    RestoreSearchHandle(pSortHandle, pSearch, searchCacheSlot);
+    RestoreSearchHandle(pSortHandle, pEntry);
 
     return result;
 }
@@ -1360,3 +1558,44 @@ int32_t GlobalizationNative_GetSortKey(
 
     return result;
 }
+
+int32_t GlobalizationNative_GetSortKeys(
+                        SortHandle* pSortHandle,
+                        const UChar** lpStrs,
+                        const int32_t* cwStrLengths,
+                        int32_t count,
+                        uint8_t* sortKeys,
+                        int32_t cbSortKeysLength,
+                        int32_t* sortKeyOffsets,
+                        int32_t* sortKeyLengths,
+                        int32_t options)
+{
+    assert(lpStrs != NULL && cwStrLengths != NULL && sortKeyOffsets != NULL && sortKeyLengths != NULL);
+
+    UErrorCode err = U_ZERO_ERROR;
+    const UCollator* pColl = GetCollatorFromSortHandle(pSortHandle, options, &err);
+    if (!U_SUCCESS(err))
+    {
+        return 0;
+    }
+
+    int32_t offset = 0;
+    for (int32_t i = 0; i < count; i++)
+    {
+        int32_t remaining = cbSortKeysLength - offset;
+        int32_t length = ucol_getSortKey(pColl, lpStrs[i], cwStrLengths[i], remaining > 0 ? sortKeys + offset : NULL, remaining > 0 ? remaining : 0);
+
+        sortKeyOffsets[i] = offset;
+        sortKeyLengths[i] = length;
+
+        if (length == 0 || length > remaining)
+        {
+            // doesn't fit (or failed); sortKeyLengths[i] tells the caller how much room the next call needs
+            return i;
+        }
+
+        offset += length;
+    }
+
+    return count;
+}
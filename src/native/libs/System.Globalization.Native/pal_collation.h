@@ -20,6 +20,11 @@ PALEXPORT void GlobalizationNative_CloseSortHandle(SortHandle* pSortHandle);
 // If we fail to get the sort version we will fallback to -1 as the sort version.
 PALEXPORT int32_t GlobalizationNative_GetSortVersion(SortHandle* pSortHandle);
 
+// Makes CompareString on this handle compare cached sort keys for strings up to maxStringLength
+// characters, remembering about capacity of them. Returns 0 if the cache couldn't be created
+// or is already enabled.
+PALEXPORT int32_t GlobalizationNative_EnableSortKeyCache(SortHandle* pSortHandle, int32_t capacity, int32_t maxStringLength);
+
 PALEXPORT int32_t GlobalizationNative_CompareString(SortHandle* pSortHandle,
                                                     const UChar* lpStr1,
                                                     int32_t cwStr1Length,
@@ -65,6 +70,19 @@ PALEXPORT int32_t GlobalizationNative_GetSortKey(SortHandle* pSortHandle,
                                                  uint8_t* sortKey,
                                                  int32_t cbSortKeyLength,
                                                  int32_t options);
+
+// Writes the sort keys of count strings back to back into sortKeys, recording where each one starts
+// and how long it is. Returns the number of keys written; when that's less than count,
+// sortKeyLengths[result] is the space the next key needs (or 0 if it couldn't be computed).
+PALEXPORT int32_t GlobalizationNative_GetSortKeys(SortHandle* pSortHandle,
+                                                  const UChar** lpStrs,
+                                                  const int32_t* cwStrLengths,
+                                                  int32_t count,
+                                                  uint8_t* sortKeys,
+                                                  int32_t cbSortKeysLength,
+                                                  int32_t* sortKeyOffsets,
+                                                  int32_t* sortKeyLengths,
+                                                  int32_t options);
 #if defined(APPLE_HYBRID_GLOBALIZATION)
 PALEXPORT int32_t GlobalizationNative_CompareStringNative(const uint16_t* localeName,
                                                           int32_t lNameLength,
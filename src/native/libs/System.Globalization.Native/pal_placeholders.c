@@ -105,6 +105,12 @@ int32_t GlobalizationNative_GetSortVersion(SortHandle* pSortHandle)
     return 0;
 }
 
+int32_t GlobalizationNative_EnableSortKeyCache(SortHandle* pSortHandle, int32_t capacity, int32_t maxStringLength)
+{
+    assert_msg(false, "Not supported on this platform", 0);
+    return 0;
+}
+
 int32_t GlobalizationNative_CompareString(
     SortHandle* pSortHandle, const UChar* lpStr1, int32_t cwStr1Length, const UChar* lpStr2, int32_t cwStr2Length, int32_t options)
 {
@@ -147,6 +153,13 @@ int32_t GlobalizationNative_GetSortKey(
     return 0;
 }
 
+int32_t GlobalizationNative_GetSortKeys(
+    SortHandle* pSortHandle, const UChar** lpStrs, const int32_t* cwStrLengths, int32_t count, uint8_t* sortKeys, int32_t cbSortKeysLength, int32_t* sortKeyOffsets, int32_t* sortKeyLengths, int32_t options)
+{
+    assert_msg(false, "Not supported on this platform", 0);
+    return 0;
+}
+
 // Placeholder for locale data
 int32_t GlobalizationNative_GetLocales(
     UChar *value, int32_t valueLength)
@@ -4,7 +4,10 @@
 #include <minipal/entrypoints.h>
 
 // Include System.IO.Compression.Native headers
+#include "pal_deflate_parallel.h"
+#include "pal_lz4.h"
 #include "pal_zlib.h"
+#include "pal_zstd.h"
 #include <brotli/decode.h>
 #include <brotli/encode.h>
 #include <brotli/port.h>
@@ -30,6 +33,22 @@ static const Entry s_compressionNative[] =
     DllImportEntry(CompressionNative_Inflate)
     DllImportEntry(CompressionNative_InflateEnd)
     DllImportEntry(CompressionNative_InflateInit2_)
+    DllImportEntry(CompressionNative_Lz4Compress)
+    DllImportEntry(CompressionNative_Lz4CompressEnd)
+    DllImportEntry(CompressionNative_Lz4CompressInit)
+    DllImportEntry(CompressionNative_Lz4Decompress)
+    DllImportEntry(CompressionNative_Lz4DecompressEnd)
+    DllImportEntry(CompressionNative_Lz4DecompressInit)
+    DllImportEntry(CompressionNative_ParallelDeflate)
+    DllImportEntry(CompressionNative_ParallelDeflateEnd)
+    DllImportEntry(CompressionNative_ParallelDeflateGetCrc32)
+    DllImportEntry(CompressionNative_ParallelDeflateInit)
+    DllImportEntry(CompressionNative_ZstdCompress)
+    DllImportEntry(CompressionNative_ZstdCompressEnd)
+    DllImportEntry(CompressionNative_ZstdCompressInit)
+    DllImportEntry(CompressionNative_ZstdDecompress)
+    DllImportEntry(CompressionNative_ZstdDecompressEnd)
+    DllImportEntry(CompressionNative_ZstdDecompressInit)
 };
 
 EXTERN_C const void* CompressionResolveDllImport(const char* name);
@@ -1,7 +1,10 @@
 
 macro(append_extra_compression_libs NativeLibsExtra)
   # TODO: remove the mono-style HOST_ variable checks once Mono is using eng/native/configureplatform.cmake to define the CLR_CMAKE_TARGET_ defines
-  if (CLR_CMAKE_TARGET_BROWSER OR HOST_BROWSER OR CLR_CMAKE_TARGET_WASI OR HOST_WASI)
+  if (TARGET zlib)
+      # the in-tree zlib-ng, see external/zlib-ng.cmake
+      set(ZLIB_LIBRARIES zlib)
+  elseif (CLR_CMAKE_TARGET_BROWSER OR HOST_BROWSER OR CLR_CMAKE_TARGET_WASI OR HOST_WASI)
       # nothing special to link
   elseif (CLR_CMAKE_TARGET_ANDROID OR HOST_ANDROID)
       # need special case here since we want to link against libz.so but find_package() would resolve libz.a
@@ -20,4 +23,19 @@ macro(append_extra_compression_libs NativeLibsExtra)
 
     list(APPEND ${NativeLibsExtra} ${BROTLIDEC} ${BROTLIENC})
   endif ()
+
+  # zstd and LZ4 are optional, pal_zstd.c and pal_lz4.c are stubs returning PAL_Z_VERSIONERROR without them
+  if (NOT CLR_CMAKE_TARGET_BROWSER AND NOT HOST_BROWSER AND NOT CLR_CMAKE_TARGET_WASI AND NOT HOST_WASI AND NOT CLR_CMAKE_TARGET_ANDROID AND NOT HOST_ANDROID)
+    find_library(ZSTD_LIBRARY zstd)
+    find_path(ZSTD_INCLUDE_DIR zstd.h)
+    if (ZSTD_LIBRARY AND ZSTD_INCLUDE_DIR)
+      list(APPEND ${NativeLibsExtra} ${ZSTD_LIBRARY})
+    endif ()
+
+    find_library(LZ4_LIBRARY lz4)
+    find_path(LZ4_INCLUDE_DIR lz4frame.h)
+    if (LZ4_LIBRARY AND LZ4_INCLUDE_DIR)
+      list(APPEND ${NativeLibsExtra} ${LZ4_LIBRARY})
+    endif ()
+  endif ()
 endmacro()
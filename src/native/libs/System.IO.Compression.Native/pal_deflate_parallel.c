@@ -0,0 +1,552 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pal_deflate_parallel.h"
+
+#ifdef INTERNAL_ZLIB
+    #ifdef INTERNAL_ZLIB_INTEL
+        #include <external/zlib-intel/zlib.h>
+    #else
+        #include <external/zlib/zlib.h>
+    #endif
+#else
+    #include <zlib.h>
+#endif
+
+#if !defined(_WIN32) && !defined(TARGET_WASI)
+    #include <pthread.h>
+    #include <unistd.h>
+    #define PARALLEL_DEFLATE_PTHREADS
+#endif
+
+#define DEFAULT_BLOCK_SIZE (128 * 1024)
+#define MIN_BLOCK_SIZE (32 * 1024)
+#define MAX_BLOCK_SIZE (4 * 1024 * 1024)
+#define MAX_WORKERS 64
+#define DICTIONARY_SIZE (32 * 1024)
+
+#ifdef _WIN32
+    #define GZIP_OS_CODE 10
+#else
+    #define GZIP_OS_CODE 3
+#endif
+
+enum
+{
+    WRAP_RAW = 0,
+    WRAP_ZLIB = 1,
+    WRAP_GZIP = 2,
+};
+
+/*
+One block slot; its z_stream is kept across batches and reset for every block.
+*/
+typedef struct DeflateWorker
+{
+    z_stream zStream;
+    const uint8_t* input;
+    uint32_t inputLength;
+    const uint8_t* dictionary;
+    uint32_t dictionaryLength;
+    uint8_t* output;
+    uint32_t outputCapacity;
+    uint32_t outputLength;
+    uint32_t crc;
+    uint32_t adler;
+    int32_t last;
+    int32_t computeAdler;
+    int32_t result;
+} DeflateWorker;
+
+typedef struct ParallelDeflateState
+{
+    DeflateWorker* workers;
+    int32_t workerCount;
+    uint32_t blockSize;
+    int32_t wrap;
+    int32_t level;
+    int32_t strategy;
+    int32_t windowBits;
+
+    uint8_t* input; // workerCount * blockSize bytes
+    uint32_t inputLength;
+
+    uint8_t history[DICTIONARY_SIZE];
+    uint32_t historyLength;
+
+    uint8_t header[10];
+    uint8_t trailer[8];
+
+    // Compressed output of the last batch, handed out in order.
+    const uint8_t* segments[MAX_WORKERS + 2];
+    uint32_t segmentLengths[MAX_WORKERS + 2];
+    int32_t segmentCount;
+    int32_t segmentIndex;
+    uint32_t segmentOffset;
+
+    uint32_t crc;
+    uint32_t adler;
+    uint64_t totalIn;
+    int32_t headerWritten;
+    int32_t finished;
+} ParallelDeflateState;
+
+static int32_t GetProcessorCount(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return (int32_t)info.dwNumberOfProcessors;
+#elif defined(PARALLEL_DEFLATE_PTHREADS)
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int32_t)count : 1;
+#else
+    return 1;
+#endif
+}
+
+static void CompressBlock(DeflateWorker* worker)
+{
+    z_stream* zStream = &worker->zStream;
+
+    int32_t result = deflateReset(zStream);
+    if (result == Z_OK && worker->dictionaryLength > 0)
+    {
+        result = deflateSetDictionary(zStream, worker->dictionary, worker->dictionaryLength);
+    }
+
+    if (result == Z_OK)
+    {
+        zStream->next_in = (Bytef*)worker->input;
+        zStream->avail_in = worker->inputLength;
+        zStream->next_out = worker->output;
+        zStream->avail_out = worker->outputCapacity;
+
+        // The output buffer is sized with deflateBound, so a single call always completes the block;
+        // Z_SYNC_FLUSH ends it on a byte boundary with an empty stored block so the next one can follow.
+        result = deflate(zStream, worker->last ? Z_FINISH : Z_SYNC_FLUSH);
+        if (result == Z_STREAM_END || (result == Z_OK && !worker->last && zStream->avail_in == 0 && zStream->avail_out > 0))
+        {
+            result = Z_OK;
+        }
+        else if (result == Z_OK)
+        {
+            result = Z_BUF_ERROR;
+        }
+
+        worker->outputLength = worker->outputCapacity - zStream->avail_out;
+    }
+
+    worker->crc = (uint32_t)crc32(0, worker->input, worker->inputLength);
+    if (worker->computeAdler)
+    {
+        worker->adler = (uint32_t)adler32(1, worker->input, worker->inputLength);
+    }
+
+    worker->result = result;
+}
+
+#ifdef _WIN32
+static DWORD WINAPI WorkerThread(LPVOID context)
+{
+    CompressBlock((DeflateWorker*)context);
+    return 0;
+}
+#elif defined(PARALLEL_DEFLATE_PTHREADS)
+static void* WorkerThread(void* context)
+{
+    CompressBlock((DeflateWorker*)context);
+    return NULL;
+}
+#endif
+
+/*
+Compresses everything in the input buffer as one batch and queues the output segments.
+*/
+static int32_t RunBatch(ParallelDeflateState* state, int32_t last)
+{
+    int32_t blockCount = state->inputLength == 0 ? 1 : (int32_t)((state->inputLength + state->blockSize - 1) / state->blockSize);
+    assert(blockCount <= state->workerCount);
+
+    for (int32_t i = 0; i < blockCount; i++)
+    {
+        DeflateWorker* worker = &state->workers[i];
+        uint32_t offset = (uint32_t)i * state->blockSize;
+        uint32_t remaining = state->inputLength - offset;
+
+        worker->input = state->input + offset;
+        worker->inputLength = remaining < state->blockSize ? remaining : state->blockSize;
+        worker->last = last && i == blockCount - 1;
+        worker->computeAdler = state->wrap == WRAP_ZLIB;
+
+        if (i == 0)
+        {
+            worker->dictionary = state->history;
+            worker->dictionaryLength = state->historyLength;
+        }
+        else
+        {
+            // the previous block is a full block, which is at least as large as the dictionary
+            worker->dictionary = worker->input - DICTIONARY_SIZE;
+            worker->dictionaryLength = DICTIONARY_SIZE;
+        }
+    }
+
+#ifdef _WIN32
+    HANDLE threads[MAX_WORKERS];
+#elif defined(PARALLEL_DEFLATE_PTHREADS)
+    pthread_t threads[MAX_WORKERS];
+#endif
+    int32_t started[MAX_WORKERS];
+
+    for (int32_t i = 1; i < blockCount; i++)
+    {
+        started[i] = 0;
+#ifdef _WIN32
+        threads[i] = CreateThread(NULL, 0, WorkerThread, &state->workers[i], 0, NULL);
+        started[i] = threads[i] != NULL;
+#elif defined(PARALLEL_DEFLATE_PTHREADS)
+        started[i] = pthread_create(&threads[i], NULL, WorkerThread, &state->workers[i]) == 0;
+#endif
+        if (!started[i])
+        {
+            // Out of threads; the block is still compressed, just on this thread.
+            CompressBlock(&state->workers[i]);
+        }
+    }
+
+    CompressBlock(&state->workers[0]);
+
+    for (int32_t i = 1; i < blockCount; i++)
+    {
+        if (started[i])
+        {
+#ifdef _WIN32
+            WaitForSingleObject(threads[i], INFINITE);
+            CloseHandle(threads[i]);
+#elif defined(PARALLEL_DEFLATE_PTHREADS)
+            pthread_join(threads[i], NULL);
+#endif
+        }
+    }
+
+    state->segmentCount = 0;
+    state->segmentIndex = 0;
+    state->segmentOffset = 0;
+
+    if (!state->headerWritten)
+    {
+        uint32_t headerLength = 0;
+        int32_t level = state->level == Z_DEFAULT_COMPRESSION ? 6 : state->level;
+        int32_t fastest = state->strategy >= Z_HUFFMAN_ONLY || level < 2;
+
+        if (state->wrap == WRAP_ZLIB)
+        {
+            uint32_t levelFlags = fastest ? 0 : level < 6 ? 1 : level == 6 ? 2 : 3;
+            uint32_t header = ((uint32_t)((state->windowBits - 8) << 4 | Z_DEFLATED) << 8) | (levelFlags << 6);
+            header += 31 - (header % 31);
+
+            state->header[0] = (uint8_t)(header >> 8);
+            state->header[1] = (uint8_t)header;
+            headerLength = 2;
+        }
+        else if (state->wrap == WRAP_GZIP)
+        {
+            static const uint8_t gzipHeader[] = { 0x1f, 0x8b, Z_DEFLATED, 0, 0, 0, 0, 0, 0, GZIP_OS_CODE };
+            memcpy(state->header, gzipHeader, sizeof(gzipHeader));
+            state->header[8] = level == 9 ? 2 : fastest ? 4 : 0;
+            headerLength = sizeof(gzipHeader);
+        }
+
+        if (headerLength > 0)
+        {
+            state->segments[state->segmentCount] = state->header;
+            state->segmentLengths[state->segmentCount++] = headerLength;
+        }
+
+        state->headerWritten = 1;
+    }
+
+    for (int32_t i = 0; i < blockCount; i++)
+    {
+        DeflateWorker* worker = &state->workers[i];
+        if (worker->result != Z_OK)
+        {
+            return worker->result;
+        }
+
+        state->crc = (uint32_t)crc32_combine(state->crc, worker->crc, (z_off_t)worker->inputLength);
+        if (state->wrap == WRAP_ZLIB)
+        {
+            state->adler = (uint32_t)adler32_combine(state->adler, worker->adler, (z_off_t)worker->inputLength);
+        }
+
+        state->segments[state->segmentCount] = worker->output;
+        state->segmentLengths[state->segmentCount++] = worker->outputLength;
+    }
+
+    state->totalIn += state->inputLength;
+
+    if (last)
+    {
+        if (state->wrap == WRAP_ZLIB)
+        {
+            for (int32_t i = 0; i < 4; i++)
+            {
+                state->trailer[i] = (uint8_t)(state->adler >> (24 - 8 * i));
+            }
+
+            state->segments[state->segmentCount] = state->trailer;
+            state->segmentLengths[state->segmentCount++] = 4;
+        }
+        else if (state->wrap == WRAP_GZIP)
+        {
+            uint32_t size = (uint32_t)state->totalIn;
+            for (int32_t i = 0; i < 4; i++)
+            {
+                state->trailer[i] = (uint8_t)(state->crc >> (8 * i));
+                state->trailer[4 + i] = (uint8_t)(size >> (8 * i));
+            }
+
+            state->segments[state->segmentCount] = state->trailer;
+            state->segmentLengths[state->segmentCount++] = 8;
+        }
+
+        state->finished = 1;
+    }
+
+    // Keep the end of the data as the dictionary for the next batch.
+    if (state->inputLength >= DICTIONARY_SIZE)
+    {
+        memcpy(state->history, state->input + state->inputLength - DICTIONARY_SIZE, DICTIONARY_SIZE);
+        state->historyLength = DICTIONARY_SIZE;
+    }
+    else if (state->inputLength > 0)
+    {
+        uint32_t keep = state->historyLength + state->inputLength > DICTIONARY_SIZE ? DICTIONARY_SIZE - state->inputLength : state->historyLength;
+        memmove(state->history, state->history + state->historyLength - keep, keep);
+        memcpy(state->history + keep, state->input, state->inputLength);
+        state->historyLength = keep + state->inputLength;
+    }
+
+    state->inputLength = 0;
+    return Z_OK;
+}
+
+static void FreeState(ParallelDeflateState* state)
+{
+    if (state == NULL)
+    {
+        return;
+    }
+
+    if (state->workers != NULL)
+    {
+        for (int32_t i = 0; i < state->workerCount; i++)
+        {
+            DeflateWorker* worker = &state->workers[i];
+            if (worker->output != NULL)
+            {
+                deflateEnd(&worker->zStream);
+                free(worker->output);
+            }
+        }
+
+        free(state->workers);
+    }
+
+    free(state->input);
+    free(state);
+}
+
+int32_t CompressionNative_ParallelDeflateInit(PAL_ZStream* stream,
+                                              int32_t level,
+                                              int32_t windowBits,
+                                              int32_t memLevel,
+                                              int32_t strategy,
+                                              int32_t threadCount,
+                                              int32_t blockSize)
+{
+    assert(stream != NULL);
+
+    stream->msg = NULL;
+    stream->internalState = NULL;
+
+    int32_t wrap;
+    if (windowBits >= -15 && windowBits <= -8)
+    {
+        wrap = WRAP_RAW;
+        windowBits = -windowBits;
+    }
+    else if (windowBits >= 8 && windowBits <= 15)
+    {
+        wrap = WRAP_ZLIB;
+    }
+    else if (windowBits >= 16 + 8 && windowBits <= 16 + 15)
+    {
+        wrap = WRAP_GZIP;
+        windowBits -= 16;
+    }
+    else
+    {
+        return PAL_Z_STREAMERROR;
+    }
+
+    if (windowBits == 8)
+    {
+        windowBits = 9; // as deflateInit2 does
+    }
+
+    if (threadCount <= 0)
+    {
+        threadCount = GetProcessorCount();
+    }
+
+    if (threadCount > MAX_WORKERS)
+    {
+        threadCount = MAX_WORKERS;
+    }
+
+    if (blockSize <= 0)
+    {
+        blockSize = DEFAULT_BLOCK_SIZE;
+    }
+
+    blockSize = blockSize < MIN_BLOCK_SIZE ? MIN_BLOCK_SIZE : blockSize > MAX_BLOCK_SIZE ? MAX_BLOCK_SIZE : blockSize;
+
+    ParallelDeflateState* state = (ParallelDeflateState*)calloc(1, sizeof(ParallelDeflateState));
+    if (state == NULL)
+    {
+        return PAL_Z_MEMERROR;
+    }
+
+    state->workerCount = threadCount;
+    state->blockSize = (uint32_t)blockSize;
+    state->wrap = wrap;
+    state->level = level;
+    state->strategy = strategy;
+    state->windowBits = windowBits;
+    state->adler = 1;
+
+    state->workers = (DeflateWorker*)calloc((size_t)threadCount, sizeof(DeflateWorker));
+    state->input = (uint8_t*)malloc((size_t)threadCount * (size_t)blockSize);
+    if (state->workers == NULL || state->input == NULL)
+    {
+        FreeState(state);
+        return PAL_Z_MEMERROR;
+    }
+
+    for (int32_t i = 0; i < threadCount; i++)
+    {
+        DeflateWorker* worker = &state->workers[i];
+
+        int32_t result = deflateInit2(&worker->zStream, level, Z_DEFLATED, -windowBits, memLevel, strategy);
+        if (result != Z_OK)
+        {
+            FreeState(state);
+            return result;
+        }
+
+        // room for the empty stored block ending every flushed block
+        worker->outputCapacity = (uint32_t)deflateBound(&worker->zStream, (uLong)blockSize) + 16;
+        worker->output = (uint8_t*)malloc(worker->outputCapacity);
+        if (worker->output == NULL)
+        {
+            deflateEnd(&worker->zStream);
+            FreeState(state);
+            return PAL_Z_MEMERROR;
+        }
+    }
+
+    stream->internalState = state;
+    return PAL_Z_OK;
+}
+
+int32_t CompressionNative_ParallelDeflate(PAL_ZStream* stream, int32_t flush)
+{
+    assert(stream != NULL);
+
+    ParallelDeflateState* state = (ParallelDeflateState*)stream->internalState;
+    assert(state != NULL);
+
+    if (flush != PAL_Z_NOFLUSH && flush != PAL_Z_SYNCFLUSH && flush != PAL_Z_FINISH)
+    {
+        return PAL_Z_STREAMERROR;
+    }
+
+    for (;;)
+    {
+        while (state->segmentIndex < state->segmentCount)
+        {
+            if (stream->availOut == 0)
+            {
+                return PAL_Z_OK;
+            }
+
+            uint32_t available = state->segmentLengths[state->segmentIndex] - state->segmentOffset;
+            uint32_t count = available < stream->availOut ? available : stream->availOut;
+            memcpy(stream->nextOut, state->segments[state->segmentIndex] + state->segmentOffset, count);
+
+            stream->nextOut += count;
+            stream->availOut -= count;
+            state->segmentOffset += count;
+
+            if (state->segmentOffset == state->segmentLengths[state->segmentIndex])
+            {
+                state->segmentIndex++;
+                state->segmentOffset = 0;
+            }
+        }
+
+        if (state->finished)
+        {
+            return PAL_Z_STREAMEND;
+        }
+
+        uint32_t capacity = (uint32_t)state->workerCount * state->blockSize;
+        uint32_t space = capacity - state->inputLength;
+        uint32_t count = stream->availIn < space ? stream->availIn : space;
+        memcpy(state->input + state->inputLength, stream->nextIn, count);
+
+        stream->nextIn += count;
+        stream->availIn -= count;
+        state->inputLength += count;
+
+        int32_t last = flush == PAL_Z_FINISH && stream->availIn == 0;
+        if (state->inputLength == capacity || last || (flush == PAL_Z_SYNCFLUSH && stream->availIn == 0 && state->inputLength > 0))
+        {
+            int32_t result = RunBatch(state, last);
+            if (result != Z_OK)
+            {
+                return result;
+            }
+
+            continue;
+        }
+
+        return PAL_Z_OK;
+    }
+}
+
+uint32_t CompressionNative_ParallelDeflateGetCrc32(PAL_ZStream* stream)
+{
+    assert(stream != NULL);
+
+    ParallelDeflateState* state = (ParallelDeflateState*)stream->internalState;
+    assert(state != NULL);
+
+    return state->crc;
+}
+
+int32_t CompressionNative_ParallelDeflateEnd(PAL_ZStream* stream)
+{
+    assert(stream != NULL);
+
+    FreeState((ParallelDeflateState*)stream->internalState);
+    stream->internalState = NULL;
+
+    return PAL_Z_OK;
+}
@@ -0,0 +1,59 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#pragma once
+
+#include "pal_zlib.h"
+
+/*
+Parallel deflate compression over a PAL_ZStream.
+
+Input is split into blocks that are compressed concurrently, one per worker thread. Each block
+is primed with the last 32 KiB of the data before it and ends on a byte boundary, so the
+concatenated blocks form one ordinary deflate stream (raw, zlib or gzip wrapped, picked by
+windowBits as for DeflateInit2_) that any inflater can read. The ratio is within a fraction of a
+percent of serial deflate.
+
+Input is buffered until a whole batch of blocks is available; PAL_Z_SYNCFLUSH compresses whatever
+has been buffered so far.
+*/
+
+/*
+Initializes the PAL_ZStream so the ParallelDeflate function can be invoked on it.
+
+level, windowBits, memLevel and strategy have the same meaning as for DeflateInit2_. threadCount
+is the number of blocks compressed at once, or 0 for one per online processor. blockSize is the
+uncompressed size of each block, or 0 for the 128 KiB default; it's clamped to [32 KiB, 4 MiB].
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ParallelDeflateInit(PAL_ZStream* stream,
+                                                                                        int32_t level,
+                                                                                        int32_t windowBits,
+                                                                                        int32_t memLevel,
+                                                                                        int32_t strategy,
+                                                                                        int32_t threadCount,
+                                                                                        int32_t blockSize);
+
+/*
+Compresses the bytes in the PAL_ZStream's nextIn buffer and puts the compressed bytes in nextOut.
+
+flush is PAL_Z_NOFLUSH, PAL_Z_SYNCFLUSH or PAL_Z_FINISH. Call again with the same flush value
+while the output buffer keeps filling up.
+
+Returns PAL_Z_STREAMEND once a PAL_Z_FINISH call has written the whole stream, PAL_Z_OK while
+more calls are needed, or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ParallelDeflate(PAL_ZStream* stream, int32_t flush);
+
+/*
+Returns the CRC-32 of all the input compressed so far, computed alongside the blocks.
+*/
+FUNCTIONEXPORT uint32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ParallelDeflateGetCrc32(PAL_ZStream* stream);
+
+/*
+All dynamically allocated data structures for this stream are freed.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ParallelDeflateEnd(PAL_ZStream* stream);
@@ -0,0 +1,270 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pal_lz4.h"
+
+#ifdef FEATURE_LZ4
+#include <lz4frame.h>
+
+// Input is fed to LZ4F_compressUpdate in chunks of at most this size, which bounds the staging buffer.
+#define LZ4_INPUT_CHUNK (64 * 1024)
+
+/*
+LZ4F_compressUpdate needs room for the worst case output of its input, which the caller's buffer
+may not have, so compressed bytes are staged here and handed out as output space allows.
+*/
+typedef struct Lz4CompressState
+{
+    LZ4F_cctx* cctx;
+    LZ4F_preferences_t preferences;
+    uint8_t* buffer;
+    size_t bufferCapacity;
+    size_t pendingOffset;
+    size_t pendingLength;
+    int32_t started;
+    int32_t finished;
+} Lz4CompressState;
+
+static void FreeCompressState(Lz4CompressState* state)
+{
+    if (state != NULL)
+    {
+        LZ4F_freeCompressionContext(state->cctx);
+        free(state->buffer);
+        free(state);
+    }
+}
+
+/*
+Copies as much of the staged output as fits into the PAL_ZStream's output buffer.
+*/
+static void DrainPending(Lz4CompressState* state, PAL_ZStream* stream)
+{
+    size_t count = state->pendingLength < stream->availOut ? state->pendingLength : stream->availOut;
+    memcpy(stream->nextOut, state->buffer + state->pendingOffset, count);
+
+    stream->nextOut += count;
+    stream->availOut -= (uint32_t)count;
+    state->pendingOffset += count;
+    state->pendingLength -= count;
+}
+
+int32_t CompressionNative_Lz4CompressInit(PAL_ZStream* stream, int32_t level, int32_t contentChecksum)
+{
+    assert(stream != NULL);
+
+    stream->msg = NULL;
+
+    Lz4CompressState* state = (Lz4CompressState*)calloc(1, sizeof(Lz4CompressState));
+    stream->internalState = state;
+    if (state == NULL)
+    {
+        return PAL_Z_MEMERROR;
+    }
+
+    state->preferences.compressionLevel = level;
+    state->preferences.frameInfo.contentChecksumFlag = contentChecksum ? LZ4F_contentChecksumEnabled : LZ4F_noContentChecksum;
+
+    LZ4F_errorCode_t result = LZ4F_createCompressionContext(&state->cctx, LZ4F_VERSION);
+    if (LZ4F_isError(result))
+    {
+        stream->msg = (char*)LZ4F_getErrorName(result);
+        FreeCompressState(state);
+        stream->internalState = NULL;
+        return PAL_Z_MEMERROR;
+    }
+
+    size_t capacity = LZ4F_compressBound(LZ4_INPUT_CHUNK, &state->preferences);
+    state->bufferCapacity = capacity > LZ4F_HEADER_SIZE_MAX ? capacity : LZ4F_HEADER_SIZE_MAX;
+    state->buffer = (uint8_t*)malloc(state->bufferCapacity);
+    if (state->buffer == NULL)
+    {
+        FreeCompressState(state);
+        stream->internalState = NULL;
+        return PAL_Z_MEMERROR;
+    }
+
+    return PAL_Z_OK;
+}
+
+int32_t CompressionNative_Lz4Compress(PAL_ZStream* stream, int32_t flush)
+{
+    assert(stream != NULL);
+
+    Lz4CompressState* state = (Lz4CompressState*)stream->internalState;
+    assert(state != NULL);
+
+    if (flush != PAL_Z_NOFLUSH && flush != PAL_Z_SYNCFLUSH && flush != PAL_Z_FINISH)
+    {
+        return PAL_Z_STREAMERROR;
+    }
+
+    int32_t flushed = 0;
+
+    for (;;)
+    {
+        DrainPending(state, stream);
+        if (state->pendingLength > 0 || (stream->availOut == 0 && !state->finished))
+        {
+            return PAL_Z_OK;
+        }
+
+        if (state->finished)
+        {
+            return PAL_Z_STREAMEND;
+        }
+
+        size_t result;
+        if (!state->started)
+        {
+            result = LZ4F_compressBegin(state->cctx, state->buffer, state->bufferCapacity, &state->preferences);
+            state->started = 1;
+        }
+        else if (stream->availIn > 0)
+        {
+            size_t chunk = stream->availIn < LZ4_INPUT_CHUNK ? stream->availIn : LZ4_INPUT_CHUNK;
+            result = LZ4F_compressUpdate(state->cctx, state->buffer, state->bufferCapacity, stream->nextIn, chunk, NULL);
+            if (!LZ4F_isError(result))
+            {
+                stream->nextIn += chunk;
+                stream->availIn -= (uint32_t)chunk;
+            }
+        }
+        else if (flush == PAL_Z_FINISH)
+        {
+            result = LZ4F_compressEnd(state->cctx, state->buffer, state->bufferCapacity, NULL);
+            state->finished = 1;
+        }
+        else if (flush == PAL_Z_SYNCFLUSH && !flushed)
+        {
+            result = LZ4F_flush(state->cctx, state->buffer, state->bufferCapacity, NULL);
+            flushed = 1;
+        }
+        else
+        {
+            return PAL_Z_OK;
+        }
+
+        if (LZ4F_isError(result))
+        {
+            stream->msg = (char*)LZ4F_getErrorName(result);
+            return PAL_Z_STREAMERROR;
+        }
+
+        state->pendingOffset = 0;
+        state->pendingLength = result;
+    }
+}
+
+int32_t CompressionNative_Lz4CompressEnd(PAL_ZStream* stream)
+{
+    assert(stream != NULL);
+
+    FreeCompressState((Lz4CompressState*)stream->internalState);
+    stream->internalState = NULL;
+
+    return PAL_Z_OK;
+}
+
+int32_t CompressionNative_Lz4DecompressInit(PAL_ZStream* stream)
+{
+    assert(stream != NULL);
+
+    stream->msg = NULL;
+
+    LZ4F_dctx* dctx = NULL;
+    LZ4F_errorCode_t result = LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION);
+    stream->internalState = dctx;
+
+    if (LZ4F_isError(result))
+    {
+        stream->msg = (char*)LZ4F_getErrorName(result);
+        LZ4F_freeDecompressionContext(dctx);
+        stream->internalState = NULL;
+        return PAL_Z_MEMERROR;
+    }
+
+    return PAL_Z_OK;
+}
+
+int32_t CompressionNative_Lz4Decompress(PAL_ZStream* stream)
+{
+    assert(stream != NULL);
+
+    LZ4F_dctx* dctx = (LZ4F_dctx*)stream->internalState;
+    assert(dctx != NULL);
+
+    size_t consumed = stream->availIn;
+    size_t produced = stream->availOut;
+
+    size_t result = LZ4F_decompress(dctx, stream->nextOut, &produced, stream->nextIn, &consumed, NULL);
+
+    stream->nextIn += consumed;
+    stream->availIn -= (uint32_t)consumed;
+    stream->nextOut += produced;
+    stream->availOut -= (uint32_t)produced;
+
+    if (LZ4F_isError(result))
+    {
+        stream->msg = (char*)LZ4F_getErrorName(result);
+        return PAL_Z_DATAERROR;
+    }
+
+    return result == 0 ? PAL_Z_STREAMEND : PAL_Z_OK;
+}
+
+int32_t CompressionNative_Lz4DecompressEnd(PAL_ZStream* stream)
+{
+    assert(stream != NULL);
+
+    LZ4F_freeDecompressionContext((LZ4F_dctx*)stream->internalState);
+    stream->internalState = NULL;
+
+    return PAL_Z_OK;
+}
+
+#else // FEATURE_LZ4
+
+int32_t CompressionNative_Lz4CompressInit(PAL_ZStream* stream, int32_t level, int32_t contentChecksum)
+{
+    (void)level;
+    (void)contentChecksum;
+    stream->internalState = NULL;
+    return PAL_Z_VERSIONERROR;
+}
+
+int32_t CompressionNative_Lz4Compress(PAL_ZStream* stream, int32_t flush)
+{
+    (void)stream;
+    (void)flush;
+    return PAL_Z_STREAMERROR;
+}
+
+int32_t CompressionNative_Lz4CompressEnd(PAL_ZStream* stream)
+{
+    (void)stream;
+    return PAL_Z_OK;
+}
+
+int32_t CompressionNative_Lz4DecompressInit(PAL_ZStream* stream)
+{
+    stream->internalState = NULL;
+    return PAL_Z_VERSIONERROR;
+}
+
+int32_t CompressionNative_Lz4Decompress(PAL_ZStream* stream)
+{
+    (void)stream;
+    return PAL_Z_STREAMERROR;
+}
+
+int32_t CompressionNative_Lz4DecompressEnd(PAL_ZStream* stream)
+{
+    (void)stream;
+    return PAL_Z_OK;
+}
+
+#endif // FEATURE_LZ4
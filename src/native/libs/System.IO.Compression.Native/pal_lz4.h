@@ -0,0 +1,68 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#pragma once
+
+#include "pal_zlib.h"
+
+/*
+LZ4 frame format streaming compression and decompression over a PAL_ZStream.
+
+The stream fields have the same meaning as for Deflate and Inflate: nextIn/availIn are consumed,
+nextOut/availOut are filled, and internalState holds the LZ4 frame context. msg is set to a
+static string describing the last LZ4 error.
+
+When the library is built without LZ4 support the Init functions return PAL_Z_VERSIONERROR.
+*/
+
+/*
+Initializes the PAL_ZStream so the Lz4Compress function can be invoked on it.
+
+level 0 is the fast compressor, 3 and up (to 12) select the high compression one. A non-zero
+contentChecksum appends an xxHash32 of the uncompressed data to the frame.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_Lz4CompressInit(
+    PAL_ZStream* stream, int32_t level, int32_t contentChecksum);
+
+/*
+Compresses the bytes in the PAL_ZStream's nextIn buffer and puts the compressed bytes in nextOut.
+
+flush is PAL_Z_NOFLUSH, PAL_Z_SYNCFLUSH to emit everything compressed so far, or PAL_Z_FINISH to
+end the frame. Call again with the same flush value while the output buffer keeps filling up.
+A stream produces a single frame; once it's finished the stream must be ended.
+
+Returns PAL_Z_STREAMEND once a PAL_Z_FINISH call has written the whole frame, PAL_Z_OK while more
+calls are needed, or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_Lz4Compress(PAL_ZStream* stream, int32_t flush);
+
+/*
+All dynamically allocated data structures for this stream are freed.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_Lz4CompressEnd(PAL_ZStream* stream);
+
+/*
+Initializes the PAL_ZStream so the Lz4Decompress function can be invoked on it.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_Lz4DecompressInit(PAL_ZStream* stream);
+
+/*
+Decompresses the bytes in the PAL_ZStream's nextIn buffer and puts the uncompressed bytes in nextOut.
+
+Returns PAL_Z_STREAMEND when a frame has been fully decoded and flushed, PAL_Z_OK while more
+input or output space is needed, or PAL_Z_DATAERROR for corrupt input.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_Lz4Decompress(PAL_ZStream* stream);
+
+/*
+All dynamically allocated data structures for this stream are freed.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_Lz4DecompressEnd(PAL_ZStream* stream);
@@ -20,6 +20,7 @@
 #endif
 
 c_static_assert(PAL_Z_NOFLUSH == Z_NO_FLUSH);
+c_static_assert(PAL_Z_SYNCFLUSH == Z_SYNC_FLUSH);
 c_static_assert(PAL_Z_FINISH == Z_FINISH);
 
 c_static_assert(PAL_Z_OK == Z_OK);
@@ -35,6 +36,10 @@ c_static_assert(PAL_Z_BESTSPEED == Z_BEST_SPEED);
 c_static_assert(PAL_Z_DEFAULTCOMPRESSION == Z_DEFAULT_COMPRESSION);
 
 c_static_assert(PAL_Z_DEFAULTSTRATEGY == Z_DEFAULT_STRATEGY);
+c_static_assert(PAL_Z_FILTERED == Z_FILTERED);
+c_static_assert(PAL_Z_HUFFMANONLY == Z_HUFFMAN_ONLY);
+c_static_assert(PAL_Z_RLE == Z_RLE);
+c_static_assert(PAL_Z_FIXED == Z_FIXED);
 
 c_static_assert(PAL_Z_DEFLATED == Z_DEFLATED);
 
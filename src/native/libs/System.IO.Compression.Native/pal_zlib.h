@@ -1,6 +1,8 @@
 // Licensed to the .NET Foundation under one or more agreements.
 // The .NET Foundation licenses this file to you under the MIT license.
 
+#pragma once
+
 #ifdef _WIN32
     #include <stdint.h>
     #include <windows.h>
@@ -36,6 +38,7 @@ Allowed flush values for the Deflate and Inflate functions.
 enum PAL_FlushCode
 {
     PAL_Z_NOFLUSH = 0,
+    PAL_Z_SYNCFLUSH = 2,
     PAL_Z_FINISH = 4,
 };
 
@@ -65,10 +68,17 @@ enum PAL_CompressionLevel
 
 /*
 Compression strategy
+
+With zlib-ng, PAL_Z_BESTSPEED with the default strategy uses deflate_quick, the fastest
+streaming compressor; PAL_Z_RLE and PAL_Z_HUFFMANONLY trade ratio for even less match searching.
 */
 enum PAL_CompressionStrategy
 {
-    PAL_Z_DEFAULTSTRATEGY = 0
+    PAL_Z_DEFAULTSTRATEGY = 0,
+    PAL_Z_FILTERED = 1,
+    PAL_Z_HUFFMANONLY = 2,
+    PAL_Z_RLE = 3,
+    PAL_Z_FIXED = 4
 };
 
 /*
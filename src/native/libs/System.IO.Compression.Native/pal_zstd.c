@@ -0,0 +1,210 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include <assert.h>
+#include <stdlib.h>
+#include "pal_zstd.h"
+
+#ifdef FEATURE_ZSTD
+#include <zstd.h>
+
+/*
+Moves the PAL_ZStream buffers past whatever zstd consumed and produced.
+*/
+static void Advance(PAL_ZStream* stream, const ZSTD_inBuffer* in, const ZSTD_outBuffer* out)
+{
+    stream->nextIn += in->pos;
+    stream->availIn -= (uint32_t)in->pos;
+
+    stream->nextOut += out->pos;
+    stream->availOut -= (uint32_t)out->pos;
+}
+
+int32_t CompressionNative_ZstdCompressInit(
+    PAL_ZStream* stream, int32_t level, int32_t workers, const uint8_t* dictionary, int32_t dictionaryLength)
+{
+    assert(stream != NULL);
+    assert(dictionary != NULL || dictionaryLength == 0);
+
+    stream->msg = NULL;
+
+    ZSTD_CCtx* cctx = ZSTD_createCCtx();
+    stream->internalState = cctx;
+    if (cctx == NULL)
+    {
+        return PAL_Z_MEMERROR;
+    }
+
+    size_t result = ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, level);
+
+    if (!ZSTD_isError(result) && workers > 0)
+    {
+        // Fails when libzstd was built without threading support; compress on the calling thread then.
+        (void)ZSTD_CCtx_setParameter(cctx, ZSTD_c_nbWorkers, workers);
+    }
+
+    if (!ZSTD_isError(result) && dictionaryLength > 0)
+    {
+        result = ZSTD_CCtx_loadDictionary(cctx, dictionary, (size_t)dictionaryLength);
+    }
+
+    if (ZSTD_isError(result))
+    {
+        stream->msg = (char*)ZSTD_getErrorName(result);
+        ZSTD_freeCCtx(cctx);
+        stream->internalState = NULL;
+        return PAL_Z_STREAMERROR;
+    }
+
+    return PAL_Z_OK;
+}
+
+int32_t CompressionNative_ZstdCompress(PAL_ZStream* stream, int32_t flush)
+{
+    assert(stream != NULL);
+
+    ZSTD_CCtx* cctx = (ZSTD_CCtx*)stream->internalState;
+    assert(cctx != NULL);
+
+    ZSTD_EndDirective op;
+    switch (flush)
+    {
+        case PAL_Z_NOFLUSH: op = ZSTD_e_continue; break;
+        case PAL_Z_SYNCFLUSH: op = ZSTD_e_flush; break;
+        case PAL_Z_FINISH: op = ZSTD_e_end; break;
+        default: return PAL_Z_STREAMERROR;
+    }
+
+    ZSTD_inBuffer in = { stream->nextIn, stream->availIn, 0 };
+    ZSTD_outBuffer out = { stream->nextOut, stream->availOut, 0 };
+
+    size_t remaining = ZSTD_compressStream2(cctx, &out, &in, op);
+    Advance(stream, &in, &out);
+
+    if (ZSTD_isError(remaining))
+    {
+        stream->msg = (char*)ZSTD_getErrorName(remaining);
+        return PAL_Z_STREAMERROR;
+    }
+
+    return op == ZSTD_e_end && remaining == 0 ? PAL_Z_STREAMEND : PAL_Z_OK;
+}
+
+int32_t CompressionNative_ZstdCompressEnd(PAL_ZStream* stream)
+{
+    assert(stream != NULL);
+
+    ZSTD_freeCCtx((ZSTD_CCtx*)stream->internalState);
+    stream->internalState = NULL;
+
+    return PAL_Z_OK;
+}
+
+int32_t CompressionNative_ZstdDecompressInit(PAL_ZStream* stream, const uint8_t* dictionary, int32_t dictionaryLength)
+{
+    assert(stream != NULL);
+    assert(dictionary != NULL || dictionaryLength == 0);
+
+    stream->msg = NULL;
+
+    ZSTD_DCtx* dctx = ZSTD_createDCtx();
+    stream->internalState = dctx;
+    if (dctx == NULL)
+    {
+        return PAL_Z_MEMERROR;
+    }
+
+    if (dictionaryLength > 0)
+    {
+        size_t result = ZSTD_DCtx_loadDictionary(dctx, dictionary, (size_t)dictionaryLength);
+        if (ZSTD_isError(result))
+        {
+            stream->msg = (char*)ZSTD_getErrorName(result);
+            ZSTD_freeDCtx(dctx);
+            stream->internalState = NULL;
+            return PAL_Z_STREAMERROR;
+        }
+    }
+
+    return PAL_Z_OK;
+}
+
+int32_t CompressionNative_ZstdDecompress(PAL_ZStream* stream)
+{
+    assert(stream != NULL);
+
+    ZSTD_DCtx* dctx = (ZSTD_DCtx*)stream->internalState;
+    assert(dctx != NULL);
+
+    ZSTD_inBuffer in = { stream->nextIn, stream->availIn, 0 };
+    ZSTD_outBuffer out = { stream->nextOut, stream->availOut, 0 };
+
+    size_t result = ZSTD_decompressStream(dctx, &out, &in);
+    Advance(stream, &in, &out);
+
+    if (ZSTD_isError(result))
+    {
+        stream->msg = (char*)ZSTD_getErrorName(result);
+        return PAL_Z_DATAERROR;
+    }
+
+    return result == 0 ? PAL_Z_STREAMEND : PAL_Z_OK;
+}
+
+int32_t CompressionNative_ZstdDecompressEnd(PAL_ZStream* stream)
+{
+    assert(stream != NULL);
+
+    ZSTD_freeDCtx((ZSTD_DCtx*)stream->internalState);
+    stream->internalState = NULL;
+
+    return PAL_Z_OK;
+}
+
+#else // FEATURE_ZSTD
+
+int32_t CompressionNative_ZstdCompressInit(
+    PAL_ZStream* stream, int32_t level, int32_t workers, const uint8_t* dictionary, int32_t dictionaryLength)
+{
+    (void)level;
+    (void)workers;
+    (void)dictionary;
+    (void)dictionaryLength;
+    stream->internalState = NULL;
+    return PAL_Z_VERSIONERROR;
+}
+
+int32_t CompressionNative_ZstdCompress(PAL_ZStream* stream, int32_t flush)
+{
+    (void)stream;
+    (void)flush;
+    return PAL_Z_STREAMERROR;
+}
+
+int32_t CompressionNative_ZstdCompressEnd(PAL_ZStream* stream)
+{
+    (void)stream;
+    return PAL_Z_OK;
+}
+
+int32_t CompressionNative_ZstdDecompressInit(PAL_ZStream* stream, const uint8_t* dictionary, int32_t dictionaryLength)
+{
+    (void)dictionary;
+    (void)dictionaryLength;
+    stream->internalState = NULL;
+    return PAL_Z_VERSIONERROR;
+}
+
+int32_t CompressionNative_ZstdDecompress(PAL_ZStream* stream)
+{
+    (void)stream;
+    return PAL_Z_STREAMERROR;
+}
+
+int32_t CompressionNative_ZstdDecompressEnd(PAL_ZStream* stream)
+{
+    (void)stream;
+    return PAL_Z_OK;
+}
+
+#endif // FEATURE_ZSTD
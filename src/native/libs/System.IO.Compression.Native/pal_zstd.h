@@ -0,0 +1,73 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#pragma once
+
+#include "pal_zlib.h"
+
+/*
+Zstandard streaming compression and decompression over a PAL_ZStream.
+
+The stream fields have the same meaning as for Deflate and Inflate: nextIn/availIn are consumed,
+nextOut/availOut are filled, and internalState holds the zstd context. msg is set to a static
+string describing the last zstd error.
+
+When the library is built without zstd support the Init functions return PAL_Z_VERSIONERROR.
+*/
+
+/*
+Initializes the PAL_ZStream so the ZstdCompress function can be invoked on it.
+
+level follows zstd (1-22, negative values for the fast levels, 0 for the default). A workers
+count above zero compresses on that many background threads, if libzstd was built with threading
+support, and on the calling thread otherwise. dictionary may be NULL, otherwise it's a zstd
+dictionary (or raw content); it's copied, so the buffer can be released once this returns.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdCompressInit(
+    PAL_ZStream* stream, int32_t level, int32_t workers, const uint8_t* dictionary, int32_t dictionaryLength);
+
+/*
+Compresses the bytes in the PAL_ZStream's nextIn buffer and puts the compressed bytes in nextOut.
+
+flush is PAL_Z_NOFLUSH, PAL_Z_SYNCFLUSH to emit everything compressed so far, or PAL_Z_FINISH to
+end the frame. Call again with the same flush value while the output buffer keeps filling up.
+
+Returns PAL_Z_STREAMEND once a PAL_Z_FINISH call has written the whole frame, PAL_Z_OK while more
+calls are needed, or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdCompress(PAL_ZStream* stream, int32_t flush);
+
+/*
+All dynamically allocated data structures for this stream are freed.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdCompressEnd(PAL_ZStream* stream);
+
+/*
+Initializes the PAL_ZStream so the ZstdDecompress function can be invoked on it.
+
+dictionary may be NULL, otherwise it must be the dictionary the frames were compressed with.
+It's copied, so the buffer can be released once this returns.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdDecompressInit(
+    PAL_ZStream* stream, const uint8_t* dictionary, int32_t dictionaryLength);
+
+/*
+Decompresses the bytes in the PAL_ZStream's nextIn buffer and puts the uncompressed bytes in nextOut.
+
+Returns PAL_Z_STREAMEND when a frame has been fully decoded and flushed, PAL_Z_OK while more
+input or output space is needed, or PAL_Z_DATAERROR for corrupt input.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdDecompress(PAL_ZStream* stream);
+
+/*
+All dynamically allocated data structures for this stream are freed.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENCTION CompressionNative_ZstdDecompressEnd(PAL_ZStream* stream);
@@ -58,6 +58,8 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_EnumerateGatewayAddressesForInterface)
     DllImportEntry(SystemNative_Stat)
     DllImportEntry(SystemNative_LStat)
+    DllImportEntry(SystemNative_StatX)
+    DllImportEntry(SystemNative_FStatX)
     DllImportEntry(SystemNative_Open)
     DllImportEntry(SystemNative_Close)
     DllImportEntry(SystemNative_Dup)
@@ -66,6 +68,8 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_ShmUnlink)
     DllImportEntry(SystemNative_GetReadDirRBufferSize)
     DllImportEntry(SystemNative_ReadDirR)
+    DllImportEntry(SystemNative_ReadDirEntries)
+    DllImportEntry(SystemNative_LStatDirEntries)
     DllImportEntry(SystemNative_OpenDir)
     DllImportEntry(SystemNative_CloseDir)
     DllImportEntry(SystemNative_Pipe)
@@ -96,6 +100,7 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_MProtect)
     DllImportEntry(SystemNative_MAdvise)
     DllImportEntry(SystemNative_MSync)
+    DllImportEntry(SystemNative_MBind)
     DllImportEntry(SystemNative_SysConf)
     DllImportEntry(SystemNative_FTruncate)
     DllImportEntry(SystemNative_Poll)
@@ -125,6 +130,10 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_AlignedAlloc)
     DllImportEntry(SystemNative_AlignedFree)
     DllImportEntry(SystemNative_AlignedRealloc)
+    DllImportEntry(SystemNative_AlignedBufferPool_Create)
+    DllImportEntry(SystemNative_AlignedBufferPool_Destroy)
+    DllImportEntry(SystemNative_AlignedBufferPool_Rent)
+    DllImportEntry(SystemNative_AlignedBufferPool_Return)
     DllImportEntry(SystemNative_Calloc)
     DllImportEntry(SystemNative_Free)
     DllImportEntry(SystemNative_Malloc)
@@ -150,6 +159,9 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_SetIPv6Address)
     DllImportEntry(SystemNative_GetControlMessageBufferSize)
     DllImportEntry(SystemNative_TryGetIPPacketInformation)
+    DllImportEntry(SystemNative_GetUdpSegmentationControlMessageBufferSize)
+    DllImportEntry(SystemNative_SetUdpSegmentSize)
+    DllImportEntry(SystemNative_TryGetUdpGroSegmentSize)
     DllImportEntry(SystemNative_GetIPv4MulticastOption)
     DllImportEntry(SystemNative_SetIPv4MulticastOption)
     DllImportEntry(SystemNative_GetIPv6MulticastOption)
@@ -160,9 +172,13 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_SetSendTimeout)
     DllImportEntry(SystemNative_Receive)
     DllImportEntry(SystemNative_ReceiveMessage)
+    DllImportEntry(SystemNative_ReceiveMessages)
     DllImportEntry(SystemNative_ReceiveSocketError)
+    DllImportEntry(SystemNative_EnableZeroCopySend)
+    DllImportEntry(SystemNative_ReceiveZeroCopyCompletions)
     DllImportEntry(SystemNative_Send)
     DllImportEntry(SystemNative_SendMessage)
+    DllImportEntry(SystemNative_SendMessages)
     DllImportEntry(SystemNative_Accept)
     DllImportEntry(SystemNative_Bind)
     DllImportEntry(SystemNative_Connect)
@@ -177,6 +193,7 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_SetSockOpt)
     DllImportEntry(SystemNative_SetRawSockOpt)
     DllImportEntry(SystemNative_Socket)
+    DllImportEntry(SystemNative_GetSocketIncomingCpu)
     DllImportEntry(SystemNative_GetSocketType)
     DllImportEntry(SystemNative_GetAtOutOfBandMark)
     DllImportEntry(SystemNative_GetBytesAvailable)
@@ -190,6 +207,9 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_GetDomainSocketSizes)
     DllImportEntry(SystemNative_GetMaximumAddressSize)
     DllImportEntry(SystemNative_SendFile)
+    DllImportEntry(SystemNative_CreateSplicePipe)
+    DllImportEntry(SystemNative_CloseSplicePipe)
+    DllImportEntry(SystemNative_Splice)
     DllImportEntry(SystemNative_Disconnect)
     DllImportEntry(SystemNative_InterfaceNameToIndex)
     DllImportEntry(SystemNative_GetTcpGlobalStatistics)
@@ -269,6 +289,14 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_PWrite)
     DllImportEntry(SystemNative_PReadV)
     DllImportEntry(SystemNative_PWriteV)
+    DllImportEntry(SystemNative_GetDirectIOAlignment)
+    DllImportEntry(SystemNative_PReadV2)
+    DllImportEntry(SystemNative_PWriteV2)
+    DllImportEntry(SystemNative_CreateFileIoRing)
+    DllImportEntry(SystemNative_CloseFileIoRing)
+    DllImportEntry(SystemNative_SubmitFileRead)
+    DllImportEntry(SystemNative_SubmitFileWrite)
+    DllImportEntry(SystemNative_WaitForFileCompletions)
     DllImportEntry(SystemNative_CreateThread)
     DllImportEntry(SystemNative_EnablePosixSignalHandling)
     DllImportEntry(SystemNative_DisablePosixSignalHandling)
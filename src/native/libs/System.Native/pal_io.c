@@ -13,6 +13,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <fnmatch.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <sys/mman.h>
@@ -99,14 +100,21 @@ extern int     getpeereid(int, uid_t *__restrict__, gid_t *__restrict__);
 
 #endif
 
+#if HAVE_LINUX_IO_URING_H
+#include "pal_io_uring.h"
+#include <pthread.h>
+#endif
+
 #if HAVE_STAT64
 #define stat_ stat64
 #define fstat_ fstat64
 #define lstat_ lstat64
+#define fstatat_ fstatat64
 #else /* HAVE_STAT64 */
 #define stat_ stat
 #define fstat_ fstat
 #define lstat_ lstat
+#define fstatat_ fstatat
 #endif  /* HAVE_STAT64 */
 
 // These numeric values are specified by POSIX.
@@ -272,6 +280,154 @@ int32_t SystemNative_LStat(const char* path, FileStatus* output)
     return ret;
 }
 
+#if HAVE_STATX
+c_static_assert(PAL_STATX_TYPE == STATX_TYPE);
+c_static_assert(PAL_STATX_MODE == STATX_MODE);
+c_static_assert(PAL_STATX_UID == STATX_UID);
+c_static_assert(PAL_STATX_GID == STATX_GID);
+c_static_assert(PAL_STATX_ATIME == STATX_ATIME);
+c_static_assert(PAL_STATX_MTIME == STATX_MTIME);
+c_static_assert(PAL_STATX_CTIME == STATX_CTIME);
+c_static_assert(PAL_STATX_INO == STATX_INO);
+c_static_assert(PAL_STATX_SIZE == STATX_SIZE);
+c_static_assert(PAL_STATX_BTIME == STATX_BTIME);
+
+static void ConvertFileStatusX(const struct statx* src, FileStatus* dst)
+{
+    memset(dst, 0, sizeof(FileStatus));
+
+    dst->Dev = (int64_t)makedev(src->stx_dev_major, src->stx_dev_minor);
+    dst->RDev = (int64_t)makedev(src->stx_rdev_major, src->stx_rdev_minor);
+    dst->Flags = FILESTATUS_FLAGS_NONE;
+
+    // The type and permission bits are reported separately but share one field.
+    if (src->stx_mask & (STATX_TYPE | STATX_MODE))
+    {
+        int32_t mode = (int32_t)src->stx_mode;
+        if (!(src->stx_mask & STATX_TYPE))
+        {
+            mode &= ~S_IFMT;
+        }
+        if (!(src->stx_mask & STATX_MODE))
+        {
+            mode &= S_IFMT;
+        }
+        dst->Mode = mode;
+    }
+
+    if (src->stx_mask & STATX_UID)
+    {
+        dst->Uid = src->stx_uid;
+    }
+    if (src->stx_mask & STATX_GID)
+    {
+        dst->Gid = src->stx_gid;
+    }
+    if (src->stx_mask & STATX_INO)
+    {
+        dst->Ino = (int64_t)src->stx_ino;
+    }
+    if (src->stx_mask & STATX_SIZE)
+    {
+        dst->Size = (int64_t)src->stx_size;
+    }
+    if (src->stx_mask & STATX_ATIME)
+    {
+        dst->ATime = src->stx_atime.tv_sec;
+        dst->ATimeNsec = src->stx_atime.tv_nsec;
+    }
+    if (src->stx_mask & STATX_MTIME)
+    {
+        dst->MTime = src->stx_mtime.tv_sec;
+        dst->MTimeNsec = src->stx_mtime.tv_nsec;
+    }
+    if (src->stx_mask & STATX_CTIME)
+    {
+        dst->CTime = src->stx_ctime.tv_sec;
+        dst->CTimeNsec = src->stx_ctime.tv_nsec;
+    }
+    if (src->stx_mask & STATX_BTIME)
+    {
+        dst->BirthTime = src->stx_btime.tv_sec;
+        dst->BirthTimeNsec = src->stx_btime.tv_nsec;
+        dst->Flags |= FILESTATUS_FLAGS_HAS_BIRTHTIME;
+    }
+}
+
+static int32_t StatXCore(int dirfd, const char* path, int32_t atFlags, int32_t mask, int32_t flags, FileStatus* output, int32_t* filledMask)
+{
+    if (flags & PAL_STATX_FLAGS_NOFOLLOW)
+    {
+        atFlags |= AT_SYMLINK_NOFOLLOW;
+    }
+    if (flags & PAL_STATX_FLAGS_DONT_SYNC)
+    {
+        atFlags |= AT_STATX_DONT_SYNC;
+    }
+
+    struct statx result;
+    int ret;
+    while ((ret = statx(dirfd, path, atFlags, (unsigned int)(mask & PAL_STATX_ALL), &result)) < 0 && errno == EINTR);
+
+    if (ret == 0)
+    {
+        ConvertFileStatusX(&result, output);
+        *filledMask = (int32_t)(result.stx_mask & PAL_STATX_ALL);
+    }
+
+    return ret;
+}
+#else
+static int32_t GetFileStatusFilledMask(const FileStatus* output)
+{
+    return (output->Flags & FILESTATUS_FLAGS_HAS_BIRTHTIME) ? PAL_STATX_ALL : (PAL_STATX_ALL & ~PAL_STATX_BTIME);
+}
+#endif
+
+int32_t SystemNative_StatX(const char* path, int32_t mask, int32_t flags, FileStatus* output, int32_t* filledMask)
+{
+    assert(output != NULL);
+    assert(filledMask != NULL);
+
+    *filledMask = 0;
+
+#if HAVE_STATX
+    return StatXCore(AT_FDCWD, path, 0, mask, flags, output, filledMask);
+#else
+    // Without statx every field comes back anyway and there's nothing to skip syncing.
+    (void)mask;
+    int ret = (flags & PAL_STATX_FLAGS_NOFOLLOW) ? SystemNative_LStat(path, output) : SystemNative_Stat(path, output);
+    if (ret == 0)
+    {
+        *filledMask = GetFileStatusFilledMask(output);
+    }
+
+    return ret;
+#endif
+}
+
+int32_t SystemNative_FStatX(intptr_t fd, int32_t mask, int32_t flags, FileStatus* output, int32_t* filledMask)
+{
+    assert(output != NULL);
+    assert(filledMask != NULL);
+
+    *filledMask = 0;
+
+#if HAVE_STATX
+    return StatXCore(ToFileDescriptor(fd), "", AT_EMPTY_PATH, mask, flags & ~PAL_STATX_FLAGS_NOFOLLOW, output, filledMask);
+#else
+    (void)mask;
+    (void)flags;
+    int ret = SystemNative_FStat(fd, output);
+    if (ret == 0)
+    {
+        *filledMask = GetFileStatusFilledMask(output);
+    }
+
+    return ret;
+#endif
+}
+
 static int32_t ConvertOpenFlags(int32_t flags)
 {
     int32_t ret;
@@ -291,7 +447,7 @@ static int32_t ConvertOpenFlags(int32_t flags)
             return -1;
     }
 
-    if (flags & ~(PAL_O_ACCESS_MODE_MASK | PAL_O_CLOEXEC | PAL_O_CREAT | PAL_O_EXCL | PAL_O_TRUNC | PAL_O_SYNC | PAL_O_NOFOLLOW))
+    if (flags & ~(PAL_O_ACCESS_MODE_MASK | PAL_O_CLOEXEC | PAL_O_CREAT | PAL_O_EXCL | PAL_O_TRUNC | PAL_O_SYNC | PAL_O_NOFOLLOW | PAL_O_DIRECT))
     {
         assert_msg(false, "Unknown Open flag", (int)flags);
         return -1;
@@ -311,6 +467,10 @@ static int32_t ConvertOpenFlags(int32_t flags)
         ret |= O_SYNC;
     if (flags & PAL_O_NOFOLLOW)
         ret |= O_NOFOLLOW;
+#ifdef O_DIRECT
+    if (flags & PAL_O_DIRECT)
+        ret |= O_DIRECT;
+#endif
 
     assert(ret != -1);
     return ret;
@@ -320,9 +480,7 @@ intptr_t SystemNative_Open(const char* path, int32_t flags, int32_t mode)
 {
 // these two ifdefs are for platforms where we dont have the open version of CLOEXEC and thus
 // must simulate it by doing a fcntl with the SETFFD version after the open instead
-#if !HAVE_O_CLOEXEC
     int32_t old_flags = flags;
-#endif
     flags = ConvertOpenFlags(flags);
     if (flags == -1)
     {
@@ -330,6 +488,14 @@ intptr_t SystemNative_Open(const char* path, int32_t flags, int32_t mode)
         return -1;
     }
 
+#if !defined(O_DIRECT) && !defined(F_NOCACHE)
+    if (old_flags & PAL_O_DIRECT)
+    {
+        errno = ENOTSUP;
+        return -1;
+    }
+#endif
+
     int result;
     while ((result = open(path, flags, (mode_t)mode)) < 0 && errno == EINTR);
 #if !HAVE_O_CLOEXEC
@@ -338,11 +504,27 @@ intptr_t SystemNative_Open(const char* path, int32_t flags, int32_t mode)
         fcntl(result, F_SETFD, FD_CLOEXEC);
     }
 #endif
+#if !defined(O_DIRECT) && defined(F_NOCACHE)
+    // macOS has no O_DIRECT, turning off caching for the file descriptor is the closest equivalent.
+    if (result != -1 && (old_flags & PAL_O_DIRECT) && fcntl(result, F_NOCACHE, 1) == -1)
+    {
+        // Preserve and return errno from fcntl. close() may reset errno to OK.
+        int oldErrno = errno;
+        close(result);
+        errno = oldErrno;
+        result = -1;
+    }
+#endif
+    (void)old_flags;
     return result;
 }
 
 int32_t SystemNative_Close(intptr_t fd)
 {
+#if HAVE_LINUX_IO_URING_H
+    RemoveSocketFromIoUringPorts(ToFileDescriptor(fd));
+#endif
+
     return close(ToFileDescriptor(fd));
 }
 
@@ -538,6 +720,153 @@ int32_t SystemNative_ReadDirR(DIR* dir, uint8_t* buffer, int32_t bufferSize, Dir
     return 0;
 }
 
+#if defined(__linux__) && defined(SYS_getdents64) && !defined(TARGET_WASM)
+// The record layout getdents64 fills the buffer with, glibc only declares it from 2.30 on.
+struct linux_dirent64
+{
+    uint64_t d_ino;
+    int64_t d_off;
+    unsigned short d_reclen;
+    unsigned char d_type;
+    char d_name[];
+};
+#endif
+
+// Returns many entries per call, their names are copied into buffer so they stay valid until the next call.
+// On Linux the entries come straight from getdents64 on the directory's descriptor, so a DIR used with this
+// function must not also be read with SystemNative_ReadDirR.
+int32_t SystemNative_ReadDirEntries(DIR* dir, uint8_t* buffer, int32_t bufferSize, DirectoryEntry* entries, int32_t entryCount, int32_t* entriesRead)
+{
+    assert(dir != NULL);
+    assert(buffer != NULL);
+    assert(entries != NULL);
+    assert(entriesRead != NULL);
+
+    *entriesRead = 0;
+    if (bufferSize <= 0 || entryCount <= 0)
+    {
+        return EINVAL;
+    }
+
+#if defined(__linux__) && defined(SYS_getdents64) && !defined(TARGET_WASM)
+    int fd = dirfd(dir);
+
+    // getdents64 can return more records than fit in entries, so don't hand it more buffer than that
+    // could need; a record is at most its header plus NAME_MAX and a terminator, 8 byte aligned.
+    size_t maxRecordSize = (offsetof(struct linux_dirent64, d_name) + NAME_MAX + 1 + 7) & ~(size_t)7;
+    size_t readSize = (size_t)entryCount * maxRecordSize;
+    if (readSize > (size_t)bufferSize)
+    {
+        readSize = (size_t)bufferSize;
+    }
+
+    long bytesRead;
+    while ((bytesRead = syscall(SYS_getdents64, fd, buffer, readSize)) < 0 && errno == EINTR);
+    if (bytesRead < 0)
+    {
+        // EINVAL means the buffer can't hold even one record.
+        return errno;
+    }
+
+    if (bytesRead == 0)
+    {
+        return -1; // shim convention for end-of-stream
+    }
+
+    int32_t count = 0;
+    for (long offset = 0; offset < bytesRead && count < entryCount;)
+    {
+        struct linux_dirent64* record = (struct linux_dirent64*)(buffer + offset);
+        entries[count].Name = record->d_name;
+        entries[count].NameLength = -1; // sentinel value to mean we have to walk to find the first \0
+        entries[count].InodeType = (int32_t)record->d_type;
+        count++;
+        offset += record->d_reclen;
+    }
+
+    *entriesRead = count;
+    return 0;
+#else
+    // Fall back to readdir, copying the names out since the next readdir call invalidates them. Only read
+    // another entry while even the longest name still fits, there's no portable way to push one back.
+    if (bufferSize < NAME_MAX + 1)
+    {
+        return ERANGE;
+    }
+
+    int32_t count = 0;
+    int32_t used = 0;
+    while (count < entryCount && bufferSize - used >= NAME_MAX + 1)
+    {
+        errno = 0;
+        struct dirent* entry = readdir(dir);
+        if (entry == NULL)
+        {
+            // Report an error only once the entries already read have been returned.
+            if (errno != 0 && count == 0)
+            {
+                return errno;
+            }
+
+            break;
+        }
+
+        size_t nameLength = strlen(entry->d_name);
+        memcpy(buffer + used, entry->d_name, nameLength + 1);
+
+        ConvertDirent(entry, &entries[count]);
+        entries[count].Name = (const char*)(buffer + used);
+        entries[count].NameLength = (int32_t)nameLength;
+        used += (int32_t)nameLength + 1;
+        count++;
+    }
+
+    if (count == 0)
+    {
+        return -1; // shim convention for end-of-stream
+    }
+
+    *entriesRead = count;
+    return 0;
+#endif
+}
+
+// Stats a batch of entries returned by SystemNative_ReadDirEntries relative to their directory, so that
+// enumerating with attributes doesn't need a P/Invoke and a path string per file.
+int32_t SystemNative_LStatDirEntries(DIR* dir, const DirectoryEntry* entries, int32_t entryCount, FileStatus* statuses, int32_t* errors)
+{
+    assert(dir != NULL);
+    assert(entries != NULL);
+    assert(statuses != NULL);
+    assert(errors != NULL);
+
+    int fd = dirfd(dir);
+    if (fd == -1)
+    {
+        return -1;
+    }
+
+    for (int32_t i = 0; i < entryCount; i++)
+    {
+        struct stat_ result;
+        int ret;
+        while ((ret = fstatat_(fd, entries[i].Name, &result, AT_SYMLINK_NOFOLLOW)) < 0 && errno == EINTR);
+
+        if (ret == 0)
+        {
+            ConvertFileStatus(&result, &statuses[i]);
+            errors[i] = 0;
+        }
+        else
+        {
+            memset(&statuses[i], 0, sizeof(FileStatus));
+            errors[i] = SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+    }
+
+    return 0;
+}
+
 DIR* SystemNative_OpenDir(const char* path)
 {
     DIR *result;
@@ -927,7 +1256,7 @@ static int32_t ConvertMMapProtection(int32_t protection)
 
 static int32_t ConvertMMapFlags(int32_t flags)
 {
-    if (flags & ~(PAL_MAP_SHARED | PAL_MAP_PRIVATE | PAL_MAP_ANONYMOUS))
+    if (flags & ~(PAL_MAP_SHARED | PAL_MAP_PRIVATE | PAL_MAP_ANONYMOUS | PAL_MAP_HUGETLB | PAL_MAP_POPULATE))
     {
         assert_msg(false, "Unknown MMap flag", (int)flags);
         return -1;
@@ -940,6 +1269,17 @@ static int32_t ConvertMMapFlags(int32_t flags)
         ret |= MAP_SHARED;
     if (flags & PAL_MAP_ANONYMOUS)
         ret |= MAP_ANON;
+#ifdef MAP_HUGETLB
+    if (flags & PAL_MAP_HUGETLB)
+        ret |= MAP_HUGETLB;
+#else
+    if (flags & PAL_MAP_HUGETLB)
+        return -1;
+#endif
+#ifdef MAP_POPULATE
+    if (flags & PAL_MAP_POPULATE)
+        ret |= MAP_POPULATE;
+#endif
 
     assert(ret != -1);
     return ret;
@@ -1051,6 +1391,35 @@ int32_t SystemNative_MAdvise(void* address, uint64_t length, int32_t advice)
             (void)address, (void)length, (void)advice;
             errno = ENOTSUP;
             return -1;
+#endif
+        case PAL_MADV_HUGEPAGE:
+#if defined(MADV_HUGEPAGE) && !defined(TARGET_WASI)
+            return madvise(address, (size_t)length, MADV_HUGEPAGE);
+#else
+            (void)address, (void)length, (void)advice;
+            errno = ENOTSUP;
+            return -1;
+#endif
+        case PAL_MADV_POPULATE_READ:
+#if defined(MADV_POPULATE_READ) && !defined(TARGET_WASI)
+        {
+            // Available since Linux 5.14, callers fall back to touching the pages on EINVAL.
+            int result;
+            while ((result = madvise(address, (size_t)length, MADV_POPULATE_READ)) < 0 && errno == EINTR);
+            return result;
+        }
+#else
+            (void)address, (void)length, (void)advice;
+            errno = ENOTSUP;
+            return -1;
+#endif
+        case PAL_MADV_WILLNEED:
+#if defined(MADV_WILLNEED) && !defined(TARGET_WASI)
+            return madvise(address, (size_t)length, MADV_WILLNEED);
+#else
+            (void)address, (void)length, (void)advice;
+            errno = ENOTSUP;
+            return -1;
 #endif
         default:
             break; // fall through to error
@@ -1061,6 +1430,50 @@ int32_t SystemNative_MAdvise(void* address, uint64_t length, int32_t advice)
     return -1;
 }
 
+int32_t SystemNative_MBind(void* address, uint64_t length, int32_t numaNode)
+{
+    if (length > SIZE_MAX || numaNode < 0)
+    {
+        errno = length > SIZE_MAX ? ERANGE : EINVAL;
+        return -1;
+    }
+
+#if defined(__linux__) && defined(__NR_mbind)
+    // Not using libnuma for this, the values below are part of the kernel ABI.
+    const int MpolBind = 2;
+    const unsigned int MpolMfMove = 1 << 1;
+
+    const size_t BitsPerWord = sizeof(unsigned long) * 8;
+    size_t words = (size_t)numaNode / BitsPerWord + 1;
+    unsigned long* nodeMask = (unsigned long*)calloc(words, sizeof(unsigned long));
+    if (nodeMask == NULL)
+    {
+        errno = ENOMEM;
+        return -1;
+    }
+
+    nodeMask[(size_t)numaNode / BitsPerWord] = 1UL << ((size_t)numaNode % BitsPerWord);
+
+    // maxnode is one more than the number of bits the kernel reads.
+    long result = syscall(__NR_mbind, address, (unsigned long)length, MpolBind, nodeMask, (unsigned long)(words * BitsPerWord + 1), MpolMfMove);
+
+    int savedErrno = errno;
+    free(nodeMask);
+    errno = savedErrno;
+
+    if (result != 0 && errno == ENOSYS)
+    {
+        errno = ENOTSUP;
+    }
+
+    return result == 0 ? 0 : -1;
+#else
+    (void)address, (void)numaNode;
+    errno = ENOTSUP;
+    return -1;
+#endif
+}
+
 int32_t SystemNative_MSync(void* address, uint64_t length, int32_t flags)
 {
     if (length > SIZE_MAX)
@@ -1953,3 +2366,319 @@ int64_t SystemNative_PWriteV(intptr_t fd, IOVector* vectors, int32_t vectorCount
     assert(count >= -1);
     return count;
 }
+
+int32_t SystemNative_GetDirectIOAlignment(intptr_t fd, DirectIOAlignment* alignment)
+{
+    assert(alignment != NULL);
+
+    int32_t pageSize = (int32_t)sysconf(_SC_PAGESIZE);
+    alignment->MemoryAlignment = pageSize;
+    alignment->OffsetAlignment = pageSize;
+
+#if defined(STATX_DIOALIGN)
+    // Linux 6.1+ reports the actual requirements, which are often just the logical block size.
+    struct statx stx;
+    int result;
+    while ((result = statx(ToFileDescriptor(fd), "", AT_EMPTY_PATH, STATX_DIOALIGN, &stx)) < 0 && errno == EINTR);
+    if (result == 0 && (stx.stx_mask & STATX_DIOALIGN) != 0)
+    {
+        if (stx.stx_dio_mem_align == 0 || stx.stx_dio_offset_align == 0)
+        {
+            // The file doesn't support direct I/O at all.
+            errno = ENOTSUP;
+            return -1;
+        }
+
+        alignment->MemoryAlignment = (int32_t)stx.stx_dio_mem_align;
+        alignment->OffsetAlignment = (int32_t)stx.stx_dio_offset_align;
+        return 0;
+    }
+#endif
+
+    // Make sure the descriptor is valid even if we can't ask it for its requirements.
+    struct stat_ st;
+    int statResult;
+    while ((statResult = fstat_(ToFileDescriptor(fd), &st)) < 0 && errno == EINTR);
+    return statResult < 0 ? -1 : 0;
+}
+
+static bool TryConvertReadWriteFlagsPalToPlatform(int32_t palFlags, int* platformFlags)
+{
+    if ((palFlags & ~(PAL_RWF_NOWAIT | PAL_RWF_DSYNC)) != 0)
+    {
+        return false;
+    }
+
+    *platformFlags = 0;
+#if HAVE_PREADV2 && HAVE_PWRITEV2
+    if ((palFlags & PAL_RWF_NOWAIT) != 0)
+    {
+        *platformFlags |= RWF_NOWAIT;
+    }
+
+    if ((palFlags & PAL_RWF_DSYNC) != 0)
+    {
+        *platformFlags |= RWF_DSYNC;
+    }
+#endif
+
+    return true;
+}
+
+int64_t SystemNative_PReadV2(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset, int32_t flags)
+{
+    assert(vectors != NULL);
+    assert(vectorCount >= 0);
+
+    int platformFlags;
+    if (!TryConvertReadWriteFlagsPalToPlatform(flags, &platformFlags))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+#if HAVE_PREADV2
+    int64_t count;
+    while ((count = preadv2(ToFileDescriptor(fd), (struct iovec*)vectors, (int)vectorCount, (off_t)fileOffset, platformFlags)) < 0 && errno == EINTR);
+
+    // Kernels before 4.14 don't know RWF_NOWAIT, keep the caller's contract of failing with ENOTSUP.
+    if (count < 0 && errno == EOPNOTSUPP)
+    {
+        errno = ENOTSUP;
+    }
+
+    assert(count >= -1);
+    return count;
+#else
+    // Without preadv2 we can't promise not to block.
+    if ((flags & PAL_RWF_NOWAIT) != 0)
+    {
+        errno = ENOTSUP;
+        return -1;
+    }
+
+    return SystemNative_PReadV(fd, vectors, vectorCount, fileOffset);
+#endif
+}
+
+int64_t SystemNative_PWriteV2(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset, int32_t flags)
+{
+    assert(vectors != NULL);
+    assert(vectorCount >= 0);
+
+    int platformFlags;
+    if (!TryConvertReadWriteFlagsPalToPlatform(flags, &platformFlags))
+    {
+        errno = EINVAL;
+        return -1;
+    }
+
+#if HAVE_PWRITEV2
+    int64_t count;
+    while ((count = pwritev2(ToFileDescriptor(fd), (struct iovec*)vectors, (int)vectorCount, (off_t)fileOffset, platformFlags)) < 0 && errno == EINTR);
+
+    if (count < 0 && errno == EOPNOTSUPP)
+    {
+        errno = ENOTSUP;
+    }
+
+    assert(count >= -1);
+    return count;
+#else
+    if ((flags & PAL_RWF_NOWAIT) != 0)
+    {
+        errno = ENOTSUP;
+        return -1;
+    }
+
+    int64_t count = SystemNative_PWriteV(fd, vectors, vectorCount, fileOffset);
+
+    // Emulate RWF_DSYNC by syncing after the write.
+    if (count >= 0 && (flags & PAL_RWF_DSYNC) != 0)
+    {
+        int result;
+        while ((result = fsync(ToFileDescriptor(fd))) < 0 && errno == EINTR);
+        if (result < 0)
+        {
+            return -1;
+        }
+    }
+
+    return count;
+#endif
+}
+
+#if HAVE_LINUX_IO_URING_H
+typedef struct
+{
+    IoUring ring;
+
+    // Serializes submissions, completions are only reaped by the one waiting thread.
+    pthread_mutex_t submitLock;
+} FileIoRing;
+#endif
+
+int32_t SystemNative_CreateFileIoRing(int32_t entries, intptr_t* ring)
+{
+    if (ring == NULL || entries <= 0)
+    {
+        return Error_EFAULT;
+    }
+
+    *ring = 0;
+
+#if HAVE_LINUX_IO_URING_H
+    FileIoRing* fileRing = (FileIoRing*)calloc(1, sizeof(FileIoRing));
+    if (fileRing == NULL)
+    {
+        return Error_ENOMEM;
+    }
+
+    // Completions can outnumber submissions when the caller keeps submitting while it reaps.
+    int32_t error = IoUringInitialize(&fileRing->ring, (uint32_t)entries, (uint32_t)entries * 2);
+    if (error == Error_SUCCESS && (fileRing->ring.features & IORING_FEAT_SUBMIT_STABLE) == 0)
+    {
+        // Without it the kernel may read the iovecs after the submit call returned.
+        IoUringDestroy(&fileRing->ring);
+        error = Error_ENOTSUP;
+    }
+
+    if (error != Error_SUCCESS)
+    {
+        free(fileRing);
+        return error;
+    }
+
+    pthread_mutex_init(&fileRing->submitLock, NULL);
+    *ring = (intptr_t)fileRing;
+    return Error_SUCCESS;
+#else
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_CloseFileIoRing(intptr_t ring)
+{
+#if HAVE_LINUX_IO_URING_H
+    FileIoRing* fileRing = (FileIoRing*)ring;
+    if (fileRing == NULL)
+    {
+        return Error_EFAULT;
+    }
+
+    IoUringDestroy(&fileRing->ring);
+    pthread_mutex_destroy(&fileRing->submitLock);
+    free(fileRing);
+    return Error_SUCCESS;
+#else
+    (void)ring;
+    return Error_ENOTSUP;
+#endif
+}
+
+#if HAVE_LINUX_IO_URING_H
+static int32_t SubmitFileOperation(
+    intptr_t ring, uint8_t opcode, intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset, int32_t flags, uint64_t userData)
+{
+    FileIoRing* fileRing = (FileIoRing*)ring;
+    if (fileRing == NULL || vectors == NULL || vectorCount < 0)
+    {
+        return Error_EFAULT;
+    }
+
+    int platformFlags;
+    if (!TryConvertReadWriteFlagsPalToPlatform(flags, &platformFlags))
+    {
+        return Error_EINVAL;
+    }
+
+    struct io_uring_sqe sqe;
+    memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = opcode;
+    sqe.fd = ToFileDescriptor(fd);
+    sqe.addr = (uint64_t)(uintptr_t)vectors;
+    sqe.len = (uint32_t)vectorCount;
+    sqe.off = (uint64_t)fileOffset;
+    sqe.rw_flags = (uint32_t)platformFlags;
+    sqe.user_data = userData;
+
+    pthread_mutex_lock(&fileRing->submitLock);
+    int32_t error = IoUringQueue(&fileRing->ring, &sqe);
+    if (error == Error_SUCCESS)
+    {
+        error = IoUringSubmit(&fileRing->ring);
+    }
+    pthread_mutex_unlock(&fileRing->submitLock);
+
+    return error;
+}
+#endif
+
+int32_t SystemNative_SubmitFileRead(
+    intptr_t ring, intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset, int32_t flags, uint64_t userData)
+{
+#if HAVE_LINUX_IO_URING_H
+    return SubmitFileOperation(ring, IORING_OP_READV, fd, vectors, vectorCount, fileOffset, flags, userData);
+#else
+    (void)ring, (void)fd, (void)vectors, (void)vectorCount, (void)fileOffset, (void)flags, (void)userData;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_SubmitFileWrite(
+    intptr_t ring, intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset, int32_t flags, uint64_t userData)
+{
+#if HAVE_LINUX_IO_URING_H
+    return SubmitFileOperation(ring, IORING_OP_WRITEV, fd, vectors, vectorCount, fileOffset, flags, userData);
+#else
+    (void)ring, (void)fd, (void)vectors, (void)vectorCount, (void)fileOffset, (void)flags, (void)userData;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_WaitForFileCompletions(intptr_t ring, FileCompletion* completions, int32_t count, int32_t* completionCount)
+{
+    if (completions == NULL || completionCount == NULL || count <= 0)
+    {
+        return Error_EFAULT;
+    }
+
+    *completionCount = 0;
+
+#if HAVE_LINUX_IO_URING_H
+    FileIoRing* fileRing = (FileIoRing*)ring;
+    if (fileRing == NULL)
+    {
+        return Error_EFAULT;
+    }
+
+    uint32_t head = IoUringGetCompletionHead(&fileRing->ring);
+    while (IoUringPeekCompletion(&fileRing->ring, head) == NULL)
+    {
+        int32_t error = IoUringWaitForCompletion(&fileRing->ring);
+        if (error != Error_SUCCESS)
+        {
+            return error;
+        }
+    }
+
+    int32_t reaped = 0;
+    struct io_uring_cqe* cqe;
+    for (; reaped < count && (cqe = IoUringPeekCompletion(&fileRing->ring, head)) != NULL; head++)
+    {
+        FileCompletion* completion = &completions[reaped++];
+        completion->UserData = cqe->user_data;
+        completion->BytesTransferred = cqe->res >= 0 ? cqe->res : 0;
+        completion->Error = cqe->res >= 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(-cqe->res);
+        completion->Padding = 0;
+    }
+
+    IoUringSetCompletionHead(&fileRing->ring, head);
+
+    *completionCount = reaped;
+    return Error_SUCCESS;
+#else
+    (void)ring;
+    return Error_ENOTSUP;
+#endif
+}
@@ -157,8 +157,18 @@ enum
     PAL_O_TRUNC = 0x0080,    // Truncate file to length 0 if it already exists
     PAL_O_SYNC = 0x0100,     // Block writes call will block until physically written
     PAL_O_NOFOLLOW = 0x0200, // Fails to open the target if it's a symlink, parent symlinks are allowed
+    PAL_O_DIRECT = 0x0400,   // Bypass the page cache, buffers, offsets and lengths must follow SystemNative_GetDirectIOAlignment
 };
 
+/**
+ * Alignment requirements for I/O on a file opened with PAL_O_DIRECT.
+ */
+typedef struct
+{
+    int32_t MemoryAlignment; // Required alignment of buffer addresses
+    int32_t OffsetAlignment; // Required alignment of file offsets and lengths
+} DirectIOAlignment;
+
 /**
  * Constants for interpreting FileStatus.Flags.
  */
@@ -168,6 +178,35 @@ enum
     FILESTATUS_FLAGS_HAS_BIRTHTIME = 1,
 };
 
+/**
+ * Constants for the fields requested from and reported by SystemNative_StatX/FStatX.
+ * Values match the Linux STATX_* mask bits.
+ */
+enum
+{
+    PAL_STATX_TYPE = 0x0001,  // Mode & PAL_S_IFMT
+    PAL_STATX_MODE = 0x0002,  // Mode & ~PAL_S_IFMT
+    PAL_STATX_UID = 0x0008,
+    PAL_STATX_GID = 0x0010,
+    PAL_STATX_ATIME = 0x0020,
+    PAL_STATX_MTIME = 0x0040,
+    PAL_STATX_CTIME = 0x0080,
+    PAL_STATX_INO = 0x0100,
+    PAL_STATX_SIZE = 0x0200,
+    PAL_STATX_BTIME = 0x0800,
+    PAL_STATX_ALL = 0x0BFB,
+};
+
+/**
+ * Constants for the flags argument of SystemNative_StatX/FStatX.
+ */
+enum
+{
+    PAL_STATX_FLAGS_NONE = 0,
+    PAL_STATX_FLAGS_NOFOLLOW = 1,  // don't follow a trailing symlink, like lstat
+    PAL_STATX_FLAGS_DONT_SYNC = 2, // allow cached attributes on network filesystems instead of asking the server
+};
+
 /**
  * Constants for interpreting FileStatus.UserFlags.
  */
@@ -245,6 +284,8 @@ enum
     PAL_MAP_PRIVATE = 0x02, // private copy-on-write-mapping
 
     PAL_MAP_ANONYMOUS = 0x10, // mapping is not backed by any file
+    PAL_MAP_HUGETLB = 0x20,   // anonymous mapping backed by huge pages from the reserved pool
+    PAL_MAP_POPULATE = 0x40,  // prefault the whole mapping before returning
 };
 
 /**
@@ -264,7 +305,10 @@ enum
  */
 typedef enum
 {
-    PAL_MADV_DONTFORK = 1, // don't map pages in to forked process
+    PAL_MADV_DONTFORK = 1,      // don't map pages in to forked process
+    PAL_MADV_HUGEPAGE = 2,      // back the range with transparent huge pages where possible
+    PAL_MADV_POPULATE_READ = 3, // prefault the range for reading, can be called on disjoint parts from several threads
+    PAL_MADV_WILLNEED = 4,      // start reading the range in asynchronously
 } MemoryAdvice;
 
 /**
@@ -341,6 +385,23 @@ PALEXPORT int32_t SystemNative_Stat(const char* path, FileStatus* output);
  */
 PALEXPORT int32_t SystemNative_LStat(const char* path, FileStatus* output);
 
+/**
+ * Get only the requested fields of the file status from a full path. Implemented as shim to statx(2)
+ * where available, otherwise to stat(2)/lstat(2). Fields that aren't reported are zeroed; Dev and RDev
+ * are always reported. filledMask receives the PAL_STATX_* fields that are valid, which can be more
+ * than were requested.
+ *
+ * Returns 0 for success, -1 for failure. Sets errno on failure.
+ */
+PALEXPORT int32_t SystemNative_StatX(const char* path, int32_t mask, int32_t flags, FileStatus* output, int32_t* filledMask);
+
+/**
+ * Get only the requested fields of the file status from a descriptor. See SystemNative_StatX.
+ *
+ * Returns 0 for success, -1 for failure. Sets errno on failure.
+ */
+PALEXPORT int32_t SystemNative_FStatX(intptr_t fd, int32_t mask, int32_t flags, FileStatus* output, int32_t* filledMask);
+
 /**
  * Open or create a file or device. Implemented as shim to open(2).
  *
@@ -395,6 +456,24 @@ PALEXPORT int32_t SystemNative_GetReadDirRBufferSize(void);
  */
 PALEXPORT int32_t SystemNative_ReadDirR(DIR* dir, uint8_t* buffer, int32_t bufferSize, DirectoryEntry* outputEntry);
 
+/**
+ * Reads up to entryCount entries from the directory stream at once. The names point into buffer and stay
+ * valid until the next call. A stream read with this function must not be read with SystemNative_ReadDirR.
+ *
+ * Returns 0 when entries are retrieved; returns -1 when end-of-stream is reached; returns an error code on failure
+ */
+PALEXPORT int32_t SystemNative_ReadDirEntries(
+    DIR* dir, uint8_t* buffer, int32_t bufferSize, DirectoryEntry* entries, int32_t entryCount, int32_t* entriesRead);
+
+/**
+ * Gets the file status of each entry, relative to the directory and without following symlinks.
+ * errors receives a PAL error code per entry, Error_SUCCESS if its status was retrieved.
+ *
+ * Returns 0 for success, -1 if the directory has no descriptor. Sets errno on failure.
+ */
+PALEXPORT int32_t SystemNative_LStatDirEntries(
+    DIR* dir, const DirectoryEntry* entries, int32_t entryCount, FileStatus* statuses, int32_t* errors);
+
 /**
  * Returns a DIR struct containing info about the current path or NULL on failure; sets errno on fail.
  */
@@ -621,6 +700,14 @@ PALEXPORT int32_t SystemNative_MAdvise(void* address, uint64_t length, int32_t a
  */
 PALEXPORT int32_t SystemNative_MSync(void* address, uint64_t length, int32_t flags);
 
+/**
+ * Bind the memory of the specified pages to a NUMA node. Implemented as shim to mbind(2) with MPOL_BIND,
+ * pages already faulted in are migrated.
+ *
+ * Returns 0 for success, -1 for failure. Sets errno on failure, ENOTSUP where NUMA policies aren't supported.
+ */
+PALEXPORT int32_t SystemNative_MBind(void* address, uint64_t length, int32_t numaNode);
+
 /**
  * Get system configuration value. Implemented as shim to sysconf(3).
  *
@@ -829,3 +916,74 @@ PALEXPORT int64_t SystemNative_PReadV(intptr_t fd, IOVector* vectors, int32_t ve
  * Returns the number of bytes written on success; otherwise, -1 is returned an errno is set.
  */
 PALEXPORT int64_t SystemNative_PWriteV(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset);
+
+/**
+ * Per call flags for SystemNative_PReadV2 and SystemNative_PWriteV2.
+ */
+enum
+{
+    PAL_RWF_NONE = 0x0,
+    PAL_RWF_NOWAIT = 0x1, // Fail with EAGAIN instead of blocking, e.g. when the data isn't in the page cache.
+    PAL_RWF_DSYNC = 0x2,  // Complete the write only once the data is durable, like O_DSYNC for this call only.
+};
+
+/**
+ * Like SystemNative_PReadV with PAL_RWF_* flags. PAL_RWF_NOWAIT fails with ENOTSUP where it isn't supported.
+ *
+ * Returns the number of bytes read on success; otherwise, -1 is returned an errno is set.
+ */
+/**
+ * Gets the alignment that buffers, file offsets and lengths need for I/O on a file opened with PAL_O_DIRECT.
+ * Falls back to the page size, which satisfies every file system and device, if the file can't tell.
+ *
+ * Returns 0 on success; otherwise, -1 is returned and errno is set.
+ */
+PALEXPORT int32_t SystemNative_GetDirectIOAlignment(intptr_t fd, DirectIOAlignment* alignment);
+
+PALEXPORT int64_t SystemNative_PReadV2(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset, int32_t flags);
+
+/**
+ * Like SystemNative_PWriteV with PAL_RWF_* flags. PAL_RWF_NOWAIT fails with ENOTSUP where it isn't supported.
+ *
+ * Returns the number of bytes written on success; otherwise, -1 is returned an errno is set.
+ */
+PALEXPORT int64_t SystemNative_PWriteV2(intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset, int32_t flags);
+
+/**
+ * The result of a read or write submitted to a file I/O ring.
+ */
+typedef struct
+{
+    uint64_t UserData;         // The value passed when the operation was submitted
+    int64_t BytesTransferred;  // Number of bytes read or written, 0 if the operation failed
+    int32_t Error;             // PAL error code of the operation, Error_SUCCESS if it succeeded
+    int32_t Padding;           // Pad out to 8-byte alignment
+} FileCompletion;
+
+/**
+ * Creates an io_uring to read and write files asynchronously, without blocking a thread per operation.
+ *
+ * Returns Error_SUCCESS, or Error_ENOTSUP where io_uring isn't available; callers then use the synchronous functions.
+ */
+PALEXPORT int32_t SystemNative_CreateFileIoRing(int32_t entries, intptr_t* ring);
+
+PALEXPORT int32_t SystemNative_CloseFileIoRing(intptr_t ring);
+
+/**
+ * Starts reading into the buffers at the given offset. The vectors only need to stay valid for the duration
+ * of the call, the buffers they point to until the completion for userData has been received.
+ */
+PALEXPORT int32_t SystemNative_SubmitFileRead(
+    intptr_t ring, intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset, int32_t flags, uint64_t userData);
+
+/**
+ * Starts writing the buffers at the given offset, with the same lifetime rules as SystemNative_SubmitFileRead.
+ */
+PALEXPORT int32_t SystemNative_SubmitFileWrite(
+    intptr_t ring, intptr_t fd, IOVector* vectors, int32_t vectorCount, int64_t fileOffset, int32_t flags, uint64_t userData);
+
+/**
+ * Blocks until at least one submitted operation completed and returns up to count completions.
+ * Only one thread may wait on a ring at a time.
+ */
+PALEXPORT int32_t SystemNative_WaitForFileCompletions(intptr_t ring, FileCompletion* completions, int32_t count, int32_t* completionCount);
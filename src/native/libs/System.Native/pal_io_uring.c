@@ -0,0 +1,189 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "pal_config.h"
+#include "pal_errno.h"
+#include "pal_io_uring.h"
+
+#if HAVE_LINUX_IO_URING_H
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+static int IoUringSetup(uint32_t entries, struct io_uring_params* params)
+{
+    return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int IoUringEnter(int fd, uint32_t toSubmit, uint32_t minComplete, uint32_t flags)
+{
+    return (int)syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, NULL, 0);
+}
+
+int32_t IoUringInitialize(IoUring* ring, uint32_t submissionEntries, uint32_t completionEntries)
+{
+    assert(ring != NULL);
+
+    memset(ring, 0, sizeof(IoUring));
+    ring->fd = -1;
+
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = completionEntries;
+
+    ring->fd = IoUringSetup(submissionEntries, &params);
+    if (ring->fd == -1)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    const uint32_t RequiredFeatures = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP;
+    if ((params.features & RequiredFeatures) != RequiredFeatures)
+    {
+        IoUringDestroy(ring);
+        return Error_ENOTSUP;
+    }
+
+    ring->features = params.features;
+
+    size_t sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    size_t cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    ring->ringSize = sqRingSize > cqRingSize ? sqRingSize : cqRingSize;
+    ring->ring = mmap(NULL, ring->ringSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = (struct io_uring_sqe*)mmap(NULL, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+    if (ring->ring == MAP_FAILED || ring->sqes == MAP_FAILED)
+    {
+        int32_t error = SystemNative_ConvertErrorPlatformToPal(errno);
+        IoUringDestroy(ring);
+        return error;
+    }
+
+    uint8_t* base = (uint8_t*)ring->ring;
+    ring->sqHead = (uint32_t*)(base + params.sq_off.head);
+    ring->sqTail = (uint32_t*)(base + params.sq_off.tail);
+    ring->sqMask = *(uint32_t*)(base + params.sq_off.ring_mask);
+    ring->sqEntries = *(uint32_t*)(base + params.sq_off.ring_entries);
+    ring->sqArray = (uint32_t*)(base + params.sq_off.array);
+    ring->cqHead = (uint32_t*)(base + params.cq_off.head);
+    ring->cqTail = (uint32_t*)(base + params.cq_off.tail);
+    ring->cqMask = *(uint32_t*)(base + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe*)(base + params.cq_off.cqes);
+
+    return Error_SUCCESS;
+}
+
+void IoUringDestroy(IoUring* ring)
+{
+    assert(ring != NULL);
+
+    if (ring->sqes != NULL && ring->sqes != MAP_FAILED)
+    {
+        munmap(ring->sqes, ring->sqesSize);
+    }
+
+    if (ring->ring != NULL && ring->ring != MAP_FAILED)
+    {
+        munmap(ring->ring, ring->ringSize);
+    }
+
+    if (ring->fd != -1)
+    {
+        close(ring->fd);
+    }
+
+    memset(ring, 0, sizeof(IoUring));
+    ring->fd = -1;
+}
+
+int32_t IoUringQueue(IoUring* ring, const struct io_uring_sqe* sqe)
+{
+    assert(ring != NULL);
+    assert(sqe != NULL);
+
+    uint32_t tail = *ring->sqTail;
+    if (tail - __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE) == ring->sqEntries)
+    {
+        int32_t error = IoUringSubmit(ring);
+        if (error != Error_SUCCESS)
+        {
+            return error;
+        }
+    }
+
+    uint32_t index = tail & ring->sqMask;
+    memcpy(&ring->sqes[index], sqe, sizeof(struct io_uring_sqe));
+    ring->sqArray[index] = index;
+    __atomic_store_n(ring->sqTail, tail + 1, __ATOMIC_RELEASE);
+    ring->sqPending++;
+
+    return Error_SUCCESS;
+}
+
+int32_t IoUringSubmit(IoUring* ring)
+{
+    assert(ring != NULL);
+
+    while (ring->sqPending != 0)
+    {
+        int submitted;
+        while ((submitted = IoUringEnter(ring->fd, ring->sqPending, 0, 0)) < 0 && errno == EINTR);
+        if (submitted < 0)
+        {
+            return SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+
+        ring->sqPending -= (uint32_t)submitted;
+    }
+
+    return Error_SUCCESS;
+}
+
+int32_t IoUringWaitForCompletion(IoUring* ring)
+{
+    assert(ring != NULL);
+
+    if (IoUringPeekCompletion(ring, IoUringGetCompletionHead(ring)) != NULL)
+    {
+        return Error_SUCCESS;
+    }
+
+    if (IoUringEnter(ring->fd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    return Error_SUCCESS;
+}
+
+struct io_uring_cqe* IoUringPeekCompletion(IoUring* ring, uint32_t position)
+{
+    assert(ring != NULL);
+
+    uint32_t tail = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+    if (position == tail)
+    {
+        return NULL;
+    }
+
+    return &ring->cqes[position & ring->cqMask];
+}
+
+uint32_t IoUringGetCompletionHead(IoUring* ring)
+{
+    assert(ring != NULL);
+    return *ring->cqHead;
+}
+
+void IoUringSetCompletionHead(IoUring* ring, uint32_t position)
+{
+    assert(ring != NULL);
+    __atomic_store_n(ring->cqHead, position, __ATOMIC_RELEASE);
+}
+
+#endif // HAVE_LINUX_IO_URING_H
@@ -0,0 +1,90 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#pragma once
+
+#include "pal_compiler.h"
+#include "pal_config.h"
+#include "pal_types.h"
+
+#if HAVE_LINUX_IO_URING_H
+
+#include <linux/io_uring.h>
+
+// A minimal io_uring wrapper shared by the socket event port and the file I/O ring.
+//
+// Submissions aren't synchronized, callers serialize IoUringQueue/IoUringSubmit themselves. Completions
+// are expected to be reaped by a single thread.
+typedef struct
+{
+    int32_t fd;
+
+    void* ring;
+    size_t ringSize;
+    struct io_uring_sqe* sqes;
+    size_t sqesSize;
+
+    uint32_t* sqHead;
+    uint32_t* sqTail;
+    uint32_t sqMask;
+    uint32_t sqEntries;
+    uint32_t* sqArray;
+    uint32_t sqPending;
+
+    uint32_t* cqHead;
+    uint32_t* cqTail;
+    uint32_t cqMask;
+    struct io_uring_cqe* cqes;
+
+    uint32_t features;
+} IoUring;
+
+/**
+ * Creates the ring and maps its queues. Requires IORING_FEAT_SINGLE_MMAP and IORING_FEAT_NODROP (Linux 5.5).
+ *
+ * Returns Error_SUCCESS, or the PAL error if the ring couldn't be created.
+ */
+int32_t IoUringInitialize(IoUring* ring, uint32_t submissionEntries, uint32_t completionEntries);
+
+/**
+ * Unmaps the queues and closes the ring, safe to call on a ring that failed to initialize.
+ */
+void IoUringDestroy(IoUring* ring);
+
+/**
+ * Copies the request into the submission queue, submitting what is pending first if the queue is full.
+ * The request is passed to the kernel with the next IoUringSubmit.
+ */
+int32_t IoUringQueue(IoUring* ring, const struct io_uring_sqe* sqe);
+
+/**
+ * Passes all queued requests to the kernel.
+ */
+int32_t IoUringSubmit(IoUring* ring);
+
+/**
+ * Blocks until at least one completion is available. May return early with Error_SUCCESS when interrupted.
+ */
+int32_t IoUringWaitForCompletion(IoUring* ring);
+
+/**
+ * Returns the completion at the given position of the completion queue, or NULL when the queue has
+ * no completion at that position yet. Positions start at IoUringGetCompletionHead.
+ */
+struct io_uring_cqe* IoUringPeekCompletion(IoUring* ring, uint32_t position);
+
+uint32_t IoUringGetCompletionHead(IoUring* ring);
+
+/**
+ * Hands all completions before the given position back to the kernel.
+ */
+void IoUringSetCompletionHead(IoUring* ring, uint32_t position);
+
+/**
+ * Removes the socket from the io_uring socket event ports it is registered with. Must be called before
+ * the socket is closed: a multishot poll holds a reference to the file, so the socket would otherwise
+ * stay open, and its peer would not see it closed, until the port is.
+ */
+void RemoveSocketFromIoUringPorts(int32_t socket);
+
+#endif // HAVE_LINUX_IO_URING_H
@@ -2,11 +2,14 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 
 #include "pal_config.h"
+#include "pal_io.h"
 #include "pal_memory.h"
 
 #include <assert.h>
+#include <pthread.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 #if HAVE_MALLOC_SIZE
     #include <malloc/malloc.h>
@@ -58,6 +61,102 @@ void* SystemNative_AlignedRealloc(void* ptr, uintptr_t alignment, uintptr_t new_
     return result;
 }
 
+struct AlignedBufferPool
+{
+    pthread_mutex_t lock;
+    uintptr_t alignment;
+    uintptr_t bufferSize;
+    int32_t maxCachedBuffers;
+    int32_t cachedBufferCount;
+    void* cachedBuffers[];
+};
+
+AlignedBufferPool* SystemNative_AlignedBufferPool_Create(uintptr_t bufferSize, int32_t maxCachedBuffers)
+{
+    if (bufferSize == 0 || maxCachedBuffers < 0)
+    {
+        return NULL;
+    }
+
+    AlignedBufferPool* pool = (AlignedBufferPool*)calloc(1, sizeof(AlignedBufferPool) + (size_t)maxCachedBuffers * sizeof(void*));
+    if (pool == NULL)
+    {
+        return NULL;
+    }
+
+    // Page alignment satisfies the direct I/O requirements of every file system and device.
+    uintptr_t pageSize = (uintptr_t)sysconf(_SC_PAGESIZE);
+    pthread_mutex_init(&pool->lock, NULL);
+    pool->alignment = pageSize;
+    pool->bufferSize = (bufferSize + pageSize - 1) & ~(pageSize - 1);
+    pool->maxCachedBuffers = maxCachedBuffers;
+
+    return pool;
+}
+
+void SystemNative_AlignedBufferPool_Destroy(AlignedBufferPool* pool)
+{
+    if (pool == NULL)
+    {
+        return;
+    }
+
+    for (int32_t i = 0; i < pool->cachedBufferCount; i++)
+    {
+        SystemNative_AlignedFree(pool->cachedBuffers[i]);
+    }
+
+    pthread_mutex_destroy(&pool->lock);
+    free(pool);
+}
+
+void* SystemNative_AlignedBufferPool_Rent(AlignedBufferPool* pool)
+{
+    assert(pool != NULL);
+
+    void* buffer = NULL;
+
+    pthread_mutex_lock(&pool->lock);
+    if (pool->cachedBufferCount > 0)
+    {
+        buffer = pool->cachedBuffers[--pool->cachedBufferCount];
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    if (buffer == NULL)
+    {
+        buffer = SystemNative_AlignedAlloc(pool->alignment, pool->bufferSize);
+        if (buffer != NULL)
+        {
+            // The buffers are whole pages, so keep a fork from making them copy on write while the
+            // kernel may still be DMAing into them. Failing to do so isn't fatal.
+            SystemNative_MAdvise(buffer, pool->bufferSize, PAL_MADV_DONTFORK);
+        }
+    }
+
+    return buffer;
+}
+
+void SystemNative_AlignedBufferPool_Return(AlignedBufferPool* pool, void* buffer)
+{
+    assert(pool != NULL);
+
+    if (buffer == NULL)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    if (pool->cachedBufferCount < pool->maxCachedBuffers)
+    {
+        pool->cachedBuffers[pool->cachedBufferCount++] = buffer;
+        buffer = NULL;
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    SystemNative_AlignedFree(buffer);
+}
+
 void* SystemNative_Calloc(uintptr_t num, uintptr_t size)
 {
     return calloc(num, size);
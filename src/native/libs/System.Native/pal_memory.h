@@ -21,6 +21,31 @@ PALEXPORT void SystemNative_AlignedFree(void* ptr);
  */
 PALEXPORT void* SystemNative_AlignedRealloc(void* ptr, uintptr_t alignment, uintptr_t size);
 
+typedef struct AlignedBufferPool AlignedBufferPool;
+
+/**
+ * Creates a pool of page aligned buffers of bufferSize bytes, rounded up to whole pages, suitable for
+ * I/O on files opened with PAL_O_DIRECT. Up to maxCachedBuffers returned buffers are kept for reuse.
+ *
+ * Returns NULL if bufferSize is 0 or the pool couldn't be allocated.
+ */
+PALEXPORT AlignedBufferPool* SystemNative_AlignedBufferPool_Create(uintptr_t bufferSize, int32_t maxCachedBuffers);
+
+/**
+ * Frees the pool and all the buffers it caches. Rented buffers must have been returned first.
+ */
+PALEXPORT void SystemNative_AlignedBufferPool_Destroy(AlignedBufferPool* pool);
+
+/**
+ * Returns a cached buffer, or a newly allocated one if none is cached. Returns NULL on allocation failure.
+ */
+PALEXPORT void* SystemNative_AlignedBufferPool_Rent(AlignedBufferPool* pool);
+
+/**
+ * Gives a rented buffer back to the pool, the buffer is freed if the pool is full.
+ */
+PALEXPORT void SystemNative_AlignedBufferPool_Return(AlignedBufferPool* pool, void* buffer);
+
 /**
  * C runtime calloc
  */
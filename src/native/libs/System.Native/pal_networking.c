@@ -2,6 +2,7 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 
 #include "pal_config.h"
+#include "pal_io.h"
 #include "pal_networking.h"
 #include "pal_safecrt.h"
 #include "pal_utilities.h"
@@ -16,6 +17,11 @@
 #include <sys/time.h>
 #if HAVE_EPOLL
 #include <sys/epoll.h>
+#if HAVE_LINUX_IO_URING_H
+#include "pal_io_uring.h"
+#include <poll.h>
+#include <sys/eventfd.h>
+#endif
 #elif HAVE_KQUEUE
 #include <sys/types.h>
 #include <sys/event.h>
@@ -30,6 +36,9 @@
 #include <netdb.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#if defined(__linux__)
+#include <netinet/udp.h>
+#endif
 #include <net/if.h>
 #include <stdlib.h>
 #include <string.h>
@@ -939,6 +948,16 @@ int32_t SystemNative_GetControlMessageBufferSize(int32_t isIPv4, int32_t isIPv6)
     return (isIPv4 != 0 ? CMSG_SPACE(sizeof(struct in_pktinfo)) : 0) + (isIPv6 != 0 ? CMSG_SPACE(sizeof(struct in6_pktinfo)) : 0);
 }
 
+int32_t SystemNative_GetUdpSegmentationControlMessageBufferSize(int32_t isIPv4, int32_t isIPv6)
+{
+#if defined(UDP_SEGMENT) && defined(UDP_GRO)
+    // UDP_SEGMENT is sent as a uint16_t while UDP_GRO is received as an int, size for the larger of the two.
+    return SystemNative_GetControlMessageBufferSize(isIPv4, isIPv6) + (int32_t)CMSG_SPACE(sizeof(int));
+#else
+    return SystemNative_GetControlMessageBufferSize(isIPv4, isIPv6);
+#endif
+}
+
 static int32_t GetIPv4PacketInformation(struct cmsghdr* controlMessage, IPPacketInformation* packetInfo)
 {
     assert(controlMessage != NULL);
@@ -1056,6 +1075,73 @@ SystemNative_TryGetIPPacketInformation(MessageHeader* messageHeader, int32_t isI
     return 0;
 }
 
+int32_t SystemNative_SetUdpSegmentSize(MessageHeader* messageHeader, int32_t segmentSize)
+{
+    if (messageHeader == NULL || messageHeader->ControlBufferLen < 0)
+    {
+        return Error_EFAULT;
+    }
+
+#ifdef UDP_SEGMENT
+    if (segmentSize <= 0 || segmentSize > UINT16_MAX || (size_t)messageHeader->ControlBufferLen < CMSG_SPACE(sizeof(uint16_t)))
+    {
+        return Error_EINVAL;
+    }
+
+    // The kernel splits the payload into datagrams of segmentSize bytes, so a single sendmsg can carry
+    // many datagrams to the same destination.
+    memset(messageHeader->ControlBuffer, 0, CMSG_SPACE(sizeof(uint16_t)));
+
+    struct msghdr header;
+    ConvertMessageHeaderToMsghdr(&header, messageHeader, -1);
+    header.msg_controllen = CMSG_SPACE(sizeof(uint16_t));
+
+    struct cmsghdr* controlMessage = CMSG_FIRSTHDR(&header);
+    controlMessage->cmsg_level = IPPROTO_UDP;
+    controlMessage->cmsg_type = UDP_SEGMENT;
+    controlMessage->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+
+    uint16_t value = (uint16_t)segmentSize;
+    memcpy(CMSG_DATA(controlMessage), &value, sizeof(uint16_t));
+
+    messageHeader->ControlBufferLen = (int32_t)CMSG_SPACE(sizeof(uint16_t));
+    return Error_SUCCESS;
+#else
+    (void)segmentSize;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_TryGetUdpGroSegmentSize(MessageHeader* messageHeader, int32_t* segmentSize)
+{
+    if (messageHeader == NULL || segmentSize == NULL)
+    {
+        return 0;
+    }
+
+#ifdef UDP_GRO
+    struct msghdr header;
+    ConvertMessageHeaderToMsghdr(&header, messageHeader, -1);
+
+    // Present when the kernel coalesced several datagrams of this size into the received buffer,
+    // UDP_GRO has to be enabled on the socket for that to happen.
+    for (struct cmsghdr* controlMessage = CMSG_FIRSTHDR(&header); controlMessage != NULL && controlMessage->cmsg_len > 0;
+         controlMessage = GET_CMSG_NXTHDR(&header, controlMessage))
+    {
+        if (controlMessage->cmsg_level == IPPROTO_UDP && controlMessage->cmsg_type == UDP_GRO &&
+            controlMessage->cmsg_len >= CMSG_LEN(sizeof(int)))
+        {
+            int value;
+            memcpy(&value, CMSG_DATA(controlMessage), sizeof(int));
+            *segmentSize = value;
+            return 1;
+        }
+    }
+#endif
+
+    return 0;
+}
+
 static int8_t GetMulticastOptionName(int32_t multicastOption, int8_t isIPv6, int* optionName)
 {
     switch (multicastOption)
@@ -1333,6 +1419,9 @@ static int8_t ConvertSocketFlagsPalToPlatform(int32_t palFlags, int* platformFla
     const int32_t SupportedFlagsMask =
 #ifdef MSG_ERRQUEUE
                         SocketFlags_MSG_ERRQUEUE |
+#endif
+#ifdef MSG_ZEROCOPY
+                        SocketFlags_MSG_ZEROCOPY |
 #endif
                         SocketFlags_MSG_OOB | SocketFlags_MSG_PEEK | SocketFlags_MSG_DONTROUTE | SocketFlags_MSG_TRUNC | SocketFlags_MSG_CTRUNC | SocketFlags_MSG_DONTWAIT;
 
@@ -1352,6 +1441,12 @@ static int8_t ConvertSocketFlagsPalToPlatform(int32_t palFlags, int* platformFla
     {
         *platformFlags |= MSG_ERRQUEUE;
     }
+#endif
+#ifdef MSG_ZEROCOPY
+    if ((palFlags & SocketFlags_MSG_ZEROCOPY) != 0)
+    {
+        *platformFlags |= MSG_ZEROCOPY;
+    }
 #endif
     return true;
 }
@@ -1450,6 +1545,119 @@ int32_t SystemNative_ReceiveSocketError(intptr_t socket, MessageHeader* messageH
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+int32_t SystemNative_EnableZeroCopySend(intptr_t socket)
+{
+#if HAVE_LINUX_ERRQUEUE_H && defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+    int fd = ToFileDescriptor(socket);
+    int value = 1;
+    int err = setsockopt(fd, SOL_SOCKET, SO_ZEROCOPY, &value, sizeof(value));
+    return err == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)socket;
+    return Error_ENOTSUP;
+#endif
+}
+
+// Sends made with SocketFlags_MSG_ZEROCOPY keep referencing the caller's buffers until the kernel posts a
+// completion for them on the socket error queue. Each completion covers a range of sends, numbered in
+// the order they were made, and the buffers of those sends may be released once it is reaped here.
+int32_t SystemNative_ReceiveZeroCopyCompletions(
+    intptr_t socket, ZeroCopyCompletion* completions, int32_t count, int32_t* completionCount)
+{
+    if (completions == NULL || completionCount == NULL || count < 0)
+    {
+        return Error_EFAULT;
+    }
+
+    *completionCount = 0;
+
+#if HAVE_LINUX_ERRQUEUE_H && defined(SO_EE_ORIGIN_ZEROCOPY)
+    int fd = ToFileDescriptor(socket);
+
+    while (*completionCount < count)
+    {
+        // A zero copy notification carries no payload, only the extended error.
+        uint8_t control[CMSG_SPACE(sizeof(struct sock_extended_err) + sizeof(struct sockaddr_storage))];
+        memset(control, 0, sizeof(control));
+
+        struct msghdr header;
+        memset(&header, 0, sizeof(header));
+        header.msg_control = control;
+        header.msg_controllen = sizeof(control);
+
+        ssize_t res;
+        while ((res = recvmsg(fd, &header, MSG_ERRQUEUE | MSG_DONTWAIT)) < 0 && errno == EINTR);
+        if (res == -1)
+        {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+            {
+                break;
+            }
+
+            return *completionCount > 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+
+        for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&header); cmsg != NULL; cmsg = GET_CMSG_NXTHDR(&header, cmsg))
+        {
+            if (!((cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) ||
+                  (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR)))
+            {
+                continue;
+            }
+
+            struct sock_extended_err* e = (struct sock_extended_err*)CMSG_DATA(cmsg);
+            if (e->ee_errno != 0 || e->ee_origin != SO_EE_ORIGIN_ZEROCOPY)
+            {
+                continue;
+            }
+
+            ZeroCopyCompletion* completion = &completions[*completionCount];
+            completion->RangeStart = e->ee_info;
+            completion->RangeEnd = e->ee_data;
+            completion->Copied = (e->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0;
+            completion->Padding = 0;
+            (*completionCount)++;
+            break;
+        }
+    }
+
+    return Error_SUCCESS;
+#else
+    (void)socket;
+    return Error_ENOTSUP;
+#endif
+}
+
+static void UpdateMessageHeaderFromMsghdr(MessageHeader* messageHeader, const struct msghdr* header)
+{
+    assert(header->msg_name == messageHeader->SocketAddress); // should still be the same location as set in ConvertMessageHeaderToMsghdr
+    assert(header->msg_control == messageHeader->ControlBuffer);
+
+    assert((int32_t)header->msg_namelen <= messageHeader->SocketAddressLen);
+    messageHeader->SocketAddressLen = Min((int32_t)header->msg_namelen, messageHeader->SocketAddressLen);
+
+    assert(header->msg_controllen <= (size_t)messageHeader->ControlBufferLen);
+    messageHeader->ControlBufferLen = Min((int32_t)header->msg_controllen, messageHeader->ControlBufferLen);
+
+    messageHeader->Flags = ConvertSocketFlagsPlatformToPal(header->msg_flags);
+}
+
+static bool AreMessageHeadersValid(const MessageHeader* messageHeaders, int32_t count)
+{
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (messageHeaders[i].SocketAddressLen < 0 || messageHeaders[i].ControlBufferLen < 0 || messageHeaders[i].IOVectorCount < 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// recvmmsg/sendmmsg are called with at most this many messages, callers loop for more.
+#define MAX_BATCHED_MESSAGES 64
+
 int32_t SystemNative_ReceiveMessage(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* received)
 {
     if (messageHeader == NULL || received == NULL || messageHeader->SocketAddressLen < 0 ||
@@ -1472,16 +1680,7 @@ int32_t SystemNative_ReceiveMessage(intptr_t socket, MessageHeader* messageHeade
     ssize_t res;
     while ((res = recvmsg(fd, &header, socketFlags)) < 0 && errno == EINTR);
 
-    assert(header.msg_name == messageHeader->SocketAddress); // should still be the same location as set in ConvertMessageHeaderToMsghdr
-    assert(header.msg_control == messageHeader->ControlBuffer);
-
-    assert((int32_t)header.msg_namelen <= messageHeader->SocketAddressLen);
-    messageHeader->SocketAddressLen = Min((int32_t)header.msg_namelen, messageHeader->SocketAddressLen);
-
-    assert(header.msg_controllen <= (size_t)messageHeader->ControlBufferLen);
-    messageHeader->ControlBufferLen = Min((int32_t)header.msg_controllen, messageHeader->ControlBufferLen);
-
-    messageHeader->Flags = ConvertSocketFlagsPlatformToPal(header.msg_flags);
+    UpdateMessageHeaderFromMsghdr(messageHeader, &header);
 
     if (res != -1)
     {
@@ -1493,6 +1692,79 @@ int32_t SystemNative_ReceiveMessage(intptr_t socket, MessageHeader* messageHeade
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+int32_t SystemNative_ReceiveMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* received, int32_t count, int32_t flags, int32_t* messagesReceived)
+{
+    if (messageHeaders == NULL || received == NULL || messagesReceived == NULL || count <= 0 ||
+        !AreMessageHeadersValid(messageHeaders, count))
+    {
+        return Error_EFAULT;
+    }
+
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    count = Min(count, MAX_BATCHED_MESSAGES);
+
+#if HAVE_RECVMMSG
+    struct mmsghdr headers[MAX_BATCHED_MESSAGES];
+    memset(headers, 0, (size_t)count * sizeof(struct mmsghdr));
+    for (int32_t i = 0; i < count; i++)
+    {
+        ConvertMessageHeaderToMsghdr(&headers[i].msg_hdr, &messageHeaders[i], fd);
+    }
+
+    int res;
+    while ((res = recvmmsg(fd, headers, (unsigned int)count, socketFlags, NULL)) < 0 && errno == EINTR);
+    if (res == -1)
+    {
+        *messagesReceived = 0;
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (int32_t i = 0; i < res; i++)
+    {
+        UpdateMessageHeaderFromMsghdr(&messageHeaders[i], &headers[i].msg_hdr);
+        received[i] = headers[i].msg_len;
+    }
+
+    *messagesReceived = res;
+    return Error_SUCCESS;
+#else
+    // Receive one message at a time, an error after the first message just ends the batch.
+    int32_t i = 0;
+    for (; i < count; i++)
+    {
+        struct msghdr header;
+        ConvertMessageHeaderToMsghdr(&header, &messageHeaders[i], fd);
+
+        ssize_t res;
+        while ((res = recvmsg(fd, &header, socketFlags)) < 0 && errno == EINTR);
+        if (res == -1)
+        {
+            if (i == 0)
+            {
+                *messagesReceived = 0;
+                return SystemNative_ConvertErrorPlatformToPal(errno);
+            }
+
+            break;
+        }
+
+        UpdateMessageHeaderFromMsghdr(&messageHeaders[i], &header);
+        received[i] = res;
+    }
+
+    *messagesReceived = i;
+    return Error_SUCCESS;
+#endif
+}
+
 int32_t SystemNative_Send(intptr_t socket, void* buffer, int32_t bufferLen, int32_t flags, int32_t* sent)
 {
     if (buffer == NULL || bufferLen < 0 || sent == NULL)
@@ -1567,6 +1839,77 @@ int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader,
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+int32_t SystemNative_SendMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* sent, int32_t count, int32_t flags, int32_t* messagesSent)
+{
+    if (messageHeaders == NULL || sent == NULL || messagesSent == NULL || count <= 0 ||
+        !AreMessageHeadersValid(messageHeaders, count))
+    {
+        return Error_EFAULT;
+    }
+
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    count = Min(count, MAX_BATCHED_MESSAGES);
+
+#if HAVE_SENDMMSG
+    struct mmsghdr headers[MAX_BATCHED_MESSAGES];
+    memset(headers, 0, (size_t)count * sizeof(struct mmsghdr));
+    for (int32_t i = 0; i < count; i++)
+    {
+        ConvertMessageHeaderToMsghdr(&headers[i].msg_hdr, &messageHeaders[i], fd);
+    }
+
+    int res;
+    while ((res = sendmmsg(fd, headers, (unsigned int)count, socketFlags)) < 0 && errno == EINTR);
+    if (res == -1)
+    {
+        *messagesSent = 0;
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (int32_t i = 0; i < res; i++)
+    {
+        sent[i] = headers[i].msg_len;
+    }
+
+    *messagesSent = res;
+    return Error_SUCCESS;
+#else
+    // Send one message at a time, an error after the first message just ends the batch.
+    int32_t i = 0;
+    for (; i < count; i++)
+    {
+        struct msghdr header;
+        ConvertMessageHeaderToMsghdr(&header, &messageHeaders[i], fd);
+
+        ssize_t res;
+        while ((res = sendmsg(fd, &header, socketFlags)) < 0 && errno == EINTR);
+        if (res == -1)
+        {
+            if (i == 0)
+            {
+                *messagesSent = 0;
+                return SystemNative_ConvertErrorPlatformToPal(errno);
+            }
+
+            break;
+        }
+
+        sent[i] = res;
+    }
+
+    *messagesSent = i;
+    return Error_SUCCESS;
+#endif
+}
+
 int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket)
 {
     if (socketAddress == NULL || socketAddressLen == NULL || acceptedSocket == NULL || *socketAddressLen < 0)
@@ -2641,6 +2984,34 @@ int32_t SystemNative_Socket(int32_t addressFamily, int32_t socketType, int32_t p
     return Error_SUCCESS;
 }
 
+int32_t SystemNative_GetSocketIncomingCpu(intptr_t socket, int32_t* cpu)
+{
+    if (cpu == NULL)
+    {
+        return Error_EFAULT;
+    }
+
+#ifdef SO_INCOMING_CPU
+    // The CPU that processed the socket's incoming packets, registering an accepted socket with the
+    // engine shard pinned to that CPU keeps all the work for the connection on one core.
+    int fd = ToFileDescriptor(socket);
+    int value;
+    socklen_t valueLen = sizeof(value);
+    if (getsockopt(fd, SOL_SOCKET, SO_INCOMING_CPU, &value, &valueLen) != 0)
+    {
+        *cpu = -1;
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    *cpu = value;
+    return Error_SUCCESS;
+#else
+    (void)socket;
+    *cpu = -1;
+    return Error_ENOTSUP;
+#endif
+}
+
 int32_t SystemNative_GetSocketType(intptr_t socket, int32_t* addressFamily, int32_t* socketType, int32_t* protocolType, int32_t* isListening)
 {
     if (addressFamily == NULL || socketType == NULL || protocolType == NULL || isListening == NULL)
@@ -2782,54 +3153,557 @@ static uint32_t GetEPollEvents(SocketEvents events)
            (((events & SocketEvents_SA_ERROR) != 0) ? EPOLLERR : 0);
 }
 
-static int32_t CreateSocketEventPortInner(int32_t* port)
+#if HAVE_LINUX_IO_URING_H
+
+// An alternative to epoll for the socket event port, opted into with DOTNET_SYSTEM_NET_SOCKETS_IO_URING=1.
+//
+// Sockets are registered with multishot IORING_OP_POLL_ADD requests, which behave like edge triggered
+// epoll registrations: a completion is posted for every wakeup on the socket until the poll is removed.
+// Registration changes made on the event thread are batched into a single io_uring_enter, and a wait
+// reaps every completion that is already in the completion ring without any syscall at all.
+//
+// The managed socket engine consumes readiness notifications, so completion based operations
+// (multishot accept/recv into provided buffer rings) can only build on top of this once the managed
+// side posts its receives to the port instead of calling SystemNative_Receive.
+
+// Every registration is identified by its socket and a generation that is bumped when the registration
+// changes, so that completions from a poll that has already been removed can be recognized and dropped.
+#define IO_URING_USER_DATA(socket, generation) (((uint64_t)(uint32_t)(socket) << 32) | (uint32_t)(generation))
+#define IO_URING_USER_DATA_SOCKET(userData) ((int32_t)((userData) >> 32))
+#define IO_URING_USER_DATA_GENERATION(userData) ((uint32_t)(userData))
+
+// user_data of requests whose completions are of no interest, like poll removals.
+#define IO_URING_IGNORED_USER_DATA UINT64_MAX
+
+#define IO_URING_SUBMISSION_ENTRIES 1024
+#define IO_URING_COMPLETION_ENTRIES 16384
+
+typedef struct IoUringRegistration
 {
-    assert(port != NULL);
+    uintptr_t data;
+    uint32_t pollEvents;
+    uint32_t generation;
+    bool armed;
+} IoUringRegistration;
 
-    int epollFd = epoll_create1(EPOLL_CLOEXEC);
-    if (epollFd == -1)
-    {
-        *port = -1;
-        return SystemNative_ConvertErrorPlatformToPal(errno);
-    }
+typedef struct IoUringPort
+{
+    struct IoUringPort* next;
+    IoUring ring;
 
-    *port = epollFd;
-    return Error_SUCCESS;
-}
+    // Guarded by g_ioUringPortsLock. The list of ports holds one reference, and every lookup holds one
+    // until it is done with the port, so that closing the port can't free it underneath them.
+    int32_t refCount;
 
-static int32_t CloseSocketEventPortInner(int32_t port)
+    // Serializes submissions and access to the registrations.
+    pthread_mutex_t lock;
+
+    IoUringRegistration* registrations;
+    int32_t registrationCount;
+} IoUringPort;
+
+static pthread_mutex_t g_ioUringPortsLock = PTHREAD_MUTEX_INITIALIZER;
+static IoUringPort* g_ioUringPorts = NULL;
+
+// Lets the epoll paths skip the port lookup entirely while no io_uring port exists.
+static volatile int32_t g_ioUringPortCount = 0;
+
+static void ConvertEventEPollToSocketAsync(SocketEvent* sae, struct epoll_event* epoll);
+
+static bool IsIoUringRequested(void)
 {
-    int err = close(port);
-    return err == 0 || (err < 0 && errno == EINTR) ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+    const char* value = getenv("DOTNET_SYSTEM_NET_SOCKETS_IO_URING");
+    return value != NULL && strcmp(value, "1") == 0;
 }
 
-static int32_t TryChangeSocketEventRegistrationInner(
-    int32_t port, int32_t socket, SocketEvents currentEvents, SocketEvents newEvents, uintptr_t data)
+static void FreeIoUringPort(IoUringPort* port);
+
+// Returns the port with a reference that must be dropped with ReleaseIoUringPort, or NULL if the
+// port is an epoll port.
+static IoUringPort* AcquireIoUringPort(int32_t port)
 {
-    assert(currentEvents != newEvents);
+    if (g_ioUringPortCount == 0)
+    {
+        return NULL;
+    }
 
-    int op = EPOLL_CTL_MOD;
-    if (currentEvents == SocketEvents_SA_NONE)
+    pthread_mutex_lock(&g_ioUringPortsLock);
+    IoUringPort* current = g_ioUringPorts;
+    while (current != NULL && current->ring.fd != port)
     {
-        op = EPOLL_CTL_ADD;
+        current = current->next;
     }
-    else if (newEvents == SocketEvents_SA_NONE)
+
+    if (current != NULL)
     {
-        op = EPOLL_CTL_DEL;
+        current->refCount++;
     }
+    pthread_mutex_unlock(&g_ioUringPortsLock);
 
-    struct epoll_event evt;
-    memset(&evt, 0, sizeof(struct epoll_event));
-    evt.events = GetEPollEvents(newEvents) | (unsigned int)EPOLLET;
-    evt.data.ptr = (void*)data;
-    int err = epoll_ctl(port, op, socket, &evt);
-    return err == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+    return current;
 }
 
-static void ConvertEventEPollToSocketAsync(SocketEvent* sae, struct epoll_event* epoll)
+static void ReleaseIoUringPort(IoUringPort* port)
 {
-    assert(sae != NULL);
-    assert(epoll != NULL);
+    pthread_mutex_lock(&g_ioUringPortsLock);
+    bool lastReference = --port->refCount == 0;
+    pthread_mutex_unlock(&g_ioUringPortsLock);
+
+    if (lastReference)
+    {
+        FreeIoUringPort(port);
+    }
+}
+
+static int32_t QueueIoUringPoll(IoUring* ring, uint8_t opcode, int32_t fd, uint64_t addr, uint32_t pollEvents, uint32_t len, uint64_t userData)
+{
+    struct io_uring_sqe sqe;
+    memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = opcode;
+    sqe.fd = fd;
+    sqe.addr = addr;
+    sqe.poll32_events = pollEvents;
+    sqe.len = len;
+    sqe.user_data = userData;
+
+    return IoUringQueue(ring, &sqe);
+}
+
+// Must be called with the port lock held.
+static int32_t QueueIoUringPollAdd(IoUringPort* port, int32_t socket, IoUringRegistration* registration)
+{
+    return QueueIoUringPoll(&port->ring,
+                            IORING_OP_POLL_ADD,
+                            socket,
+                            0,
+                            registration->pollEvents,
+                            IORING_POLL_ADD_MULTI,
+                            IO_URING_USER_DATA(socket, registration->generation));
+}
+
+// Must be called with the port lock held.
+static int32_t QueueIoUringPollRemove(IoUringPort* port, int32_t socket, IoUringRegistration* registration)
+{
+    return QueueIoUringPoll(&port->ring,
+                            IORING_OP_POLL_REMOVE,
+                            -1,
+                            IO_URING_USER_DATA(socket, registration->generation),
+                            0,
+                            0,
+                            IO_URING_IGNORED_USER_DATA);
+}
+
+static void FreeIoUringPort(IoUringPort* port)
+{
+    IoUringDestroy(&port->ring);
+    pthread_mutex_destroy(&port->lock);
+    free(port->registrations);
+    free(port);
+}
+
+// Multishot polls need Linux 5.13. Older kernels reject the flag, so check for that once up front
+// by arming a multishot poll on an eventfd and removing it again.
+static bool IoUringSupportsMultishotPoll(IoUring* ring)
+{
+    int eventFd = eventfd(0, EFD_CLOEXEC);
+    if (eventFd == -1)
+    {
+        return false;
+    }
+
+    const uint64_t ProbeUserData = IO_URING_USER_DATA(eventFd, 0);
+
+    bool supported = false;
+    if (QueueIoUringPoll(ring, IORING_OP_POLL_ADD, eventFd, 0, POLLIN, IORING_POLL_ADD_MULTI, ProbeUserData) == Error_SUCCESS &&
+        QueueIoUringPoll(ring, IORING_OP_POLL_REMOVE, -1, ProbeUserData, 0, 0, IO_URING_IGNORED_USER_DATA) == Error_SUCCESS &&
+        IoUringSubmit(ring) == Error_SUCCESS)
+    {
+        // Both requests complete right away, either the poll fails to prepare or it gets cancelled.
+        uint32_t seen = 0;
+        while (seen < 2)
+        {
+            uint32_t head = IoUringGetCompletionHead(ring);
+            struct io_uring_cqe* cqe = IoUringPeekCompletion(ring, head);
+            if (cqe == NULL)
+            {
+                if (IoUringWaitForCompletion(ring) != Error_SUCCESS)
+                {
+                    break;
+                }
+
+                continue;
+            }
+
+            if (cqe->user_data == ProbeUserData)
+            {
+                supported = cqe->res != -EINVAL;
+            }
+
+            IoUringSetCompletionHead(ring, head + 1);
+            seen++;
+        }
+    }
+
+    close(eventFd);
+    return supported;
+}
+
+static int32_t TryCreateIoUringPort(int32_t* portFd)
+{
+    IoUringPort* port = (IoUringPort*)calloc(1, sizeof(IoUringPort));
+    if (port == NULL)
+    {
+        return Error_ENOMEM;
+    }
+
+    pthread_mutex_init(&port->lock, NULL);
+
+    int32_t error = IoUringInitialize(&port->ring, IO_URING_SUBMISSION_ENTRIES, IO_URING_COMPLETION_ENTRIES);
+    if (error != Error_SUCCESS)
+    {
+        FreeIoUringPort(port);
+        return error;
+    }
+
+    if (!IoUringSupportsMultishotPoll(&port->ring))
+    {
+        FreeIoUringPort(port);
+        return Error_ENOTSUP;
+    }
+
+    pthread_mutex_lock(&g_ioUringPortsLock);
+    port->refCount = 1;
+    port->next = g_ioUringPorts;
+    g_ioUringPorts = port;
+    g_ioUringPortCount++;
+    pthread_mutex_unlock(&g_ioUringPortsLock);
+
+    *portFd = port->ring.fd;
+    return Error_SUCCESS;
+}
+
+static bool TryCloseIoUringPort(int32_t portFd)
+{
+    if (g_ioUringPortCount == 0)
+    {
+        return false;
+    }
+
+    IoUringPort* port = NULL;
+
+    pthread_mutex_lock(&g_ioUringPortsLock);
+    for (IoUringPort** link = &g_ioUringPorts; *link != NULL; link = &(*link)->next)
+    {
+        if ((*link)->ring.fd == portFd)
+        {
+            port = *link;
+            *link = port->next;
+            g_ioUringPortCount--;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&g_ioUringPortsLock);
+
+    if (port == NULL)
+    {
+        return false;
+    }
+
+    // A thread still using the port, e.g. waiting for events on it, frees it once it is done.
+    ReleaseIoUringPort(port);
+    return true;
+}
+
+void RemoveSocketFromIoUringPorts(int32_t socket)
+{
+    if (g_ioUringPortCount == 0 || socket < 0)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&g_ioUringPortsLock);
+    for (IoUringPort* port = g_ioUringPorts; port != NULL; port = port->next)
+    {
+        pthread_mutex_lock(&port->lock);
+
+        if (socket < port->registrationCount)
+        {
+            IoUringRegistration* registration = &port->registrations[socket];
+            if (registration->armed)
+            {
+                // The poll is cancelled inline by the submission, which drops its reference to the file.
+                if (QueueIoUringPollRemove(port, socket, registration) == Error_SUCCESS)
+                {
+                    IoUringSubmit(&port->ring);
+                }
+
+                registration->armed = false;
+                registration->generation++;
+            }
+        }
+
+        pthread_mutex_unlock(&port->lock);
+    }
+    pthread_mutex_unlock(&g_ioUringPortsLock);
+}
+
+static int32_t TryChangeIoUringRegistration(IoUringPort* port, int32_t socket, SocketEvents newEvents, uintptr_t data)
+{
+    if (socket < 0)
+    {
+        return Error_EBADF;
+    }
+
+    pthread_mutex_lock(&port->lock);
+
+    int32_t error = Error_SUCCESS;
+    if (socket >= port->registrationCount)
+    {
+        int32_t newCount = port->registrationCount == 0 ? 1024 : port->registrationCount;
+        while (newCount <= socket)
+        {
+            newCount *= 2;
+        }
+
+        IoUringRegistration* registrations = (IoUringRegistration*)realloc(port->registrations, (size_t)newCount * sizeof(IoUringRegistration));
+        if (registrations == NULL)
+        {
+            pthread_mutex_unlock(&port->lock);
+            return Error_ENOMEM;
+        }
+
+        memset(&registrations[port->registrationCount], 0, (size_t)(newCount - port->registrationCount) * sizeof(IoUringRegistration));
+        port->registrations = registrations;
+        port->registrationCount = newCount;
+    }
+
+    IoUringRegistration* registration = &port->registrations[socket];
+    if (registration->armed)
+    {
+        error = QueueIoUringPollRemove(port, socket, registration);
+        registration->armed = false;
+    }
+
+    // Completions still in flight for the old registration are dropped from here on.
+    registration->generation++;
+
+    if (error == Error_SUCCESS && newEvents != SocketEvents_SA_NONE)
+    {
+        registration->data = data;
+        registration->pollEvents = GetEPollEvents(newEvents);
+        error = QueueIoUringPollAdd(port, socket, registration);
+        registration->armed = error == Error_SUCCESS;
+    }
+
+    if (error == Error_SUCCESS)
+    {
+        error = IoUringSubmit(&port->ring);
+    }
+
+    pthread_mutex_unlock(&port->lock);
+    return error;
+}
+
+static int32_t WaitForIoUringEvents(IoUringPort* port, SocketEvent* buffer, int32_t* count)
+{
+    int32_t numEvents = 0;
+    int32_t error = Error_SUCCESS;
+
+    while (numEvents == 0)
+    {
+        uint32_t head = IoUringGetCompletionHead(&port->ring);
+        if (IoUringPeekCompletion(&port->ring, head) == NULL)
+        {
+            error = IoUringWaitForCompletion(&port->ring);
+            if (error != Error_SUCCESS)
+            {
+                *count = 0;
+                return error;
+            }
+
+            continue;
+        }
+
+        pthread_mutex_lock(&port->lock);
+
+        struct io_uring_cqe* cqe;
+        for (; numEvents < *count && (cqe = IoUringPeekCompletion(&port->ring, head)) != NULL; head++)
+        {
+            if (cqe->user_data == IO_URING_IGNORED_USER_DATA)
+            {
+                continue;
+            }
+
+            int32_t socket = IO_URING_USER_DATA_SOCKET(cqe->user_data);
+            if (socket >= port->registrationCount)
+            {
+                continue;
+            }
+
+            IoUringRegistration* registration = &port->registrations[socket];
+            if (!registration->armed || registration->generation != IO_URING_USER_DATA_GENERATION(cqe->user_data))
+            {
+                continue;
+            }
+
+            struct epoll_event evt;
+            memset(&evt, 0, sizeof(struct epoll_event));
+            evt.data.ptr = (void*)registration->data;
+
+            if (cqe->res >= 0)
+            {
+                evt.events = (uint32_t)cqe->res;
+            }
+            else
+            {
+                // The poll itself failed, e.g. because the socket was closed underneath it.
+                evt.events = EPOLLERR;
+                registration->armed = false;
+            }
+
+            // The kernel ends a multishot poll when it can't post a completion, re-arm it.
+            if (registration->armed && (cqe->flags & IORING_CQE_F_MORE) == 0)
+            {
+                registration->generation++;
+                if (error == Error_SUCCESS)
+                {
+                    error = QueueIoUringPollAdd(port, socket, registration);
+                }
+            }
+
+            ConvertEventEPollToSocketAsync(&buffer[numEvents], &evt);
+            numEvents++;
+        }
+
+        IoUringSetCompletionHead(&port->ring, head);
+
+        // All the re-arms from this batch go out with a single io_uring_enter.
+        if (error == Error_SUCCESS)
+        {
+            error = IoUringSubmit(&port->ring);
+        }
+
+        pthread_mutex_unlock(&port->lock);
+
+        if (error != Error_SUCCESS && numEvents == 0)
+        {
+            *count = 0;
+            return error;
+        }
+    }
+
+    *count = numEvents;
+    return Error_SUCCESS;
+}
+
+#endif // HAVE_LINUX_IO_URING_H
+
+static int32_t CreateSocketEventPortInner(int32_t* port)
+{
+    assert(port != NULL);
+
+#if HAVE_LINUX_IO_URING_H
+    // Fall back to epoll if io_uring isn't available, e.g. on older kernels or where it is blocked by seccomp.
+    if (IsIoUringRequested() && TryCreateIoUringPort(port) == Error_SUCCESS)
+    {
+        return Error_SUCCESS;
+    }
+#endif
+
+    int epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd == -1)
+    {
+        *port = -1;
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    *port = epollFd;
+    return Error_SUCCESS;
+}
+
+static int32_t CloseSocketEventPortInner(int32_t port)
+{
+#if HAVE_LINUX_IO_URING_H
+    if (TryCloseIoUringPort(port))
+    {
+        return Error_SUCCESS;
+    }
+#endif
+
+    int err = close(port);
+    return err == 0 || (err < 0 && errno == EINTR) ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+}
+
+static int32_t TryChangeSocketEventRegistrationInner(
+    int32_t port, int32_t socket, SocketEvents currentEvents, SocketEvents newEvents, uintptr_t data)
+{
+    assert(currentEvents != newEvents);
+
+    bool exclusive = (newEvents & SocketEvents_SA_EXCLUSIVE) != 0;
+    bool wasExclusive = (currentEvents & SocketEvents_SA_EXCLUSIVE) != 0;
+    currentEvents = (SocketEvents)(currentEvents & ~SocketEvents_SA_EXCLUSIVE);
+    newEvents = (SocketEvents)(newEvents & ~SocketEvents_SA_EXCLUSIVE);
+
+#if HAVE_LINUX_IO_URING_H
+    IoUringPort* ioUringPort = AcquireIoUringPort(port);
+    if (ioUringPort != NULL)
+    {
+        int32_t error = TryChangeIoUringRegistration(ioUringPort, socket, newEvents, data);
+        ReleaseIoUringPort(ioUringPort);
+        return error;
+    }
+#endif
+
+#ifdef EPOLLEXCLUSIVE
+    // An exclusive registration can only be made by EPOLL_CTL_ADD and can't be modified afterwards,
+    // so changing one means removing and re-adding it.
+    if ((exclusive || wasExclusive) && currentEvents != SocketEvents_SA_NONE && newEvents != SocketEvents_SA_NONE)
+    {
+        if (epoll_ctl(port, EPOLL_CTL_DEL, socket, NULL) != 0)
+        {
+            return SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+
+        currentEvents = SocketEvents_SA_NONE;
+    }
+#else
+    (void)wasExclusive;
+    exclusive = false;
+#endif
+
+    if (currentEvents == newEvents)
+    {
+        return Error_SUCCESS;
+    }
+
+    int op = EPOLL_CTL_MOD;
+    if (currentEvents == SocketEvents_SA_NONE)
+    {
+        op = EPOLL_CTL_ADD;
+    }
+    else if (newEvents == SocketEvents_SA_NONE)
+    {
+        op = EPOLL_CTL_DEL;
+    }
+
+    struct epoll_event evt;
+    memset(&evt, 0, sizeof(struct epoll_event));
+    evt.events = GetEPollEvents(newEvents) | (unsigned int)EPOLLET;
+#ifdef EPOLLEXCLUSIVE
+    if (exclusive && op == EPOLL_CTL_ADD)
+    {
+        evt.events |= (unsigned int)EPOLLEXCLUSIVE;
+    }
+#endif
+    evt.data.ptr = (void*)data;
+    int err = epoll_ctl(port, op, socket, &evt);
+    return err == 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+}
+
+static void ConvertEventEPollToSocketAsync(SocketEvent* sae, struct epoll_event* epoll)
+{
+    assert(sae != NULL);
+    assert(epoll != NULL);
 
     // epoll does not play well with disconnected connection-oriented sockets, frequently
     // reporting spurious EPOLLHUP events. Fortunately, EPOLLHUP may be handled as an
@@ -2852,6 +3726,16 @@ static int32_t WaitForSocketEventsInner(int32_t port, SocketEvent* buffer, int32
     assert(count != NULL);
     assert(*count >= 0);
 
+#if HAVE_LINUX_IO_URING_H
+    IoUringPort* ioUringPort = AcquireIoUringPort(port);
+    if (ioUringPort != NULL)
+    {
+        int32_t error = WaitForIoUringEvents(ioUringPort, buffer, count);
+        ReleaseIoUringPort(ioUringPort);
+        return error;
+    }
+#endif
+
     struct epoll_event* events = (struct epoll_event*)buffer;
     int numEvents;
     while ((numEvents = epoll_wait(port, events, *count, -1)) < 0 && errno == EINTR);
@@ -3129,7 +4013,7 @@ SystemNative_TryChangeSocketEventRegistration(intptr_t port, intptr_t socket, in
     int portFd = ToFileDescriptor(port);
     int socketFd = ToFileDescriptor(socket);
 
-    const int32_t SupportedEvents = SocketEvents_SA_READ | SocketEvents_SA_WRITE | SocketEvents_SA_READCLOSE | SocketEvents_SA_CLOSE | SocketEvents_SA_ERROR;
+    const int32_t SupportedEvents = SocketEvents_SA_READ | SocketEvents_SA_WRITE | SocketEvents_SA_READCLOSE | SocketEvents_SA_CLOSE | SocketEvents_SA_ERROR | SocketEvents_SA_EXCLUSIVE;
 
     if ((currentEvents & ~SupportedEvents) != 0 || (newEvents & ~SupportedEvents) != 0)
     {
@@ -3353,6 +4237,141 @@ error:
 #endif
 }
 
+#if defined(__linux__) && defined(SPLICE_F_MOVE)
+struct SplicePipe
+{
+    int readFd;
+    int writeFd;
+
+    // Bytes spliced into the pipe that couldn't be written to the destination yet.
+    int64_t buffered;
+};
+#endif
+
+int32_t SystemNative_CreateSplicePipe(int32_t pipeSize, SplicePipe** splicePipe)
+{
+    if (splicePipe == NULL)
+    {
+        return Error_EFAULT;
+    }
+
+    *splicePipe = NULL;
+
+#if defined(__linux__) && defined(SPLICE_F_MOVE)
+    SplicePipe* result = (SplicePipe*)calloc(1, sizeof(SplicePipe));
+    if (result == NULL)
+    {
+        return Error_ENOMEM;
+    }
+
+    int pipeFds[2];
+    int err;
+    while ((err = pipe2(pipeFds, O_CLOEXEC | O_NONBLOCK)) < 0 && errno == EINTR);
+    if (err != 0)
+    {
+        int32_t error = SystemNative_ConvertErrorPlatformToPal(errno);
+        free(result);
+        return error;
+    }
+
+    result->readFd = pipeFds[0];
+    result->writeFd = pipeFds[1];
+
+    // The pipe size bounds how much a single splice can move, the default is just 64KB. Failing to
+    // grow it, e.g. past /proc/sys/fs/pipe-max-size, only makes forwarding take more calls.
+    if (pipeSize > 0)
+    {
+        SystemNative_FcntlSetPipeSz(result->writeFd, pipeSize);
+    }
+
+    *splicePipe = result;
+    return Error_SUCCESS;
+#else
+    (void)pipeSize;
+    return Error_ENOTSUP;
+#endif
+}
+
+void SystemNative_CloseSplicePipe(SplicePipe* splicePipe)
+{
+#if defined(__linux__) && defined(SPLICE_F_MOVE)
+    if (splicePipe != NULL)
+    {
+        close(splicePipe->readFd);
+        close(splicePipe->writeFd);
+        free(splicePipe);
+    }
+#else
+    (void)splicePipe;
+#endif
+}
+
+int32_t SystemNative_Splice(SplicePipe* splicePipe, intptr_t in_fd, int64_t* offset, intptr_t out_fd, int64_t count, int64_t* sent)
+{
+    if (splicePipe == NULL || sent == NULL || count < 0)
+    {
+        return Error_EFAULT;
+    }
+
+    *sent = 0;
+
+#if defined(__linux__) && defined(SPLICE_F_MOVE)
+    int infd = ToFileDescriptor(in_fd);
+    int outfd = ToFileDescriptor(out_fd);
+    const unsigned int SpliceFlags = SPLICE_F_MOVE | SPLICE_F_NONBLOCK;
+
+    // Data moves source -> pipe -> destination without ever being copied to user space. Whatever
+    // the destination doesn't take stays in the pipe and goes out first on the next call.
+    while (*sent < count)
+    {
+        if (splicePipe->buffered == 0)
+        {
+            loff_t inOffset = offset != NULL ? (loff_t)*offset : 0;
+            ssize_t filled;
+            while ((filled = splice(infd, offset != NULL ? &inOffset : NULL, splicePipe->writeFd, NULL, (size_t)(count - *sent), SpliceFlags)) < 0 && errno == EINTR);
+            if (filled <= 0)
+            {
+                if (filled == 0 || *sent > 0)
+                {
+                    // End of the source, or it has no more data right now after we already moved some.
+                    return Error_SUCCESS;
+                }
+
+                return SystemNative_ConvertErrorPlatformToPal(errno);
+            }
+
+            if (offset != NULL)
+            {
+                *offset = inOffset;
+            }
+
+            splicePipe->buffered = filled;
+        }
+
+        ssize_t drained;
+        while ((drained = splice(splicePipe->readFd, NULL, outfd, NULL, (size_t)splicePipe->buffered, SpliceFlags)) < 0 && errno == EINTR);
+        if (drained < 0)
+        {
+            return *sent > 0 ? Error_SUCCESS : SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+
+        splicePipe->buffered -= drained;
+        *sent += drained;
+
+        if (splicePipe->buffered != 0)
+        {
+            // The destination is full, report what went out so far.
+            return Error_SUCCESS;
+        }
+    }
+
+    return Error_SUCCESS;
+#else
+    (void)in_fd, (void)offset, (void)out_fd;
+    return Error_ENOTSUP;
+#endif
+}
+
 uint32_t SystemNative_InterfaceNameToIndex(char* interfaceName)
 {
     assert(interfaceName != NULL);
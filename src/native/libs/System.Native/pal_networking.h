@@ -209,6 +209,7 @@ typedef enum
     SocketFlags_MSG_CTRUNC = 0x0200,    // SocketFlags.ControlDataTruncated
     SocketFlags_MSG_DONTWAIT = 0x1000,  // used privately by Ping
     SocketFlags_MSG_ERRQUEUE = 0x2000,  // used privately by Ping
+    SocketFlags_MSG_ZEROCOPY = 0x4000,  // used privately by zero copy sends
 } SocketFlags;
 
 /*
@@ -222,6 +223,9 @@ typedef enum
     SocketEvents_SA_READCLOSE = 0x04,
     SocketEvents_SA_CLOSE = 0x08,
     SocketEvents_SA_ERROR = 0x10,
+    // Registration only: a listen socket registered with several ports wakes just one of them per
+    // connection, so each engine shard can accept on its own port.
+    SocketEvents_SA_EXCLUSIVE = 0x20,
     // Force the enum to use int32_t instead of uint32_t
     SocketEvents__IGNORE_SIGNED = -1,
 } SocketEvents;
@@ -258,6 +262,14 @@ typedef struct
     int32_t Padding;        // Pad out to 8-byte alignment
 } IPPacketInformation;
 
+typedef struct
+{
+    uint32_t RangeStart; // First zero copy send, counted from 0 per socket, that completed
+    uint32_t RangeEnd;   // Last zero copy send that completed, inclusive
+    int32_t Copied;      // Set if the kernel copied the data after all, zero copy isn't paying off on this socket
+    int32_t Padding;     // Pad out to 8-byte alignment
+} ZeroCopyCompletion;
+
 typedef struct
 {
     uint32_t MulticastAddress; // Multicast address
@@ -339,6 +351,12 @@ PALEXPORT int32_t SystemNative_GetControlMessageBufferSize(int32_t isIPv4, int32
 
 PALEXPORT int32_t SystemNative_TryGetIPPacketInformation(MessageHeader* messageHeader, int32_t isIPv4, IPPacketInformation* packetInfo);
 
+PALEXPORT int32_t SystemNative_GetUdpSegmentationControlMessageBufferSize(int32_t isIPv4, int32_t isIPv6);
+
+PALEXPORT int32_t SystemNative_SetUdpSegmentSize(MessageHeader* messageHeader, int32_t segmentSize);
+
+PALEXPORT int32_t SystemNative_TryGetUdpGroSegmentSize(MessageHeader* messageHeader, int32_t* segmentSize);
+
 PALEXPORT int32_t SystemNative_GetIPv4MulticastOption(intptr_t socket, int32_t multicastOption, IPv4MulticastOption* option);
 
 PALEXPORT int32_t SystemNative_SetIPv4MulticastOption(intptr_t socket, int32_t multicastOption, IPv4MulticastOption* option);
@@ -359,12 +377,23 @@ PALEXPORT int32_t SystemNative_Receive(intptr_t socket, void* buffer, int32_t bu
 
 PALEXPORT int32_t SystemNative_ReceiveMessage(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* received);
 
+PALEXPORT int32_t SystemNative_ReceiveMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* received, int32_t count, int32_t flags, int32_t* messagesReceived);
+
 PALEXPORT int32_t SystemNative_ReceiveSocketError(intptr_t socket, MessageHeader* messageHeader);
 
+PALEXPORT int32_t SystemNative_EnableZeroCopySend(intptr_t socket);
+
+PALEXPORT int32_t SystemNative_ReceiveZeroCopyCompletions(
+    intptr_t socket, ZeroCopyCompletion* completions, int32_t count, int32_t* completionCount);
+
 PALEXPORT int32_t SystemNative_Send(intptr_t socket, void* buffer, int32_t bufferLen, int32_t flags, int32_t* sent);
 
 PALEXPORT int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* sent);
 
+PALEXPORT int32_t SystemNative_SendMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int64_t* sent, int32_t count, int32_t flags, int32_t* messagesSent);
+
 PALEXPORT int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket);
 
 PALEXPORT int32_t SystemNative_Bind(intptr_t socket, int32_t protocolType, uint8_t* socketAddress, int32_t socketAddressLen);
@@ -397,6 +426,8 @@ PALEXPORT int32_t SystemNative_SetRawSockOpt(
 
 PALEXPORT int32_t SystemNative_Socket(int32_t addressFamily, int32_t socketType, int32_t protocolType, intptr_t* createdSocket);
 
+PALEXPORT int32_t SystemNative_GetSocketIncomingCpu(intptr_t socket, int32_t* cpu);
+
 PALEXPORT int32_t SystemNative_GetSocketType(intptr_t socket, int32_t* addressFamily, int32_t* socketType, int32_t* protocolType, int32_t* isListening);
 
 PALEXPORT int32_t SystemNative_GetAtOutOfBandMark(intptr_t socket, int32_t* available);
@@ -424,6 +455,24 @@ PALEXPORT int32_t SystemNative_GetMaximumAddressSize(void);
 
 PALEXPORT int32_t SystemNative_SendFile(intptr_t out_fd, intptr_t in_fd, int64_t offset, int64_t count, int64_t* sent);
 
+typedef struct SplicePipe SplicePipe;
+
+/**
+ * Creates the intermediate pipe SystemNative_Splice moves data through, pipeSize is passed to
+ * SystemNative_FcntlSetPipeSz if it is positive. Returns Error_ENOTSUP where splice isn't available.
+ */
+PALEXPORT int32_t SystemNative_CreateSplicePipe(int32_t pipeSize, SplicePipe** splicePipe);
+
+PALEXPORT void SystemNative_CloseSplicePipe(SplicePipe* splicePipe);
+
+/**
+ * Moves up to count bytes from in_fd to out_fd in the kernel, for any combination of sockets, pipes and files.
+ * offset is the position to read a file at and is advanced, NULL to use the current position or for sockets.
+ * Both descriptors are expected to be non-blocking; returns with the number of bytes sent once either would block.
+ * A pipe must only be used for one direction of one connection, it may hold data between calls.
+ */
+PALEXPORT int32_t SystemNative_Splice(SplicePipe* splicePipe, intptr_t in_fd, int64_t* offset, intptr_t out_fd, int64_t count, int64_t* sent);
+
 PALEXPORT int32_t SystemNative_Disconnect(intptr_t socket);
 
 PALEXPORT uint32_t SystemNative_InterfaceNameToIndex(char* interfaceName);
@@ -20,6 +20,7 @@
 #endif
 
 #include <assert.h>
+#include <pthread.h>
 #include <string.h>
 #include <stdlib.h>
 
@@ -62,13 +63,16 @@ static gss_OID_desc gss_mech_ntlm_OID_desc = {.length = STRING_LENGTH(gss_ntlm_o
     PER_FUNCTION_BLOCK(gss_accept_sec_context) \
     PER_FUNCTION_BLOCK(gss_acquire_cred) \
     PER_FUNCTION_BLOCK(gss_acquire_cred_with_password) \
+    PER_FUNCTION_BLOCK(gss_compare_name) \
     PER_FUNCTION_BLOCK(gss_delete_sec_context) \
     PER_FUNCTION_BLOCK(gss_display_name) \
+    PER_FUNCTION_BLOCK(gss_duplicate_name) \
     PER_FUNCTION_BLOCK(gss_display_status) \
     PER_FUNCTION_BLOCK(gss_import_name) \
     PER_FUNCTION_BLOCK(gss_indicate_mechs) \
     PER_FUNCTION_BLOCK(gss_init_sec_context) \
     PER_FUNCTION_BLOCK(gss_inquire_context) \
+    PER_FUNCTION_BLOCK(gss_inquire_cred) \
     PER_FUNCTION_BLOCK(gss_mech_krb5) \
     PER_FUNCTION_BLOCK(gss_oid_equal) \
     PER_FUNCTION_BLOCK(gss_release_buffer) \
@@ -96,13 +100,16 @@ static void* volatile s_gssLib = NULL;
 #define gss_accept_sec_context(...)         gss_accept_sec_context_ptr(__VA_ARGS__)
 #define gss_acquire_cred(...)               gss_acquire_cred_ptr(__VA_ARGS__)
 #define gss_acquire_cred_with_password(...) gss_acquire_cred_with_password_ptr(__VA_ARGS__)
+#define gss_compare_name(...)               gss_compare_name_ptr(__VA_ARGS__)
 #define gss_delete_sec_context(...)         gss_delete_sec_context_ptr(__VA_ARGS__)
 #define gss_display_name(...)               gss_display_name_ptr(__VA_ARGS__)
+#define gss_duplicate_name(...)             gss_duplicate_name_ptr(__VA_ARGS__)
 #define gss_display_status(...)             gss_display_status_ptr(__VA_ARGS__)
 #define gss_import_name(...)                gss_import_name_ptr(__VA_ARGS__)
 #define gss_indicate_mechs(...)             gss_indicate_mechs_ptr(__VA_ARGS__)
 #define gss_init_sec_context(...)           gss_init_sec_context_ptr(__VA_ARGS__)
 #define gss_inquire_context(...)            gss_inquire_context_ptr(__VA_ARGS__)
+#define gss_inquire_cred(...)               gss_inquire_cred_ptr(__VA_ARGS__)
 #define gss_oid_equal(...)                  gss_oid_equal_ptr(__VA_ARGS__)
 #define gss_release_buffer(...)             gss_release_buffer_ptr(__VA_ARGS__)
 #define gss_release_cred(...)               gss_release_cred_ptr(__VA_ARGS__)
@@ -176,10 +183,154 @@ static uint32_t AcquireCredSpNego(uint32_t* minorStatus,
     return majorStatus;
 }
 
+// Initiator credentials are cached per name, so that connections authenticating as the same
+// name share one credential handle instead of each acquiring their own. An entry is only
+// released once it is no longer handed out and every connection using it released it.
+#define CRED_CACHE_SIZE 8
+// Credentials which expire sooner than this (in seconds) are not handed out again
+#define CRED_CACHE_MIN_LIFETIME 60
+
+typedef struct
+{
+    GssName* name;
+    GssCredId* credHandle;
+    int32_t refCount;
+    int32_t expired;
+} CachedCred;
+
+static CachedCred s_credCache[CRED_CACHE_SIZE];
+static pthread_mutex_t s_credCacheLock = PTHREAD_MUTEX_INITIALIZER;
+
+// The cache lock must be held.
+static void ReleaseCachedCred(CachedCred* entry)
+{
+    uint32_t minorStatus;
+
+    assert(entry->refCount == 0);
+
+    gss_release_cred(&minorStatus, &entry->credHandle);
+    gss_release_name(&minorStatus, &entry->name);
+    memset(entry, 0, sizeof(*entry));
+}
+
+static GssCredId* GetCachedCred(GssName* desiredName)
+{
+    GssCredId* credHandle = NULL;
+
+    pthread_mutex_lock(&s_credCacheLock);
+    for (int32_t i = 0; i < CRED_CACHE_SIZE; i++)
+    {
+        CachedCred* entry = &s_credCache[i];
+        uint32_t minorStatus;
+        int nameEqual = 0;
+        OM_uint32 lifetime = 0;
+
+        if (entry->name == NULL || entry->expired ||
+            gss_compare_name(&minorStatus, entry->name, desiredName, &nameEqual) != GSS_S_COMPLETE || !nameEqual)
+        {
+            continue;
+        }
+
+        if (gss_inquire_cred(&minorStatus, entry->credHandle, NULL, &lifetime, NULL, NULL) == GSS_S_COMPLETE &&
+            (lifetime == GSS_C_INDEFINITE || lifetime >= CRED_CACHE_MIN_LIFETIME))
+        {
+            entry->refCount++;
+            credHandle = entry->credHandle;
+            break;
+        }
+
+        entry->expired = 1;
+        if (entry->refCount == 0)
+        {
+            ReleaseCachedCred(entry);
+        }
+    }
+    pthread_mutex_unlock(&s_credCacheLock);
+
+    return credHandle;
+}
+
+static void AddCachedCred(GssName* desiredName, GssCredId* credHandle)
+{
+    pthread_mutex_lock(&s_credCacheLock);
+    CachedCred* slot = NULL;
+    for (int32_t i = 0; i < CRED_CACHE_SIZE && (slot == NULL || slot->name != NULL); i++)
+    {
+        if (s_credCache[i].name == NULL || s_credCache[i].refCount == 0)
+        {
+            slot = &s_credCache[i];
+        }
+    }
+
+    // When all entries are in use the credential isn't cached, it is released like any other
+    uint32_t minorStatus;
+    if (slot != NULL)
+    {
+        if (slot->name != NULL)
+        {
+            ReleaseCachedCred(slot);
+        }
+
+        if (gss_duplicate_name(&minorStatus, desiredName, &slot->name) == GSS_S_COMPLETE)
+        {
+            slot->credHandle = credHandle;
+            slot->refCount = 1;
+        }
+        else
+        {
+            slot->name = NULL;
+        }
+    }
+    pthread_mutex_unlock(&s_credCacheLock);
+}
+
+static int32_t TryReleaseCachedCred(GssCredId* credHandle)
+{
+    int32_t found = 0;
+
+    pthread_mutex_lock(&s_credCacheLock);
+    for (int32_t i = 0; i < CRED_CACHE_SIZE; i++)
+    {
+        CachedCred* entry = &s_credCache[i];
+        if (entry->name != NULL && entry->credHandle == credHandle)
+        {
+            assert(entry->refCount > 0);
+            if (--entry->refCount == 0 && entry->expired)
+            {
+                ReleaseCachedCred(entry);
+            }
+
+            found = 1;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&s_credCacheLock);
+
+    return found;
+}
+
 uint32_t
 NetSecurityNative_InitiateCredSpNego(uint32_t* minorStatus, GssName* desiredName, GssCredId** outputCredHandle)
 {
-    return AcquireCredSpNego(minorStatus, desiredName, GSS_C_INITIATE, outputCredHandle);
+    assert(minorStatus != NULL);
+    assert(desiredName != NULL);
+    assert(outputCredHandle != NULL);
+
+    GssCredId* credHandle = GetCachedCred(desiredName);
+    if (credHandle != NULL)
+    {
+        *minorStatus = 0;
+        *outputCredHandle = credHandle;
+        return GSS_S_COMPLETE;
+    }
+
+    uint32_t majorStatus = AcquireCredSpNego(minorStatus, desiredName, GSS_C_INITIATE, outputCredHandle);
+    if (majorStatus == GSS_S_COMPLETE)
+    {
+        AddCachedCred(desiredName, *outputCredHandle);
+    }
+
+    return majorStatus;
 }
 
 uint32_t NetSecurityNative_DeleteSecContext(uint32_t* minorStatus, GssCtxId** contextHandle)
@@ -486,6 +637,13 @@ uint32_t NetSecurityNative_ReleaseCred(uint32_t* minorStatus, GssCredId** credHa
     assert(minorStatus != NULL);
     assert(credHandle != NULL);
 
+    if (*credHandle != NULL && TryReleaseCachedCred(*credHandle))
+    {
+        *minorStatus = 0;
+        *credHandle = NULL;
+        return GSS_S_COMPLETE;
+    }
+
     return gss_release_cred(minorStatus, credHandle);
 }
 
@@ -3,6 +3,8 @@
 
 #include "pal_evp.h"
 
+#include <stdatomic.h>
+
 // just some unique IDs
 intptr_t CryptoNative_EvpMd5(void)    { return 101; }
 intptr_t CryptoNative_EvpSha1(void)   { return 102; }
@@ -26,7 +28,13 @@ int32_t CryptoNative_GetMaxMdSize(void)
     return EVP_MAX_MD_SIZE;
 }
 
-static jobject GetMessageDigestInstance(JNIEnv* env, intptr_t type)
+// One unused MessageDigest per algorithm, cloning it is much cheaper than
+// the provider lookup done by MessageDigest.getInstance
+#define MD_TYPE_FIRST 101
+#define MD_TYPE_COUNT 5
+static _Atomic(jobject) g_mdPrototypes[MD_TYPE_COUNT];
+
+static jobject GetMessageDigestInstanceSlow(JNIEnv* env, intptr_t type)
 {
     jobject mdName = NULL;
     if (type == CryptoNative_EvpSha1())
@@ -48,6 +56,53 @@ static jobject GetMessageDigestInstance(JNIEnv* env, intptr_t type)
     return CheckJNIExceptions(env) ? FAIL : mdObj;
 }
 
+static jobject GetMessageDigestInstance(JNIEnv* env, intptr_t type)
+{
+    intptr_t index = type - MD_TYPE_FIRST;
+    if (index < 0 || index >= MD_TYPE_COUNT)
+        return NULL;
+
+    jobject prototype = atomic_load_explicit(&g_mdPrototypes[index], memory_order_acquire);
+    if (!prototype)
+    {
+        prototype = ToGRef(env, GetMessageDigestInstanceSlow(env, type));
+        if (!prototype)
+            return NULL;
+
+        jobject expected = NULL;
+        if (!atomic_compare_exchange_strong_explicit(&g_mdPrototypes[index], &expected, prototype, memory_order_acq_rel, memory_order_acquire))
+        {
+            // Another thread was faster, use its instance
+            ReleaseGRef(env, prototype);
+            prototype = expected;
+        }
+    }
+
+    // The prototype is never updated, so it can be cloned from multiple threads
+    jobject mdObj = (*env)->CallObjectMethod(env, prototype, g_mdClone);
+    if (TryClearJNIExceptions(env))
+    {
+        // The provider doesn't support cloning
+        return GetMessageDigestInstanceSlow(env, type);
+    }
+
+    return mdObj;
+}
+
+static int32_t DigestFinal(JNIEnv* env, jobject ctx, uint8_t* md, uint32_t* s)
+{
+    abort_if_invalid_pointer_argument (md);
+
+    // ctx.digest();
+    jbyteArray bytes = (jbyteArray)(*env)->CallObjectMethod(env, ctx, g_mdDigest);
+    abort_unless(bytes != NULL, "digest() was not expected to return null");
+    jsize bytesLen = (*env)->GetArrayLength(env, bytes);
+    *s = (uint32_t)bytesLen;
+    (*env)->GetByteArrayRegion(env, bytes, 0, bytesLen, (jbyte*) md);
+    (*env)->DeleteLocalRef(env, bytes);
+    return CheckJNIExceptions(env) ? FAIL : SUCCESS;
+}
+
 int32_t CryptoNative_EvpDigestOneShot(intptr_t type, void* source, int32_t sourceSize, uint8_t* md, uint32_t* mdSize)
 {
     if (!type || !md || !mdSize || sourceSize < 0 || (sourceSize > 0 && !source))
@@ -59,20 +114,25 @@ int32_t CryptoNative_EvpDigestOneShot(intptr_t type, void* source, int32_t sourc
     if (!mdObj)
         return FAIL;
 
-    jbyteArray bytes = make_java_byte_array(env, sourceSize);
-    (*env)->SetByteArrayRegion(env, bytes, 0, sourceSize, (jbyte*) source);
-    jbyteArray hashedBytes = (jbyteArray)(*env)->CallObjectMethod(env, mdObj, g_mdDigestWithInputBytes, bytes);
-    abort_unless(hashedBytes != NULL, "MessageDigest.digest(...) was not expected to return null");
+    int32_t ret = FAIL;
 
-    jsize hashedBytesLen = (*env)->GetArrayLength(env, hashedBytes);
-    (*env)->GetByteArrayRegion(env, hashedBytes, 0, hashedBytesLen, (jbyte*) md);
-    *mdSize = (uint32_t)hashedBytesLen;
+    // Hash the source in place instead of copying it into a Java array first
+    if (sourceSize > 0)
+    {
+        jobject sourceBuffer = (*env)->NewDirectByteBuffer(env, source, sourceSize);
+        if (sourceBuffer == NULL)
+            goto cleanup;
 
-    (*env)->DeleteLocalRef(env, bytes);
-    (*env)->DeleteLocalRef(env, hashedBytes);
-    (*env)->DeleteLocalRef(env, mdObj);
+        (*env)->CallVoidMethod(env, mdObj, g_mdUpdateWithByteBuffer, sourceBuffer);
+        (*env)->DeleteLocalRef(env, sourceBuffer);
+        ON_EXCEPTION_PRINT_AND_GOTO(cleanup);
+    }
 
-    return CheckJNIExceptions(env) ? FAIL : SUCCESS;
+    ret = DigestFinal(env, mdObj, md, mdSize);
+
+cleanup:
+    (*env)->DeleteLocalRef(env, mdObj);
+    return ret;
 }
 
 jobject CryptoNative_EvpMdCtxCreate(intptr_t type)
@@ -110,27 +170,19 @@ int32_t CryptoNative_EvpDigestUpdate(jobject ctx, void* d, int32_t cnt)
     abort_if_invalid_pointer_argument (ctx);
     if(cnt > 0)
         abort_if_invalid_pointer_argument (d);
-    JNIEnv* env = GetJNIEnv();
+    if (cnt <= 0)
+        return SUCCESS;
 
-    jbyteArray bytes = make_java_byte_array(env, cnt);
-    (*env)->SetByteArrayRegion(env, bytes, 0, cnt, (jbyte*) d);
-    (*env)->CallVoidMethod(env, ctx, g_mdUpdate, bytes);
-    (*env)->DeleteLocalRef(env, bytes);
+    JNIEnv* env = GetJNIEnv();
 
-    return CheckJNIExceptions(env) ? FAIL : SUCCESS;
-}
+    // Hash the data in place instead of copying it into a Java array first
+    jobject buffer = (*env)->NewDirectByteBuffer(env, d, cnt);
+    if (buffer == NULL)
+        return FAIL;
 
-static int32_t DigestFinal(JNIEnv* env, jobject ctx, uint8_t* md, uint32_t* s)
-{
-    abort_if_invalid_pointer_argument (md);
+    (*env)->CallVoidMethod(env, ctx, g_mdUpdateWithByteBuffer, buffer);
+    (*env)->DeleteLocalRef(env, buffer);
 
-    // ctx.digest();
-    jbyteArray bytes = (jbyteArray)(*env)->CallObjectMethod(env, ctx, g_mdDigest);
-    abort_unless(bytes != NULL, "digest() was not expected to return null");
-    jsize bytesLen = (*env)->GetArrayLength(env, bytes);
-    *s = (uint32_t)bytesLen;
-    (*env)->GetByteArrayRegion(env, bytes, 0, bytesLen, (jbyte*) md);
-    (*env)->DeleteLocalRef(env, bytes);
     return CheckJNIExceptions(env) ? FAIL : SUCCESS;
 }
 
@@ -37,6 +37,7 @@ jmethodID g_mdDigest;
 jmethodID g_mdDigestWithInputBytes;
 jmethodID g_mdReset;
 jmethodID g_mdUpdate;
+jmethodID g_mdUpdateWithByteBuffer;
 
 // javax/crypto/Mac
 jclass    g_MacClass;
@@ -724,6 +725,7 @@ JNI_OnLoad(JavaVM *vm, void *reserved)
     g_mdDigestWithInputBytes =  GetMethod(env, false, g_mdClass, "digest", "([B)[B");
     g_mdReset =                 GetMethod(env, false, g_mdClass, "reset", "()V");
     g_mdUpdate =                GetMethod(env, false, g_mdClass, "update", "([B)V");
+    g_mdUpdateWithByteBuffer =  GetMethod(env, false, g_mdClass, "update", "(Ljava/nio/ByteBuffer;)V");
 
     g_MacClass =          GetClassGRef(env, "javax/crypto/Mac");
     g_MacGetInstance =    GetMethod(env, true,  g_MacClass, "getInstance", "(Ljava/lang/String;)Ljavax/crypto/Mac;");
@@ -46,6 +46,7 @@ extern jmethodID g_mdDigest;
 extern jmethodID g_mdDigestWithInputBytes;
 extern jmethodID g_mdReset;
 extern jmethodID g_mdUpdate;
+extern jmethodID g_mdUpdateWithByteBuffer;
 
 // javax/crypto/Mac
 extern jclass    g_MacClass;
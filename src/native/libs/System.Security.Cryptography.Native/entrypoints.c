@@ -25,6 +25,7 @@
 #include "pal_ocsp.h"
 #include "pal_pkcs7.h"
 #include "pal_ssl.h"
+#include "pal_ssl_session_cache.h"
 #include "pal_x509.h"
 #include "pal_x509ext.h"
 #include "pal_x509_name.h"
@@ -122,6 +123,8 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_EvpCipherGetGcmTag)
     DllImportEntry(CryptoNative_EvpCipherGetAeadTag)
     DllImportEntry(CryptoNative_EvpCipherSetAeadTag)
+    DllImportEntry(CryptoNative_EvpCipherAeadOneShot)
+    DllImportEntry(CryptoNative_EvpCipherAeadBatch)
     DllImportEntry(CryptoNative_EvpCipherReset)
     DllImportEntry(CryptoNative_EvpCipherSetCcmNonceLength)
     DllImportEntry(CryptoNative_EvpCipherSetCcmTag)
@@ -141,6 +144,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_EvpDigestFinalEx)
     DllImportEntry(CryptoNative_EvpDigestFinalXOF)
     DllImportEntry(CryptoNative_EvpDigestOneShot)
+    DllImportEntry(CryptoNative_EvpDigestBatchOneShot)
     DllImportEntry(CryptoNative_EvpDigestReset)
     DllImportEntry(CryptoNative_EvpDigestSqueeze)
     DllImportEntry(CryptoNative_EvpDigestUpdate)
@@ -314,6 +318,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_IsSslStateOK)
     DllImportEntry(CryptoNative_SslCtxAddExtraChainCert)
     DllImportEntry(CryptoNative_SslCtxSetCaching)
+    DllImportEntry(CryptoNative_SslCtxSetSessionCache)
     DllImportEntry(CryptoNative_SslCtxRemoveSession)
     DllImportEntry(CryptoNative_SslCtxSetCiphers)
     DllImportEntry(CryptoNative_SslCtxSetDefaultOcspCallback)
@@ -353,10 +358,19 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_SslSessionSetHostname)
     DllImportEntry(CryptoNative_SslSessionReused)
     DllImportEntry(CryptoNative_SslSessionGetData)
+    DllImportEntry(CryptoNative_SslSessionCacheCreate)
+    DllImportEntry(CryptoNative_SslSessionCacheDestroy)
+    DllImportEntry(CryptoNative_SslSessionCacheGetCount)
     DllImportEntry(CryptoNative_SslSessionSetData)
     DllImportEntry(CryptoNative_SslSetAcceptState)
     DllImportEntry(CryptoNative_SslSetAlpnProtos)
     DllImportEntry(CryptoNative_SslSetBio)
+    DllImportEntry(CryptoNative_SslSetSocket)
+    DllImportEntry(CryptoNative_SslGetKtlsState)
+    DllImportEntry(CryptoNative_SslSendFile)
+    DllImportEntry(CryptoNative_SslSetAsyncMode)
+    DllImportEntry(CryptoNative_SslGetAsyncWaitFds)
+    DllImportEntry(CryptoNative_SslLoadOffloadProvider)
     DllImportEntry(CryptoNative_SslSetClientCertCallback)
     DllImportEntry(CryptoNative_SslSetPostHandshakeAuth)
     DllImportEntry(CryptoNative_SslSetConnectState)
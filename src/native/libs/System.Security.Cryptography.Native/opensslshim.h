@@ -262,6 +262,7 @@ extern bool g_libSslUses32BitTime;
     REQUIRED_FUNCTION(d2i_PKCS8_PRIV_KEY_INFO) \
     REQUIRED_FUNCTION(d2i_PUBKEY) \
     REQUIRED_FUNCTION(d2i_RSAPublicKey) \
+    REQUIRED_FUNCTION(d2i_SSL_SESSION) \
     REQUIRED_FUNCTION(d2i_X509) \
     REQUIRED_FUNCTION(d2i_X509_bio) \
     REQUIRED_FUNCTION(d2i_X509_CRL) \
@@ -325,6 +326,7 @@ extern bool g_libSslUses32BitTime;
     REQUIRED_FUNCTION(ENGINE_init) \
     REQUIRED_FUNCTION(ENGINE_load_public_key) \
     REQUIRED_FUNCTION(ENGINE_load_private_key) \
+    REQUIRED_FUNCTION(ENGINE_set_default) \
     REQUIRED_FUNCTION(ERR_clear_error) \
     REQUIRED_FUNCTION(ERR_error_string_n) \
     REQUIRED_FUNCTION(ERR_get_error) \
@@ -468,6 +470,7 @@ extern bool g_libSslUses32BitTime;
     REQUIRED_FUNCTION(i2d_PKCS7) \
     REQUIRED_FUNCTION(i2d_PKCS8_PRIV_KEY_INFO) \
     REQUIRED_FUNCTION(i2d_PUBKEY) \
+    REQUIRED_FUNCTION(i2d_SSL_SESSION) \
     REQUIRED_FUNCTION(i2d_X509) \
     REQUIRED_FUNCTION(i2d_X509_PUBKEY) \
     REQUIRED_FUNCTION(OBJ_ln2nid) \
@@ -556,6 +559,7 @@ extern bool g_libSslUses32BitTime;
     REQUIRED_FUNCTION(SSL_CTX_get_ex_data) \
     FALLBACK_FUNCTION(SSL_is_init_finished) \
     REQUIRED_FUNCTION(SSL_CTX_new) \
+    REQUIRED_FUNCTION(SSL_CTX_sess_set_get_cb) \
     REQUIRED_FUNCTION(SSL_CTX_sess_set_new_cb) \
     REQUIRED_FUNCTION(SSL_CTX_sess_set_remove_cb) \
     REQUIRED_FUNCTION(SSL_CTX_remove_session) \
@@ -583,9 +587,12 @@ extern bool g_libSslUses32BitTime;
     REQUIRED_FUNCTION(SSL_get_finished) \
     REQUIRED_FUNCTION(SSL_get_peer_cert_chain) \
     REQUIRED_FUNCTION(SSL_get_peer_finished) \
+    REQUIRED_FUNCTION(SSL_get_rbio) \
     REQUIRED_FUNCTION(SSL_get_servername) \
     REQUIRED_FUNCTION(SSL_get_SSL_CTX) \
+    LIGHTUP_FUNCTION(SSL_get_all_async_fds) \
     REQUIRED_FUNCTION(SSL_get_version) \
+    REQUIRED_FUNCTION(SSL_get_wbio) \
     LIGHTUP_FUNCTION(SSL_get0_alpn_selected) \
     RENAMED_FUNCTION(SSL_get1_peer_certificate, SSL_get_peer_certificate) \
     REQUIRED_FUNCTION(SSL_get_certificate) \
@@ -596,8 +603,10 @@ extern bool g_libSslUses32BitTime;
     REQUIRED_FUNCTION(SSL_read) \
     REQUIRED_FUNCTION(SSL_renegotiate) \
     REQUIRED_FUNCTION(SSL_renegotiate_pending) \
+    LIGHTUP_FUNCTION(SSL_sendfile) \
     REQUIRED_FUNCTION(SSL_SESSION_free) \
     REQUIRED_FUNCTION(SSL_SESSION_get_ex_data) \
+    REQUIRED_FUNCTION(SSL_SESSION_get_id) \
     REQUIRED_FUNCTION(SSL_SESSION_set_ex_data) \
     LIGHTUP_FUNCTION(SSL_SESSION_get0_hostname) \
     LIGHTUP_FUNCTION(SSL_SESSION_set1_hostname) \
@@ -609,6 +618,7 @@ extern bool g_libSslUses32BitTime;
     LIGHTUP_FUNCTION(SSL_set_ciphersuites) \
     REQUIRED_FUNCTION(SSL_set_connect_state) \
     REQUIRED_FUNCTION(SSL_set_ex_data) \
+    REQUIRED_FUNCTION(SSL_set_fd) \
     FALLBACK_FUNCTION(SSL_set_options) \
     REQUIRED_FUNCTION(SSL_set_session) \
     REQUIRED_FUNCTION(SSL_get_session) \
@@ -794,6 +804,7 @@ extern TYPEOF(OPENSSL_gmtime)* OPENSSL_gmtime_ptr;
 #define d2i_PKCS8_PRIV_KEY_INFO d2i_PKCS8_PRIV_KEY_INFO_ptr
 #define d2i_PUBKEY d2i_PUBKEY_ptr
 #define d2i_RSAPublicKey d2i_RSAPublicKey_ptr
+#define d2i_SSL_SESSION d2i_SSL_SESSION_ptr
 #define d2i_X509 d2i_X509_ptr
 #define d2i_X509_bio d2i_X509_bio_ptr
 #define d2i_X509_CRL d2i_X509_CRL_ptr
@@ -857,6 +868,7 @@ extern TYPEOF(OPENSSL_gmtime)* OPENSSL_gmtime_ptr;
 #define ENGINE_init ENGINE_init_ptr
 #define ENGINE_load_public_key ENGINE_load_public_key_ptr
 #define ENGINE_load_private_key ENGINE_load_private_key_ptr
+#define ENGINE_set_default ENGINE_set_default_ptr
 #define ERR_clear_error ERR_clear_error_ptr
 #define ERR_error_string_n ERR_error_string_n_ptr
 #define ERR_get_error ERR_get_error_ptr
@@ -1000,6 +1012,7 @@ extern TYPEOF(OPENSSL_gmtime)* OPENSSL_gmtime_ptr;
 #define i2d_PKCS7 i2d_PKCS7_ptr
 #define i2d_PKCS8_PRIV_KEY_INFO i2d_PKCS8_PRIV_KEY_INFO_ptr
 #define i2d_PUBKEY i2d_PUBKEY_ptr
+#define i2d_SSL_SESSION i2d_SSL_SESSION_ptr
 #define i2d_X509 i2d_X509_ptr
 #define i2d_X509_PUBKEY i2d_X509_PUBKEY_ptr
 #define OBJ_ln2nid OBJ_ln2nid_ptr
@@ -1090,6 +1103,7 @@ extern TYPEOF(OPENSSL_gmtime)* OPENSSL_gmtime_ptr;
 #define SSL_CTX_free SSL_CTX_free_ptr
 #define SSL_CTX_get_ex_data SSL_CTX_get_ex_data_ptr
 #define SSL_CTX_new SSL_CTX_new_ptr
+#define SSL_CTX_sess_set_get_cb SSL_CTX_sess_set_get_cb_ptr
 #define SSL_CTX_sess_set_new_cb SSL_CTX_sess_set_new_cb_ptr
 #define SSL_CTX_sess_set_remove_cb SSL_CTX_sess_set_remove_cb_ptr
 #define SSL_CTX_remove_session SSL_CTX_remove_session_ptr
@@ -1118,9 +1132,12 @@ extern TYPEOF(OPENSSL_gmtime)* OPENSSL_gmtime_ptr;
 #define SSL_get_finished SSL_get_finished_ptr
 #define SSL_get_peer_cert_chain SSL_get_peer_cert_chain_ptr
 #define SSL_get_peer_finished SSL_get_peer_finished_ptr
+#define SSL_get_rbio SSL_get_rbio_ptr
 #define SSL_get_servername SSL_get_servername_ptr
 #define SSL_get_SSL_CTX SSL_get_SSL_CTX_ptr
+#define SSL_get_all_async_fds SSL_get_all_async_fds_ptr
 #define SSL_get_version SSL_get_version_ptr
+#define SSL_get_wbio SSL_get_wbio_ptr
 #define SSL_get0_alpn_selected SSL_get0_alpn_selected_ptr
 #define SSL_get1_peer_certificate SSL_get1_peer_certificate_ptr
 #define SSL_is_init_finished SSL_is_init_finished_ptr
@@ -1132,11 +1149,13 @@ extern TYPEOF(OPENSSL_gmtime)* OPENSSL_gmtime_ptr;
 #define SSL_read SSL_read_ptr
 #define SSL_renegotiate SSL_renegotiate_ptr
 #define SSL_renegotiate_pending SSL_renegotiate_pending_ptr
+#define SSL_sendfile SSL_sendfile_ptr
 #define SSL_SESSION_free SSL_SESSION_free_ptr
 #define SSL_SESSION_get0_hostname SSL_SESSION_get0_hostname_ptr
 #define SSL_SESSION_set1_hostname SSL_SESSION_set1_hostname_ptr
 #define SSL_session_reused SSL_session_reused_ptr
 #define SSL_SESSION_get_ex_data SSL_SESSION_get_ex_data_ptr
+#define SSL_SESSION_get_id SSL_SESSION_get_id_ptr
 #define SSL_SESSION_set_ex_data SSL_SESSION_set_ex_data_ptr
 #define SSL_set_accept_state SSL_set_accept_state_ptr
 #define SSL_set_bio SSL_set_bio_ptr
@@ -1145,6 +1164,7 @@ extern TYPEOF(OPENSSL_gmtime)* OPENSSL_gmtime_ptr;
 #define SSL_set_ciphersuites SSL_set_ciphersuites_ptr
 #define SSL_set_connect_state SSL_set_connect_state_ptr
 #define SSL_set_ex_data SSL_set_ex_data_ptr
+#define SSL_set_fd SSL_set_fd_ptr
 #define SSL_set_options SSL_set_options_ptr
 #define SSL_set_session SSL_set_session_ptr
 #define SSL_get_session SSL_get_session_ptr
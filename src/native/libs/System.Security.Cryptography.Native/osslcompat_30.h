@@ -5,6 +5,7 @@
 
 #pragma once
 #include "pal_types.h"
+#include <sys/types.h>
 
 #undef EVP_PKEY_CTX_set_rsa_keygen_bits
 #undef EVP_PKEY_CTX_set_rsa_oaep_md
@@ -55,6 +56,8 @@ int EVP_PKEY_CTX_set_signature_md(EVP_PKEY_CTX* ctx, const EVP_MD* md);
 int EVP_PKEY_get_base_id(const EVP_PKEY* pkey);
 int EVP_PKEY_get_size(const EVP_PKEY* pkey);
 
+ssize_t SSL_sendfile(SSL *s, int fd, off_t offset, size_t size, int flags);
+
 OSSL_PARAM OSSL_PARAM_construct_end(void);
 OSSL_PARAM OSSL_PARAM_construct_int32(const char *key, int32_t *buf);
 OSSL_PARAM OSSL_PARAM_construct_octet_string(const char *key, void *buf, size_t bsize);
@@ -7,6 +7,7 @@
 
 #include <assert.h>
 #include <pthread.h>
+#include <unistd.h>
 
 #define SUCCESS 1
 
@@ -232,6 +233,147 @@ int32_t CryptoNative_EvpDigestOneShot(const EVP_MD* type, const void* source, in
     return ret;
 }
 
+// Thread creation costs tens of microseconds, so only fan out when each thread gets a good amount of data.
+#define DIGEST_BATCH_BYTES_PER_THREAD (1024 * 1024)
+#define DIGEST_BATCH_MAX_THREADS 8
+
+typedef struct
+{
+    const EVP_MD* Type;
+    const uint8_t* const* Sources;
+    const int32_t* SourceSizes;
+    int32_t Start;
+    int32_t End;
+    uint8_t* Md;
+    int32_t MdStride;
+    int32_t Result;
+} DigestBatchRange;
+
+static void* DigestBatchRangeCore(void* arg)
+{
+    DigestBatchRange* range = (DigestBatchRange*)arg;
+    range->Result = 0;
+
+    EVP_MD_CTX* ctx = CryptoNative_EvpMdCtxCreate(range->Type);
+    if (ctx == NULL)
+    {
+        return NULL;
+    }
+
+    int32_t ret = SUCCESS;
+    for (int32_t i = range->Start; i < range->End && ret == SUCCESS; i++)
+    {
+        unsigned int size;
+
+        // The context comes out of CryptoNative_EvpMdCtxCreate initialized, only redo that for the next buffers.
+        ret = (i == range->Start || EVP_DigestInit_ex(ctx, range->Type, NULL) == SUCCESS) &&
+              EVP_DigestUpdate(ctx, range->Sources[i], (size_t)range->SourceSizes[i]) == SUCCESS &&
+              EVP_DigestFinal_ex(ctx, range->Md + (size_t)i * (size_t)range->MdStride, &size) == SUCCESS;
+    }
+
+    CryptoNative_EvpMdCtxDestroy(ctx);
+    range->Result = ret;
+    return NULL;
+}
+
+int32_t CryptoNative_EvpDigestBatchOneShot(const EVP_MD* type,
+                                           const uint8_t* const* sources,
+                                           const int32_t* sourceSizes,
+                                           int32_t count,
+                                           uint8_t* md,
+                                           int32_t mdStride)
+{
+    ERR_clear_error();
+
+    if (type == NULL || count < 0 || (count > 0 && (sources == NULL || sourceSizes == NULL || md == NULL)) ||
+        mdStride < EVP_MD_get_size(type))
+    {
+        return 0;
+    }
+
+    int64_t totalSize = 0;
+    for (int32_t i = 0; i < count; i++)
+    {
+        if (sourceSizes[i] < 0 || (sourceSizes[i] > 0 && sources[i] == NULL))
+        {
+            return 0;
+        }
+
+        totalSize += sourceSizes[i];
+    }
+
+    int64_t threadCount = totalSize / DIGEST_BATCH_BYTES_PER_THREAD;
+    long processorCount = sysconf(_SC_NPROCESSORS_ONLN);
+    if (threadCount > processorCount)
+    {
+        threadCount = processorCount;
+    }
+    if (threadCount > DIGEST_BATCH_MAX_THREADS)
+    {
+        threadCount = DIGEST_BATCH_MAX_THREADS;
+    }
+    if (threadCount > count)
+    {
+        threadCount = count;
+    }
+    if (threadCount < 1)
+    {
+        threadCount = 1;
+    }
+
+    // Split into contiguous ranges of about the same number of bytes; this thread does the last one.
+    DigestBatchRange ranges[DIGEST_BATCH_MAX_THREADS];
+    pthread_t threads[DIGEST_BATCH_MAX_THREADS];
+    bool started[DIGEST_BATCH_MAX_THREADS] = { false };
+
+    int32_t start = 0;
+    int64_t consumed = 0;
+    for (int32_t t = 0; t < (int32_t)threadCount; t++)
+    {
+        int32_t end = count;
+        if (t < threadCount - 1)
+        {
+            int64_t target = totalSize * (t + 1) / threadCount;
+            end = start;
+            while (end < count && consumed < target)
+            {
+                consumed += sourceSizes[end++];
+            }
+        }
+
+        ranges[t] = (DigestBatchRange){ type, sources, sourceSizes, start, end, md, mdStride, 0 };
+        start = end;
+    }
+
+    for (int32_t t = 0; t < (int32_t)threadCount - 1; t++)
+    {
+        // If a thread can't be started, its range is done on this thread instead.
+        started[t] = pthread_create(&threads[t], NULL, DigestBatchRangeCore, &ranges[t]) == 0;
+    }
+
+    DigestBatchRangeCore(&ranges[threadCount - 1]);
+
+    int32_t ret = ranges[threadCount - 1].Result;
+    for (int32_t t = 0; t < (int32_t)threadCount - 1; t++)
+    {
+        if (started[t])
+        {
+            pthread_join(threads[t], NULL);
+        }
+        else
+        {
+            DigestBatchRangeCore(&ranges[t]);
+        }
+
+        if (ranges[t].Result != SUCCESS)
+        {
+            ret = 0;
+        }
+    }
+
+    return ret;
+}
+
 int32_t CryptoNative_EvpDigestXOFOneShot(const EVP_MD* type, const void* source, int32_t sourceSize, uint8_t* md, uint32_t len)
 {
     ERR_clear_error();
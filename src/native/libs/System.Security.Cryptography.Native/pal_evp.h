@@ -81,6 +81,23 @@ Combines EVP_MD_CTX_create, EVP_DigestUpdate, and EVP_DigestFinal_ex in to a sin
 */
 PALEXPORT int32_t CryptoNative_EvpDigestOneShot(const EVP_MD* type, const void* source, int32_t sourceSize, uint8_t* md, uint32_t* mdSize);
 
+/*
+Function:
+EvpDigestBatchOneShot
+
+Computes the digest of count independent buffers in a single call, writing the digest of sources[i]
+to md + i * mdStride. mdStride must be at least the digest size. One EVP_MD_CTX is reused for the
+whole batch, and large batches are split across native threads.
+
+Returns 1 if every digest was computed, 0 otherwise.
+*/
+PALEXPORT int32_t CryptoNative_EvpDigestBatchOneShot(const EVP_MD* type,
+                                                     const uint8_t* const* sources,
+                                                     const int32_t* sourceSizes,
+                                                     int32_t count,
+                                                     uint8_t* md,
+                                                     int32_t mdStride);
+
 /*
 Function:
 EvpDigestXOFOneShot
@@ -233,6 +233,119 @@ int32_t CryptoNative_EvpCipherSetAeadTag(EVP_CIPHER_CTX* ctx, uint8_t* tag, int3
 #endif
 }
 
+// GCM and ChaCha20-Poly1305 share the GCM control values (EVP_CTRL_AEAD_* alias them from 1.1 on),
+// so one sequence works for both.
+static int32_t AeadProcess(EVP_CIPHER_CTX* ctx,
+                           uint8_t* nonce,
+                           int32_t nonceLength,
+                           uint8_t* associatedData,
+                           int32_t associatedDataLength,
+                           uint8_t* input,
+                           int32_t inputLength,
+                           uint8_t* output,
+                           uint8_t* tag,
+                           int32_t tagLength,
+                           int32_t enc)
+{
+    assert(nonce != NULL && nonceLength > 0);
+    assert(associatedDataLength >= 0 && (associatedData != NULL || associatedDataLength == 0));
+    assert(inputLength >= 0 && (input != NULL || inputLength == 0));
+    assert(tag != NULL && tagLength > 0);
+
+    if (EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_IVLEN, nonceLength, NULL) != SUCCESS ||
+        EVP_CipherInit_ex(ctx, NULL, NULL, NULL, nonce, enc) != SUCCESS)
+    {
+        return 0;
+    }
+
+    if (!enc && EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, tagLength, tag) != SUCCESS)
+    {
+        return 0;
+    }
+
+    int outLength;
+    if (associatedDataLength > 0 &&
+        EVP_CipherUpdate(ctx, NULL, &outLength, associatedData, associatedDataLength) != SUCCESS)
+    {
+        return 0;
+    }
+
+    int written = 0;
+    if (inputLength > 0)
+    {
+        if (EVP_CipherUpdate(ctx, output, &outLength, input, inputLength) != SUCCESS)
+        {
+            return 0;
+        }
+
+        written = outLength;
+    }
+
+    // These modes don't buffer, so finalizing writes nothing but does check the tag when decrypting.
+    if (EVP_CipherFinal_ex(ctx, output + written, &outLength) != SUCCESS)
+    {
+        return 0;
+    }
+
+    assert(written + outLength == inputLength);
+
+    if (enc && EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, tagLength, tag) != SUCCESS)
+    {
+        return 0;
+    }
+
+    return SUCCESS;
+}
+
+int32_t CryptoNative_EvpCipherAeadOneShot(EVP_CIPHER_CTX* ctx,
+                                          uint8_t* nonce,
+                                          int32_t nonceLength,
+                                          uint8_t* associatedData,
+                                          int32_t associatedDataLength,
+                                          uint8_t* input,
+                                          int32_t inputLength,
+                                          uint8_t* output,
+                                          uint8_t* tag,
+                                          int32_t tagLength,
+                                          int32_t enc)
+{
+    ERR_clear_error();
+
+    return AeadProcess(
+        ctx, nonce, nonceLength, associatedData, associatedDataLength, input, inputLength, output, tag, tagLength, enc);
+}
+
+int32_t CryptoNative_EvpCipherAeadBatch(EVP_CIPHER_CTX* ctx, AeadMessage* messages, int32_t count, int32_t enc)
+{
+    assert(messages != NULL || count == 0);
+
+    ERR_clear_error();
+
+    int32_t ret = SUCCESS;
+    for (int32_t i = 0; i < count; i++)
+    {
+        AeadMessage* message = &messages[i];
+        message->Result = AeadProcess(ctx,
+                                      message->Nonce,
+                                      message->NonceLength,
+                                      message->AssociatedData,
+                                      message->AssociatedDataLength,
+                                      message->Input,
+                                      message->InputLength,
+                                      message->Output,
+                                      message->Tag,
+                                      message->TagLength,
+                                      enc);
+
+        if (message->Result != SUCCESS)
+        {
+            ret = 0;
+        }
+    }
+
+    return ret;
+}
+
 const EVP_CIPHER* CryptoNative_EvpAes128Ecb(void)
 {
     // No error queue impact.
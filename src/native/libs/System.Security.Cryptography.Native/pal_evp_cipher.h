@@ -5,6 +5,26 @@
 #include "pal_compiler.h"
 #include "opensslshim.h"
 
+/*
+A single message for CryptoNative_EvpCipherAeadBatch. Output must have room for InputLength bytes,
+Tag receives the tag when encrypting and holds the expected tag when decrypting.
+Result is set to 1 if the message was processed (and authenticated) successfully, 0 otherwise.
+*/
+typedef struct
+{
+    uint8_t* Nonce;
+    int32_t NonceLength;
+    int32_t AssociatedDataLength;
+    uint8_t* AssociatedData;
+    uint8_t* Input;
+    uint8_t* Output;
+    uint8_t* Tag;
+    int32_t InputLength;
+    int32_t TagLength;
+    int32_t Result;
+    int32_t Padding;
+} AeadMessage;
+
 PALEXPORT EVP_CIPHER_CTX*
 CryptoNative_EvpCipherCreate2(const EVP_CIPHER* type, uint8_t* key, int32_t keyLength, unsigned char* iv, int32_t enc);
 
@@ -110,6 +130,39 @@ Sets tag for authenticated decryption
 */
 PALEXPORT int32_t CryptoNative_EvpCipherSetAeadTag(EVP_CIPHER_CTX* ctx, uint8_t* tag, int32_t tagLength);
 
+/*
+Function:
+EvpCipherAeadOneShot
+
+Encrypts (enc = 1) or decrypts (enc = 0) a whole AES-GCM or ChaCha20-Poly1305 message with the key
+already set on ctx: sets the nonce, feeds the associated data and input, and gets or checks the tag.
+
+Returns 1 on success, 0 on failure, including a tag that doesn't match when decrypting; the output
+of a failed message must be discarded.
+*/
+PALEXPORT int32_t CryptoNative_EvpCipherAeadOneShot(EVP_CIPHER_CTX* ctx,
+                                                    uint8_t* nonce,
+                                                    int32_t nonceLength,
+                                                    uint8_t* associatedData,
+                                                    int32_t associatedDataLength,
+                                                    uint8_t* input,
+                                                    int32_t inputLength,
+                                                    uint8_t* output,
+                                                    uint8_t* tag,
+                                                    int32_t tagLength,
+                                                    int32_t enc);
+
+/*
+Function:
+EvpCipherAeadBatch
+
+Processes count messages like EvpCipherAeadOneShot against the key already set on ctx, recording
+the outcome of each in its Result field. A failed message doesn't stop the batch.
+
+Returns 1 if every message succeeded, 0 otherwise.
+*/
+PALEXPORT int32_t CryptoNative_EvpCipherAeadBatch(EVP_CIPHER_CTX* ctx, AeadMessage* messages, int32_t count, int32_t enc);
+
 /*
 Function:
 EvpAes128Ecb
@@ -18,6 +18,10 @@ c_static_assert(PAL_SSL_ERROR_WANT_READ == SSL_ERROR_WANT_READ);
 c_static_assert(PAL_SSL_ERROR_WANT_WRITE == SSL_ERROR_WANT_WRITE);
 c_static_assert(PAL_SSL_ERROR_SYSCALL == SSL_ERROR_SYSCALL);
 c_static_assert(PAL_SSL_ERROR_ZERO_RETURN == SSL_ERROR_ZERO_RETURN);
+#ifdef SSL_ERROR_WANT_ASYNC
+c_static_assert(PAL_SSL_ERROR_WANT_ASYNC == SSL_ERROR_WANT_ASYNC);
+c_static_assert(PAL_SSL_ERROR_WANT_ASYNC_JOB == SSL_ERROR_WANT_ASYNC_JOB);
+#endif
 c_static_assert(SSL_CTRL_SET_TLSEXT_STATUS_REQ_TYPE == 65);
 c_static_assert(TLSEXT_STATUSTYPE_ocsp == 1);
 
@@ -549,6 +553,188 @@ void CryptoNative_SslSetBio(SSL* ssl, BIO* rbio, BIO* wbio)
     SSL_set_bio(ssl, rbio, wbio);
 }
 
+// Kernel TLS exists from OpenSSL 3.0 on; define what we need so that the portable build can light it up.
+#ifndef SSL_OP_ENABLE_KTLS
+#define SSL_OP_ENABLE_KTLS ((uint64_t)1 << (uint64_t)3)
+#endif
+#ifndef BIO_CTRL_GET_KTLS_SEND
+#define BIO_CTRL_GET_KTLS_SEND 73
+#endif
+#ifndef BIO_CTRL_GET_KTLS_RECV
+#define BIO_CTRL_GET_KTLS_RECV 76
+#endif
+
+int32_t CryptoNative_SslSetSocket(SSL* ssl, intptr_t fd, int32_t enableKtls)
+{
+    ERR_clear_error();
+
+#ifdef NEED_OPENSSL_3_0
+    // SSL_sendfile is the marker for a libssl that knows about kernel TLS. On 1.x the option bit means
+    // something else or nothing, so don't set it there.
+    if (enableKtls && API_EXISTS(SSL_sendfile))
+    {
+        SSL_set_options(ssl, SSL_OP_ENABLE_KTLS);
+    }
+#else
+    (void)enableKtls;
+#endif
+
+    return SSL_set_fd(ssl, (int)fd);
+}
+
+int32_t CryptoNative_SslGetKtlsState(SSL* ssl)
+{
+    int32_t state = PAL_SSL_KTLS_NONE;
+
+#ifdef NEED_OPENSSL_3_0
+    if (API_EXISTS(SSL_sendfile))
+    {
+        // No error queue impact, BIOs that don't know the control just return 0.
+        BIO* wbio = SSL_get_wbio(ssl);
+        BIO* rbio = SSL_get_rbio(ssl);
+
+        if (wbio != NULL && BIO_ctrl(wbio, BIO_CTRL_GET_KTLS_SEND, 0, NULL) > 0)
+        {
+            state |= PAL_SSL_KTLS_SEND;
+        }
+
+        if (rbio != NULL && BIO_ctrl(rbio, BIO_CTRL_GET_KTLS_RECV, 0, NULL) > 0)
+        {
+            state |= PAL_SSL_KTLS_RECEIVE;
+        }
+    }
+#else
+    (void)ssl;
+#endif
+
+    return state;
+}
+
+int64_t CryptoNative_SslSendFile(SSL* ssl, intptr_t fd, int64_t offset, int64_t count, int32_t* error)
+{
+    assert(error != NULL);
+
+    ERR_clear_error();
+
+#ifdef NEED_OPENSSL_3_0
+    if (API_EXISTS(SSL_sendfile))
+    {
+        int64_t result = (int64_t)SSL_sendfile(ssl, (int)fd, (off_t)offset, (size_t)count, 0);
+        *error = result > 0 ? SSL_ERROR_NONE : CryptoNative_SslGetError(ssl, (int32_t)result);
+        return result;
+    }
+#else
+    (void)ssl;
+    (void)fd;
+    (void)offset;
+    (void)count;
+#endif
+
+    *error = SSL_ERROR_SSL;
+    return -1;
+}
+
+// Async jobs exist from OpenSSL 1.1.0 on.
+#ifndef SSL_MODE_ASYNC
+#define SSL_MODE_ASYNC 0x00000100U
+#endif
+
+int32_t CryptoNative_SslSetAsyncMode(SSL* ssl, int32_t enable)
+{
+    // SSL_get_all_async_fds comes with the async job support, use it to detect 1.0.x.
+    if (!API_EXISTS(SSL_get_all_async_fds))
+    {
+        return enable ? 0 : 1;
+    }
+
+    // No error queue impact.
+    SSL_ctrl(ssl, enable ? SSL_CTRL_MODE : SSL_CTRL_CLEAR_MODE, SSL_MODE_ASYNC, NULL);
+    return 1;
+}
+
+int32_t CryptoNative_SslGetAsyncWaitFds(SSL* ssl, intptr_t* fds, int32_t count, int32_t* fdCount)
+{
+    assert(fdCount != NULL);
+    assert(fds != NULL || count == 0);
+
+    *fdCount = 0;
+    if (!API_EXISTS(SSL_get_all_async_fds))
+    {
+        return 0;
+    }
+
+    ERR_clear_error();
+
+    size_t numFds = 0;
+    if (!SSL_get_all_async_fds(ssl, NULL, &numFds))
+    {
+        return 0;
+    }
+
+    if (numFds > 0 && count > 0)
+    {
+        int* platformFds = (int*)calloc(numFds, sizeof(int));
+        if (platformFds == NULL)
+        {
+            return 0;
+        }
+
+        if (!SSL_get_all_async_fds(ssl, platformFds, &numFds))
+        {
+            free(platformFds);
+            return 0;
+        }
+
+        for (size_t i = 0; i < numFds && i < (size_t)count; i++)
+        {
+            fds[i] = platformFds[i];
+        }
+
+        free(platformFds);
+    }
+
+    *fdCount = (int32_t)numFds;
+    return 1;
+}
+
+int32_t CryptoNative_SslLoadOffloadProvider(const char* name)
+{
+    assert(name != NULL);
+
+    ERR_clear_error();
+
+#ifdef NEED_OPENSSL_3_0
+    if (API_EXISTS(OSSL_PROVIDER_try_load))
+    {
+        // Retaining fallbacks keeps the default provider for whatever the offload one doesn't do.
+        if (OSSL_PROVIDER_try_load(NULL, name, 1) != NULL)
+        {
+            return 1;
+        }
+
+        // Some offload stacks still ship as engines on 3.0, so try that as well.
+        ERR_clear_error();
+    }
+#endif
+
+    int32_t ret = 0;
+    ENGINE* engine = ENGINE_by_id(name);
+
+    if (engine != NULL)
+    {
+        if (ENGINE_init(engine))
+        {
+            // ENGINE_set_default takes its own functional reference.
+            ret = ENGINE_set_default(engine, ENGINE_METHOD_RSA | ENGINE_METHOD_EC | ENGINE_METHOD_PKEY_METHS);
+            ENGINE_finish(engine);
+        }
+
+        ENGINE_free(engine);
+    }
+
+    return ret;
+}
+
 int32_t CryptoNative_SslDoHandshake(SSL* ssl, int32_t* error)
 {
     ERR_clear_error();
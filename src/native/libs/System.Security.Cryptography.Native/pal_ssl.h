@@ -112,8 +112,20 @@ typedef enum
     PAL_SSL_ERROR_WANT_WRITE = 3,
     PAL_SSL_ERROR_SYSCALL = 5,
     PAL_SSL_ERROR_ZERO_RETURN = 6,
+    PAL_SSL_ERROR_WANT_ASYNC = 9,
+    PAL_SSL_ERROR_WANT_ASYNC_JOB = 10,
 } SslErrorCode;
 
+/*
+Flags describing which directions of a connection are offloaded to kernel TLS.
+*/
+typedef enum
+{
+    PAL_SSL_KTLS_NONE = 0,
+    PAL_SSL_KTLS_SEND = 1,
+    PAL_SSL_KTLS_RECEIVE = 2,
+} SslKtlsState;
+
 // the function pointer definition for the callback used in SslCtxSetAlpnSelectCb
 typedef int32_t (*SslCtxSetAlpnCallback)(SSL* ssl,
     const uint8_t** out,
@@ -310,6 +322,56 @@ Shims the SSL_set_bio method.
 */
 PALEXPORT void CryptoNative_SslSetBio(SSL* ssl, BIO* rbio, BIO* wbio);
 
+/*
+Attaches the socket directly to the SSL instead of memory BIOs, shims SSL_set_fd.
+When enableKtls is nonzero, asks OpenSSL (3.0 and later) to hand the record layer to the kernel
+once the handshake has negotiated keys; whether that happened is reported by CryptoNative_SslGetKtlsState.
+
+Returns 1 on success, 0 on failure.
+*/
+PALEXPORT int32_t CryptoNative_SslSetSocket(SSL* ssl, intptr_t fd, int32_t enableKtls);
+
+/*
+Returns the SslKtlsState flags for the SSL. After the handshake, a direction that is offloaded
+carries TLS records natively on the socket, so for PAL_SSL_KTLS_SEND plain writes, sendfile(2)
+and SystemNative_SendFile on the descriptor are encrypted by the kernel.
+*/
+PALEXPORT int32_t CryptoNative_SslGetKtlsState(SSL* ssl);
+
+/*
+Shims the SSL_sendfile method, which requires PAL_SSL_KTLS_SEND.
+
+Returns the number of bytes sent; <= 0 on failure, with the SSL error code in error.
+*/
+PALEXPORT int64_t CryptoNative_SslSendFile(SSL* ssl, intptr_t fd, int64_t offset, int64_t count, int32_t* error);
+
+/*
+Turns SSL_MODE_ASYNC on or off. With it on, handshake, read and write calls that reach a private key
+operation offloaded by an async capable engine or provider return PAL_SSL_ERROR_WANT_ASYNC instead
+of blocking; wait for the descriptors from SslGetAsyncWaitFds and repeat the call to resume.
+
+Returns 1 on success, 0 if the OpenSSL in use has no async support.
+*/
+PALEXPORT int32_t CryptoNative_SslSetAsyncMode(SSL* ssl, int32_t enable);
+
+/*
+Gets the descriptors that become readable when the paused async job of the SSL can resume.
+Up to count descriptors are written to fds, fdCount receives the total number.
+
+Returns 1 on success, 0 on failure.
+*/
+PALEXPORT int32_t CryptoNative_SslGetAsyncWaitFds(SSL* ssl, intptr_t* fds, int32_t count, int32_t* fdCount);
+
+/*
+Makes a hardware or thread pool offload implementation the default for private key operations of
+the process: loads the named provider on OpenSSL 3.0+, keeping the default provider for everything
+it doesn't implement, and otherwise makes the named engine the default for RSA, EC and PKEY methods.
+The implementation stays loaded for the lifetime of the process.
+
+Returns 1 on success, 0 on failure.
+*/
+PALEXPORT int32_t CryptoNative_SslLoadOffloadProvider(const char* name);
+
 /*
 Shims the SSL_do_handshake method.
 
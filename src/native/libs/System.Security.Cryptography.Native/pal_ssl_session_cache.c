@@ -0,0 +1,634 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "pal_ssl_session_cache.h"
+
+#include <assert.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define MAX_SHARD_COUNT 1024
+#define TICKET_KEY_COUNT 3
+#define TICKET_KEY_NAME_LENGTH 16
+#define TICKET_AES_KEY_LENGTH 32
+#define TICKET_HMAC_KEY_LENGTH 32
+#define TICKET_IV_LENGTH 16
+
+typedef struct SessionCacheEntry SessionCacheEntry;
+
+struct SessionCacheEntry
+{
+    SessionCacheEntry* HashNext;
+    SessionCacheEntry* LruPrev;
+    SessionCacheEntry* LruNext;
+    time_t Expiry;
+    uint32_t Hash;
+    uint32_t IdLength;
+    uint8_t Id[SSL_MAX_SSL_SESSION_ID_LENGTH];
+    long DataLength;
+    uint8_t Data[]; // the DER encoded session
+};
+
+typedef struct
+{
+    pthread_mutex_t Lock;
+    SessionCacheEntry** Buckets;
+    uint32_t BucketMask;
+    int32_t Count;
+    int32_t Capacity;
+    SessionCacheEntry* LruHead; // most recently used
+    SessionCacheEntry* LruTail; // next to evict
+} SessionCacheShard;
+
+typedef struct
+{
+    uint8_t Name[TICKET_KEY_NAME_LENGTH];
+    uint8_t AesKey[TICKET_AES_KEY_LENGTH];
+    uint8_t HmacKey[TICKET_HMAC_KEY_LENGTH];
+    time_t Created;
+} TicketKey;
+
+struct SslSessionCache
+{
+    int32_t RefCount;
+    uint32_t ShardMask;
+    int32_t TimeoutSeconds;
+    int32_t TicketKeyLifetimeSeconds;
+    pthread_rwlock_t TicketKeyLock;
+    int32_t TicketKeyCount;
+    TicketKey TicketKeys[TICKET_KEY_COUNT]; // current key first
+    SessionCacheShard Shards[];
+};
+
+static pthread_once_t g_sessionCacheIndexOnce = PTHREAD_ONCE_INIT;
+static int g_sessionCacheIndex = -1;
+
+static uint32_t RoundUpToPowerOf2(uint32_t value)
+{
+    uint32_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+
+    return result;
+}
+
+static uint32_t HashSessionId(const uint8_t* id, uint32_t length)
+{
+    // FNV-1a, session IDs are random so there's no need for anything stronger.
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = 0; i < length; i++)
+    {
+        hash = (hash ^ id[i]) * 16777619u;
+    }
+
+    return hash;
+}
+
+static void AddRefCache(SslSessionCache* cache)
+{
+    __atomic_add_fetch(&cache->RefCount, 1, __ATOMIC_RELAXED);
+}
+
+static void ReleaseCache(SslSessionCache* cache)
+{
+    if (__atomic_sub_fetch(&cache->RefCount, 1, __ATOMIC_ACQ_REL) != 0)
+    {
+        return;
+    }
+
+    for (uint32_t i = 0; i <= cache->ShardMask; i++)
+    {
+        SessionCacheShard* shard = &cache->Shards[i];
+        SessionCacheEntry* entry = shard->LruHead;
+        while (entry != NULL)
+        {
+            SessionCacheEntry* next = entry->LruNext;
+            OPENSSL_cleanse(entry->Data, (size_t)entry->DataLength);
+            free(entry);
+            entry = next;
+        }
+
+        free(shard->Buckets);
+        pthread_mutex_destroy(&shard->Lock);
+    }
+
+    OPENSSL_cleanse(cache->TicketKeys, sizeof(cache->TicketKeys));
+    pthread_rwlock_destroy(&cache->TicketKeyLock);
+    free(cache);
+}
+
+static SessionCacheShard* GetShard(SslSessionCache* cache, uint32_t hash)
+{
+    return &cache->Shards[hash & cache->ShardMask];
+}
+
+static SessionCacheEntry** GetBucket(SslSessionCache* cache, SessionCacheShard* shard, uint32_t hash)
+{
+    // The low bits already picked the shard.
+    return &shard->Buckets[(hash / (cache->ShardMask + 1)) & shard->BucketMask];
+}
+
+static void LruUnlink(SessionCacheShard* shard, SessionCacheEntry* entry)
+{
+    if (entry->LruPrev != NULL)
+    {
+        entry->LruPrev->LruNext = entry->LruNext;
+    }
+    else
+    {
+        shard->LruHead = entry->LruNext;
+    }
+
+    if (entry->LruNext != NULL)
+    {
+        entry->LruNext->LruPrev = entry->LruPrev;
+    }
+    else
+    {
+        shard->LruTail = entry->LruPrev;
+    }
+
+    entry->LruPrev = NULL;
+    entry->LruNext = NULL;
+}
+
+static void LruPushFront(SessionCacheShard* shard, SessionCacheEntry* entry)
+{
+    entry->LruPrev = NULL;
+    entry->LruNext = shard->LruHead;
+    if (shard->LruHead != NULL)
+    {
+        shard->LruHead->LruPrev = entry;
+    }
+    else
+    {
+        shard->LruTail = entry;
+    }
+
+    shard->LruHead = entry;
+}
+
+static SessionCacheEntry**
+FindEntry(SslSessionCache* cache, SessionCacheShard* shard, uint32_t hash, const uint8_t* id, uint32_t idLength)
+{
+    SessionCacheEntry** link = GetBucket(cache, shard, hash);
+    while (*link != NULL)
+    {
+        SessionCacheEntry* entry = *link;
+        if (entry->Hash == hash && entry->IdLength == idLength && memcmp(entry->Id, id, idLength) == 0)
+        {
+            break;
+        }
+
+        link = &entry->HashNext;
+    }
+
+    return link;
+}
+
+static void RemoveEntry(SslSessionCache* cache, SessionCacheShard* shard, SessionCacheEntry* entry)
+{
+    SessionCacheEntry** link = FindEntry(cache, shard, entry->Hash, entry->Id, entry->IdLength);
+    assert(*link == entry);
+
+    *link = entry->HashNext;
+    LruUnlink(shard, entry);
+    shard->Count--;
+
+    OPENSSL_cleanse(entry->Data, (size_t)entry->DataLength);
+    free(entry);
+}
+
+static SslSessionCache* GetSessionCache(SSL_CTX* ctx)
+{
+    return ctx != NULL ? (SslSessionCache*)SSL_CTX_get_ex_data(ctx, g_sessionCacheIndex) : NULL;
+}
+
+static int NewSessionCallback(SSL* ssl, SSL_SESSION* session)
+{
+    SslSessionCache* cache = GetSessionCache(SSL_get_SSL_CTX(ssl));
+    if (cache == NULL)
+    {
+        return 0;
+    }
+
+    unsigned int idLength;
+    const unsigned char* id = SSL_SESSION_get_id(session, &idLength);
+    int dataLength = i2d_SSL_SESSION(session, NULL);
+    if (idLength == 0 || idLength > SSL_MAX_SSL_SESSION_ID_LENGTH || dataLength <= 0)
+    {
+        return 0;
+    }
+
+    // Serialize outside of the lock.
+    SessionCacheEntry* entry = (SessionCacheEntry*)malloc(sizeof(SessionCacheEntry) + (size_t)dataLength);
+    if (entry == NULL)
+    {
+        return 0;
+    }
+
+    uint8_t* data = entry->Data;
+    if (i2d_SSL_SESSION(session, &data) != dataLength)
+    {
+        free(entry);
+        ERR_clear_error();
+        return 0;
+    }
+
+    memset(entry, 0, offsetof(SessionCacheEntry, Data));
+    memcpy(entry->Id, id, idLength);
+    entry->IdLength = idLength;
+    entry->Hash = HashSessionId(entry->Id, idLength);
+    entry->DataLength = dataLength;
+    entry->Expiry = time(NULL) + cache->TimeoutSeconds;
+
+    SessionCacheShard* shard = GetShard(cache, entry->Hash);
+    pthread_mutex_lock(&shard->Lock);
+
+    SessionCacheEntry** link = FindEntry(cache, shard, entry->Hash, entry->Id, idLength);
+    if (*link != NULL)
+    {
+        RemoveEntry(cache, shard, *link);
+    }
+
+    // Drop sessions that expired without being looked up again, then make room by evicting the least
+    // recently used ones.
+    while (shard->LruTail != NULL && shard->LruTail->Expiry <= time(NULL))
+    {
+        RemoveEntry(cache, shard, shard->LruTail);
+    }
+
+    while (shard->Count >= shard->Capacity && shard->LruTail != NULL)
+    {
+        RemoveEntry(cache, shard, shard->LruTail);
+    }
+
+    SessionCacheEntry** bucket = GetBucket(cache, shard, entry->Hash);
+    entry->HashNext = *bucket;
+    *bucket = entry;
+    LruPushFront(shard, entry);
+    shard->Count++;
+
+    pthread_mutex_unlock(&shard->Lock);
+
+    // We kept a copy, not a reference.
+    return 0;
+}
+
+#if OPENSSL_VERSION_NUMBER >= OPENSSL_VERSION_1_1_0_RTM
+static SSL_SESSION* GetSessionCallback(SSL* ssl, const unsigned char* id, int idLength, int* copy)
+#else
+static SSL_SESSION* GetSessionCallback(SSL* ssl, unsigned char* id, int idLength, int* copy)
+#endif
+{
+    // The returned session is a new object, OpenSSL takes over our reference.
+    *copy = 0;
+
+    SslSessionCache* cache = GetSessionCache(SSL_get_SSL_CTX(ssl));
+    if (cache == NULL || idLength <= 0 || idLength > SSL_MAX_SSL_SESSION_ID_LENGTH)
+    {
+        return NULL;
+    }
+
+    uint32_t hash = HashSessionId(id, (uint32_t)idLength);
+    SessionCacheShard* shard = GetShard(cache, hash);
+    SSL_SESSION* session = NULL;
+
+    pthread_mutex_lock(&shard->Lock);
+
+    SessionCacheEntry* entry = *FindEntry(cache, shard, hash, id, (uint32_t)idLength);
+    if (entry != NULL)
+    {
+        if (entry->Expiry <= time(NULL))
+        {
+            RemoveEntry(cache, shard, entry);
+        }
+        else
+        {
+            LruUnlink(shard, entry);
+            LruPushFront(shard, entry);
+
+            const unsigned char* data = entry->Data;
+            session = d2i_SSL_SESSION(NULL, &data, entry->DataLength);
+        }
+    }
+
+    pthread_mutex_unlock(&shard->Lock);
+
+    if (session == NULL)
+    {
+        ERR_clear_error();
+    }
+
+    return session;
+}
+
+static void RemoveSessionCallback(SSL_CTX* ctx, SSL_SESSION* session)
+{
+    SslSessionCache* cache = GetSessionCache(ctx);
+    if (cache == NULL)
+    {
+        return;
+    }
+
+    unsigned int idLength;
+    const unsigned char* id = SSL_SESSION_get_id(session, &idLength);
+    if (idLength == 0 || idLength > SSL_MAX_SSL_SESSION_ID_LENGTH)
+    {
+        return;
+    }
+
+    uint32_t hash = HashSessionId(id, idLength);
+    SessionCacheShard* shard = GetShard(cache, hash);
+
+    pthread_mutex_lock(&shard->Lock);
+
+    SessionCacheEntry* entry = *FindEntry(cache, shard, hash, id, idLength);
+    if (entry != NULL)
+    {
+        RemoveEntry(cache, shard, entry);
+    }
+
+    pthread_mutex_unlock(&shard->Lock);
+}
+
+static bool GetCurrentTicketKey(SslSessionCache* cache, TicketKey* key)
+{
+    time_t now = time(NULL);
+
+    pthread_rwlock_rdlock(&cache->TicketKeyLock);
+    bool current = cache->TicketKeyCount > 0 && now - cache->TicketKeys[0].Created < cache->TicketKeyLifetimeSeconds;
+    if (current)
+    {
+        *key = cache->TicketKeys[0];
+    }
+    pthread_rwlock_unlock(&cache->TicketKeyLock);
+
+    if (current)
+    {
+        return true;
+    }
+
+    bool ret = true;
+    pthread_rwlock_wrlock(&cache->TicketKeyLock);
+
+    // Somebody else may have rotated the key while we waited for the lock.
+    if (cache->TicketKeyCount == 0 || now - cache->TicketKeys[0].Created >= cache->TicketKeyLifetimeSeconds)
+    {
+        TicketKey newKey;
+        if (RAND_bytes(newKey.Name, sizeof(newKey.Name)) == 1 &&
+            RAND_bytes(newKey.AesKey, sizeof(newKey.AesKey)) == 1 &&
+            RAND_bytes(newKey.HmacKey, sizeof(newKey.HmacKey)) == 1)
+        {
+            // Keep the previous keys around so the tickets they sealed still resume, just get reissued.
+            OPENSSL_cleanse(&cache->TicketKeys[TICKET_KEY_COUNT - 1], sizeof(TicketKey));
+            memmove(&cache->TicketKeys[1], &cache->TicketKeys[0], sizeof(TicketKey) * (TICKET_KEY_COUNT - 1));
+
+            newKey.Created = now;
+            cache->TicketKeys[0] = newKey;
+            if (cache->TicketKeyCount < TICKET_KEY_COUNT)
+            {
+                cache->TicketKeyCount++;
+            }
+        }
+        else if (cache->TicketKeyCount == 0)
+        {
+            ret = false;
+        }
+
+        OPENSSL_cleanse(&newKey, sizeof(newKey));
+    }
+
+    if (ret)
+    {
+        *key = cache->TicketKeys[0];
+    }
+
+    pthread_rwlock_unlock(&cache->TicketKeyLock);
+    return ret;
+}
+
+static int FindTicketKey(SslSessionCache* cache, const unsigned char* name, TicketKey* key)
+{
+    time_t now = time(NULL);
+    int index = -1;
+
+    pthread_rwlock_rdlock(&cache->TicketKeyLock);
+    for (int i = 0; i < cache->TicketKeyCount; i++)
+    {
+        // Retired keys also stop being accepted if nothing has rotated them out.
+        if (memcmp(cache->TicketKeys[i].Name, name, TICKET_KEY_NAME_LENGTH) == 0 &&
+            now - cache->TicketKeys[i].Created < (time_t)cache->TicketKeyLifetimeSeconds * TICKET_KEY_COUNT)
+        {
+            *key = cache->TicketKeys[i];
+            index = i;
+            break;
+        }
+    }
+    pthread_rwlock_unlock(&cache->TicketKeyLock);
+
+    return index;
+}
+
+static int TicketKeyCallback(
+    SSL* ssl, unsigned char* keyName, unsigned char* iv, EVP_CIPHER_CTX* cipherCtx, HMAC_CTX* hmacCtx, int enc)
+{
+    SslSessionCache* cache = GetSessionCache(SSL_get_SSL_CTX(ssl));
+    if (cache == NULL)
+    {
+        // -1 fails sealing the ticket, 0 declines it so we do a full handshake.
+        return enc ? -1 : 0;
+    }
+
+    TicketKey key;
+    int ret;
+
+    if (enc)
+    {
+        if (!GetCurrentTicketKey(cache, &key))
+        {
+            return -1;
+        }
+
+        memcpy(keyName, key.Name, TICKET_KEY_NAME_LENGTH);
+        ret = RAND_bytes(iv, TICKET_IV_LENGTH) == 1 &&
+              EVP_CipherInit_ex(cipherCtx, EVP_aes_256_cbc(), NULL, key.AesKey, iv, 1) == 1 &&
+              HMAC_Init_ex(hmacCtx, key.HmacKey, TICKET_HMAC_KEY_LENGTH, EVP_sha256(), NULL) == 1 ? 1 : -1;
+    }
+    else
+    {
+        int index = FindTicketKey(cache, keyName, &key);
+        if (index < 0)
+        {
+            return 0;
+        }
+
+        // 2 tells OpenSSL to issue a new ticket under the current key.
+        ret = HMAC_Init_ex(hmacCtx, key.HmacKey, TICKET_HMAC_KEY_LENGTH, EVP_sha256(), NULL) == 1 &&
+              EVP_CipherInit_ex(cipherCtx, EVP_aes_256_cbc(), NULL, key.AesKey, iv, 0) == 1 ? (index == 0 ? 1 : 2) : -1;
+    }
+
+    OPENSSL_cleanse(&key, sizeof(key));
+    return ret;
+}
+
+static void SessionCacheExDataFree(void* parent, void* ptr, CRYPTO_EX_DATA* ad, int idx, long argl, void* argp)
+{
+    (void)parent;
+    (void)ad;
+    (void)idx;
+    (void)argl;
+    (void)argp;
+
+    if (ptr != NULL)
+    {
+        ReleaseCache((SslSessionCache*)ptr);
+    }
+}
+
+static void InitializeSessionCacheIndex(void)
+{
+    // In OpenSSL 1.1.0+, CRYPTO_EX_INDEX_SSL_CTX is 1.
+    g_sessionCacheIndex = CRYPTO_get_ex_new_index(1, 0, NULL, NULL, NULL, SessionCacheExDataFree);
+}
+
+SslSessionCache* CryptoNative_SslSessionCacheCreate(int32_t shardCount,
+                                                    int32_t capacity,
+                                                    int32_t timeoutSeconds,
+                                                    int32_t ticketKeyLifetimeSeconds)
+{
+    if (shardCount <= 0 || shardCount > MAX_SHARD_COUNT || capacity <= 0 || timeoutSeconds <= 0 ||
+        ticketKeyLifetimeSeconds < 0)
+    {
+        return NULL;
+    }
+
+    uint32_t shards = RoundUpToPowerOf2((uint32_t)shardCount);
+    int32_t shardCapacity = capacity / (int32_t)shards;
+    if (shardCapacity == 0)
+    {
+        shardCapacity = 1;
+    }
+
+    SslSessionCache* cache =
+        (SslSessionCache*)calloc(1, sizeof(SslSessionCache) + sizeof(SessionCacheShard) * shards);
+    if (cache == NULL)
+    {
+        return NULL;
+    }
+
+    cache->RefCount = 1;
+    cache->ShardMask = shards - 1;
+    cache->TimeoutSeconds = timeoutSeconds;
+    cache->TicketKeyLifetimeSeconds = ticketKeyLifetimeSeconds;
+
+    if (pthread_rwlock_init(&cache->TicketKeyLock, NULL) != 0)
+    {
+        free(cache);
+        return NULL;
+    }
+
+    uint32_t bucketCount = RoundUpToPowerOf2((uint32_t)shardCapacity);
+    for (uint32_t i = 0; i < shards; i++)
+    {
+        SessionCacheShard* shard = &cache->Shards[i];
+        shard->Capacity = shardCapacity;
+        shard->BucketMask = bucketCount - 1;
+        shard->Buckets = (SessionCacheEntry**)calloc(bucketCount, sizeof(SessionCacheEntry*));
+
+        if (shard->Buckets == NULL || pthread_mutex_init(&shard->Lock, NULL) != 0)
+        {
+            free(shard->Buckets);
+            for (uint32_t j = 0; j < i; j++)
+            {
+                free(cache->Shards[j].Buckets);
+                pthread_mutex_destroy(&cache->Shards[j].Lock);
+            }
+
+            pthread_rwlock_destroy(&cache->TicketKeyLock);
+            free(cache);
+            return NULL;
+        }
+    }
+
+    return cache;
+}
+
+void CryptoNative_SslSessionCacheDestroy(SslSessionCache* cache)
+{
+    if (cache != NULL)
+    {
+        ReleaseCache(cache);
+    }
+}
+
+int32_t CryptoNative_SslCtxSetSessionCache(SSL_CTX* ctx, SslSessionCache* cache)
+{
+    assert(cache != NULL);
+
+    // Same cut off as SslCtxSetCaching, which disables resumption before 1.1.1.
+    if (!API_EXISTS(SSL_SESSION_get0_hostname))
+    {
+        return 0;
+    }
+
+    pthread_once(&g_sessionCacheIndexOnce, InitializeSessionCacheIndex);
+    if (g_sessionCacheIndex < 0)
+    {
+        return 0;
+    }
+
+    ERR_clear_error();
+
+    SslSessionCache* previous = GetSessionCache(ctx);
+    if (previous == cache)
+    {
+        return 1;
+    }
+
+    AddRefCache(cache);
+    if (!SSL_CTX_set_ex_data(ctx, g_sessionCacheIndex, cache))
+    {
+        ReleaseCache(cache);
+        return 0;
+    }
+
+    if (previous != NULL)
+    {
+        ReleaseCache(previous);
+    }
+
+    SSL_CTX_ctrl(ctx, SSL_CTRL_SET_SESS_CACHE_MODE, SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_NO_INTERNAL, NULL);
+    SSL_CTX_sess_set_new_cb(ctx, NewSessionCallback);
+    SSL_CTX_sess_set_get_cb(ctx, GetSessionCallback);
+    SSL_CTX_sess_set_remove_cb(ctx, RemoveSessionCallback);
+
+    if (cache->TicketKeyLifetimeSeconds > 0)
+    {
+        SSL_CTX_callback_ctrl(ctx, SSL_CTRL_SET_TLSEXT_TICKET_KEY_CB, (void (*)(void))TicketKeyCallback);
+    }
+
+    return 1;
+}
+
+int32_t CryptoNative_SslSessionCacheGetCount(SslSessionCache* cache)
+{
+    assert(cache != NULL);
+
+    int32_t count = 0;
+    for (uint32_t i = 0; i <= cache->ShardMask; i++)
+    {
+        SessionCacheShard* shard = &cache->Shards[i];
+        pthread_mutex_lock(&shard->Lock);
+        count += shard->Count;
+        pthread_mutex_unlock(&shard->Lock);
+    }
+
+    return count;
+}
@@ -0,0 +1,50 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "pal_types.h"
+#include "pal_compiler.h"
+#include "opensslshim.h"
+
+/*
+A server side TLS session cache that can be shared by any number of SSL_CTX instances.
+
+Sessions are stored serialized, in shards picked by session ID, each with its own lock and LRU
+list, so a lookup only contends with lookups that hash to the same shard. When a shard is full the
+least recently used session is evicted. The cache also owns the session ticket keys: a new key is
+generated when the current one is older than the ticket key lifetime, and tickets sealed with one
+of the retained previous keys are still accepted and get reissued with the current key.
+*/
+typedef struct SslSessionCache SslSessionCache;
+
+/*
+Creates a session cache.
+
+shardCount is rounded up to a power of two, capacity is the total number of sessions kept, and
+sessions and ticket keys are retired after timeoutSeconds and ticketKeyLifetimeSeconds.
+A ticketKeyLifetimeSeconds of zero leaves ticket handling to OpenSSL.
+
+Returns NULL on failure.
+*/
+PALEXPORT SslSessionCache* CryptoNative_SslSessionCacheCreate(int32_t shardCount,
+                                                              int32_t capacity,
+                                                              int32_t timeoutSeconds,
+                                                              int32_t ticketKeyLifetimeSeconds);
+
+/*
+Releases the reference returned by SslSessionCacheCreate. The cache itself stays alive until every
+SSL_CTX it was attached to has been freed.
+*/
+PALEXPORT void CryptoNative_SslSessionCacheDestroy(SslSessionCache* cache);
+
+/*
+Makes ctx store and look up server sessions, and seal tickets, with the given cache instead of
+its internal cache. The session ID context should be set with SslCtxSetCaching first.
+
+Returns 1 on success, 0 if the cache can't be used with the OpenSSL in use (before 1.1.1).
+*/
+PALEXPORT int32_t CryptoNative_SslCtxSetSessionCache(SSL_CTX* ctx, SslSessionCache* cache);
+
+/*
+Returns the number of sessions currently held by the cache.
+*/
+PALEXPORT int32_t CryptoNative_SslSessionCacheGetCount(SslSessionCache* cache);
@@ -10,6 +10,7 @@
 #include <unistd.h>
 #include <time.h>
 #include <errno.h>
+#include <string.h>
 #if defined(__APPLE__) && __APPLE__
 #include <CommonCrypto/CommonRandom.h>
 #endif
@@ -17,6 +18,14 @@
 #include "minipalconfig.h"
 #include "random.h"
 
+#if HAVE_GETRANDOM
+#include <sys/random.h>
+#endif
+#if !defined(__EMSCRIPTEN__) && !defined(__wasi__) && !(defined(__APPLE__) && __APPLE__)
+#define USE_RANDOM_CACHE 1
+#include <pthread.h>
+#endif
+
 /*
 
 Generate random bytes. The generated bytes are not cryptographically strong.
@@ -58,35 +67,44 @@ void minipal_get_non_cryptographically_secure_random_bytes(uint8_t* buffer, int3
 #endif // HAVE_ARC4RANDOM_BUF
 }
 
-/*
+#if !defined(__EMSCRIPTEN__) && !(defined(__APPLE__) && __APPLE__)
 
-Generate cryptographically strong random bytes.
-
-Return 0 on success, -1 on failure.
-*/
-int32_t minipal_get_cryptographically_secure_random_bytes(uint8_t* buffer, int32_t bufferLength)
+static int32_t get_os_random_bytes(uint8_t* buffer, int32_t bufferLength)
 {
-    assert(buffer != NULL);
+#if HAVE_GETRANDOM
+    static bool sMissingGetRandom;
 
-#ifdef __EMSCRIPTEN__
-    extern int32_t mono_wasm_browser_entropy(uint8_t* buffer, int32_t bufferLength);
-    static bool sMissingBrowserCrypto;
-    if (!sMissingBrowserCrypto)
+    if (!sMissingGetRandom)
     {
-        int32_t bff = mono_wasm_browser_entropy(buffer, bufferLength);
-        if (bff == -1)
-            sMissingBrowserCrypto = true;
-        else
-            return 0;
-    }
-#elif defined(__APPLE__) && __APPLE__
-    CCRNGStatus status = CCRandomGenerateBytes(buffer, (size_t)bufferLength);
+        int32_t offset = 0;
+        do
+        {
+            ssize_t n = getrandom(buffer + offset, (size_t)(bufferLength - offset), 0);
+            if (n == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                if (errno == ENOSYS)
+                {
+                    // Kernels older than 3.17, use /dev/urandom instead
+                    sMissingGetRandom = true;
+                    break;
+                }
+                return -1;
+            }
 
-    if (status == kCCSuccess)
-    {
-        return 0;
+            offset += n;
+        }
+        while (offset != bufferLength);
+
+        if (!sMissingGetRandom)
+        {
+            return 0;
+        }
     }
-#else
+#endif // HAVE_GETRANDOM
 
     static volatile int rand_des = -1;
     static bool sMissingDevURandom;
@@ -144,6 +162,120 @@ int32_t minipal_get_cryptographically_secure_random_bytes(uint8_t* buffer, int32
             return 0;
         }
     }
+
+    return -1;
+}
+
+#ifdef USE_RANDOM_CACHE
+
+// Small requests (GUIDs, random ids) are served from a per-thread cache of bytes read from the
+// OS in one go, so that they don't cost a syscall each. The bytes still come straight from the
+// kernel CSPRNG; they are handed out at most once and wiped as they are consumed.
+#define RANDOM_CACHE_SIZE 512
+#define RANDOM_CACHE_MAX_REQUEST 64
+
+typedef struct
+{
+    uint8_t bytes[RANDOM_CACHE_SIZE];
+    int32_t available;
+    uint32_t forkGeneration;
+} random_cache_t;
+
+static __thread random_cache_t t_randomCache;
+
+// Bumped in the child after fork() so the copy of the forking thread's cache is discarded,
+// otherwise parent and child would hand out the same bytes.
+static volatile uint32_t s_forkGeneration = 1;
+static pthread_once_t s_atforkOnce = PTHREAD_ONCE_INIT;
+static bool s_atforkRegistered;
+
+static void random_cache_after_fork_child(void)
+{
+    s_forkGeneration++;
+}
+
+static void random_cache_register_atfork(void)
+{
+    s_atforkRegistered = pthread_atfork(NULL, NULL, random_cache_after_fork_child) == 0;
+}
+
+static bool try_get_cached_random_bytes(uint8_t* buffer, int32_t bufferLength)
+{
+    pthread_once(&s_atforkOnce, random_cache_register_atfork);
+    if (!s_atforkRegistered)
+    {
+        return false;
+    }
+
+    random_cache_t* cache = &t_randomCache;
+    uint32_t forkGeneration = __atomic_load_n(&s_forkGeneration, __ATOMIC_ACQUIRE);
+    if (cache->forkGeneration != forkGeneration)
+    {
+        memset(cache->bytes, 0, sizeof(cache->bytes));
+        cache->available = 0;
+        cache->forkGeneration = forkGeneration;
+    }
+
+    if (cache->available < bufferLength)
+    {
+        if (get_os_random_bytes(cache->bytes, RANDOM_CACHE_SIZE) != 0)
+        {
+            cache->available = 0;
+            return false;
+        }
+
+        cache->available = RANDOM_CACHE_SIZE;
+    }
+
+    // Consume from the end so the remaining bytes stay at the start of the cache
+    uint8_t* source = cache->bytes + cache->available - bufferLength;
+    memcpy(buffer, source, (size_t)bufferLength);
+    memset(source, 0, (size_t)bufferLength);
+    cache->available -= bufferLength;
+    return true;
+}
+
+#endif // USE_RANDOM_CACHE
+
+#endif // !__EMSCRIPTEN__ && !__APPLE__
+
+/*
+
+Generate cryptographically strong random bytes.
+
+Return 0 on success, -1 on failure.
+*/
+int32_t minipal_get_cryptographically_secure_random_bytes(uint8_t* buffer, int32_t bufferLength)
+{
+    assert(buffer != NULL);
+
+#ifdef __EMSCRIPTEN__
+    extern int32_t mono_wasm_browser_entropy(uint8_t* buffer, int32_t bufferLength);
+    static bool sMissingBrowserCrypto;
+    if (!sMissingBrowserCrypto)
+    {
+        int32_t bff = mono_wasm_browser_entropy(buffer, bufferLength);
+        if (bff == -1)
+            sMissingBrowserCrypto = true;
+        else
+            return 0;
+    }
+#elif defined(__APPLE__) && __APPLE__
+    CCRNGStatus status = CCRandomGenerateBytes(buffer, (size_t)bufferLength);
+
+    if (status == kCCSuccess)
+    {
+        return 0;
+    }
+#else
+#ifdef USE_RANDOM_CACHE
+    if ((bufferLength <= RANDOM_CACHE_MAX_REQUEST) && try_get_cached_random_bytes(buffer, bufferLength))
+    {
+        return 0;
+    }
+#endif // USE_RANDOM_CACHE
+
+    return get_os_random_bytes(buffer, bufferLength);
 #endif
     return -1;
 }
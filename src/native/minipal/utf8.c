@@ -8,6 +8,18 @@
 #include <string.h>
 #include <assert.h>
 
+// Leading ASCII runs are handled 16 elements at a time with the SIMD instructions
+// that are part of the baseline ISA, so no runtime dispatch is needed.
+#if !BIGENDIAN
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define MINIPAL_UTF8_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define MINIPAL_UTF8_NEON
+#endif
+#endif // !BIGENDIAN
+
 #define HIGH_SURROGATE_START 0xd800
 #define HIGH_SURROGATE_END 0xdbff
 #define LOW_SURROGATE_START 0xdc00
@@ -2055,13 +2067,105 @@ static size_t GetByteCount(UTF8Encoding* self, CHAR16_T *chars, size_t count)
     return byteCount;
 }
 
+// Returns the length of the ASCII prefix of the UTF-8 source, in whole 16 byte blocks.
+// If destination is not NULL, the prefix is also widened into it.
+static size_t ConvertAsciiPrefixUtf8(const unsigned char* source, size_t length, CHAR16_T* destination)
+{
+    size_t i = 0;
+
+#if defined(MINIPAL_UTF8_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= length; i += 16)
+    {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(source + i));
+        if (_mm_movemask_epi8(bytes) != 0)
+            break;
+
+        if (destination != NULL)
+        {
+            _mm_storeu_si128((__m128i*)(destination + i), _mm_unpacklo_epi8(bytes, zero));
+            _mm_storeu_si128((__m128i*)(destination + i + 8), _mm_unpackhi_epi8(bytes, zero));
+        }
+    }
+#elif defined(MINIPAL_UTF8_NEON)
+    for (; i + 16 <= length; i += 16)
+    {
+        uint8x16_t bytes = vld1q_u8(source + i);
+        if (vmaxvq_u8(bytes) > 0x7F)
+            break;
+
+        if (destination != NULL)
+        {
+            vst1q_u16((uint16_t*)(destination + i), vmovl_u8(vget_low_u8(bytes)));
+            vst1q_u16((uint16_t*)(destination + i + 8), vmovl_high_u8(bytes));
+        }
+    }
+#else
+    (void)source;
+    (void)length;
+    (void)destination;
+#endif
+
+    return i;
+}
+
+// Returns the length of the ASCII prefix of the UTF-16 source, in whole 16 char blocks.
+// If destination is not NULL, the prefix is also narrowed into it.
+static size_t ConvertAsciiPrefixUtf16(const CHAR16_T* source, size_t length, unsigned char* destination)
+{
+    size_t i = 0;
+
+#if defined(MINIPAL_UTF8_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i nonAsciiMask = _mm_set1_epi16((short)0xFF80);
+    for (; i + 16 <= length; i += 16)
+    {
+        __m128i lower = _mm_loadu_si128((const __m128i*)(source + i));
+        __m128i upper = _mm_loadu_si128((const __m128i*)(source + i + 8));
+        __m128i nonAscii = _mm_and_si128(_mm_or_si128(lower, upper), nonAsciiMask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, zero)) != 0xFFFF)
+            break;
+
+        if (destination != NULL)
+        {
+            _mm_storeu_si128((__m128i*)(destination + i), _mm_packus_epi16(lower, upper));
+        }
+    }
+#elif defined(MINIPAL_UTF8_NEON)
+    for (; i + 16 <= length; i += 16)
+    {
+        uint16x8_t lower = vld1q_u16((const uint16_t*)(source + i));
+        uint16x8_t upper = vld1q_u16((const uint16_t*)(source + i + 8));
+        if (vmaxvq_u16(vorrq_u16(lower, upper)) > 0x7F)
+            break;
+
+        if (destination != NULL)
+        {
+            vst1q_u8(destination + i, vcombine_u8(vmovn_u16(lower), vmovn_u16(upper)));
+        }
+    }
+#else
+    (void)source;
+    (void)length;
+    (void)destination;
+#endif
+
+    return i;
+}
+
 size_t minipal_get_length_utf8_to_utf16(const char* source, size_t sourceLength, unsigned int flags)
 {
+    size_t ret;
     errno = 0;
 
     if (sourceLength == 0)
         return 0;
 
+    // ASCII maps one to one, so only the rest needs to go through the decoder
+    size_t asciiLength = ConvertAsciiPrefixUtf8((const unsigned char*)source, sourceLength, NULL);
+    if (asciiLength == sourceLength)
+        return asciiLength;
+
     UTF8Encoding enc =
     {
         .buffer = { .decoder = { .fallbackCount = -1, .fallbackIndex = -1, .strDefault = { 0xFFFD, 0 }, .strDefaultLength = 1 } },
@@ -2071,16 +2175,24 @@ size_t minipal_get_length_utf8_to_utf16(const char* source, size_t sourceLength,
 #endif
     };
 
-    return GetCharCount(&enc, (unsigned char*)source, sourceLength);
+    ret = GetCharCount(&enc, (unsigned char*)source + asciiLength, sourceLength - asciiLength);
+    if (errno) return 0;
+
+    return asciiLength + ret;
 }
 
 size_t minipal_get_length_utf16_to_utf8(const CHAR16_T* source, size_t sourceLength, unsigned int flags)
 {
+    size_t ret;
     errno = 0;
 
     if (sourceLength == 0)
         return 0;
 
+    size_t asciiLength = ConvertAsciiPrefixUtf16(source, sourceLength, NULL);
+    if (asciiLength == sourceLength)
+        return asciiLength;
+
     UTF8Encoding enc =
     {
         // repeat replacement char (0xFFFD) twice for a surrogate pair
@@ -2095,7 +2207,10 @@ size_t minipal_get_length_utf16_to_utf8(const CHAR16_T* source, size_t sourceLen
     (void)flags; // unused
 #endif
 
-    return GetByteCount(&enc, (CHAR16_T*)source, sourceLength);
+    ret = GetByteCount(&enc, (CHAR16_T*)source + asciiLength, sourceLength - asciiLength);
+    if (errno) return 0;
+
+    return asciiLength + ret;
 }
 
 size_t minipal_convert_utf8_to_utf16(const char* source, size_t sourceLength, CHAR16_T* destination, size_t destinationLength, unsigned int flags)
@@ -2106,6 +2221,10 @@ size_t minipal_convert_utf8_to_utf16(const char* source, size_t sourceLength, CH
     if (sourceLength == 0)
         return 0;
 
+    size_t asciiLength = ConvertAsciiPrefixUtf8((const unsigned char*)source, sourceLength < destinationLength ? sourceLength : destinationLength, destination);
+    if (asciiLength == sourceLength)
+        return asciiLength;
+
     UTF8Encoding enc =
     {
         .buffer = { .decoder = { .fallbackCount = -1, .fallbackIndex = -1, .strDefault = { 0xFFFD, 0 }, .strDefaultLength = 1 } },
@@ -2115,10 +2234,10 @@ size_t minipal_convert_utf8_to_utf16(const char* source, size_t sourceLength, CH
 #endif
     };
 
-    ret = GetChars(&enc, (unsigned char*)source, sourceLength, destination, destinationLength);
-    if (errno) ret = 0;
+    ret = GetChars(&enc, (unsigned char*)source + asciiLength, sourceLength - asciiLength, destination + asciiLength, destinationLength - asciiLength);
+    if (errno) return 0;
 
-    return ret;
+    return asciiLength + ret;
 }
 
 size_t minipal_convert_utf16_to_utf8(const CHAR16_T* source, size_t sourceLength, char* destination, size_t destinationLength, unsigned int flags)
@@ -2129,6 +2248,10 @@ size_t minipal_convert_utf16_to_utf8(const CHAR16_T* source, size_t sourceLength
     if (sourceLength == 0)
         return 0;
 
+    size_t asciiLength = ConvertAsciiPrefixUtf16(source, sourceLength < destinationLength ? sourceLength : destinationLength, (unsigned char*)destination);
+    if (asciiLength == sourceLength)
+        return asciiLength;
+
     UTF8Encoding enc =
     {
         // repeat replacement char (0xFFFD) twice for a surrogate pair
@@ -2143,8 +2266,8 @@ size_t minipal_convert_utf16_to_utf8(const CHAR16_T* source, size_t sourceLength
     (void)flags; // unused
 #endif
 
-    ret = GetBytes(&enc, (CHAR16_T*)source, sourceLength, (unsigned char*)destination, destinationLength);
-    if (errno) ret = 0;
+    ret = GetBytes(&enc, (CHAR16_T*)source + asciiLength, sourceLength - asciiLength, (unsigned char*)destination + asciiLength, destinationLength - asciiLength);
+    if (errno) return 0;
 
-    return ret;
+    return asciiLength + ret;
 }
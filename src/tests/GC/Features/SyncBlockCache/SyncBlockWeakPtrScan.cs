@@ -0,0 +1,177 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime;
+using System.Runtime.CompilerServices;
+using System.Threading;
+using Xunit;
+
+// With server GC every GC thread scans its own part of the sync block cache for entries
+// whose objects died. Objects with sync blocks are allocated from several threads so that
+// they live on different heaps and their entries end up in different partitions. Half of
+// them die in every round; the survivors must keep their hash codes and lock state through
+// ephemeral, full and background GCs, and the freed entries must be reusable.
+public class SyncBlockWeakPtrScan
+{
+    const int Rounds = 20;
+    const int ObjectsPerThread = 5000;
+
+    class Node
+    {
+        public int Id;
+    }
+
+    class Survivors
+    {
+        public Node[] Objects;
+        public int[] HashCodes;
+    }
+
+    static int s_threadCount = Math.Clamp(Environment.ProcessorCount, 4, 16);
+
+    // Gives the object a sync block: the hash code takes the header, so the lock can't be thin
+    static void InflateSyncBlock(Node node)
+    {
+        node.GetHashCode();
+        lock (node)
+        {
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    static Survivors AllocateRound(int thread, int round, WeakReference[] dead)
+    {
+        var survivors = new Survivors
+        {
+            Objects = new Node[ObjectsPerThread / 2],
+            HashCodes = new int[ObjectsPerThread / 2]
+        };
+
+        for (int i = 0; i < ObjectsPerThread; i++)
+        {
+            var node = new Node { Id = (thread << 24) | (round << 16) | i };
+            InflateSyncBlock(node);
+
+            if ((i & 1) == 0)
+            {
+                survivors.Objects[i / 2] = node;
+                survivors.HashCodes[i / 2] = node.GetHashCode();
+            }
+            else if ((i % 97) == 1)
+            {
+                dead[i / 97] = new WeakReference(node);
+            }
+        }
+
+        return survivors;
+    }
+
+    static void Collect(int round)
+    {
+        switch (round % 4)
+        {
+            case 0:
+                GC.Collect(0);
+                break;
+            case 1:
+                GC.Collect(1);
+                break;
+            case 2:
+                GC.Collect(2, GCCollectionMode.Forced, blocking: true, compacting: true);
+                break;
+            default:
+                GC.Collect(2, GCCollectionMode.Forced, blocking: false);
+                break;
+        }
+    }
+
+    static void Verify(Survivors survivors)
+    {
+        for (int i = 0; i < survivors.Objects.Length; i++)
+        {
+            Node node = survivors.Objects[i];
+            Assert.Equal(survivors.HashCodes[i], node.GetHashCode());
+            Assert.False(Monitor.IsEntered(node));
+
+            lock (node)
+            {
+                Assert.True(Monitor.IsEntered(node));
+            }
+        }
+    }
+
+    [Fact]
+    public static void TestEntryPoint()
+    {
+        Assert.True(GCSettings.IsServerGC, "the test is meant to run with server GC");
+
+        var survivors = new Survivors[s_threadCount][];
+        var held = new Node[s_threadCount];
+        using var heldLocksTaken = new CountdownEvent(s_threadCount);
+        using var releaseHeldLocks = new ManualResetEventSlim();
+
+        var threads = new Thread[s_threadCount];
+        for (int t = 0; t < s_threadCount; t++)
+        {
+            int thread = t;
+            survivors[thread] = new Survivors[Rounds];
+            threads[t] = new Thread(() =>
+            {
+                // A lock held on another thread through all the GCs
+                held[thread] = new Node { Id = thread };
+                InflateSyncBlock(held[thread]);
+                Monitor.Enter(held[thread]);
+                heldLocksTaken.Signal();
+
+                for (int round = 0; round < Rounds; round++)
+                {
+                    var dead = new WeakReference[ObjectsPerThread / 97 + 1];
+                    survivors[thread][round] = AllocateRound(thread, round, dead);
+                    Collect(round);
+
+                    foreach (WeakReference weak in dead)
+                    {
+                        if (weak != null)
+                        {
+                            GC.Collect();
+                            Assert.False(weak.IsAlive);
+                            break;
+                        }
+                    }
+
+                    for (int older = 0; older <= round; older++)
+                    {
+                        Verify(survivors[thread][older]);
+                    }
+                }
+
+                releaseHeldLocks.Wait();
+                Assert.True(Monitor.IsEntered(held[thread]));
+                Monitor.Exit(held[thread]);
+            });
+            threads[t].Start();
+        }
+
+        heldLocksTaken.Wait();
+        foreach (Node node in held)
+        {
+            Assert.False(Monitor.TryEnter(node));
+        }
+
+        releaseHeldLocks.Set();
+        foreach (Thread thread in threads)
+        {
+            thread.Join();
+        }
+
+        GC.Collect();
+        foreach (Survivors[] perThread in survivors)
+        {
+            foreach (Survivors round in perThread)
+            {
+                Verify(round);
+            }
+        }
+    }
+}
@@ -0,0 +1,252 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using Xunit;
+
+// Loops that store the same value into consecutive array elements may be replaced by a
+// block initialization (JitDoLoopFillBlockInit). Checks that the transformed loops, and
+// the similar loops that must be left alone, store exactly the elements they should.
+public class LoopFillBlockInit
+{
+    const int Sentinel = 0x33;
+
+    static int[] NewInts(int length)
+    {
+        int[] array = new int[length];
+        Array.Fill(array, Sentinel);
+        return array;
+    }
+
+    static byte[] NewBytes(int length)
+    {
+        byte[] array = new byte[length];
+        Array.Fill(array, (byte)Sentinel);
+        return array;
+    }
+
+    static void VerifyRange<T>(T[] array, int start, int end, T inside, T outside)
+    {
+        for (int i = 0; i < array.Length; i++)
+        {
+            T expected = ((i >= start) && (i < end)) ? inside : outside;
+            Assert.True(Equals(array[i], expected), $"element {i} is {array[i]}, expected {expected}");
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void ZeroAll(int[] array)
+    {
+        for (int i = 0; i < array.Length; i++)
+        {
+            array[i] = 0;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void ZeroRange(int[] array, int start, int end)
+    {
+        for (int i = start; i < end; i++)
+        {
+            array[i] = 0;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void ZeroFromConstant(long[] array)
+    {
+        for (int i = 3; i < array.Length; i++)
+        {
+            array[i] = 0;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void FillBytes(byte[] array, int start, int end)
+    {
+        for (int i = start; i < end; i++)
+        {
+            array[i] = 0x5A;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void FillSBytes(sbyte[] array)
+    {
+        for (int i = 0; i < array.Length; i++)
+        {
+            array[i] = -1;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void FillInts(int[] array)
+    {
+        for (int i = 0; i < array.Length; i++)
+        {
+            array[i] = 0x5A5A5A5A;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void FillNegativeZero(double[] array)
+    {
+        for (int i = 0; i < array.Length; i++)
+        {
+            array[i] = -0.0;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void ClearObjects(object[] array, int start, int end)
+    {
+        for (int i = start; i < end; i++)
+        {
+            array[i] = null;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void FillStrings(string[] array)
+    {
+        for (int i = 0; i < array.Length; i++)
+        {
+            array[i] = "fill";
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void ZeroTwoArrays(int[] first, int[] second)
+    {
+        for (int i = 0; i < first.Length; i++)
+        {
+            first[i] = 0;
+            second[i] = 0;
+        }
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static void CopyForward(int[] array)
+    {
+        for (int i = 1; i < array.Length; i++)
+        {
+            array[i] = array[i - 1];
+        }
+    }
+
+    [Fact]
+    public static void ZeroFills()
+    {
+        foreach (int length in new[] { 0, 1, 7, 8, 33, 1000 })
+        {
+            int[] array = NewInts(length);
+            ZeroAll(array);
+            VerifyRange(array, 0, length, 0, Sentinel);
+        }
+
+        long[] longs = new long[20];
+        Array.Fill(longs, -1L);
+        ZeroFromConstant(longs);
+        VerifyRange(longs, 3, 20, 0L, -1L);
+
+        long[] shortLongs = new long[2];
+        Array.Fill(shortLongs, -1L);
+        ZeroFromConstant(shortLongs);
+        VerifyRange(shortLongs, 0, 0, 0L, -1L);
+    }
+
+    [Fact]
+    public static void PartialFills()
+    {
+        int[] array = NewInts(64);
+        ZeroRange(array, 5, 59);
+        VerifyRange(array, 5, 59, 0, Sentinel);
+
+        array = NewInts(64);
+        ZeroRange(array, 63, 64);
+        VerifyRange(array, 63, 64, 0, Sentinel);
+
+        // Empty ranges must not store anything
+        array = NewInts(64);
+        ZeroRange(array, 10, 10);
+        ZeroRange(array, 20, 10);
+        VerifyRange(array, 0, 0, 0, Sentinel);
+
+        array = NewInts(16);
+        Assert.Throws<IndexOutOfRangeException>(() => ZeroRange(array, 8, 17));
+        VerifyRange(array, 8, 16, 0, Sentinel);
+    }
+
+    [Fact]
+    public static void NonZeroFills()
+    {
+        byte[] bytes = NewBytes(100);
+        FillBytes(bytes, 3, 97);
+        VerifyRange(bytes, 3, 97, (byte)0x5A, (byte)Sentinel);
+
+        sbyte[] sbytes = new sbyte[31];
+        FillSBytes(sbytes);
+        VerifyRange(sbytes, 0, 31, (sbyte)-1, (sbyte)0);
+
+        int[] ints = NewInts(50);
+        FillInts(ints);
+        VerifyRange(ints, 0, 50, 0x5A5A5A5A, Sentinel);
+
+        double[] doubles = new double[40];
+        FillNegativeZero(doubles);
+        foreach (double value in doubles)
+        {
+            Assert.Equal(BitConverter.DoubleToInt64Bits(-0.0), BitConverter.DoubleToInt64Bits(value));
+        }
+    }
+
+    [Fact]
+    public static void OverlappingFills()
+    {
+        byte[] bytes = NewBytes(40);
+        FillBytes(bytes, 0, 30);
+        bytes[10] = 1;
+        FillBytes(bytes, 10, 20);
+        VerifyRange(bytes, 0, 30, (byte)0x5A, (byte)Sentinel);
+
+        int[] array = NewInts(40);
+        ZeroRange(array, 10, 30);
+        ZeroRange(array, 0, 15);
+        VerifyRange(array, 0, 30, 0, Sentinel);
+
+        // The same array passed twice, and two arrays that only overlap in their first elements
+        array = NewInts(32);
+        ZeroTwoArrays(array, array);
+        VerifyRange(array, 0, 32, 0, Sentinel);
+
+        int[] longer = NewInts(32);
+        Assert.Throws<IndexOutOfRangeException>(() => ZeroTwoArrays(longer, new int[16]));
+        VerifyRange(longer, 0, 17, 0, Sentinel);
+
+        // Each store reads the element stored by the previous iteration
+        array = NewInts(32);
+        array[0] = 7;
+        CopyForward(array);
+        VerifyRange(array, 0, 32, 7, Sentinel);
+    }
+
+    [Fact]
+    public static void GcRefFills()
+    {
+        object[] objects = new object[50];
+        Array.Fill(objects, (object)"x");
+        ClearObjects(objects, 10, 40);
+        VerifyRange(objects, 10, 40, null, (object)"x");
+
+        GC.Collect();
+        VerifyRange(objects, 10, 40, null, (object)"x");
+
+        string[] strings = new string[50];
+        FillStrings(strings);
+
+        // The stores must have gone through the write barrier for the strings to survive
+        GC.Collect();
+        VerifyRange(strings, 0, 50, "fill", null);
+    }
+}
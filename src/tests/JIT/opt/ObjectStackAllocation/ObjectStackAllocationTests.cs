@@ -0,0 +1,180 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using Xunit;
+
+// Checks which boxes and arrays the JIT allocates on the stack. Each use kind the escape
+// analysis treats as non-escaping (INDEX_ADDR, ARR_LENGTH, BLK and STORE_BLK) has a
+// non-escaping case that must not allocate on the heap, and an escaping case that must.
+namespace ObjectStackAllocation
+{
+    enum AllocationKind
+    {
+        Heap,
+        Stack,
+        Undefined
+    }
+
+    // Larger than a register so that copies into and out of the box are block copies
+    struct LargeStruct
+    {
+        public long A;
+        public long B;
+        public long C;
+    }
+
+    public class Tests
+    {
+        static object s_escapedObject;
+        static int[] s_escapedArray;
+
+        static AllocationKind s_expectedStackAllocationKind = AllocationKind.Stack;
+
+        delegate int Test();
+
+        static bool GCStressEnabled()
+        {
+            return Environment.GetEnvironmentVariable("DOTNET_GCStress") != null;
+        }
+
+        static bool OptimizationsDisabled()
+        {
+            return (Environment.GetEnvironmentVariable("DOTNET_JitMinOpts") == "1") ||
+                   (Environment.GetEnvironmentVariable("DOTNET_JITMinOpts") == "1") ||
+                   (Environment.GetEnvironmentVariable("DOTNET_JitObjectStackAllocation") != "1");
+        }
+
+        [Fact]
+        public static int TestEntryPoint()
+        {
+            if (GCStressEnabled() || OptimizationsDisabled())
+            {
+                // Allocations may or may not be moved to the stack
+                s_expectedStackAllocationKind = AllocationKind.Undefined;
+            }
+
+            // INDEX_ADDR
+            CallTestAndVerifyAllocation(StoreAndLoadElements, 7, s_expectedStackAllocationKind);
+            CallTestAndVerifyAllocation(ElementAddressEscapes, 3, AllocationKind.Heap);
+
+            // ARR_LENGTH
+            CallTestAndVerifyAllocation(ReadLength, 12, s_expectedStackAllocationKind);
+            CallTestAndVerifyAllocation(ReadLengthOfEscapingArray, 12, AllocationKind.Heap);
+
+            // BLK
+            CallTestAndVerifyAllocation(CopyOutOfBox, 6, s_expectedStackAllocationKind);
+            CallTestAndVerifyAllocation(CopyOutOfEscapingBox, 6, AllocationKind.Heap);
+
+            // STORE_BLK
+            CallTestAndVerifyAllocation(CopyIntoBox, 15, s_expectedStackAllocationKind);
+            CallTestAndVerifyAllocation(CopyIntoEscapingBox, 15, AllocationKind.Heap);
+
+            return 100;
+        }
+
+        static void CallTestAndVerifyAllocation(Test test, int expectedResult, AllocationKind expectedAllocationKind)
+        {
+            string testName = test.Method.Name;
+
+            long allocatedBytesBefore = GC.GetAllocatedBytesForCurrentThread();
+            int testResult = test();
+            long allocatedBytesAfter = GC.GetAllocatedBytesForCurrentThread();
+
+            Assert.True(testResult == expectedResult, $"{testName} returned {testResult}, expected {expectedResult}");
+
+            if (expectedAllocationKind == AllocationKind.Stack)
+            {
+                Assert.True(allocatedBytesBefore == allocatedBytesAfter, $"{testName} allocated {allocatedBytesAfter - allocatedBytesBefore} bytes on the heap");
+            }
+            else if (expectedAllocationKind == AllocationKind.Heap)
+            {
+                Assert.True(allocatedBytesBefore != allocatedBytesAfter, $"{testName} didn't allocate on the heap");
+            }
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int StoreAndLoadElements()
+        {
+            int[] array = new int[4];
+            array[1] = 3;
+            array[2] = 4;
+            return array[0] + array[1] + array[2] + array[3];
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int ElementAddressEscapes()
+        {
+            int[] array = new int[4];
+            array[1] = 3;
+            return ReadThroughByref(ref array[1]);
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int ReadLength()
+        {
+            long[] array = new long[12];
+            return array.Length;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int ReadLengthOfEscapingArray()
+        {
+            int[] array = new int[12];
+            s_escapedArray = array;
+            return array.Length;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int CopyOutOfBox()
+        {
+            LargeStruct s = new LargeStruct { A = 1, B = 2, C = 3 };
+            object o = s;
+            LargeStruct t = (LargeStruct)o;
+            return (int)(t.A + t.B + t.C);
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int CopyOutOfEscapingBox()
+        {
+            LargeStruct s = new LargeStruct { A = 1, B = 2, C = 3 };
+            object o = s;
+            Consume(o);
+            LargeStruct t = (LargeStruct)o;
+            return (int)(t.A + t.B + t.C);
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int CopyIntoBox()
+        {
+            object o = GetLargeStruct();
+            return (int)((LargeStruct)o).C;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int CopyIntoEscapingBox()
+        {
+            object o = GetLargeStruct();
+            s_escapedObject = o;
+            return (int)((LargeStruct)o).C;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static LargeStruct GetLargeStruct()
+        {
+            return new LargeStruct { A = 5, B = 10, C = 15 };
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int ReadThroughByref(ref int value)
+        {
+            return value;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static void Consume(object o)
+        {
+        }
+    }
+}
@@ -0,0 +1,326 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Collections.Generic;
+using System.Runtime.CompilerServices;
+using Xunit;
+
+// Switches whose jump table consists of a few runs of cases with the same target may be
+// lowered into a binary search over the run boundaries (JitSwitchBinarySearchMaxRuns).
+// Checks every value around each run boundary, the ends of the tables and the default
+// case against the ranges the switches were written from.
+public class SwitchBinarySearch
+{
+    const int Default = -1;
+
+    struct Run
+    {
+        public int First;
+        public int Last;
+        public int Result;
+
+        public Run(int first, int last, int result)
+        {
+            First = first;
+            Last = last;
+            Result = result;
+        }
+    }
+
+    static int Expected(Run[] runs, int value)
+    {
+        foreach (Run run in runs)
+        {
+            if ((value >= run.First) && (value <= run.Last))
+            {
+                return run.Result;
+            }
+        }
+
+        return Default;
+    }
+
+    static void Verify(Func<int, int> test, Run[] runs)
+    {
+        var values = new List<long> { int.MinValue, int.MinValue + 1, -1, 0, 1, int.MaxValue };
+        foreach (Run run in runs)
+        {
+            for (long value = (long)run.First - 3; value <= (long)run.Last + 3; value++)
+            {
+                values.Add(value);
+            }
+        }
+
+        foreach (long value in values)
+        {
+            if ((value < int.MinValue) || (value > int.MaxValue))
+            {
+                continue;
+            }
+
+            int expected = Expected(runs, (int)value);
+            int actual = test((int)value);
+            Assert.True(expected == actual, $"{test.Method.Name}({value}) returned {actual}, expected {expected}");
+        }
+    }
+
+    // Two runs, the smallest table the transformation applies to
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int TwoRuns(int value)
+    {
+        switch (value)
+        {
+            case 0:
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            case 7:
+                return 1;
+            case 8:
+            case 9:
+            case 10:
+            case 11:
+            case 12:
+            case 13:
+            case 14:
+            case 15:
+                return 2;
+            default:
+                return Default;
+        }
+    }
+
+    [Fact]
+    public static void TestTwoRuns()
+    {
+        Verify(TwoRuns, new[] { new Run(0, 7, 1), new Run(8, 15, 2) });
+    }
+
+    // A hole in the middle of the table is a run that goes to the default case
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int ThreeRunsWithHole(int value)
+    {
+        switch (value)
+        {
+            case 10:
+            case 11:
+            case 12:
+            case 13:
+            case 14:
+                return 1;
+            case 20:
+            case 21:
+            case 22:
+            case 23:
+            case 24:
+            case 25:
+            case 26:
+            case 27:
+            case 28:
+            case 29:
+                return 2;
+            default:
+                return Default;
+        }
+    }
+
+    [Fact]
+    public static void TestThreeRunsWithHole()
+    {
+        Verify(ThreeRunsWithHole, new[] { new Run(10, 14, 1), new Run(20, 29, 2) });
+    }
+
+    // As many runs as JitSwitchBinarySearchMaxRuns allows by default
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int FourRuns(int value)
+    {
+        switch (value)
+        {
+            case 97:
+            case 98:
+            case 99:
+            case 100:
+            case 101:
+            case 102:
+                return 1;
+            case 103:
+            case 104:
+            case 105:
+            case 106:
+            case 107:
+            case 108:
+            case 109:
+                return 2;
+            case 110:
+            case 111:
+            case 112:
+            case 113:
+            case 114:
+            case 115:
+                return 3;
+            case 116:
+            case 117:
+            case 118:
+            case 119:
+            case 120:
+            case 121:
+            case 122:
+                return 4;
+            default:
+                return Default;
+        }
+    }
+
+    [Fact]
+    public static void TestFourRuns()
+    {
+        Verify(FourRuns, new[] { new Run(97, 102, 1), new Run(103, 109, 2), new Run(110, 115, 3), new Run(116, 122, 4) });
+    }
+
+    // One run more than the default limit, stays a jump table
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int FiveRuns(int value)
+    {
+        switch (value)
+        {
+            case 0:
+            case 1:
+            case 2:
+                return 1;
+            case 3:
+            case 4:
+            case 5:
+                return 2;
+            case 6:
+            case 7:
+            case 8:
+                return 3;
+            case 9:
+            case 10:
+            case 11:
+                return 4;
+            case 12:
+            case 13:
+            case 14:
+                return 5;
+            default:
+                return Default;
+        }
+    }
+
+    [Fact]
+    public static void TestFiveRuns()
+    {
+        Verify(FiveRuns, new[] { new Run(0, 2, 1), new Run(3, 5, 2), new Run(6, 8, 3), new Run(9, 11, 4), new Run(12, 14, 5) });
+    }
+
+    // Cases below zero, the search compares the rebased value as unsigned
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int NegativeRange(int value)
+    {
+        switch (value)
+        {
+            case -20:
+            case -19:
+            case -18:
+            case -17:
+            case -16:
+            case -15:
+            case -14:
+            case -13:
+            case -12:
+            case -11:
+                return 1;
+            case -10:
+            case -9:
+            case -8:
+            case -7:
+            case -6:
+            case -5:
+            case -4:
+            case -3:
+            case -2:
+            case -1:
+                return 2;
+            case 0:
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+                return 3;
+            default:
+                return Default;
+        }
+    }
+
+    [Fact]
+    public static void TestNegativeRange()
+    {
+        Verify(NegativeRange, new[] { new Run(-20, -11, 1), new Run(-10, -1, 2), new Run(0, 5, 3) });
+    }
+
+    // Runs of a single case at both ends of the table
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int SingleCaseRunsAtEdges(int value)
+    {
+        switch (value)
+        {
+            case 0:
+                return 1;
+            case 1:
+            case 2:
+            case 3:
+            case 4:
+            case 5:
+            case 6:
+            case 7:
+            case 8:
+            case 9:
+                return 2;
+            case 10:
+                return 3;
+            default:
+                return Default;
+        }
+    }
+
+    [Fact]
+    public static void TestSingleCaseRunsAtEdges()
+    {
+        Verify(SingleCaseRunsAtEdges, new[] { new Run(0, 0, 1), new Run(1, 9, 2), new Run(10, 10, 3) });
+    }
+
+    // Cases next to int.MaxValue, values past the end must not wrap into the table
+    [MethodImpl(MethodImplOptions.NoInlining | MethodImplOptions.AggressiveOptimization)]
+    static int NearMaxValue(int value)
+    {
+        switch (value)
+        {
+            case int.MaxValue - 9:
+            case int.MaxValue - 8:
+            case int.MaxValue - 7:
+            case int.MaxValue - 6:
+            case int.MaxValue - 5:
+                return 1;
+            case int.MaxValue - 4:
+            case int.MaxValue - 3:
+            case int.MaxValue - 2:
+            case int.MaxValue - 1:
+            case int.MaxValue:
+                return 2;
+            default:
+                return Default;
+        }
+    }
+
+    [Fact]
+    public static void TestNearMaxValue()
+    {
+        Verify(NearMaxValue, new[] { new Run(int.MaxValue - 9, int.MaxValue - 5, 1), new Run(int.MaxValue - 4, int.MaxValue, 2) });
+    }
+}
@@ -0,0 +1,227 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Buffers.Binary;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using System.Linq;
+using System.Reflection;
+
+using Xunit;
+
+// Checks that the profile written with DOTNET_TieredPGO_PersistedProfilePath can be read back by
+// another run, and that the runtime neither crashes nor keeps a damaged profile when the file is
+// corrupt.
+namespace PersistedPgoTest
+{
+    public class Program
+    {
+        // Layout of the file, see PersistedPgoFileHeader and PersistedPgoMethodEntry in pgo.cpp
+        const uint Signature = 0x4F475044;
+        const uint Version = 1;
+        const int HeaderSize = 16;
+        const int EntrySize = 32;
+
+        struct Entry
+        {
+            public uint CodeHash;
+            public uint MethodHash;
+            public uint ILSize;
+            public uint DataOffset;
+            public uint DataSize;
+            public uint NameTableOffset;
+            public uint NameTableSize;
+            public uint NameCount;
+        }
+
+        static string TestDirectory => Path.GetDirectoryName(Assembly.GetExecutingAssembly().Location);
+
+        static void RunWorkload(string profilePath, bool readOnly)
+        {
+            Process process = new Process();
+            process.StartInfo.FileName = Path.Combine(Environment.GetEnvironmentVariable("CORE_ROOT"), "corerun");
+            process.StartInfo.Arguments = Path.Combine(TestDirectory, "PersistedPgoWorkload.dll");
+            process.StartInfo.Environment["DOTNET_TieredCompilation"] = "1";
+            process.StartInfo.Environment["DOTNET_TieredPGO"] = "1";
+            process.StartInfo.Environment["DOTNET_TieredPGO_InstrumentOnlyHotCode"] = "1";
+            process.StartInfo.Environment["DOTNET_TC_CallCountingDelayMs"] = "0";
+            process.StartInfo.Environment["DOTNET_TieredPGO_PersistedProfilePath"] = profilePath;
+            process.StartInfo.Environment["DOTNET_TieredPGO_PersistedProfileReadOnly"] = readOnly ? "1" : "0";
+            process.StartInfo.Environment.Remove("DOTNET_DbgEnableMiniDump");
+
+            process.Start();
+            process.WaitForExit();
+
+            if (process.ExitCode != 100)
+            {
+                throw new Exception($"Workload exited with {process.ExitCode} (readOnly: {readOnly})");
+            }
+        }
+
+        static uint ReadUInt32(byte[] bytes, int offset) => BinaryPrimitives.ReadUInt32LittleEndian(bytes.AsSpan(offset));
+
+        static void WriteUInt32(byte[] bytes, int offset, uint value) => BinaryPrimitives.WriteUInt32LittleEndian(bytes.AsSpan(offset), value);
+
+        static Entry ReadEntry(byte[] bytes, int index)
+        {
+            int offset = HeaderSize + index * EntrySize;
+            return new Entry
+            {
+                CodeHash = ReadUInt32(bytes, offset),
+                MethodHash = ReadUInt32(bytes, offset + 4),
+                ILSize = ReadUInt32(bytes, offset + 8),
+                DataOffset = ReadUInt32(bytes, offset + 12),
+                DataSize = ReadUInt32(bytes, offset + 16),
+                NameTableOffset = ReadUInt32(bytes, offset + 20),
+                NameTableSize = ReadUInt32(bytes, offset + 24),
+                NameCount = ReadUInt32(bytes, offset + 28),
+            };
+        }
+
+        // Validates the structure of the profile and returns its entries
+        static List<Entry> ValidateProfile(string profilePath)
+        {
+            byte[] bytes = File.ReadAllBytes(profilePath);
+            Assert.True(bytes.Length >= HeaderSize, "profile is smaller than its header");
+            Assert.Equal(Signature, ReadUInt32(bytes, 0));
+            Assert.Equal(Version, ReadUInt32(bytes, 4));
+
+            uint methodCount = ReadUInt32(bytes, 8);
+            Assert.True(methodCount > 0, "profile has no methods");
+            Assert.True((long)HeaderSize + (long)methodCount * EntrySize <= bytes.Length, "method table is truncated");
+
+            List<Entry> entries = new List<Entry>();
+            for (int i = 0; i < methodCount; i++)
+            {
+                Entry entry = ReadEntry(bytes, i);
+                Assert.True((long)entry.DataOffset + entry.DataSize <= bytes.Length, "method data is out of bounds");
+                Assert.True((long)entry.NameTableOffset + entry.NameTableSize <= bytes.Length, "name table is out of bounds");
+                Assert.True((long)entry.NameCount * 4 <= entry.NameTableSize, "name table is too small for its names");
+                Assert.True(entry.NameTableOffset % 4 == 0, "name table is not aligned");
+
+                // Lookups binary search the table, so it must be sorted without duplicates
+                if (i > 0)
+                {
+                    Entry previous = entries[i - 1];
+                    Assert.True(previous.CodeHash < entry.CodeHash ||
+                                (previous.CodeHash == entry.CodeHash && previous.MethodHash < entry.MethodHash),
+                                "method table is not sorted");
+                }
+
+                entries.Add(entry);
+            }
+
+            return entries;
+        }
+
+        static string CreateProfile(string name)
+        {
+            string profilePath = Path.Combine(TestDirectory, name);
+            File.Delete(profilePath);
+            RunWorkload(profilePath, readOnly: false);
+            Assert.True(File.Exists(profilePath), "the profile was not written");
+            return profilePath;
+        }
+
+        [Fact]
+        public static void RoundTrip()
+        {
+            string profilePath = CreateProfile("roundtrip.dpgo");
+            List<Entry> entries = ValidateProfile(profilePath);
+
+            // A read only run loads the profile and leaves it as is
+            byte[] original = File.ReadAllBytes(profilePath);
+            RunWorkload(profilePath, readOnly: true);
+            Assert.Equal(original, File.ReadAllBytes(profilePath));
+
+            // Rewriting keeps every method, the ones that skipped instrumentation are carried forward
+            RunWorkload(profilePath, readOnly: false);
+            List<Entry> rewritten = ValidateProfile(profilePath);
+            foreach (Entry entry in entries)
+            {
+                Assert.Contains(rewritten, e => e.CodeHash == entry.CodeHash && e.MethodHash == entry.MethodHash && e.ILSize == entry.ILSize);
+            }
+
+            File.Delete(profilePath);
+        }
+
+        static IEnumerable<(string Name, byte[] Contents)> Corruptions(byte[] valid)
+        {
+            int methodCount = (int)ReadUInt32(valid, 8);
+            int tableEnd = HeaderSize + methodCount * EntrySize;
+
+            yield return ("empty", Array.Empty<byte>());
+            yield return ("shorter than the header", valid.Take(HeaderSize / 2).ToArray());
+            yield return ("truncated method table", valid.Take(HeaderSize + EntrySize / 2).ToArray());
+            yield return ("truncated data", valid.Take(tableEnd + (valid.Length - tableEnd) / 2).ToArray());
+
+            byte[] random = new byte[valid.Length];
+            new Random(42).NextBytes(random);
+            yield return ("random bytes", random);
+
+            byte[] bytes = (byte[])valid.Clone();
+            WriteUInt32(bytes, 0, ~Signature);
+            yield return ("bad signature", bytes);
+
+            bytes = (byte[])valid.Clone();
+            WriteUInt32(bytes, 4, Version + 1);
+            yield return ("unknown version", bytes);
+
+            bytes = (byte[])valid.Clone();
+            WriteUInt32(bytes, 8, uint.MaxValue);
+            yield return ("huge method count", bytes);
+
+            bytes = (byte[])valid.Clone();
+            for (int i = 0; i < methodCount; i++)
+            {
+                WriteUInt32(bytes, HeaderSize + i * EntrySize + 12, uint.MaxValue - 8);
+                WriteUInt32(bytes, HeaderSize + i * EntrySize + 16, 64);
+            }
+            yield return ("data out of bounds", bytes);
+
+            bytes = (byte[])valid.Clone();
+            for (int i = 0; i < methodCount; i++)
+            {
+                WriteUInt32(bytes, HeaderSize + i * EntrySize + 28, uint.MaxValue);
+            }
+            yield return ("huge name count", bytes);
+
+            bytes = (byte[])valid.Clone();
+            for (int i = 0; i < methodCount; i++)
+            {
+                Entry entry = ReadEntry(valid, i);
+                bytes.AsSpan((int)entry.DataOffset, (int)entry.DataSize).Fill(0xFF);
+                bytes.AsSpan((int)entry.NameTableOffset, (int)entry.NameTableSize).Fill(0xFF);
+            }
+            yield return ("garbage method data", bytes);
+        }
+
+        [Fact]
+        public static void CorruptInput()
+        {
+            string validPath = CreateProfile("valid.dpgo");
+            byte[] valid = File.ReadAllBytes(validPath);
+            ValidateProfile(validPath);
+
+            string profilePath = Path.Combine(TestDirectory, "corrupt.dpgo");
+            foreach ((string name, byte[] contents) in Corruptions(valid))
+            {
+                Console.WriteLine($"Corruption: {name}");
+
+                // The corrupt profile is ignored, or the damaged parts of it are
+                File.WriteAllBytes(profilePath, contents);
+                RunWorkload(profilePath, readOnly: true);
+                Assert.Equal(contents, File.ReadAllBytes(profilePath));
+
+                // And it is replaced by a well formed one at shutdown
+                RunWorkload(profilePath, readOnly: false);
+                ValidateProfile(profilePath);
+            }
+
+            File.Delete(profilePath);
+            File.Delete(validPath);
+        }
+    }
+}
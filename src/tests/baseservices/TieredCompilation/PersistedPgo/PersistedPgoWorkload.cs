@@ -0,0 +1,89 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Threading;
+
+// Runs a few hot methods with class probes and branches, so that dynamic PGO collects data
+// for them and the runtime saves it to the persisted profile at shutdown.
+namespace PersistedPgoWorkload
+{
+    public abstract class Shape
+    {
+        public abstract int Area();
+    }
+
+    public sealed class Square : Shape
+    {
+        public int Side = 3;
+        public override int Area() => Side * Side;
+    }
+
+    public sealed class Rectangle : Shape
+    {
+        public int Width = 2;
+        public int Height = 5;
+        public override int Area() => Width * Height;
+    }
+
+    public static class Program
+    {
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int SumAreas(Shape[] shapes)
+        {
+            int sum = 0;
+            foreach (Shape shape in shapes)
+            {
+                sum += shape.Area();
+            }
+            return sum;
+        }
+
+        [MethodImpl(MethodImplOptions.NoInlining)]
+        static int CountOdd(int[] values)
+        {
+            int count = 0;
+            foreach (int value in values)
+            {
+                if ((value & 1) != 0)
+                {
+                    count++;
+                }
+            }
+            return count;
+        }
+
+        public static int Main()
+        {
+            Shape[] shapes = new Shape[64];
+            int[] values = new int[64];
+            for (int i = 0; i < shapes.Length; i++)
+            {
+                shapes[i] = (i % 8 == 0) ? new Rectangle() : new Square();
+                values[i] = i * 7;
+            }
+
+            long result = 0;
+            for (int iteration = 0; iteration < 200; iteration++)
+            {
+                for (int i = 0; i < 100; i++)
+                {
+                    result += SumAreas(shapes) + CountOdd(values);
+                }
+
+                // Give the tiering background work a chance to promote the methods
+                Thread.Sleep(5);
+            }
+
+            int expected = 200 * 100 * (8 * 10 + 56 * 9 + 32);
+            if (result != expected)
+            {
+                Console.WriteLine($"Unexpected result {result}, expected {expected}");
+                return 101;
+            }
+
+            return 100;
+        }
+    }
+}
@@ -0,0 +1,172 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Threading;
+using Xunit;
+
+// A lock that had waiters keeps its sync block only while it stays contended; once it goes a
+// GC without waiters the GC frees the sync block and the object returns to the thin lock
+// state. The locks here alternate between phases of heavy contention and idle phases with GCs
+// in between, so they are inflated, reclaimed and inflated again many times. Mutual exclusion,
+// Wait/Pulse and hash codes must survive every transition.
+public class ContendedLockReclaim
+{
+    const int LockCount = 16;
+    const int Phases = 30;
+    const int IterationsPerPhase = 2000;
+
+    class LockObject
+    {
+        public long Counter;
+    }
+
+    static int s_threadCount = Math.Clamp(Environment.ProcessorCount, 4, 16);
+
+    [Fact]
+    public static void MutualExclusionAcrossReclaims()
+    {
+        var locks = new LockObject[LockCount];
+        var expected = new long[LockCount];
+        var hashCodes = new int[LockCount];
+        for (int i = 0; i < LockCount; i++)
+        {
+            locks[i] = new LockObject();
+
+            // Every other lock also stores its hash code in the sync block, which then must not be reclaimed
+            if ((i & 1) == 0)
+            {
+                hashCodes[i] = locks[i].GetHashCode();
+            }
+        }
+
+        using var phaseStart = new Barrier(s_threadCount + 1);
+        using var phaseEnd = new Barrier(s_threadCount + 1);
+
+        var threads = new Thread[s_threadCount];
+        for (int t = 0; t < s_threadCount; t++)
+        {
+            int thread = t;
+            threads[t] = new Thread(() =>
+            {
+                for (int phase = 0; phase < Phases; phase++)
+                {
+                    phaseStart.SignalAndWait();
+
+                    // Odd phases hammer a few locks so that they get waiters, even phases spread
+                    // out over all of them so that most go uncontended
+                    int lockSpan = ((phase & 1) != 0) ? 2 : LockCount;
+                    for (int i = 0; i < IterationsPerPhase; i++)
+                    {
+                        LockObject lockObject = locks[(thread + i) % lockSpan];
+                        lock (lockObject)
+                        {
+                            long value = lockObject.Counter;
+                            if ((i % 64) == 0)
+                            {
+                                // Hold the lock across a context switch so the others have to wait
+                                Thread.Yield();
+                            }
+                            lockObject.Counter = value + 1;
+                        }
+                    }
+
+                    phaseEnd.SignalAndWait();
+                }
+            });
+            threads[t].Start();
+        }
+
+        for (int phase = 0; phase < Phases; phase++)
+        {
+            phaseStart.SignalAndWait();
+            phaseEnd.SignalAndWait();
+
+            int lockSpan = ((phase & 1) != 0) ? 2 : LockCount;
+            for (int t = 0; t < s_threadCount; t++)
+            {
+                for (int i = 0; i < IterationsPerPhase; i++)
+                {
+                    expected[(t + i) % lockSpan]++;
+                }
+            }
+
+            // The locks are idle now, two GCs give the scan a chance to reclaim their sync blocks
+            GC.Collect();
+            GC.Collect();
+            GC.WaitForPendingFinalizers();
+
+            for (int i = 0; i < LockCount; i++)
+            {
+                Assert.Equal(expected[i], locks[i].Counter);
+                Assert.False(Monitor.IsEntered(locks[i]));
+                if ((i & 1) == 0)
+                {
+                    Assert.Equal(hashCodes[i], locks[i].GetHashCode());
+                }
+            }
+        }
+
+        foreach (Thread thread in threads)
+        {
+            thread.Join();
+        }
+    }
+
+    [Fact]
+    public static void WaitAndPulseAcrossReclaims()
+    {
+        var lockObject = new LockObject();
+
+        for (int round = 0; round < 20; round++)
+        {
+            // Make the lock contended so it gets a monitor event, then let it go idle and collect
+            using (var started = new CountdownEvent(s_threadCount))
+            {
+                var waiters = new Thread[s_threadCount];
+                for (int t = 0; t < s_threadCount; t++)
+                {
+                    waiters[t] = new Thread(() =>
+                    {
+                        lock (lockObject)
+                        {
+                            started.Signal();
+                            while (lockObject.Counter == 0)
+                            {
+                                Monitor.Wait(lockObject);
+                            }
+                            lockObject.Counter++;
+                        }
+                    });
+                    waiters[t].Start();
+                }
+
+                started.Wait();
+                lock (lockObject)
+                {
+                    lockObject.Counter = 1;
+                    Monitor.PulseAll(lockObject);
+                }
+
+                foreach (Thread waiter in waiters)
+                {
+                    waiter.Join();
+                }
+            }
+
+            Assert.Equal(1 + s_threadCount, lockObject.Counter);
+            lockObject.Counter = 0;
+
+            GC.Collect();
+            GC.Collect();
+            GC.WaitForPendingFinalizers();
+
+            // A wait with a timeout on a lock whose sync block may have just been reclaimed
+            lock (lockObject)
+            {
+                Assert.False(Monitor.Wait(lockObject, 1));
+                Assert.True(Monitor.IsEntered(lockObject));
+            }
+        }
+    }
+}